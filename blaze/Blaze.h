@@ -5758,6 +5758,20 @@ namespace blaze {}
 // In the context of OpenMP, the function returns the maximum number of threads OpenMP will use
 // within a parallel region and is therefore equivalent to the \c omp_get_max_threads() function.
 //
+// On NUMA systems the placement of the threads has a significant impact on the performance. In
+// case of OpenMP the placement is controlled by the standard \c OMP_PROC_BIND and \c OMP_PLACES
+// environment variables:
+
+   \code
+   export OMP_PROC_BIND=spread  // Unix systems
+   export OMP_PLACES=cores      // Unix systems
+   \endcode
+
+// Additionally, the memory of large dense vectors and matrices is initialized in parallel by the
+// same threads and with the same partitioning as the subsequent parallel operations, such that
+// each thread primarily works on memory of its local memory node (see the configuration switch
+// \c BLAZE_USE_PARALLEL_FIRST_TOUCH in the configuration file <em>./blaze/config/SMP.h</em>).
+//
 //
 // \n \section openmp_configuration OpenMP Configuration
 // <hr>
@@ -5778,6 +5792,17 @@ namespace blaze {}
 // performance for all possible situations and configurations. They merely provide a reasonable
 // standard for the current CPU generation.
 //
+// For the parallel execution of an operation, the target vector or matrix is split into several
+// blocks per thread, whose boundaries are aligned to the SIMD width and to the cache line size.
+// By default, these blocks are distributed among the threads via guided scheduling. Therefore
+// the workload is rebalanced in case some threads are delayed (as for instance by other processes
+// on a shared host) or in case the work per block varies (as for instance in case of triangular
+// or sparse operands). Both the number of blocks per thread and the loop schedule can be selected
+// via the \c BLAZE_OPENMP_BLOCKS_PER_THREAD and \c BLAZE_OPENMP_SCHEDULING switches in the
+// configuration file <em>./blaze/config/SMP.h</em>. On dedicated NUMA systems static scheduling
+// may be preferable, since it assigns the same parts of the operands to the same threads in all
+// operations.
+//
 //
 // \n \section openmp_first_touch First Touch Policy
 // <hr>
@@ -6000,6 +6025,23 @@ namespace blaze {}
 // In the context of C++11 threads, the function will return the previously specified number of
 // threads.
 //
+// On NUMA systems the placement of the threads has a significant impact on the performance. The
+// worker threads can be pinned to individual CPUs via the environment variable
+// \c BLAZE_THREAD_AFFINITY, which accepts either \c compact (consecutive CPUs, filling one
+// processor package after another), \c scatter (round-robin distribution over the processor
+// packages), or an explicit list of CPUs:
+
+   \code
+   export BLAZE_THREAD_AFFINITY=scatter  // Unix systems
+   export BLAZE_THREAD_AFFINITY=0,2,4-7  // Unix systems
+   set BLAZE_THREAD_AFFINITY=compact     // Windows systems
+   \endcode
+
+// Additionally, the memory of large dense vectors and matrices is initialized in parallel by the
+// worker threads with the same partitioning as the subsequent parallel operations, such that the
+// memory is distributed among the memory nodes of the workers (see the configuration switch
+// \c BLAZE_USE_PARALLEL_FIRST_TOUCH in the configuration file <em>./blaze/config/SMP.h</em>).
+//
 //
 // \n \section cpp_threads_configuration C++11 Thread Configuration
 // <hr>
@@ -6022,6 +6064,88 @@ namespace blaze {}
 // the C++11 thread parallelization.
 //
 //
+// \n \section cpp_threads_async Asynchronous Assignments
+// <hr>
+//
+// By default, an assignment blocks the calling thread until all worker threads have finished
+// their part of the operation. Via the \c asyncAssign() function it is possible to start an
+// assignment without waiting for its completion, which allows to overlap independent large
+// operations. The function returns a \c Future, which can be used to wait for the completion
+// of the assignment:
+
+   \code
+   blaze::DynamicVector<double> y1( A1.rows() ), y2( A2.rows() );
+
+   blaze::Future future( blaze::asyncAssign( y1, A1 * x1 ) );  // Returns immediately
+   y2 = A2 * x2;                                                // Executed concurrently
+   future.wait();                                               // Waits for the first product
+   \endcode
+
+// In contrast to a regular assignment the target is not resized and must not be used as an
+// operand of the assigned expression. In both cases a \c std::invalid_argument exception is
+// thrown. The target and all operands of the expression must neither be destroyed nor modified
+// before the assignment has been completed (the destruction of the last copy of a \c Future
+// blocks until the assignment has been completed). Asynchronous assignments are executed by the
+// process-wide worker threads. In case of the OpenMP parallelization or in case parallelization
+// is deactivated, the \c asyncAssign() function executes the assignment synchronously.
+//
+//
+// \n \section cpp_threads_task_graphs Task Graphs
+// <hr>
+//
+// Sequences of dependent assignments, as for instance the steps of an iterative solver, can be
+// recorded in a \c TaskGraph and executed as a whole. On execution, the dependencies between
+// the recorded assignments are determined from the aliasing of their operands and every
+// assignment is started as soon as all preceding assignments it depends on have been completed.
+// Therefore independent assignments are executed concurrently and the calling thread only waits
+// once for the completion of all assignments:
+
+   \code
+   blaze::TaskGraph graph;
+
+   graph.assign   ( q, A * p );          // Independent of the second assignment
+   graph.assign   ( s, B * p );          // Independent of the first assignment
+   graph.subAssign( r, alpha * q + s );  // Depends on the first two assignments
+
+   graph.run();  // Executes all three assignments and waits for their completion
+   graph.run();  // Executes the recorded assignments once again
+   \endcode
+
+// In contrast to regular assignments the targets are not resized. The targets and operands of
+// the recorded assignments are referenced by the task graph and must not be destroyed before
+// the task graph, whereas scalar factors are copied at the time of the recording. Assignments
+// to views are executed in order with respect to all other assignments. In case of the OpenMP
+// parallelization or in case parallelization is deactivated, all recorded assignments are
+// executed in the order of their recording.
+//
+//
+// \n \section cpp_threads_fused_statements Fused Statements
+// <hr>
+//
+// Sequences of element-wise dense vector operations, as for instance the vector updates of the
+// conjugate gradient method, are usually limited by the memory bandwidth. Evaluating them one
+// after another streams every vector from main memory once per statement. A \c FusedStatements
+// object evaluates the recorded statements block by block instead, i.e. each cache-sized block
+// of all vectors is processed by all statements before proceeding with the next block:
+
+   \code
+   blaze::FusedStatements cg;
+
+   cg.subAssign( r, alpha * Ap );   // r -= alpha * Ap
+   cg.assign   ( p, r + beta * p ); // p  = r + beta * p
+   cg.addAssign( x, alpha * p );    // x += alpha * p
+
+   cg.run();
+   \endcode
+
+// The blocks are distributed among the threads in the same way as by a regular SMP assignment
+// (OpenMP as well as C++11 and Boost threads). Only element-wise statements of equal size can
+// be fused, i.e. operations that require an intermediate evaluation (as for instance
+// matrix/vector multiplications) result in a compilation error. The targets and operands may
+// be dense vectors and dense subvectors, but a target that is also used as an operand has to
+// refer to the same range of elements in all statements.
+//
+//
 // \n \section cpp_threads_known_issues Known Issues
 // <hr>
 //
@@ -6104,7 +6228,9 @@ namespace blaze {}
    \endcode
 
 // In the context of Boost threads, the function will return the previously specified number of
-// threads.
+// threads. As in case of the C++11 thread parallelization, the worker threads can be pinned to
+// individual CPUs via the \c BLAZE_THREAD_AFFINITY environment variable (see
+// \ref cpp_threads_setup).
 //
 //
 // \n \section boost_threads_configuration Boost Thread Configuration
@@ -6189,8 +6315,8 @@ namespace blaze {}
 // Outside the scope of the serial section, all operations are run in parallel (if beneficial for
 // the performance).
 //
-// Note that the \c BLAZE_SERIAL_SECTION must only be used within a single thread of execution.
-// The use of the serial section within several concurrent threads will result undefined behavior!
+// Note that the \c BLAZE_SERIAL_SECTION only affects the thread of execution that enters it, i.e.
+// several concurrent threads can use serial sections independently of each other.
 //
 //
 // \n \section serial_execution_deactivate_parallelism Option 3: Deactivation of Parallel Execution
@@ -6207,6 +6333,42 @@ namespace blaze {}
 // In case the \c BLAZE_USE_SHARED_MEMORY_PARALLELIZATION switch is set to 0, the shared-memory
 // parallelization is deactivated altogether.
 //
+//
+// \n \section serial_execution_thread_limit Limiting the Number of Threads
+// <hr>
+//
+// In between a fully parallel and a serial execution, the number of threads that are used by
+// parallel operations can be restricted via the \c BLAZE_THREAD_LIMIT. The limit can either be
+// applied to a block of expressions or to a single statement:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C, D;
+   // ... Resizing and initialization
+
+   // All operations within the section use at most two threads
+   BLAZE_THREAD_LIMIT( 2 )
+   {
+      C = A + B;
+      D = A * B;
+   }
+
+   // Only this single assignment is restricted to four threads
+   BLAZE_THREAD_LIMIT( 4 ) D = A * B;
+   \endcode
+
+// In contrast to the \c BLAZE_SERIAL_SECTION, thread limits may be nested, in which case the
+// smaller of the two limits is in effect. A limit of 1 is equivalent to a serial section and a
+// limit of 0 results in a \a std::invalid_argument exception. The limit is kept separately for
+// every thread of execution and is also applied to asynchronous assignments that are started
+// within the section.
+//
+// Independent of any explicit limit, \b Blaze detects nested parallelism and avoids oversubscribing
+// the machine. In case a parallel operation is executed within an OpenMP parallel region, the
+// number of threads is restricted according to the number of active levels and the size of the
+// enclosing teams (see \c omp_set_max_active_levels()). In case several threads execute parallel
+// operations by means of the C++11 or Boost thread parallelization at the same time, the threads
+// of the thread pool are divided evenly among all concurrently running operations.
+//
 // \n <center> Previous: \ref cpp_threads_parallelization &nbsp; &nbsp; Next: \ref vector_serialization </center>
 */
 //*************************************************************************************************
@@ -6594,6 +6756,28 @@ namespace blaze {}
 // the OpenMP-based parallelization, are contained within the configuration file
 // <em>./blaze/config/Thresholds.h</em>.
 //
+// The \c thresholds binary of the \b Blaze benchmark suite determines the crossover points of
+// all thresholds on the current machine. It compares the single-threaded and the parallel
+// execution of each operation (and, in case BLAS is enabled, the \b Blaze and the BLAS kernels)
+// for increasing problem sizes and writes both a replacement of the configuration file and a
+// threshold file. The SMP thresholds are tuned for the number of threads the tool is run with:
+
+   \code
+   BLAZE_NUM_THREADS=8 ./bin/thresholds -o Thresholds.h -r thresholds.cfg
+   \endcode
+
+// Alternatively, the thresholds can be set at runtime. In case the \c BLAZE_USE_RUNTIME_THRESHOLDS
+// switch is set to 1, the thresholds are loaded from the file specified by the environment
+// variable \c BLAZE_THRESHOLD_FILE at program start and can be queried and adapted via the
+// getThreshold(), setThreshold(), and loadThresholds() functions:
+
+   \code
+   blaze::setThreshold( "SMP_DVECDVECADD_THRESHOLD", 50000UL );
+   blaze::loadThresholds( "thresholds.cfg" );
+   \endcode
+
+// Note however that in this mode the thresholds are no longer compile time constants.
+//
 //
 // \n \section streaming Streaming (Non-Temporal Stores)
 //
@@ -41,8 +41,12 @@
 //*************************************************************************************************
 
 #include <blaze/math/Accuracy.h>
+#include <blaze/math/BandMatrix.h>
 #include <blaze/math/BLAS.h>
+#include <blaze/math/BlockCompressedMatrix.h>
+#include <blaze/math/CompactDiagonalMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedSoAMatrix.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Constants.h>
 #include <blaze/math/Constraints.h>
@@ -57,15 +61,20 @@
 #include <blaze/math/LowerMatrix.h>
 #include <blaze/math/Serialization.h>
 #include <blaze/math/Shims.h>
+#include <blaze/math/SlicedEllpackMatrix.h>
 #include <blaze/math/SMP.h>
 #include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticMatrixBatch.h>
 #include <blaze/math/StaticVector.h>
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/StrictlyLowerMatrix.h>
 #include <blaze/math/StrictlyUpperMatrix.h>
+#include <blaze/math/SymmetricCompressedMatrix.h>
 #include <blaze/math/SymmetricMatrix.h>
+#include <blaze/math/SymmetricPackedMatrix.h>
 #include <blaze/math/Traits.h>
 #include <blaze/math/TransposeFlag.h>
+#include <blaze/math/TriangularPackedMatrix.h>
 #include <blaze/math/TypeTraits.h>
 #include <blaze/math/UniLowerMatrix.h>
 #include <blaze/math/UniUpperMatrix.h>
@@ -51,4 +51,103 @@ namespace blaze {
 #define BLAZE_USE_SHARED_MEMORY_PARALLELIZATION 1
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the (de-)activation of the parallel first-touch initialization.
+// \ingroup config
+//
+// This compilation switch enables/disables the parallel initialization of the memory of large
+// dense vectors and matrices (i.e. DynamicVector and DynamicMatrix). On NUMA systems a memory
+// page is placed on the memory node of the thread that first writes to it. In case the switch
+// is set to 1 (i.e. in case the parallel first-touch initialization is enabled), newly allocated
+// memory of a vector or matrix that is large enough to be assigned in parallel (see the SMP
+// assignment thresholds in <em>./blaze/config/Thresholds.h</em>) is initialized in parallel with
+// the same partitioning as the subsequent parallel assignments. In case the OpenMP-based
+// parallelization with a static schedule is used (see the \c BLAZE_OPENMP_SCHEDULING setting),
+// every block is initialized by the thread that later assigns it and therefore the parallel
+// operations primarily access memory of their local memory node. Since the C++11 and Boost
+// thread pools distribute the blocks to whichever thread is idle, in these cases the placement
+// of the memory pages only approximates the placement of the work. In case the switch is set to
+// 0, newly allocated memory is initialized by the allocating thread. Note that this switch has
+// no effect in case the shared-memory parallelization is disabled. This switch can also be
+// specified on the command line (for instance via the -DBLAZE_USE_PARALLEL_FIRST_TOUCH=1
+// compiler flag).
+//
+// Possible settings for the parallel first-touch initialization switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+*/
+#ifndef BLAZE_USE_PARALLEL_FIRST_TOUCH
+#define BLAZE_USE_PARALLEL_FIRST_TOUCH 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the low-latency mode of the thread-based parallelization.
+// \ingroup config
+//
+// This compilation switch selects the worker threads of the C++11 and Boost thread-based
+// parallelization. In case the switch is set to 0, the tasks of a parallel operation are passed
+// to the worker threads via a mutex-protected task queue and idle workers sleep on a condition
+// variable. In case the switch is set to 1, every worker owns a lock-free dispatch slot, which it
+// actively polls for new tasks, and the scheduling thread actively waits for the completion of
+// the tasks. This reduces the latency of a parallel operation from tens of microseconds to a
+// few microseconds and allows considerably smaller SMP thresholds (see the configuration file
+// <em>./blaze/config/Thresholds.h</em>), at the price of keeping the CPUs of the workers busy
+// for a short period of time after each operation. Therefore the low-latency mode should only
+// be used in case the number of threads doesn't exceed the number of available cores. Note
+// that this switch has no effect on the OpenMP-based parallelization.
+//
+// Possible settings for the low-latency switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+*/
+#define BLAZE_USE_SPINNING_WORKERS 0
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the loop scheduling of the OpenMP-based parallelization.
+// \ingroup config
+//
+// This compilation switch selects the OpenMP loop schedule used to distribute the blocks of an
+// OpenMP parallel assignment among the threads (see also \c BLAZE_OPENMP_BLOCKS_PER_THREAD).
+// In case the switch is set to 0, every thread is statically assigned a contiguous range of
+// blocks. This results in the same partitioning as the parallel first-touch initialization and
+// therefore provides the best memory locality on NUMA systems, but cannot compensate for
+// threads that are delayed (as for instance by other processes on a shared host) or for an
+// irregular workload (as for instance in case of triangular or sparse operands). In case the
+// switch is set to 1, the blocks are assigned one by one to the next idle thread, and in case
+// the switch is set to 2, idle threads are assigned chunks of blocks that shrink proportionally
+// to the number of remaining blocks. Guided scheduling combines a low scheduling overhead with
+// the ability to rebalance the workload at the end of an operation. Note that this switch has
+// no effect on the C++11 and Boost thread-based parallelizations.
+//
+// Possible settings for the OpenMP loop scheduling switch:
+//  - Static scheduling : \b 0
+//  - Dynamic scheduling: \b 1
+//  - Guided scheduling : \b 2 (default)
+*/
+#define BLAZE_OPENMP_SCHEDULING 2
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The number of blocks per thread of an OpenMP parallel assignment.
+// \ingroup config
+//
+// This value specifies the over-decomposition of the OpenMP-based parallelization, i.e. the
+// number of blocks per thread into which the target of a parallel assignment is split. The
+// boundaries of all blocks are aligned to the SIMD width and to the cache line size of the
+// target, such that the blocks can be assigned by means of vectorized kernels and such that
+// no two threads write to the same cache line. A value of 1 corresponds to the classical
+// partitioning with a single block per thread. Larger values enable the loop schedule (see
+// \c BLAZE_OPENMP_SCHEDULING) to rebalance the workload, at the price of a slightly higher
+// scheduling overhead and of shorter inner loops. Note that the number of blocks per thread
+// must be at least 1.
+*/
+#define BLAZE_OPENMP_BLOCKS_PER_THREAD 4
+//*************************************************************************************************
+
 } // namespace blaze
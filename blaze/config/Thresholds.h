@@ -33,6 +33,46 @@
 //=================================================================================================
 
 
+//=================================================================================================
+//
+//  RUNTIME THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime configuration of the thresholds.
+// \ingroup config
+//
+// This compilation switch selects between compile time and runtime thresholds. In case the
+// switch is set to 0, all thresholds of this file are compile time constants. In case it is set
+// to 1, the values of this file merely serve as default values and all thresholds can be changed
+// at runtime. At program startup the thresholds are loaded from the file specified via the
+// \c BLAZE_THRESHOLD_FILE environment variable (if defined):
+
+   \code
+   export BLAZE_THRESHOLD_FILE=/etc/blaze/thresholds.cfg
+   \endcode
+
+// Afterwards the thresholds can be queried and modified via the getThreshold(), setThreshold()
+// and loadThresholds() functions. A suitable threshold file for the current machine is written
+// by the \c thresholds tool of the Blaze benchmark suite (see the blazemark directory), which
+// also creates a tuned replacement for this configuration file. Note that the runtime mode adds
+// a memory access to every threshold check and prevents the compiler from discarding code paths
+// based on the thresholds. This switch can also be specified on the command line (for instance
+// via the -DBLAZE_USE_RUNTIME_THRESHOLDS=1 compiler flag).
+//
+// Possible settings for the runtime threshold switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+*/
+#ifndef BLAZE_USE_RUNTIME_THRESHOLDS
+#define BLAZE_USE_RUNTIME_THRESHOLDS 0
+#endif
+//*************************************************************************************************
+
+
+
+
 namespace blaze {
 
 //=================================================================================================
@@ -54,7 +94,7 @@ namespace blaze {
 // The default setting for this threshold is 4000000 (which for instance corresponds to a matrix
 // size of \f$ 2000 \times 2000 \f$).
 */
-const size_t DMATDVECMULT_THRESHOLD = 4000000UL;
+BLAZE_THRESHOLD( DMATDVECMULT_THRESHOLD, 4000000UL );
 //*************************************************************************************************
 
 
@@ -71,7 +111,7 @@ const size_t DMATDVECMULT_THRESHOLD = 4000000UL;
 // The default setting for this threshold is 62500 (which for instance corresponds to a matrix
 // size of \f$ 250 \times 250 \f$).
 */
-const size_t TDMATDVECMULT_THRESHOLD = 62500UL;
+BLAZE_THRESHOLD( TDMATDVECMULT_THRESHOLD, 62500UL );
 //*************************************************************************************************
 
 
@@ -88,7 +128,7 @@ const size_t TDMATDVECMULT_THRESHOLD = 62500UL;
 // The default setting for this threshold is 62500 (which for instance corresponds to a matrix
 // size of \f$ 250 \times 250 \f$).
 */
-const size_t TDVECDMATMULT_THRESHOLD = 62500UL;
+BLAZE_THRESHOLD( TDVECDMATMULT_THRESHOLD, 62500UL );
 //*************************************************************************************************
 
 
@@ -105,7 +145,7 @@ const size_t TDVECDMATMULT_THRESHOLD = 62500UL;
 // The default setting for this threshold is 4000000 (which for instance corresponds to a matrix
 // size of \f$ 2000 \times 2000 \f$).
 */
-const size_t TDVECTDMATMULT_THRESHOLD = 4000000UL;
+BLAZE_THRESHOLD( TDVECTDMATMULT_THRESHOLD, 4000000UL );
 //*************************************************************************************************
 
 
@@ -122,7 +162,7 @@ const size_t TDVECTDMATMULT_THRESHOLD = 4000000UL;
 // The default setting for this threshold is 10000 (which for instance corresponds to a matrix
 // size of \f$ 100 \times 100 \f$).
 */
-const size_t DMATDMATMULT_THRESHOLD = 10000UL;
+BLAZE_THRESHOLD( DMATDMATMULT_THRESHOLD, 10000UL );
 //*************************************************************************************************
 
 
@@ -139,7 +179,7 @@ const size_t DMATDMATMULT_THRESHOLD = 10000UL;
 // The default setting for this threshold is 10000 (which for instance corresponds to a matrix
 // size of \f$ 100 \times 100 \f$).
 */
-const size_t DMATTDMATMULT_THRESHOLD = 10000UL;
+BLAZE_THRESHOLD( DMATTDMATMULT_THRESHOLD, 10000UL );
 //*************************************************************************************************
 
 
@@ -156,7 +196,7 @@ const size_t DMATTDMATMULT_THRESHOLD = 10000UL;
 // The default setting for this threshold is 10000 (which for instance corresponds to a matrix
 // size of \f$ 100 \times 100 \f$).
 */
-const size_t TDMATDMATMULT_THRESHOLD = 10000UL;
+BLAZE_THRESHOLD( TDMATDMATMULT_THRESHOLD, 10000UL );
 //*************************************************************************************************
 
 
@@ -173,7 +213,7 @@ const size_t TDMATDMATMULT_THRESHOLD = 10000UL;
 // The default setting for this threshold is 10000 (which for instance corresponds to a matrix
 // size of \f$ 100 \times 100 \f$).
 */
-const size_t TDMATTDMATMULT_THRESHOLD = 10000UL;
+BLAZE_THRESHOLD( TDMATTDMATMULT_THRESHOLD, 10000UL );
 //*************************************************************************************************
 
 
@@ -204,7 +244,7 @@ const size_t TDMATTDMATMULT_THRESHOLD = 10000UL;
 // The default setting for this threshold is 38000. In case the threshold is set to 0, the
 // operation is unconditionally executed in parallel.
 */
-const size_t SMP_DVECASSIGN_THRESHOLD = 38000UL;
+BLAZE_THRESHOLD( SMP_DVECASSIGN_THRESHOLD, 38000UL );
 //*************************************************************************************************
 
 
@@ -227,7 +267,7 @@ const size_t SMP_DVECASSIGN_THRESHOLD = 38000UL;
 // The default setting for this threshold is 38000. In case the threshold is set to 0, the
 // operation is unconditionally executed in parallel.
 */
-const size_t SMP_DVECDVECADD_THRESHOLD = 38000UL;
+BLAZE_THRESHOLD( SMP_DVECDVECADD_THRESHOLD, 38000UL );
 //*************************************************************************************************
 
 
@@ -250,7 +290,7 @@ const size_t SMP_DVECDVECADD_THRESHOLD = 38000UL;
 // The default setting for this threshold is 38000. In case the threshold is set to 0, the
 // operation is unconditionally executed in parallel.
 */
-const size_t SMP_DVECDVECSUB_THRESHOLD = 38000UL;
+BLAZE_THRESHOLD( SMP_DVECDVECSUB_THRESHOLD, 38000UL );
 //*************************************************************************************************
 
 
@@ -273,7 +313,7 @@ const size_t SMP_DVECDVECSUB_THRESHOLD = 38000UL;
 // The default setting for this threshold is 38000. In case the threshold is set to 0, the
 // operation is unconditionally executed in parallel.
 */
-const size_t SMP_DVECDVECMULT_THRESHOLD = 38000UL;
+BLAZE_THRESHOLD( SMP_DVECDVECMULT_THRESHOLD, 38000UL );
 //*************************************************************************************************
 
 
@@ -296,7 +336,7 @@ const size_t SMP_DVECDVECMULT_THRESHOLD = 38000UL;
 // The default setting for this threshold is 51000. In case the threshold is set to 0, the
 // operation is unconditionally executed in parallel.
 */
-const size_t SMP_DVECSCALARMULT_THRESHOLD = 51000UL;
+BLAZE_THRESHOLD( SMP_DVECSCALARMULT_THRESHOLD, 51000UL );
 //*************************************************************************************************
 
 
@@ -319,7 +359,7 @@ const size_t SMP_DVECSCALARMULT_THRESHOLD = 51000UL;
 // The default setting for this threshold is 330. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATDVECMULT_THRESHOLD = 330UL;
+BLAZE_THRESHOLD( SMP_DMATDVECMULT_THRESHOLD, 330UL );
 //*************************************************************************************************
 
 
@@ -342,7 +382,7 @@ const size_t SMP_DMATDVECMULT_THRESHOLD = 330UL;
 // The default setting for this threshold is 360. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TDMATDVECMULT_THRESHOLD = 360UL;
+BLAZE_THRESHOLD( SMP_TDMATDVECMULT_THRESHOLD, 360UL );
 //*************************************************************************************************
 
 
@@ -365,7 +405,7 @@ const size_t SMP_TDMATDVECMULT_THRESHOLD = 360UL;
 // The default setting for this threshold is 370. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TDVECDMATMULT_THRESHOLD = 370UL;
+BLAZE_THRESHOLD( SMP_TDVECDMATMULT_THRESHOLD, 370UL );
 //*************************************************************************************************
 
 
@@ -388,7 +428,7 @@ const size_t SMP_TDVECDMATMULT_THRESHOLD = 370UL;
 // The default setting for this threshold is 340. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TDVECTDMATMULT_THRESHOLD = 340UL;
+BLAZE_THRESHOLD( SMP_TDVECTDMATMULT_THRESHOLD, 340UL );
 //*************************************************************************************************
 
 
@@ -411,7 +451,7 @@ const size_t SMP_TDVECTDMATMULT_THRESHOLD = 340UL;
 // The default setting for this threshold is 480. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATSVECMULT_THRESHOLD = 480UL;
+BLAZE_THRESHOLD( SMP_DMATSVECMULT_THRESHOLD, 480UL );
 //*************************************************************************************************
 
 
@@ -434,7 +474,7 @@ const size_t SMP_DMATSVECMULT_THRESHOLD = 480UL;
 // The default setting for this threshold is 910. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TDMATSVECMULT_THRESHOLD = 910UL;
+BLAZE_THRESHOLD( SMP_TDMATSVECMULT_THRESHOLD, 910UL );
 //*************************************************************************************************
 
 
@@ -457,7 +497,7 @@ const size_t SMP_TDMATSVECMULT_THRESHOLD = 910UL;
 // The default setting for this threshold is 910. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TSVECDMATMULT_THRESHOLD = 910UL;
+BLAZE_THRESHOLD( SMP_TSVECDMATMULT_THRESHOLD, 910UL );
 //*************************************************************************************************
 
 
@@ -480,7 +520,7 @@ const size_t SMP_TSVECDMATMULT_THRESHOLD = 910UL;
 // The default setting for this threshold is 480. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TSVECTDMATMULT_THRESHOLD = 480UL;
+BLAZE_THRESHOLD( SMP_TSVECTDMATMULT_THRESHOLD, 480UL );
 //*************************************************************************************************
 
 
@@ -503,7 +543,7 @@ const size_t SMP_TSVECTDMATMULT_THRESHOLD = 480UL;
 // The default setting for this threshold is 600. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_SMATDVECMULT_THRESHOLD = 600UL;
+BLAZE_THRESHOLD( SMP_SMATDVECMULT_THRESHOLD, 600UL );
 //*************************************************************************************************
 
 
@@ -526,7 +566,7 @@ const size_t SMP_SMATDVECMULT_THRESHOLD = 600UL;
 // The default setting for this threshold is 1250. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TSMATDVECMULT_THRESHOLD = 1250UL;
+BLAZE_THRESHOLD( SMP_TSMATDVECMULT_THRESHOLD, 1250UL );
 //*************************************************************************************************
 
 
@@ -549,7 +589,7 @@ const size_t SMP_TSMATDVECMULT_THRESHOLD = 1250UL;
 // The default setting for this threshold is 1190. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TDVECSMATMULT_THRESHOLD = 1190UL;
+BLAZE_THRESHOLD( SMP_TDVECSMATMULT_THRESHOLD, 1190UL );
 //*************************************************************************************************
 
 
@@ -572,7 +612,7 @@ const size_t SMP_TDVECSMATMULT_THRESHOLD = 1190UL;
 // The default setting for this threshold is 530. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TDVECTSMATMULT_THRESHOLD = 530UL;
+BLAZE_THRESHOLD( SMP_TDVECTSMATMULT_THRESHOLD, 530UL );
 //*************************************************************************************************
 
 
@@ -595,7 +635,7 @@ const size_t SMP_TDVECTSMATMULT_THRESHOLD = 530UL;
 // The default setting for this threshold is 260. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_SMATSVECMULT_THRESHOLD = 260UL;
+BLAZE_THRESHOLD( SMP_SMATSVECMULT_THRESHOLD, 260UL );
 //*************************************************************************************************
 
 
@@ -618,7 +658,7 @@ const size_t SMP_SMATSVECMULT_THRESHOLD = 260UL;
 // The default setting for this threshold is 2160. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TSMATSVECMULT_THRESHOLD = 2160UL;
+BLAZE_THRESHOLD( SMP_TSMATSVECMULT_THRESHOLD, 2160UL );
 //*************************************************************************************************
 
 
@@ -641,7 +681,7 @@ const size_t SMP_TSMATSVECMULT_THRESHOLD = 2160UL;
 // The default setting for this threshold is 2160. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TSVECSMATMULT_THRESHOLD = 2160UL;
+BLAZE_THRESHOLD( SMP_TSVECSMATMULT_THRESHOLD, 2160UL );
 //*************************************************************************************************
 
 
@@ -664,7 +704,7 @@ const size_t SMP_TSVECSMATMULT_THRESHOLD = 2160UL;
 // The default setting for this threshold is 260. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TSVECTSMATMULT_THRESHOLD = 260UL;
+BLAZE_THRESHOLD( SMP_TSVECTSMATMULT_THRESHOLD, 260UL );
 //*************************************************************************************************
 
 
@@ -687,7 +727,7 @@ const size_t SMP_TSVECTSMATMULT_THRESHOLD = 260UL;
 // The default setting for this threshold is 220. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATASSIGN_THRESHOLD = 220UL;
+BLAZE_THRESHOLD( SMP_DMATASSIGN_THRESHOLD, 220UL );
 //*************************************************************************************************
 
 
@@ -711,7 +751,7 @@ const size_t SMP_DMATASSIGN_THRESHOLD = 220UL;
 // The default setting for this threshold is 190. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATDMATADD_THRESHOLD = 190UL;
+BLAZE_THRESHOLD( SMP_DMATDMATADD_THRESHOLD, 190UL );
 //*************************************************************************************************
 
 
@@ -736,7 +776,7 @@ const size_t SMP_DMATDMATADD_THRESHOLD = 190UL;
 // The default setting for this threshold is 175. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATTDMATADD_THRESHOLD = 175UL;
+BLAZE_THRESHOLD( SMP_DMATTDMATADD_THRESHOLD, 175UL );
 //*************************************************************************************************
 
 
@@ -760,7 +800,7 @@ const size_t SMP_DMATTDMATADD_THRESHOLD = 175UL;
 // The default setting for this threshold is 190. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATDMATSUB_THRESHOLD = 190UL;
+BLAZE_THRESHOLD( SMP_DMATDMATSUB_THRESHOLD, 190UL );
 //*************************************************************************************************
 
 
@@ -785,7 +825,7 @@ const size_t SMP_DMATDMATSUB_THRESHOLD = 190UL;
 // The default setting for this threshold is 175. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATTDMATSUB_THRESHOLD = 175UL;
+BLAZE_THRESHOLD( SMP_DMATTDMATSUB_THRESHOLD, 175UL );
 //*************************************************************************************************
 
 
@@ -808,7 +848,7 @@ const size_t SMP_DMATTDMATSUB_THRESHOLD = 175UL;
 // The default setting for this threshold is 220. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATSCALARMULT_THRESHOLD = 220UL;
+BLAZE_THRESHOLD( SMP_DMATSCALARMULT_THRESHOLD, 220UL );
 //*************************************************************************************************
 
 
@@ -831,7 +871,7 @@ const size_t SMP_DMATSCALARMULT_THRESHOLD = 220UL;
 // The default setting for this threshold is 55. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATDMATMULT_THRESHOLD = 55UL;
+BLAZE_THRESHOLD( SMP_DMATDMATMULT_THRESHOLD, 55UL );
 //*************************************************************************************************
 
 
@@ -854,7 +894,7 @@ const size_t SMP_DMATDMATMULT_THRESHOLD = 55UL;
 // The default setting for this threshold is 55. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATTDMATMULT_THRESHOLD = 55UL;
+BLAZE_THRESHOLD( SMP_DMATTDMATMULT_THRESHOLD, 55UL );
 //*************************************************************************************************
 
 
@@ -877,7 +917,7 @@ const size_t SMP_DMATTDMATMULT_THRESHOLD = 55UL;
 // The default setting for this threshold is 55. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TDMATDMATMULT_THRESHOLD = 55UL;
+BLAZE_THRESHOLD( SMP_TDMATDMATMULT_THRESHOLD, 55UL );
 //*************************************************************************************************
 
 
@@ -900,7 +940,7 @@ const size_t SMP_TDMATDMATMULT_THRESHOLD = 55UL;
 // The default setting for this threshold is 55. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TDMATTDMATMULT_THRESHOLD = 55UL;
+BLAZE_THRESHOLD( SMP_TDMATTDMATMULT_THRESHOLD, 55UL );
 //*************************************************************************************************
 
 
@@ -923,7 +963,7 @@ const size_t SMP_TDMATTDMATMULT_THRESHOLD = 55UL;
 // The default setting for this threshold is 64. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATSMATMULT_THRESHOLD = 64UL;
+BLAZE_THRESHOLD( SMP_DMATSMATMULT_THRESHOLD, 64UL );
 //*************************************************************************************************
 
 
@@ -946,7 +986,7 @@ const size_t SMP_DMATSMATMULT_THRESHOLD = 64UL;
 // The default setting for this threshold is 68. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DMATTSMATMULT_THRESHOLD = 68UL;
+BLAZE_THRESHOLD( SMP_DMATTSMATMULT_THRESHOLD, 68UL );
 //*************************************************************************************************
 
 
@@ -969,7 +1009,7 @@ const size_t SMP_DMATTSMATMULT_THRESHOLD = 68UL;
 // The default setting for this threshold is 90. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TDMATSMATMULT_THRESHOLD = 90UL;
+BLAZE_THRESHOLD( SMP_TDMATSMATMULT_THRESHOLD, 90UL );
 //*************************************************************************************************
 
 
@@ -992,7 +1032,7 @@ const size_t SMP_TDMATSMATMULT_THRESHOLD = 90UL;
 // The default setting for this threshold is 90. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TDMATTSMATMULT_THRESHOLD = 90UL;
+BLAZE_THRESHOLD( SMP_TDMATTSMATMULT_THRESHOLD, 90UL );
 //*************************************************************************************************
 
 
@@ -1015,7 +1055,7 @@ const size_t SMP_TDMATTSMATMULT_THRESHOLD = 90UL;
 // The default setting for this threshold is 88. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_SMATDMATMULT_THRESHOLD = 88UL;
+BLAZE_THRESHOLD( SMP_SMATDMATMULT_THRESHOLD, 88UL );
 //*************************************************************************************************
 
 
@@ -1038,7 +1078,7 @@ const size_t SMP_SMATDMATMULT_THRESHOLD = 88UL;
 // The default setting for this threshold is 72. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_SMATTDMATMULT_THRESHOLD = 72UL;
+BLAZE_THRESHOLD( SMP_SMATTDMATMULT_THRESHOLD, 72UL );
 //*************************************************************************************************
 
 
@@ -1061,7 +1101,7 @@ const size_t SMP_SMATTDMATMULT_THRESHOLD = 72UL;
 // The default setting for this threshold is 66. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TSMATDMATMULT_THRESHOLD = 66UL;
+BLAZE_THRESHOLD( SMP_TSMATDMATMULT_THRESHOLD, 66UL );
 //*************************************************************************************************
 
 
@@ -1084,7 +1124,7 @@ const size_t SMP_TSMATDMATMULT_THRESHOLD = 66UL;
 // The default setting for this threshold is 66. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TSMATTDMATMULT_THRESHOLD = 66UL;
+BLAZE_THRESHOLD( SMP_TSMATTDMATMULT_THRESHOLD, 66UL );
 //*************************************************************************************************
 
 
@@ -1107,7 +1147,7 @@ const size_t SMP_TSMATTDMATMULT_THRESHOLD = 66UL;
 // The default setting for this threshold is 150. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_SMATSMATMULT_THRESHOLD = 150UL;
+BLAZE_THRESHOLD( SMP_SMATSMATMULT_THRESHOLD, 150UL );
 //*************************************************************************************************
 
 
@@ -1130,7 +1170,7 @@ const size_t SMP_SMATSMATMULT_THRESHOLD = 150UL;
 // The default setting for this threshold is 140. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_SMATTSMATMULT_THRESHOLD = 140UL;
+BLAZE_THRESHOLD( SMP_SMATTSMATMULT_THRESHOLD, 140UL );
 //*************************************************************************************************
 
 
@@ -1153,7 +1193,7 @@ const size_t SMP_SMATTSMATMULT_THRESHOLD = 140UL;
 // The default setting for this threshold is 140. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TSMATSMATMULT_THRESHOLD = 140UL;
+BLAZE_THRESHOLD( SMP_TSMATSMATMULT_THRESHOLD, 140UL );
 //*************************************************************************************************
 
 
@@ -1176,7 +1216,7 @@ const size_t SMP_TSMATSMATMULT_THRESHOLD = 140UL;
 // The default setting for this threshold is 150. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_TSMATTSMATMULT_THRESHOLD = 150UL;
+BLAZE_THRESHOLD( SMP_TSMATTSMATMULT_THRESHOLD, 150UL );
 //*************************************************************************************************
 
 
@@ -1199,7 +1239,53 @@ const size_t SMP_TSMATTSMATMULT_THRESHOLD = 150UL;
 // The default setting for this threshold is 290. In case the threshold is set to 0, the operation
 // is unconditionally executed in parallel.
 */
-const size_t SMP_DVECTDVECMULT_THRESHOLD = 290UL;
+BLAZE_THRESHOLD( SMP_DVECTDVECMULT_THRESHOLD, 290UL );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP batch operation threshold.
+// \ingroup config
+//
+// This threshold specifies when an operation on a batch of small matrices or vectors (see the
+// StaticMatrixBatch and StaticVectorBatch class templates) can be executed in parallel. In case
+// the number of matrices/vectors of the batch is larger or equal to this threshold, the batch is
+// processed in parallel. If the number of matrices/vectors is below this threshold the operation
+// is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the batch operations are only
+// parallelized by means of OpenMP.
+//
+// The default setting for this threshold is 2000. In case the threshold is set to 0, the operation
+// is unconditionally executed in parallel.
+*/
+BLAZE_THRESHOLD( SMP_BATCH_THRESHOLD, 2000UL );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP batch matrix multiplication threshold.
+// \ingroup config
+//
+// This threshold specifies when a batch of dense matrix/dense matrix multiplications (see the
+// batchMult() function) can be executed in parallel. In case the total number of multiply-add
+// operations of all products of the batch is larger or equal to this threshold, the products
+// are distributed among the available threads. If the number of operations is below this
+// threshold the products are computed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 1000000 (which corresponds to a single product of
+// two \f$ 100 \times 100 \f$ matrices). In case the threshold is set to 0, the batch is
+// unconditionally executed in parallel.
+*/
+BLAZE_THRESHOLD( SMP_BATCHMULT_THRESHOLD, 1000000UL );
 //*************************************************************************************************
 
 } // namespace blaze
@@ -65,36 +65,37 @@ namespace blaze {
 // This specialization of the Rand class creates random instances of CompressedMatrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-class Rand< CompressedMatrix<Type,SO> >
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+class Rand< CompressedMatrix<Type,SO,IT> >
 {
  public:
    //**Generate functions**************************************************************************
    /*!\name Generate functions */
    //@{
-   inline const CompressedMatrix<Type,SO> generate( size_t m, size_t n ) const;
-   inline const CompressedMatrix<Type,SO> generate( size_t m, size_t n, size_t nonzeros ) const;
+   inline const CompressedMatrix<Type,SO,IT> generate( size_t m, size_t n ) const;
+   inline const CompressedMatrix<Type,SO,IT> generate( size_t m, size_t n, size_t nonzeros ) const;
 
    template< typename Arg >
-   inline const CompressedMatrix<Type,SO> generate( size_t m, size_t n, const Arg& min, const Arg& max ) const;
+   inline const CompressedMatrix<Type,SO,IT> generate( size_t m, size_t n, const Arg& min, const Arg& max ) const;
 
    template< typename Arg >
-   inline const CompressedMatrix<Type,SO> generate( size_t m, size_t n, size_t nonzeros,
-                                                    const Arg& min, const Arg& max ) const;
+   inline const CompressedMatrix<Type,SO,IT> generate( size_t m, size_t n, size_t nonzeros,
+                                                       const Arg& min, const Arg& max ) const;
    //@}
    //**********************************************************************************************
 
    //**Randomize functions*************************************************************************
    /*!\name Randomize functions */
    //@{
-   inline void randomize( CompressedMatrix<Type,SO>& matrix ) const;
-   inline void randomize( CompressedMatrix<Type,SO>& matrix, size_t nonzeros ) const;
+   inline void randomize( CompressedMatrix<Type,SO,IT>& matrix ) const;
+   inline void randomize( CompressedMatrix<Type,SO,IT>& matrix, size_t nonzeros ) const;
 
    template< typename Arg >
-   inline void randomize( CompressedMatrix<Type,SO>& matrix, const Arg& min, const Arg& max ) const;
+   inline void randomize( CompressedMatrix<Type,SO,IT>& matrix, const Arg& min, const Arg& max ) const;
 
    template< typename Arg >
-   inline void randomize( CompressedMatrix<Type,SO>& matrix, size_t nonzeros,
+   inline void randomize( CompressedMatrix<Type,SO,IT>& matrix, size_t nonzeros,
                           const Arg& min, const Arg& max ) const;
    //@}
    //**********************************************************************************************
@@ -112,11 +113,12 @@ class Rand< CompressedMatrix<Type,SO> >
 // \return The generated random matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline const CompressedMatrix<Type,SO>
-   Rand< CompressedMatrix<Type,SO> >::generate( size_t m, size_t n ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline const CompressedMatrix<Type,SO,IT>
+   Rand< CompressedMatrix<Type,SO,IT> >::generate( size_t m, size_t n ) const
 {
-   CompressedMatrix<Type,SO> matrix( m, n );
+   CompressedMatrix<Type,SO,IT> matrix( m, n );
    randomize( matrix );
 
    return matrix;
@@ -136,14 +138,15 @@ inline const CompressedMatrix<Type,SO>
 // \exception std::invalid_argument Invalid number of non-zero elements.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline const CompressedMatrix<Type,SO>
-   Rand< CompressedMatrix<Type,SO> >::generate( size_t m, size_t n, size_t nonzeros ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline const CompressedMatrix<Type,SO,IT>
+   Rand< CompressedMatrix<Type,SO,IT> >::generate( size_t m, size_t n, size_t nonzeros ) const
 {
    if( nonzeros > m*n )
       throw std::invalid_argument( "Invalid number of non-zero elements" );
 
-   CompressedMatrix<Type,SO> matrix( m, n );
+   CompressedMatrix<Type,SO,IT> matrix( m, n );
    randomize( matrix, nonzeros );
 
    return matrix;
@@ -163,12 +166,13 @@ inline const CompressedMatrix<Type,SO>
 // \param max The largest possible value for a matrix element.
 */
 template< typename Type   // Data type of the matrix
-        , bool SO >       // Storage order
+        , bool SO         // Storage order
+        , typename IT >   // Index type
 template< typename Arg >  // Min/max argument type
-inline const CompressedMatrix<Type,SO>
-   Rand< CompressedMatrix<Type,SO> >::generate( size_t m, size_t n, const Arg& min, const Arg& max ) const
+inline const CompressedMatrix<Type,SO,IT>
+   Rand< CompressedMatrix<Type,SO,IT> >::generate( size_t m, size_t n, const Arg& min, const Arg& max ) const
 {
-   CompressedMatrix<Type,SO> matrix( m, n );
+   CompressedMatrix<Type,SO,IT> matrix( m, n );
    randomize( matrix, min, max );
 
    return matrix;
@@ -190,16 +194,17 @@ inline const CompressedMatrix<Type,SO>
 // \exception std::invalid_argument Invalid number of non-zero elements.
 */
 template< typename Type   // Data type of the matrix
-        , bool SO >       // Storage order
+        , bool SO         // Storage order
+        , typename IT >   // Index type
 template< typename Arg >  // Min/max argument type
-inline const CompressedMatrix<Type,SO>
-   Rand< CompressedMatrix<Type,SO> >::generate( size_t m, size_t n, size_t nonzeros,
-                                                const Arg& min, const Arg& max ) const
+inline const CompressedMatrix<Type,SO,IT>
+   Rand< CompressedMatrix<Type,SO,IT> >::generate( size_t m, size_t n, size_t nonzeros,
+                                                   const Arg& min, const Arg& max ) const
 {
    if( nonzeros > m*n )
       throw std::invalid_argument( "Invalid number of non-zero elements" );
 
-   CompressedMatrix<Type,SO> matrix( m, n );
+   CompressedMatrix<Type,SO,IT> matrix( m, n );
    randomize( matrix, nonzeros, min, max );
 
    return matrix;
@@ -216,8 +221,9 @@ inline const CompressedMatrix<Type,SO>
 // \return void
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,SO>& matrix ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void Rand< CompressedMatrix<Type,SO,IT> >::randomize( CompressedMatrix<Type,SO,IT>& matrix ) const
 {
    const size_t m( matrix.rows()    );
    const size_t n( matrix.columns() );
@@ -247,8 +253,9 @@ inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,
 // \exception std::invalid_argument Invalid number of non-zero elements.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,SO>& matrix, size_t nonzeros ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void Rand< CompressedMatrix<Type,SO,IT> >::randomize( CompressedMatrix<Type,SO,IT>& matrix, size_t nonzeros ) const
 {
    const size_t m( matrix.rows()    );
    const size_t n( matrix.columns() );
@@ -279,10 +286,11 @@ inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,
 // \return void
 */
 template< typename Type   // Data type of the matrix
-        , bool SO >       // Storage order
+        , bool SO         // Storage order
+        , typename IT >   // Index type
 template< typename Arg >  // Min/max argument type
-inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,SO>& matrix,
-                                                          const Arg& min, const Arg& max ) const
+inline void Rand< CompressedMatrix<Type,SO,IT> >::randomize( CompressedMatrix<Type,SO,IT>& matrix,
+                                                             const Arg& min, const Arg& max ) const
 {
    const size_t m( matrix.rows()    );
    const size_t n( matrix.columns() );
@@ -314,10 +322,11 @@ inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,
 // \exception std::invalid_argument Invalid number of non-zero elements.
 */
 template< typename Type   // Data type of the matrix
-        , bool SO >       // Storage order
+        , bool SO         // Storage order
+        , typename IT >   // Index type
 template< typename Arg >  // Min/max argument type
-inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,SO>& matrix,
-                                                          size_t nonzeros, const Arg& min, const Arg& max ) const
+inline void Rand< CompressedMatrix<Type,SO,IT> >::randomize( CompressedMatrix<Type,SO,IT>& matrix,
+                                                             size_t nonzeros, const Arg& min, const Arg& max ) const
 {
    const size_t m( matrix.rows()    );
    const size_t n( matrix.columns() );
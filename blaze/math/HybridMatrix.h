@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/math/dense/HybridMatrix.h>
+#include <blaze/math/dense/SmallMatrixSolvers.h>
 #include <blaze/math/DenseMatrix.h>
 #include <blaze/math/HybridVector.h>
 #include <blaze/math/StaticMatrix.h>
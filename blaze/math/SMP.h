@@ -40,11 +40,16 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/smp/Async.h>
 #include <blaze/math/smp/DenseMatrix.h>
 #include <blaze/math/smp/DenseVector.h>
+#include <blaze/math/smp/ExecutionContext.h>
 #include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/FusedStatements.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/SparseMatrix.h>
 #include <blaze/math/smp/SparseVector.h>
+#include <blaze/math/smp/TaskGraph.h>
+#include <blaze/math/smp/ThreadLimit.h>
 
 #endif
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/dense/SmallMatrixSolvers.h>
 #include <blaze/math/DenseMatrix.h>
 #include <blaze/math/HybridMatrix.h>
 #include <blaze/math/StaticVector.h>
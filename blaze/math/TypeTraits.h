@@ -42,8 +42,15 @@
 
 #include <blaze/math/typetraits/BaseElementType.h>
 #include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/HasBandStorage.h>
+#include <blaze/math/typetraits/HasBlockStorage.h>
 #include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasDiagonalStorage.h>
+#include <blaze/math/typetraits/HasHalfStorage.h>
+#include <blaze/math/typetraits/HasPackedStorage.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/HasSlicedEllpackStorage.h>
+#include <blaze/math/typetraits/HasSoAStorage.h>
 #include <blaze/math/typetraits/IsAbsExpr.h>
 #include <blaze/math/typetraits/IsAdaptor.h>
 #include <blaze/math/typetraits/IsAddExpr.h>
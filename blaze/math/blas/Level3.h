@@ -101,6 +101,22 @@ template< typename MT1, bool SO1, typename MT2, bool SO2 >
 BLAZE_ALWAYS_INLINE void ztrmm( DenseMatrix<MT1,SO1>& B, const DenseMatrix<MT2,SO2>& A,
                                 CBLAS_SIDE side, CBLAS_UPLO uplo, complex<double> alpha );
 
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+BLAZE_ALWAYS_INLINE void ssyrk( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                                CBLAS_UPLO uplo, float alpha, float beta );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+BLAZE_ALWAYS_INLINE void dsyrk( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                                CBLAS_UPLO uplo, double alpha, double beta );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+BLAZE_ALWAYS_INLINE void csyrk( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                                CBLAS_UPLO uplo, complex<float> alpha, complex<float> beta );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+BLAZE_ALWAYS_INLINE void zsyrk( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                                CBLAS_UPLO uplo, complex<double> alpha, complex<double> beta );
+
 #endif
 //@}
 //*************************************************************************************************
@@ -629,6 +645,230 @@ BLAZE_ALWAYS_INLINE void ztrmm( DenseMatrix<MT1,SO1>& B, const DenseMatrix<MT2,S
 #endif
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+#if BLAZE_BLAS_MODE
+/*!\brief BLAS kernel for a symmetric rank-k update with single precision matrices
+//        (\f$ C=\alpha*A*A^T+\beta*C \f$).
+// \ingroup math
+//
+// \param C The target dense matrix.
+// \param A The dense matrix multiplication operand.
+// \param uplo \a CblasLower to compute the lower triangle of \a C, \a CblasUpper to compute the upper triangle.
+// \param alpha The scaling factor for \f$ A*A^T \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function computes the given triangle of the symmetric matrix product \f$ A*A^T \f$
+// based on the cblas_ssyrk() function. The opposite triangle of \a C is not referenced. Note
+// that the function only works for matrices with \c float element type. The attempt to call
+// the function with matrices of any other element type results in a compile time error. Also,
+// the number of rows and columns of \a C is expected to match the number of rows of \a A.
+*/
+template< typename MT1  // Type of the left-hand side target matrix
+        , bool SO1      // Storage order of the left-hand side target matrix
+        , typename MT2  // Type of the matrix operand
+        , bool SO2 >    // Storage order of the matrix operand
+BLAZE_ALWAYS_INLINE void ssyrk( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                                CBLAS_UPLO uplo, float alpha, float beta )
+{
+   using boost::numeric_cast;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS  ( MT2 );
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOAT_TYPE( typename MT1::ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_FLOAT_TYPE( typename MT2::ElementType );
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows() == (~C).columns(), "Non-square target matrix detected" );
+   BLAZE_INTERNAL_ASSERT( (~C).rows() == (~A).rows()   , "Invalid number of rows"           );
+   BLAZE_INTERNAL_ASSERT( uplo == CblasLower || uplo == CblasUpper, "Invalid uplo argument detected" );
+
+   const int N  ( numeric_cast<int>( (~A).rows() )    );
+   const int K  ( numeric_cast<int>( (~A).columns() ) );
+   const int lda( numeric_cast<int>( (~A).spacing() ) );
+   const int ldc( numeric_cast<int>( (~C).spacing() ) );
+
+   cblas_ssyrk( ( IsRowMajorMatrix<MT1>::value )?( CblasRowMajor ):( CblasColMajor ),
+                uplo,
+                ( SO1 == SO2 )?( CblasNoTrans ):( CblasTrans ),
+                N, K, alpha, (~A).data(), lda, beta, (~C).data(), ldc );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_BLAS_MODE
+/*!\brief BLAS kernel for a symmetric rank-k update with double precision matrices
+//        (\f$ C=\alpha*A*A^T+\beta*C \f$).
+// \ingroup math
+//
+// \param C The target dense matrix.
+// \param A The dense matrix multiplication operand.
+// \param uplo \a CblasLower to compute the lower triangle of \a C, \a CblasUpper to compute the upper triangle.
+// \param alpha The scaling factor for \f$ A*A^T \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function computes the given triangle of the symmetric matrix product \f$ A*A^T \f$
+// based on the cblas_dsyrk() function. The opposite triangle of \a C is not referenced. Note
+// that the function only works for matrices with \c double element type. The attempt to call
+// the function with matrices of any other element type results in a compile time error. Also,
+// the number of rows and columns of \a C is expected to match the number of rows of \a A.
+*/
+template< typename MT1  // Type of the left-hand side target matrix
+        , bool SO1      // Storage order of the left-hand side target matrix
+        , typename MT2  // Type of the matrix operand
+        , bool SO2 >    // Storage order of the matrix operand
+BLAZE_ALWAYS_INLINE void dsyrk( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                                CBLAS_UPLO uplo, double alpha, double beta )
+{
+   using boost::numeric_cast;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS  ( MT2 );
+
+   BLAZE_CONSTRAINT_MUST_BE_DOUBLE_TYPE( typename MT1::ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_DOUBLE_TYPE( typename MT2::ElementType );
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows() == (~C).columns(), "Non-square target matrix detected" );
+   BLAZE_INTERNAL_ASSERT( (~C).rows() == (~A).rows()   , "Invalid number of rows"           );
+   BLAZE_INTERNAL_ASSERT( uplo == CblasLower || uplo == CblasUpper, "Invalid uplo argument detected" );
+
+   const int N  ( numeric_cast<int>( (~A).rows() )    );
+   const int K  ( numeric_cast<int>( (~A).columns() ) );
+   const int lda( numeric_cast<int>( (~A).spacing() ) );
+   const int ldc( numeric_cast<int>( (~C).spacing() ) );
+
+   cblas_dsyrk( ( IsRowMajorMatrix<MT1>::value )?( CblasRowMajor ):( CblasColMajor ),
+                uplo,
+                ( SO1 == SO2 )?( CblasNoTrans ):( CblasTrans ),
+                N, K, alpha, (~A).data(), lda, beta, (~C).data(), ldc );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_BLAS_MODE
+/*!\brief BLAS kernel for a symmetric rank-k update with single precision complex matrices
+//        (\f$ C=\alpha*A*A^T+\beta*C \f$).
+// \ingroup math
+//
+// \param C The target dense matrix.
+// \param A The dense matrix multiplication operand.
+// \param uplo \a CblasLower to compute the lower triangle of \a C, \a CblasUpper to compute the upper triangle.
+// \param alpha The scaling factor for \f$ A*A^T \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function computes the given triangle of the symmetric matrix product \f$ A*A^T \f$
+// based on the cblas_csyrk() function. The opposite triangle of \a C is not referenced. Note
+// that the function only works for matrices with \c complex<float> element type. The attempt to call
+// the function with matrices of any other element type results in a compile time error. Also,
+// the number of rows and columns of \a C is expected to match the number of rows of \a A.
+*/
+template< typename MT1  // Type of the left-hand side target matrix
+        , bool SO1      // Storage order of the left-hand side target matrix
+        , typename MT2  // Type of the matrix operand
+        , bool SO2 >    // Storage order of the matrix operand
+BLAZE_ALWAYS_INLINE void csyrk( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                                CBLAS_UPLO uplo, complex<float> alpha, complex<float> beta )
+{
+   using boost::numeric_cast;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS  ( MT2 );
+
+   BLAZE_CONSTRAINT_MUST_BE_COMPLEX_TYPE( typename MT1::ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_COMPLEX_TYPE( typename MT2::ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_FLOAT_TYPE  ( typename MT1::ElementType::value_type );
+   BLAZE_CONSTRAINT_MUST_BE_FLOAT_TYPE  ( typename MT2::ElementType::value_type );
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows() == (~C).columns(), "Non-square target matrix detected" );
+   BLAZE_INTERNAL_ASSERT( (~C).rows() == (~A).rows()   , "Invalid number of rows"           );
+   BLAZE_INTERNAL_ASSERT( uplo == CblasLower || uplo == CblasUpper, "Invalid uplo argument detected" );
+
+   const int N  ( numeric_cast<int>( (~A).rows() )    );
+   const int K  ( numeric_cast<int>( (~A).columns() ) );
+   const int lda( numeric_cast<int>( (~A).spacing() ) );
+   const int ldc( numeric_cast<int>( (~C).spacing() ) );
+
+   cblas_csyrk( ( IsRowMajorMatrix<MT1>::value )?( CblasRowMajor ):( CblasColMajor ),
+                uplo,
+                ( SO1 == SO2 )?( CblasNoTrans ):( CblasTrans ),
+                N, K, &alpha, (~A).data(), lda, &beta, (~C).data(), ldc );
+}
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_BLAS_MODE
+/*!\brief BLAS kernel for a symmetric rank-k update with double precision complex matrices
+//        (\f$ C=\alpha*A*A^T+\beta*C \f$).
+// \ingroup math
+//
+// \param C The target dense matrix.
+// \param A The dense matrix multiplication operand.
+// \param uplo \a CblasLower to compute the lower triangle of \a C, \a CblasUpper to compute the upper triangle.
+// \param alpha The scaling factor for \f$ A*A^T \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function computes the given triangle of the symmetric matrix product \f$ A*A^T \f$
+// based on the cblas_zsyrk() function. The opposite triangle of \a C is not referenced. Note
+// that the function only works for matrices with \c complex<double> element type. The attempt to call
+// the function with matrices of any other element type results in a compile time error. Also,
+// the number of rows and columns of \a C is expected to match the number of rows of \a A.
+*/
+template< typename MT1  // Type of the left-hand side target matrix
+        , bool SO1      // Storage order of the left-hand side target matrix
+        , typename MT2  // Type of the matrix operand
+        , bool SO2 >    // Storage order of the matrix operand
+BLAZE_ALWAYS_INLINE void zsyrk( DenseMatrix<MT1,SO1>& C, const DenseMatrix<MT2,SO2>& A,
+                                CBLAS_UPLO uplo, complex<double> alpha, complex<double> beta )
+{
+   using boost::numeric_cast;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT1 );
+   BLAZE_CONSTRAINT_MUST_HAVE_CONST_DATA_ACCESS  ( MT2 );
+
+   BLAZE_CONSTRAINT_MUST_BE_COMPLEX_TYPE( typename MT1::ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_COMPLEX_TYPE( typename MT2::ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_DOUBLE_TYPE ( typename MT1::ElementType::value_type );
+   BLAZE_CONSTRAINT_MUST_BE_DOUBLE_TYPE ( typename MT2::ElementType::value_type );
+
+   BLAZE_INTERNAL_ASSERT( (~C).rows() == (~C).columns(), "Non-square target matrix detected" );
+   BLAZE_INTERNAL_ASSERT( (~C).rows() == (~A).rows()   , "Invalid number of rows"           );
+   BLAZE_INTERNAL_ASSERT( uplo == CblasLower || uplo == CblasUpper, "Invalid uplo argument detected" );
+
+   const int N  ( numeric_cast<int>( (~A).rows() )    );
+   const int K  ( numeric_cast<int>( (~A).columns() ) );
+   const int lda( numeric_cast<int>( (~A).spacing() ) );
+   const int ldc( numeric_cast<int>( (~C).spacing() ) );
+
+   cblas_zsyrk( ( IsRowMajorMatrix<MT1>::value )?( CblasRowMajor ):( CblasColMajor ),
+                uplo,
+                ( SO1 == SO2 )?( CblasNoTrans ):( CblasTrans ),
+                N, K, &alpha, (~A).data(), lda, &beta, (~C).data(), ldc );
+}
+#endif
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
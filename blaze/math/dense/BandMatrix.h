@@ -0,0 +1,2304 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BandMatrix.h
+//  \brief Implementation of a dense MxN band matrix storing only the elements within its band
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BANDMATRIX_H_
+#define _BLAZE_MATH_DENSE_BANDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <blaze/math/dense/BandProxy.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MathTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/HasBandStorage.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/views/Forward.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup band_matrix BandMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Dense \f$ M \times N \f$ band matrix storing only the elements within its band.
+// \ingroup band_matrix
+//
+// The BandMatrix class template is a row-major dense matrix whose non-zero elements are confined
+// to a band of \f$ k_l \f$ subdiagonals and \f$ k_u \f$ superdiagonals around the diagonal. Only
+// the elements within the band are stored, which reduces the memory requirements of the matrix
+// from \f$ O(M \cdot N) \f$ to \f$ O((k_l+k_u+1) \cdot N) \f$. The type of the elements can be
+// specified via the single template parameter:
+
+   \code
+   template< typename Type >
+   class BandMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. BandMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//
+// The lower and upper bandwidth are runtime parameters of the matrix. The elements are stored
+// in the LAPACK band storage scheme, i.e. in a \f$ (k_l+k_u+1) \times N \f$ array \f$ B \f$ with
+// \f$ a_{ij} = B_{k_u+i-j,j} \f$. Since the array is stored in a row-major, properly aligned and
+// padded DynamicMatrix, each diagonal of the band matrix is stored contiguously in memory, which
+// enables a vectorized and parallelized computation of products with dense vectors:
+
+   \code
+   using blaze::BandMatrix;
+   using blaze::DynamicVector;
+
+   // Setup of a 1000x1000 tridiagonal matrix
+   BandMatrix<double> T( 1000UL, 1000UL, 1UL, 1UL );
+
+   for( size_t i=0UL; i<1000UL; ++i ) {
+      T(i,i) = 2.0;
+      if( i > 0UL    ) T(i,i-1UL) = -1.0;
+      if( i < 999UL  ) T(i,i+1UL) = -1.0;
+   }
+
+   T(0,2) = 1.0;  // Invalid assignment to element outside the band; results in an exception!
+
+   DynamicVector<double> x( 1000UL, 1.0 ), y;
+
+   y = T * x;            // Vectorized band matrix-vector multiplication
+   y = trans( x ) * T;   // Vectorized transpose vector-band matrix multiplication
+   \endcode
+
+// A BandMatrix can be created from and assigned any dense or sparse matrix. In this case the
+// bandwidths of the band matrix are deduced from the non-zero elements of the given matrix. The
+// bandwidths can be adapted via the setBandwidths() function. Any attempt to reduce the
+// bandwidths such that non-zero elements would be lost results in a \a std::invalid_argument
+// exception. For the solution of band systems, the band LU and Cholesky decompositions and the
+// tridiagonal solvers in <blaze/math/dense/BandSolvers.h> can be used.
+*/
+template< typename Type >  // Data type of the dense matrix
+class BandMatrix : public DenseMatrix< BandMatrix<Type>, false >
+{
+ public:
+   //**BandIterator class definition***********************************************************
+   /*!\brief Iterator over the elements of a row of a BandMatrix.
+   //
+   // The BandIterator traverses a complete row of the band matrix, i.e. including the elements
+   // outside the band. These elements are represented by proxies that refer to the zero element
+   // of the matrix and cannot be modified.
+   */
+   template< typename VT >  // Type of the value (Type or const Type)
+   class BandIterator
+   {
+    private:
+      //**Type definitions*************************************************************************
+      //! Type of the traversed matrix.
+      typedef typename SelectType< IsConst<VT>::value, const BandMatrix
+                                                     , BandMatrix >::Type  MT;
+
+      //! Type of the access proxy for the elements of a non-constant matrix.
+      typedef BandProxy<Type>  ProxyType;
+      //*******************************************************************************************
+
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef Type                             ValueType;         //!< Type of the underlying elements.
+      //! Pointer return type.
+      typedef typename SelectType< IsConst<VT>::value, const Type*, ProxyType >::Type  PointerType;
+
+      //! Reference return type.
+      typedef typename SelectType< IsConst<VT>::value, const Type&, ProxyType >::Type  ReferenceType;
+
+      typedef ptrdiff_t  DifferenceType;  //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Default constructor**********************************************************************
+      /*!\brief Default constructor for the BandIterator class.
+      */
+      inline BandIterator()
+         : matrix_( NULL )  // Pointer to the traversed matrix
+         , row_   ( 0UL  )  // The index of the traversed row
+         , column_( 0UL  )  // The current column index of the iterator
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the BandIterator class.
+      //
+      // \param matrix The traversed matrix.
+      // \param row The index of the traversed row.
+      // \param column The initial column index of the iterator.
+      */
+      inline BandIterator( MT* matrix, size_t row, size_t column )
+         : matrix_( matrix )  // Pointer to the traversed matrix
+         , row_   ( row    )  // The index of the traversed row
+         , column_( column )  // The current column index of the iterator
+      {}
+      //*******************************************************************************************
+
+      //**Conversion constructor*******************************************************************
+      /*!\brief Conversion constructor from different BandIterator instances.
+      //
+      // \param it The iterator to be copied.
+      */
+      template< typename VT2 >
+      inline BandIterator( const BandIterator<VT2>& it )
+         : matrix_( it.matrix_ )  // Pointer to the traversed matrix
+         , row_   ( it.row_    )  // The index of the traversed row
+         , column_( it.column_ )  // The current column index of the iterator
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline BandIterator& operator+=( size_t inc ) {
+         column_ += inc;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline BandIterator& operator-=( size_t dec ) {
+         column_ -= dec;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline BandIterator& operator++() {
+         ++column_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const BandIterator operator++( int ) {
+         const BandIterator tmp( *this );
+         ++column_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline BandIterator& operator--() {
+         --column_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const BandIterator operator--( int ) {
+         const BandIterator tmp( *this );
+         --column_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Subscript operator***********************************************************************
+      /*!\brief Direct access to the matrix elements.
+      //
+      // \param index Access index.
+      // \return Reference or proxy to the accessed value.
+      */
+      inline ReferenceType operator[]( size_t index ) const {
+         return (*matrix_)(row_,column_+index);
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return Reference or proxy to the current element.
+      */
+      inline ReferenceType operator*() const {
+         return (*matrix_)(row_,column_);
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return Pointer or proxy to the current element.
+      */
+      inline PointerType operator->() const {
+         return address( (*matrix_)(row_,column_) );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two BandIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator==( const BandIterator<VT2>& rhs ) const {
+         return column_ == rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two BandIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      template< typename VT2 >
+      inline bool operator!=( const BandIterator<VT2>& rhs ) const {
+         return column_ != rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two BandIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator<( const BandIterator<VT2>& rhs ) const {
+         return column_ < rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two BandIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator>( const BandIterator<VT2>& rhs ) const {
+         return column_ > rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two BandIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator<=( const BandIterator<VT2>& rhs ) const {
+         return column_ <= rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two BandIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator>=( const BandIterator<VT2>& rhs ) const {
+         return column_ >= rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two BandIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      template< typename VT2 >
+      inline DifferenceType operator-( const BandIterator<VT2>& rhs ) const {
+         return column_ - rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a BandIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const BandIterator operator+( const BandIterator& it, size_t inc ) {
+         return BandIterator( it.matrix_, it.row_, it.column_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a BandIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const BandIterator operator+( size_t inc, const BandIterator& it ) {
+         return BandIterator( it.matrix_, it.row_, it.column_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a BandIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const BandIterator operator-( const BandIterator& it, size_t dec ) {
+         return BandIterator( it.matrix_, it.row_, it.column_ - dec );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Address functions************************************************************************
+      /*!\brief Returns the address of a constant matrix element.
+      //
+      // \param value The constant matrix element.
+      // \return Pointer to the matrix element.
+      */
+      static inline const Type* address( const Type& value ) {
+         return &value;
+      }
+      //*******************************************************************************************
+
+      //**Address functions************************************************************************
+      /*!\brief Returns the access proxy of a non-constant matrix element.
+      //
+      // \param proxy The access proxy of the matrix element.
+      // \return The access proxy of the matrix element.
+      */
+      static inline ProxyType address( const ProxyType& proxy ) {
+         return proxy;
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      MT*    matrix_;  //!< Pointer to the traversed matrix.
+      size_t row_;     //!< The index of the traversed row.
+      size_t column_;  //!< The current column index of the iterator.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      /*! \cond BLAZE_INTERNAL */
+      template< typename VT2 > friend class BandIterator;
+      /*! \endcond */
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef IntrinsicTrait<Type>  IT;  //!< Intrinsic trait for the matrix element type.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef BandMatrix<Type>           This;            //!< Type of this BandMatrix instance.
+   typedef This                       ResultType;      //!< Result type for expression template evaluations.
+   typedef DynamicMatrix<Type,true>   OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef This                       TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                       ElementType;     //!< Type of the matrix elements.
+   typedef typename IT::Type          IntrinsicType;   //!< Intrinsic type of the matrix elements.
+   typedef const Type&                ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                CompositeType;   //!< Data type for composite expression templates.
+   typedef BandProxy<Type>            Reference;       //!< Reference to a non-constant matrix value.
+   typedef const Type&                ConstReference;  //!< Reference to a constant matrix value.
+   typedef Type*                      Pointer;         //!< Pointer to a non-constant matrix value.
+   typedef const Type*                ConstPointer;    //!< Pointer to a constant matrix value.
+   typedef BandIterator<Type>         Iterator;        //!< Iterator over non-constant elements.
+   typedef BandIterator<const Type>   ConstIterator;   //!< Iterator over constant elements.
+   typedef DynamicMatrix<Type,false>  BandType;        //!< Type of the band storage array.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a BandMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef BandMatrix<ET>  Other;  //!< The type of the other BandMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for intrinsic optimization.
+   /*! The \a vectorizable compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via intrinsics. Since the rows of a BandMatrix are not stored
+       contiguously in memory, the flag is always set to \a false. Products with the matrix are
+       vectorized along the diagonals by means of the band() function instead. */
+   enum { vectorizable = 0 };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since a BandMatrix is never the target of an SMP assignment, the flag only
+       enables the parallel evaluation of expressions involving the matrix. */
+   enum { smpAssignable = 1 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BandMatrix();
+   explicit inline BandMatrix( size_t m, size_t n, size_t kl, size_t ku );
+   explicit inline BandMatrix( size_t m, size_t n, size_t kl, size_t ku, const Type& init );
+            inline BandMatrix( const BandMatrix& m );
+
+   template< typename MT, bool SO >
+   inline BandMatrix( const Matrix<MT,SO>& m );
+
+   template< typename MT, bool SO >
+   explicit inline BandMatrix( const Matrix<MT,SO>& m, size_t kl, size_t ku );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j );
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline BandMatrix& operator=( const Type& set );
+   inline BandMatrix& operator=( const BandMatrix& rhs );
+
+   template< typename MT, bool SO > inline BandMatrix& operator= ( const Matrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline BandMatrix& operator+=( const Matrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline BandMatrix& operator-=( const Matrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline BandMatrix& operator*=( const Matrix<MT,SO>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, BandMatrix >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, BandMatrix >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t      rows() const;
+                              inline size_t      columns() const;
+                              inline size_t      lowerBandwidth() const;
+                              inline size_t      upperBandwidth() const;
+                              inline size_t      capacity() const;
+                              inline size_t      capacity( size_t i ) const;
+                              inline size_t      nonZeros() const;
+                              inline size_t      nonZeros( size_t i ) const;
+                              inline void        reset();
+                              inline void        reset( size_t i );
+                              inline void        clear();
+                                     void        resize ( size_t m, size_t n, bool preserve=true );
+                              inline void        reserve( size_t elements );
+                                     void        setBandwidths( size_t kl, size_t ku );
+   template< typename Other > inline BandMatrix& scale( const Other& scalar );
+                              inline void        swap( BandMatrix& m ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline BandType&       band();
+   inline const BandType& band() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool isAligned   () const;
+   inline bool canSMPAssign() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool isInBand( size_t i, size_t j ) const;
+
+   template< typename MT, bool SO > void initialize( const Matrix<MT,SO>& m );
+
+   template< typename MT, bool SO > void copyBand( const DenseMatrix<MT,SO>& m );
+   template< typename MT >          void copyBand( const SparseMatrix<MT,false>& m );
+   template< typename MT >          void copyBand( const SparseMatrix<MT,true>& m );
+
+   template< typename MT, bool SO >
+   static void deduceBandwidths( const DenseMatrix<MT,SO>& m, size_t& kl, size_t& ku );
+
+   template< typename MT >
+   static void deduceBandwidths( const SparseMatrix<MT,false>& m, size_t& kl, size_t& ku );
+
+   template< typename MT >
+   static void deduceBandwidths( const SparseMatrix<MT,true>& m, size_t& kl, size_t& ku );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;        //!< The current number of rows of the matrix.
+   size_t kl_;       //!< The lower bandwidth of the matrix.
+   size_t ku_;       //!< The upper bandwidth of the matrix.
+   BandType band_;   //!< The elements within the band of the matrix.
+                     /*!< The element \f$ a_{ij} \f$ is stored in row \f$ k_u+i-j \f$ and
+                          column \f$ j \f$ of the band storage array. */
+   Type zero_;       //!< The zero element of the matrix.
+                     /*!< All elements outside the band refer to this element. */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BandMatrix.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline BandMatrix<Type>::BandMatrix()
+   : m_   ( 0UL )         // The current number of rows of the matrix
+   , kl_  ( 0UL )         // The lower bandwidth of the matrix
+   , ku_  ( 0UL )         // The upper bandwidth of the matrix
+   , band_( 1UL, 0UL )    // The elements within the band of the matrix
+   , zero_()              // The zero element of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a band matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param kl The lower bandwidth of the matrix.
+// \param ku The upper bandwidth of the matrix.
+//
+// The matrix is initialized to the zero matrix.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline BandMatrix<Type>::BandMatrix( size_t m, size_t n, size_t kl, size_t ku )
+   : m_   ( m  )                          // The current number of rows of the matrix
+   , kl_  ( kl )                          // The lower bandwidth of the matrix
+   , ku_  ( ku )                          // The upper bandwidth of the matrix
+   , band_( kl+ku+1UL, n, Type() )        // The elements within the band of the matrix
+   , zero_()                              // The zero element of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogenous initialization of the band.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param kl The lower bandwidth of the matrix.
+// \param ku The upper bandwidth of the matrix.
+// \param init The initial value of the elements within the band.
+//
+// All elements within the band are initialized with the specified value, all elements outside
+// the band are zero.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline BandMatrix<Type>::BandMatrix( size_t m, size_t n, size_t kl, size_t ku, const Type& init )
+   : m_   ( m  )                          // The current number of rows of the matrix
+   , kl_  ( kl )                          // The lower bandwidth of the matrix
+   , ku_  ( ku )                          // The upper bandwidth of the matrix
+   , band_( kl+ku+1UL, n, Type() )        // The elements within the band of the matrix
+   , zero_()                              // The zero element of the matrix
+{
+   *this = init;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for BandMatrix.
+//
+// \param m Matrix to be copied.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline BandMatrix<Type>::BandMatrix( const BandMatrix& m )
+   : m_   ( m.m_    )  // The current number of rows of the matrix
+   , kl_  ( m.kl_   )  // The lower bandwidth of the matrix
+   , ku_  ( m.ku_   )  // The upper bandwidth of the matrix
+   , band_( m.band_ )  // The elements within the band of the matrix
+   , zero_()           // The zero element of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense and sparse matrices.
+//
+// \param m Matrix to be converted.
+//
+// This constructor creates a BandMatrix from the given dense or sparse matrix. The lower and
+// upper bandwidth of the band matrix are deduced from the non-zero elements of the given matrix.
+*/
+template< typename Type >  // Data type of the dense matrix
+template< typename MT      // Type of the foreign matrix
+        , bool SO >        // Storage order of the foreign matrix
+inline BandMatrix<Type>::BandMatrix( const Matrix<MT,SO>& m )
+   : m_   ( 0UL )         // The current number of rows of the matrix
+   , kl_  ( 0UL )         // The lower bandwidth of the matrix
+   , ku_  ( 0UL )         // The upper bandwidth of the matrix
+   , band_( 1UL, 0UL )    // The elements within the band of the matrix
+   , zero_()              // The zero element of the matrix
+{
+   initialize( ~m );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense and sparse matrices with given bandwidths.
+//
+// \param m Matrix to be converted.
+// \param kl The lower bandwidth of the matrix.
+// \param ku The upper bandwidth of the matrix.
+// \exception std::invalid_argument Invalid setup of band matrix.
+//
+// This constructor creates a BandMatrix with the given lower and upper bandwidth from the given
+// dense or sparse matrix. In case the given matrix has non-zero elements outside the specified
+// band, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the dense matrix
+template< typename MT      // Type of the foreign matrix
+        , bool SO >        // Storage order of the foreign matrix
+inline BandMatrix<Type>::BandMatrix( const Matrix<MT,SO>& m, size_t kl, size_t ku )
+   : m_   ( 0UL )         // The current number of rows of the matrix
+   , kl_  ( 0UL )         // The lower bandwidth of the matrix
+   , ku_  ( 0UL )         // The upper bandwidth of the matrix
+   , band_( 1UL, 0UL )    // The elements within the band of the matrix
+   , zero_()              // The zero element of the matrix
+{
+   initialize( ~m );
+
+   if( kl_ > kl || ku_ > ku )
+      throw std::invalid_argument( "Invalid setup of band matrix" );
+
+   setBandwidths( kl, ku );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Proxy to the accessed value.
+//
+// This function returns a proxy to the element \f$ a_{ij} \f$. In case the element lies outside
+// the band of the matrix, any attempt to modify the element via the returned proxy results in a
+// \a std::invalid_argument exception.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline typename BandMatrix<Type>::Reference
+   BandMatrix<Type>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return Reference( ( isInBand( i, j ) )?( &band_(ku_+i-j,j) ):( NULL ), zero_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline typename BandMatrix<Type>::ConstReference
+   BandMatrix<Type>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return ( isInBand( i, j ) )?( band_(ku_+i-j,j) ):( zero_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline typename BandMatrix<Type>::Iterator
+   BandMatrix<Type>::begin( size_t i )
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid band matrix row access index" );
+   return Iterator( this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline typename BandMatrix<Type>::ConstIterator
+   BandMatrix<Type>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid band matrix row access index" );
+   return ConstIterator( this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline typename BandMatrix<Type>::ConstIterator
+   BandMatrix<Type>::cbegin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid band matrix row access index" );
+   return ConstIterator( this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline typename BandMatrix<Type>::Iterator
+   BandMatrix<Type>::end( size_t i )
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid band matrix row access index" );
+   return Iterator( this, i, columns() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline typename BandMatrix<Type>::ConstIterator
+   BandMatrix<Type>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid band matrix row access index" );
+   return ConstIterator( this, i, columns() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline typename BandMatrix<Type>::ConstIterator
+   BandMatrix<Type>::cend( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid band matrix row access index" );
+   return ConstIterator( this, i, columns() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to the elements within the band.
+//
+// \param set Scalar value to be assigned to the elements within the band.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline BandMatrix<Type>& BandMatrix<Type>::operator=( const Type& set )
+{
+   const size_t n( columns() );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      const size_t jbegin( ( i > kl_ )?( i - kl_ ):( 0UL ) );
+      const size_t jend  ( min( n, i+ku_+1UL ) );
+      for( size_t j=jbegin; j<jend; ++j )
+         band_(ku_+i-j,j) = set;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for BandMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix, including its bandwidths.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline BandMatrix<Type>& BandMatrix<Type>::operator=( const BandMatrix& rhs )
+{
+   m_    = rhs.m_;
+   kl_   = rhs.kl_;
+   ku_   = rhs.ku_;
+   band_ = rhs.band_;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense and sparse matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix. The lower and upper bandwidth of the band matrix are deduced from the
+// non-zero elements of the given matrix.
+*/
+template< typename Type >  // Data type of the dense matrix
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+inline BandMatrix<Type>& BandMatrix<Type>::operator=( const Matrix<MT,SO>& rhs )
+{
+   initialize( ~rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown. The bandwidths of the band matrix are adapted to the result of the
+// addition.
+*/
+template< typename Type >  // Data type of the dense matrix
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+inline BandMatrix<Type>& BandMatrix<Type>::operator+=( const Matrix<MT,SO>& rhs )
+{
+   if( (~rhs).rows() != rows() || (~rhs).columns() != columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   initialize( *this + ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown. The bandwidths of the band matrix are adapted to the result of the
+// subtraction.
+*/
+template< typename Type >  // Data type of the dense matrix
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+inline BandMatrix<Type>& BandMatrix<Type>::operator-=( const Matrix<MT,SO>& rhs )
+{
+   if( (~rhs).rows() != rows() || (~rhs).columns() != columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   initialize( *this - ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown. The bandwidths of the band matrix are adapted to the result of the
+// multiplication.
+*/
+template< typename Type >  // Data type of the dense matrix
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+inline BandMatrix<Type>& BandMatrix<Type>::operator*=( const Matrix<MT,SO>& rhs )
+{
+   if( (~rhs).rows() != columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   initialize( *this * ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type >   // Data type of the dense matrix
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, BandMatrix<Type> >::Type&
+   BandMatrix<Type>::operator*=( Other rhs )
+{
+   band_ *= rhs;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename Type >   // Data type of the dense matrix
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, BandMatrix<Type> >::Type&
+   BandMatrix<Type>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   band_ /= rhs;
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline size_t BandMatrix<Type>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline size_t BandMatrix<Type>::columns() const
+{
+   return band_.columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the lower bandwidth of the matrix.
+//
+// \return The number of subdiagonals within the band of the matrix.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline size_t BandMatrix<Type>::lowerBandwidth() const
+{
+   return kl_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the upper bandwidth of the matrix.
+//
+// \return The number of superdiagonals within the band of the matrix.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline size_t BandMatrix<Type>::upperBandwidth() const
+{
+   return ku_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+//
+// Note that the capacity refers to the band storage array, i.e. a matrix of size
+// \f$ M \times N \f$ with bandwidths \f$ k_l \f$ and \f$ k_u \f$ requires a capacity of at least
+// \f$ (k_l+k_u+1) \cdot N \f$ elements.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline size_t BandMatrix<Type>::capacity() const
+{
+   return band_.capacity();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row.
+//
+// \param i The index of the row.
+// \return The current capacity of row \a i.
+//
+// The capacity of a row corresponds to the width of the band, i.e. \f$ k_l+k_u+1 \f$.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline size_t BandMatrix<Type>::capacity( size_t i ) const
+{
+   UNUSED_PARAMETER( i );
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return kl_ + ku_ + 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix.
+//
+// \return The number of non-zero elements within the band of the matrix.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline size_t BandMatrix<Type>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<m_; ++i )
+      nonzeros += nonZeros( i );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline size_t BandMatrix<Type>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t jbegin( ( i > kl_ )?( i - kl_ ):( 0UL ) );
+   const size_t jend  ( min( columns(), i+ku_+1UL ) );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t j=jbegin; j<jend; ++j )
+      if( !isDefault( band_(ku_+i-j,j) ) )
+         ++nonzeros;
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function resets all elements within the band to their default value. The bandwidths of
+// the matrix remain unchanged.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline void BandMatrix<Type>::reset()
+{
+   band_.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row to the default initial values.
+//
+// \param i The index of the row.
+// \return void
+//
+// This function resets the values in the specified row to their default value. Note that only
+// the elements within the band are affected.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline void BandMatrix<Type>::reset( size_t i )
+{
+   using blaze::clear;
+
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t jbegin( ( i > kl_ )?( i - kl_ ):( 0UL ) );
+   const size_t jend  ( min( columns(), i+ku_+1UL ) );
+
+   for( size_t j=jbegin; j<jend; ++j )
+      clear( band_(ku_+i-j,j) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ M \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0. The bandwidths of the matrix remain
+// unchanged.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline void BandMatrix<Type>::clear()
+{
+   m_ = 0UL;
+   band_.resize( kl_+ku_+1UL, 0UL, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param m The new number of rows of the matrix.
+// \param n The new number of columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$. The bandwidths
+// of the matrix remain unchanged. During this operation, new dynamic memory may be allocated in
+// case the capacity of the matrix is too small. In case the old values are preserved, new
+// elements within the band are default initialized. Otherwise, the values of all elements
+// within the band are undefined after the resize operation.
+*/
+template< typename Type >  // Data type of the dense matrix
+void BandMatrix<Type>::resize( size_t m, size_t n, bool preserve )
+{
+   if( preserve )
+   {
+      BandType tmp( kl_+ku_+1UL, n, Type() );
+
+      const size_t mmin( min( m, m_ ) );
+      const size_t nmin( min( n, columns() ) );
+
+      for( size_t i=0UL; i<mmin; ++i ) {
+         const size_t jbegin( ( i > kl_ )?( i - kl_ ):( 0UL ) );
+         const size_t jend  ( min( nmin, i+ku_+1UL ) );
+         for( size_t j=jbegin; j<jend; ++j )
+            tmp(ku_+i-j,j) = band_(ku_+i-j,j);
+      }
+
+      band_.swap( tmp );
+   }
+   else {
+      band_.resize( kl_+ku_+1UL, n, false );
+   }
+
+   m_ = m;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the matrix.
+//
+// \param elements The new minimum capacity of the matrix.
+// \return void
+//
+// This function increases the capacity of the band storage array to at least \a elements
+// elements. The current values of the matrix elements are preserved.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline void BandMatrix<Type>::reserve( size_t elements )
+{
+   band_.reserve( elements );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the bandwidths of the matrix.
+//
+// \param kl The new lower bandwidth of the matrix.
+// \param ku The new upper bandwidth of the matrix.
+// \return void
+// \exception std::invalid_argument Invalid bandwidths for band matrix.
+//
+// This function changes the lower and upper bandwidth of the matrix. All elements within both
+// the old and the new band are preserved, new elements within the band are default initialized.
+// In case the bandwidths are reduced such that a non-zero element would be lost, a
+// \a std::invalid_argument exception is thrown and the matrix remains unchanged.
+*/
+template< typename Type >  // Data type of the dense matrix
+void BandMatrix<Type>::setBandwidths( size_t kl, size_t ku )
+{
+   if( kl == kl_ && ku == ku_ )
+      return;
+
+   BandType tmp( kl+ku+1UL, columns(), Type() );
+
+   for( size_t i=0UL; i<m_; ++i )
+   {
+      const size_t jbegin( ( i > kl_ )?( i - kl_ ):( 0UL ) );
+      const size_t jend  ( min( columns(), i+ku_+1UL ) );
+
+      for( size_t j=jbegin; j<jend; ++j ) {
+         if( j+kl >= i && j <= i+ku )
+            tmp(ku+i-j,j) = band_(ku_+i-j,j);
+         else if( !isDefault( band_(ku_+i-j,j) ) )
+            throw std::invalid_argument( "Invalid bandwidths for band matrix" );
+      }
+   }
+
+   kl_ = kl;
+   ku_ = ku;
+   band_.swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the matrix by the scalar value \a scalar (\f$ A*=s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the matrix.
+*/
+template< typename Type >   // Data type of the dense matrix
+template< typename Other >  // Data type of the scalar value
+inline BandMatrix<Type>& BandMatrix<Type>::scale( const Other& scalar )
+{
+   band_.scale( scalar );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline void BandMatrix<Type>::swap( BandMatrix& m ) /* throw() */
+{
+   std::swap( m_ , m.m_  );
+   std::swap( kl_, m.kl_ );
+   std::swap( ku_, m.ku_ );
+   band_.swap( m.band_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the specified element lies within the band of the matrix.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return \a true in case the element lies within the band, \a false if not.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline bool BandMatrix<Type>::isInBand( size_t i, size_t j ) const
+{
+   return ( j+kl_ >= i && j <= i+ku_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting up the band matrix from the given dense or sparse matrix.
+//
+// \param m The matrix to be converted.
+// \return void
+//
+// This function deduces the bandwidths of the given matrix and copies its band. Matrices that
+// are aliased with the band matrix are converted into a temporary band matrix first. Expressions
+// that require an intermediate evaluation are evaluated into a temporary dense or sparse matrix,
+// all other expressions are evaluated element by element.
+*/
+template< typename Type >  // Data type of the dense matrix
+template< typename MT      // Type of the foreign matrix
+        , bool SO >        // Storage order of the foreign matrix
+void BandMatrix<Type>::initialize( const Matrix<MT,SO>& m )
+{
+   typedef typename SelectType< IsDenseMatrix<MT>::value, DynamicMatrix<Type,SO>
+                                                        , CompressedMatrix<Type,SO> >::Type  TmpType;
+
+   if( RequiresEvaluation<MT>::value ) {
+      const TmpType tmp( ~m );
+      initialize( tmp );
+      return;
+   }
+
+   if( (~m).isAliased( this ) ) {
+      BandMatrix tmp( ~m );
+      swap( tmp );
+      return;
+   }
+
+   size_t kl( 0UL );
+   size_t ku( 0UL );
+
+   deduceBandwidths( ~m, kl, ku );
+
+   m_  = (~m).rows();
+   kl_ = kl;
+   ku_ = ku;
+   band_.resize( kl+ku+1UL, (~m).columns(), false );
+
+   copyBand( ~m );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copying the band of the given dense matrix.
+//
+// \param m The dense matrix to be copied.
+// \return void
+*/
+template< typename Type >  // Data type of the dense matrix
+template< typename MT      // Type of the foreign matrix
+        , bool SO >        // Storage order of the foreign matrix
+void BandMatrix<Type>::copyBand( const DenseMatrix<MT,SO>& m )
+{
+   const size_t n( columns() );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      const size_t jbegin( ( i > kl_ )?( i - kl_ ):( 0UL ) );
+      const size_t jend  ( min( n, i+ku_+1UL ) );
+      for( size_t j=jbegin; j<jend; ++j )
+         band_(ku_+i-j,j) = (~m)(i,j);
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copying the band of the given row-major sparse matrix.
+//
+// \param m The sparse matrix to be copied.
+// \return void
+*/
+template< typename Type >  // Data type of the dense matrix
+template< typename MT >    // Type of the foreign matrix
+void BandMatrix<Type>::copyBand( const SparseMatrix<MT,false>& m )
+{
+   typedef typename MT::ConstIterator  RhsIterator;
+
+   reset();
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      const RhsIterator end( (~m).end(i) );
+      for( RhsIterator element=(~m).begin(i); element!=end; ++element ) {
+         if( isInBand( i, element->index() ) )
+            band_(ku_+i-element->index(),element->index()) = element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copying the band of the given column-major sparse matrix.
+//
+// \param m The sparse matrix to be copied.
+// \return void
+*/
+template< typename Type >  // Data type of the dense matrix
+template< typename MT >    // Type of the foreign matrix
+void BandMatrix<Type>::copyBand( const SparseMatrix<MT,true>& m )
+{
+   typedef typename MT::ConstIterator  RhsIterator;
+
+   const size_t n( columns() );
+
+   reset();
+
+   for( size_t j=0UL; j<n; ++j ) {
+      const RhsIterator end( (~m).end(j) );
+      for( RhsIterator element=(~m).begin(j); element!=end; ++element ) {
+         if( isInBand( element->index(), j ) )
+            band_(ku_+element->index()-j,j) = element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deduction of the bandwidths of the given dense matrix.
+//
+// \param m The dense matrix to be analyzed.
+// \param kl Reference to the resulting lower bandwidth.
+// \param ku Reference to the resulting upper bandwidth.
+// \return void
+*/
+template< typename Type >  // Data type of the dense matrix
+template< typename MT      // Type of the foreign matrix
+        , bool SO >        // Storage order of the foreign matrix
+void BandMatrix<Type>::deduceBandwidths( const DenseMatrix<MT,SO>& m, size_t& kl, size_t& ku )
+{
+   const size_t M( (~m).rows()    );
+   const size_t N( (~m).columns() );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         if( isDefault( (~m)(i,j) ) ) continue;
+         if( i > j ) kl = max( kl, i-j );
+         else        ku = max( ku, j-i );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deduction of the bandwidths of the given row-major sparse matrix.
+//
+// \param m The sparse matrix to be analyzed.
+// \param kl Reference to the resulting lower bandwidth.
+// \param ku Reference to the resulting upper bandwidth.
+// \return void
+*/
+template< typename Type >  // Data type of the dense matrix
+template< typename MT >    // Type of the foreign matrix
+void BandMatrix<Type>::deduceBandwidths( const SparseMatrix<MT,false>& m, size_t& kl, size_t& ku )
+{
+   typedef typename MT::ConstIterator  RhsIterator;
+
+   const size_t M( (~m).rows() );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      const RhsIterator end( (~m).end(i) );
+      for( RhsIterator element=(~m).begin(i); element!=end; ++element ) {
+         if( isDefault( element->value() ) ) continue;
+         if( i > element->index() ) kl = max( kl, i-element->index() );
+         else                       ku = max( ku, element->index()-i );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deduction of the bandwidths of the given column-major sparse matrix.
+//
+// \param m The sparse matrix to be analyzed.
+// \param kl Reference to the resulting lower bandwidth.
+// \param ku Reference to the resulting upper bandwidth.
+// \return void
+*/
+template< typename Type >  // Data type of the dense matrix
+template< typename MT >    // Type of the foreign matrix
+void BandMatrix<Type>::deduceBandwidths( const SparseMatrix<MT,true>& m, size_t& kl, size_t& ku )
+{
+   typedef typename MT::ConstIterator  RhsIterator;
+
+   const size_t N( (~m).columns() );
+
+   for( size_t j=0UL; j<N; ++j ) {
+      const RhsIterator end( (~m).end(j) );
+      for( RhsIterator element=(~m).begin(j); element!=end; ++element ) {
+         if( isDefault( element->value() ) ) continue;
+         if( element->index() > j ) kl = max( kl, element->index()-j );
+         else                       ku = max( ku, j-element->index() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the band storage array of the matrix.
+//
+// \return Reference to the band storage array.
+//
+// The elements within the band are stored in a row-major \f$ (k_l+k_u+1) \times N \f$ dense
+// matrix, where the element \f$ a_{ij} \f$ is stored in row \f$ k_u+i-j \f$ and column \f$ j \f$.
+// Elements of the array that don't correspond to an element of the matrix are undefined. This
+// function must \b NOT be called explicitly! It is used internally for the performance optimized
+// evaluation of expression templates and by the band solvers.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline typename BandMatrix<Type>::BandType& BandMatrix<Type>::band()
+{
+   return band_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the band storage array of the matrix.
+//
+// \return Reference to the band storage array.
+//
+// The elements within the band are stored in a row-major \f$ (k_l+k_u+1) \times N \f$ dense
+// matrix, where the element \f$ a_{ij} \f$ is stored in row \f$ k_u+i-j \f$ and column \f$ j \f$.
+// Elements of the array that don't correspond to an element of the matrix are undefined. This
+// function must \b NOT be called explicitly! It is used internally for the performance optimized
+// evaluation of expression templates and by the band solvers.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline const typename BandMatrix<Type>::BandType& BandMatrix<Type>::band() const
+{
+   return band_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type >   // Data type of the dense matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool BandMatrix<Type>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type >   // Data type of the dense matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool BandMatrix<Type>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a false.
+//
+// Since the rows of the band matrix are not stored contiguously in memory, this function always
+// returns \a false.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline bool BandMatrix<Type>::isAligned() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type >  // Data type of the dense matrix
+inline bool BandMatrix<Type>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BANDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BandMatrix operators */
+//@{
+template< typename Type >
+inline void reset( BandMatrix<Type>& m );
+
+template< typename Type >
+inline void reset( BandMatrix<Type>& m, size_t i );
+
+template< typename Type >
+inline void clear( BandMatrix<Type>& m );
+
+template< typename Type >
+inline bool isDefault( const BandMatrix<Type>& m );
+
+template< typename Type >
+inline void swap( BandMatrix<Type>& a, BandMatrix<Type>& b ) /* throw() */;
+
+template< typename Type >
+inline void move( BandMatrix<Type>& dst, BandMatrix<Type>& src ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given band matrix.
+// \ingroup band_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type >  // Data type of the dense matrix
+inline void reset( BandMatrix<Type>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row of the given band matrix.
+// \ingroup band_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row to be resetted.
+// \return void
+*/
+template< typename Type >  // Data type of the dense matrix
+inline void reset( BandMatrix<Type>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given band matrix.
+// \ingroup band_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type >  // Data type of the dense matrix
+inline void clear( BandMatrix<Type>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given band matrix is in default state.
+// \ingroup band_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline bool isDefault( const BandMatrix<Type>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two band matrices.
+// \ingroup band_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline void swap( BandMatrix<Type>& a, BandMatrix<Type>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving the contents of one band matrix to another.
+// \ingroup band_matrix
+//
+// \param dst The destination matrix.
+// \param src The source matrix.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline void move( BandMatrix<Type>& dst, BandMatrix<Type>& src ) /* throw() */
+{
+   dst.swap( src );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+struct IsResizable< BandMatrix<T> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASBANDSTORAGE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+struct HasBandStorage< BandMatrix<T> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+
+template< typename T, bool AF >
+struct HasBandStorage< DenseSubmatrix<BandMatrix<T>,AF,false> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+
+template< typename T, bool AF >
+struct HasBandStorage< DenseSubmatrix<const BandMatrix<T>,AF,false> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename T2, bool SO >
+struct AddTrait< BandMatrix<T1>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct AddTrait< DynamicMatrix<T1,SO>, BandMatrix<T2> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, typename T2, bool SO, typename IT >
+struct AddTrait< BandMatrix<T1>, CompressedMatrix<T2,SO,IT> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename IT, typename T2 >
+struct AddTrait< CompressedMatrix<T1,SO,IT>, BandMatrix<T2> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2 >
+struct AddTrait< BandMatrix<T1>, BandMatrix<T2> >
+{
+   typedef BandMatrix< typename AddTrait<T1,T2>::Type >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename T2, bool SO >
+struct SubTrait< BandMatrix<T1>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct SubTrait< DynamicMatrix<T1,SO>, BandMatrix<T2> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, typename T2, bool SO, typename IT >
+struct SubTrait< BandMatrix<T1>, CompressedMatrix<T2,SO,IT> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename IT, typename T2 >
+struct SubTrait< CompressedMatrix<T1,SO,IT>, BandMatrix<T2> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2 >
+struct SubTrait< BandMatrix<T1>, BandMatrix<T2> >
+{
+   typedef BandMatrix< typename SubTrait<T1,T2>::Type >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename T2 >
+struct MultTrait< BandMatrix<T1>, T2 >
+{
+   typedef BandMatrix< typename MultTrait<T1,T2>::Type >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+
+template< typename T1, typename T2 >
+struct MultTrait< T1, BandMatrix<T2> >
+{
+   typedef BandMatrix< typename MultTrait<T1,T2>::Type >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
+};
+
+template< typename T1, typename T2, size_t N >
+struct MultTrait< BandMatrix<T1>, StaticVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2 >
+struct MultTrait< StaticVector<T1,N,true>, BandMatrix<T2> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, typename T2, size_t N >
+struct MultTrait< BandMatrix<T1>, HybridVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2 >
+struct MultTrait< HybridVector<T1,N,true>, BandMatrix<T2> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, typename T2 >
+struct MultTrait< BandMatrix<T1>, DynamicVector<T2,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2 >
+struct MultTrait< DynamicVector<T1,true>, BandMatrix<T2> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, typename T2, typename IT >
+struct MultTrait< BandMatrix<T1>, CompressedVector<T2,false,IT> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename IT, typename T2 >
+struct MultTrait< CompressedVector<T1,true,IT>, BandMatrix<T2> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, typename T2, bool SO >
+struct MultTrait< BandMatrix<T1>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct MultTrait< DynamicMatrix<T1,SO>, BandMatrix<T2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, typename T2, bool SO, typename IT >
+struct MultTrait< BandMatrix<T1>, CompressedMatrix<T2,SO,IT> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename IT, typename T2 >
+struct MultTrait< CompressedMatrix<T1,SO,IT>, BandMatrix<T2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, typename T2 >
+struct MultTrait< BandMatrix<T1>, BandMatrix<T2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename T2 >
+struct DivTrait< BandMatrix<T1>, T2 >
+{
+   typedef BandMatrix< typename DivTrait<T1,T2>::Type >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATHTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename T2 >
+struct MathTrait< BandMatrix<T1>, BandMatrix<T2> >
+{
+   typedef BandMatrix< typename MathTrait<T1,T2>::HighType >  HighType;
+   typedef BandMatrix< typename MathTrait<T1,T2>::LowType  >  LowType;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1 >
+struct SubmatrixTrait< BandMatrix<T1> >
+{
+   typedef DynamicMatrix<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1 >
+struct RowTrait< BandMatrix<T1> >
+{
+   typedef DynamicVector<T1,true>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1 >
+struct ColumnTrait< BandMatrix<T1> >
+{
+   typedef DynamicVector<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
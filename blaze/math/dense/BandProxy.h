@@ -0,0 +1,873 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BandProxy.h
+//  \brief Header file for the BandProxy class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BANDPROXY_H_
+#define _BLAZE_MATH_DENSE_BANDPROXY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <ostream>
+#include <stdexcept>
+#include <blaze/math/proxy/Proxy.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access proxy for the elements of a BandMatrix.
+// \ingroup band_matrix
+//
+// The BandProxy provides controlled access to the elements of a non-const BandMatrix. Since
+// only the elements within the band of the matrix are stored, the proxy refers either to a
+// stored element or, in case it represents an element outside the band, to a constant zero
+// value. Any attempt to modify an element outside the band results in a \a std::invalid_argument
+// exception:
+
+   \code
+   // Creating a 3x3 band matrix with lower bandwidth 1 and upper bandwidth 0
+   blaze::BandMatrix<int> A( 3UL, 3UL, 1UL, 0UL );
+
+   A(0,0) = -2;  //        ( -2 0 0 )
+   A(1,0) =  3;  // => A = (  3 4 0 )
+   A(1,1) =  4;  //        (  0 1 5 )
+   A(2,1) =  1;
+   A(2,2) =  5;
+
+   A(0,2) =  7;  // Invalid assignment to element outside the band; results in an exception!
+   \endcode
+*/
+template< typename Type >  // Data type of the matrix elements
+class BandProxy : public Proxy< BandProxy<Type>, Type >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef Type         RepresentedType;  //!< Type of the represented matrix element.
+   typedef const Type&  RawReference;     //!< Reference to the represented element.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BandProxy( Type* value, const Type& zero );
+            inline BandProxy( const BandProxy& bp );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                          inline const BandProxy& operator= ( const BandProxy& bp ) const;
+   template< typename T > inline const BandProxy& operator= ( const T& value ) const;
+   template< typename T > inline const BandProxy& operator+=( const T& value ) const;
+   template< typename T > inline const BandProxy& operator-=( const T& value ) const;
+   template< typename T > inline const BandProxy& operator*=( const T& value ) const;
+   template< typename T > inline const BandProxy& operator/=( const T& value ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline RawReference get()          const;
+   inline bool         isRestricted() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator RawReference() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void checkAccess() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Type* const       value_;  //!< Pointer to the accessed stored matrix element.
+                              /*!< The pointer is \a NULL in case the proxy represents an
+                                   element outside the band of the matrix. */
+   const Type* const zero_;   //!< Pointer to the zero element of the matrix.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization constructor for a BandProxy.
+//
+// \param value Pointer to the accessed stored element (\a NULL for elements outside the band).
+// \param zero Reference to the zero element of the matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline BandProxy<Type>::BandProxy( Type* value, const Type& zero )
+   : value_( value )  // Pointer to the accessed stored matrix element
+   , zero_ ( &zero )  // Pointer to the zero element of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for BandProxy.
+//
+// \param bp Band proxy to be copied.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline BandProxy<Type>::BandProxy( const BandProxy& bp )
+   : value_( bp.value_ )  // Pointer to the accessed stored matrix element
+   , zero_ ( bp.zero_  )  // Pointer to the zero element of the matrix
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for BandProxy.
+//
+// \param bp Band proxy to be copied.
+// \return Reference to the assigned proxy.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline const BandProxy<Type>& BandProxy<Type>::operator=( const BandProxy& bp ) const
+{
+   checkAccess();
+
+   *value_ = bp.get();
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment to the accessed matrix element.
+//
+// \param value The new value of the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to matrix element outside the band.
+//
+// In case the proxy represents an element outside the band of the matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename T >     // Type of the right-hand side value
+inline const BandProxy<Type>& BandProxy<Type>::operator=( const T& value ) const
+{
+   checkAccess();
+
+   *value_ = value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment to the accessed matrix element.
+//
+// \param value The right-hand side value to be added to the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to matrix element outside the band.
+//
+// In case the proxy represents an element outside the band of the matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename T >     // Type of the right-hand side value
+inline const BandProxy<Type>& BandProxy<Type>::operator+=( const T& value ) const
+{
+   checkAccess();
+
+   *value_ += value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment to the accessed matrix element.
+//
+// \param value The right-hand side value to be subtracted from the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to matrix element outside the band.
+//
+// In case the proxy represents an element outside the band of the matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename T >     // Type of the right-hand side value
+inline const BandProxy<Type>& BandProxy<Type>::operator-=( const T& value ) const
+{
+   checkAccess();
+
+   *value_ -= value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment to the accessed matrix element.
+//
+// \param value The right-hand side value for the multiplication.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to matrix element outside the band.
+//
+// In case the proxy represents an element outside the band of the matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename T >     // Type of the right-hand side value
+inline const BandProxy<Type>& BandProxy<Type>::operator*=( const T& value ) const
+{
+   checkAccess();
+
+   *value_ *= value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment to the accessed matrix element.
+//
+// \param value The right-hand side value for the division.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to matrix element outside the band.
+//
+// In case the proxy represents an element outside the band of the matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename T >     // Type of the right-hand side value
+inline const BandProxy<Type>& BandProxy<Type>::operator/=( const T& value ) const
+{
+   checkAccess();
+
+   *value_ /= value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returning the value of the accessed matrix element.
+//
+// \return Direct/raw reference to the accessed matrix element.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline typename BandProxy<Type>::RawReference BandProxy<Type>::get() const
+{
+   return ( value_ != NULL )?( *value_ ):( *zero_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the proxy represents a restricted matrix element..
+//
+// \return \a true in case access to the matrix element is restricted, \a false if not.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline bool BandProxy<Type>::isRestricted() const
+{
+   return value_ == NULL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks the access to the represented matrix element.
+//
+// \return void
+// \exception std::invalid_argument Invalid assignment to matrix element outside the band.
+//
+// In case the proxy represents an element outside the band of the matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline void BandProxy<Type>::checkAccess() const
+{
+   if( isRestricted() ) {
+      throw std::invalid_argument( "Invalid assignment to matrix element outside the band" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion to the accessed matrix element.
+//
+// \return Direct/raw reference to the accessed matrix element.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline BandProxy<Type>::operator RawReference() const
+{
+   return get();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BandProxy operators */
+//@{
+template< typename T1, typename T2 >
+inline bool operator==( const BandProxy<T1>& lhs, const BandProxy<T2>& rhs );
+
+template< typename Type, typename T >
+inline bool operator==( const BandProxy<Type>& lhs, const T& rhs );
+
+template< typename T, typename Type >
+inline bool operator==( const T& lhs, const BandProxy<Type>& rhs );
+
+template< typename T1, typename T2 >
+inline bool operator!=( const BandProxy<T1>& lhs, const BandProxy<T2>& rhs );
+
+template< typename Type, typename T >
+inline bool operator!=( const BandProxy<Type>& lhs, const T& rhs );
+
+template< typename T, typename Type >
+inline bool operator!=( const T& lhs, const BandProxy<Type>& rhs );
+
+template< typename T1, typename T2 >
+inline bool operator<( const BandProxy<T1>& lhs, const BandProxy<T2>& rhs );
+
+template< typename Type, typename T >
+inline bool operator<( const BandProxy<Type>& lhs, const T& rhs );
+
+template< typename T, typename Type >
+inline bool operator<( const T& lhs, const BandProxy<Type>& rhs );
+
+template< typename T1, typename T2 >
+inline bool operator>( const BandProxy<T1>& lhs, const BandProxy<T2>& rhs );
+
+template< typename Type, typename T >
+inline bool operator>( const BandProxy<Type>& lhs, const T& rhs );
+
+template< typename T, typename Type >
+inline bool operator>( const T& lhs, const BandProxy<Type>& rhs );
+
+template< typename T1, typename T2 >
+inline bool operator<=( const BandProxy<T1>& lhs, const BandProxy<T2>& rhs );
+
+template< typename Type, typename T >
+inline bool operator<=( const BandProxy<Type>& lhs, const T& rhs );
+
+template< typename T, typename Type >
+inline bool operator<=( const T& lhs, const BandProxy<Type>& rhs );
+
+template< typename T1, typename T2 >
+inline bool operator>=( const BandProxy<T1>& lhs, const BandProxy<T2>& rhs );
+
+template< typename Type, typename T >
+inline bool operator>=( const BandProxy<Type>& lhs, const T& rhs );
+
+template< typename T, typename Type >
+inline bool operator>=( const T& lhs, const BandProxy<Type>& rhs );
+
+template< typename Type >
+inline std::ostream& operator<<( std::ostream& os, const BandProxy<Type>& proxy );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two BandProxy objects.
+// \ingroup band_matrix
+//
+// \param lhs The left-hand side BandProxy object.
+// \param rhs The right-hand side BandProxy object.
+// \return \a true if both referenced values are equal, \a false if they are not.
+*/
+template< typename T1, typename T2 >
+inline bool operator==( const BandProxy<T1>& lhs, const BandProxy<T2>& rhs )
+{
+   return ( lhs.get() == rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between a BandProxy object and an object of different type.
+// \ingroup band_matrix
+//
+// \param lhs The left-hand side BandProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the referenced value and the other object are equal, \a false if they are not.
+*/
+template< typename Type, typename T >
+inline bool operator==( const BandProxy<Type>& lhs, const T& rhs )
+{
+   return ( lhs.get() == rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between an object of different type and a BandProxy object.
+// \ingroup band_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side BandProxy object.
+// \return \a true if the other object and the referenced value are equal, \a false if they are not.
+*/
+template< typename T, typename Type >
+inline bool operator==( const T& lhs, const BandProxy<Type>& rhs )
+{
+   return ( lhs == rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two BandProxy objects.
+// \ingroup band_matrix
+//
+// \param lhs The left-hand side BandProxy object.
+// \param rhs The right-hand side BandProxy object.
+// \return \a true if both referenced values are not equal, \a false if they are.
+*/
+template< typename T1, typename T2 >
+inline bool operator!=( const BandProxy<T1>& lhs, const BandProxy<T2>& rhs )
+{
+   return ( lhs.get() != rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between a BandProxy object and an object of different type.
+// \ingroup band_matrix
+//
+// \param lhs The left-hand side BandProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the referenced value and the other object are not equal, \a false if they are.
+*/
+template< typename Type, typename T >
+inline bool operator!=( const BandProxy<Type>& lhs, const T& rhs )
+{
+   return ( lhs.get() != rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inquality comparison between an object of different type and a BandProxy object.
+// \ingroup band_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side BandProxy object.
+// \return \a true if the other object and the referenced value are not equal, \a false if they are.
+*/
+template< typename T, typename Type >
+inline bool operator!=( const T& lhs, const BandProxy<Type>& rhs )
+{
+   return ( lhs != rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between two BandProxy objects.
+// \ingroup band_matrix
+//
+// \param lhs The left-hand side BandProxy object.
+// \param rhs The right-hand side BandProxy object.
+// \return \a true if the left-hand side referenced value is smaller, \a false if not.
+*/
+template< typename T1, typename T2 >
+inline bool operator<( const BandProxy<T1>& lhs, const BandProxy<T2>& rhs )
+{
+   return ( lhs.get() < rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between a BandProxy object and an object of different type.
+// \ingroup band_matrix
+//
+// \param lhs The left-hand side BandProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is smaller, \a false if not.
+*/
+template< typename Type, typename T >
+inline bool operator<( const BandProxy<Type>& lhs, const T& rhs )
+{
+   return ( lhs.get() < rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between an object of different type and a BandProxy object.
+// \ingroup band_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side BandProxy object.
+// \return \a true if the left-hand side other object is smaller, \a false if not.
+*/
+template< typename T, typename Type >
+inline bool operator<( const T& lhs, const BandProxy<Type>& rhs )
+{
+   return ( lhs < rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between two BandProxy objects.
+// \ingroup band_matrix
+//
+// \param lhs The left-hand side BandProxy object.
+// \param rhs The right-hand side BandProxy object.
+// \return \a true if the left-hand side referenced value is greater, \a false if not.
+*/
+template< typename T1, typename T2 >
+inline bool operator>( const BandProxy<T1>& lhs, const BandProxy<T2>& rhs )
+{
+   return ( lhs.get() > rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between a BandProxy object and an object of different type.
+// \ingroup band_matrix
+//
+// \param lhs The left-hand side BandProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is greater, \a false if not.
+*/
+template< typename Type, typename T >
+inline bool operator>( const BandProxy<Type>& lhs, const T& rhs )
+{
+   return ( lhs.get() > rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between an object of different type and a BandProxy object.
+// \ingroup band_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side BandProxy object.
+// \return \a true if the left-hand side other object is greater, \a false if not.
+*/
+template< typename T, typename Type >
+inline bool operator>( const T& lhs, const BandProxy<Type>& rhs )
+{
+   return ( lhs > rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between two BandProxy objects.
+// \ingroup band_matrix
+//
+// \param lhs The left-hand side BandProxy object.
+// \param rhs The right-hand side BandProxy object.
+// \return \a true if the left-hand side referenced value is smaller or equal, \a false if not.
+*/
+template< typename T1, typename T2 >
+inline bool operator<=( const BandProxy<T1>& lhs, const BandProxy<T2>& rhs )
+{
+   return ( lhs.get() <= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between a BandProxy object and an object of different type.
+// \ingroup band_matrix
+//
+// \param lhs The left-hand side BandProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is smaller or equal, \a false if not.
+*/
+template< typename Type, typename T >
+inline bool operator<=( const BandProxy<Type>& lhs, const T& rhs )
+{
+   return ( lhs.get() <= rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between an object of different type and a BandProxy object.
+// \ingroup band_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side BandProxy object.
+// \return \a true if the left-hand side other object is smaller or equal, \a false if not.
+*/
+template< typename T, typename Type >
+inline bool operator<=( const T& lhs, const BandProxy<Type>& rhs )
+{
+   return ( lhs <= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between two BandProxy objects.
+// \ingroup band_matrix
+//
+// \param lhs The left-hand side BandProxy object.
+// \param rhs The right-hand side BandProxy object.
+// \return \a true if the left-hand side referenced value is greater or equal, \a false if not.
+*/
+template< typename T1, typename T2 >
+inline bool operator>=( const BandProxy<T1>& lhs, const BandProxy<T2>& rhs )
+{
+   return ( lhs.get() >= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between a BandProxy object and an object of different type.
+// \ingroup band_matrix
+//
+// \param lhs The left-hand side BandProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is greater or equal, \a false if not.
+*/
+template< typename Type, typename T >
+inline bool operator>=( const BandProxy<Type>& lhs, const T& rhs )
+{
+   return ( lhs.get() >= rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between an object of different type and a BandProxy object.
+// \ingroup band_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side BandProxy object.
+// \return \a true if the left-hand side other object is greater or equal, \a false if not.
+*/
+template< typename T, typename Type >
+inline bool operator>=( const T& lhs, const BandProxy<Type>& rhs )
+{
+   return ( lhs >= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Global output operator for proxies on band matrices.
+// \ingroup band_matrix
+//
+// \param os Reference to the output stream.
+// \param proxy Reference to a constant proxy object.
+// \return Reference to the output stream.
+*/
+template< typename Type >
+inline std::ostream& operator<<( std::ostream& os, const BandProxy<Type>& proxy )
+{
+   return os << proxy.get();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BandProxy global functions */
+//@{
+template< typename Type >
+inline void reset( const BandProxy<Type>& proxy );
+
+template< typename Type >
+inline void clear( const BandProxy<Type>& proxy );
+
+template< typename Type >
+inline bool isDefault( const BandProxy<Type>& proxy );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the represented element to the default initial values.
+// \ingroup band_matrix
+//
+// \param proxy The given access proxy.
+// \return void
+//
+// This function resets the element represented by the access proxy to its default initial
+// value.
+*/
+template< typename Type >
+inline void reset( const BandProxy<Type>& proxy )
+{
+   using blaze::reset;
+
+   reset( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the represented element.
+// \ingroup band_matrix
+//
+// \param proxy The given access proxy.
+// \return void
+//
+// This function clears the element represented by the access proxy to its default initial
+// state.
+*/
+template< typename Type >
+inline void clear( const BandProxy<Type>& proxy )
+{
+   using blaze::clear;
+
+   clear( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the represented element is in default state.
+// \ingroup band_matrix
+//
+// \param proxy The given access proxy
+// \return \a true in case the represented element is in default state, \a false otherwise.
+//
+// This function checks whether the element represented by the access proxy is in default state.
+// In case it is in default state, the function returns \a true, otherwise it returns \a false.
+*/
+template< typename Type >
+inline bool isDefault( const BandProxy<Type>& proxy )
+{
+   using blaze::isDefault;
+
+   return isDefault( proxy.get() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,713 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BandSolvers.h
+//  \brief Direct solvers for band and tridiagonal systems of linear equations
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_BANDSOLVERS_H_
+#define _BLAZE_MATH_DENSE_BANDSOLVERS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/SMP.h>
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+#  include <omp.h>
+#  include <blaze/math/smp/openmp/Functions.h>
+#endif
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/dense/BandMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BAND LU DECOMPOSITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief LU decomposition with partial pivoting of the given square band matrix.
+// \ingroup band_matrix
+//
+// \param A The band matrix to be decomposed.
+// \param pivots The resulting row interchanges.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Singular matrix provided.
+//
+// This function computes the LU decomposition \f$ P \cdot A = L \cdot U \f$ of the given square
+// band matrix with \f$ k_l \f$ subdiagonals and \f$ k_u \f$ superdiagonals in place. Since the
+// row interchanges increase the number of superdiagonals of \a U, the upper bandwidth of \a A
+// is extended to \f$ k_l+k_u \f$. On exit, the superdiagonals and the diagonal of \a A contain
+// the factor \a U and the subdiagonals contain the multipliers of the unit lower triangular
+// factor \a L. The row interchanges are returned in \a pivots, where row \a i has been
+// interchanged with row \a pivots[i]. The factorization can be used with the luSolve() function
+// to solve systems of linear equations:
+
+   \code
+   blaze::BandMatrix<double> A( 1000UL, 1000UL, 2UL, 3UL );
+   blaze::DynamicVector<double> b( 1000UL );
+   std::vector<size_t> pivots;
+   // ... Initialization
+
+   lu( A, pivots );
+   luSolve( A, pivots, b );  // Computes the solution of the original system in place
+   \endcode
+
+// In contrast to a full LU decomposition the computational cost of the band decomposition is
+// only \f$ O(N \cdot k_l \cdot (k_l+k_u)) \f$. In case the given matrix is not square, a
+// \a std::invalid_argument exception is thrown. In case the matrix is singular, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the band matrix
+void lu( BandMatrix<Type>& A, std::vector<size_t>& pivots )
+{
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+
+   if( A.rows() != A.columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   const size_t n ( A.rows() );
+   const size_t kl( A.lowerBandwidth() );
+   const size_t ku( A.lowerBandwidth() + A.upperBandwidth() );
+
+   A.setBandwidths( kl, ku );
+   pivots.resize( n );
+
+   typename BandMatrix<Type>::BandType& band( A.band() );
+
+   size_t ju( 0UL );
+
+   for( size_t j=0UL; j<n; ++j )
+   {
+      const size_t km( min( kl, n-1UL-j ) );
+
+      size_t p( j );
+      for( size_t i=j+1UL; i<=j+km; ++i ) {
+         if( std::abs( band(ku+i-j,j) ) > std::abs( band(ku+p-j,j) ) )
+            p = i;
+      }
+
+      if( isDefault( band(ku+p-j,j) ) )
+         throw std::runtime_error( "Singular matrix provided" );
+
+      pivots[j] = p;
+      ju = max( ju, min( p+ku-kl, n-1UL ) );
+
+      if( p != j ) {
+         for( size_t k=j; k<=ju; ++k )
+            std::swap( band(ku+j-k,k), band(ku+p-k,k) );
+      }
+
+      const Type pivot( band(ku,j) );
+
+      for( size_t i=j+1UL; i<=j+km; ++i )
+         band(ku+i-j,j) /= pivot;
+
+      for( size_t k=j+1UL; k<=ju; ++k ) {
+         const Type ujk( band(ku+j-k,k) );
+         for( size_t i=j+1UL; i<=j+km; ++i )
+            band(ku+i-k,k) -= band(ku+i-j,j) * ujk;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving a band system of linear equations by means of a band LU decomposition.
+// \ingroup band_matrix
+//
+// \param LU The LU decomposition of the band matrix as computed by the lu() function.
+// \param pivots The row interchanges as computed by the lu() function.
+// \param b The right-hand side vector, which is overwritten with the solution.
+// \return void
+// \exception std::invalid_argument Invalid LU decomposition provided.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the system of linear equations \f$ A \cdot x = b \f$ for the band matrix
+// \a A, given the LU decomposition of \a A computed by the lu() function. The forward
+// substitution with \a L requires \f$ O(N \cdot k_l) \f$ and the backward substitution with
+// \a U requires \f$ O(N \cdot (k_l+k_u)) \f$ operations.
+*/
+template< typename Type  // Data type of the band matrix
+        , typename VT >  // Type of the right-hand side dense vector
+void luSolve( const BandMatrix<Type>& LU, const std::vector<size_t>& pivots,
+              DenseVector<VT,false>& b )
+{
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+
+   if( LU.rows() != LU.columns() || pivots.size() != LU.rows() )
+      throw std::invalid_argument( "Invalid LU decomposition provided" );
+
+   if( (~b).size() != LU.rows() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   const size_t n ( LU.rows() );
+   const size_t kl( LU.lowerBandwidth() );
+   const size_t ku( LU.upperBandwidth() );
+
+   const typename BandMatrix<Type>::BandType& band( LU.band() );
+
+   for( size_t j=0UL; j+1UL<n; ++j )
+   {
+      const size_t p( pivots[j] );
+      if( p != j )
+         std::swap( (~b)[j], (~b)[p] );
+
+      const size_t iend( min( j+kl, n-1UL ) );
+      for( size_t i=j+1UL; i<=iend; ++i )
+         (~b)[i] -= band(ku+i-j,j) * (~b)[j];
+   }
+
+   for( size_t j=n; j>0UL; --j )
+   {
+      (~b)[j-1UL] /= band(ku,j-1UL);
+
+      const size_t ibegin( ( j-1UL > ku )?( j-1UL-ku ):( 0UL ) );
+      for( size_t i=ibegin; i<j-1UL; ++i )
+         (~b)[i] -= band(ku+i+1UL-j,j-1UL) * (~b)[j-1UL];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving a band system of linear equations.
+// \ingroup band_matrix
+//
+// \param A The square system matrix.
+// \param b The right-hand side vector, which is overwritten with the solution.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector sizes do not match.
+// \exception std::runtime_error Singular matrix provided.
+//
+// This function solves the system of linear equations \f$ A \cdot x = b \f$ by means of a band
+// LU decomposition with partial pivoting of a copy of \a A (see the lu() function).
+*/
+template< typename Type  // Data type of the band matrix
+        , typename VT >  // Type of the right-hand side dense vector
+void solve( const BandMatrix<Type>& A, DenseVector<VT,false>& b )
+{
+   if( (~b).size() != A.rows() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   BandMatrix<Type> LU( A );
+   std::vector<size_t> pivots;
+
+   lu( LU, pivots );
+   luSolve( LU, pivots, b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BAND CHOLESKY DECOMPOSITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Cholesky decomposition of the given symmetric positive definite band matrix.
+// \ingroup band_matrix
+//
+// \param A The symmetric positive definite band matrix to be decomposed.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Matrix is not positive definite.
+//
+// This function computes the Cholesky decomposition \f$ A = L \cdot L^T \f$ of the given
+// symmetric positive definite band matrix in place. Only the diagonal and the subdiagonals of
+// \a A are referenced. On exit, \a A contains the lower triangular factor \a L with the same
+// lower bandwidth as \a A and an upper bandwidth of 0. The factorization can be used with the
+// llhSolve() function to solve systems of linear equations. The decomposition requires
+// \f$ O(N \cdot k_l^2) \f$ operations. In case the given matrix is not square, a
+// \a std::invalid_argument exception is thrown. In case the matrix is not positive definite, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the band matrix
+void llh( BandMatrix<Type>& A )
+{
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+
+   if( A.rows() != A.columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   const size_t n ( A.rows() );
+   const size_t kl( A.lowerBandwidth() );
+   const size_t ku( A.upperBandwidth() );
+
+   typename BandMatrix<Type>::BandType& band( A.band() );
+
+   for( size_t j=0UL; j<n; ++j )
+   {
+      const size_t kbegin( ( j > kl )?( j-kl ):( 0UL ) );
+
+      Type d( band(ku,j) );
+      for( size_t k=kbegin; k<j; ++k )
+         d -= band(ku+j-k,k) * band(ku+j-k,k);
+
+      if( d <= Type() )
+         throw std::runtime_error( "Matrix is not positive definite" );
+
+      d = std::sqrt( d );
+      band(ku,j) = d;
+
+      const size_t iend( min( j+kl, n-1UL ) );
+      for( size_t i=j+1UL; i<=iend; ++i )
+      {
+         Type lij( band(ku+i-j,j) );
+         for( size_t k=( ( i > kl )?( i-kl ):( 0UL ) ); k<j; ++k )
+            lij -= band(ku+i-k,k) * band(ku+j-k,k);
+         band(ku+i-j,j) = lij / d;
+      }
+   }
+
+   for( size_t r=0UL; r<ku; ++r ) {
+      for( size_t j=0UL; j<n; ++j )
+         band(r,j) = Type();
+   }
+
+   A.setBandwidths( kl, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving a band system of linear equations by means of a band Cholesky decomposition.
+// \ingroup band_matrix
+//
+// \param L The Cholesky factor of the band matrix as computed by the llh() function.
+// \param b The right-hand side vector, which is overwritten with the solution.
+// \return void
+// \exception std::invalid_argument Invalid Cholesky decomposition provided.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function solves the system of linear equations \f$ A \cdot x = b \f$ for the symmetric
+// positive definite band matrix \a A, given the Cholesky factor \a L of \a A computed by the
+// llh() function.
+*/
+template< typename Type  // Data type of the band matrix
+        , typename VT >  // Type of the right-hand side dense vector
+void llhSolve( const BandMatrix<Type>& L, DenseVector<VT,false>& b )
+{
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+
+   if( L.rows() != L.columns() || L.upperBandwidth() != 0UL )
+      throw std::invalid_argument( "Invalid Cholesky decomposition provided" );
+
+   if( (~b).size() != L.rows() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   const size_t n ( L.rows() );
+   const size_t kl( L.lowerBandwidth() );
+
+   const typename BandMatrix<Type>::BandType& band( L.band() );
+
+   for( size_t j=0UL; j<n; ++j )
+   {
+      (~b)[j] /= band(0UL,j);
+
+      const size_t iend( min( j+kl, n-1UL ) );
+      for( size_t i=j+1UL; i<=iend; ++i )
+         (~b)[i] -= band(i-j,j) * (~b)[j];
+   }
+
+   for( size_t i=n; i>0UL; --i )
+   {
+      const size_t kend( min( i-1UL+kl, n-1UL ) );
+      for( size_t k=i; k<=kend; ++k )
+         (~b)[i-1UL] -= band(k+1UL-i,i-1UL) * (~b)[k];
+
+      (~b)[i-1UL] /= band(0UL,i-1UL);
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TRIDIAGONAL SOLVERS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solving a tridiagonal system of linear equations.
+// \ingroup band_matrix
+//
+// \param A The square tridiagonal system matrix.
+// \param b The right-hand side vector, which is overwritten with the solution.
+// \return void
+// \exception std::invalid_argument Invalid tridiagonal matrix provided.
+// \exception std::invalid_argument Vector sizes do not match.
+// \exception std::runtime_error Singular matrix provided.
+//
+// This function solves the system of linear equations \f$ A \cdot x = b \f$ for the given
+// square band matrix with at most one subdiagonal and one superdiagonal by means of the Thomas
+// algorithm in \f$ O(N) \f$ operations. Since the algorithm does not perform any pivoting, it
+// should only be used for diagonally dominant or symmetric positive definite matrices. In case
+// the matrix is not a square tridiagonal matrix, a \a std::invalid_argument exception is thrown.
+// In case a zero pivot is encountered, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the band matrix
+        , typename VT >  // Type of the right-hand side dense vector
+void solveTridiagonal( const BandMatrix<Type>& A, DenseVector<VT,false>& b )
+{
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+
+   if( A.rows() != A.columns() || A.lowerBandwidth() > 1UL || A.upperBandwidth() > 1UL )
+      throw std::invalid_argument( "Invalid tridiagonal matrix provided" );
+
+   if( (~b).size() != A.rows() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   const size_t n( A.rows() );
+
+   if( n == 0UL ) return;
+
+   DynamicVector<Type> c( n );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const Type a( ( i > 0UL )?( A(i,i-1UL) ):( Type() ) );
+      const Type m( ( i > 0UL )?( A(i,i) - a * c[i-1UL] ):( A(i,i) ) );
+
+      if( isDefault( m ) )
+         throw std::runtime_error( "Singular matrix provided" );
+
+      c[i] = ( ( i+1UL < n )?( A(i,i+1UL) ):( Type() ) ) / m;
+      (~b)[i] = ( ( i > 0UL )?( (~b)[i] - a * (~b)[i-1UL] ):( (~b)[i] ) ) / m;
+   }
+
+   for( size_t i=n-1UL; i>0UL; --i ) {
+      (~b)[i-1UL] -= c[i-1UL] * (~b)[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the batched tridiagonal solver.
+// \ingroup band_matrix
+//
+// This helper struct determines whether the batched tridiagonal solver can use the vectorized
+// kernel for the given operand types. The vectorized kernel directly accesses the contiguous
+// rows of the operands and is therefore restricted to non-expression types.
+*/
+template< typename T1    // Type of the subdiagonal operand
+        , typename T2    // Type of the diagonal operand
+        , typename T3    // Type of the superdiagonal operand
+        , typename T4 >  // Type of the right-hand side/solution operand
+struct UseVectorizedTridiagonalKernel
+{
+   //**********************************************************************************************
+   typedef typename T4::ElementType  ET;
+
+   enum { value = T1::vectorizable && T2::vectorizable && T3::vectorizable && T4::vectorizable &&
+                  !IsExpression<T1>::value && !IsExpression<T2>::value &&
+                  !IsExpression<T3>::value && !IsExpression<T4>::value &&
+                  IsSame<typename T1::ElementType,ET>::value &&
+                  IsSame<typename T2::ElementType,ET>::value &&
+                  IsSame<typename T3::ElementType,ET>::value &&
+                  IntrinsicTrait<ET>::addition &&
+                  IntrinsicTrait<ET>::subtraction &&
+                  IntrinsicTrait<ET>::multiplication &&
+                  IntrinsicTrait<ET>::division };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel of the batched tridiagonal solver.
+// \ingroup band_matrix
+//
+// \param a The subdiagonals of the systems.
+// \param d The diagonals of the systems.
+// \param c The superdiagonals of the systems.
+// \param B The right-hand sides of the systems, which are overwritten with the solutions.
+// \param C The workspace for the modified superdiagonals.
+// \param kbegin The index of the first system to be solved.
+// \param kend The index one past the last system to be solved.
+// \return void
+//
+// This function solves the systems \a kbegin to \a kend by means of the Thomas algorithm. The
+// systems are traversed row by row in order to access the row-major operands contiguously.
+*/
+template< typename MT1    // Type of the subdiagonal operand
+        , typename MT2    // Type of the diagonal operand
+        , typename MT3    // Type of the superdiagonal operand
+        , typename MT4    // Type of the right-hand side/solution operand
+        , typename MT5 >  // Type of the workspace
+typename DisableIf< UseVectorizedTridiagonalKernel<MT1,MT2,MT3,MT4> >::Type
+   tridiagonalKernel( const MT1& a, const MT2& d, const MT3& c, MT4& B, MT5& C,
+                      size_t kbegin, size_t kend )
+{
+   typedef typename MT4::ElementType  ET;
+
+   const size_t n( B.rows() );
+
+   for( size_t k=kbegin; k<kend; ++k ) {
+      C(0UL,k) = c(0UL,k) / d(0UL,k);
+      B(0UL,k) = B(0UL,k) / d(0UL,k);
+   }
+
+   for( size_t i=1UL; i<n; ++i ) {
+      for( size_t k=kbegin; k<kend; ++k ) {
+         const ET m( d(i,k) - a(i,k) * C(i-1UL,k) );
+         C(i,k) = c(i,k) / m;
+         B(i,k) = ( B(i,k) - a(i,k) * B(i-1UL,k) ) / m;
+      }
+   }
+
+   for( size_t i=n-1UL; i>0UL; --i ) {
+      for( size_t k=kbegin; k<kend; ++k )
+         B(i-1UL,k) -= C(i-1UL,k) * B(i,k);
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel of the batched tridiagonal solver.
+// \ingroup band_matrix
+//
+// \param a The subdiagonals of the systems.
+// \param d The diagonals of the systems.
+// \param c The superdiagonals of the systems.
+// \param B The right-hand sides of the systems, which are overwritten with the solutions.
+// \param C The workspace for the modified superdiagonals.
+// \param kbegin The index of the first system to be solved.
+// \param kend The index one past the last system to be solved.
+// \return void
+//
+// This function solves the systems \a kbegin to \a kend by means of the Thomas algorithm.
+// Since the systems are stored in the columns of the row-major operands, several systems are
+// solved simultaneously by means of intrinsics.
+*/
+template< typename MT1    // Type of the subdiagonal operand
+        , typename MT2    // Type of the diagonal operand
+        , typename MT3    // Type of the superdiagonal operand
+        , typename MT4    // Type of the right-hand side/solution operand
+        , typename MT5 >  // Type of the workspace
+typename EnableIf< UseVectorizedTridiagonalKernel<MT1,MT2,MT3,MT4> >::Type
+   tridiagonalKernel( const MT1& a, const MT2& d, const MT3& c, MT4& B, MT5& C,
+                      size_t kbegin, size_t kend )
+{
+   typedef typename MT4::ElementType  ET;
+   typedef IntrinsicTrait<ET>         IT;
+   typedef typename IT::Type          IntrinsicType;
+
+   const size_t n   ( B.rows() );
+   const size_t kpos( kbegin + ( ( kend - kbegin ) & size_t(-IT::size) ) );
+
+   const ET* const pa( a.data() );
+   const ET* const pd( d.data() );
+   const ET* const pc( c.data() );
+   ET* const pb( B.data() );
+   ET* const pw( C.data() );
+
+   const size_t sa( a.spacing() );
+   const size_t sd( d.spacing() );
+   const size_t sc( c.spacing() );
+   const size_t sb( B.spacing() );
+   const size_t sw( C.spacing() );
+
+   for( size_t k=kbegin; k<kpos; k+=IT::size ) {
+      const IntrinsicType d0( loadu( pd+k ) );
+      storeu( pw+k, loadu( pc+k ) / d0 );
+      storeu( pb+k, loadu( pb+k ) / d0 );
+   }
+
+   for( size_t i=1UL; i<n; ++i ) {
+      for( size_t k=kbegin; k<kpos; k+=IT::size ) {
+         const IntrinsicType ai( loadu( pa+i*sa+k ) );
+         const IntrinsicType m ( loadu( pd+i*sd+k ) - ai * loadu( pw+(i-1UL)*sw+k ) );
+         storeu( pw+i*sw+k, loadu( pc+i*sc+k ) / m );
+         storeu( pb+i*sb+k, ( loadu( pb+i*sb+k ) - ai * loadu( pb+(i-1UL)*sb+k ) ) / m );
+      }
+   }
+
+   for( size_t i=n-1UL; i>0UL; --i ) {
+      for( size_t k=kbegin; k<kpos; k+=IT::size ) {
+         ET* const pi( pb+(i-1UL)*sb+k );
+         storeu( pi, loadu( pi ) - loadu( pw+(i-1UL)*sw+k ) * loadu( pb+i*sb+k ) );
+      }
+   }
+
+   for( size_t k=kpos; k<kend; ++k ) {
+      C(0UL,k) = c(0UL,k) / d(0UL,k);
+      B(0UL,k) = B(0UL,k) / d(0UL,k);
+   }
+
+   for( size_t i=1UL; i<n; ++i ) {
+      for( size_t k=kpos; k<kend; ++k ) {
+         const ET m( d(i,k) - a(i,k) * C(i-1UL,k) );
+         C(i,k) = c(i,k) / m;
+         B(i,k) = ( B(i,k) - a(i,k) * B(i-1UL,k) ) / m;
+      }
+   }
+
+   for( size_t i=n-1UL; i>0UL; --i ) {
+      for( size_t k=kpos; k<kend; ++k )
+         B(i-1UL,k) -= C(i-1UL,k) * B(i,k);
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving a batch of tridiagonal systems of linear equations.
+// \ingroup band_matrix
+//
+// \param lower The subdiagonals of the systems.
+// \param diag The diagonals of the systems.
+// \param upper The superdiagonals of the systems.
+// \param B The right-hand sides of the systems, which are overwritten with the solutions.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function simultaneously solves \a S independent tridiagonal systems of size \a N by
+// means of the Thomas algorithm. All operands are \f$ N \times S \f$ row-major matrices, whose
+// \a k-th column represents the \a k-th system: \a lower(i,k), \a diag(i,k) and \a upper(i,k)
+// are the elements \f$ a_{i,i-1} \f$, \f$ a_{ii} \f$ and \f$ a_{i,i+1} \f$ of the \a k-th
+// system matrix and \a B(i,k) is the \a i-th element of the \a k-th right-hand side. The first
+// row of \a lower and the last row of \a upper are not referenced.
+
+   \code
+   const size_t N( 100UL ), S( 1000UL );
+
+   blaze::DynamicMatrix<double> lower( N, S, -1.0 ), diag( N, S, 4.0 ), upper( N, S, -1.0 );
+   blaze::DynamicMatrix<double> B( N, S, 1.0 );
+
+   solveTridiagonal( lower, diag, upper, B );  // Solves 1000 systems of size 100
+   \endcode
+
+// Since the systems are stored in the columns of row-major matrices, several systems are
+// solved at once by means of intrinsics. Additionally, in case the OpenMP parallelization is
+// active and the number of systems exceeds the SMP dense matrix assignment threshold, the
+// systems are distributed among the available threads. Note however that no pivoting is
+// performed and that zero pivots are not detected, i.e. the systems are expected to be
+// diagonally dominant or symmetric positive definite.
+*/
+template< typename MT1    // Type of the subdiagonal operand
+        , typename MT2    // Type of the diagonal operand
+        , typename MT3    // Type of the superdiagonal operand
+        , typename MT4 >  // Type of the right-hand side/solution operand
+void solveTridiagonal( const DenseMatrix<MT1,false>& lower, const DenseMatrix<MT2,false>& diag,
+                       const DenseMatrix<MT3,false>& upper, DenseMatrix<MT4,false>& B )
+{
+   typedef typename MT4::ElementType  ET;
+   typedef IntrinsicTrait<ET>         IT;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( ET );
+
+   if( (~lower).rows() != (~B).rows() || (~lower).columns() != (~B).columns() ||
+       (~diag).rows()  != (~B).rows() || (~diag).columns()  != (~B).columns() ||
+       (~upper).rows() != (~B).rows() || (~upper).columns() != (~B).columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   const size_t n( (~B).rows() );
+   const size_t s( (~B).columns() );
+
+   if( n == 0UL || s == 0UL ) return;
+
+   typename MT1::CompositeType a( ~lower );
+   typename MT2::CompositeType d( ~diag  );
+   typename MT3::CompositeType c( ~upper );
+
+   DynamicMatrix<ET,false> C( n, s );
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+   if( !isSerialSectionActive() && s > SMP_DMATASSIGN_THRESHOLD )
+   {
+      const size_t threads   ( getAvailableThreads() );
+      const size_t addon     ( ( ( s % threads ) != 0UL )?( 1UL ):( 0UL ) );
+      const size_t equalShare( s / threads + addon );
+      const size_t rest      ( equalShare & ( IT::size - 1UL ) );
+      const size_t blocksize ( ( rest )?( equalShare - rest + IT::size ):( equalShare ) );
+      const int    blocks    ( static_cast<int>( ( s - 1UL ) / blocksize + 1UL ) );
+
+#pragma omp parallel for schedule(static,1) shared(a,d,c,B,C) num_threads( blocks )
+      for( int b=0; b<blocks; ++b ) {
+         const size_t kbegin( b*blocksize );
+         const size_t kend  ( min( kbegin+blocksize, s ) );
+         tridiagonalKernel( a, d, c, ~B, C, kbegin, kend );
+      }
+
+      return;
+   }
+#endif
+
+   tridiagonalKernel( a, d, c, ~B, C, 0UL, s );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
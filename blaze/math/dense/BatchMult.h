@@ -0,0 +1,293 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BatchMult.h
+//  \brief Parallel execution of batches of independent dense matrix/dense matrix multiplications
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BATCHMULT_H_
+#define _BLAZE_MATH_DENSE_BATCHMULT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/SMP.h>
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+#  include <blaze/math/smp/openmp/Functions.h>
+#endif
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <blaze/math/DenseSubmatrix.h>
+#  include <blaze/math/smp/threads/ThreadBackend.h>
+#  include <blaze/math/traits/SubmatrixExprTrait.h>
+#endif
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/traits/MultExprTrait.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY CLASS TEMPLATES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief A single matrix/matrix multiplication of a batch of products.
+// \ingroup dense_matrix
+//
+// The BatchMultTask class template represents the multiplication \f$ C = A \cdot B \f$ of a
+// batch of independent products. In addition to the three operands it stores the number of
+// multiply-add operations of the product, which is used as cost estimate for the scheduling.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2    // Type of the right-hand side dense matrix
+        , typename MT3 >  // Type of the target dense matrix
+struct BatchMultTask
+{
+   //**Utility functions***************************************************************************
+   /*!\brief Comparison of the costs and shapes of two products.
+   //
+   // \param rhs The product to be compared with.
+   // \return \a true if this product has to be executed before the given product.
+   //
+   // Expensive products are ordered before cheap products. Products of equal costs are ordered
+   // by their shapes such that equally shaped products are executed consecutively.
+   */
+   inline bool operator<( const BatchMultTask& rhs ) const {
+      if( ops_ != rhs.ops_ )
+         return ops_ > rhs.ops_;
+      if( lhs_->rows() != rhs.lhs_->rows() )
+         return lhs_->rows() < rhs.lhs_->rows();
+      return lhs_->columns() < rhs.lhs_->columns();
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   const MT1* lhs_;  //!< The left-hand side operand of the product.
+   const MT2* rhs_;  //!< The right-hand side operand of the product.
+   MT3* target_;     //!< The target of the product.
+   size_t ops_;      //!< The number of multiply-add operations of the product.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Single-threaded execution of a single product of a batch of products.
+// \ingroup dense_matrix
+//
+// \param task The product to be executed.
+// \return void
+//
+// This function computes the given product by means of the serial assign() function. The
+// target matrix is required to be resized to the size of the product beforehand.
+*/
+template< typename MT1    // Type of the left-hand side dense matrix
+        , typename MT2    // Type of the right-hand side dense matrix
+        , typename MT3 >  // Type of the target dense matrix
+inline void batchMultKernel( const BatchMultTask<MT1,MT2,MT3>& task )
+{
+   assign( *task.target_, (*task.lhs_) * (*task.rhs_) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCH MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes a batch of independent dense matrix/dense matrix multiplications.
+// \ingroup dense_matrix
+//
+// \param firstA Iterator to the first left-hand side operand.
+// \param lastA Iterator one past the last left-hand side operand.
+// \param firstB Iterator to the first right-hand side operand.
+// \param firstC Iterator to the first target matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the products \f$ C_i = A_i \cdot B_i \f$ for all left-hand side
+// operands in the range \f$ [firstA,lastA) \f$ and the according right-hand side operands and
+// target matrices starting at \a firstB and \a firstC. The target matrices are resized to the
+// size of the according product, i.e. they have to be resizable dense matrices as for instance
+// the DynamicMatrix or HybridMatrix class templates. In case the number of columns of any
+// left-hand side operand doesn't match the number of rows of the according right-hand side
+// operand, a \a std::invalid_argument exception is thrown and none of the target matrices is
+// modified.
+
+   \code
+   std::vector< blaze::DynamicMatrix<double> > A( 1000UL ), B( 1000UL ), C( 1000UL );
+   // ... Resizing and initialization of the operands
+
+   blaze::batchMult( A.begin(), A.end(), B.begin(), C.begin() );
+   \endcode
+
+// In contrast to a loop over the single products, which parallelizes each product on its own,
+// the batch multiplication distributes whole products among the available threads. Therefore
+// it avoids the synchronization after every single product and scales well even for products
+// of medium-sized matrices, which are too small to be efficiently parallelized on their own.
+// The products are scheduled dynamically in descending order of their costs, such that the
+// most expensive products are started first and equally shaped products are executed back to
+// back. In case the total number of multiply-add operations of the batch is below the SMP
+// batch multiplication threshold (see the SMP_BATCHMULT_THRESHOLD) or in case a serial section
+// is active, the products are computed single-threaded.
+//
+// Products whose target matrix is one of their operands are computed before all other products
+// of the batch by means of a temporary. Note however that a target matrix must not be used as
+// operand of any other product of the same batch, since the products are computed in arbitrary
+// order.
+*/
+template< typename InputIterator1    // Type of the left-hand side iterator
+        , typename InputIterator2    // Type of the right-hand side iterator
+        , typename OutputIterator >  // Type of the target iterator
+void batchMult( InputIterator1 firstA, InputIterator1 lastA,
+                InputIterator2 firstB, OutputIterator firstC )
+{
+   typedef typename std::iterator_traits<InputIterator1>::value_type  MT1;
+   typedef typename std::iterator_traits<InputIterator2>::value_type  MT2;
+   typedef typename std::iterator_traits<OutputIterator>::value_type  MT3;
+   typedef BatchMultTask<MT1,MT2,MT3>                                 Task;
+
+   std::vector<Task> tasks;
+   std::vector<Task> aliased;
+   size_t ops( 0UL );
+
+   for( ; firstA!=lastA; ++firstA, ++firstB, ++firstC )
+   {
+      const MT1& A( *firstA );
+      const MT2& B( *firstB );
+      MT3& C( *firstC );
+
+      if( A.columns() != B.rows() )
+         throw std::invalid_argument( "Matrix sizes do not match" );
+
+      const Task task = { &A, &B, &C, A.rows() * A.columns() * B.columns() };
+
+      if( A.isAliased( &C ) || B.isAliased( &C ) ) {
+         aliased.push_back( task );
+      }
+      else {
+         tasks.push_back( task );
+         ops += task.ops_;
+      }
+   }
+
+   for( size_t i=0UL; i<aliased.size(); ++i ) {
+      *aliased[i].target_ = (*aliased[i].lhs_) * (*aliased[i].rhs_);
+   }
+
+   for( size_t i=0UL; i<tasks.size(); ++i ) {
+      tasks[i].target_->resize( tasks[i].lhs_->rows(), tasks[i].rhs_->columns(), false );
+   }
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+   if( !isSerialSectionActive() && tasks.size() > 1UL && ops >= SMP_BATCHMULT_THRESHOLD )
+   {
+      std::sort( tasks.begin(), tasks.end() );
+
+      BLAZE_PARALLEL_SECTION
+      {
+         const int n( static_cast<int>( tasks.size() ) );
+
+#pragma omp parallel for schedule(dynamic,1) shared( tasks ) num_threads( getAvailableThreads() )
+         for( int i=0; i<n; ++i ) {
+            batchMultKernel( tasks[i] );
+         }
+      }
+
+      return;
+   }
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   if( !isSerialSectionActive() && tasks.size() > 1UL && ops >= SMP_BATCHMULT_THRESHOLD )
+   {
+      typedef typename SubmatrixExprTrait<MT3,unaligned>::Type  Target;
+      typedef typename MultExprTrait<MT1,MT2>::Type             Product;
+
+      std::sort( tasks.begin(), tasks.end() );
+
+      BLAZE_PARALLEL_SECTION
+      {
+         for( size_t i=0UL; i<tasks.size(); ++i ) {
+            const Task& task( tasks[i] );
+            Target target( submatrix<unaligned>( *task.target_, 0UL, 0UL,
+                                                 task.target_->rows(), task.target_->columns() ) );
+            TheThreadBackend::scheduleAssign( target, Product( (*task.lhs_) * (*task.rhs_) ) );
+         }
+
+         TheThreadBackend::wait();
+      }
+
+      return;
+   }
+#else
+   UNUSED_PARAMETER( ops );
+#endif
+
+   for( size_t i=0UL; i<tasks.size(); ++i ) {
+      batchMultKernel( tasks[i] );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
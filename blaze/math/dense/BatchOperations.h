@@ -0,0 +1,1267 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BatchOperations.h
+//  \brief Vectorized and parallel operations on batches of small matrices and vectors
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BATCHOPERATIONS_H_
+#define _BLAZE_MATH_DENSE_BATCHOPERATIONS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/SMP.h>
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+#  include <omp.h>
+#  include <blaze/math/smp/openmp/Functions.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <blaze/math/dense/StaticMatrixBatch.h>
+#include <blaze/math/dense/StaticVectorBatch.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY CLASS TEMPLATES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the vectorized batch kernels.
+// \ingroup static_matrix_batch
+//
+// The vectorized kernels of the batch multiplications, additions and subtractions can be used
+// in case the element type is vectorizable and provides intrinsic additions, subtractions and
+// multiplications.
+*/
+template< typename T >  // Data type of the batch elements
+struct UseVectorizedBatchKernel
+{
+   //**********************************************************************************************
+   enum { value = IsVectorizable<T>::value &&
+                  IntrinsicTrait<T>::addition &&
+                  IntrinsicTrait<T>::subtraction &&
+                  IntrinsicTrait<T>::multiplication };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the vectorized batch solvers.
+// \ingroup static_matrix_batch
+//
+// The vectorized kernels of the batch inversion and the batch solver additionally require an
+// intrinsic division.
+*/
+template< typename T >  // Data type of the batch elements
+struct UseVectorizedBatchSolver
+{
+   //**********************************************************************************************
+   enum { value = UseVectorizedBatchKernel<T>::value && IntrinsicTrait<T>::division };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCK KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized multiplication kernel for a single block of a matrix batch.
+// \ingroup static_matrix_batch
+//
+// \param c Pointer to the block of the target batch.
+// \param a Pointer to the block of the left-hand side \f$ M \times K \f$ batch.
+// \param b Pointer to the block of the right-hand side \f$ K \times N \f$ batch.
+// \return void
+//
+// Since the elements \f$ (i,j) \f$ of all matrices of a block are stored contiguously, each
+// intrinsic operation computes the according element of all matrices of the block at once.
+// Note that the target block must not alias any of the two operand blocks.
+*/
+template< size_t M       // Number of rows of the left-hand side matrices
+        , size_t K       // Number of columns of the left-hand side matrices
+        , size_t N       // Number of columns of the right-hand side matrices
+        , typename Type >  // Data type of the batch elements
+inline typename EnableIf< UseVectorizedBatchKernel<Type> >::Type
+   batchMultBlock( Type* c, const Type* a, const Type* b )
+{
+   typedef IntrinsicTrait<Type>  IT;
+   typedef typename IT::Type     IntrinsicType;
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         IntrinsicType xmm( load( a+i*K*IT::size ) * load( b+j*IT::size ) );
+         for( size_t k=1UL; k<K; ++k ) {
+            xmm = xmm + load( a+(i*K+k)*IT::size ) * load( b+(k*N+j)*IT::size );
+         }
+         store( c+(i*N+j)*IT::size, xmm );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default multiplication kernel for a single block of a matrix batch.
+// \ingroup static_matrix_batch
+//
+// \param c Pointer to the block of the target batch.
+// \param a Pointer to the block of the left-hand side \f$ M \times K \f$ batch.
+// \param b Pointer to the block of the right-hand side \f$ K \times N \f$ batch.
+// \return void
+//
+// Note that the target block must not alias any of the two operand blocks.
+*/
+template< size_t M       // Number of rows of the left-hand side matrices
+        , size_t K       // Number of columns of the left-hand side matrices
+        , size_t N       // Number of columns of the right-hand side matrices
+        , typename Type >  // Data type of the batch elements
+inline typename DisableIf< UseVectorizedBatchKernel<Type> >::Type
+   batchMultBlock( Type* c, const Type* a, const Type* b )
+{
+   const size_t L( IntrinsicTrait<Type>::size );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         for( size_t l=0UL; l<L; ++l ) {
+            Type sum( a[i*K*L+l] * b[j*L+l] );
+            for( size_t k=1UL; k<K; ++k )
+               sum += a[(i*K+k)*L+l] * b[(k*N+j)*L+l];
+            c[(i*N+j)*L+l] = sum;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized addition kernel for a single block of a matrix or vector batch.
+// \ingroup static_matrix_batch
+//
+// \param c Pointer to the block of the target batch.
+// \param a Pointer to the block of the left-hand side batch.
+// \param b Pointer to the block of the right-hand side batch.
+// \return void
+*/
+template< size_t S       // Number of elements per block
+        , typename Type >  // Data type of the batch elements
+inline typename EnableIf< UseVectorizedBatchKernel<Type> >::Type
+   batchAddBlock( Type* c, const Type* a, const Type* b )
+{
+   typedef IntrinsicTrait<Type>  IT;
+
+   for( size_t e=0UL; e<S; e+=IT::size ) {
+      store( c+e, load( a+e ) + load( b+e ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default addition kernel for a single block of a matrix or vector batch.
+// \ingroup static_matrix_batch
+//
+// \param c Pointer to the block of the target batch.
+// \param a Pointer to the block of the left-hand side batch.
+// \param b Pointer to the block of the right-hand side batch.
+// \return void
+*/
+template< size_t S       // Number of elements per block
+        , typename Type >  // Data type of the batch elements
+inline typename DisableIf< UseVectorizedBatchKernel<Type> >::Type
+   batchAddBlock( Type* c, const Type* a, const Type* b )
+{
+   for( size_t e=0UL; e<S; ++e ) {
+      c[e] = a[e] + b[e];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized subtraction kernel for a single block of a matrix or vector batch.
+// \ingroup static_matrix_batch
+//
+// \param c Pointer to the block of the target batch.
+// \param a Pointer to the block of the left-hand side batch.
+// \param b Pointer to the block of the right-hand side batch.
+// \return void
+*/
+template< size_t S       // Number of elements per block
+        , typename Type >  // Data type of the batch elements
+inline typename EnableIf< UseVectorizedBatchKernel<Type> >::Type
+   batchSubBlock( Type* c, const Type* a, const Type* b )
+{
+   typedef IntrinsicTrait<Type>  IT;
+
+   for( size_t e=0UL; e<S; e+=IT::size ) {
+      store( c+e, load( a+e ) - load( b+e ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default subtraction kernel for a single block of a matrix or vector batch.
+// \ingroup static_matrix_batch
+//
+// \param c Pointer to the block of the target batch.
+// \param a Pointer to the block of the left-hand side batch.
+// \param b Pointer to the block of the right-hand side batch.
+// \return void
+*/
+template< size_t S       // Number of elements per block
+        , typename Type >  // Data type of the batch elements
+inline typename DisableIf< UseVectorizedBatchKernel<Type> >::Type
+   batchSubBlock( Type* c, const Type* a, const Type* b )
+{
+   for( size_t e=0UL; e<S; ++e ) {
+      c[e] = a[e] - b[e];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized transposition kernel for a single block of a matrix batch.
+// \ingroup static_matrix_batch
+//
+// \param b Pointer to the block of the target \f$ N \times M \f$ batch.
+// \param a Pointer to the block of the \f$ M \times N \f$ batch to be transposed.
+// \return void
+//
+// Within a block the transposition of all matrices reduces to a permutation of the contiguous
+// element vectors, i.e. no shuffling of elements is necessary. Note that the target block must
+// not alias the given block.
+*/
+template< size_t M       // Number of rows of the matrices to be transposed
+        , size_t N       // Number of columns of the matrices to be transposed
+        , typename Type >  // Data type of the batch elements
+inline typename EnableIf< IsVectorizable<Type> >::Type
+   batchTransBlock( Type* b, const Type* a )
+{
+   typedef IntrinsicTrait<Type>  IT;
+
+   for( size_t i=0UL; i<M; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         store( b+(j*M+i)*IT::size, load( a+(i*N+j)*IT::size ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default transposition kernel for a single block of a matrix batch.
+// \ingroup static_matrix_batch
+//
+// \param b Pointer to the block of the target \f$ N \times M \f$ batch.
+// \param a Pointer to the block of the \f$ M \times N \f$ batch to be transposed.
+// \return void
+//
+// Note that the target block must not alias the given block.
+*/
+template< size_t M       // Number of rows of the matrices to be transposed
+        , size_t N       // Number of columns of the matrices to be transposed
+        , typename Type >  // Data type of the batch elements
+inline typename DisableIf< IsVectorizable<Type> >::Type
+   batchTransBlock( Type* b, const Type* a )
+{
+   const size_t L( IntrinsicTrait<Type>::size );
+
+   for( size_t i=0UL; i<M; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         for( size_t l=0UL; l<L; ++l )
+            b[(j*M+i)*L+l] = a[(i*N+j)*L+l];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partial pivoting of a single column of a block of \f$ N \times N \f$ matrices.
+// \ingroup static_matrix_batch
+//
+// \param w The block of matrices in the interleaved layout.
+// \param r The block of right-hand side vectors (or \a NULL in case there are none).
+// \param k The index of the current column.
+// \param pivots The row interchanges of all matrices of the block.
+// \return \a true in case all matrices are regular in column \a k, \a false if not.
+//
+// For every matrix of the block this function searches the element with the largest absolute
+// value in the column \a k below the diagonal and exchanges the according row with row \a k.
+// Since the pivot rows differ between the matrices, the interchanges are performed element-wise.
+*/
+template< size_t N         // Number of rows and columns of the matrices
+        , typename Type >  // Data type of the batch elements
+inline bool batchPivot( Type* w, Type* r, size_t k, size_t* pivots )
+{
+   using std::abs;
+
+   const size_t L( IntrinsicTrait<Type>::size );
+
+   for( size_t l=0UL; l<L; ++l )
+   {
+      size_t p( k );
+      Type max( abs( w[(k*N+k)*L+l] ) );
+
+      for( size_t i=k+1UL; i<N; ++i ) {
+         if( abs( w[(i*N+k)*L+l] ) > max ) {
+            p   = i;
+            max = abs( w[(i*N+k)*L+l] );
+         }
+      }
+
+      if( max == Type(0) )
+         return false;
+
+      pivots[k*L+l] = p;
+
+      if( p != k ) {
+         for( size_t j=0UL; j<N; ++j )
+            std::swap( w[(k*N+j)*L+l], w[(p*N+j)*L+l] );
+         if( r != NULL )
+            std::swap( r[k*L+l], r[p*L+l] );
+      }
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies a block of \f$ N \times N \f$ matrices into a workspace.
+// \ingroup static_matrix_batch
+//
+// \param w The workspace.
+// \param a Pointer to the block of the batch.
+// \param valid The number of matrices of the block that are part of the batch.
+// \return void
+//
+// The unused matrices of the last block are replaced by identity matrices such that the
+// inversion and the solution of the according (zero) systems cannot fail.
+*/
+template< size_t N         // Number of rows and columns of the matrices
+        , typename Type >  // Data type of the batch elements
+inline void batchLoadBlock( Type* w, const Type* a, size_t valid )
+{
+   const size_t L( IntrinsicTrait<Type>::size );
+
+   std::copy( a, a+N*N*L, w );
+
+   for( size_t l=valid; l<L; ++l )
+      for( size_t i=0UL; i<N; ++i )
+         w[(i*N+i)*L+l] = Type(1);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies a workspace into a block of a batch.
+// \ingroup static_matrix_batch
+//
+// \param b Pointer to the block of the batch.
+// \param w The workspace.
+// \param valid The number of matrices/vectors of the block that are part of the batch.
+// \return void
+//
+// The unused matrices/vectors of the last block are reset to zero.
+*/
+template< size_t S         // Number of elements per block
+        , typename Type >  // Data type of the batch elements
+inline void batchStoreBlock( Type* b, const Type* w, size_t valid )
+{
+   const size_t L( IntrinsicTrait<Type>::size );
+
+   std::copy( w, w+S, b );
+
+   for( size_t e=0UL; e<S; e+=L )
+      for( size_t l=valid; l<L; ++l )
+         b[e+l] = Type();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized Gauss-Jordan inversion kernel for a single block of a matrix batch.
+// \ingroup static_matrix_batch
+//
+// \param b Pointer to the block of the target batch.
+// \param a Pointer to the block of the batch to be inverted.
+// \param valid The number of matrices of the block that are part of the batch.
+// \return \a true in case all matrices have been inverted, \a false if a matrix is singular.
+//
+// This function inverts all matrices of the block in place by means of a Gauss-Jordan
+// elimination with partial pivoting. The elimination steps are vectorized across the matrices
+// of the block, whereas the pivot search and the row interchanges are performed per matrix.
+*/
+template< size_t N         // Number of rows and columns of the matrices
+        , typename Type >  // Data type of the batch elements
+inline typename EnableIf< UseVectorizedBatchSolver<Type>, bool >::Type
+   batchInvertBlock( Type* b, const Type* a, size_t valid )
+{
+   typedef IntrinsicTrait<Type>  IT;
+   typedef typename IT::Type     IntrinsicType;
+
+   const size_t L( IT::size );
+
+   Type w[N*N*L];
+   size_t pivots[N*L];
+
+   batchLoadBlock<N>( w, a, valid );
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      if( !batchPivot<N>( w, static_cast<Type*>( NULL ), k, pivots ) )
+         return false;
+
+      const IntrinsicType one  ( set( Type(1) ) );
+      const IntrinsicType pivot( one / loadu( w+(k*N+k)*L ) );
+
+      storeu( w+(k*N+k)*L, one );
+      for( size_t j=0UL; j<N; ++j ) {
+         storeu( w+(k*N+j)*L, loadu( w+(k*N+j)*L ) * pivot );
+      }
+
+      for( size_t i=0UL; i<N; ++i ) {
+         if( i == k ) continue;
+         const IntrinsicType factor( loadu( w+(i*N+k)*L ) );
+         storeu( w+(i*N+k)*L, IntrinsicType() );
+         for( size_t j=0UL; j<N; ++j ) {
+            storeu( w+(i*N+j)*L, loadu( w+(i*N+j)*L ) - factor * loadu( w+(k*N+j)*L ) );
+         }
+      }
+   }
+
+   for( size_t k=N; k-- > 0UL; ) {
+      for( size_t l=0UL; l<L; ++l ) {
+         const size_t p( pivots[k*L+l] );
+         if( p == k ) continue;
+         for( size_t i=0UL; i<N; ++i )
+            std::swap( w[(i*N+k)*L+l], w[(i*N+p)*L+l] );
+      }
+   }
+
+   batchStoreBlock<N*N*L>( b, w, valid );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default Gauss-Jordan inversion kernel for a single block of a matrix batch.
+// \ingroup static_matrix_batch
+//
+// \param b Pointer to the block of the target batch.
+// \param a Pointer to the block of the batch to be inverted.
+// \param valid The number of matrices of the block that are part of the batch.
+// \return \a true in case all matrices have been inverted, \a false if a matrix is singular.
+*/
+template< size_t N         // Number of rows and columns of the matrices
+        , typename Type >  // Data type of the batch elements
+inline typename DisableIf< UseVectorizedBatchSolver<Type>, bool >::Type
+   batchInvertBlock( Type* b, const Type* a, size_t valid )
+{
+   const size_t L( IntrinsicTrait<Type>::size );
+
+   Type w[N*N*L];
+   size_t pivots[N*L];
+
+   batchLoadBlock<N>( w, a, valid );
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      if( !batchPivot<N>( w, static_cast<Type*>( NULL ), k, pivots ) )
+         return false;
+
+      for( size_t l=0UL; l<L; ++l )
+      {
+         const Type pivot( Type(1) / w[(k*N+k)*L+l] );
+
+         w[(k*N+k)*L+l] = Type(1);
+         for( size_t j=0UL; j<N; ++j )
+            w[(k*N+j)*L+l] *= pivot;
+
+         for( size_t i=0UL; i<N; ++i ) {
+            if( i == k ) continue;
+            const Type factor( w[(i*N+k)*L+l] );
+            w[(i*N+k)*L+l] = Type(0);
+            for( size_t j=0UL; j<N; ++j )
+               w[(i*N+j)*L+l] -= factor * w[(k*N+j)*L+l];
+         }
+      }
+   }
+
+   for( size_t k=N; k-- > 0UL; ) {
+      for( size_t l=0UL; l<L; ++l ) {
+         const size_t p( pivots[k*L+l] );
+         if( p == k ) continue;
+         for( size_t i=0UL; i<N; ++i )
+            std::swap( w[(i*N+k)*L+l], w[(i*N+p)*L+l] );
+      }
+   }
+
+   batchStoreBlock<N*N*L>( b, w, valid );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized LU solver kernel for a single block of a batch of linear systems.
+// \ingroup static_matrix_batch
+//
+// \param x Pointer to the block of the right-hand side vectors, which are overwritten with the
+//          solutions.
+// \param a Pointer to the block of the system matrices.
+// \param valid The number of systems of the block that are part of the batch.
+// \return \a true in case all systems have been solved, \a false if a matrix is singular.
+//
+// This function solves all systems of the block by means of a Gaussian elimination with
+// partial pivoting and a subsequent back substitution. The elimination and substitution steps
+// are vectorized across the systems of the block.
+*/
+template< size_t N         // Number of rows and columns of the matrices
+        , typename Type >  // Data type of the batch elements
+inline typename EnableIf< UseVectorizedBatchSolver<Type>, bool >::Type
+   batchSolveBlock( Type* x, const Type* a, size_t valid )
+{
+   typedef IntrinsicTrait<Type>  IT;
+   typedef typename IT::Type     IntrinsicType;
+
+   const size_t L( IT::size );
+
+   Type w[N*N*L];
+   Type r[N*L];
+   size_t pivots[N*L];
+
+   batchLoadBlock<N>( w, a, valid );
+   std::copy( x, x+N*L, r );
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      if( !batchPivot<N>( w, r, k, pivots ) )
+         return false;
+
+      const IntrinsicType pivot( set( Type(1) ) / loadu( w+(k*N+k)*L ) );
+
+      for( size_t i=k+1UL; i<N; ++i ) {
+         const IntrinsicType factor( loadu( w+(i*N+k)*L ) * pivot );
+         for( size_t j=k+1UL; j<N; ++j ) {
+            storeu( w+(i*N+j)*L, loadu( w+(i*N+j)*L ) - factor * loadu( w+(k*N+j)*L ) );
+         }
+         storeu( r+i*L, loadu( r+i*L ) - factor * loadu( r+k*L ) );
+      }
+   }
+
+   for( size_t i=N; i-- > 0UL; ) {
+      IntrinsicType xmm( loadu( r+i*L ) );
+      for( size_t j=i+1UL; j<N; ++j ) {
+         xmm = xmm - loadu( w+(i*N+j)*L ) * loadu( r+j*L );
+      }
+      storeu( r+i*L, xmm / loadu( w+(i*N+i)*L ) );
+   }
+
+   batchStoreBlock<N*L>( x, r, valid );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default LU solver kernel for a single block of a batch of linear systems.
+// \ingroup static_matrix_batch
+//
+// \param x Pointer to the block of the right-hand side vectors, which are overwritten with the
+//          solutions.
+// \param a Pointer to the block of the system matrices.
+// \param valid The number of systems of the block that are part of the batch.
+// \return \a true in case all systems have been solved, \a false if a matrix is singular.
+*/
+template< size_t N         // Number of rows and columns of the matrices
+        , typename Type >  // Data type of the batch elements
+inline typename DisableIf< UseVectorizedBatchSolver<Type>, bool >::Type
+   batchSolveBlock( Type* x, const Type* a, size_t valid )
+{
+   const size_t L( IntrinsicTrait<Type>::size );
+
+   Type w[N*N*L];
+   Type r[N*L];
+   size_t pivots[N*L];
+
+   batchLoadBlock<N>( w, a, valid );
+   std::copy( x, x+N*L, r );
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      if( !batchPivot<N>( w, r, k, pivots ) )
+         return false;
+
+      for( size_t l=0UL; l<L; ++l ) {
+         for( size_t i=k+1UL; i<N; ++i ) {
+            const Type factor( w[(i*N+k)*L+l] / w[(k*N+k)*L+l] );
+            for( size_t j=k+1UL; j<N; ++j )
+               w[(i*N+j)*L+l] -= factor * w[(k*N+j)*L+l];
+            r[i*L+l] -= factor * r[k*L+l];
+         }
+      }
+   }
+
+   for( size_t i=N; i-- > 0UL; ) {
+      for( size_t l=0UL; l<L; ++l ) {
+         Type sum( r[i*L+l] );
+         for( size_t j=i+1UL; j<N; ++j )
+            sum -= w[(i*N+j)*L+l] * r[j*L+l];
+         r[i*L+l] = sum / w[(i*N+i)*L+l];
+      }
+   }
+
+   batchStoreBlock<N*L>( x, r, valid );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCH KERNEL FUNCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Functor for the blockwise multiplication of two matrix batches.
+// \ingroup static_matrix_batch
+*/
+template< typename Type  // Data type of the batch elements
+        , size_t M       // Number of rows of the left-hand side matrices
+        , size_t K       // Number of columns of the left-hand side matrices
+        , size_t N >     // Number of columns of the right-hand side matrices
+struct BatchMultKernel
+{
+   //**********************************************************************************************
+   enum { L = IntrinsicTrait<Type>::size };
+
+   inline BatchMultKernel( Type* c, const Type* a, const Type* b )
+      : c_( c ), a_( a ), b_( b ) {}
+
+   inline bool operator()( size_t block ) const {
+      batchMultBlock<M,K,N>( c_+block*M*N*L, a_+block*M*K*L, b_+block*K*N*L );
+      return true;
+   }
+
+   Type* const c_;        //!< The elements of the target batch.
+   const Type* const a_;  //!< The elements of the left-hand side batch.
+   const Type* const b_;  //!< The elements of the right-hand side batch.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Functor for the blockwise addition of two batches.
+// \ingroup static_matrix_batch
+*/
+template< typename Type  // Data type of the batch elements
+        , size_t S >     // Number of elements per block
+struct BatchAddKernel
+{
+   //**********************************************************************************************
+   inline BatchAddKernel( Type* c, const Type* a, const Type* b )
+      : c_( c ), a_( a ), b_( b ) {}
+
+   inline bool operator()( size_t block ) const {
+      batchAddBlock<S>( c_+block*S, a_+block*S, b_+block*S );
+      return true;
+   }
+
+   Type* const c_;        //!< The elements of the target batch.
+   const Type* const a_;  //!< The elements of the left-hand side batch.
+   const Type* const b_;  //!< The elements of the right-hand side batch.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Functor for the blockwise subtraction of two batches.
+// \ingroup static_matrix_batch
+*/
+template< typename Type  // Data type of the batch elements
+        , size_t S >     // Number of elements per block
+struct BatchSubKernel
+{
+   //**********************************************************************************************
+   inline BatchSubKernel( Type* c, const Type* a, const Type* b )
+      : c_( c ), a_( a ), b_( b ) {}
+
+   inline bool operator()( size_t block ) const {
+      batchSubBlock<S>( c_+block*S, a_+block*S, b_+block*S );
+      return true;
+   }
+
+   Type* const c_;        //!< The elements of the target batch.
+   const Type* const a_;  //!< The elements of the left-hand side batch.
+   const Type* const b_;  //!< The elements of the right-hand side batch.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Functor for the blockwise transposition of a matrix batch.
+// \ingroup static_matrix_batch
+*/
+template< typename Type  // Data type of the batch elements
+        , size_t M       // Number of rows of the matrices to be transposed
+        , size_t N >     // Number of columns of the matrices to be transposed
+struct BatchTransKernel
+{
+   //**********************************************************************************************
+   enum { L = IntrinsicTrait<Type>::size };
+
+   inline BatchTransKernel( Type* b, const Type* a )
+      : b_( b ), a_( a ) {}
+
+   inline bool operator()( size_t block ) const {
+      batchTransBlock<M,N>( b_+block*M*N*L, a_+block*M*N*L );
+      return true;
+   }
+
+   Type* const b_;        //!< The elements of the target batch.
+   const Type* const a_;  //!< The elements of the batch to be transposed.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Functor for the blockwise inversion of a matrix batch.
+// \ingroup static_matrix_batch
+*/
+template< typename Type  // Data type of the batch elements
+        , size_t N >     // Number of rows and columns of the matrices
+struct BatchInvertKernel
+{
+   //**********************************************************************************************
+   enum { L = IntrinsicTrait<Type>::size };
+
+   inline BatchInvertKernel( Type* a, size_t size )
+      : a_( a ), size_( size ) {}
+
+   inline bool operator()( size_t block ) const {
+      const size_t valid( ( size_ - block*L < size_t(L) )?( size_ - block*L ):( size_t(L) ) );
+      return batchInvertBlock<N>( a_+block*N*N*L, a_+block*N*N*L, valid );
+   }
+
+   Type* const a_;      //!< The elements of the batch to be inverted.
+   const size_t size_;  //!< The number of matrices of the batch.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Functor for the blockwise solution of a batch of linear systems.
+// \ingroup static_matrix_batch
+*/
+template< typename Type  // Data type of the batch elements
+        , size_t N >     // Number of rows and columns of the matrices
+struct BatchSolveKernel
+{
+   //**********************************************************************************************
+   enum { L = IntrinsicTrait<Type>::size };
+
+   inline BatchSolveKernel( Type* x, const Type* a, size_t size )
+      : x_( x ), a_( a ), size_( size ) {}
+
+   inline bool operator()( size_t block ) const {
+      const size_t valid( ( size_ - block*L < size_t(L) )?( size_ - block*L ):( size_t(L) ) );
+      return batchSolveBlock<N>( x_+block*N*L, a_+block*N*N*L, valid );
+   }
+
+   Type* const x_;        //!< The right-hand sides and solutions of the systems.
+   const Type* const a_;  //!< The elements of the system matrices.
+   const size_t size_;    //!< The number of systems of the batch.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given block kernel for all blocks of a batch.
+// \ingroup static_matrix_batch
+//
+// \param kernel The kernel to be executed for each block.
+// \param blocks The number of blocks of the batch.
+// \param size The number of matrices/vectors of the batch.
+// \return \a true in case the kernel succeeded for all blocks, \a false if not.
+//
+// In case the OpenMP parallelization is active and the number of matrices/vectors exceeds the
+// SMP batch threshold, the blocks are distributed among the available threads.
+*/
+template< typename Kernel >  // Type of the block kernel
+bool batchLoop( const Kernel& kernel, size_t blocks, size_t size )
+{
+   bool success( true );
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+   if( !isSerialSectionActive() && size > SMP_BATCH_THRESHOLD )
+   {
+      const int n( static_cast<int>( blocks ) );
+
+#pragma omp parallel for schedule(static) reduction(&&:success) num_threads( getAvailableThreads() )
+      for( int b=0; b<n; ++b ) {
+         success = kernel( static_cast<size_t>( b ) ) && success;
+      }
+
+      return success;
+   }
+#else
+   UNUSED_PARAMETER( size );
+#endif
+
+   for( size_t b=0UL; b<blocks; ++b ) {
+      success = kernel( b ) && success;
+   }
+
+   return success;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCH OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Batch operations */
+//@{
+template< typename Type, size_t M, size_t K, size_t N >
+void mult( StaticMatrixBatch<Type,M,N>& C,
+           const StaticMatrixBatch<Type,M,K>& A, const StaticMatrixBatch<Type,K,N>& B );
+
+template< typename Type, size_t M, size_t N >
+void mult( StaticVectorBatch<Type,M>& y,
+           const StaticMatrixBatch<Type,M,N>& A, const StaticVectorBatch<Type,N>& x );
+
+template< typename Type, size_t M, size_t N >
+void add( StaticMatrixBatch<Type,M,N>& C,
+          const StaticMatrixBatch<Type,M,N>& A, const StaticMatrixBatch<Type,M,N>& B );
+
+template< typename Type, size_t N >
+void add( StaticVectorBatch<Type,N>& c,
+          const StaticVectorBatch<Type,N>& a, const StaticVectorBatch<Type,N>& b );
+
+template< typename Type, size_t M, size_t N >
+void sub( StaticMatrixBatch<Type,M,N>& C,
+          const StaticMatrixBatch<Type,M,N>& A, const StaticMatrixBatch<Type,M,N>& B );
+
+template< typename Type, size_t N >
+void sub( StaticVectorBatch<Type,N>& c,
+          const StaticVectorBatch<Type,N>& a, const StaticVectorBatch<Type,N>& b );
+
+template< typename Type, size_t M, size_t N >
+void trans( StaticMatrixBatch<Type,N,M>& B, const StaticMatrixBatch<Type,M,N>& A );
+
+template< typename Type, size_t N >
+void invert( StaticMatrixBatch<Type,N,N>& A );
+
+template< typename Type, size_t N >
+void solve( const StaticMatrixBatch<Type,N,N>& A, StaticVectorBatch<Type,N>& b );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of two batches of matrices (\f$ C_k=A_k*B_k \f$).
+// \ingroup static_matrix_batch
+//
+// \param C The target batch of \f$ M \times N \f$ matrices.
+// \param A The left-hand side batch of \f$ M \times K \f$ matrices.
+// \param B The right-hand side batch of \f$ K \times N \f$ matrices.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// This function computes the products of the corresponding matrices of the two batches. The
+// target batch is resized to the size of the operands and may be one of the two operands, in
+// which case the products are evaluated into a temporary batch.
+*/
+template< typename Type  // Data type of the batch elements
+        , size_t M       // Number of rows of the left-hand side matrices
+        , size_t K       // Number of columns of the left-hand side matrices
+        , size_t N >     // Number of columns of the right-hand side matrices
+void mult( StaticMatrixBatch<Type,M,N>& C,
+           const StaticMatrixBatch<Type,M,K>& A, const StaticMatrixBatch<Type,K,N>& B )
+{
+   if( A.size() != B.size() )
+      throw std::invalid_argument( "Batch sizes do not match" );
+
+   if( A.size() > 0UL && ( C.data() == A.data() || C.data() == B.data() ) ) {
+      StaticMatrixBatch<Type,M,N> tmp;
+      mult( tmp, A, B );
+      swap( C, tmp );
+      return;
+   }
+
+   C.resize( A.size(), false );
+
+   const BatchMultKernel<Type,M,K,N> kernel( C.data(), A.data(), B.data() );
+   batchLoop( kernel, C.blocks(), C.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Matrix/vector multiplication of two batches (\f$ \vec{y}_k=A_k*\vec{x}_k \f$).
+// \ingroup static_matrix_batch
+//
+// \param y The target batch of vectors with \a M elements.
+// \param A The batch of \f$ M \times N \f$ matrices.
+// \param x The batch of vectors with \a N elements.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// This function computes the products of the corresponding matrices and vectors of the two
+// batches. The target batch is resized to the size of the operands and may be the vector
+// operand, in which case the products are evaluated into a temporary batch.
+*/
+template< typename Type  // Data type of the batch elements
+        , size_t M       // Number of rows of the matrices
+        , size_t N >     // Number of columns of the matrices
+void mult( StaticVectorBatch<Type,M>& y,
+           const StaticMatrixBatch<Type,M,N>& A, const StaticVectorBatch<Type,N>& x )
+{
+   if( A.size() != x.size() )
+      throw std::invalid_argument( "Batch sizes do not match" );
+
+   if( x.size() > 0UL && y.data() == x.data() ) {
+      StaticVectorBatch<Type,M> tmp;
+      mult( tmp, A, x );
+      swap( y, tmp );
+      return;
+   }
+
+   y.resize( A.size(), false );
+
+   const BatchMultKernel<Type,M,N,1UL> kernel( y.data(), A.data(), x.data() );
+   batchLoop( kernel, y.blocks(), y.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition of two batches of matrices (\f$ C_k=A_k+B_k \f$).
+// \ingroup static_matrix_batch
+//
+// \param C The target batch.
+// \param A The left-hand side batch.
+// \param B The right-hand side batch.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+*/
+template< typename Type  // Data type of the batch elements
+        , size_t M       // Number of rows of the matrices
+        , size_t N >     // Number of columns of the matrices
+void add( StaticMatrixBatch<Type,M,N>& C,
+          const StaticMatrixBatch<Type,M,N>& A, const StaticMatrixBatch<Type,M,N>& B )
+{
+   typedef StaticMatrixBatch<Type,M,N>  BT;
+
+   if( A.size() != B.size() )
+      throw std::invalid_argument( "Batch sizes do not match" );
+
+   C.resize( A.size(), false );
+
+   const BatchAddKernel<Type,BT::blockSize> kernel( C.data(), A.data(), B.data() );
+   batchLoop( kernel, C.blocks(), C.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition of two batches of vectors (\f$ \vec{c}_k=\vec{a}_k+\vec{b}_k \f$).
+// \ingroup static_matrix_batch
+//
+// \param c The target batch.
+// \param a The left-hand side batch.
+// \param b The right-hand side batch.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+*/
+template< typename Type  // Data type of the batch elements
+        , size_t N >     // Number of elements of the vectors
+void add( StaticVectorBatch<Type,N>& c,
+          const StaticVectorBatch<Type,N>& a, const StaticVectorBatch<Type,N>& b )
+{
+   typedef StaticVectorBatch<Type,N>  BT;
+
+   if( a.size() != b.size() )
+      throw std::invalid_argument( "Batch sizes do not match" );
+
+   c.resize( a.size(), false );
+
+   const BatchAddKernel<Type,BT::blockSize> kernel( c.data(), a.data(), b.data() );
+   batchLoop( kernel, c.blocks(), c.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction of two batches of matrices (\f$ C_k=A_k-B_k \f$).
+// \ingroup static_matrix_batch
+//
+// \param C The target batch.
+// \param A The left-hand side batch.
+// \param B The right-hand side batch.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+*/
+template< typename Type  // Data type of the batch elements
+        , size_t M       // Number of rows of the matrices
+        , size_t N >     // Number of columns of the matrices
+void sub( StaticMatrixBatch<Type,M,N>& C,
+          const StaticMatrixBatch<Type,M,N>& A, const StaticMatrixBatch<Type,M,N>& B )
+{
+   typedef StaticMatrixBatch<Type,M,N>  BT;
+
+   if( A.size() != B.size() )
+      throw std::invalid_argument( "Batch sizes do not match" );
+
+   C.resize( A.size(), false );
+
+   const BatchSubKernel<Type,BT::blockSize> kernel( C.data(), A.data(), B.data() );
+   batchLoop( kernel, C.blocks(), C.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction of two batches of vectors (\f$ \vec{c}_k=\vec{a}_k-\vec{b}_k \f$).
+// \ingroup static_matrix_batch
+//
+// \param c The target batch.
+// \param a The left-hand side batch.
+// \param b The right-hand side batch.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+*/
+template< typename Type  // Data type of the batch elements
+        , size_t N >     // Number of elements of the vectors
+void sub( StaticVectorBatch<Type,N>& c,
+          const StaticVectorBatch<Type,N>& a, const StaticVectorBatch<Type,N>& b )
+{
+   typedef StaticVectorBatch<Type,N>  BT;
+
+   if( a.size() != b.size() )
+      throw std::invalid_argument( "Batch sizes do not match" );
+
+   c.resize( a.size(), false );
+
+   const BatchSubKernel<Type,BT::blockSize> kernel( c.data(), a.data(), b.data() );
+   batchLoop( kernel, c.blocks(), c.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Transposition of a batch of matrices (\f$ B_k=A_k^T \f$).
+// \ingroup static_matrix_batch
+//
+// \param B The target batch of \f$ N \times M \f$ matrices.
+// \param A The batch of \f$ M \times N \f$ matrices to be transposed.
+// \return void
+//
+// The target batch is resized to the size of the given batch. In case of square matrices the
+// target batch may be the given batch, in which case the transposes are evaluated into a
+// temporary batch.
+*/
+template< typename Type  // Data type of the batch elements
+        , size_t M       // Number of rows of the matrices to be transposed
+        , size_t N >     // Number of columns of the matrices to be transposed
+void trans( StaticMatrixBatch<Type,N,M>& B, const StaticMatrixBatch<Type,M,N>& A )
+{
+   if( A.size() > 0UL && B.data() == A.data() ) {
+      StaticMatrixBatch<Type,N,M> tmp;
+      trans( tmp, A );
+      swap( B, tmp );
+      return;
+   }
+
+   B.resize( A.size(), false );
+
+   const BatchTransKernel<Type,M,N> kernel( B.data(), A.data() );
+   batchLoop( kernel, B.blocks(), B.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place inversion of a batch of square matrices.
+// \ingroup static_matrix_batch
+//
+// \param A The batch of \f$ N \times N \f$ matrices to be inverted.
+// \return void
+// \exception std::runtime_error Singular matrix provided.
+//
+// This function inverts all matrices of the given batch by means of a Gauss-Jordan elimination
+// with partial pivoting, which is vectorized across the matrices of each block. In case any of
+// the matrices is singular, a \a std::runtime_error exception is thrown. Note that in this case
+// the content of the batch is unspecified.
+*/
+template< typename Type  // Data type of the batch elements
+        , size_t N >     // Number of rows and columns of the matrices
+void invert( StaticMatrixBatch<Type,N,N>& A )
+{
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+
+   const BatchInvertKernel<Type,N> kernel( A.data(), A.size() );
+
+   if( !batchLoop( kernel, A.blocks(), A.size() ) )
+      throw std::runtime_error( "Singular matrix provided" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving a batch of linear systems of equations (\f$ A_k*\vec{x}_k=\vec{b}_k \f$).
+// \ingroup static_matrix_batch
+//
+// \param A The batch of \f$ N \times N \f$ system matrices.
+// \param b The batch of right-hand sides, which are overwritten with the solutions.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+// \exception std::runtime_error Singular matrix provided.
+//
+// This function solves all systems of the batch by means of a Gaussian elimination with partial
+// pivoting, which is vectorized across the systems of each block. The system matrices are not
+// modified. In case any of the matrices is singular, a \a std::runtime_error exception is thrown.
+// Note that in this case the content of \a b is unspecified.
+*/
+template< typename Type  // Data type of the batch elements
+        , size_t N >     // Number of rows and columns of the matrices
+void solve( const StaticMatrixBatch<Type,N,N>& A, StaticVectorBatch<Type,N>& b )
+{
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+
+   if( A.size() != b.size() )
+      throw std::invalid_argument( "Batch sizes do not match" );
+
+   const BatchSolveKernel<Type,N> kernel( b.data(), A.data(), b.size() );
+
+   if( !batchLoop( kernel, b.blocks(), b.size() ) )
+      throw std::runtime_error( "Singular matrix provided" );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
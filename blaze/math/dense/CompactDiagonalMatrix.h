@@ -0,0 +1,2091 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/CompactDiagonalMatrix.h
+//  \brief Implementation of a diagonal dense NxN matrix storing only its diagonal elements
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_COMPACTDIAGONALMATRIX_H_
+#define _BLAZE_MATH_DENSE_COMPACTDIAGONALMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <blaze/math/dense/CompactDiagonalProxy.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MathTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/HasDiagonalStorage.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsDiagonal.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSquare.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/views/Forward.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup compact_diagonal_matrix CompactDiagonalMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Diagonal \f$ N \times N \f$ dense matrix storing only its diagonal elements.
+// \ingroup compact_diagonal_matrix
+//
+// The CompactDiagonalMatrix class template is a row-major diagonal dense matrix that only stores
+// the \f$ N \f$ elements of its diagonal in a single dense vector. In comparison to a
+// DiagonalMatrix< DynamicMatrix<Type> >, which stores all \f$ N^2 \f$ elements, this reduces the
+// memory requirements of the matrix from \f$ O(N^2) \f$ to \f$ O(N) \f$ and turns products with
+// vectors and matrices into vectorized and parallelized row and column scaling operations. The
+// type of the elements can be specified via the single template parameter:
+
+   \code
+   template< typename Type >
+   class CompactDiagonalMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. CompactDiagonalMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//
+// The matrix provides the same interface as a DiagonalMatrix< DynamicMatrix<Type> >: it can be
+// created from and assigned any diagonal dense or sparse matrix, the diagonal elements can be
+// modified freely, and any attempt to modify a non-diagonal element results in an exception.
+// Additionally, the matrix can be created directly from the vector of its diagonal elements:
+
+   \code
+   using blaze::CompactDiagonalMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+
+   DynamicVector<double> d( 3000UL );
+   // ... Initialization of the diagonal elements
+
+   CompactDiagonalMatrix<double> D( d );  // Storing only the 3000 diagonal elements
+
+   D(2,2) = 4.0;  // Modifies the diagonal element (2,2)
+   D(0,2) = 2.0;  // Invalid assignment to non-diagonal matrix element; results in an exception!
+
+   DynamicVector<double> x( 3000UL ), y;
+   DynamicMatrix<double> A( 3000UL, 3000UL ), B;
+   // ... Initialization of the dense vector and matrix
+
+   y = D * x;  // Scaling of the elements of x
+   B = D * A;  // Scaling of the rows of A
+   B = A * D;  // Scaling of the columns of A
+   \endcode
+
+// Note that any attempt to setup or assign a matrix that is not diagonal results in a
+// \a std::invalid_argument exception.
+*/
+template< typename Type >  // Data type of the dense matrix
+class CompactDiagonalMatrix : public DenseMatrix< CompactDiagonalMatrix<Type>, false >
+{
+ public:
+   //**DiagonalIterator class definition***********************************************************
+   /*!\brief Iterator over the elements of a row of a CompactDiagonalMatrix.
+   //
+   // The DiagonalIterator traverses a complete row of the diagonal matrix, i.e. including the
+   // non-diagonal elements. Non-diagonal elements are represented by proxies that refer to the
+   // zero element of the matrix and cannot be modified.
+   */
+   template< typename VT >  // Type of the value (Type or const Type)
+   class DiagonalIterator
+   {
+    private:
+      //**Type definitions*************************************************************************
+      //! Type of the traversed matrix.
+      typedef typename SelectType< IsConst<VT>::value, const CompactDiagonalMatrix
+                                                     , CompactDiagonalMatrix >::Type  MT;
+
+      //! Type of the access proxy for the elements of a non-constant matrix.
+      typedef CompactDiagonalProxy<Type>  ProxyType;
+      //*******************************************************************************************
+
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef Type                             ValueType;         //!< Type of the underlying elements.
+      //! Pointer return type.
+      typedef typename SelectType< IsConst<VT>::value, const Type*, ProxyType >::Type  PointerType;
+
+      //! Reference return type.
+      typedef typename SelectType< IsConst<VT>::value, const Type&, ProxyType >::Type  ReferenceType;
+
+      typedef ptrdiff_t  DifferenceType;  //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Default constructor**********************************************************************
+      /*!\brief Default constructor for the DiagonalIterator class.
+      */
+      inline DiagonalIterator()
+         : matrix_( NULL )  // Pointer to the traversed matrix
+         , row_   ( 0UL  )  // The index of the traversed row
+         , column_( 0UL  )  // The current column index of the iterator
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the DiagonalIterator class.
+      //
+      // \param matrix The traversed matrix.
+      // \param row The index of the traversed row.
+      // \param column The initial column index of the iterator.
+      */
+      inline DiagonalIterator( MT* matrix, size_t row, size_t column )
+         : matrix_( matrix )  // Pointer to the traversed matrix
+         , row_   ( row    )  // The index of the traversed row
+         , column_( column )  // The current column index of the iterator
+      {}
+      //*******************************************************************************************
+
+      //**Conversion constructor*******************************************************************
+      /*!\brief Conversion constructor from different DiagonalIterator instances.
+      //
+      // \param it The iterator to be copied.
+      */
+      template< typename VT2 >
+      inline DiagonalIterator( const DiagonalIterator<VT2>& it )
+         : matrix_( it.matrix_ )  // Pointer to the traversed matrix
+         , row_   ( it.row_    )  // The index of the traversed row
+         , column_( it.column_ )  // The current column index of the iterator
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline DiagonalIterator& operator+=( size_t inc ) {
+         column_ += inc;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline DiagonalIterator& operator-=( size_t dec ) {
+         column_ -= dec;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline DiagonalIterator& operator++() {
+         ++column_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const DiagonalIterator operator++( int ) {
+         const DiagonalIterator tmp( *this );
+         ++column_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline DiagonalIterator& operator--() {
+         --column_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const DiagonalIterator operator--( int ) {
+         const DiagonalIterator tmp( *this );
+         --column_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Subscript operator***********************************************************************
+      /*!\brief Direct access to the matrix elements.
+      //
+      // \param index Access index.
+      // \return Reference or proxy to the accessed value.
+      */
+      inline ReferenceType operator[]( size_t index ) const {
+         return (*matrix_)(row_,column_+index);
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return Reference or proxy to the current element.
+      */
+      inline ReferenceType operator*() const {
+         return (*matrix_)(row_,column_);
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return Pointer or proxy to the current element.
+      */
+      inline PointerType operator->() const {
+         return address( (*matrix_)(row_,column_) );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two DiagonalIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator==( const DiagonalIterator<VT2>& rhs ) const {
+         return column_ == rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two DiagonalIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      template< typename VT2 >
+      inline bool operator!=( const DiagonalIterator<VT2>& rhs ) const {
+         return column_ != rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two DiagonalIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator<( const DiagonalIterator<VT2>& rhs ) const {
+         return column_ < rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two DiagonalIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator>( const DiagonalIterator<VT2>& rhs ) const {
+         return column_ > rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two DiagonalIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator<=( const DiagonalIterator<VT2>& rhs ) const {
+         return column_ <= rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two DiagonalIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator>=( const DiagonalIterator<VT2>& rhs ) const {
+         return column_ >= rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two DiagonalIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      template< typename VT2 >
+      inline DifferenceType operator-( const DiagonalIterator<VT2>& rhs ) const {
+         return column_ - rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a DiagonalIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const DiagonalIterator operator+( const DiagonalIterator& it, size_t inc ) {
+         return DiagonalIterator( it.matrix_, it.row_, it.column_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a DiagonalIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const DiagonalIterator operator+( size_t inc, const DiagonalIterator& it ) {
+         return DiagonalIterator( it.matrix_, it.row_, it.column_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a DiagonalIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const DiagonalIterator operator-( const DiagonalIterator& it, size_t dec ) {
+         return DiagonalIterator( it.matrix_, it.row_, it.column_ - dec );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Address functions************************************************************************
+      /*!\brief Returns the address of a constant matrix element.
+      //
+      // \param value The constant matrix element.
+      // \return Pointer to the matrix element.
+      */
+      static inline const Type* address( const Type& value ) {
+         return &value;
+      }
+      //*******************************************************************************************
+
+      //**Address functions************************************************************************
+      /*!\brief Returns the access proxy of a non-constant matrix element.
+      //
+      // \param proxy The access proxy of the matrix element.
+      // \return The access proxy of the matrix element.
+      */
+      static inline ProxyType address( const ProxyType& proxy ) {
+         return proxy;
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      MT*    matrix_;  //!< Pointer to the traversed matrix.
+      size_t row_;     //!< The index of the traversed row.
+      size_t column_;  //!< The current column index of the iterator.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      /*! \cond BLAZE_INTERNAL */
+      template< typename VT2 > friend class DiagonalIterator;
+      /*! \endcond */
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef IntrinsicTrait<Type>  IT;  //!< Intrinsic trait for the matrix element type.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef CompactDiagonalMatrix<Type>    This;            //!< Type of this CompactDiagonalMatrix instance.
+   typedef This                           ResultType;      //!< Result type for expression template evaluations.
+   typedef DynamicMatrix<Type,true>       OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef This                           TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                           ElementType;     //!< Type of the matrix elements.
+   typedef typename IT::Type              IntrinsicType;   //!< Intrinsic type of the matrix elements.
+   typedef const Type&                    ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                    CompositeType;   //!< Data type for composite expression templates.
+   typedef CompactDiagonalProxy<Type>     Reference;       //!< Reference to a non-constant matrix value.
+   typedef const Type&                    ConstReference;  //!< Reference to a constant matrix value.
+   typedef Type*                          Pointer;         //!< Pointer to a non-constant matrix value.
+   typedef const Type*                    ConstPointer;    //!< Pointer to a constant matrix value.
+   typedef DiagonalIterator<Type>         Iterator;        //!< Iterator over non-constant elements.
+   typedef DiagonalIterator<const Type>   ConstIterator;   //!< Iterator over constant elements.
+   typedef DynamicVector<Type,false>      DiagonalType;    //!< Type of the vector of diagonal elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a CompactDiagonalMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef CompactDiagonalMatrix<ET>  Other;  //!< The type of the other CompactDiagonalMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for intrinsic optimization.
+   /*! The \a vectorizable compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via intrinsics. Since the rows of a CompactDiagonalMatrix are not
+       stored in memory, the flag is always set to \a false. Products with the matrix are
+       vectorized by means of the diagonal() function instead. */
+   enum { vectorizable = 0 };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since a CompactDiagonalMatrix is never the target of an SMP assignment,
+       the flag only enables the parallel evaluation of expressions involving the matrix. */
+   enum { smpAssignable = 1 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline CompactDiagonalMatrix();
+   explicit inline CompactDiagonalMatrix( size_t n );
+   explicit inline CompactDiagonalMatrix( size_t n, const Type& init );
+            inline CompactDiagonalMatrix( const CompactDiagonalMatrix& m );
+
+   template< typename VT >
+   explicit inline CompactDiagonalMatrix( const Vector<VT,false>& diag );
+
+   template< typename MT, bool SO >
+   inline CompactDiagonalMatrix( const Matrix<MT,SO>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j );
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline CompactDiagonalMatrix& operator=( const Type& set );
+   inline CompactDiagonalMatrix& operator=( const CompactDiagonalMatrix& rhs );
+
+   template< typename MT, bool SO > inline CompactDiagonalMatrix& operator= ( const Matrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline CompactDiagonalMatrix& operator+=( const Matrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline CompactDiagonalMatrix& operator-=( const Matrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline CompactDiagonalMatrix& operator*=( const Matrix<MT,SO>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, CompactDiagonalMatrix >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, CompactDiagonalMatrix >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t                 rows() const;
+                              inline size_t                 columns() const;
+                              inline size_t                 capacity() const;
+                              inline size_t                 capacity( size_t i ) const;
+                              inline size_t                 nonZeros() const;
+                              inline size_t                 nonZeros( size_t i ) const;
+                              inline void                   reset();
+                              inline void                   reset( size_t i );
+                              inline void                   clear();
+                              inline void                   resize ( size_t n, bool preserve=true );
+                              inline void                   reserve( size_t elements );
+   template< typename Other > inline CompactDiagonalMatrix& scale( const Other& scalar );
+                              inline void                   swap( CompactDiagonalMatrix& m ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline const DiagonalType& diagonal() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool isAligned   () const;
+   inline bool canSMPAssign() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO > bool initialize( const Matrix<MT,SO>& m );
+
+   template< typename MT, bool SO > void copyDiagonal( const DenseMatrix<MT,SO>& m );
+   template< typename MT >          void copyDiagonal( const SparseMatrix<MT,false>& m );
+   template< typename MT >          void copyDiagonal( const SparseMatrix<MT,true>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   DiagonalType diag_;  //!< The diagonal elements of the matrix.
+   Type zero_;          //!< The zero element of the matrix.
+                        /*!< All non-diagonal elements refer to this element. */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CompactDiagonalMatrix.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline CompactDiagonalMatrix<Type>::CompactDiagonalMatrix()
+   : diag_()  // The diagonal elements of the matrix
+   , zero_()  // The zero element of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ N \times N \f$.
+//
+// \param n The number of rows and columns of the matrix.
+//
+// The matrix is initialized to the zero matrix.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline CompactDiagonalMatrix<Type>::CompactDiagonalMatrix( size_t n )
+   : diag_( n, Type() )  // The diagonal elements of the matrix
+   , zero_()             // The zero element of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogenous initialization of the diagonal.
+//
+// \param n The number of rows and columns of the matrix.
+// \param init The initial value of the diagonal elements.
+//
+// All diagonal elements are initialized with the specified value, all non-diagonal elements
+// are zero.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline CompactDiagonalMatrix<Type>::CompactDiagonalMatrix( size_t n, const Type& init )
+   : diag_( n, init )  // The diagonal elements of the matrix
+   , zero_()           // The zero element of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for CompactDiagonalMatrix.
+//
+// \param m Matrix to be copied.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline CompactDiagonalMatrix<Type>::CompactDiagonalMatrix( const CompactDiagonalMatrix& m )
+   : diag_( m.diag_ )  // The diagonal elements of the matrix
+   , zero_()           // The zero element of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the setup of a diagonal matrix from the vector of its diagonal elements.
+//
+// \param diag The dense or sparse vector of diagonal elements.
+//
+// This constructor creates a \f$ N \times N \f$ diagonal matrix, where \f$ N \f$ is the size
+// of the given vector, and initializes the diagonal with the elements of the vector.
+*/
+template< typename Type >  // Data type of the dense matrix
+template< typename VT >    // Type of the vector of diagonal elements
+inline CompactDiagonalMatrix<Type>::CompactDiagonalMatrix( const Vector<VT,false>& diag )
+   : diag_( ~diag )  // The diagonal elements of the matrix
+   , zero_()         // The zero element of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense and sparse matrices.
+//
+// \param m Matrix to be converted.
+// \exception std::invalid_argument Invalid setup of diagonal matrix.
+//
+// This constructor creates a CompactDiagonalMatrix from the given dense or sparse matrix. In
+// case the given matrix is not diagonal, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the dense matrix
+template< typename MT      // Type of the foreign matrix
+        , bool SO >        // Storage order of the foreign matrix
+inline CompactDiagonalMatrix<Type>::CompactDiagonalMatrix( const Matrix<MT,SO>& m )
+   : diag_()  // The diagonal elements of the matrix
+   , zero_()  // The zero element of the matrix
+{
+   if( !initialize( ~m ) )
+      throw std::invalid_argument( "Invalid setup of diagonal matrix" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Proxy to the accessed value.
+//
+// This function returns a proxy to the element \f$ a_{ij} \f$. In case the element is not a
+// diagonal element, any attempt to modify the element via the returned proxy results in a
+// \a std::invalid_argument exception.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline typename CompactDiagonalMatrix<Type>::Reference
+   CompactDiagonalMatrix<Type>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return Reference( ( i == j )?( diag_.data()+i ):( NULL ), zero_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline typename CompactDiagonalMatrix<Type>::ConstReference
+   CompactDiagonalMatrix<Type>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return ( i == j )?( diag_[i] ):( zero_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline typename CompactDiagonalMatrix<Type>::Iterator
+   CompactDiagonalMatrix<Type>::begin( size_t i )
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid compact diagonal matrix row access index" );
+   return Iterator( this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline typename CompactDiagonalMatrix<Type>::ConstIterator
+   CompactDiagonalMatrix<Type>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid compact diagonal matrix row access index" );
+   return ConstIterator( this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline typename CompactDiagonalMatrix<Type>::ConstIterator
+   CompactDiagonalMatrix<Type>::cbegin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid compact diagonal matrix row access index" );
+   return ConstIterator( this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline typename CompactDiagonalMatrix<Type>::Iterator
+   CompactDiagonalMatrix<Type>::end( size_t i )
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid compact diagonal matrix row access index" );
+   return Iterator( this, i, diag_.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline typename CompactDiagonalMatrix<Type>::ConstIterator
+   CompactDiagonalMatrix<Type>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid compact diagonal matrix row access index" );
+   return ConstIterator( this, i, diag_.size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline typename CompactDiagonalMatrix<Type>::ConstIterator
+   CompactDiagonalMatrix<Type>::cend( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid compact diagonal matrix row access index" );
+   return ConstIterator( this, i, diag_.size() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to the diagonal elements.
+//
+// \param set Scalar value to be assigned to the diagonal elements.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline CompactDiagonalMatrix<Type>& CompactDiagonalMatrix<Type>::operator=( const Type& set )
+{
+   diag_ = set;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for CompactDiagonalMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given \f$ N \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline CompactDiagonalMatrix<Type>&
+   CompactDiagonalMatrix<Type>::operator=( const CompactDiagonalMatrix& rhs )
+{
+   diag_ = rhs.diag_;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense and sparse matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// The matrix is resized according to the given \f$ N \times N \f$ matrix and initialized as a
+// copy of this matrix. In case the given matrix is not diagonal, a \a std::invalid_argument
+// exception is thrown and the matrix remains unchanged.
+*/
+template< typename Type >  // Data type of the dense matrix
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+inline CompactDiagonalMatrix<Type>&
+   CompactDiagonalMatrix<Type>::operator=( const Matrix<MT,SO>& rhs )
+{
+   if( !initialize( ~rhs ) )
+      throw std::invalid_argument( "Invalid assignment to diagonal matrix" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown. Also, in case the result of the addition is not diagonal, a
+// \a std::invalid_argument exception is thrown and the matrix remains unchanged.
+*/
+template< typename Type >  // Data type of the dense matrix
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+inline CompactDiagonalMatrix<Type>&
+   CompactDiagonalMatrix<Type>::operator+=( const Matrix<MT,SO>& rhs )
+{
+   if( (~rhs).rows() != rows() || (~rhs).columns() != columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( !initialize( *this + ~rhs ) )
+      throw std::invalid_argument( "Invalid assignment to diagonal matrix" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown. Also, in case the result of the subtraction is not diagonal, a
+// \a std::invalid_argument exception is thrown and the matrix remains unchanged.
+*/
+template< typename Type >  // Data type of the dense matrix
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+inline CompactDiagonalMatrix<Type>&
+   CompactDiagonalMatrix<Type>::operator-=( const Matrix<MT,SO>& rhs )
+{
+   if( (~rhs).rows() != rows() || (~rhs).columns() != columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( !initialize( *this - ~rhs ) )
+      throw std::invalid_argument( "Invalid assignment to diagonal matrix" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown. Also, in case the result of the multiplication is not diagonal, a
+// \a std::invalid_argument exception is thrown and the matrix remains unchanged.
+*/
+template< typename Type >  // Data type of the dense matrix
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+inline CompactDiagonalMatrix<Type>&
+   CompactDiagonalMatrix<Type>::operator*=( const Matrix<MT,SO>& rhs )
+{
+   if( (~rhs).rows() != columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( !initialize( *this * ~rhs ) )
+      throw std::invalid_argument( "Invalid assignment to diagonal matrix" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type >   // Data type of the dense matrix
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, CompactDiagonalMatrix<Type> >::Type&
+   CompactDiagonalMatrix<Type>::operator*=( Other rhs )
+{
+   diag_ *= rhs;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename Type >   // Data type of the dense matrix
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, CompactDiagonalMatrix<Type> >::Type&
+   CompactDiagonalMatrix<Type>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   diag_ /= rhs;
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline size_t CompactDiagonalMatrix<Type>::rows() const
+{
+   return diag_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline size_t CompactDiagonalMatrix<Type>::columns() const
+{
+   return diag_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+//
+// Note that the capacity refers to the diagonal elements, i.e. a matrix of size
+// \f$ N \times N \f$ requires a capacity of \f$ N \f$ elements.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline size_t CompactDiagonalMatrix<Type>::capacity() const
+{
+   return diag_.capacity();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row.
+//
+// \param i The index of the row.
+// \return The current capacity of row \a i.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline size_t CompactDiagonalMatrix<Type>::capacity( size_t i ) const
+{
+   UNUSED_PARAMETER( i );
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return diag_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix.
+//
+// \return The number of non-zero diagonal elements.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline size_t CompactDiagonalMatrix<Type>::nonZeros() const
+{
+   return diag_.nonZeros();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline size_t CompactDiagonalMatrix<Type>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return ( isDefault( diag_[i] ) )?( 0UL ):( 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type >  // Data type of the dense matrix
+inline void CompactDiagonalMatrix<Type>::reset()
+{
+   diag_.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row to the default initial values.
+//
+// \param i The index of the row.
+// \return void
+//
+// This function resets the values in the specified row to their default value. Note that only
+// the diagonal element of the row is affected.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline void CompactDiagonalMatrix<Type>::reset( size_t i )
+{
+   using blaze::clear;
+
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   clear( diag_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ N \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline void CompactDiagonalMatrix<Type>::clear()
+{
+   diag_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param n The new number of rows and columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ n \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. In case the old values are preserved, new diagonal elements are default initialized.
+// Otherwise, the values of all diagonal elements are undefined after the resize operation.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline void CompactDiagonalMatrix<Type>::resize( size_t n, bool preserve )
+{
+   const size_t oldsize( diag_.size() );
+
+   diag_.resize( n, preserve );
+
+   if( preserve ) {
+      for( size_t i=oldsize; i<n; ++i )
+         diag_[i] = Type();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the matrix.
+//
+// \param elements The new minimum capacity of the matrix.
+// \return void
+//
+// This function increases the capacity of the matrix to at least \a elements diagonal elements.
+// The current values of the matrix elements are preserved.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline void CompactDiagonalMatrix<Type>::reserve( size_t elements )
+{
+   diag_.reserve( elements );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the matrix by the scalar value \a scalar (\f$ A*=s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the matrix.
+*/
+template< typename Type >   // Data type of the dense matrix
+template< typename Other >  // Data type of the scalar value
+inline CompactDiagonalMatrix<Type>& CompactDiagonalMatrix<Type>::scale( const Other& scalar )
+{
+   diag_.scale( scalar );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline void CompactDiagonalMatrix<Type>::swap( CompactDiagonalMatrix& m ) /* throw() */
+{
+   diag_.swap( m.diag_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting up the diagonal matrix from the given dense or sparse matrix.
+//
+// \param m The matrix to be converted.
+// \return \a true in case the given matrix is diagonal, \a false if not.
+//
+// This function copies the diagonal of the given matrix. Expressions and matrices that might
+// alias with the diagonal matrix are evaluated into a temporary matrix first. In case the given
+// matrix is not diagonal, the function returns \a false and the diagonal matrix remains
+// unchanged.
+*/
+template< typename Type >  // Data type of the dense matrix
+template< typename MT      // Type of the foreign matrix
+        , bool SO >        // Storage order of the foreign matrix
+bool CompactDiagonalMatrix<Type>::initialize( const Matrix<MT,SO>& m )
+{
+   typedef typename SelectType< IsDenseMatrix<MT>::value, DynamicMatrix<Type,SO>
+                                                        , CompressedMatrix<Type,SO> >::Type  TmpType;
+
+   if( IsExpression<MT>::value || (~m).canAlias( this ) ) {
+      const TmpType tmp( ~m );
+      return initialize( tmp );
+   }
+
+   if( !IsDiagonal<MT>::value && !isDiagonal( ~m ) )
+      return false;
+
+   resize( (~m).rows(), false );
+   copyDiagonal( ~m );
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copying the diagonal of the given diagonal dense matrix.
+//
+// \param m The diagonal matrix to be copied.
+// \return void
+*/
+template< typename Type >  // Data type of the dense matrix
+template< typename MT      // Type of the foreign matrix
+        , bool SO >        // Storage order of the foreign matrix
+void CompactDiagonalMatrix<Type>::copyDiagonal( const DenseMatrix<MT,SO>& m )
+{
+   const size_t n( diag_.size() );
+
+   for( size_t i=0UL; i<n; ++i )
+      diag_[i] = (~m)(i,i);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copying the diagonal of the given diagonal row-major sparse matrix.
+//
+// \param m The diagonal matrix to be copied.
+// \return void
+*/
+template< typename Type >  // Data type of the dense matrix
+template< typename MT >    // Type of the foreign matrix
+void CompactDiagonalMatrix<Type>::copyDiagonal( const SparseMatrix<MT,false>& m )
+{
+   typedef typename MT::ConstIterator  RhsIterator;
+
+   const size_t n( diag_.size() );
+
+   reset();
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const RhsIterator end( (~m).end(i) );
+      for( RhsIterator element=(~m).begin(i); element!=end; ++element ) {
+         if( element->index() == i )
+            diag_[i] = element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copying the diagonal of the given diagonal column-major sparse matrix.
+//
+// \param m The diagonal matrix to be copied.
+// \return void
+*/
+template< typename Type >  // Data type of the dense matrix
+template< typename MT >    // Type of the foreign matrix
+void CompactDiagonalMatrix<Type>::copyDiagonal( const SparseMatrix<MT,true>& m )
+{
+   typedef typename MT::ConstIterator  RhsIterator;
+
+   const size_t n( diag_.size() );
+
+   reset();
+
+   for( size_t j=0UL; j<n; ++j ) {
+      const RhsIterator end( (~m).end(j) );
+      for( RhsIterator element=(~m).begin(j); element!=end; ++element ) {
+         if( element->index() == j )
+            diag_[j] = element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the vector of diagonal elements of the matrix.
+//
+// \return Reference to the dense vector of diagonal elements.
+//
+// The diagonal elements are stored in a dense column vector that is properly aligned and padded
+// for the vectorized scaling kernels of the multiplication expressions. This function must
+// \b NOT be called explicitly! It is used internally for the performance optimized evaluation
+// of expression templates.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline const typename CompactDiagonalMatrix<Type>::DiagonalType&
+   CompactDiagonalMatrix<Type>::diagonal() const
+{
+   return diag_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type >   // Data type of the dense matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool CompactDiagonalMatrix<Type>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type >   // Data type of the dense matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool CompactDiagonalMatrix<Type>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a false.
+//
+// Since the rows of the diagonal matrix are not stored in memory, this function always returns
+// \a false.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline bool CompactDiagonalMatrix<Type>::isAligned() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type >  // Data type of the dense matrix
+inline bool CompactDiagonalMatrix<Type>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPACTDIAGONALMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CompactDiagonalMatrix operators */
+//@{
+template< typename Type >
+inline void reset( CompactDiagonalMatrix<Type>& m );
+
+template< typename Type >
+inline void reset( CompactDiagonalMatrix<Type>& m, size_t i );
+
+template< typename Type >
+inline void clear( CompactDiagonalMatrix<Type>& m );
+
+template< typename Type >
+inline bool isDefault( const CompactDiagonalMatrix<Type>& m );
+
+template< typename Type >
+inline void swap( CompactDiagonalMatrix<Type>& a, CompactDiagonalMatrix<Type>& b ) /* throw() */;
+
+template< typename Type >
+inline void move( CompactDiagonalMatrix<Type>& dst, CompactDiagonalMatrix<Type>& src ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given compact diagonal matrix.
+// \ingroup compact_diagonal_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type >  // Data type of the dense matrix
+inline void reset( CompactDiagonalMatrix<Type>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row of the given compact diagonal matrix.
+// \ingroup compact_diagonal_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row to be resetted.
+// \return void
+*/
+template< typename Type >  // Data type of the dense matrix
+inline void reset( CompactDiagonalMatrix<Type>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given compact diagonal matrix.
+// \ingroup compact_diagonal_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type >  // Data type of the dense matrix
+inline void clear( CompactDiagonalMatrix<Type>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given compact diagonal matrix is in default state.
+// \ingroup compact_diagonal_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline bool isDefault( const CompactDiagonalMatrix<Type>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compact diagonal matrices.
+// \ingroup compact_diagonal_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline void swap( CompactDiagonalMatrix<Type>& a, CompactDiagonalMatrix<Type>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving the contents of one compact diagonal matrix to another.
+// \ingroup compact_diagonal_matrix
+//
+// \param dst The destination matrix.
+// \param src The source matrix.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type >  // Data type of the dense matrix
+inline void move( CompactDiagonalMatrix<Type>& dst, CompactDiagonalMatrix<Type>& src ) /* throw() */
+{
+   dst.swap( src );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSQUARE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+struct IsSquare< CompactDiagonalMatrix<T> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSYMMETRIC SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+struct IsSymmetric< CompactDiagonalMatrix<T> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISLOWER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+struct IsLower< CompactDiagonalMatrix<T> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISUPPER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+struct IsUpper< CompactDiagonalMatrix<T> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+struct IsResizable< CompactDiagonalMatrix<T> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASDIAGONALSTORAGE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+struct HasDiagonalStorage< CompactDiagonalMatrix<T> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+
+template< typename T, bool AF >
+struct HasDiagonalStorage< DenseSubmatrix<CompactDiagonalMatrix<T>,AF,false> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+
+template< typename T, bool AF >
+struct HasDiagonalStorage< DenseSubmatrix<const CompactDiagonalMatrix<T>,AF,false> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename T2, bool SO >
+struct AddTrait< CompactDiagonalMatrix<T1>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct AddTrait< DynamicMatrix<T1,SO>, CompactDiagonalMatrix<T2> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, typename T2, bool SO, typename IT >
+struct AddTrait< CompactDiagonalMatrix<T1>, CompressedMatrix<T2,SO,IT> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename IT, typename T2 >
+struct AddTrait< CompressedMatrix<T1,SO,IT>, CompactDiagonalMatrix<T2> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2 >
+struct AddTrait< CompactDiagonalMatrix<T1>, CompactDiagonalMatrix<T2> >
+{
+   typedef CompactDiagonalMatrix< typename AddTrait<T1,T2>::Type >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename T2, bool SO >
+struct SubTrait< CompactDiagonalMatrix<T1>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct SubTrait< DynamicMatrix<T1,SO>, CompactDiagonalMatrix<T2> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, typename T2, bool SO, typename IT >
+struct SubTrait< CompactDiagonalMatrix<T1>, CompressedMatrix<T2,SO,IT> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename IT, typename T2 >
+struct SubTrait< CompressedMatrix<T1,SO,IT>, CompactDiagonalMatrix<T2> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2 >
+struct SubTrait< CompactDiagonalMatrix<T1>, CompactDiagonalMatrix<T2> >
+{
+   typedef CompactDiagonalMatrix< typename SubTrait<T1,T2>::Type >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename T2 >
+struct MultTrait< CompactDiagonalMatrix<T1>, T2 >
+{
+   typedef CompactDiagonalMatrix< typename MultTrait<T1,T2>::Type >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+
+template< typename T1, typename T2 >
+struct MultTrait< T1, CompactDiagonalMatrix<T2> >
+{
+   typedef CompactDiagonalMatrix< typename MultTrait<T1,T2>::Type >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
+};
+
+template< typename T1, typename T2, size_t N >
+struct MultTrait< CompactDiagonalMatrix<T1>, StaticVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2 >
+struct MultTrait< StaticVector<T1,N,true>, CompactDiagonalMatrix<T2> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, typename T2, size_t N >
+struct MultTrait< CompactDiagonalMatrix<T1>, HybridVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2 >
+struct MultTrait< HybridVector<T1,N,true>, CompactDiagonalMatrix<T2> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, typename T2 >
+struct MultTrait< CompactDiagonalMatrix<T1>, DynamicVector<T2,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2 >
+struct MultTrait< DynamicVector<T1,true>, CompactDiagonalMatrix<T2> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, typename T2, typename IT >
+struct MultTrait< CompactDiagonalMatrix<T1>, CompressedVector<T2,false,IT> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename IT, typename T2 >
+struct MultTrait< CompressedVector<T1,true,IT>, CompactDiagonalMatrix<T2> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, typename T2, bool SO >
+struct MultTrait< CompactDiagonalMatrix<T1>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct MultTrait< DynamicMatrix<T1,SO>, CompactDiagonalMatrix<T2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, typename T2, bool SO, typename IT >
+struct MultTrait< CompactDiagonalMatrix<T1>, CompressedMatrix<T2,SO,IT> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename IT, typename T2 >
+struct MultTrait< CompressedMatrix<T1,SO,IT>, CompactDiagonalMatrix<T2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, typename T2 >
+struct MultTrait< CompactDiagonalMatrix<T1>, CompactDiagonalMatrix<T2> >
+{
+   typedef CompactDiagonalMatrix< typename MultTrait<T1,T2>::Type >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename T2 >
+struct DivTrait< CompactDiagonalMatrix<T1>, T2 >
+{
+   typedef CompactDiagonalMatrix< typename DivTrait<T1,T2>::Type >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATHTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename T2 >
+struct MathTrait< CompactDiagonalMatrix<T1>, CompactDiagonalMatrix<T2> >
+{
+   typedef CompactDiagonalMatrix< typename MathTrait<T1,T2>::HighType >  HighType;
+   typedef CompactDiagonalMatrix< typename MathTrait<T1,T2>::LowType  >  LowType;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1 >
+struct SubmatrixTrait< CompactDiagonalMatrix<T1> >
+{
+   typedef DynamicMatrix<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1 >
+struct RowTrait< CompactDiagonalMatrix<T1> >
+{
+   typedef DynamicVector<T1,true>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1 >
+struct ColumnTrait< CompactDiagonalMatrix<T1> >
+{
+   typedef DynamicVector<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,871 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/CompactDiagonalProxy.h
+//  \brief Header file for the CompactDiagonalProxy class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_COMPACTDIAGONALPROXY_H_
+#define _BLAZE_MATH_DENSE_COMPACTDIAGONALPROXY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <ostream>
+#include <stdexcept>
+#include <blaze/math/proxy/Proxy.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access proxy for the elements of a CompactDiagonalMatrix.
+// \ingroup compact_diagonal_matrix
+//
+// The CompactDiagonalProxy provides controlled access to the elements of a non-const
+// CompactDiagonalMatrix. Since only the diagonal elements are stored, the proxy refers either
+// to a diagonal element or, in case it represents a non-diagonal element, to a constant zero
+// value. Any attempt to modify a non-diagonal element results in a \a std::invalid_argument
+// exception:
+
+   \code
+   // Creating a 3x3 compact diagonal matrix
+   blaze::CompactDiagonalMatrix<int> A( 3UL );
+
+   A(0,0) = -2;  //        ( -2 0 0 )
+   A(1,1) =  3;  // => A = (  0 3 0 )
+   A(2,2) =  5;  //        (  0 0 5 )
+
+   A(0,2) =  7;  // Invalid assignment to non-diagonal matrix element; results in an exception!
+   \endcode
+*/
+template< typename Type >  // Data type of the matrix elements
+class CompactDiagonalProxy : public Proxy< CompactDiagonalProxy<Type>, Type >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef Type         RepresentedType;  //!< Type of the represented matrix element.
+   typedef const Type&  RawReference;     //!< Reference to the represented element.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline CompactDiagonalProxy( Type* value, const Type& zero );
+            inline CompactDiagonalProxy( const CompactDiagonalProxy& cdp );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                          inline const CompactDiagonalProxy& operator= ( const CompactDiagonalProxy& cdp ) const;
+   template< typename T > inline const CompactDiagonalProxy& operator= ( const T& value ) const;
+   template< typename T > inline const CompactDiagonalProxy& operator+=( const T& value ) const;
+   template< typename T > inline const CompactDiagonalProxy& operator-=( const T& value ) const;
+   template< typename T > inline const CompactDiagonalProxy& operator*=( const T& value ) const;
+   template< typename T > inline const CompactDiagonalProxy& operator/=( const T& value ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline RawReference get()          const;
+   inline bool         isRestricted() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator RawReference() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void checkAccess() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Type* const       value_;  //!< Pointer to the accessed stored matrix element.
+                              /*!< The pointer is \a NULL in case the proxy represents an
+                                   non-diagonal element of the matrix. */
+   const Type* const zero_;   //!< Pointer to the zero element of the matrix.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization constructor for a CompactDiagonalProxy.
+//
+// \param value Pointer to the accessed stored element (\a NULL for non-diagonal elements).
+// \param zero Reference to the zero element of the matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline CompactDiagonalProxy<Type>::CompactDiagonalProxy( Type* value, const Type& zero )
+   : value_( value )  // Pointer to the accessed stored matrix element
+   , zero_ ( &zero )  // Pointer to the zero element of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for CompactDiagonalProxy.
+//
+// \param cdp Compact diagonal proxy to be copied.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline CompactDiagonalProxy<Type>::CompactDiagonalProxy( const CompactDiagonalProxy& cdp )
+   : value_( cdp.value_ )  // Pointer to the accessed stored matrix element
+   , zero_ ( cdp.zero_  )  // Pointer to the zero element of the matrix
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for CompactDiagonalProxy.
+//
+// \param cdp Compact diagonal proxy to be copied.
+// \return Reference to the assigned proxy.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline const CompactDiagonalProxy<Type>& CompactDiagonalProxy<Type>::operator=( const CompactDiagonalProxy& cdp ) const
+{
+   checkAccess();
+
+   *value_ = cdp.get();
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment to the accessed matrix element.
+//
+// \param value The new value of the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to non-diagonal matrix element.
+//
+// In case the proxy represents a non-diagonal element of the matrix, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename T >     // Type of the right-hand side value
+inline const CompactDiagonalProxy<Type>& CompactDiagonalProxy<Type>::operator=( const T& value ) const
+{
+   checkAccess();
+
+   *value_ = value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment to the accessed matrix element.
+//
+// \param value The right-hand side value to be added to the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to non-diagonal matrix element.
+//
+// In case the proxy represents a non-diagonal element of the matrix, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename T >     // Type of the right-hand side value
+inline const CompactDiagonalProxy<Type>& CompactDiagonalProxy<Type>::operator+=( const T& value ) const
+{
+   checkAccess();
+
+   *value_ += value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment to the accessed matrix element.
+//
+// \param value The right-hand side value to be subtracted from the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to non-diagonal matrix element.
+//
+// In case the proxy represents a non-diagonal element of the matrix, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename T >     // Type of the right-hand side value
+inline const CompactDiagonalProxy<Type>& CompactDiagonalProxy<Type>::operator-=( const T& value ) const
+{
+   checkAccess();
+
+   *value_ -= value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment to the accessed matrix element.
+//
+// \param value The right-hand side value for the multiplication.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to non-diagonal matrix element.
+//
+// In case the proxy represents a non-diagonal element of the matrix, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename T >     // Type of the right-hand side value
+inline const CompactDiagonalProxy<Type>& CompactDiagonalProxy<Type>::operator*=( const T& value ) const
+{
+   checkAccess();
+
+   *value_ *= value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment to the accessed matrix element.
+//
+// \param value The right-hand side value for the division.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to non-diagonal matrix element.
+//
+// In case the proxy represents a non-diagonal element of the matrix, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename T >     // Type of the right-hand side value
+inline const CompactDiagonalProxy<Type>& CompactDiagonalProxy<Type>::operator/=( const T& value ) const
+{
+   checkAccess();
+
+   *value_ /= value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returning the value of the accessed matrix element.
+//
+// \return Direct/raw reference to the accessed matrix element.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline typename CompactDiagonalProxy<Type>::RawReference CompactDiagonalProxy<Type>::get() const
+{
+   return ( value_ != NULL )?( *value_ ):( *zero_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the proxy represents a restricted matrix element..
+//
+// \return \a true in case access to the matrix element is restricted, \a false if not.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline bool CompactDiagonalProxy<Type>::isRestricted() const
+{
+   return value_ == NULL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks the access to the represented matrix element.
+//
+// \return void
+// \exception std::invalid_argument Invalid assignment to non-diagonal matrix element.
+//
+// In case the proxy represents a non-diagonal element of the matrix, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline void CompactDiagonalProxy<Type>::checkAccess() const
+{
+   if( isRestricted() ) {
+      throw std::invalid_argument( "Invalid assignment to non-diagonal matrix element" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion to the accessed matrix element.
+//
+// \return Direct/raw reference to the accessed matrix element.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline CompactDiagonalProxy<Type>::operator RawReference() const
+{
+   return get();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CompactDiagonalProxy operators */
+//@{
+template< typename T1, typename T2 >
+inline bool operator==( const CompactDiagonalProxy<T1>& lhs, const CompactDiagonalProxy<T2>& rhs );
+
+template< typename Type, typename T >
+inline bool operator==( const CompactDiagonalProxy<Type>& lhs, const T& rhs );
+
+template< typename T, typename Type >
+inline bool operator==( const T& lhs, const CompactDiagonalProxy<Type>& rhs );
+
+template< typename T1, typename T2 >
+inline bool operator!=( const CompactDiagonalProxy<T1>& lhs, const CompactDiagonalProxy<T2>& rhs );
+
+template< typename Type, typename T >
+inline bool operator!=( const CompactDiagonalProxy<Type>& lhs, const T& rhs );
+
+template< typename T, typename Type >
+inline bool operator!=( const T& lhs, const CompactDiagonalProxy<Type>& rhs );
+
+template< typename T1, typename T2 >
+inline bool operator<( const CompactDiagonalProxy<T1>& lhs, const CompactDiagonalProxy<T2>& rhs );
+
+template< typename Type, typename T >
+inline bool operator<( const CompactDiagonalProxy<Type>& lhs, const T& rhs );
+
+template< typename T, typename Type >
+inline bool operator<( const T& lhs, const CompactDiagonalProxy<Type>& rhs );
+
+template< typename T1, typename T2 >
+inline bool operator>( const CompactDiagonalProxy<T1>& lhs, const CompactDiagonalProxy<T2>& rhs );
+
+template< typename Type, typename T >
+inline bool operator>( const CompactDiagonalProxy<Type>& lhs, const T& rhs );
+
+template< typename T, typename Type >
+inline bool operator>( const T& lhs, const CompactDiagonalProxy<Type>& rhs );
+
+template< typename T1, typename T2 >
+inline bool operator<=( const CompactDiagonalProxy<T1>& lhs, const CompactDiagonalProxy<T2>& rhs );
+
+template< typename Type, typename T >
+inline bool operator<=( const CompactDiagonalProxy<Type>& lhs, const T& rhs );
+
+template< typename T, typename Type >
+inline bool operator<=( const T& lhs, const CompactDiagonalProxy<Type>& rhs );
+
+template< typename T1, typename T2 >
+inline bool operator>=( const CompactDiagonalProxy<T1>& lhs, const CompactDiagonalProxy<T2>& rhs );
+
+template< typename Type, typename T >
+inline bool operator>=( const CompactDiagonalProxy<Type>& lhs, const T& rhs );
+
+template< typename T, typename Type >
+inline bool operator>=( const T& lhs, const CompactDiagonalProxy<Type>& rhs );
+
+template< typename Type >
+inline std::ostream& operator<<( std::ostream& os, const CompactDiagonalProxy<Type>& proxy );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two CompactDiagonalProxy objects.
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side CompactDiagonalProxy object.
+// \param rhs The right-hand side CompactDiagonalProxy object.
+// \return \a true if both referenced values are equal, \a false if they are not.
+*/
+template< typename T1, typename T2 >
+inline bool operator==( const CompactDiagonalProxy<T1>& lhs, const CompactDiagonalProxy<T2>& rhs )
+{
+   return ( lhs.get() == rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between a CompactDiagonalProxy object and an object of different type.
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side CompactDiagonalProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the referenced value and the other object are equal, \a false if they are not.
+*/
+template< typename Type, typename T >
+inline bool operator==( const CompactDiagonalProxy<Type>& lhs, const T& rhs )
+{
+   return ( lhs.get() == rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between an object of different type and a CompactDiagonalProxy object.
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side CompactDiagonalProxy object.
+// \return \a true if the other object and the referenced value are equal, \a false if they are not.
+*/
+template< typename T, typename Type >
+inline bool operator==( const T& lhs, const CompactDiagonalProxy<Type>& rhs )
+{
+   return ( lhs == rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two CompactDiagonalProxy objects.
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side CompactDiagonalProxy object.
+// \param rhs The right-hand side CompactDiagonalProxy object.
+// \return \a true if both referenced values are not equal, \a false if they are.
+*/
+template< typename T1, typename T2 >
+inline bool operator!=( const CompactDiagonalProxy<T1>& lhs, const CompactDiagonalProxy<T2>& rhs )
+{
+   return ( lhs.get() != rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between a CompactDiagonalProxy object and an object of different type.
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side CompactDiagonalProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the referenced value and the other object are not equal, \a false if they are.
+*/
+template< typename Type, typename T >
+inline bool operator!=( const CompactDiagonalProxy<Type>& lhs, const T& rhs )
+{
+   return ( lhs.get() != rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inquality comparison between an object of different type and a CompactDiagonalProxy object.
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side CompactDiagonalProxy object.
+// \return \a true if the other object and the referenced value are not equal, \a false if they are.
+*/
+template< typename T, typename Type >
+inline bool operator!=( const T& lhs, const CompactDiagonalProxy<Type>& rhs )
+{
+   return ( lhs != rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between two CompactDiagonalProxy objects.
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side CompactDiagonalProxy object.
+// \param rhs The right-hand side CompactDiagonalProxy object.
+// \return \a true if the left-hand side referenced value is smaller, \a false if not.
+*/
+template< typename T1, typename T2 >
+inline bool operator<( const CompactDiagonalProxy<T1>& lhs, const CompactDiagonalProxy<T2>& rhs )
+{
+   return ( lhs.get() < rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between a CompactDiagonalProxy object and an object of different type.
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side CompactDiagonalProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is smaller, \a false if not.
+*/
+template< typename Type, typename T >
+inline bool operator<( const CompactDiagonalProxy<Type>& lhs, const T& rhs )
+{
+   return ( lhs.get() < rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between an object of different type and a CompactDiagonalProxy object.
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side CompactDiagonalProxy object.
+// \return \a true if the left-hand side other object is smaller, \a false if not.
+*/
+template< typename T, typename Type >
+inline bool operator<( const T& lhs, const CompactDiagonalProxy<Type>& rhs )
+{
+   return ( lhs < rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between two CompactDiagonalProxy objects.
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side CompactDiagonalProxy object.
+// \param rhs The right-hand side CompactDiagonalProxy object.
+// \return \a true if the left-hand side referenced value is greater, \a false if not.
+*/
+template< typename T1, typename T2 >
+inline bool operator>( const CompactDiagonalProxy<T1>& lhs, const CompactDiagonalProxy<T2>& rhs )
+{
+   return ( lhs.get() > rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between a CompactDiagonalProxy object and an object of different type.
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side CompactDiagonalProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is greater, \a false if not.
+*/
+template< typename Type, typename T >
+inline bool operator>( const CompactDiagonalProxy<Type>& lhs, const T& rhs )
+{
+   return ( lhs.get() > rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between an object of different type and a CompactDiagonalProxy object.
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side CompactDiagonalProxy object.
+// \return \a true if the left-hand side other object is greater, \a false if not.
+*/
+template< typename T, typename Type >
+inline bool operator>( const T& lhs, const CompactDiagonalProxy<Type>& rhs )
+{
+   return ( lhs > rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between two CompactDiagonalProxy objects.
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side CompactDiagonalProxy object.
+// \param rhs The right-hand side CompactDiagonalProxy object.
+// \return \a true if the left-hand side referenced value is smaller or equal, \a false if not.
+*/
+template< typename T1, typename T2 >
+inline bool operator<=( const CompactDiagonalProxy<T1>& lhs, const CompactDiagonalProxy<T2>& rhs )
+{
+   return ( lhs.get() <= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between a CompactDiagonalProxy object and an object of different type.
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side CompactDiagonalProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is smaller or equal, \a false if not.
+*/
+template< typename Type, typename T >
+inline bool operator<=( const CompactDiagonalProxy<Type>& lhs, const T& rhs )
+{
+   return ( lhs.get() <= rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between an object of different type and a CompactDiagonalProxy object.
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side CompactDiagonalProxy object.
+// \return \a true if the left-hand side other object is smaller or equal, \a false if not.
+*/
+template< typename T, typename Type >
+inline bool operator<=( const T& lhs, const CompactDiagonalProxy<Type>& rhs )
+{
+   return ( lhs <= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between two CompactDiagonalProxy objects.
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side CompactDiagonalProxy object.
+// \param rhs The right-hand side CompactDiagonalProxy object.
+// \return \a true if the left-hand side referenced value is greater or equal, \a false if not.
+*/
+template< typename T1, typename T2 >
+inline bool operator>=( const CompactDiagonalProxy<T1>& lhs, const CompactDiagonalProxy<T2>& rhs )
+{
+   return ( lhs.get() >= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between a CompactDiagonalProxy object and an object of different type.
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side CompactDiagonalProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is greater or equal, \a false if not.
+*/
+template< typename Type, typename T >
+inline bool operator>=( const CompactDiagonalProxy<Type>& lhs, const T& rhs )
+{
+   return ( lhs.get() >= rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between an object of different type and a CompactDiagonalProxy object.
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side CompactDiagonalProxy object.
+// \return \a true if the left-hand side other object is greater or equal, \a false if not.
+*/
+template< typename T, typename Type >
+inline bool operator>=( const T& lhs, const CompactDiagonalProxy<Type>& rhs )
+{
+   return ( lhs >= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Global output operator for proxies on compact diagonal matrices.
+// \ingroup compact_diagonal_matrix
+//
+// \param os Reference to the output stream.
+// \param proxy Reference to a constant proxy object.
+// \return Reference to the output stream.
+*/
+template< typename Type >
+inline std::ostream& operator<<( std::ostream& os, const CompactDiagonalProxy<Type>& proxy )
+{
+   return os << proxy.get();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CompactDiagonalProxy global functions */
+//@{
+template< typename Type >
+inline void reset( const CompactDiagonalProxy<Type>& proxy );
+
+template< typename Type >
+inline void clear( const CompactDiagonalProxy<Type>& proxy );
+
+template< typename Type >
+inline bool isDefault( const CompactDiagonalProxy<Type>& proxy );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the represented element to the default initial values.
+// \ingroup compact_diagonal_matrix
+//
+// \param proxy The given access proxy.
+// \return void
+//
+// This function resets the element represented by the access proxy to its default initial
+// value.
+*/
+template< typename Type >
+inline void reset( const CompactDiagonalProxy<Type>& proxy )
+{
+   using blaze::reset;
+
+   reset( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the represented element.
+// \ingroup compact_diagonal_matrix
+//
+// \param proxy The given access proxy.
+// \return void
+//
+// This function clears the element represented by the access proxy to its default initial
+// state.
+*/
+template< typename Type >
+inline void clear( const CompactDiagonalProxy<Type>& proxy )
+{
+   using blaze::clear;
+
+   clear( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the represented element is in default state.
+// \ingroup compact_diagonal_matrix
+//
+// \param proxy The given access proxy
+// \return \a true in case the represented element is in default state, \a false otherwise.
+//
+// This function checks whether the element represented by the access proxy is in default state.
+// In case it is in default state, the function returns \a true, otherwise it returns \a false.
+*/
+template< typename Type >
+inline bool isDefault( const CompactDiagonalProxy<Type>& proxy )
+{
+   using blaze::isDefault;
+
+   return isDefault( proxy.get() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -52,6 +52,7 @@
 #include <blaze/math/Intrinsics.h>
 #include <blaze/math/shims/Clear.h>
 #include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/smp/FirstTouch.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/ColumnTrait.h>
 #include <blaze/math/traits/DivTrait.h>
@@ -493,7 +494,7 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   if( IsVectorizable<Type>::value ) {
+   if( !smpFirstTouch( v_, m_, n_, nn_, Type() ) && IsVectorizable<Type>::value ) {
       for( size_t i=0UL; i<m_; ++i ) {
          for( size_t j=n_; j<nn_; ++j )
             v_[i*nn_+j] = Type();
@@ -521,6 +522,9 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& in
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
+   if( smpFirstTouch( v_, m_, n_, nn_, init ) )
+      return;
+
    for( size_t i=0UL; i<m; ++i ) {
       for( size_t j=0UL; j<n_; ++j )
          v_[i*nn_+j] = init;
@@ -1448,6 +1452,7 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
    if( m == m_ && n == n_ ) return;
 
    const size_t nn( adjustColumns( n ) );
+   bool touched( false );
 
    if( preserve )
    {
@@ -1455,6 +1460,8 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
       const size_t min_m( min( m, m_ ) );
       const size_t min_n( min( n, n_ ) );
 
+      touched = smpFirstTouch( v, m, n, nn, Type() );
+
       for( size_t i=0UL; i<min_m; ++i )
          for( size_t j=0UL; j<min_n; ++j )
             v[i*nn+j] = v_[i*nn_+j];
@@ -1465,12 +1472,13 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
    }
    else if( m*nn > capacity_ ) {
       Type* BLAZE_RESTRICT v = allocate<Type>( m*nn );
+      touched = smpFirstTouch( v, m, n, nn, Type() );
       std::swap( v_, v );
       deallocate( v );
       capacity_ = m*nn;
    }
 
-   if( IsVectorizable<Type>::value ) {
+   if( IsVectorizable<Type>::value && !touched ) {
       for( size_t i=0UL; i<m; ++i )
          for( size_t j=n; j<nn; ++j )
             v_[i*nn+j] = Type();
@@ -2791,7 +2799,7 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   if( IsVectorizable<Type>::value ) {
+   if( !smpFirstTouch( v_, n_, m_, mm_, Type() ) && IsVectorizable<Type>::value ) {
       for( size_t j=0UL; j<n_; ++j )
          for( size_t i=m_; i<mm_; ++i ) {
             v_[i+j*mm_] = Type();
@@ -2820,6 +2828,9 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type&
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
+   if( smpFirstTouch( v_, n_, m_, mm_, init ) )
+      return;
+
    for( size_t j=0UL; j<n_; ++j ) {
       for( size_t i=0UL; i<m_; ++i )
          v_[i+j*mm_] = init;
@@ -3738,6 +3749,7 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
    if( m == m_ && n == n_ ) return;
 
    const size_t mm( adjustRows( m ) );
+   bool touched( false );
 
    if( preserve )
    {
@@ -3745,6 +3757,8 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
       const size_t min_m( min( m, m_ ) );
       const size_t min_n( min( n, n_ ) );
 
+      touched = smpFirstTouch( v, n, m, mm, Type() );
+
       for( size_t j=0UL; j<min_n; ++j )
          for( size_t i=0UL; i<min_m; ++i )
             v[i+j*mm] = v_[i+j*mm_];
@@ -3755,12 +3769,13 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
    }
    else if( mm*n > capacity_ ) {
       Type* BLAZE_RESTRICT v = allocate<Type>( mm*n );
+      touched = smpFirstTouch( v, n, m, mm, Type() );
       std::swap( v_, v );
       deallocate( v );
       capacity_ = mm*n;
    }
 
-   if( IsVectorizable<Type>::value ) {
+   if( IsVectorizable<Type>::value && !touched ) {
       for( size_t j=0UL; j<n; ++j )
          for( size_t i=m; i<mm; ++i )
             v_[i+j*mm] = Type();
@@ -5204,14 +5219,14 @@ struct MultTrait< DynamicVector<T1,true>, DynamicMatrix<T2,SO> >
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< DynamicMatrix<T1,SO>, CompressedVector<T2,false> >
+template< typename T1, bool SO, typename T2, typename IT >
+struct MultTrait< DynamicMatrix<T1,SO>, CompressedVector<T2,false,IT> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< CompressedVector<T1,true>, DynamicMatrix<T2,SO> >
+template< typename T1, typename T2, bool SO, typename IT >
+struct MultTrait< CompressedVector<T1,true,IT>, DynamicMatrix<T2,SO> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
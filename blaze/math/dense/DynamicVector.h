@@ -50,6 +50,7 @@
 #include <blaze/math/shims/Clear.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/FirstTouch.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/CrossTrait.h>
 #include <blaze/math/traits/DivTrait.h>
@@ -463,7 +464,7 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n )
    , capacity_( adjustCapacity( n ) )          // The maximum capacity of the vector
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
 {
-   if( IsVectorizable<Type>::value ) {
+   if( !smpFirstTouch( v_, size_, capacity_, Type() ) && IsVectorizable<Type>::value ) {
       for( size_t i=size_; i<capacity_; ++i )
          v_[i] = Type();
    }
@@ -486,6 +487,9 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Type& init )
    , capacity_( adjustCapacity( n ) )          // The maximum capacity of the vector
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
 {
+   if( smpFirstTouch( v_, size_, capacity_, init ) )
+      return;
+
    for( size_t i=0UL; i<size_; ++i )
       v_[i] = init;
 
@@ -1177,11 +1181,13 @@ inline void DynamicVector<Type,TF>::resize( size_t n, bool preserve )
       Type* BLAZE_RESTRICT tmp = allocate<Type>( newCapacity );
 
       // Initializing the new array
+      const bool touched( smpFirstTouch( tmp, n, newCapacity, Type() ) );
+
       if( preserve ) {
          std::copy( v_, v_+size_, tmp );
       }
 
-      if( IsVectorizable<Type>::value ) {
+      if( IsVectorizable<Type>::value && !touched ) {
          for( size_t i=size_; i<newCapacity; ++i )
             tmp[i] = Type();
       }
@@ -51,12 +51,18 @@ namespace blaze {
 //
 //=================================================================================================
 
+template< typename > class BandMatrix;
+template< typename > class CompactDiagonalMatrix;
 template< typename, bool > class DynamicVector;
 template< typename, bool > class DynamicMatrix;
 template< typename, size_t, size_t, bool > class HybridMatrix;
 template< typename, size_t, bool > class HybridVector;
 template< typename, size_t, size_t, bool > class StaticMatrix;
+template< typename, size_t, size_t > class StaticMatrixBatch;
 template< typename, size_t, bool > class StaticVector;
+template< typename, size_t > class StaticVectorBatch;
+template< typename, bool = true > class SymmetricPackedMatrix;
+template< typename, bool = true > class TriangularPackedMatrix;
 
 } // namespace blaze
 
@@ -5564,14 +5564,14 @@ struct MultTrait< DynamicVector<T1,true>, HybridMatrix<T2,M,N,SO> >
    typedef HybridVector< typename MultTrait<T1,T2>::Type, N, true >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct MultTrait< HybridMatrix<T1,M,N,SO>, CompressedVector<T2,false> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename IT >
+struct MultTrait< HybridMatrix<T1,M,N,SO>, CompressedVector<T2,false,IT> >
 {
    typedef HybridVector< typename MultTrait<T1,T2>::Type, M, false >  Type;
 };
 
-template< typename T1, typename T2, size_t M, size_t N, bool SO >
-struct MultTrait< CompressedVector<T1,true>, HybridMatrix<T2,M,N,SO> >
+template< typename T1, typename T2, size_t M, size_t N, bool SO, typename IT >
+struct MultTrait< CompressedVector<T1,true,IT>, HybridMatrix<T2,M,N,SO> >
 {
    typedef HybridVector< typename MultTrait<T1,T2>::Type, N, true >  Type;
 };
@@ -0,0 +1,1070 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/SmallMatrixSolvers.h
+//  \brief Inversion, determinant and direct solvers for small fixed-size dense matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_SMALLMATRIXSOLVERS_H_
+#define _BLAZE_MATH_DENSE_SMALLMATRIXSOLVERS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <blaze/math/dense/HybridMatrix.h>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GENERAL KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determinant of a general \f$ n \times n \f$ matrix via LU decomposition.
+// \ingroup dense_matrix
+//
+// \param a The row-major elements of the matrix, which are overwritten by the LU factors.
+// \param n The number of rows and columns of the matrix.
+// \return The determinant of the matrix.
+//
+// This function computes the determinant by means of an LU decomposition with partial pivoting.
+// In case the number of rows and columns is a compile time constant, all loops have a constant
+// trip count and are completely unrolled by the compiler.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline Type detDefault( Type* a, size_t n )
+{
+   using std::abs;
+
+   Type det( 1 );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      size_t p( k );
+      for( size_t i=k+1UL; i<n; ++i ) {
+         if( abs( a[i*n+k] ) > abs( a[p*n+k] ) )
+            p = i;
+      }
+
+      if( a[p*n+k] == Type(0) )
+         return Type(0);
+
+      if( p != k ) {
+         std::swap_ranges( a+k*n, a+(k+1UL)*n, a+p*n );
+         det = -det;
+      }
+
+      det *= a[k*n+k];
+
+      const Type pivot( Type(1) / a[k*n+k] );
+      for( size_t i=k+1UL; i<n; ++i ) {
+         const Type factor( a[i*n+k] * pivot );
+         for( size_t j=k+1UL; j<n; ++j )
+            a[i*n+j] -= factor * a[k*n+j];
+      }
+   }
+
+   return det;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of a general \f$ n \times n \f$ matrix.
+// \ingroup dense_matrix
+//
+// \param a The row-major elements of the matrix, which are overwritten by the inverse.
+// \param n The number of rows and columns of the matrix (\f$ n \le C \f$).
+// \return \a true in case the matrix has been inverted, \a false if it is singular.
+//
+// This function inverts the given matrix by means of a Gauss-Jordan elimination with partial
+// pivoting.
+*/
+template< size_t C         // Maximum number of rows and columns of the matrix
+        , typename Type >  // Data type of the matrix elements
+inline bool invertDefault( Type* a, size_t n )
+{
+   using std::abs;
+
+   size_t pivots[C];
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      size_t p( k );
+      for( size_t i=k+1UL; i<n; ++i ) {
+         if( abs( a[i*n+k] ) > abs( a[p*n+k] ) )
+            p = i;
+      }
+
+      if( a[p*n+k] == Type(0) )
+         return false;
+
+      pivots[k] = p;
+      if( p != k )
+         std::swap_ranges( a+k*n, a+(k+1UL)*n, a+p*n );
+
+      const Type pivot( Type(1) / a[k*n+k] );
+      a[k*n+k] = Type(1);
+      for( size_t j=0UL; j<n; ++j )
+         a[k*n+j] *= pivot;
+
+      for( size_t i=0UL; i<n; ++i ) {
+         if( i == k ) continue;
+         const Type factor( a[i*n+k] );
+         a[i*n+k] = Type(0);
+         for( size_t j=0UL; j<n; ++j )
+            a[i*n+j] -= factor * a[k*n+j];
+      }
+   }
+
+   for( size_t k=n; k-- > 0UL; ) {
+      if( pivots[k] == k ) continue;
+      for( size_t i=0UL; i<n; ++i )
+         std::swap( a[i*n+k], a[i*n+pivots[k]] );
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Solving a general \f$ n \times n \f$ linear system of equations.
+// \ingroup dense_matrix
+//
+// \param a The row-major elements of the system matrix, which are overwritten by the LU factors.
+// \param b The right-hand side vector, which is overwritten by the solution.
+// \param n The number of rows and columns of the matrix.
+// \return \a true in case the system has been solved, \a false if the matrix is singular.
+//
+// This function solves the given linear system by means of a Gaussian elimination with partial
+// pivoting and a subsequent back substitution.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline bool solveDefault( Type* a, Type* b, size_t n )
+{
+   using std::abs;
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      size_t p( k );
+      for( size_t i=k+1UL; i<n; ++i ) {
+         if( abs( a[i*n+k] ) > abs( a[p*n+k] ) )
+            p = i;
+      }
+
+      if( a[p*n+k] == Type(0) )
+         return false;
+
+      if( p != k ) {
+         std::swap_ranges( a+k*n, a+(k+1UL)*n, a+p*n );
+         std::swap( b[k], b[p] );
+      }
+
+      const Type pivot( Type(1) / a[k*n+k] );
+      for( size_t i=k+1UL; i<n; ++i ) {
+         const Type factor( a[i*n+k] * pivot );
+         for( size_t j=k+1UL; j<n; ++j )
+            a[i*n+j] -= factor * a[k*n+j];
+         b[i] -= factor * b[k];
+      }
+   }
+
+   for( size_t i=n; i-- > 0UL; ) {
+      Type sum( b[i] );
+      for( size_t j=i+1UL; j<n; ++j )
+         sum -= a[i*n+j] * b[j];
+      b[i] = sum / a[i*n+i];
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies the upper left \f$ n \times n \f$ block of a matrix into a row-major array.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be copied.
+// \param a The target array.
+// \param n The number of rows and columns to be copied.
+// \return void
+*/
+template< typename MT      // Type of the matrix
+        , typename Type >  // Data type of the matrix elements
+inline void copyToArray( const MT& A, Type* a, size_t n )
+{
+   for( size_t i=0UL; i<n; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         a[i*n+j] = A(i,j);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies a row-major array into the upper left \f$ n \times n \f$ block of a matrix.
+// \ingroup dense_matrix
+//
+// \param a The array to be copied.
+// \param A The target matrix.
+// \param n The number of rows and columns to be copied.
+// \return void
+*/
+template< typename Type    // Data type of the matrix elements
+        , typename MT >    // Type of the matrix
+inline void copyFromArray( const Type* a, MT& A, size_t n )
+{
+   for( size_t i=0UL; i<n; ++i )
+      for( size_t j=0UL; j<n; ++j )
+         A(i,j) = a[i*n+j];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time dispatch of the kernels for \f$ N \times N \f$ matrices.
+// \ingroup dense_matrix
+//
+// The SmallMatrixKernel class template provides the determinant, inversion and solver kernels
+// for the upper left \f$ N \times N \f$ block of a dense matrix. For \f$ N \le 4 \f$ the kernels
+// are implemented in terms of closed-form formulas, which work directly on the elements of the
+// matrix and keep all intermediate results in local variables. For all larger matrices the
+// elements are copied into a local array and an LU decomposition respectively Gauss-Jordan
+// elimination with partial pivoting is used, whose loops are unrolled by the compiler due to
+// their constant trip count. The inversion and solver kernels return \a false in case the matrix
+// is singular, in which case neither the matrix nor the right-hand side vector are modified.
+*/
+template< size_t N >  // Number of rows and columns of the matrix
+struct SmallMatrixKernel
+{
+   //**********************************************************************************************
+   template< typename MT >
+   static inline typename MT::ElementType det( const MT& A )
+   {
+      typename MT::ElementType a[N*N];
+      copyToArray( A, a, N );
+      return detDefault( a, N );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename MT >
+   static inline bool invert( MT& A )
+   {
+      typename MT::ElementType a[N*N];
+      copyToArray( A, a, N );
+
+      if( !invertDefault<N>( a, N ) ) return false;
+
+      copyFromArray( a, A, N );
+      return true;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename MT, typename VT >
+   static inline bool solve( const MT& A, VT& b )
+   {
+      typedef typename MT::ElementType  ET;
+
+      ET a[N*N], x[N];
+      copyToArray( A, a, N );
+
+      for( size_t i=0UL; i<N; ++i )
+         x[i] = b[i];
+
+      if( !solveDefault( a, x, N ) ) return false;
+
+      for( size_t i=0UL; i<N; ++i )
+         b[i] = x[i];
+      return true;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPECIALIZATIONS FOR 1x1 MATRICES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SmallMatrixKernel class template for \f$ 1 \times 1 \f$ matrices.
+// \ingroup dense_matrix
+*/
+template<>
+struct SmallMatrixKernel<1UL>
+{
+   //**********************************************************************************************
+   template< typename MT >
+   static inline typename MT::ElementType det( const MT& A ) {
+      return A(0,0);
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename MT >
+   static inline bool invert( MT& A ) {
+      typedef typename MT::ElementType  ET;
+      if( A(0,0) == ET(0) ) return false;
+      A(0,0) = ET(1) / A(0,0);
+      return true;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename MT, typename VT >
+   static inline bool solve( const MT& A, VT& b ) {
+      typedef typename MT::ElementType  ET;
+      if( A(0,0) == ET(0) ) return false;
+      b[0] /= A(0,0);
+      return true;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPECIALIZATIONS FOR 2x2 MATRICES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SmallMatrixKernel class template for \f$ 2 \times 2 \f$ matrices.
+// \ingroup dense_matrix
+*/
+template<>
+struct SmallMatrixKernel<2UL>
+{
+   //**********************************************************************************************
+   template< typename MT >
+   static inline typename MT::ElementType det( const MT& A ) {
+      return A(0,0)*A(1,1) - A(0,1)*A(1,0);
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename MT >
+   static inline bool invert( MT& A )
+   {
+      typedef typename MT::ElementType  ET;
+
+      const ET a0( A(0,0) ), a1( A(0,1) ), a2( A(1,0) ), a3( A(1,1) );
+      const ET det( a0*a3 - a1*a2 );
+
+      if( det == ET(0) ) return false;
+
+      const ET idet( ET(1) / det );
+
+      A(0,0) =  a3 * idet;
+      A(0,1) = -a1 * idet;
+      A(1,0) = -a2 * idet;
+      A(1,1) =  a0 * idet;
+
+      return true;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename MT, typename VT >
+   static inline bool solve( const MT& A, VT& b )
+   {
+      typedef typename MT::ElementType  ET;
+
+      const ET det( A(0,0)*A(1,1) - A(0,1)*A(1,0) );
+
+      if( det == ET(0) ) return false;
+
+      const ET idet( ET(1) / det );
+      const ET b0( b[0] ), b1( b[1] );
+
+      b[0] = ( A(1,1)*b0 - A(0,1)*b1 ) * idet;
+      b[1] = ( A(0,0)*b1 - A(1,0)*b0 ) * idet;
+
+      return true;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPECIALIZATIONS FOR 3x3 MATRICES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SmallMatrixKernel class template for \f$ 3 \times 3 \f$ matrices.
+// \ingroup dense_matrix
+//
+// The kernels are based on the adjugate of the matrix, i.e. the transposed matrix of cofactors.
+*/
+template<>
+struct SmallMatrixKernel<3UL>
+{
+   //**********************************************************************************************
+   template< typename MT >
+   static inline typename MT::ElementType det( const MT& A ) {
+      return A(0,0)*( A(1,1)*A(2,2) - A(1,2)*A(2,1) ) +
+             A(0,1)*( A(1,2)*A(2,0) - A(1,0)*A(2,2) ) +
+             A(0,2)*( A(1,0)*A(2,1) - A(1,1)*A(2,0) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename MT >
+   static inline bool invert( MT& A )
+   {
+      typename MT::ElementType b[9];
+
+      if( !inverse( A, b ) ) return false;
+
+      A(0,0) = b[0]; A(0,1) = b[1]; A(0,2) = b[2];
+      A(1,0) = b[3]; A(1,1) = b[4]; A(1,2) = b[5];
+      A(2,0) = b[6]; A(2,1) = b[7]; A(2,2) = b[8];
+
+      return true;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename MT, typename VT >
+   static inline bool solve( const MT& A, VT& x )
+   {
+      typedef typename MT::ElementType  ET;
+
+      ET b[9];
+
+      if( !inverse( A, b ) ) return false;
+
+      const ET x0( x[0] ), x1( x[1] ), x2( x[2] );
+
+      x[0] = b[0]*x0 + b[1]*x1 + b[2]*x2;
+      x[1] = b[3]*x0 + b[4]*x1 + b[5]*x2;
+      x[2] = b[6]*x0 + b[7]*x1 + b[8]*x2;
+
+      return true;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   template< typename MT >
+   static BLAZE_ALWAYS_INLINE bool inverse( const MT& A, typename MT::ElementType* b )
+   {
+      typedef typename MT::ElementType  ET;
+
+      const ET a[9] = { A(0,0), A(0,1), A(0,2),
+                        A(1,0), A(1,1), A(1,2),
+                        A(2,0), A(2,1), A(2,2) };
+
+      const ET c0( a[4]*a[8] - a[5]*a[7] );
+      const ET c3( a[5]*a[6] - a[3]*a[8] );
+      const ET c6( a[3]*a[7] - a[4]*a[6] );
+
+      const ET det( a[0]*c0 + a[1]*c3 + a[2]*c6 );
+
+      if( det == ET(0) ) return false;
+
+      const ET idet( ET(1) / det );
+
+      b[0] = c0 * idet;
+      b[1] = ( a[2]*a[7] - a[1]*a[8] ) * idet;
+      b[2] = ( a[1]*a[5] - a[2]*a[4] ) * idet;
+      b[3] = c3 * idet;
+      b[4] = ( a[0]*a[8] - a[2]*a[6] ) * idet;
+      b[5] = ( a[2]*a[3] - a[0]*a[5] ) * idet;
+      b[6] = c6 * idet;
+      b[7] = ( a[1]*a[6] - a[0]*a[7] ) * idet;
+      b[8] = ( a[0]*a[4] - a[1]*a[3] ) * idet;
+
+      return true;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPECIALIZATIONS FOR 4x4 MATRICES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SmallMatrixKernel class template for \f$ 4 \times 4 \f$ matrices.
+// \ingroup dense_matrix
+//
+// The kernels are based on the Laplace expansion of the determinant in terms of the \f$ 2 \times
+// 2 \f$ minors of the upper two rows (\f$ s_0 \f$ to \f$ s_5 \f$) and the lower two rows (\f$ c_0
+// \f$ to \f$ c_5 \f$). All cofactors of the adjugate are formed from these twelve minors.
+*/
+template<>
+struct SmallMatrixKernel<4UL>
+{
+   //**********************************************************************************************
+   template< typename MT >
+   static inline typename MT::ElementType det( const MT& A )
+   {
+      typedef typename MT::ElementType  ET;
+
+      const ET s0( A(0,0)*A(1,1) - A(1,0)*A(0,1) );
+      const ET s1( A(0,0)*A(1,2) - A(1,0)*A(0,2) );
+      const ET s2( A(0,0)*A(1,3) - A(1,0)*A(0,3) );
+      const ET s3( A(0,1)*A(1,2) - A(1,1)*A(0,2) );
+      const ET s4( A(0,1)*A(1,3) - A(1,1)*A(0,3) );
+      const ET s5( A(0,2)*A(1,3) - A(1,2)*A(0,3) );
+
+      const ET c5( A(2,2)*A(3,3) - A(3,2)*A(2,3) );
+      const ET c4( A(2,1)*A(3,3) - A(3,1)*A(2,3) );
+      const ET c3( A(2,1)*A(3,2) - A(3,1)*A(2,2) );
+      const ET c2( A(2,0)*A(3,3) - A(3,0)*A(2,3) );
+      const ET c1( A(2,0)*A(3,2) - A(3,0)*A(2,2) );
+      const ET c0( A(2,0)*A(3,1) - A(3,0)*A(2,1) );
+
+      return s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename MT >
+   static inline bool invert( MT& A )
+   {
+      typename MT::ElementType b[16];
+
+      if( !inverse( A, b ) ) return false;
+
+      A(0,0) = b[ 0]; A(0,1) = b[ 1]; A(0,2) = b[ 2]; A(0,3) = b[ 3];
+      A(1,0) = b[ 4]; A(1,1) = b[ 5]; A(1,2) = b[ 6]; A(1,3) = b[ 7];
+      A(2,0) = b[ 8]; A(2,1) = b[ 9]; A(2,2) = b[10]; A(2,3) = b[11];
+      A(3,0) = b[12]; A(3,1) = b[13]; A(3,2) = b[14]; A(3,3) = b[15];
+
+      return true;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   template< typename MT, typename VT >
+   static inline bool solve( const MT& A, VT& x )
+   {
+      typedef typename MT::ElementType  ET;
+
+      ET b[16];
+
+      if( !inverse( A, b ) ) return false;
+
+      const ET x0( x[0] ), x1( x[1] ), x2( x[2] ), x3( x[3] );
+
+      x[0] = b[ 0]*x0 + b[ 1]*x1 + b[ 2]*x2 + b[ 3]*x3;
+      x[1] = b[ 4]*x0 + b[ 5]*x1 + b[ 6]*x2 + b[ 7]*x3;
+      x[2] = b[ 8]*x0 + b[ 9]*x1 + b[10]*x2 + b[11]*x3;
+      x[3] = b[12]*x0 + b[13]*x1 + b[14]*x2 + b[15]*x3;
+
+      return true;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   template< typename MT >
+   static BLAZE_ALWAYS_INLINE bool inverse( const MT& A, typename MT::ElementType* b )
+   {
+      typedef typename MT::ElementType  ET;
+
+      const ET a[16] = { A(0,0), A(0,1), A(0,2), A(0,3),
+                         A(1,0), A(1,1), A(1,2), A(1,3),
+                         A(2,0), A(2,1), A(2,2), A(2,3),
+                         A(3,0), A(3,1), A(3,2), A(3,3) };
+
+      const ET s0( a[0]*a[5] - a[4]*a[1] );
+      const ET s1( a[0]*a[6] - a[4]*a[2] );
+      const ET s2( a[0]*a[7] - a[4]*a[3] );
+      const ET s3( a[1]*a[6] - a[5]*a[2] );
+      const ET s4( a[1]*a[7] - a[5]*a[3] );
+      const ET s5( a[2]*a[7] - a[6]*a[3] );
+
+      const ET c5( a[10]*a[15] - a[14]*a[11] );
+      const ET c4( a[ 9]*a[15] - a[13]*a[11] );
+      const ET c3( a[ 9]*a[14] - a[13]*a[10] );
+      const ET c2( a[ 8]*a[15] - a[12]*a[11] );
+      const ET c1( a[ 8]*a[14] - a[12]*a[10] );
+      const ET c0( a[ 8]*a[13] - a[12]*a[ 9] );
+
+      const ET det( s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0 );
+
+      if( det == ET(0) ) return false;
+
+      const ET idet( ET(1) / det );
+
+      b[ 0] = (  a[ 5]*c5 - a[ 6]*c4 + a[ 7]*c3 ) * idet;
+      b[ 1] = ( -a[ 1]*c5 + a[ 2]*c4 - a[ 3]*c3 ) * idet;
+      b[ 2] = (  a[13]*s5 - a[14]*s4 + a[15]*s3 ) * idet;
+      b[ 3] = ( -a[ 9]*s5 + a[10]*s4 - a[11]*s3 ) * idet;
+
+      b[ 4] = ( -a[ 4]*c5 + a[ 6]*c2 - a[ 7]*c1 ) * idet;
+      b[ 5] = (  a[ 0]*c5 - a[ 2]*c2 + a[ 3]*c1 ) * idet;
+      b[ 6] = ( -a[12]*s5 + a[14]*s2 - a[15]*s1 ) * idet;
+      b[ 7] = (  a[ 8]*s5 - a[10]*s2 + a[11]*s1 ) * idet;
+
+      b[ 8] = (  a[ 4]*c4 - a[ 5]*c2 + a[ 7]*c0 ) * idet;
+      b[ 9] = ( -a[ 0]*c4 + a[ 1]*c2 - a[ 3]*c0 ) * idet;
+      b[10] = (  a[12]*s4 - a[13]*s2 + a[15]*s0 ) * idet;
+      b[11] = ( -a[ 8]*s4 + a[ 9]*s2 - a[11]*s0 ) * idet;
+
+      b[12] = ( -a[ 4]*c3 + a[ 5]*c1 - a[ 6]*c0 ) * idet;
+      b[13] = (  a[ 0]*c3 - a[ 1]*c1 + a[ 2]*c0 ) * idet;
+      b[14] = ( -a[12]*s3 + a[13]*s1 - a[14]*s0 ) * idet;
+      b[15] = (  a[ 8]*s3 - a[ 9]*s1 + a[10]*s0 ) * idet;
+
+      return true;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STATICMATRIX FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name StaticMatrix solver functions */
+//@{
+template< typename Type, size_t N, bool SO >
+inline Type det( const StaticMatrix<Type,N,N,SO>& A );
+
+template< typename Type, size_t N, bool SO >
+inline void invert( StaticMatrix<Type,N,N,SO>& A );
+
+template< typename Type, size_t N, bool SO >
+inline const StaticMatrix<Type,N,N,SO> inv( const StaticMatrix<Type,N,N,SO>& A );
+
+template< typename Type, size_t N, bool SO, typename VT >
+inline void solve( const StaticMatrix<Type,N,N,SO>& A, DenseVector<VT,false>& b );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the determinant of a square StaticMatrix.
+// \ingroup dense_matrix
+//
+// \param A The given \f$ N \times N \f$ matrix.
+// \return The determinant of the matrix.
+//
+// For \f$ N \le 4 \f$ the determinant is computed by a closed-form formula, for all larger
+// matrices by an LU decomposition with partial pivoting, which is unrolled by the compiler for
+// small matrices:
+
+   \code
+   blaze::StaticMatrix<double,3UL,3UL> A;
+   // ... Initialization
+   const double d( det( A ) );
+   \endcode
+*/
+template< typename Type  // Data type of the matrix
+        , size_t N       // Number of rows and columns
+        , bool SO >      // Storage order
+inline Type det( const StaticMatrix<Type,N,N,SO>& A )
+{
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+
+   return SmallMatrixKernel<N>::det( A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place inversion of a square StaticMatrix.
+// \ingroup dense_matrix
+//
+// \param A The \f$ N \times N \f$ matrix to be inverted.
+// \return void
+// \exception std::runtime_error Singular matrix provided.
+//
+// For \f$ N \le 4 \f$ the inverse is computed by a closed-form formula based on the adjugate of
+// the matrix, for all larger matrices by a Gauss-Jordan elimination with partial pivoting, which
+// is unrolled by the compiler for small matrices. In case the matrix is singular, a
+// \a std::runtime_error exception is thrown and the matrix is not modified.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t N       // Number of rows and columns
+        , bool SO >      // Storage order
+inline void invert( StaticMatrix<Type,N,N,SO>& A )
+{
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+
+   if( !SmallMatrixKernel<N>::invert( A ) )
+      throw std::runtime_error( "Singular matrix provided" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the inverse of a square StaticMatrix.
+// \ingroup dense_matrix
+//
+// \param A The \f$ N \times N \f$ matrix to be inverted.
+// \return The inverse of the matrix.
+// \exception std::runtime_error Singular matrix provided.
+//
+// This function returns the inverse of the given matrix (see the invert() function). In case
+// the matrix is singular, a \a std::runtime_error exception is thrown:
+
+   \code
+   blaze::StaticMatrix<double,4UL,4UL> A, B;
+   // ... Initialization
+   B = inv( A );
+   \endcode
+
+// Note that the inverse is returned by value. In performance critical code the in-place
+// invert() function should be preferred since it avoids the temporary matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t N       // Number of rows and columns
+        , bool SO >      // Storage order
+inline const StaticMatrix<Type,N,N,SO> inv( const StaticMatrix<Type,N,N,SO>& A )
+{
+   StaticMatrix<Type,N,N,SO> B( A );
+   invert( B );
+   return B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving a linear system with a square StaticMatrix (\f$ A*\vec{x}=\vec{b} \f$).
+// \ingroup dense_matrix
+//
+// \param A The \f$ N \times N \f$ system matrix.
+// \param b The right-hand side vector, which is overwritten with the solution.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+// \exception std::runtime_error Singular matrix provided.
+//
+// For \f$ N \le 4 \f$ the system is solved by means of the closed-form inverse of the matrix,
+// for all larger matrices by a Gaussian elimination with partial pivoting, which is unrolled by
+// the compiler for small matrices. The system matrix is not modified.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t N       // Number of rows and columns
+        , bool SO        // Storage order
+        , typename VT >  // Type of the right-hand side vector
+inline void solve( const StaticMatrix<Type,N,N,SO>& A, DenseVector<VT,false>& b )
+{
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+
+   if( (~b).size() != N )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   if( !SmallMatrixKernel<N>::solve( A, ~b ) )
+      throw std::runtime_error( "Singular matrix provided" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HYBRIDMATRIX FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name HybridMatrix solver functions */
+//@{
+template< typename Type, size_t M, size_t N, bool SO >
+inline Type det( const HybridMatrix<Type,M,N,SO>& A );
+
+template< typename Type, size_t M, size_t N, bool SO >
+inline void invert( HybridMatrix<Type,M,N,SO>& A );
+
+template< typename Type, size_t M, size_t N, bool SO >
+inline const HybridMatrix<Type,M,N,SO> inv( const HybridMatrix<Type,M,N,SO>& A );
+
+template< typename Type, size_t M, size_t N, bool SO, typename VT >
+inline void solve( const HybridMatrix<Type,M,N,SO>& A, DenseVector<VT,false>& b );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the determinant of a square HybridMatrix.
+// \ingroup dense_matrix
+//
+// \param A The given \f$ n \times n \f$ matrix.
+// \return The determinant of the matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// The current number of rows and columns of the matrix is mapped to the according compile time
+// kernel for \f$ n \le 6 \f$ (see the det() function for StaticMatrix). All larger matrices are
+// handled by an LU decomposition with partial pivoting. In case the matrix is not square, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Maximum number of rows
+        , size_t N       // Maximum number of columns
+        , bool SO >      // Storage order
+inline Type det( const HybridMatrix<Type,M,N,SO>& A )
+{
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+
+   if( A.rows() != A.columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   const size_t n( A.rows() );
+
+   switch( n ) {
+      case 0UL: return Type(1);
+      case 1UL: return SmallMatrixKernel<1UL>::det( A );
+      case 2UL: return SmallMatrixKernel<2UL>::det( A );
+      case 3UL: return SmallMatrixKernel<3UL>::det( A );
+      case 4UL: return SmallMatrixKernel<4UL>::det( A );
+      case 5UL: return SmallMatrixKernel<5UL>::det( A );
+      case 6UL: return SmallMatrixKernel<6UL>::det( A );
+      default : break;
+   }
+
+   Type a[M*N];
+   copyToArray( A, a, n );
+
+   return detDefault( a, n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place inversion of a square HybridMatrix.
+// \ingroup dense_matrix
+//
+// \param A The \f$ n \times n \f$ matrix to be inverted.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Singular matrix provided.
+//
+// The current number of rows and columns of the matrix is mapped to the according compile time
+// kernel for \f$ n \le 6 \f$. All larger matrices are inverted by a Gauss-Jordan elimination
+// with partial pivoting. In case the matrix is not square, a \a std::invalid_argument exception
+// is thrown, in case it is singular, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Maximum number of rows
+        , size_t N       // Maximum number of columns
+        , bool SO >      // Storage order
+inline void invert( HybridMatrix<Type,M,N,SO>& A )
+{
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+
+   if( A.rows() != A.columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   const size_t n( A.rows() );
+
+   bool success( true );
+
+   switch( n ) {
+      case 0UL: break;
+      case 1UL: success = SmallMatrixKernel<1UL>::invert( A ); break;
+      case 2UL: success = SmallMatrixKernel<2UL>::invert( A ); break;
+      case 3UL: success = SmallMatrixKernel<3UL>::invert( A ); break;
+      case 4UL: success = SmallMatrixKernel<4UL>::invert( A ); break;
+      case 5UL: success = SmallMatrixKernel<5UL>::invert( A ); break;
+      case 6UL: success = SmallMatrixKernel<6UL>::invert( A ); break;
+      default : {
+         Type a[M*N];
+         copyToArray( A, a, n );
+         success = invertDefault<M>( a, n );
+         if( success ) copyFromArray( a, A, n );
+         break;
+      }
+   }
+
+   if( !success )
+      throw std::runtime_error( "Singular matrix provided" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the inverse of a square HybridMatrix.
+// \ingroup dense_matrix
+//
+// \param A The \f$ n \times n \f$ matrix to be inverted.
+// \return The inverse of the matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Singular matrix provided.
+//
+// This function returns the inverse of the given matrix (see the invert() function).
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Maximum number of rows
+        , size_t N       // Maximum number of columns
+        , bool SO >      // Storage order
+inline const HybridMatrix<Type,M,N,SO> inv( const HybridMatrix<Type,M,N,SO>& A )
+{
+   HybridMatrix<Type,M,N,SO> B( A );
+   invert( B );
+   return B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving a linear system with a square HybridMatrix (\f$ A*\vec{x}=\vec{b} \f$).
+// \ingroup dense_matrix
+//
+// \param A The \f$ n \times n \f$ system matrix.
+// \param b The right-hand side vector, which is overwritten with the solution.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Vector sizes do not match.
+// \exception std::runtime_error Singular matrix provided.
+//
+// The current number of rows and columns of the matrix is mapped to the according compile time
+// kernel for \f$ n \le 6 \f$. All larger systems are solved by a Gaussian elimination with
+// partial pivoting. The system matrix is not modified.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Maximum number of rows
+        , size_t N       // Maximum number of columns
+        , bool SO        // Storage order
+        , typename VT >  // Type of the right-hand side vector
+inline void solve( const HybridMatrix<Type,M,N,SO>& A, DenseVector<VT,false>& b )
+{
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+
+   if( A.rows() != A.columns() )
+      throw std::invalid_argument( "Invalid non-square matrix provided" );
+
+   const size_t n( A.rows() );
+
+   if( (~b).size() != n )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   bool success( true );
+
+   switch( n ) {
+      case 0UL: break;
+      case 1UL: success = SmallMatrixKernel<1UL>::solve( A, ~b ); break;
+      case 2UL: success = SmallMatrixKernel<2UL>::solve( A, ~b ); break;
+      case 3UL: success = SmallMatrixKernel<3UL>::solve( A, ~b ); break;
+      case 4UL: success = SmallMatrixKernel<4UL>::solve( A, ~b ); break;
+      case 5UL: success = SmallMatrixKernel<5UL>::solve( A, ~b ); break;
+      case 6UL: success = SmallMatrixKernel<6UL>::solve( A, ~b ); break;
+      default : {
+         Type a[M*N], x[M];
+         copyToArray( A, a, n );
+         for( size_t i=0UL; i<n; ++i )
+            x[i] = (~b)[i];
+         success = solveDefault( a, x, n );
+         if( success ) {
+            for( size_t i=0UL; i<n; ++i )
+               (~b)[i] = x[i];
+         }
+         break;
+      }
+   }
+
+   if( !success )
+      throw std::runtime_error( "Singular matrix provided" );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,709 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/StaticMatrixBatch.h
+//  \brief Implementation of a batch of fixed-size matrices stored in an interleaved layout
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_STATICMATRIXBATCH_H_
+#define _BLAZE_MATH_DENSE_STATICMATRIXBATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup static_matrix_batch StaticMatrixBatch
+// \ingroup dense_matrix
+*/
+/*!\brief Batch of fixed-size \f$ M \times N \f$ matrices.
+// \ingroup static_matrix_batch
+//
+// The StaticMatrixBatch class template represents a contiguous array of independent matrices of
+// the compile time size \f$ M \times N \f$. The type of the elements and the number of rows and
+// columns of the matrices can be specified via the three template parameters:
+
+   \code
+   template< typename Type, size_t M, size_t N >
+   class StaticMatrixBatch;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. StaticMatrixBatch can be used with any
+//          numeric element type.
+//  - M   : specifies the number of rows of each matrix.
+//  - N   : specifies the number of columns of each matrix.
+//
+// In contrast to an array of StaticMatrix instances, the matrices of a batch are stored in an
+// array-of-structures-of-arrays (AoSoA) layout: the matrices are combined in blocks of as many
+// matrices as fit into a single intrinsic vector and within each block the elements \f$ (i,j) \f$
+// of all matrices of the block are stored contiguously. Therefore the batch operations in
+// <blaze/math/dense/BatchOperations.h> vectorize across the matrices of a block instead of across
+// the rows of a single matrix, which uses all SIMD lanes even for small sizes as for instance
+// 3x3 matrices. Additionally, large batches are processed in parallel:
+
+   \code
+   using blaze::StaticMatrix;
+   using blaze::StaticMatrixBatch;
+
+   std::vector< StaticMatrix<double,3UL,3UL> > transforms( 100000UL );
+   // ... Initialization of the transformation matrices
+
+   StaticMatrixBatch<double,3UL,3UL> A( transforms.begin(), transforms.end() );
+   StaticMatrixBatch<double,3UL,3UL> B( 100000UL ), C;
+
+   B.set( 0UL, transforms[1] );  // Setting the first matrix of the batch
+   B(1UL,0UL,2UL) = 2.0;         // Setting the element (0,2) of the second matrix of the batch
+
+   mult( C, A, B );  // Computing C[k] = A[k] * B[k] for all matrices of the batch
+   invert( C );      // Inverting all matrices of the batch in place
+
+   C.scatter( transforms.begin() );  // Writing the results back to the array of matrices
+   \endcode
+
+// Note that a StaticMatrixBatch is not a matrix, i.e. it cannot be used in expressions with other
+// vectors or matrices. All computations are performed via the batch operations.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+class StaticMatrixBatch
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef StaticMatrixBatch<Type,M,N>          This;            //!< Type of this StaticMatrixBatch instance.
+   typedef StaticMatrix<Type,M,N,rowMajor>      MatrixType;      //!< Type of a single matrix of the batch.
+   typedef Type                                 ElementType;     //!< Type of the matrix elements.
+   typedef typename IntrinsicTrait<Type>::Type  IntrinsicType;   //!< Intrinsic type of the matrix elements.
+   typedef Type&                                Reference;       //!< Reference to a non-constant matrix value.
+   typedef const Type&                          ConstReference;  //!< Reference to a constant matrix value.
+   typedef Type*                                Pointer;         //!< Pointer to a non-constant matrix value.
+   typedef const Type*                          ConstPointer;    //!< Pointer to a constant matrix value.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for intrinsic optimization.
+   /*! The \a vectorizable compilation flag indicates whether the batch operations can be
+       vectorized across the matrices of a block. */
+   enum { vectorizable = IsVectorizable<Type>::value };
+
+   //! Number of matrices per block.
+   /*! The \a lanes value specifies the number of matrices that are interleaved within a single
+       block of the batch, which corresponds to the number of elements per intrinsic vector. */
+   enum { lanes = IntrinsicTrait<Type>::size };
+
+   //! Number of elements per block.
+   enum { blockSize = M*N*lanes };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline StaticMatrixBatch();
+   explicit inline StaticMatrixBatch( size_t n );
+
+   template< typename Iterator >
+   explicit inline StaticMatrixBatch( Iterator first, Iterator last );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t k, size_t i, size_t j );
+   inline ConstReference operator()( size_t k, size_t i, size_t j ) const;
+   inline Pointer        data  ();
+   inline ConstPointer   data  () const;
+   inline Pointer        data  ( size_t b );
+   inline ConstPointer   data  ( size_t b ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t           size  () const;
+   inline size_t           blocks() const;
+   inline const MatrixType get   ( size_t k ) const;
+
+   template< typename MT, bool SO > inline void set( size_t k, const Matrix<MT,SO>& m );
+
+   template< typename Iterator > inline void gather ( Iterator first, Iterator last );
+   template< typename Iterator > inline void scatter( Iterator first ) const;
+
+   inline void reset ();
+   inline void clear ();
+   inline void resize( size_t n, bool preserve=true );
+   inline void swap  ( StaticMatrixBatch& b ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t index( size_t k, size_t i, size_t j ) const;
+   inline void   clearLanes( size_t first );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;                  //!< The current number of matrices of the batch.
+   DynamicVector<Type,false> v_;  //!< The interleaved elements of the matrices.
+                                  /*!< The vector stores all blocks of the batch. Within each
+                                       block the element \f$ (i,j) \f$ of the matrix \a k is
+                                       stored at the position
+                                       \f$ (i \cdot N + j) \cdot lanes + k \bmod lanes \f$.
+                                       The unused matrices of the last block are zero. */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+   BLAZE_STATIC_ASSERT( M > 0UL && N > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for StaticMatrixBatch.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline StaticMatrixBatch<Type,M,N>::StaticMatrixBatch()
+   : size_( 0UL )  // The current number of matrices of the batch
+   , v_   ()       // The interleaved elements of the matrices
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a batch of size \a n.
+//
+// \param n The number of matrices of the batch.
+//
+// \b Note: This constructor is only responsible to allocate the required memory. The elements
+// of the matrices are not initialized!
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline StaticMatrixBatch<Type,M,N>::StaticMatrixBatch( size_t n )
+   : size_( n )                                            // The number of matrices
+   , v_   ( ( ( n + lanes - 1UL ) / lanes ) * blockSize )  // The interleaved elements
+{
+   clearLanes( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a batch initialized from a range of matrices.
+//
+// \param first Iterator to the first matrix of the range.
+// \param last Iterator one past the last matrix of the range.
+// \exception std::invalid_argument Invalid matrix size.
+//
+// This constructor creates a batch of \f$ M \times N \f$ matrices from the given range of
+// matrices (as for instance a \a std::vector of StaticMatrix instances). In case any of the
+// matrices does not have the size \f$ M \times N \f$, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename Type        // Data type of the matrix elements
+        , size_t M             // Number of rows of each matrix
+        , size_t N >           // Number of columns of each matrix
+template< typename Iterator >  // Type of the matrix iterator
+inline StaticMatrixBatch<Type,M,N>::StaticMatrixBatch( Iterator first, Iterator last )
+   : size_( 0UL )  // The current number of matrices of the batch
+   , v_   ()       // The interleaved elements of the matrices
+{
+   gather( first, last );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access to the elements of the matrices of the batch.
+//
+// \param k Access index for the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename StaticMatrixBatch<Type,M,N>::Reference
+   StaticMatrixBatch<Type,M,N>::operator()( size_t k, size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( k<size_, "Invalid matrix access index" );
+   BLAZE_USER_ASSERT( i<M    , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<N    , "Invalid column access index" );
+   return v_[index(k,i,j)];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the elements of the matrices of the batch.
+//
+// \param k Access index for the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename StaticMatrixBatch<Type,M,N>::ConstReference
+   StaticMatrixBatch<Type,M,N>::operator()( size_t k, size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( k<size_, "Invalid matrix access index" );
+   BLAZE_USER_ASSERT( i<M    , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<N    , "Invalid column access index" );
+   return v_[index(k,i,j)];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the interleaved elements of the batch.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the batch. The storage consists
+// of blocks of \a blockSize elements, within which the elements of \a lanes matrices are
+// interleaved (see the class documentation).
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename StaticMatrixBatch<Type,M,N>::Pointer StaticMatrixBatch<Type,M,N>::data()
+{
+   return v_.data();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the interleaved elements of the batch.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the batch. The storage consists
+// of blocks of \a blockSize elements, within which the elements of \a lanes matrices are
+// interleaved (see the class documentation).
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename StaticMatrixBatch<Type,M,N>::ConstPointer StaticMatrixBatch<Type,M,N>::data() const
+{
+   return v_.data();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the interleaved elements of a specific block.
+//
+// \param b The block index.
+// \return Pointer to the first element of the block.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename StaticMatrixBatch<Type,M,N>::Pointer StaticMatrixBatch<Type,M,N>::data( size_t b )
+{
+   BLAZE_USER_ASSERT( b < blocks(), "Invalid block access index" );
+   return v_.data() + b*blockSize;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the interleaved elements of a specific block.
+//
+// \param b The block index.
+// \return Pointer to the first element of the block.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline typename StaticMatrixBatch<Type,M,N>::ConstPointer
+   StaticMatrixBatch<Type,M,N>::data( size_t b ) const
+{
+   BLAZE_USER_ASSERT( b < blocks(), "Invalid block access index" );
+   return v_.data() + b*blockSize;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of matrices of the batch.
+//
+// \return The number of matrices of the batch.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline size_t StaticMatrixBatch<Type,M,N>::size() const
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of blocks of the batch.
+//
+// \return The number of blocks of the batch.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline size_t StaticMatrixBatch<Type,M,N>::blocks() const
+{
+   return v_.size() / blockSize;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a copy of a single matrix of the batch.
+//
+// \param k The index of the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \return The \a k-th matrix of the batch.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline const typename StaticMatrixBatch<Type,M,N>::MatrixType
+   StaticMatrixBatch<Type,M,N>::get( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k<size_, "Invalid matrix access index" );
+
+   MatrixType m;
+
+   for( size_t i=0UL; i<M; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         m(i,j) = v_[index(k,i,j)];
+
+   return m;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting a single matrix of the batch.
+//
+// \param k The index of the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param m The new value of the matrix.
+// \return void
+// \exception std::invalid_argument Invalid matrix size.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+template< typename MT    // Type of the matrix
+        , bool SO >      // Storage order of the matrix
+inline void StaticMatrixBatch<Type,M,N>::set( size_t k, const Matrix<MT,SO>& m )
+{
+   BLAZE_USER_ASSERT( k<size_, "Invalid matrix access index" );
+
+   if( (~m).rows() != M || (~m).columns() != N )
+      throw std::invalid_argument( "Invalid matrix size" );
+
+   for( size_t i=0UL; i<M; ++i )
+      for( size_t j=0UL; j<N; ++j )
+         v_[index(k,i,j)] = (~m)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Replacing the matrices of the batch by a range of matrices.
+//
+// \param first Iterator to the first matrix of the range.
+// \param last Iterator one past the last matrix of the range.
+// \return void
+// \exception std::invalid_argument Invalid matrix size.
+//
+// This function resizes the batch to the number of matrices in the range \f$[first..last)\f$
+// and copies the matrices into the interleaved layout of the batch. In case any of the matrices
+// does not have the size \f$ M \times N \f$, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type        // Data type of the matrix elements
+        , size_t M             // Number of rows of each matrix
+        , size_t N >           // Number of columns of each matrix
+template< typename Iterator >  // Type of the matrix iterator
+inline void StaticMatrixBatch<Type,M,N>::gather( Iterator first, Iterator last )
+{
+   resize( static_cast<size_t>( std::distance( first, last ) ), false );
+
+   for( size_t k=0UL; first!=last; ++first, ++k ) {
+      set( k, *first );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writing the matrices of the batch to a range of matrices.
+//
+// \param first Iterator to the first matrix of the target range.
+// \return void
+//
+// This function assigns the matrices of the batch to the range of \a size() matrices starting
+// at \a first, i.e. it is the reverse operation of the gather() function.
+*/
+template< typename Type        // Data type of the matrix elements
+        , size_t M             // Number of rows of each matrix
+        , size_t N >           // Number of columns of each matrix
+template< typename Iterator >  // Type of the matrix iterator
+inline void StaticMatrixBatch<Type,M,N>::scatter( Iterator first ) const
+{
+   for( size_t k=0UL; k<size_; ++k, ++first ) {
+      *first = get( k );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void StaticMatrixBatch<Type,M,N>::reset()
+{
+   blaze::reset( v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the batch.
+//
+// \return void
+//
+// After the clear() function, the size of the batch is 0.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void StaticMatrixBatch<Type,M,N>::clear()
+{
+   size_ = 0UL;
+   v_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the batch.
+//
+// \param n The new number of matrices of the batch.
+// \param preserve \a true if the old matrices of the batch should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the batch using the given size to \a n. During this operation, new
+// dynamic memory may be allocated in case the capacity of the batch is too small. Note that
+// this function may invalidate all existing pointers to the elements of the batch. Also note
+// that in case the batch is enlarged, the elements of the new matrices are not initialized!
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void StaticMatrixBatch<Type,M,N>::resize( size_t n, bool preserve )
+{
+   v_.resize( ( ( n + lanes - 1UL ) / lanes ) * blockSize, preserve );
+   size_ = n;
+   clearLanes( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+//
+// \param b The batch to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void StaticMatrixBatch<Type,M,N>::swap( StaticMatrixBatch& b ) /* throw() */
+{
+   std::swap( size_, b.size_ );
+   v_.swap( b.v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the position of an element within the interleaved storage.
+//
+// \param k The index of the matrix.
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return The position of the element within the storage vector.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline size_t StaticMatrixBatch<Type,M,N>::index( size_t k, size_t i, size_t j ) const
+{
+   return ( k / lanes ) * blockSize + ( i*N + j ) * lanes + ( k % lanes );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets all matrices of the last block starting from the given matrix.
+//
+// \param first The index of the first matrix to be reset.
+// \return void
+//
+// This function resets the unused matrices of the last block, which are expected to be zero by
+// the batch operations.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void StaticMatrixBatch<Type,M,N>::clearLanes( size_t first )
+{
+   const size_t last( blocks()*lanes );
+
+   for( size_t k=first; k<last; ++k )
+      for( size_t e=0UL; e<M*N; ++e )
+         v_[( k / lanes ) * blockSize + e*lanes + ( k % lanes )] = Type();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name StaticMatrixBatch operators */
+//@{
+template< typename Type, size_t M, size_t N >
+inline void swap( StaticMatrixBatch<Type,M,N>& a, StaticMatrixBatch<Type,M,N>& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+// \ingroup static_matrix_batch
+//
+// \param a The first batch to be swapped.
+// \param b The second batch to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the matrix elements
+        , size_t M       // Number of rows of each matrix
+        , size_t N >     // Number of columns of each matrix
+inline void swap( StaticMatrixBatch<Type,M,N>& a, StaticMatrixBatch<Type,M,N>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,652 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/StaticVectorBatch.h
+//  \brief Implementation of a batch of fixed-size vectors stored in an interleaved layout
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_STATICVECTORBATCH_H_
+#define _BLAZE_MATH_DENSE_STATICVECTORBATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Batch of fixed-size vectors with \a N elements.
+// \ingroup static_matrix_batch
+//
+// The StaticVectorBatch class template represents a contiguous array of independent column
+// vectors of the compile time size \a N. It is the vector counterpart of the StaticMatrixBatch
+// class template and uses the same array-of-structures-of-arrays (AoSoA) layout: the vectors are
+// combined in blocks of as many vectors as fit into a single intrinsic vector and within each
+// block the \a i-th elements of all vectors of the block are stored contiguously. The type of
+// the elements and the size of the vectors can be specified via the two template parameters:
+
+   \code
+   template< typename Type, size_t N >
+   class StaticVectorBatch;
+   \endcode
+
+//  - Type: specifies the type of the vector elements. StaticVectorBatch can be used with any
+//          numeric element type.
+//  - N   : specifies the number of elements of each vector.
+//
+// Vector batches are used as operands and results of the batched matrix/vector multiplication
+// and the batched solution of linear systems (see <blaze/math/dense/BatchOperations.h>):
+
+   \code
+   using blaze::StaticMatrixBatch;
+   using blaze::StaticVectorBatch;
+
+   StaticMatrixBatch<double,6UL,6UL> K( 100000UL );  // Element stiffness matrices
+   StaticVectorBatch<double,6UL> u( 100000UL );      // Element loads and displacements
+   // ... Initialization of the batches
+
+   solve( K, u );  // Overwriting u[k] with the solution of K[k] * x = u[k] for all systems
+   \endcode
+*/
+template< typename Type  // Data type of the vector elements
+        , size_t N >     // Number of elements of each vector
+class StaticVectorBatch
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef StaticVectorBatch<Type,N>            This;            //!< Type of this StaticVectorBatch instance.
+   typedef StaticVector<Type,N,columnVector>    VectorType;      //!< Type of a single vector of the batch.
+   typedef Type                                 ElementType;     //!< Type of the vector elements.
+   typedef typename IntrinsicTrait<Type>::Type  IntrinsicType;   //!< Intrinsic type of the vector elements.
+   typedef Type&                                Reference;       //!< Reference to a non-constant vector value.
+   typedef const Type&                          ConstReference;  //!< Reference to a constant vector value.
+   typedef Type*                                Pointer;         //!< Pointer to a non-constant vector value.
+   typedef const Type*                          ConstPointer;    //!< Pointer to a constant vector value.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for intrinsic optimization.
+   /*! The \a vectorizable compilation flag indicates whether the batch operations can be
+       vectorized across the vectors of a block. */
+   enum { vectorizable = IsVectorizable<Type>::value };
+
+   //! Number of vectors per block.
+   /*! The \a lanes value specifies the number of vectors that are interleaved within a single
+       block of the batch, which corresponds to the number of elements per intrinsic vector. */
+   enum { lanes = IntrinsicTrait<Type>::size };
+
+   //! Number of elements per block.
+   enum { blockSize = N*lanes };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline StaticVectorBatch();
+   explicit inline StaticVectorBatch( size_t n );
+
+   template< typename Iterator >
+   explicit inline StaticVectorBatch( Iterator first, Iterator last );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t k, size_t i );
+   inline ConstReference operator()( size_t k, size_t i ) const;
+   inline Pointer        data  ();
+   inline ConstPointer   data  () const;
+   inline Pointer        data  ( size_t b );
+   inline ConstPointer   data  ( size_t b ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t           size  () const;
+   inline size_t           blocks() const;
+   inline const VectorType get   ( size_t k ) const;
+
+   template< typename VT, bool TF > inline void set( size_t k, const Vector<VT,TF>& v );
+
+   template< typename Iterator > inline void gather ( Iterator first, Iterator last );
+   template< typename Iterator > inline void scatter( Iterator first ) const;
+
+   inline void reset ();
+   inline void clear ();
+   inline void resize( size_t n, bool preserve=true );
+   inline void swap  ( StaticVectorBatch& b ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t index( size_t k, size_t i ) const;
+   inline void   clearLanes( size_t first );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;                  //!< The current number of vectors of the batch.
+   DynamicVector<Type,false> v_;  //!< The interleaved elements of the vectors.
+                                  /*!< The vector stores all blocks of the batch. Within each
+                                       block the element \a i of the vector \a k is stored at the
+                                       position \f$ i \cdot lanes + k \bmod lanes \f$. The unused
+                                       vectors of the last block are zero. */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+   BLAZE_STATIC_ASSERT( N > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for StaticVectorBatch.
+*/
+template< typename Type  // Data type of the vector elements
+        , size_t N >     // Number of elements of each vector
+inline StaticVectorBatch<Type,N>::StaticVectorBatch()
+   : size_( 0UL )  // The current number of vectors of the batch
+   , v_   ()       // The interleaved elements of the vectors
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a batch of size \a n.
+//
+// \param n The number of vectors of the batch.
+//
+// \b Note: This constructor is only responsible to allocate the required memory. The elements
+// of the vectors are not initialized!
+*/
+template< typename Type  // Data type of the vector elements
+        , size_t N >     // Number of elements of each vector
+inline StaticVectorBatch<Type,N>::StaticVectorBatch( size_t n )
+   : size_( n )                                            // The number of vectors
+   , v_   ( ( ( n + lanes - 1UL ) / lanes ) * blockSize )  // The interleaved elements
+{
+   clearLanes( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a batch initialized from a range of vectors.
+//
+// \param first Iterator to the first vector of the range.
+// \param last Iterator one past the last vector of the range.
+// \exception std::invalid_argument Invalid vector size.
+//
+// This constructor creates a batch of vectors from the given range of vectors (as for instance
+// a \a std::vector of StaticVector instances). In case any of the vectors does not have the size
+// \a N, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type        // Data type of the vector elements
+        , size_t N >           // Number of elements of each vector
+template< typename Iterator >  // Type of the vector iterator
+inline StaticVectorBatch<Type,N>::StaticVectorBatch( Iterator first, Iterator last )
+   : size_( 0UL )  // The current number of vectors of the batch
+   , v_   ()       // The interleaved elements of the vectors
+{
+   gather( first, last );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access to the elements of the vectors of the batch.
+//
+// \param k Access index for the vector. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the vector elements
+        , size_t N >     // Number of elements of each vector
+inline typename StaticVectorBatch<Type,N>::Reference
+   StaticVectorBatch<Type,N>::operator()( size_t k, size_t i )
+{
+   BLAZE_USER_ASSERT( k<size_, "Invalid vector access index"  );
+   BLAZE_USER_ASSERT( i<N    , "Invalid element access index" );
+   return v_[index(k,i)];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Access to the elements of the vectors of the batch.
+//
+// \param k Access index for the vector. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the vector elements
+        , size_t N >     // Number of elements of each vector
+inline typename StaticVectorBatch<Type,N>::ConstReference
+   StaticVectorBatch<Type,N>::operator()( size_t k, size_t i ) const
+{
+   BLAZE_USER_ASSERT( k<size_, "Invalid vector access index"  );
+   BLAZE_USER_ASSERT( i<N    , "Invalid element access index" );
+   return v_[index(k,i)];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the interleaved elements of the batch.
+//
+// \return Pointer to the internal element storage.
+*/
+template< typename Type  // Data type of the vector elements
+        , size_t N >     // Number of elements of each vector
+inline typename StaticVectorBatch<Type,N>::Pointer StaticVectorBatch<Type,N>::data()
+{
+   return v_.data();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the interleaved elements of the batch.
+//
+// \return Pointer to the internal element storage.
+*/
+template< typename Type  // Data type of the vector elements
+        , size_t N >     // Number of elements of each vector
+inline typename StaticVectorBatch<Type,N>::ConstPointer StaticVectorBatch<Type,N>::data() const
+{
+   return v_.data();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the interleaved elements of a specific block.
+//
+// \param b The block index.
+// \return Pointer to the first element of the block.
+*/
+template< typename Type  // Data type of the vector elements
+        , size_t N >     // Number of elements of each vector
+inline typename StaticVectorBatch<Type,N>::Pointer StaticVectorBatch<Type,N>::data( size_t b )
+{
+   BLAZE_USER_ASSERT( b < blocks(), "Invalid block access index" );
+   return v_.data() + b*blockSize;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the interleaved elements of a specific block.
+//
+// \param b The block index.
+// \return Pointer to the first element of the block.
+*/
+template< typename Type  // Data type of the vector elements
+        , size_t N >     // Number of elements of each vector
+inline typename StaticVectorBatch<Type,N>::ConstPointer
+   StaticVectorBatch<Type,N>::data( size_t b ) const
+{
+   BLAZE_USER_ASSERT( b < blocks(), "Invalid block access index" );
+   return v_.data() + b*blockSize;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of vectors of the batch.
+//
+// \return The number of vectors of the batch.
+*/
+template< typename Type  // Data type of the vector elements
+        , size_t N >     // Number of elements of each vector
+inline size_t StaticVectorBatch<Type,N>::size() const
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of blocks of the batch.
+//
+// \return The number of blocks of the batch.
+*/
+template< typename Type  // Data type of the vector elements
+        , size_t N >     // Number of elements of each vector
+inline size_t StaticVectorBatch<Type,N>::blocks() const
+{
+   return v_.size() / blockSize;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a copy of a single vector of the batch.
+//
+// \param k The index of the vector. The index has to be in the range \f$[0..size-1]\f$.
+// \return The \a k-th vector of the batch.
+*/
+template< typename Type  // Data type of the vector elements
+        , size_t N >     // Number of elements of each vector
+inline const typename StaticVectorBatch<Type,N>::VectorType
+   StaticVectorBatch<Type,N>::get( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k<size_, "Invalid vector access index" );
+
+   VectorType v;
+
+   for( size_t i=0UL; i<N; ++i )
+      v[i] = v_[index(k,i)];
+
+   return v;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting a single vector of the batch.
+//
+// \param k The index of the vector. The index has to be in the range \f$[0..size-1]\f$.
+// \param v The new value of the vector.
+// \return void
+// \exception std::invalid_argument Invalid vector size.
+*/
+template< typename Type  // Data type of the vector elements
+        , size_t N >     // Number of elements of each vector
+template< typename VT    // Type of the vector
+        , bool TF >      // Transpose flag of the vector
+inline void StaticVectorBatch<Type,N>::set( size_t k, const Vector<VT,TF>& v )
+{
+   BLAZE_USER_ASSERT( k<size_, "Invalid vector access index" );
+
+   if( (~v).size() != N )
+      throw std::invalid_argument( "Invalid vector size" );
+
+   for( size_t i=0UL; i<N; ++i )
+      v_[index(k,i)] = (~v)[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Replacing the vectors of the batch by a range of vectors.
+//
+// \param first Iterator to the first vector of the range.
+// \param last Iterator one past the last vector of the range.
+// \return void
+// \exception std::invalid_argument Invalid vector size.
+//
+// This function resizes the batch to the number of vectors in the range \f$[first..last)\f$
+// and copies the vectors into the interleaved layout of the batch. In case any of the vectors
+// does not have the size \a N, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type        // Data type of the vector elements
+        , size_t N >           // Number of elements of each vector
+template< typename Iterator >  // Type of the vector iterator
+inline void StaticVectorBatch<Type,N>::gather( Iterator first, Iterator last )
+{
+   resize( static_cast<size_t>( std::distance( first, last ) ), false );
+
+   for( size_t k=0UL; first!=last; ++first, ++k ) {
+      set( k, *first );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writing the vectors of the batch to a range of vectors.
+//
+// \param first Iterator to the first vector of the target range.
+// \return void
+//
+// This function assigns the vectors of the batch to the range of \a size() vectors starting
+// at \a first, i.e. it is the reverse operation of the gather() function.
+*/
+template< typename Type        // Data type of the vector elements
+        , size_t N >           // Number of elements of each vector
+template< typename Iterator >  // Type of the vector iterator
+inline void StaticVectorBatch<Type,N>::scatter( Iterator first ) const
+{
+   for( size_t k=0UL; k<size_; ++k, ++first ) {
+      *first = get( k );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the vector elements
+        , size_t N >     // Number of elements of each vector
+inline void StaticVectorBatch<Type,N>::reset()
+{
+   blaze::reset( v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the batch.
+//
+// \return void
+//
+// After the clear() function, the size of the batch is 0.
+*/
+template< typename Type  // Data type of the vector elements
+        , size_t N >     // Number of elements of each vector
+inline void StaticVectorBatch<Type,N>::clear()
+{
+   size_ = 0UL;
+   v_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the batch.
+//
+// \param n The new number of vectors of the batch.
+// \param preserve \a true if the old vectors of the batch should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the batch using the given size to \a n. During this operation, new
+// dynamic memory may be allocated in case the capacity of the batch is too small. Note that
+// this function may invalidate all existing pointers to the elements of the batch. Also note
+// that in case the batch is enlarged, the elements of the new vectors are not initialized!
+*/
+template< typename Type  // Data type of the vector elements
+        , size_t N >     // Number of elements of each vector
+inline void StaticVectorBatch<Type,N>::resize( size_t n, bool preserve )
+{
+   v_.resize( ( ( n + lanes - 1UL ) / lanes ) * blockSize, preserve );
+   size_ = n;
+   clearLanes( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+//
+// \param b The batch to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the vector elements
+        , size_t N >     // Number of elements of each vector
+inline void StaticVectorBatch<Type,N>::swap( StaticVectorBatch& b ) /* throw() */
+{
+   std::swap( size_, b.size_ );
+   v_.swap( b.v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the position of an element within the interleaved storage.
+//
+// \param k The index of the vector.
+// \param i The index of the element.
+// \return The position of the element within the storage vector.
+*/
+template< typename Type  // Data type of the vector elements
+        , size_t N >     // Number of elements of each vector
+inline size_t StaticVectorBatch<Type,N>::index( size_t k, size_t i ) const
+{
+   return ( k / lanes ) * blockSize + i * lanes + ( k % lanes );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets all vectors of the last block starting from the given vector.
+//
+// \param first The index of the first vector to be reset.
+// \return void
+//
+// This function resets the unused vectors of the last block, which are expected to be zero by
+// the batch operations.
+*/
+template< typename Type  // Data type of the vector elements
+        , size_t N >     // Number of elements of each vector
+inline void StaticVectorBatch<Type,N>::clearLanes( size_t first )
+{
+   const size_t last( blocks()*lanes );
+
+   for( size_t k=first; k<last; ++k )
+      for( size_t i=0UL; i<N; ++i )
+         v_[( k / lanes ) * blockSize + i*lanes + ( k % lanes )] = Type();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name StaticVectorBatch operators */
+//@{
+template< typename Type, size_t N >
+inline void swap( StaticVectorBatch<Type,N>& a, StaticVectorBatch<Type,N>& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+// \ingroup static_matrix_batch
+//
+// \param a The first batch to be swapped.
+// \param b The second batch to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the vector elements
+        , size_t N >     // Number of elements of each vector
+inline void swap( StaticVectorBatch<Type,N>& a, StaticVectorBatch<Type,N>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
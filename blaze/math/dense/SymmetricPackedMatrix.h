@@ -0,0 +1,2258 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/SymmetricPackedMatrix.h
+//  \brief Implementation of a symmetric dense NxN matrix storing a single triangle in packed format
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_SYMMETRICPACKEDMATRIX_H_
+#define _BLAZE_MATH_DENSE_SYMMETRICPACKEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Intrinsics.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MathTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/HasPackedStorage.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSquare.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/views/Forward.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup symmetric_packed_matrix SymmetricPackedMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Symmetric \f$ N \times N \f$ dense matrix storing a single triangle in packed format.
+// \ingroup symmetric_packed_matrix
+//
+// The SymmetricPackedMatrix class template is a row-major symmetric dense matrix that only stores
+// the \f$ N(N+1)/2 \f$ elements of either its upper or its lower triangle (including the diagonal)
+// in a single contiguous array. In comparison to a SymmetricMatrix< DynamicMatrix<Type> >, which
+// stores all \f$ N^2 \f$ elements, this halves the memory requirements of the matrix and the
+// memory traffic of matrix/vector and matrix/matrix multiplications: every stored off-diagonal
+// element \f$ a_{ij} \f$ is read only once and applied twice, once as \f$ a_{ij} \f$ and once as
+// \f$ a_{ji} \f$. The type of the elements and the stored triangle can be specified via the two
+// template parameters:
+
+   \code
+   template< typename Type, bool UF >
+   class SymmetricPackedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. SymmetricPackedMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - UF  : specifies the stored triangle. In case the flag is set to \a true (the default), the
+//          upper triangle is stored, otherwise the lower triangle.
+//
+// The stored triangle is packed row by row: In case the upper triangle is stored, row \a i holds
+// the elements \f$ a_{ii} \ldots a_{i,N-1} \f$, in case the lower triangle is stored, row \a i
+// holds the elements \f$ a_{i0} \ldots a_{ii} \f$. Since the stored part of every row is a
+// contiguous range of memory, the multiplication kernels can operate directly on the packed rows.
+// The matrix provides the same interface as a SymmetricMatrix< DynamicMatrix<Type> >: it can be
+// created from and assigned any symmetric dense or sparse matrix, any modification of an element
+// \f$ a_{ij} \f$ implicitly modifies \f$ a_{ji} \f$, and the iterators traverse complete rows:
+
+   \code
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::SymmetricMatrix;
+   using blaze::SymmetricPackedMatrix;
+
+   SymmetricMatrix< DynamicMatrix<double> > A( 3000UL );
+   // ... Initialization of the symmetric matrix
+
+   SymmetricPackedMatrix<double> B( A );  // Storing only the upper triangle of A
+
+   B(0,2) = 4.0;  // Modifies both B(0,2) and B(2,0)
+   B(3,1) = 2.0;  // Modifies both B(3,1) and B(1,3)
+
+   DynamicVector<double> x( 3000UL ), y;
+   // ... Initialization of the dense vector
+
+   y = B * x;  // Dense matrix/dense vector multiplication reading every element only once
+   \endcode
+
+// Note that any attempt to setup or assign a non-symmetric matrix results in a
+// \a std::invalid_argument exception.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+class SymmetricPackedMatrix : public DenseMatrix< SymmetricPackedMatrix<Type,UF>, false >
+{
+ public:
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for the stored triangle.
+   /*! The \a storesUpper compilation flag indicates whether the matrix stores its upper (1) or
+       lower (0) triangle. */
+   enum { storesUpper = UF };
+   //**********************************************************************************************
+
+   //**PackedIterator class definition*************************************************************
+   /*!\brief Iterator over the elements of a row of a SymmetricPackedMatrix.
+   //
+   // The PackedIterator traverses a complete row of the symmetric matrix, i.e. including the
+   // elements of the opposite triangle, which are stored in other rows of the packed array.
+   */
+   template< typename VT >  // Type of the value (Type or const Type)
+   class PackedIterator
+   {
+    private:
+      //**Type definitions*************************************************************************
+      //! Type of the traversed matrix.
+      typedef typename SelectType< IsConst<VT>::value, const SymmetricPackedMatrix
+                                                     , SymmetricPackedMatrix >::Type  MT;
+      //*******************************************************************************************
+
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::random_access_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef Type                             ValueType;         //!< Type of the underlying elements.
+      typedef VT*                              PointerType;       //!< Pointer return type.
+      typedef VT&                              ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                        DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Default constructor**********************************************************************
+      /*!\brief Default constructor for the PackedIterator class.
+      */
+      inline PackedIterator()
+         : matrix_( NULL )  // Pointer to the traversed matrix
+         , row_   ( 0UL  )  // The index of the traversed row
+         , column_( 0UL  )  // The current column index of the iterator
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the PackedIterator class.
+      //
+      // \param matrix The traversed matrix.
+      // \param row The index of the traversed row.
+      // \param column The initial column index of the iterator.
+      */
+      inline PackedIterator( MT* matrix, size_t row, size_t column )
+         : matrix_( matrix )  // Pointer to the traversed matrix
+         , row_   ( row    )  // The index of the traversed row
+         , column_( column )  // The current column index of the iterator
+      {}
+      //*******************************************************************************************
+
+      //**Conversion constructor*******************************************************************
+      /*!\brief Conversion constructor from different PackedIterator instances.
+      //
+      // \param it The iterator to be copied.
+      */
+      template< typename VT2 >
+      inline PackedIterator( const PackedIterator<VT2>& it )
+         : matrix_( it.matrix_ )  // Pointer to the traversed matrix
+         , row_   ( it.row_    )  // The index of the traversed row
+         , column_( it.column_ )  // The current column index of the iterator
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline PackedIterator& operator+=( size_t inc ) {
+         column_ += inc;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline PackedIterator& operator-=( size_t dec ) {
+         column_ -= dec;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline PackedIterator& operator++() {
+         ++column_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const PackedIterator operator++( int ) {
+         const PackedIterator tmp( *this );
+         ++column_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline PackedIterator& operator--() {
+         --column_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const PackedIterator operator--( int ) {
+         const PackedIterator tmp( *this );
+         --column_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Subscript operator***********************************************************************
+      /*!\brief Direct access to the matrix elements.
+      //
+      // \param index Access index.
+      // \return Reference to the accessed value.
+      */
+      inline ReferenceType operator[]( size_t index ) const {
+         return (*matrix_)(row_,column_+index);
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return Reference to the current element.
+      */
+      inline ReferenceType operator*() const {
+         return (*matrix_)(row_,column_);
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return Pointer to the current element.
+      */
+      inline PointerType operator->() const {
+         return &(*matrix_)(row_,column_);
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator==( const PackedIterator<VT2>& rhs ) const {
+         return column_ == rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      template< typename VT2 >
+      inline bool operator!=( const PackedIterator<VT2>& rhs ) const {
+         return column_ != rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator<( const PackedIterator<VT2>& rhs ) const {
+         return column_ < rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator>( const PackedIterator<VT2>& rhs ) const {
+         return column_ > rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator<=( const PackedIterator<VT2>& rhs ) const {
+         return column_ <= rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator>=( const PackedIterator<VT2>& rhs ) const {
+         return column_ >= rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two PackedIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      template< typename VT2 >
+      inline DifferenceType operator-( const PackedIterator<VT2>& rhs ) const {
+         return column_ - rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a PackedIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const PackedIterator operator+( const PackedIterator& it, size_t inc ) {
+         return PackedIterator( it.matrix_, it.row_, it.column_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a PackedIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const PackedIterator operator+( size_t inc, const PackedIterator& it ) {
+         return PackedIterator( it.matrix_, it.row_, it.column_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a PackedIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const PackedIterator operator-( const PackedIterator& it, size_t dec ) {
+         return PackedIterator( it.matrix_, it.row_, it.column_ - dec );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      MT*    matrix_;  //!< Pointer to the traversed matrix.
+      size_t row_;     //!< The index of the traversed row.
+      size_t column_;  //!< The current column index of the iterator.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      /*! \cond BLAZE_INTERNAL */
+      template< typename VT2 > friend class PackedIterator;
+      /*! \endcond */
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef IntrinsicTrait<Type>  IT;  //!< Intrinsic trait for the matrix element type.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   typedef SymmetricPackedMatrix<Type,UF>  This;            //!< Type of this SymmetricPackedMatrix instance.
+   typedef This                            ResultType;      //!< Result type for expression template evaluations.
+   typedef DynamicMatrix<Type,true>        OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef DynamicMatrix<Type,true>        TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                            ElementType;     //!< Type of the matrix elements.
+   typedef typename IT::Type               IntrinsicType;   //!< Intrinsic type of the matrix elements.
+   typedef const Type&                     ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                     CompositeType;   //!< Data type for composite expression templates.
+   typedef Type&                           Reference;       //!< Reference to a non-constant matrix value.
+   typedef const Type&                     ConstReference;  //!< Reference to a constant matrix value.
+   typedef Type*                           Pointer;         //!< Pointer to a non-constant matrix value.
+   typedef const Type*                     ConstPointer;    //!< Pointer to a constant matrix value.
+   typedef PackedIterator<Type>            Iterator;        //!< Iterator over non-constant elements.
+   typedef PackedIterator<const Type>      ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SymmetricPackedMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef SymmetricPackedMatrix<ET,UF>  Other;  //!< The type of the other SymmetricPackedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for intrinsic optimization.
+   /*! The \a vectorizable compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via intrinsics. Since the rows of a SymmetricPackedMatrix are neither
+       complete nor aligned in memory, the flag is always set to \a false. */
+   enum { vectorizable = 0 };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since a SymmetricPackedMatrix is never the target of an SMP assignment,
+       the flag only enables the parallel evaluation of expressions involving the matrix. */
+   enum { smpAssignable = 1 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SymmetricPackedMatrix();
+   explicit inline SymmetricPackedMatrix( size_t n );
+   explicit inline SymmetricPackedMatrix( size_t n, const Type& init );
+            inline SymmetricPackedMatrix( const SymmetricPackedMatrix& m );
+
+   template< typename MT, bool SO >
+   inline SymmetricPackedMatrix( const Matrix<MT,SO>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~SymmetricPackedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j );
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline SymmetricPackedMatrix& operator=( const Type& set );
+   inline SymmetricPackedMatrix& operator=( const SymmetricPackedMatrix& rhs );
+
+   template< typename MT, bool SO > inline SymmetricPackedMatrix& operator= ( const Matrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline SymmetricPackedMatrix& operator+=( const Matrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline SymmetricPackedMatrix& operator-=( const Matrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline SymmetricPackedMatrix& operator*=( const Matrix<MT,SO>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, SymmetricPackedMatrix >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, SymmetricPackedMatrix >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t                 rows() const;
+                              inline size_t                 columns() const;
+                              inline size_t                 capacity() const;
+                              inline size_t                 capacity( size_t i ) const;
+                              inline size_t                 nonZeros() const;
+                              inline size_t                 nonZeros( size_t i ) const;
+                              inline void                   reset();
+                              inline void                   reset( size_t i );
+                              inline void                   clear();
+                                     void                   resize ( size_t n, bool preserve=true );
+                              inline void                   reserve( size_t elements );
+                              inline SymmetricPackedMatrix& transpose();
+   template< typename Other > inline SymmetricPackedMatrix& scale( const Other& scalar );
+                              inline void                   swap( SymmetricPackedMatrix& m ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline ConstPointer packedBegin( size_t i ) const;
+   inline ConstPointer packedEnd  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool isAligned   () const;
+   inline bool canSMPAssign() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO > bool initialize( const Matrix<MT,SO>& m );
+
+   template< typename MT, bool SO > void copyTriangle( const DenseMatrix<MT,SO>& m );
+   template< typename MT >          void copyTriangle( const SparseMatrix<MT,false>& m );
+   template< typename MT >          void copyTriangle( const SparseMatrix<MT,true>& m );
+
+   inline bool   isStored( size_t i, size_t j ) const;
+   inline size_t offset  ( size_t i ) const;
+   inline size_t index   ( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;         //!< The current number of rows and columns of the matrix.
+   size_t capacity_;  //!< The maximum capacity of the matrix.
+   Type* v_;          //!< The dynamically allocated elements of the stored triangle.
+                      /*!< In case the upper triangle is stored, the memory layout of the
+                           elements is
+                           \f[\left(\begin{array}{*{5}{c}}
+                           0      & 1      & 2      & \cdots & N-1           \\
+                                  & N      & N+1    & \cdots & 2 \cdot N-2   \\
+                                  &        & \ddots &        & \vdots        \\
+                                  &        &        &        & N(N+1)/2-1    \\
+                           \end{array}\right)\f]. */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SymmetricPackedMatrix.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline SymmetricPackedMatrix<Type,UF>::SymmetricPackedMatrix()
+   : n_       ( 0UL  )  // The current number of rows and columns of the matrix
+   , capacity_( 0UL  )  // The maximum capacity of the matrix
+   , v_       ( NULL )  // The elements of the stored triangle
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ N \times N \f$.
+//
+// \param n The number of rows and columns of the matrix.
+//
+// The matrix is initialized to the zero matrix.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline SymmetricPackedMatrix<Type,UF>::SymmetricPackedMatrix( size_t n )
+   : n_       ( n )                            // The current number of rows and columns of the matrix
+   , capacity_( n*(n+1UL)/2UL )                // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )  // The elements of the stored triangle
+{
+   std::fill( v_, v_+capacity_, Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogenous initialization of all \f$ N \times N \f$ matrix elements.
+//
+// \param n The number of rows and columns of the matrix.
+// \param init The initial value of the matrix elements.
+//
+// All matrix elements are initialized with the specified value.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline SymmetricPackedMatrix<Type,UF>::SymmetricPackedMatrix( size_t n, const Type& init )
+   : n_       ( n )                            // The current number of rows and columns of the matrix
+   , capacity_( n*(n+1UL)/2UL )                // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )  // The elements of the stored triangle
+{
+   std::fill( v_, v_+capacity_, init );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for SymmetricPackedMatrix.
+//
+// \param m Matrix to be copied.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline SymmetricPackedMatrix<Type,UF>::SymmetricPackedMatrix( const SymmetricPackedMatrix& m )
+   : n_       ( m.n_ )                         // The current number of rows and columns of the matrix
+   , capacity_( n_*(n_+1UL)/2UL )              // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )  // The elements of the stored triangle
+{
+   std::copy( m.v_, m.v_+capacity_, v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense and sparse matrices.
+//
+// \param m Matrix to be converted.
+// \exception std::invalid_argument Invalid setup of symmetric matrix.
+//
+// This constructor creates a SymmetricPackedMatrix from the given dense or sparse matrix. In
+// case the given matrix is not symmetric, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+template< typename MT    // Type of the foreign matrix
+        , bool SO >      // Storage order of the foreign matrix
+inline SymmetricPackedMatrix<Type,UF>::SymmetricPackedMatrix( const Matrix<MT,SO>& m )
+   : n_       ( 0UL  )  // The current number of rows and columns of the matrix
+   , capacity_( 0UL  )  // The maximum capacity of the matrix
+   , v_       ( NULL )  // The elements of the stored triangle
+{
+   if( !initialize( ~m ) ) {
+      deallocate( v_ );
+      throw std::invalid_argument( "Invalid setup of symmetric matrix" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for SymmetricPackedMatrix.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline SymmetricPackedMatrix<Type,UF>::~SymmetricPackedMatrix()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function returns a reference to the stored element \f$ a_{ij} \f$ or \f$ a_{ji} \f$,
+// respectively. Note that a modification of the element via the returned reference implicitly
+// modifies both \f$ a_{ij} \f$ and \f$ a_{ji} \f$.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline typename SymmetricPackedMatrix<Type,UF>::Reference
+   SymmetricPackedMatrix<Type,UF>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return v_[index(i,j)];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline typename SymmetricPackedMatrix<Type,UF>::ConstReference
+   SymmetricPackedMatrix<Type,UF>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return v_[index(i,j)];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline typename SymmetricPackedMatrix<Type,UF>::Iterator
+   SymmetricPackedMatrix<Type,UF>::begin( size_t i )
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid symmetric packed matrix row access index" );
+   return Iterator( this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline typename SymmetricPackedMatrix<Type,UF>::ConstIterator
+   SymmetricPackedMatrix<Type,UF>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid symmetric packed matrix row access index" );
+   return ConstIterator( this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline typename SymmetricPackedMatrix<Type,UF>::ConstIterator
+   SymmetricPackedMatrix<Type,UF>::cbegin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid symmetric packed matrix row access index" );
+   return ConstIterator( this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline typename SymmetricPackedMatrix<Type,UF>::Iterator
+   SymmetricPackedMatrix<Type,UF>::end( size_t i )
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid symmetric packed matrix row access index" );
+   return Iterator( this, i, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline typename SymmetricPackedMatrix<Type,UF>::ConstIterator
+   SymmetricPackedMatrix<Type,UF>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid symmetric packed matrix row access index" );
+   return ConstIterator( this, i, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline typename SymmetricPackedMatrix<Type,UF>::ConstIterator
+   SymmetricPackedMatrix<Type,UF>::cend( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid symmetric packed matrix row access index" );
+   return ConstIterator( this, i, n_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to all matrix elements.
+//
+// \param set Scalar value to be assigned to all matrix elements.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline SymmetricPackedMatrix<Type,UF>& SymmetricPackedMatrix<Type,UF>::operator=( const Type& set )
+{
+   std::fill( v_, v_+n_*(n_+1UL)/2UL, set );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SymmetricPackedMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given \f$ N \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline SymmetricPackedMatrix<Type,UF>&
+   SymmetricPackedMatrix<Type,UF>::operator=( const SymmetricPackedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.n_, false );
+   std::copy( rhs.v_, rhs.v_+n_*(n_+1UL)/2UL, v_ );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense and sparse matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to symmetric matrix.
+//
+// The matrix is resized according to the given \f$ N \times N \f$ matrix and initialized as a
+// copy of this matrix. In case the given matrix is not symmetric, a \a std::invalid_argument
+// exception is thrown and the matrix remains unchanged.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO >      // Storage order of the right-hand side matrix
+inline SymmetricPackedMatrix<Type,UF>&
+   SymmetricPackedMatrix<Type,UF>::operator=( const Matrix<MT,SO>& rhs )
+{
+   if( !initialize( ~rhs ) )
+      throw std::invalid_argument( "Invalid assignment to symmetric matrix" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to symmetric matrix.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown. Also, in case the result of the addition is not symmetric, a
+// \a std::invalid_argument exception is thrown and the matrix remains unchanged.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO >      // Storage order of the right-hand side matrix
+inline SymmetricPackedMatrix<Type,UF>&
+   SymmetricPackedMatrix<Type,UF>::operator+=( const Matrix<MT,SO>& rhs )
+{
+   if( (~rhs).rows() != rows() || (~rhs).columns() != columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( !initialize( *this + ~rhs ) )
+      throw std::invalid_argument( "Invalid assignment to symmetric matrix" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to symmetric matrix.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown. Also, in case the result of the subtraction is not symmetric, a
+// \a std::invalid_argument exception is thrown and the matrix remains unchanged.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO >      // Storage order of the right-hand side matrix
+inline SymmetricPackedMatrix<Type,UF>&
+   SymmetricPackedMatrix<Type,UF>::operator-=( const Matrix<MT,SO>& rhs )
+{
+   if( (~rhs).rows() != rows() || (~rhs).columns() != columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( !initialize( *this - ~rhs ) )
+      throw std::invalid_argument( "Invalid assignment to symmetric matrix" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to symmetric matrix.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown. Also, in case the result of the multiplication is not symmetric, a
+// \a std::invalid_argument exception is thrown and the matrix remains unchanged.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO >      // Storage order of the right-hand side matrix
+inline SymmetricPackedMatrix<Type,UF>&
+   SymmetricPackedMatrix<Type,UF>::operator*=( const Matrix<MT,SO>& rhs )
+{
+   if( (~rhs).rows() != columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( !initialize( *this * ~rhs ) )
+      throw std::invalid_argument( "Invalid assignment to symmetric matrix" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the dense matrix
+        , bool UF >         // Upper triangle storage flag
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, SymmetricPackedMatrix<Type,UF> >::Type&
+   SymmetricPackedMatrix<Type,UF>::operator*=( Other rhs )
+{
+   return scale( rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename Type     // Data type of the dense matrix
+        , bool UF >         // Upper triangle storage flag
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, SymmetricPackedMatrix<Type,UF> >::Type&
+   SymmetricPackedMatrix<Type,UF>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   const size_t nn( n_*(n_+1UL)/2UL );
+   for( size_t k=0UL; k<nn; ++k )
+      v_[k] /= rhs;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline size_t SymmetricPackedMatrix<Type,UF>::rows() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline size_t SymmetricPackedMatrix<Type,UF>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+//
+// Note that the capacity refers to the elements of the stored triangle, i.e. a matrix of size
+// \f$ N \times N \f$ requires a capacity of \f$ N(N+1)/2 \f$ elements.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline size_t SymmetricPackedMatrix<Type,UF>::capacity() const
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row.
+//
+// \param i The index of the row.
+// \return The current capacity of row \a i.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline size_t SymmetricPackedMatrix<Type,UF>::capacity( size_t i ) const
+{
+   UNUSED_PARAMETER( i );
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix.
+//
+// \return The number of non-zero elements in the symmetric matrix.
+//
+// Note that every stored off-diagonal non-zero element counts twice, once as \f$ a_{ij} \f$
+// and once as \f$ a_{ji} \f$.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline size_t SymmetricPackedMatrix<Type,UF>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      const ConstPointer end( packedEnd(i) );
+      for( ConstPointer element=packedBegin(i); element!=end; ++element ) {
+         if( !isDefault( *element ) )
+            nonzeros += 2UL;
+      }
+      if( !isDefault( v_[index(i,i)] ) )
+         --nonzeros;
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline size_t SymmetricPackedMatrix<Type,UF>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t j=0UL; j<n_; ++j )
+      if( !isDefault( v_[index(i,j)] ) )
+         ++nonzeros;
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline void SymmetricPackedMatrix<Type,UF>::reset()
+{
+   using blaze::clear;
+
+   const size_t nn( n_*(n_+1UL)/2UL );
+   for( size_t k=0UL; k<nn; ++k )
+      clear( v_[k] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row and column to the default initial values.
+//
+// \param i The index of the row/column.
+// \return void
+//
+// This function resets the values in the specified row and, in order to preserve the symmetry
+// of the matrix, the according column to their default value.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline void SymmetricPackedMatrix<Type,UF>::reset( size_t i )
+{
+   using blaze::clear;
+
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   for( size_t j=0UL; j<n_; ++j )
+      clear( v_[index(i,j)] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ N \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline void SymmetricPackedMatrix<Type,UF>::clear()
+{
+   n_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the matrix.
+//
+// \param n The new number of rows and columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ n \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. In case the old values are preserved, the stored part of every remaining row is moved
+// to its new position within the packed array and new elements are default initialized.
+// Otherwise, the values of all elements are undefined after the resize operation.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+void SymmetricPackedMatrix<Type,UF>::resize( size_t n, bool preserve )
+{
+   if( n == n_ ) return;
+
+   const size_t nn( n*(n+1UL)/2UL );
+
+   if( preserve )
+   {
+      Type* v = allocate<Type>( nn );
+      std::fill( v, v+nn, Type() );
+
+      const size_t nmin( min( n, n_ ) );
+
+      for( size_t i=0UL; i<nmin; ++i ) {
+         const size_t first( ( UF )?( i*(2UL*n-i+1UL)/2UL ):( i*(i+1UL)/2UL ) );
+         std::copy( packedBegin(i), packedBegin(i)+( ( UF )?( nmin-i ):( i+1UL ) ), v+first );
+      }
+
+      std::swap( v_, v );
+      deallocate( v );
+      capacity_ = nn;
+   }
+   else if( nn > capacity_ ) {
+      Type* v = allocate<Type>( nn );
+      std::swap( v_, v );
+      deallocate( v );
+      capacity_ = nn;
+   }
+
+   n_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the matrix.
+//
+// \param elements The new minimum capacity of the matrix.
+// \return void
+//
+// This function increases the capacity of the matrix to at least \a elements elements of the
+// stored triangle. The current values of the matrix elements are preserved.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline void SymmetricPackedMatrix<Type,UF>::reserve( size_t elements )
+{
+   if( elements > capacity_ )
+   {
+      Type* tmp = allocate<Type>( elements );
+      std::copy( v_, v_+n_*(n_+1UL)/2UL, tmp );
+      std::swap( tmp, v_ );
+      deallocate( tmp );
+      capacity_ = elements;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Transposing the matrix.
+//
+// \return Reference to the transposed matrix.
+//
+// Since the matrix is symmetric, this function has no effect.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline SymmetricPackedMatrix<Type,UF>& SymmetricPackedMatrix<Type,UF>::transpose()
+{
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the matrix by the scalar value \a scalar (\f$ A*=s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the dense matrix
+        , bool UF >         // Upper triangle storage flag
+template< typename Other >  // Data type of the scalar value
+inline SymmetricPackedMatrix<Type,UF>& SymmetricPackedMatrix<Type,UF>::scale( const Other& scalar )
+{
+   const size_t nn( n_*(n_+1UL)/2UL );
+   for( size_t k=0UL; k<nn; ++k )
+      v_[k] *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline void SymmetricPackedMatrix<Type,UF>::swap( SymmetricPackedMatrix& m ) /* throw() */
+{
+   std::swap( n_, m.n_ );
+   std::swap( capacity_, m.capacity_ );
+   std::swap( v_, m.v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting up the symmetric matrix from the given dense or sparse matrix.
+//
+// \param m The matrix to be converted.
+// \return \a true in case the given matrix is symmetric, \a false if not.
+//
+// This function copies the stored triangle of the given matrix. Expressions and matrices that
+// might alias with the symmetric matrix are evaluated into a temporary matrix first. In case
+// the given matrix is not symmetric, the function returns \a false and the symmetric matrix
+// remains unchanged.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+template< typename MT    // Type of the foreign matrix
+        , bool SO >      // Storage order of the foreign matrix
+bool SymmetricPackedMatrix<Type,UF>::initialize( const Matrix<MT,SO>& m )
+{
+   typedef typename SelectType< IsDenseMatrix<MT>::value, DynamicMatrix<Type,SO>
+                                                        , CompressedMatrix<Type,SO> >::Type  TmpType;
+
+   if( IsExpression<MT>::value || (~m).canAlias( this ) ) {
+      const TmpType tmp( ~m );
+      return initialize( tmp );
+   }
+
+   if( !IsSymmetric<MT>::value && !isSymmetric( ~m ) )
+      return false;
+
+   resize( (~m).rows(), false );
+   copyTriangle( ~m );
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copying the stored triangle of the given symmetric dense matrix.
+//
+// \param m The symmetric matrix to be copied.
+// \return void
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+template< typename MT    // Type of the foreign matrix
+        , bool SO >      // Storage order of the foreign matrix
+void SymmetricPackedMatrix<Type,UF>::copyTriangle( const DenseMatrix<MT,SO>& m )
+{
+   Type* element( v_ );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      const size_t jbegin( ( UF )?( i ):( 0UL ) );
+      const size_t jend  ( ( UF )?( n_ ):( i+1UL ) );
+      for( size_t j=jbegin; j<jend; ++j, ++element )
+         *element = (~m)(i,j);
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copying the stored triangle of the given symmetric row-major sparse matrix.
+//
+// \param m The symmetric matrix to be copied.
+// \return void
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+template< typename MT >  // Type of the foreign matrix
+void SymmetricPackedMatrix<Type,UF>::copyTriangle( const SparseMatrix<MT,false>& m )
+{
+   typedef typename MT::ConstIterator  RhsIterator;
+
+   reset();
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      const RhsIterator end( (~m).end(i) );
+      for( RhsIterator element=(~m).begin(i); element!=end; ++element ) {
+         if( isStored( i, element->index() ) )
+            v_[index(i,element->index())] = element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copying the stored triangle of the given symmetric column-major sparse matrix.
+//
+// \param m The symmetric matrix to be copied.
+// \return void
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+template< typename MT >  // Type of the foreign matrix
+void SymmetricPackedMatrix<Type,UF>::copyTriangle( const SparseMatrix<MT,true>& m )
+{
+   typedef typename MT::ConstIterator  RhsIterator;
+
+   reset();
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      const RhsIterator end( (~m).end(j) );
+      for( RhsIterator element=(~m).begin(j); element!=end; ++element ) {
+         if( isStored( element->index(), j ) )
+            v_[index(element->index(),j)] = element->value();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the element \f$ a_{ij} \f$ is part of the stored triangle.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return \a true in case the element is stored, \a false if it is mirrored.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline bool SymmetricPackedMatrix<Type,UF>::isStored( size_t i, size_t j ) const
+{
+   return ( UF )?( i <= j ):( j <= i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the stored part of row \a i within the packed array.
+//
+// \param i The index of the row.
+// \return The offset of the first stored element of row \a i.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline size_t SymmetricPackedMatrix<Type,UF>::offset( size_t i ) const
+{
+   return ( UF )?( i*(2UL*n_-i+1UL)/2UL ):( i*(i+1UL)/2UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the position of the element \f$ a_{ij} \f$ within the packed array.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return The position of the stored element \f$ a_{ij} \f$ or \f$ a_{ji} \f$, respectively.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline size_t SymmetricPackedMatrix<Type,UF>::index( size_t i, size_t j ) const
+{
+   if( !isStored( i, j ) )
+      std::swap( i, j );
+
+   return ( UF )?( offset(i) + j - i ):( offset(i) + j );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first stored element of row \a i.
+//
+// \param i The row index.
+// \return Pointer to the first stored element of row \a i.
+//
+// In case the upper triangle is stored, the stored part of row \a i consists of the elements
+// \f$ a_{ii} \ldots a_{i,N-1} \f$, otherwise of the elements \f$ a_{i0} \ldots a_{ii} \f$.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline typename SymmetricPackedMatrix<Type,UF>::ConstPointer
+   SymmetricPackedMatrix<Type,UF>::packedBegin( size_t i ) const
+{
+   BLAZE_INTERNAL_ASSERT( i < rows(), "Invalid row access index" );
+   return v_ + offset(i);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer just past the last stored element of row \a i.
+//
+// \param i The row index.
+// \return Pointer just past the last stored element of row \a i.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline typename SymmetricPackedMatrix<Type,UF>::ConstPointer
+   SymmetricPackedMatrix<Type,UF>::packedEnd( size_t i ) const
+{
+   BLAZE_INTERNAL_ASSERT( i < rows(), "Invalid row access index" );
+   return v_ + offset(i+1UL);
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the dense matrix
+        , bool UF >         // Upper triangle storage flag
+template< typename Other >  // Data type of the foreign expression
+inline bool SymmetricPackedMatrix<Type,UF>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the dense matrix
+        , bool UF >         // Upper triangle storage flag
+template< typename Other >  // Data type of the foreign expression
+inline bool SymmetricPackedMatrix<Type,UF>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a false.
+//
+// Since the rows of the packed triangle are not aligned in memory, this function always
+// returns \a false.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline bool SymmetricPackedMatrix<Type,UF>::isAligned() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline bool SymmetricPackedMatrix<Type,UF>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SYMMETRICPACKEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SymmetricPackedMatrix operators */
+//@{
+template< typename Type, bool UF >
+inline void reset( SymmetricPackedMatrix<Type,UF>& m );
+
+template< typename Type, bool UF >
+inline void reset( SymmetricPackedMatrix<Type,UF>& m, size_t i );
+
+template< typename Type, bool UF >
+inline void clear( SymmetricPackedMatrix<Type,UF>& m );
+
+template< typename Type, bool UF >
+inline bool isDefault( const SymmetricPackedMatrix<Type,UF>& m );
+
+template< typename Type, bool UF >
+inline void swap( SymmetricPackedMatrix<Type,UF>& a, SymmetricPackedMatrix<Type,UF>& b ) /* throw() */;
+
+template< typename Type, bool UF >
+inline void move( SymmetricPackedMatrix<Type,UF>& dst, SymmetricPackedMatrix<Type,UF>& src ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given symmetric packed matrix.
+// \ingroup symmetric_packed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline void reset( SymmetricPackedMatrix<Type,UF>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row and column of the given symmetric packed matrix.
+// \ingroup symmetric_packed_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline void reset( SymmetricPackedMatrix<Type,UF>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given symmetric packed matrix.
+// \ingroup symmetric_packed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline void clear( SymmetricPackedMatrix<Type,UF>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given symmetric packed matrix is in default state.
+// \ingroup symmetric_packed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline bool isDefault( const SymmetricPackedMatrix<Type,UF>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two symmetric packed matrices.
+// \ingroup symmetric_packed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline void swap( SymmetricPackedMatrix<Type,UF>& a, SymmetricPackedMatrix<Type,UF>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving the contents of one symmetric packed matrix to another.
+// \ingroup symmetric_packed_matrix
+//
+// \param dst The destination matrix.
+// \param src The source matrix.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the dense matrix
+        , bool UF >      // Upper triangle storage flag
+inline void move( SymmetricPackedMatrix<Type,UF>& dst, SymmetricPackedMatrix<Type,UF>& src ) /* throw() */
+{
+   dst.swap( src );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSQUARE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool UF >
+struct IsSquare< SymmetricPackedMatrix<T,UF> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSYMMETRIC SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool UF >
+struct IsSymmetric< SymmetricPackedMatrix<T,UF> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool UF >
+struct IsResizable< SymmetricPackedMatrix<T,UF> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASPACKEDSTORAGE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool UF >
+struct HasPackedStorage< SymmetricPackedMatrix<T,UF> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+
+template< typename T, bool UF, bool AF >
+struct HasPackedStorage< DenseSubmatrix<SymmetricPackedMatrix<T,UF>,AF,false> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+
+template< typename T, bool UF, bool AF >
+struct HasPackedStorage< DenseSubmatrix<const SymmetricPackedMatrix<T,UF>,AF,false> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool UF, typename T2, bool SO >
+struct AddTrait< SymmetricPackedMatrix<T1,UF>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool SO, typename T2, bool UF >
+struct AddTrait< DynamicMatrix<T1,SO>, SymmetricPackedMatrix<T2,UF> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool UF, typename T2, bool SO, typename IT >
+struct AddTrait< SymmetricPackedMatrix<T1,UF>, CompressedMatrix<T2,SO,IT> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename IT, typename T2, bool UF >
+struct AddTrait< CompressedMatrix<T1,SO,IT>, SymmetricPackedMatrix<T2,UF> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool UF1, typename T2, bool UF2 >
+struct AddTrait< SymmetricPackedMatrix<T1,UF1>, SymmetricPackedMatrix<T2,UF2> >
+{
+   typedef SymmetricPackedMatrix< typename AddTrait<T1,T2>::Type, UF1 >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool UF, typename T2, bool SO >
+struct SubTrait< SymmetricPackedMatrix<T1,UF>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool SO, typename T2, bool UF >
+struct SubTrait< DynamicMatrix<T1,SO>, SymmetricPackedMatrix<T2,UF> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool UF, typename T2, bool SO, typename IT >
+struct SubTrait< SymmetricPackedMatrix<T1,UF>, CompressedMatrix<T2,SO,IT> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename IT, typename T2, bool UF >
+struct SubTrait< CompressedMatrix<T1,SO,IT>, SymmetricPackedMatrix<T2,UF> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool UF1, typename T2, bool UF2 >
+struct SubTrait< SymmetricPackedMatrix<T1,UF1>, SymmetricPackedMatrix<T2,UF2> >
+{
+   typedef SymmetricPackedMatrix< typename SubTrait<T1,T2>::Type, UF1 >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool UF, typename T2 >
+struct MultTrait< SymmetricPackedMatrix<T1,UF>, T2 >
+{
+   typedef SymmetricPackedMatrix< typename MultTrait<T1,T2>::Type, UF >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+
+template< typename T1, typename T2, bool UF >
+struct MultTrait< T1, SymmetricPackedMatrix<T2,UF> >
+{
+   typedef SymmetricPackedMatrix< typename MultTrait<T1,T2>::Type, UF >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
+};
+
+template< typename T1, bool UF, typename T2, size_t N >
+struct MultTrait< SymmetricPackedMatrix<T1,UF>, StaticVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, bool UF >
+struct MultTrait< StaticVector<T1,N,true>, SymmetricPackedMatrix<T2,UF> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool UF, typename T2, size_t N >
+struct MultTrait< SymmetricPackedMatrix<T1,UF>, HybridVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, bool UF >
+struct MultTrait< HybridVector<T1,N,true>, SymmetricPackedMatrix<T2,UF> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool UF, typename T2 >
+struct MultTrait< SymmetricPackedMatrix<T1,UF>, DynamicVector<T2,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2, bool UF >
+struct MultTrait< DynamicVector<T1,true>, SymmetricPackedMatrix<T2,UF> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool UF, typename T2, typename IT >
+struct MultTrait< SymmetricPackedMatrix<T1,UF>, CompressedVector<T2,false,IT> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename IT, typename T2, bool UF >
+struct MultTrait< CompressedVector<T1,true,IT>, SymmetricPackedMatrix<T2,UF> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool UF, typename T2, bool SO >
+struct MultTrait< SymmetricPackedMatrix<T1,UF>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, bool UF >
+struct MultTrait< DynamicMatrix<T1,SO>, SymmetricPackedMatrix<T2,UF> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool UF, typename T2, bool SO, typename IT >
+struct MultTrait< SymmetricPackedMatrix<T1,UF>, CompressedMatrix<T2,SO,IT> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename IT, typename T2, bool UF >
+struct MultTrait< CompressedMatrix<T1,SO,IT>, SymmetricPackedMatrix<T2,UF> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool UF1, typename T2, bool UF2 >
+struct MultTrait< SymmetricPackedMatrix<T1,UF1>, SymmetricPackedMatrix<T2,UF2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool UF, typename T2 >
+struct DivTrait< SymmetricPackedMatrix<T1,UF>, T2 >
+{
+   typedef SymmetricPackedMatrix< typename DivTrait<T1,T2>::Type, UF >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATHTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool UF1, typename T2, bool UF2 >
+struct MathTrait< SymmetricPackedMatrix<T1,UF1>, SymmetricPackedMatrix<T2,UF2> >
+{
+   typedef SymmetricPackedMatrix< typename MathTrait<T1,T2>::HighType, UF1 >  HighType;
+   typedef SymmetricPackedMatrix< typename MathTrait<T1,T2>::LowType , UF1 >  LowType;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool UF >
+struct SubmatrixTrait< SymmetricPackedMatrix<T1,UF> >
+{
+   typedef DynamicMatrix<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool UF >
+struct RowTrait< SymmetricPackedMatrix<T1,UF> >
+{
+   typedef DynamicVector<T1,true>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool UF >
+struct ColumnTrait< SymmetricPackedMatrix<T1,UF> >
+{
+   typedef DynamicVector<T1,false>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,887 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/TriangularPackedProxy.h
+//  \brief Header file for the TriangularPackedProxy class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_TRIANGULARPACKEDPROXY_H_
+#define _BLAZE_MATH_DENSE_TRIANGULARPACKEDPROXY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <ostream>
+#include <stdexcept>
+#include <blaze/math/proxy/Proxy.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access proxy for the elements of a TriangularPackedMatrix.
+// \ingroup triangular_packed_matrix
+//
+// The TriangularPackedProxy provides controlled access to the elements of a non-const
+// TriangularPackedMatrix. Since only the elements of the non-zero triangle are stored, the
+// proxy refers either to a stored element or, in case it represents an element of the zero
+// triangle, to a constant zero value. Any attempt to modify an element of the zero triangle
+// results in a \a std::invalid_argument exception:
+
+   \code
+   // Creating a 3x3 lower triangular packed matrix
+   blaze::TriangularPackedMatrix<int,false> A( 3UL );
+
+   A(0,0) = -2;  //        ( -2 0 0 )
+   A(1,0) =  3;  // => A = (  3 0 0 )
+   A(2,1) =  5;  //        (  0 5 0 )
+
+   A(0,2) =  7;  // Invalid assignment to upper matrix element; results in an exception!
+   \endcode
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool UF >      // Upper triangular flag
+class TriangularPackedProxy : public Proxy< TriangularPackedProxy<Type,UF>, Type >
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef Type         RepresentedType;  //!< Type of the represented matrix element.
+   typedef const Type&  RawReference;     //!< Reference to the represented element.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline TriangularPackedProxy( Type* value, const Type& zero );
+            inline TriangularPackedProxy( const TriangularPackedProxy& tp );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                          inline const TriangularPackedProxy& operator= ( const TriangularPackedProxy& tp ) const;
+   template< typename T > inline const TriangularPackedProxy& operator= ( const T& value ) const;
+   template< typename T > inline const TriangularPackedProxy& operator+=( const T& value ) const;
+   template< typename T > inline const TriangularPackedProxy& operator-=( const T& value ) const;
+   template< typename T > inline const TriangularPackedProxy& operator*=( const T& value ) const;
+   template< typename T > inline const TriangularPackedProxy& operator/=( const T& value ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline RawReference get()          const;
+   inline bool         isRestricted() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator RawReference() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void checkAccess() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Type* const       value_;  //!< Pointer to the accessed stored matrix element.
+                              /*!< The pointer is \a NULL in case the proxy represents an
+                                   element of the zero triangle of the matrix. */
+   const Type* const zero_;   //!< Pointer to the zero element of the matrix.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization constructor for a TriangularPackedProxy.
+//
+// \param value Pointer to the accessed stored element (\a NULL for elements of the zero triangle).
+// \param zero Reference to the zero element of the matrix.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool UF >      // Upper triangular flag
+inline TriangularPackedProxy<Type,UF>::TriangularPackedProxy( Type* value, const Type& zero )
+   : value_( value )  // Pointer to the accessed stored matrix element
+   , zero_ ( &zero )  // Pointer to the zero element of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for TriangularPackedProxy.
+//
+// \param tp Triangular packed proxy to be copied.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool UF >      // Upper triangular flag
+inline TriangularPackedProxy<Type,UF>::TriangularPackedProxy( const TriangularPackedProxy& tp )
+   : value_( tp.value_ )  // Pointer to the accessed stored matrix element
+   , zero_ ( tp.zero_  )  // Pointer to the zero element of the matrix
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for TriangularPackedProxy.
+//
+// \param tp Triangular packed proxy to be copied.
+// \return Reference to the assigned proxy.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool UF >      // Upper triangular flag
+inline const TriangularPackedProxy<Type,UF>& TriangularPackedProxy<Type,UF>::operator=( const TriangularPackedProxy& tp ) const
+{
+   checkAccess();
+
+   *value_ = tp.get();
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment to the accessed matrix element.
+//
+// \param value The new value of the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to lower/upper matrix element.
+//
+// In case the proxy represents an element of the zero triangle of the matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool UF >      // Upper triangular flag
+template< typename T >   // Type of the right-hand side value
+inline const TriangularPackedProxy<Type,UF>& TriangularPackedProxy<Type,UF>::operator=( const T& value ) const
+{
+   checkAccess();
+
+   *value_ = value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment to the accessed matrix element.
+//
+// \param value The right-hand side value to be added to the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to lower/upper matrix element.
+//
+// In case the proxy represents an element of the zero triangle of the matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool UF >      // Upper triangular flag
+template< typename T >   // Type of the right-hand side value
+inline const TriangularPackedProxy<Type,UF>& TriangularPackedProxy<Type,UF>::operator+=( const T& value ) const
+{
+   checkAccess();
+
+   *value_ += value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment to the accessed matrix element.
+//
+// \param value The right-hand side value to be subtracted from the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to lower/upper matrix element.
+//
+// In case the proxy represents an element of the zero triangle of the matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool UF >      // Upper triangular flag
+template< typename T >   // Type of the right-hand side value
+inline const TriangularPackedProxy<Type,UF>& TriangularPackedProxy<Type,UF>::operator-=( const T& value ) const
+{
+   checkAccess();
+
+   *value_ -= value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment to the accessed matrix element.
+//
+// \param value The right-hand side value for the multiplication.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to lower/upper matrix element.
+//
+// In case the proxy represents an element of the zero triangle of the matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool UF >      // Upper triangular flag
+template< typename T >   // Type of the right-hand side value
+inline const TriangularPackedProxy<Type,UF>& TriangularPackedProxy<Type,UF>::operator*=( const T& value ) const
+{
+   checkAccess();
+
+   *value_ *= value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment to the accessed matrix element.
+//
+// \param value The right-hand side value for the division.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to lower/upper matrix element.
+//
+// In case the proxy represents an element of the zero triangle of the matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool UF >      // Upper triangular flag
+template< typename T >   // Type of the right-hand side value
+inline const TriangularPackedProxy<Type,UF>& TriangularPackedProxy<Type,UF>::operator/=( const T& value ) const
+{
+   checkAccess();
+
+   *value_ /= value;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returning the value of the accessed matrix element.
+//
+// \return Direct/raw reference to the accessed matrix element.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool UF >      // Upper triangular flag
+inline typename TriangularPackedProxy<Type,UF>::RawReference TriangularPackedProxy<Type,UF>::get() const
+{
+   return ( value_ != NULL )?( *value_ ):( *zero_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the proxy represents a restricted matrix element..
+//
+// \return \a true in case access to the matrix element is restricted, \a false if not.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool UF >      // Upper triangular flag
+inline bool TriangularPackedProxy<Type,UF>::isRestricted() const
+{
+   return value_ == NULL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks the access to the represented matrix element.
+//
+// \return void
+// \exception std::invalid_argument Invalid assignment to lower/upper matrix element.
+//
+// In case the proxy represents an element of the zero triangle of the matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool UF >      // Upper triangular flag
+inline void TriangularPackedProxy<Type,UF>::checkAccess() const
+{
+   if( isRestricted() ) {
+      if( UF )
+         throw std::invalid_argument( "Invalid assignment to lower matrix element" );
+      else
+         throw std::invalid_argument( "Invalid assignment to upper matrix element" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion to the accessed matrix element.
+//
+// \return Direct/raw reference to the accessed matrix element.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool UF >      // Upper triangular flag
+inline TriangularPackedProxy<Type,UF>::operator RawReference() const
+{
+   return get();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name TriangularPackedProxy operators */
+//@{
+template< typename T1, bool UF1, typename T2, bool UF2 >
+inline bool operator==( const TriangularPackedProxy<T1,UF1>& lhs, const TriangularPackedProxy<T2,UF2>& rhs );
+
+template< typename Type, bool UF, typename T >
+inline bool operator==( const TriangularPackedProxy<Type,UF>& lhs, const T& rhs );
+
+template< typename T, typename Type, bool UF >
+inline bool operator==( const T& lhs, const TriangularPackedProxy<Type,UF>& rhs );
+
+template< typename T1, bool UF1, typename T2, bool UF2 >
+inline bool operator!=( const TriangularPackedProxy<T1,UF1>& lhs, const TriangularPackedProxy<T2,UF2>& rhs );
+
+template< typename Type, bool UF, typename T >
+inline bool operator!=( const TriangularPackedProxy<Type,UF>& lhs, const T& rhs );
+
+template< typename T, typename Type, bool UF >
+inline bool operator!=( const T& lhs, const TriangularPackedProxy<Type,UF>& rhs );
+
+template< typename T1, bool UF1, typename T2, bool UF2 >
+inline bool operator<( const TriangularPackedProxy<T1,UF1>& lhs, const TriangularPackedProxy<T2,UF2>& rhs );
+
+template< typename Type, bool UF, typename T >
+inline bool operator<( const TriangularPackedProxy<Type,UF>& lhs, const T& rhs );
+
+template< typename T, typename Type, bool UF >
+inline bool operator<( const T& lhs, const TriangularPackedProxy<Type,UF>& rhs );
+
+template< typename T1, bool UF1, typename T2, bool UF2 >
+inline bool operator>( const TriangularPackedProxy<T1,UF1>& lhs, const TriangularPackedProxy<T2,UF2>& rhs );
+
+template< typename Type, bool UF, typename T >
+inline bool operator>( const TriangularPackedProxy<Type,UF>& lhs, const T& rhs );
+
+template< typename T, typename Type, bool UF >
+inline bool operator>( const T& lhs, const TriangularPackedProxy<Type,UF>& rhs );
+
+template< typename T1, bool UF1, typename T2, bool UF2 >
+inline bool operator<=( const TriangularPackedProxy<T1,UF1>& lhs, const TriangularPackedProxy<T2,UF2>& rhs );
+
+template< typename Type, bool UF, typename T >
+inline bool operator<=( const TriangularPackedProxy<Type,UF>& lhs, const T& rhs );
+
+template< typename T, typename Type, bool UF >
+inline bool operator<=( const T& lhs, const TriangularPackedProxy<Type,UF>& rhs );
+
+template< typename T1, bool UF1, typename T2, bool UF2 >
+inline bool operator>=( const TriangularPackedProxy<T1,UF1>& lhs, const TriangularPackedProxy<T2,UF2>& rhs );
+
+template< typename Type, bool UF, typename T >
+inline bool operator>=( const TriangularPackedProxy<Type,UF>& lhs, const T& rhs );
+
+template< typename T, typename Type, bool UF >
+inline bool operator>=( const T& lhs, const TriangularPackedProxy<Type,UF>& rhs );
+
+template< typename Type, bool UF >
+inline std::ostream& operator<<( std::ostream& os, const TriangularPackedProxy<Type,UF>& proxy );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two TriangularPackedProxy objects.
+// \ingroup triangular_packed_matrix
+//
+// \param lhs The left-hand side TriangularPackedProxy object.
+// \param rhs The right-hand side TriangularPackedProxy object.
+// \return \a true if both referenced values are equal, \a false if they are not.
+*/
+template< typename T1, bool UF1, typename T2, bool UF2 >
+inline bool operator==( const TriangularPackedProxy<T1,UF1>& lhs, const TriangularPackedProxy<T2,UF2>& rhs )
+{
+   return ( lhs.get() == rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between a TriangularPackedProxy object and an object of different type.
+// \ingroup triangular_packed_matrix
+//
+// \param lhs The left-hand side TriangularPackedProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the referenced value and the other object are equal, \a false if they are not.
+*/
+template< typename Type, bool UF, typename T >
+inline bool operator==( const TriangularPackedProxy<Type,UF>& lhs, const T& rhs )
+{
+   return ( lhs.get() == rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between an object of different type and a TriangularPackedProxy object.
+// \ingroup triangular_packed_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side TriangularPackedProxy object.
+// \return \a true if the other object and the referenced value are equal, \a false if they are not.
+*/
+template< typename T, typename Type, bool UF >
+inline bool operator==( const T& lhs, const TriangularPackedProxy<Type,UF>& rhs )
+{
+   return ( lhs == rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two TriangularPackedProxy objects.
+// \ingroup triangular_packed_matrix
+//
+// \param lhs The left-hand side TriangularPackedProxy object.
+// \param rhs The right-hand side TriangularPackedProxy object.
+// \return \a true if both referenced values are not equal, \a false if they are.
+*/
+template< typename T1, bool UF1, typename T2, bool UF2 >
+inline bool operator!=( const TriangularPackedProxy<T1,UF1>& lhs, const TriangularPackedProxy<T2,UF2>& rhs )
+{
+   return ( lhs.get() != rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between a TriangularPackedProxy object and an object of different type.
+// \ingroup triangular_packed_matrix
+//
+// \param lhs The left-hand side TriangularPackedProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the referenced value and the other object are not equal, \a false if they are.
+*/
+template< typename Type, bool UF, typename T >
+inline bool operator!=( const TriangularPackedProxy<Type,UF>& lhs, const T& rhs )
+{
+   return ( lhs.get() != rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inquality comparison between an object of different type and a TriangularPackedProxy object.
+// \ingroup triangular_packed_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side TriangularPackedProxy object.
+// \return \a true if the other object and the referenced value are not equal, \a false if they are.
+*/
+template< typename T, typename Type, bool UF >
+inline bool operator!=( const T& lhs, const TriangularPackedProxy<Type,UF>& rhs )
+{
+   return ( lhs != rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between two TriangularPackedProxy objects.
+// \ingroup triangular_packed_matrix
+//
+// \param lhs The left-hand side TriangularPackedProxy object.
+// \param rhs The right-hand side TriangularPackedProxy object.
+// \return \a true if the left-hand side referenced value is smaller, \a false if not.
+*/
+template< typename T1, bool UF1, typename T2, bool UF2 >
+inline bool operator<( const TriangularPackedProxy<T1,UF1>& lhs, const TriangularPackedProxy<T2,UF2>& rhs )
+{
+   return ( lhs.get() < rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between a TriangularPackedProxy object and an object of different type.
+// \ingroup triangular_packed_matrix
+//
+// \param lhs The left-hand side TriangularPackedProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is smaller, \a false if not.
+*/
+template< typename Type, bool UF, typename T >
+inline bool operator<( const TriangularPackedProxy<Type,UF>& lhs, const T& rhs )
+{
+   return ( lhs.get() < rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between an object of different type and a TriangularPackedProxy object.
+// \ingroup triangular_packed_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side TriangularPackedProxy object.
+// \return \a true if the left-hand side other object is smaller, \a false if not.
+*/
+template< typename T, typename Type, bool UF >
+inline bool operator<( const T& lhs, const TriangularPackedProxy<Type,UF>& rhs )
+{
+   return ( lhs < rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between two TriangularPackedProxy objects.
+// \ingroup triangular_packed_matrix
+//
+// \param lhs The left-hand side TriangularPackedProxy object.
+// \param rhs The right-hand side TriangularPackedProxy object.
+// \return \a true if the left-hand side referenced value is greater, \a false if not.
+*/
+template< typename T1, bool UF1, typename T2, bool UF2 >
+inline bool operator>( const TriangularPackedProxy<T1,UF1>& lhs, const TriangularPackedProxy<T2,UF2>& rhs )
+{
+   return ( lhs.get() > rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between a TriangularPackedProxy object and an object of different type.
+// \ingroup triangular_packed_matrix
+//
+// \param lhs The left-hand side TriangularPackedProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is greater, \a false if not.
+*/
+template< typename Type, bool UF, typename T >
+inline bool operator>( const TriangularPackedProxy<Type,UF>& lhs, const T& rhs )
+{
+   return ( lhs.get() > rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between an object of different type and a TriangularPackedProxy object.
+// \ingroup triangular_packed_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side TriangularPackedProxy object.
+// \return \a true if the left-hand side other object is greater, \a false if not.
+*/
+template< typename T, typename Type, bool UF >
+inline bool operator>( const T& lhs, const TriangularPackedProxy<Type,UF>& rhs )
+{
+   return ( lhs > rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between two TriangularPackedProxy objects.
+// \ingroup triangular_packed_matrix
+//
+// \param lhs The left-hand side TriangularPackedProxy object.
+// \param rhs The right-hand side TriangularPackedProxy object.
+// \return \a true if the left-hand side referenced value is smaller or equal, \a false if not.
+*/
+template< typename T1, bool UF1, typename T2, bool UF2 >
+inline bool operator<=( const TriangularPackedProxy<T1,UF1>& lhs, const TriangularPackedProxy<T2,UF2>& rhs )
+{
+   return ( lhs.get() <= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between a TriangularPackedProxy object and an object of different type.
+// \ingroup triangular_packed_matrix
+//
+// \param lhs The left-hand side TriangularPackedProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is smaller or equal, \a false if not.
+*/
+template< typename Type, bool UF, typename T >
+inline bool operator<=( const TriangularPackedProxy<Type,UF>& lhs, const T& rhs )
+{
+   return ( lhs.get() <= rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between an object of different type and a TriangularPackedProxy object.
+// \ingroup triangular_packed_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side TriangularPackedProxy object.
+// \return \a true if the left-hand side other object is smaller or equal, \a false if not.
+*/
+template< typename T, typename Type, bool UF >
+inline bool operator<=( const T& lhs, const TriangularPackedProxy<Type,UF>& rhs )
+{
+   return ( lhs <= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between two TriangularPackedProxy objects.
+// \ingroup triangular_packed_matrix
+//
+// \param lhs The left-hand side TriangularPackedProxy object.
+// \param rhs The right-hand side TriangularPackedProxy object.
+// \return \a true if the left-hand side referenced value is greater or equal, \a false if not.
+*/
+template< typename T1, bool UF1, typename T2, bool UF2 >
+inline bool operator>=( const TriangularPackedProxy<T1,UF1>& lhs, const TriangularPackedProxy<T2,UF2>& rhs )
+{
+   return ( lhs.get() >= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between a TriangularPackedProxy object and an object of different type.
+// \ingroup triangular_packed_matrix
+//
+// \param lhs The left-hand side TriangularPackedProxy object.
+// \param rhs The right-hand side object of other type.
+// \return \a true if the left-hand side referenced value is greater or equal, \a false if not.
+*/
+template< typename Type, bool UF, typename T >
+inline bool operator>=( const TriangularPackedProxy<Type,UF>& lhs, const T& rhs )
+{
+   return ( lhs.get() >= rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between an object of different type and a TriangularPackedProxy object.
+// \ingroup triangular_packed_matrix
+//
+// \param lhs The left-hand side object of other type.
+// \param rhs The right-hand side TriangularPackedProxy object.
+// \return \a true if the left-hand side other object is greater or equal, \a false if not.
+*/
+template< typename T, typename Type, bool UF >
+inline bool operator>=( const T& lhs, const TriangularPackedProxy<Type,UF>& rhs )
+{
+   return ( lhs >= rhs.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Global output operator for proxies on triangular packed matrices.
+// \ingroup triangular_packed_matrix
+//
+// \param os Reference to the output stream.
+// \param proxy Reference to a constant proxy object.
+// \return Reference to the output stream.
+*/
+template< typename Type, bool UF >
+inline std::ostream& operator<<( std::ostream& os, const TriangularPackedProxy<Type,UF>& proxy )
+{
+   return os << proxy.get();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name TriangularPackedProxy global functions */
+//@{
+template< typename Type, bool UF >
+inline void reset( const TriangularPackedProxy<Type,UF>& proxy );
+
+template< typename Type, bool UF >
+inline void clear( const TriangularPackedProxy<Type,UF>& proxy );
+
+template< typename Type, bool UF >
+inline bool isDefault( const TriangularPackedProxy<Type,UF>& proxy );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the represented element to the default initial values.
+// \ingroup triangular_packed_matrix
+//
+// \param proxy The given access proxy.
+// \return void
+//
+// This function resets the element represented by the access proxy to its default initial
+// value.
+*/
+template< typename Type, bool UF >
+inline void reset( const TriangularPackedProxy<Type,UF>& proxy )
+{
+   using blaze::reset;
+
+   reset( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the represented element.
+// \ingroup triangular_packed_matrix
+//
+// \param proxy The given access proxy.
+// \return void
+//
+// This function clears the element represented by the access proxy to its default initial
+// state.
+*/
+template< typename Type, bool UF >
+inline void clear( const TriangularPackedProxy<Type,UF>& proxy )
+{
+   using blaze::clear;
+
+   clear( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the represented element is in default state.
+// \ingroup triangular_packed_matrix
+//
+// \param proxy The given access proxy
+// \return \a true in case the represented element is in default state, \a false otherwise.
+//
+// This function checks whether the element represented by the access proxy is in default state.
+// In case it is in default state, the function returns \a true, otherwise it returns \a false.
+*/
+template< typename Type, bool UF >
+inline bool isDefault( const TriangularPackedProxy<Type,UF>& proxy )
+{
+   using blaze::isDefault;
+
+   return isDefault( proxy.get() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
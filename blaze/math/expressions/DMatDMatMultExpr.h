@@ -68,7 +68,9 @@
 #include <blaze/math/traits/TSVecDMatMultExprTrait.h>
 #include <blaze/math/typetraits/Columns.h>
 #include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasDiagonalStorage.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/HasPackedStorage.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsColumnVector.h>
 #include <blaze/math/typetraits/IsComputation.h>
@@ -90,6 +92,7 @@
 #include <blaze/math/typetraits/IsUniUpper.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/Rows.h>
+#include <blaze/math/views/Forward.h>
 #include <blaze/system/BLAS.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
@@ -111,6 +114,7 @@
 #include <blaze/util/typetraits/IsFloat.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/Unused.h>
 #include <blaze/util/valuetraits/IsTrue.h>
 
 
@@ -302,6 +306,52 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the left-hand side dense matrix is a symmetric or triangular matrix that stores a
+       single triangle in packed format, the nested \a value will be set to 1 and the packed
+       kernel is selected. Otherwise it will be 0. */
+   template< typename T1 >
+   struct UsePackedKernel {
+      enum { value = HasPackedStorage<T1>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case either of the two dense matrix operands is a diagonal matrix that only stores its
+       diagonal elements, the nested \a value will be set to 1 and the multiplication is computed
+       by means of the row or column scaling kernels. Otherwise it will be 0. */
+   template< typename T1, typename T2 >
+   struct UseDiagonalKernel {
+      enum { value = !HasPackedStorage<T1>::value &&
+                     ( HasDiagonalStorage<T1>::value || HasDiagonalStorage<T2>::value ) };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the row-major target matrix, the row-major dense matrix operand, and the vector of
+       diagonal elements are suited for a vectorized computation of the row or column scaling, the
+       nested \value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseVectorizedScalingKernel {
+      enum { value = IsRowMajorMatrix<T1>::value && IsRowMajorMatrix<T2>::value &&
+                     T1::vectorizable && T2::vectorizable && T3::vectorizable &&
+                     IsSame<typename T1::ElementType,typename T2::ElementType>::value &&
+                     IsSame<typename T1::ElementType,typename T3::ElementType>::value &&
+                     IntrinsicTrait<typename T1::ElementType>::addition &&
+                     IntrinsicTrait<typename T1::ElementType>::subtraction &&
+                     IntrinsicTrait<typename T1::ElementType>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef DMatDMatMultExpr<MT1,MT2>                   This;           //!< Type of this DMatDMatMultExpr instance.
@@ -560,7 +610,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline void selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   static inline typename DisableIf< Or< UsePackedKernel<MT4>, UseDiagonalKernel<MT4,MT5> > >::Type
+      selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal<MT5>::value ) ||
           ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
@@ -1600,6 +1651,217 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
 #endif
    //**********************************************************************************************
 
+   //**Packed assignment to dense matrices*********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a packed dense matrix-dense matrix multiplication (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays the assignment of a symmetric or triangular matrix storing a single
+   // triangle in packed format to the packed kernel.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UsePackedKernel<MT4> >::Type
+      selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      DMatDMatMultExpr::packedAssignKernel( C, A, B, 0UL, A.rows(), 0UL, A.columns() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Packed assignment to dense matrices (submatrices)*******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a packed dense submatrix-dense matrix multiplication (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side dense submatrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function handles submatrices of a packed symmetric or triangular matrix, which for
+   // instance result from the splitting of the multiplication during SMP assignments. The packed
+   // kernel is applied to the according range of rows and columns of the underlying matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the underlying dense matrix
+           , bool AF         // Alignment flag of the submatrix
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UsePackedKernel< DenseSubmatrix<MT4,AF,false> > >::Type
+      selectAssignKernel( MT3& C, const DenseSubmatrix<MT4,AF,false>& A, const MT5& B )
+   {
+      DMatDMatMultExpr::packedAssignKernel( C, A.operand(), B, A.row(), A.row()+A.rows()
+                                           , A.column(), A.column()+A.columns() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Packed assignment kernel********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment kernel for a block of a packed dense matrix (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side packed symmetric or triangular matrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \param rbegin The index of the first row of \a A to be considered.
+   // \param rend The index one past the last row of \a A to be considered.
+   // \param cbegin The index of the first column of \a A to be considered.
+   // \param cend The index one past the last column of \a A to be considered.
+   // \return void
+   //
+   // This function computes the product of the block \f$ [rbegin..rend) \times [cbegin..cend) \f$
+   // of \a A and \a B by means of the according addition assignment kernel.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline void packedAssignKernel( MT3& C, const MT4& A, const MT5& B,
+                                          size_t rbegin, size_t rend, size_t cbegin, size_t cend )
+   {
+      reset( C );
+
+      DMatDMatMultExpr::packedAddAssignKernel( C, A, B, rbegin, rend, cbegin, cend );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal assignment to dense matrices*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix-dense matrix multiplication with a compact diagonal
+   //        matrix operand (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays the assignment of a multiplication with a diagonal matrix that only
+   // stores its diagonal elements to the according row or column scaling kernel.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseDiagonalKernel<MT4,MT5> >::Type
+      selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      reset( C );
+
+      DMatDMatMultExpr::selectScalingAddAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the vector of diagonal elements of a compact diagonal matrix operand.
+   // \ingroup dense_matrix
+   //
+   // \param A The compact diagonal matrix operand.
+   // \return Reference to the vector of diagonal elements.
+   */
+   template< typename MT >  // Type of the diagonal matrix operand
+   static inline const typename MT::DiagonalType& diagonalOf( const MT& A )
+   {
+      return A.diagonal();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the vector of diagonal elements of the matrix underlying a dense submatrix.
+   // \ingroup dense_matrix
+   //
+   // \param A The dense submatrix of a compact diagonal matrix.
+   // \return Reference to the vector of diagonal elements of the underlying matrix.
+   */
+   template< typename MT  // Type of the underlying diagonal matrix
+           , bool AF >    // Alignment flag of the submatrix
+   static inline const typename MT::DiagonalType&
+      diagonalOf( const DenseSubmatrix<MT,AF,false>& A )
+   {
+      return A.operand().diagonal();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first row of a compact diagonal matrix operand.
+   // \ingroup dense_matrix
+   //
+   // \param A The compact diagonal matrix operand.
+   // \return The row offset of the operand within the diagonal matrix (always 0).
+   */
+   template< typename MT >  // Type of the diagonal matrix operand
+   static inline size_t diagonalRow( const MT& A )
+   {
+      UNUSED_PARAMETER( A );
+      return 0UL;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first row of a dense submatrix of a compact diagonal matrix.
+   // \ingroup dense_matrix
+   //
+   // \param A The dense submatrix of a compact diagonal matrix.
+   // \return The row offset of the submatrix within the underlying diagonal matrix.
+   */
+   template< typename MT  // Type of the underlying diagonal matrix
+           , bool AF >    // Alignment flag of the submatrix
+   static inline size_t diagonalRow( const DenseSubmatrix<MT,AF,false>& A )
+   {
+      return A.row();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first column of a compact diagonal matrix operand.
+   // \ingroup dense_matrix
+   //
+   // \param A The compact diagonal matrix operand.
+   // \return The column offset of the operand within the diagonal matrix (always 0).
+   */
+   template< typename MT >  // Type of the diagonal matrix operand
+   static inline size_t diagonalColumn( const MT& A )
+   {
+      UNUSED_PARAMETER( A );
+      return 0UL;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first column of a dense submatrix of a compact diagonal
+   //        matrix.
+   // \ingroup dense_matrix
+   //
+   // \param A The dense submatrix of a compact diagonal matrix.
+   // \return The column offset of the submatrix within the underlying diagonal matrix.
+   */
+   template< typename MT  // Type of the underlying diagonal matrix
+           , bool AF >    // Alignment flag of the submatrix
+   static inline size_t diagonalColumn( const DenseSubmatrix<MT,AF,false>& A )
+   {
+      return A.column();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse matrices***************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense matrix-dense matrix multiplication to a sparse matrix
@@ -1730,7 +1992,8 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline void selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   static inline typename DisableIf< Or< UsePackedKernel<MT4>, UseDiagonalKernel<MT4,MT5> > >::Type
+      selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       if( ( IsDiagonal<MT5>::value ) ||
           ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
@@ -2792,130 +3055,115 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Addition assignment to sparse matrices******************************************************
-   // No special implementation for the addition assignment to sparse matrices.
-   //**********************************************************************************************
-
-   //**Subtraction assignment to dense matrices****************************************************
+   //**Packed addition assignment to dense matrices************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Subtraction assignment of a dense matrix-dense matrix multiplication to a
-   //        dense matrix (\f$ C-=A*B \f$).
+   /*!\brief Addition assignment of a packed dense matrix-dense matrix multiplication (\f$ C+=A*B \f$).
    // \ingroup dense_matrix
    //
-   // \param lhs The target left-hand side dense matrix.
-   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function implements the performance optimized subtraction assignment of a dense matrix-
-   // dense matrix multiplication expression to a dense matrix.
+   // This function relays the addition assignment of a symmetric or triangular matrix storing a
+   // single triangle in packed format to the packed kernel.
    */
-   template< typename MT  // Type of the target dense matrix
-           , bool SO >    // Storage order of the target dense matrix
-   friend inline typename DisableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
-      subAssign( DenseMatrix<MT,SO>& lhs, const DMatDMatMultExpr& rhs )
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UsePackedKernel<MT4> >::Type
+      selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      BLAZE_FUNCTION_TRACE;
-
-      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
-      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
-
-      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL || rhs.lhs_.columns() == 0UL ) {
-         return;
-      }
-
-      LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
-      RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
-
-      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
-      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
-      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
-      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
-      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
-      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
-
-      DMatDMatMultExpr::selectSubAssignKernel( ~lhs, A, B );
+      DMatDMatMultExpr::packedAddAssignKernel( C, A, B, 0UL, A.rows(), 0UL, A.columns() );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Subtraction assignment to dense matrices (kernel selection)*********************************
+   //**Packed addition assignment to dense matrices (submatrices)**********************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Selection of the kernel for a subtraction assignment of a dense matrix-dense matrix
-   //        multiplication to a dense matrix (\f$ C-=A*B \f$).
+   /*!\brief Addition assignment of a packed dense submatrix-dense matrix multiplication (\f$ C+=A*B \f$).
    // \ingroup dense_matrix
    //
    // \param C The target left-hand side dense matrix.
-   // \param A The left-hand side multiplication operand.
+   // \param A The left-hand side dense submatrix operand.
    // \param B The right-hand side multiplication operand.
    // \return void
+   //
+   // This function handles submatrices of a packed symmetric or triangular matrix, which for
+   // instance result from the splitting of the multiplication during SMP assignments. The packed
+   // kernel is applied to the according range of rows and columns of the underlying matrix.
    */
    template< typename MT3    // Type of the left-hand side target matrix
-           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT4    // Type of the underlying dense matrix
+           , bool AF         // Alignment flag of the submatrix
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline void selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   static inline typename EnableIf< UsePackedKernel< DenseSubmatrix<MT4,AF,false> > >::Type
+      selectAddAssignKernel( MT3& C, const DenseSubmatrix<MT4,AF,false>& A, const MT5& B )
    {
-      if( ( IsDiagonal<MT5>::value ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
-         selectSmallSubAssignKernel( C, A, B );
-      else
-         selectBlasSubAssignKernel( C, A, B );
+      DMatDMatMultExpr::packedAddAssignKernel( C, A.operand(), B, A.row(), A.row()+A.rows()
+                                           , A.column(), A.column()+A.columns() );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Default subtraction assignment to dense matrices (general/general)**************************
+   //**Packed addition assignment kernel***********************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Default subtraction assignment of a general dense matrix-general dense matrix
-   //        multiplication (\f$ C-=A*B \f$).
+   /*!\brief Addition assignment kernel for a block of a packed dense matrix (\f$ C+=A*B \f$).
    // \ingroup dense_matrix
    //
    // \param C The target left-hand side dense matrix.
-   // \param A The left-hand side multiplication operand.
+   // \param A The left-hand side packed symmetric or triangular matrix operand.
    // \param B The right-hand side multiplication operand.
+   // \param rbegin The index of the first row of \a A to be considered.
+   // \param rend The index one past the last row of \a A to be considered.
+   // \param cbegin The index of the first column of \a A to be considered.
+   // \param cend The index one past the last column of \a A to be considered.
    // \return void
    //
-   // This function implements the default subtraction assignment of a general dense matrix-
-   // general dense matrix multiplication expression to a dense matrix.
+   // This function adds the product of the block \f$ [rbegin..rend) \times [cbegin..cend) \f$ of \a
+   // A and \a B to the target matrix, where row 0 of \a B corresponds to column \a cbegin of \a A.
+   // The contiguous stored part of each row of \a A within the block is traversed once and every
+   // stored element \f$ a_{ij} \f$ is applied as an update of row \a i of \a C with row \a j of \a
+   // B. In case of a symmetric matrix, the stored rows within the column range are additionally
+   // traversed to apply the mirrored elements \f$ a_{ji} \f$. Only the rows of \a C corresponding
+   // to the row range are written, so that several row ranges can be computed concurrently without
+   // any synchronization.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline typename EnableIf< And< Not< IsDiagonal<MT4> >, Not< IsDiagonal<MT5> > > >::Type
-      selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   static inline void packedAddAssignKernel( MT3& C, const MT4& A, const MT5& B,
+                                          size_t rbegin, size_t rend, size_t cbegin, size_t cend )
    {
-      const size_t M( A.rows()    );
+      typedef typename MT4::ConstPointer  ConstPointer;
+
       const size_t N( B.columns() );
-      const size_t K( A.columns() );
 
-      for( size_t i=0UL; i<M; ++i )
+      for( size_t i=rbegin; i<rend; ++i )
       {
-         const size_t kbegin( ( IsUpper<MT4>::value )
-                              ?( IsStrictlyUpper<MT4>::value ? i+1UL : i )
-                              :( 0UL ) );
-         const size_t kend( ( IsLower<MT4>::value )
-                            ?( IsStrictlyLower<MT4>::value ? i : i+1UL )
-                            :( K ) );
-         BLAZE_INTERNAL_ASSERT( kbegin <= kend, "Invalid loop indices detected" );
+         const size_t kbegin( ( MT4::storesUpper )?( max( i, cbegin ) ):( cbegin ) );
+         const size_t kend  ( ( MT4::storesUpper )?( cend ):( min( i+1UL, cend ) ) );
+         const ConstPointer a( A.packedBegin(i) - ( ( MT4::storesUpper )?( i ):( 0UL ) ) );
 
-         for( size_t k=kbegin; k<kend; ++k )
-         {
-            const size_t jbegin( ( IsUpper<MT5>::value )
-                                 ?( IsStrictlyUpper<MT5>::value ? k+1UL : k )
-                                 :( 0UL ) );
-            const size_t jend( ( IsLower<MT5>::value )
-                               ?( IsStrictlyLower<MT5>::value ? k : k+1UL )
-                               :( N ) );
-            BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
+         for( size_t k=kbegin; k<kend; ++k ) {
+            for( size_t j=0UL; j<N; ++j ) {
+               C(i-rbegin,j) += a[k] * B(k-cbegin,j);
+            }
+         }
+      }
 
-            const size_t jnum( jend - jbegin );
-            const size_t jpos( jbegin + ( jnum & size_t(-2) ) );
+      if( !IsSymmetric<MT4>::value )
+         return;
 
-            for( size_t j=jbegin; j<jpos; j+=2UL ) {
-               C(i,j    ) -= A(i,k) * B(k,j    );
-               C(i,j+1UL) -= A(i,k) * B(k,j+1UL);
-            }
-            if( jpos < jend ) {
-               C(i,jpos) -= A(i,k) * B(k,jpos);
+      for( size_t k=cbegin; k<cend; ++k )
+      {
+         const size_t ibegin( ( MT4::storesUpper )?( max( k+1UL, rbegin ) ):( rbegin ) );
+         const size_t iend  ( ( MT4::storesUpper )?( rend ):( min( k, rend ) ) );
+         const ConstPointer a( A.packedBegin(k) - ( ( MT4::storesUpper )?( k ):( 0UL ) ) );
+
+         for( size_t i=ibegin; i<iend; ++i ) {
+            for( size_t j=0UL; j<N; ++j ) {
+               C(i-rbegin,j) += a[i] * B(k-cbegin,j);
             }
          }
       }
@@ -2923,10 +3171,10 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Default subtraction assignment to dense matrices (general/diagonal)*************************
+   //**Diagonal Addition assignment to dense matrices**********************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Default subtraction assignment of a general dense matrix-diagonal dense matrix
-   //        multiplication (\f$ C-=A*B \f$).
+   /*!\brief Addition assignment of a dense matrix-dense matrix multiplication with a compact
+   //        diagonal matrix operand (\f$ C+=A*B \f$).
    // \ingroup dense_matrix
    //
    // \param C The target left-hand side dense matrix.
@@ -2934,17 +3182,402 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    // \param B The right-hand side multiplication operand.
    // \return void
    //
-   // This function implements the default subtraction assignment of a general dense matrix-
-   // diagonal dense matrix multiplication expression to a dense matrix.
+   // This function relays the addition assignment of a multiplication with a diagonal matrix
+   // that only stores its diagonal elements to the according row or column scaling kernel.
    */
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline typename EnableIf< And< Not< IsDiagonal<MT4> >, IsDiagonal<MT5> > >::Type
-      selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   static inline typename EnableIf< UseDiagonalKernel<MT4,MT5> >::Type
+      selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      DMatDMatMultExpr::selectScalingAddAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal addition assignment to dense matrices (row scaling)********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a compact diagonal matrix-dense matrix multiplication
+   //        (\f$ C+=D*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side compact diagonal matrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< HasDiagonalStorage<MT4> >::Type
+      selectScalingAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      DMatDMatMultExpr::rowScalingAddAssignKernel( C, diagonalOf( A ), diagonalRow( A )
+                                               , diagonalColumn( A ), B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal addition assignment to dense matrices (column scaling)*****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a dense matrix-compact diagonal matrix multiplication
+   //        (\f$ C+=A*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side compact diagonal matrix operand.
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename DisableIf< HasDiagonalStorage<MT4> >::Type
+      selectScalingAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      DMatDMatMultExpr::columnScalingAddAssignKernel( C, A, diagonalOf( B ), diagonalRow( B )
+                                                  , diagonalColumn( B ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default addition assignment kernel (row scaling)********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default row scaling kernel for the addition assignment of a compact diagonal
+   //        matrix-dense matrix multiplication (\f$ C+=D*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param d The vector of diagonal elements of the diagonal matrix.
+   // \param row The index of the first row of the diagonal matrix operand.
+   // \param column The index of the first column of the diagonal matrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // The diagonal matrix operand is given by the block of the diagonal matrix starting at
+   // (\a row,\a column). Row \a i of the target matrix is updated with row \f$ row+i-column \f$
+   // of \a B scaled by the diagonal element \f$ d_{row+i} \f$. All rows of \a C that don't
+   // intersect with the diagonal remain unchanged.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename VT     // Type of the vector of diagonal elements
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename DisableIf< UseVectorizedScalingKernel<MT3,MT5,VT> >::Type
+      rowScalingAddAssignKernel( MT3& C, const VT& d, size_t row, size_t column, const MT5& B )
+   {
+      const size_t M( C.rows()    );
+      const size_t N( B.columns() );
+      const size_t K( B.rows()    );
+
+      const size_t ibegin( ( column > row )?( column - row ):( 0UL ) );
+      const size_t iend  ( ( column + K > row )?( min( M, column + K - row ) ):( 0UL ) );
+
+      for( size_t i=ibegin; i<iend; ++i )
+      {
+         const size_t k( row + i - column );
+
+         for( size_t j=0UL; j<N; ++j ) {
+            C(i,j) += d[row+i] * B(k,j);
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized addition assignment kernel (row scaling)*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized row scaling kernel for the addition assignment of a compact diagonal
+   //        matrix-dense matrix multiplication (\f$ C+=D*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param d The vector of diagonal elements of the diagonal matrix.
+   // \param row The index of the first row of the diagonal matrix operand.
+   // \param column The index of the first column of the diagonal matrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the vectorized row scaling for row-major dense matrices. Each
+   // diagonal element is broadcast once per row and applied to the according row of \a B.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename VT     // Type of the vector of diagonal elements
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseVectorizedScalingKernel<MT3,MT5,VT> >::Type
+      rowScalingAddAssignKernel( MT3& C, const VT& d, size_t row, size_t column, const MT5& B )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      const size_t M( C.rows()    );
+      const size_t N( B.columns() );
+      const size_t K( B.rows()    );
+
+      const size_t ibegin( ( column > row )?( column - row ):( 0UL ) );
+      const size_t iend  ( ( column + K > row )?( min( M, column + K - row ) ):( 0UL ) );
+      const size_t jpos  ( N & size_t(-IT::size) );
+
+      for( size_t i=ibegin; i<iend; ++i )
+      {
+         const size_t k( row + i - column );
+         const IntrinsicType factor( set( d[row+i] ) );
+
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=IT::size ) {
+            C.store( i, j, C.load(i,j) + factor * B.load(k,j) );
+         }
+         for( ; j<N; ++j ) {
+            C(i,j) += d[row+i] * B(k,j);
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default addition assignment kernel (column scaling)*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default column scaling kernel for the addition assignment of a dense
+   //        matrix-compact diagonal matrix multiplication (\f$ C+=A*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param d The vector of diagonal elements of the diagonal matrix.
+   // \param row The index of the first row of the diagonal matrix operand.
+   // \param column The index of the first column of the diagonal matrix operand.
+   // \return void
+   //
+   // The diagonal matrix operand is given by the block of the diagonal matrix starting at
+   // (\a row,\a column). Column \a j of the target matrix is updated with column
+   // \f$ column+j-row \f$ of \a A scaled by the diagonal element \f$ d_{column+j} \f$. All
+   // columns of \a C that don't intersect with the diagonal remain unchanged.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename VT >   // Type of the vector of diagonal elements
+   static inline typename DisableIf< UseVectorizedScalingKernel<MT3,MT4,VT> >::Type
+      columnScalingAddAssignKernel( MT3& C, const MT4& A, const VT& d, size_t row, size_t column )
+   {
+      const size_t M( A.rows()    );
+      const size_t N( C.columns() );
+      const size_t K( A.columns() );
+
+      const size_t jbegin( ( row > column )?( row - column ):( 0UL ) );
+      const size_t jend  ( ( row + K > column )?( min( N, row + K - column ) ):( 0UL ) );
+
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=jbegin; j<jend; ++j ) {
+            C(i,j) += A(i,column+j-row) * d[column+j];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized addition assignment kernel (column scaling)**************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized column scaling kernel for the addition assignment of a dense
+   //        matrix-compact diagonal matrix multiplication (\f$ C+=A*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param d The vector of diagonal elements of the diagonal matrix.
+   // \param row The index of the first row of the diagonal matrix operand.
+   // \param column The index of the first column of the diagonal matrix operand.
+   // \return void
+   //
+   // This function implements the vectorized column scaling for row-major dense matrices. In
+   // case the diagonal matrix operand is a diagonal block, each row of \a A is multiplied
+   // elementwise with the according section of the diagonal. Otherwise the columns are scaled
+   // individually.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename VT >   // Type of the vector of diagonal elements
+   static inline typename EnableIf< UseVectorizedScalingKernel<MT3,MT4,VT> >::Type
+      columnScalingAddAssignKernel( MT3& C, const MT4& A, const VT& d, size_t row, size_t column )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      const size_t M( A.rows()    );
+      const size_t N( C.columns() );
+      const size_t K( A.columns() );
+
+      const size_t jbegin( ( row > column )?( row - column ):( 0UL ) );
+      const size_t jend  ( ( row + K > column )?( min( N, row + K - column ) ):( 0UL ) );
+      const size_t jpos  ( ( row == column )?( jend & size_t(-IT::size) ):( jbegin ) );
+
+      for( size_t i=0UL; i<M; ++i )
+      {
+         size_t j( jbegin );
+
+         for( ; j<jpos; j+=IT::size ) {
+            C.store( i, j, C.load(i,j) + A.load(i,j) * d.loadu(column+j) );
+         }
+         for( ; j<jend; ++j ) {
+            C(i,j) += A(i,column+j-row) * d[column+j];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse matrices******************************************************
+   // No special implementation for the addition assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense matrices****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a dense matrix-dense matrix multiplication to a
+   //        dense matrix (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a dense matrix-
+   // dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline typename DisableIf< CanExploitSymmetry<MT,MT1,MT2> >::Type
+      subAssign( DenseMatrix<MT,SO>& lhs, const DMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( (~lhs).rows() == 0UL || (~lhs).columns() == 0UL || rhs.lhs_.columns() == 0UL ) {
+         return;
+      }
+
+      LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side dense matrix operand
+      RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
+
+      DMatDMatMultExpr::selectSubAssignKernel( ~lhs, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense matrices (kernel selection)*********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the kernel for a subtraction assignment of a dense matrix-dense matrix
+   //        multiplication to a dense matrix (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename DisableIf< Or< UsePackedKernel<MT4>, UseDiagonalKernel<MT4,MT5> > >::Type
+      selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      if( ( IsDiagonal<MT5>::value ) ||
+          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+         selectSmallSubAssignKernel( C, A, B );
+      else
+         selectBlasSubAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default subtraction assignment to dense matrices (general/general)**************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default subtraction assignment of a general dense matrix-general dense matrix
+   //        multiplication (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the default subtraction assignment of a general dense matrix-
+   // general dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< And< Not< IsDiagonal<MT4> >, Not< IsDiagonal<MT5> > > >::Type
+      selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
-      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT3 );
-
+      const size_t M( A.rows()    );
+      const size_t N( B.columns() );
+      const size_t K( A.columns() );
+
+      for( size_t i=0UL; i<M; ++i )
+      {
+         const size_t kbegin( ( IsUpper<MT4>::value )
+                              ?( IsStrictlyUpper<MT4>::value ? i+1UL : i )
+                              :( 0UL ) );
+         const size_t kend( ( IsLower<MT4>::value )
+                            ?( IsStrictlyLower<MT4>::value ? i : i+1UL )
+                            :( K ) );
+         BLAZE_INTERNAL_ASSERT( kbegin <= kend, "Invalid loop indices detected" );
+
+         for( size_t k=kbegin; k<kend; ++k )
+         {
+            const size_t jbegin( ( IsUpper<MT5>::value )
+                                 ?( IsStrictlyUpper<MT5>::value ? k+1UL : k )
+                                 :( 0UL ) );
+            const size_t jend( ( IsLower<MT5>::value )
+                               ?( IsStrictlyLower<MT5>::value ? k : k+1UL )
+                               :( N ) );
+            BLAZE_INTERNAL_ASSERT( jbegin <= jend, "Invalid loop indices detected" );
+
+            const size_t jnum( jend - jbegin );
+            const size_t jpos( jbegin + ( jnum & size_t(-2) ) );
+
+            for( size_t j=jbegin; j<jpos; j+=2UL ) {
+               C(i,j    ) -= A(i,k) * B(k,j    );
+               C(i,j+1UL) -= A(i,k) * B(k,j+1UL);
+            }
+            if( jpos < jend ) {
+               C(i,jpos) -= A(i,k) * B(k,jpos);
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default subtraction assignment to dense matrices (general/diagonal)*************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default subtraction assignment of a general dense matrix-diagonal dense matrix
+   //        multiplication (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the default subtraction assignment of a general dense matrix-
+   // diagonal dense matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< And< Not< IsDiagonal<MT4> >, IsDiagonal<MT5> > >::Type
+      selectDefaultSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE( MT3 );
+
       const size_t M( A.rows()    );
       const size_t N( B.columns() );
 
@@ -3914,6 +4547,375 @@ class DMatDMatMultExpr : public DenseMatrix< DMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Packed subtraction assignment to dense matrices*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a packed dense matrix-dense matrix multiplication (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment of a symmetric or triangular matrix storing a
+   // single triangle in packed format to the packed kernel.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UsePackedKernel<MT4> >::Type
+      selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      DMatDMatMultExpr::packedSubAssignKernel( C, A, B, 0UL, A.rows(), 0UL, A.columns() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Packed subtraction assignment to dense matrices (submatrices)*******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a packed dense submatrix-dense matrix multiplication (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side dense submatrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function handles submatrices of a packed symmetric or triangular matrix, which for
+   // instance result from the splitting of the multiplication during SMP assignments. The packed
+   // kernel is applied to the according range of rows and columns of the underlying matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the underlying dense matrix
+           , bool AF         // Alignment flag of the submatrix
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UsePackedKernel< DenseSubmatrix<MT4,AF,false> > >::Type
+      selectSubAssignKernel( MT3& C, const DenseSubmatrix<MT4,AF,false>& A, const MT5& B )
+   {
+      DMatDMatMultExpr::packedSubAssignKernel( C, A.operand(), B, A.row(), A.row()+A.rows()
+                                           , A.column(), A.column()+A.columns() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Packed subtraction assignment kernel********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment kernel for a block of a packed dense matrix (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side packed symmetric or triangular matrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \param rbegin The index of the first row of \a A to be considered.
+   // \param rend The index one past the last row of \a A to be considered.
+   // \param cbegin The index of the first column of \a A to be considered.
+   // \param cend The index one past the last column of \a A to be considered.
+   // \return void
+   //
+   // This function subtracts the product of the block \f$ [rbegin..rend) \times [cbegin..cend) \f$
+   // of \a A and \a B from the target matrix, where row 0 of \a B corresponds to column \a cbegin
+   // of \a A. The contiguous stored part of each row of \a A within the block is traversed once and
+   // every stored element \f$ a_{ij} \f$ is applied as an update of row \a i of \a C with row \a j
+   // of \a B. In case of a symmetric matrix, the stored rows within the column range are
+   // additionally traversed to apply the mirrored elements \f$ a_{ji} \f$. Only the rows of \a C
+   // corresponding to the row range are written, so that several row ranges can be computed
+   // concurrently without any synchronization.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline void packedSubAssignKernel( MT3& C, const MT4& A, const MT5& B,
+                                          size_t rbegin, size_t rend, size_t cbegin, size_t cend )
+   {
+      typedef typename MT4::ConstPointer  ConstPointer;
+
+      const size_t N( B.columns() );
+
+      for( size_t i=rbegin; i<rend; ++i )
+      {
+         const size_t kbegin( ( MT4::storesUpper )?( max( i, cbegin ) ):( cbegin ) );
+         const size_t kend  ( ( MT4::storesUpper )?( cend ):( min( i+1UL, cend ) ) );
+         const ConstPointer a( A.packedBegin(i) - ( ( MT4::storesUpper )?( i ):( 0UL ) ) );
+
+         for( size_t k=kbegin; k<kend; ++k ) {
+            for( size_t j=0UL; j<N; ++j ) {
+               C(i-rbegin,j) -= a[k] * B(k-cbegin,j);
+            }
+         }
+      }
+
+      if( !IsSymmetric<MT4>::value )
+         return;
+
+      for( size_t k=cbegin; k<cend; ++k )
+      {
+         const size_t ibegin( ( MT4::storesUpper )?( max( k+1UL, rbegin ) ):( rbegin ) );
+         const size_t iend  ( ( MT4::storesUpper )?( rend ):( min( k, rend ) ) );
+         const ConstPointer a( A.packedBegin(k) - ( ( MT4::storesUpper )?( k ):( 0UL ) ) );
+
+         for( size_t i=ibegin; i<iend; ++i ) {
+            for( size_t j=0UL; j<N; ++j ) {
+               C(i-rbegin,j) -= a[i] * B(k-cbegin,j);
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal Subtraction assignment to dense matrices*******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a dense matrix-dense matrix multiplication with a compact
+   //        diagonal matrix operand (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment of a multiplication with a diagonal matrix
+   // that only stores its diagonal elements to the according row or column scaling kernel.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseDiagonalKernel<MT4,MT5> >::Type
+      selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      DMatDMatMultExpr::selectScalingSubAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal subtraction assignment to dense matrices (row scaling)*****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a compact diagonal matrix-dense matrix multiplication
+   //        (\f$ C-=D*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side compact diagonal matrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< HasDiagonalStorage<MT4> >::Type
+      selectScalingSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      DMatDMatMultExpr::rowScalingSubAssignKernel( C, diagonalOf( A ), diagonalRow( A )
+                                               , diagonalColumn( A ), B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal subtraction assignment to dense matrices (column scaling)**************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a dense matrix-compact diagonal matrix multiplication
+   //        (\f$ C-=A*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side compact diagonal matrix operand.
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename DisableIf< HasDiagonalStorage<MT4> >::Type
+      selectScalingSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      DMatDMatMultExpr::columnScalingSubAssignKernel( C, A, diagonalOf( B ), diagonalRow( B )
+                                                  , diagonalColumn( B ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default subtraction assignment kernel (row scaling)*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default row scaling kernel for the subtraction assignment of a compact diagonal
+   //        matrix-dense matrix multiplication (\f$ C-=D*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param d The vector of diagonal elements of the diagonal matrix.
+   // \param row The index of the first row of the diagonal matrix operand.
+   // \param column The index of the first column of the diagonal matrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // The diagonal matrix operand is given by the block of the diagonal matrix starting at
+   // (\a row,\a column). Row \a i of the target matrix is updated with row \f$ row+i-column \f$
+   // of \a B scaled by the diagonal element \f$ d_{row+i} \f$. All rows of \a C that don't
+   // intersect with the diagonal remain unchanged.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename VT     // Type of the vector of diagonal elements
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename DisableIf< UseVectorizedScalingKernel<MT3,MT5,VT> >::Type
+      rowScalingSubAssignKernel( MT3& C, const VT& d, size_t row, size_t column, const MT5& B )
+   {
+      const size_t M( C.rows()    );
+      const size_t N( B.columns() );
+      const size_t K( B.rows()    );
+
+      const size_t ibegin( ( column > row )?( column - row ):( 0UL ) );
+      const size_t iend  ( ( column + K > row )?( min( M, column + K - row ) ):( 0UL ) );
+
+      for( size_t i=ibegin; i<iend; ++i )
+      {
+         const size_t k( row + i - column );
+
+         for( size_t j=0UL; j<N; ++j ) {
+            C(i,j) -= d[row+i] * B(k,j);
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized subtraction assignment kernel (row scaling)**************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized row scaling kernel for the subtraction assignment of a compact diagonal
+   //        matrix-dense matrix multiplication (\f$ C-=D*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param d The vector of diagonal elements of the diagonal matrix.
+   // \param row The index of the first row of the diagonal matrix operand.
+   // \param column The index of the first column of the diagonal matrix operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the vectorized row scaling for row-major dense matrices. Each
+   // diagonal element is broadcast once per row and applied to the according row of \a B.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename VT     // Type of the vector of diagonal elements
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseVectorizedScalingKernel<MT3,MT5,VT> >::Type
+      rowScalingSubAssignKernel( MT3& C, const VT& d, size_t row, size_t column, const MT5& B )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      const size_t M( C.rows()    );
+      const size_t N( B.columns() );
+      const size_t K( B.rows()    );
+
+      const size_t ibegin( ( column > row )?( column - row ):( 0UL ) );
+      const size_t iend  ( ( column + K > row )?( min( M, column + K - row ) ):( 0UL ) );
+      const size_t jpos  ( N & size_t(-IT::size) );
+
+      for( size_t i=ibegin; i<iend; ++i )
+      {
+         const size_t k( row + i - column );
+         const IntrinsicType factor( set( d[row+i] ) );
+
+         size_t j( 0UL );
+
+         for( ; j<jpos; j+=IT::size ) {
+            C.store( i, j, C.load(i,j) - factor * B.load(k,j) );
+         }
+         for( ; j<N; ++j ) {
+            C(i,j) -= d[row+i] * B(k,j);
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default subtraction assignment kernel (column scaling)**************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default column scaling kernel for the subtraction assignment of a dense
+   //        matrix-compact diagonal matrix multiplication (\f$ C-=A*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param d The vector of diagonal elements of the diagonal matrix.
+   // \param row The index of the first row of the diagonal matrix operand.
+   // \param column The index of the first column of the diagonal matrix operand.
+   // \return void
+   //
+   // The diagonal matrix operand is given by the block of the diagonal matrix starting at
+   // (\a row,\a column). Column \a j of the target matrix is updated with column
+   // \f$ column+j-row \f$ of \a A scaled by the diagonal element \f$ d_{column+j} \f$. All
+   // columns of \a C that don't intersect with the diagonal remain unchanged.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename VT >   // Type of the vector of diagonal elements
+   static inline typename DisableIf< UseVectorizedScalingKernel<MT3,MT4,VT> >::Type
+      columnScalingSubAssignKernel( MT3& C, const MT4& A, const VT& d, size_t row, size_t column )
+   {
+      const size_t M( A.rows()    );
+      const size_t N( C.columns() );
+      const size_t K( A.columns() );
+
+      const size_t jbegin( ( row > column )?( row - column ):( 0UL ) );
+      const size_t jend  ( ( row + K > column )?( min( N, row + K - column ) ):( 0UL ) );
+
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=jbegin; j<jend; ++j ) {
+            C(i,j) -= A(i,column+j-row) * d[column+j];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized subtraction assignment kernel (column scaling)***********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized column scaling kernel for the subtraction assignment of a dense
+   //        matrix-compact diagonal matrix multiplication (\f$ C-=A*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param d The vector of diagonal elements of the diagonal matrix.
+   // \param row The index of the first row of the diagonal matrix operand.
+   // \param column The index of the first column of the diagonal matrix operand.
+   // \return void
+   //
+   // This function implements the vectorized column scaling for row-major dense matrices. In
+   // case the diagonal matrix operand is a diagonal block, each row of \a A is multiplied
+   // elementwise with the according section of the diagonal. Otherwise the columns are scaled
+   // individually.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename VT >   // Type of the vector of diagonal elements
+   static inline typename EnableIf< UseVectorizedScalingKernel<MT3,MT4,VT> >::Type
+      columnScalingSubAssignKernel( MT3& C, const MT4& A, const VT& d, size_t row, size_t column )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      const size_t M( A.rows()    );
+      const size_t N( C.columns() );
+      const size_t K( A.columns() );
+
+      const size_t jbegin( ( row > column )?( row - column ):( 0UL ) );
+      const size_t jend  ( ( row + K > column )?( min( N, row + K - column ) ):( 0UL ) );
+      const size_t jpos  ( ( row == column )?( jend & size_t(-IT::size) ):( jbegin ) );
+
+      for( size_t i=0UL; i<M; ++i )
+      {
+         size_t j( jbegin );
+
+         for( ; j<jpos; j+=IT::size ) {
+            C.store( i, j, C.load(i,j) - A.load(i,j) * d.loadu(column+j) );
+         }
+         for( ; j<jend; ++j ) {
+            C(i,j) -= A(i,column+j-row) * d[column+j];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse matrices***************************************************
    // No special implementation for the subtraction assignment to sparse matrices.
    //**********************************************************************************************
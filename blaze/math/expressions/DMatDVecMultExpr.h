@@ -60,8 +60,11 @@
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
+#include <blaze/math/typetraits/HasBandStorage.h>
 #include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasDiagonalStorage.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/HasPackedStorage.h>
 #include <blaze/math/typetraits/IsBlasCompatible.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
@@ -70,11 +73,13 @@
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
 #include <blaze/math/typetraits/IsTriangular.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Rows.h>
 #include <blaze/math/typetraits/Size.h>
+#include <blaze/math/views/Forward.h>
 #include <blaze/system/BLAS.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
@@ -84,6 +89,7 @@
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/Or.h>
 #include <blaze/util/SelectType.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsComplex.h>
@@ -91,6 +97,7 @@
 #include <blaze/util/typetraits/IsFloat.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/Unused.h>
 
 
 namespace blaze {
@@ -267,6 +274,84 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the dense matrix is a symmetric or triangular matrix that stores a single triangle
+       in packed format, the nested \a value will be set to 1 and the packed kernel is selected.
+       Otherwise it will be 0. */
+   template< typename T1 >
+   struct UsePackedKernel {
+      enum { value = HasPackedStorage<T1>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the dense matrix is a diagonal matrix that only stores its diagonal elements, the
+       nested \a value will be set to 1 and the multiplication is computed by means of the
+       scaling kernel. Otherwise it will be 0. */
+   template< typename T1 >
+   struct UseDiagonalKernel {
+      enum { value = !HasPackedStorage<T1>::value && HasDiagonalStorage<T1>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the dense matrix is a band matrix that only stores the elements within its band,
+       the nested \a value will be set to 1 and the multiplication is computed by means of the
+       band kernel. Otherwise it will be 0. */
+   template< typename T1 >
+   struct UseBandKernel {
+      enum { value = !HasPackedStorage<T1>::value && !HasDiagonalStorage<T1>::value &&
+                     HasBandStorage<T1>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the two involved vector types and the band storage array of the band matrix are
+       suited for a vectorized computation of the band multiplication, the nested \value will be
+       set to 1, otherwise it will be 0. Since the sections of the vector operand are accessed at
+       arbitrary offsets, vector expressions are not considered suited. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseVectorizedBandKernel {
+      enum { value = T1::vectorizable && T2::vectorizable && T3::vectorizable &&
+                     !IsExpression<T2>::value &&
+                     IsSame<typename T1::ElementType,typename T2::ElementType>::value &&
+                     IsSame<typename T1::ElementType,typename T3::ElementType>::value &&
+                     IntrinsicTrait<typename T1::ElementType>::addition &&
+                     IntrinsicTrait<typename T1::ElementType>::subtraction &&
+                     IntrinsicTrait<typename T1::ElementType>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the two involved vector types and the vector of diagonal elements are suited for
+       a vectorized computation of the scaling, the nested \value will be set to 1, otherwise it
+       will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseVectorizedScalingKernel {
+      enum { value = T1::vectorizable && T2::vectorizable && T3::vectorizable &&
+                     IsSame<typename T1::ElementType,typename T2::ElementType>::value &&
+                     IsSame<typename T1::ElementType,typename T3::ElementType>::value &&
+                     IntrinsicTrait<typename T1::ElementType>::addition &&
+                     IntrinsicTrait<typename T1::ElementType>::subtraction &&
+                     IntrinsicTrait<typename T1::ElementType>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef DMatDVecMultExpr<MT,VT>                     This;           //!< Type of this DMatDVecMultExpr instance.
@@ -496,7 +581,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline typename DisableIf< Or< UsePackedKernel<MT1>, UseDiagonalKernel<MT1>
+                                       , UseBandKernel<MT1> > >::Type
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -1103,6 +1190,369 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 #endif
    //**********************************************************************************************
 
+   //**Packed assignment to dense vectors**********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a packed dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the assignment of a symmetric or triangular matrix storing a single
+   // triangle in packed format to the packed kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UsePackedKernel<MT1> >::Type
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      DMatDVecMultExpr::packedAssignKernel( y, A, x, 0UL, A.rows(), 0UL, A.columns() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Packed assignment to dense vectors (submatrices)********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a packed dense submatrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense submatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function handles submatrices of a packed symmetric or triangular matrix, which for
+   // instance result from the splitting of the multiplication during SMP assignments. The packed
+   // kernel is applied to the according range of rows and columns of the underlying matrix. Only
+   // in case of a symmetric matrix and a submatrix that does not span all columns, the
+   // multiplication is computed element by element.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the underlying dense matrix
+           , bool AF         // Alignment flag of the submatrix
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UsePackedKernel< DenseSubmatrix<MT1,AF,false> > >::Type
+      selectAssignKernel( VT1& y, const DenseSubmatrix<MT1,AF,false>& A, const VT2& x )
+   {
+      if( IsSymmetric<MT1>::value && ( A.column() != 0UL || A.columns() != A.operand().columns() ) )
+      {
+         for( size_t i=0UL; i<A.rows(); ++i )
+         {
+            ElementType value = ElementType();
+
+            for( size_t j=0UL; j<A.columns(); ++j ) {
+               value += A(i,j) * x[j];
+            }
+
+            y[i] = value;
+         }
+         return;
+      }
+
+      DMatDVecMultExpr::packedAssignKernel( y, A.operand(), x, A.row(), A.row()+A.rows()
+                                           , A.column(), A.column()+A.columns() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Packed assignment kernel********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment kernel for a range of rows of a packed dense matrix
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side packed symmetric or triangular matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param rbegin The index of the first row to be computed.
+   // \param rend The index one past the last row to be computed.
+   // \param cbegin The index of the first column to be considered.
+   // \param cend The index one past the last column to be considered.
+   // \return void
+   //
+   // This function computes the rows \f$ [rbegin..rend) \f$ of the product and writes them to
+   // the elements \f$ [0..rend-rbegin) \f$ of the target vector by means of the according
+   // addition assignment kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline void packedAssignKernel( VT1& y, const MT1& A, const VT2& x,
+                                          size_t rbegin, size_t rend, size_t cbegin, size_t cend )
+   {
+      for( size_t i=rbegin; i<rend; ++i ) {
+         reset( y[i-rbegin] );
+      }
+
+      DMatDVecMultExpr::packedAddAssignKernel( y, A, x, rbegin, rend, cbegin, cend );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a compact diagonal matrix-dense vector multiplication
+   //        (\f$ \vec{y}=D*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side compact diagonal matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the assignment of a multiplication with a diagonal matrix that only
+   // stores its diagonal elements to the scaling kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseDiagonalKernel<MT1> >::Type
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      reset( y );
+
+      DMatDVecMultExpr::scalingAddAssignKernel( y, diagonalOf( A ), diagonalRow( A )
+                                              , diagonalColumn( A ), x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the vector of diagonal elements of a compact diagonal matrix operand.
+   // \ingroup dense_vector
+   //
+   // \param A The compact diagonal matrix operand.
+   // \return Reference to the vector of diagonal elements.
+   */
+   template< typename MT1 >  // Type of the diagonal matrix operand
+   static inline const typename MT1::DiagonalType& diagonalOf( const MT1& A )
+   {
+      return A.diagonal();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the vector of diagonal elements of the matrix underlying a dense submatrix.
+   // \ingroup dense_vector
+   //
+   // \param A The dense submatrix of a compact diagonal matrix.
+   // \return Reference to the vector of diagonal elements of the underlying matrix.
+   */
+   template< typename MT1  // Type of the underlying diagonal matrix
+           , bool AF >     // Alignment flag of the submatrix
+   static inline const typename MT1::DiagonalType&
+      diagonalOf( const DenseSubmatrix<MT1,AF,false>& A )
+   {
+      return A.operand().diagonal();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first row of a compact diagonal matrix operand.
+   // \ingroup dense_vector
+   //
+   // \param A The compact diagonal matrix operand.
+   // \return The row offset of the operand within the diagonal matrix (always 0).
+   */
+   template< typename MT1 >  // Type of the diagonal matrix operand
+   static inline size_t diagonalRow( const MT1& A )
+   {
+      UNUSED_PARAMETER( A );
+      return 0UL;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first row of a dense submatrix of a compact diagonal matrix.
+   // \ingroup dense_vector
+   //
+   // \param A The dense submatrix of a compact diagonal matrix.
+   // \return The row offset of the submatrix within the underlying diagonal matrix.
+   */
+   template< typename MT1  // Type of the underlying diagonal matrix
+           , bool AF >     // Alignment flag of the submatrix
+   static inline size_t diagonalRow( const DenseSubmatrix<MT1,AF,false>& A )
+   {
+      return A.row();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first column of a compact diagonal matrix operand.
+   // \ingroup dense_vector
+   //
+   // \param A The compact diagonal matrix operand.
+   // \return The column offset of the operand within the diagonal matrix (always 0).
+   */
+   template< typename MT1 >  // Type of the diagonal matrix operand
+   static inline size_t diagonalColumn( const MT1& A )
+   {
+      UNUSED_PARAMETER( A );
+      return 0UL;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first column of a dense submatrix of a compact diagonal
+   //        matrix.
+   // \ingroup dense_vector
+   //
+   // \param A The dense submatrix of a compact diagonal matrix.
+   // \return The column offset of the submatrix within the underlying diagonal matrix.
+   */
+   template< typename MT1  // Type of the underlying diagonal matrix
+           , bool AF >     // Alignment flag of the submatrix
+   static inline size_t diagonalColumn( const DenseSubmatrix<MT1,AF,false>& A )
+   {
+      return A.column();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Band assignment to dense vectors************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a band matrix-dense vector multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side band matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the assignment of a multiplication with a band matrix that only stores
+   // the elements within its band to the band kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseBandKernel<MT1> >::Type
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      reset( y );
+
+      DMatDVecMultExpr::bandAddAssignKernel( y, bandOf( A ), bandRow( A ), bandColumn( A ), x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Band storage access functions***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the band matrix underlying a band matrix operand.
+   // \ingroup dense_vector
+   //
+   // \param A The band matrix operand.
+   // \return Reference to the band matrix.
+   */
+   template< typename MT1 >  // Type of the band matrix operand
+   static inline const MT1& bandOf( const MT1& A )
+   {
+      return A;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Band storage access functions***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the band matrix underlying a dense submatrix.
+   // \ingroup dense_vector
+   //
+   // \param A The dense submatrix of a band matrix.
+   // \return Reference to the underlying band matrix.
+   */
+   template< typename MT1  // Type of the underlying band matrix
+           , bool AF >     // Alignment flag of the submatrix
+   static inline const MT1& bandOf( const DenseSubmatrix<MT1,AF,false>& A )
+   {
+      return A.operand();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Band storage access functions***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first row of a band matrix operand.
+   // \ingroup dense_vector
+   //
+   // \param A The band matrix operand.
+   // \return The row offset of the operand within the band matrix (always 0).
+   */
+   template< typename MT1 >  // Type of the band matrix operand
+   static inline size_t bandRow( const MT1& A )
+   {
+      UNUSED_PARAMETER( A );
+      return 0UL;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Band storage access functions***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first row of a dense submatrix of a band matrix.
+   // \ingroup dense_vector
+   //
+   // \param A The dense submatrix of a band matrix.
+   // \return The row offset of the submatrix within the underlying band matrix.
+   */
+   template< typename MT1  // Type of the underlying band matrix
+           , bool AF >     // Alignment flag of the submatrix
+   static inline size_t bandRow( const DenseSubmatrix<MT1,AF,false>& A )
+   {
+      return A.row();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Band storage access functions***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first column of a band matrix operand.
+   // \ingroup dense_vector
+   //
+   // \param A The band matrix operand.
+   // \return The column offset of the operand within the band matrix (always 0).
+   */
+   template< typename MT1 >  // Type of the band matrix operand
+   static inline size_t bandColumn( const MT1& A )
+   {
+      UNUSED_PARAMETER( A );
+      return 0UL;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Band storage access functions***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first column of a dense submatrix of a band matrix.
+   // \ingroup dense_vector
+   //
+   // \param A The dense submatrix of a band matrix.
+   // \return The column offset of the submatrix within the underlying band matrix.
+   */
+   template< typename MT1  // Type of the underlying band matrix
+           , bool AF >     // Alignment flag of the submatrix
+   static inline size_t bandColumn( const DenseSubmatrix<MT1,AF,false>& A )
+   {
+      return A.column();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense matrix-dense vector multiplication to a sparse vector
@@ -1184,7 +1634,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline typename DisableIf< Or< UsePackedKernel<MT1>, UseDiagonalKernel<MT1>
+                                       , UseBandKernel<MT1> > >::Type
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -1793,8 +2245,453 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 #endif
    //**********************************************************************************************
 
-   //**Addition assignment to sparse vectors*******************************************************
-   // No special implementation for the addition assignment to sparse vectors.
+   //**Packed addition assignment to dense vectors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a packed dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the addition assignment of a symmetric or triangular matrix storing a
+   // single triangle in packed format to the packed kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UsePackedKernel<MT1> >::Type
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      DMatDVecMultExpr::packedAddAssignKernel( y, A, x, 0UL, A.rows(), 0UL, A.columns() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Packed addition assignment to dense vectors (submatrices)***********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a packed dense submatrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense submatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function handles submatrices of a packed symmetric or triangular matrix, which for
+   // instance result from the splitting of the multiplication during SMP assignments. The packed
+   // kernel is applied to the according range of rows and columns of the underlying matrix. Only
+   // in case of a symmetric matrix and a submatrix that does not span all columns, the
+   // multiplication is computed element by element.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the underlying dense matrix
+           , bool AF         // Alignment flag of the submatrix
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UsePackedKernel< DenseSubmatrix<MT1,AF,false> > >::Type
+      selectAddAssignKernel( VT1& y, const DenseSubmatrix<MT1,AF,false>& A, const VT2& x )
+   {
+      if( IsSymmetric<MT1>::value && ( A.column() != 0UL || A.columns() != A.operand().columns() ) )
+      {
+         for( size_t i=0UL; i<A.rows(); ++i )
+         {
+            ElementType value = ElementType();
+
+            for( size_t j=0UL; j<A.columns(); ++j ) {
+               value += A(i,j) * x[j];
+            }
+
+            y[i] += value;
+         }
+         return;
+      }
+
+      DMatDVecMultExpr::packedAddAssignKernel( y, A.operand(), x, A.row(), A.row()+A.rows()
+                                           , A.column(), A.column()+A.columns() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Packed addition assignment kernel (symmetric matrices)**************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment kernel for a range of rows of a packed symmetric matrix
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side packed symmetric matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param rbegin The index of the first row to be computed.
+   // \param rend The index one past the last row to be computed.
+   // \return void
+   //
+   // This function adds the rows \f$ [rbegin..rend) \f$ of the product to the elements
+   // \f$ [0..rend-rbegin) \f$ of the target vector. Each stored element \f$ a_{ij} \f$ of the
+   // rows within the range is read only once and applied twice: to row \a i as \f$ a_{ij}
+   // \cdot x_j \f$ and, in case column \a j lies within the range as well, to row \a j as
+   // \f$ a_{ij} \cdot x_i \f$. The contributions of the stored rows outside the range are
+   // gathered from their contiguous packed parts. Since only elements within the range are
+   // written, several row ranges can be computed concurrently without any synchronization.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< IsSymmetric<MT1> >::Type
+      packedAddAssignKernel( VT1& y, const MT1& A, const VT2& x,
+                         size_t rbegin, size_t rend, size_t cbegin, size_t cend )
+   {
+      typedef typename MT1::ConstPointer  ConstPointer;
+
+      UNUSED_PARAMETER( cbegin, cend );
+
+      BLAZE_INTERNAL_ASSERT( cbegin == 0UL && cend == A.columns(), "Invalid column range detected" );
+
+      const size_t n( A.columns() );
+
+      if( MT1::storesUpper )
+      {
+         for( size_t k=0UL; k<rbegin; ++k ) {
+            const ConstPointer a( A.packedBegin(k) );
+            for( size_t j=rbegin; j<rend; ++j ) {
+               y[j-rbegin] += a[j-k] * x[k];
+            }
+         }
+
+         for( size_t i=rbegin; i<rend; ++i )
+         {
+            const ConstPointer a( A.packedBegin(i) );
+            ElementType value( a[0] * x[i] );
+
+            for( size_t j=i+1UL; j<rend; ++j ) {
+               value += a[j-i] * x[j];
+               y[j-rbegin] += a[j-i] * x[i];
+            }
+            for( size_t j=rend; j<n; ++j ) {
+               value += a[j-i] * x[j];
+            }
+
+            y[i-rbegin] += value;
+         }
+      }
+      else
+      {
+         for( size_t i=rbegin; i<rend; ++i )
+         {
+            const ConstPointer a( A.packedBegin(i) );
+            ElementType value( a[i] * x[i] );
+
+            for( size_t j=0UL; j<rbegin; ++j ) {
+               value += a[j] * x[j];
+            }
+            for( size_t j=rbegin; j<i; ++j ) {
+               value += a[j] * x[j];
+               y[j-rbegin] += a[j] * x[i];
+            }
+
+            y[i-rbegin] += value;
+         }
+
+         for( size_t k=rend; k<n; ++k ) {
+            const ConstPointer a( A.packedBegin(k) );
+            for( size_t j=rbegin; j<rend; ++j ) {
+               y[j-rbegin] += a[j] * x[k];
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Packed addition assignment kernel (triangular matrices)*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment kernel for a range of rows of a packed triangular matrix
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side packed triangular matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param rbegin The index of the first row to be computed.
+   // \param rend The index one past the last row to be computed.
+   // \param cbegin The index of the first column to be considered.
+   // \param cend The index one past the last column to be considered.
+   // \return void
+   //
+   // This function adds the rows \f$ [rbegin..rend) \f$ of the product to the elements
+   // \f$ [0..rend-rbegin) \f$ of the target vector, where the element \f$ x_0 \f$ of the
+   // right-hand side vector corresponds to column \a cbegin. Only the stored part of each row
+   // within the column range is traversed, i.e. the zero triangle is skipped completely.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename DisableIf< IsSymmetric<MT1> >::Type
+      packedAddAssignKernel( VT1& y, const MT1& A, const VT2& x,
+                         size_t rbegin, size_t rend, size_t cbegin, size_t cend )
+   {
+      typedef typename MT1::ConstPointer  ConstPointer;
+
+      for( size_t i=rbegin; i<rend; ++i )
+      {
+         const size_t jbegin( ( MT1::storesUpper )?( max( i, cbegin ) ):( cbegin ) );
+         const size_t jend  ( ( MT1::storesUpper )?( cend ):( min( i+1UL, cend ) ) );
+         const size_t first ( ( MT1::storesUpper )?( i ):( 0UL ) );
+
+         if( jbegin >= jend )
+            continue;
+
+         const ConstPointer a( A.packedBegin(i) - first );
+         ElementType value = ElementType();
+
+         for( size_t j=jbegin; j<jend; ++j ) {
+            value += a[j] * x[j-cbegin];
+         }
+
+         y[i-rbegin] += value;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal addition assignment to dense vectors***********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a compact diagonal matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=D*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side compact diagonal matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the addition assignment of a multiplication with a diagonal matrix
+   // that only stores its diagonal elements to the scaling kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseDiagonalKernel<MT1> >::Type
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      DMatDVecMultExpr::scalingAddAssignKernel( y, diagonalOf( A ), diagonalRow( A )
+                                              , diagonalColumn( A ), x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default addition assignment kernel (scaling)************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default scaling kernel for the addition assignment of a compact diagonal
+   //        matrix-dense vector multiplication (\f$ \vec{y}+=D*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param d The vector of diagonal elements of the diagonal matrix.
+   // \param row The index of the first row of the diagonal matrix operand.
+   // \param column The index of the first column of the diagonal matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // The diagonal matrix operand is given by the block of the diagonal matrix starting at
+   // (\a row,\a column). The element \f$ y_i \f$ is updated with the element
+   // \f$ x_{row+i-column} \f$ scaled by the diagonal element \f$ d_{row+i} \f$. All elements of
+   // \a y that don't intersect with the diagonal remain unchanged.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT3    // Type of the vector of diagonal elements
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename DisableIf< UseVectorizedScalingKernel<VT1,VT2,VT3> >::Type
+      scalingAddAssignKernel( VT1& y, const VT3& d, size_t row, size_t column, const VT2& x )
+   {
+      const size_t M( y.size() );
+      const size_t N( x.size() );
+
+      const size_t ibegin( ( column > row )?( column - row ):( 0UL ) );
+      const size_t iend  ( ( column + N > row )?( min( M, column + N - row ) ):( 0UL ) );
+
+      for( size_t i=ibegin; i<iend; ++i ) {
+         y[i] += d[row+i] * x[row+i-column];
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized addition assignment kernel (scaling)*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized scaling kernel for the addition assignment of a compact diagonal
+   //        matrix-dense vector multiplication (\f$ \vec{y}+=D*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param d The vector of diagonal elements of the diagonal matrix.
+   // \param row The index of the first row of the diagonal matrix operand.
+   // \param column The index of the first column of the diagonal matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // In case the diagonal matrix operand is a diagonal block, this function computes the
+   // elementwise product of the according section of the diagonal and \a x by means of
+   // intrinsics. Otherwise the elements are scaled individually.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT3    // Type of the vector of diagonal elements
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseVectorizedScalingKernel<VT1,VT2,VT3> >::Type
+      scalingAddAssignKernel( VT1& y, const VT3& d, size_t row, size_t column, const VT2& x )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      const size_t M( y.size() );
+      const size_t N( x.size() );
+
+      const size_t ibegin( ( column > row )?( column - row ):( 0UL ) );
+      const size_t iend  ( ( column + N > row )?( min( M, column + N - row ) ):( 0UL ) );
+      const size_t ipos  ( ( row == column )?( iend & size_t(-IT::size) ):( ibegin ) );
+
+      size_t i( ibegin );
+
+      for( ; i<ipos; i+=IT::size ) {
+         y.store( i, y.load(i) + d.loadu(row+i) * x.load(i) );
+      }
+      for( ; i<iend; ++i ) {
+         y[i] += d[row+i] * x[row+i-column];
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Band addition assignment to dense vectors***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a band matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side band matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the addition assignment of a multiplication with a band matrix that
+   // only stores the elements within its band to the band kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseBandKernel<MT1> >::Type
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      DMatDVecMultExpr::bandAddAssignKernel( y, bandOf( A ), bandRow( A ), bandColumn( A ), x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default addition assignment kernel (band)***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default band kernel for the addition assignment of a band matrix-dense vector
+   //        multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param B The band matrix.
+   // \param row The index of the first row of the band matrix operand.
+   // \param column The index of the first column of the band matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // The band matrix operand is given by the block of the band matrix starting at (\a row,
+   // \a column). The multiplication is computed diagonal by diagonal: for each diagonal of the
+   // band, the section of the diagonal that intersects with the block is multiplied elementwise
+   // with the according section of \a x and added to the according section of \a y.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT2    // Type of the band matrix
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename DisableIf< UseVectorizedBandKernel<VT1,VT2,typename MT2::BandType> >::Type
+      bandAddAssignKernel( VT1& y, const MT2& B, size_t row, size_t column, const VT2& x )
+   {
+      const size_t M ( y.size() );
+      const size_t N ( x.size() );
+      const size_t kl( B.lowerBandwidth() );
+      const size_t ku( B.upperBandwidth() );
+
+      const typename MT2::BandType& band( B.band() );
+
+      for( size_t r=0UL; r<=kl+ku; ++r )
+      {
+         const size_t jbegin( max( column, ( row+ku > r )?( row+ku-r ):( 0UL ) ) );
+         const size_t jend  ( min( column+N, ( row+ku+M > r )?( row+ku+M-r ):( 0UL ) ) );
+
+         for( size_t j=jbegin; j<jend; ++j ) {
+            y[j+r-row-ku] += band(r,j) * x[j-column];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized addition assignment kernel (band)************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized band kernel for the addition assignment of a band matrix-dense vector
+   //        multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param B The band matrix.
+   // \param row The index of the first row of the band matrix operand.
+   // \param column The index of the first column of the band matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function computes the multiplication diagonal by diagonal. Since each diagonal is
+   // stored contiguously in the band storage array, the elementwise products of the diagonals
+   // with the according sections of \a x are computed by means of intrinsics.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT2    // Type of the band matrix
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseVectorizedBandKernel<VT1,VT2,typename MT2::BandType> >::Type
+      bandAddAssignKernel( VT1& y, const MT2& B, size_t row, size_t column, const VT2& x )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      const size_t M ( y.size() );
+      const size_t N ( x.size() );
+      const size_t kl( B.lowerBandwidth() );
+      const size_t ku( B.upperBandwidth() );
+
+      const typename MT2::BandType& band( B.band() );
+
+      ElementType* const py( y.data() );
+      const ElementType* const px( x.data() );
+
+      for( size_t r=0UL; r<=kl+ku; ++r )
+      {
+         const size_t jbegin( max( column, ( row+ku > r )?( row+ku-r ):( 0UL ) ) );
+         const size_t jend  ( min( column+N, ( row+ku+M > r )?( row+ku+M-r ):( 0UL ) ) );
+
+         if( jbegin >= jend ) continue;
+
+         const size_t jpos( jbegin + ( ( jend - jbegin ) & size_t(-IT::size) ) );
+
+         size_t j( jbegin );
+
+         for( ; j<jpos; j+=IT::size ) {
+            ElementType* const pi( py+j+r-row-ku );
+            storeu( pi, loadu( pi ) + band.loadu(r,j) * loadu( px+j-column ) );
+         }
+         for( ; j<jend; ++j ) {
+            y[j+r-row-ku] += band(r,j) * x[j-column];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse vectors*******************************************************
+   // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
 
    //**Subtraction assignment to dense vectors*****************************************************
@@ -1848,7 +2745,9 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline typename DisableIf< Or< UsePackedKernel<MT1>, UseDiagonalKernel<MT1>
+                                       , UseBandKernel<MT1> > >::Type
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -2457,6 +3356,451 @@ class DMatDVecMultExpr : public DenseVector< DMatDVecMultExpr<MT,VT>, false >
 #endif
    //**********************************************************************************************
 
+   //**Packed subtraction assignment to dense vectors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a packed dense matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment of a symmetric or triangular matrix storing a
+   // single triangle in packed format to the packed kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UsePackedKernel<MT1> >::Type
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      DMatDVecMultExpr::packedSubAssignKernel( y, A, x, 0UL, A.rows(), 0UL, A.columns() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Packed subtraction assignment to dense vectors (submatrices)********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a packed dense submatrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense submatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function handles submatrices of a packed symmetric or triangular matrix, which for
+   // instance result from the splitting of the multiplication during SMP assignments. The packed
+   // kernel is applied to the according range of rows and columns of the underlying matrix. Only
+   // in case of a symmetric matrix and a submatrix that does not span all columns, the
+   // multiplication is computed element by element.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the underlying dense matrix
+           , bool AF         // Alignment flag of the submatrix
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UsePackedKernel< DenseSubmatrix<MT1,AF,false> > >::Type
+      selectSubAssignKernel( VT1& y, const DenseSubmatrix<MT1,AF,false>& A, const VT2& x )
+   {
+      if( IsSymmetric<MT1>::value && ( A.column() != 0UL || A.columns() != A.operand().columns() ) )
+      {
+         for( size_t i=0UL; i<A.rows(); ++i )
+         {
+            ElementType value = ElementType();
+
+            for( size_t j=0UL; j<A.columns(); ++j ) {
+               value += A(i,j) * x[j];
+            }
+
+            y[i] -= value;
+         }
+         return;
+      }
+
+      DMatDVecMultExpr::packedSubAssignKernel( y, A.operand(), x, A.row(), A.row()+A.rows()
+                                           , A.column(), A.column()+A.columns() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Packed subtraction assignment kernel (symmetric matrices)***********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment kernel for a range of rows of a packed symmetric matrix
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side packed symmetric matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param rbegin The index of the first row to be computed.
+   // \param rend The index one past the last row to be computed.
+   // \return void
+   //
+   // This function subtracts the rows \f$ [rbegin..rend) \f$ of the product from the elements
+   // \f$ [0..rend-rbegin) \f$ of the target vector. Each stored element \f$ a_{ij} \f$ of the
+   // rows within the range is read only once and applied twice: to row \a i as \f$ a_{ij}
+   // \cdot x_j \f$ and, in case column \a j lies within the range as well, to row \a j as
+   // \f$ a_{ij} \cdot x_i \f$. The contributions of the stored rows outside the range are
+   // gathered from their contiguous packed parts. Since only elements within the range are
+   // written, several row ranges can be computed concurrently without any synchronization.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< IsSymmetric<MT1> >::Type
+      packedSubAssignKernel( VT1& y, const MT1& A, const VT2& x,
+                         size_t rbegin, size_t rend, size_t cbegin, size_t cend )
+   {
+      typedef typename MT1::ConstPointer  ConstPointer;
+
+      UNUSED_PARAMETER( cbegin, cend );
+
+      BLAZE_INTERNAL_ASSERT( cbegin == 0UL && cend == A.columns(), "Invalid column range detected" );
+
+      const size_t n( A.columns() );
+
+      if( MT1::storesUpper )
+      {
+         for( size_t k=0UL; k<rbegin; ++k ) {
+            const ConstPointer a( A.packedBegin(k) );
+            for( size_t j=rbegin; j<rend; ++j ) {
+               y[j-rbegin] -= a[j-k] * x[k];
+            }
+         }
+
+         for( size_t i=rbegin; i<rend; ++i )
+         {
+            const ConstPointer a( A.packedBegin(i) );
+            ElementType value( a[0] * x[i] );
+
+            for( size_t j=i+1UL; j<rend; ++j ) {
+               value += a[j-i] * x[j];
+               y[j-rbegin] -= a[j-i] * x[i];
+            }
+            for( size_t j=rend; j<n; ++j ) {
+               value += a[j-i] * x[j];
+            }
+
+            y[i-rbegin] -= value;
+         }
+      }
+      else
+      {
+         for( size_t i=rbegin; i<rend; ++i )
+         {
+            const ConstPointer a( A.packedBegin(i) );
+            ElementType value( a[i] * x[i] );
+
+            for( size_t j=0UL; j<rbegin; ++j ) {
+               value += a[j] * x[j];
+            }
+            for( size_t j=rbegin; j<i; ++j ) {
+               value += a[j] * x[j];
+               y[j-rbegin] -= a[j] * x[i];
+            }
+
+            y[i-rbegin] -= value;
+         }
+
+         for( size_t k=rend; k<n; ++k ) {
+            const ConstPointer a( A.packedBegin(k) );
+            for( size_t j=rbegin; j<rend; ++j ) {
+               y[j-rbegin] -= a[j] * x[k];
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Packed subtraction assignment kernel (triangular matrices)**********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment kernel for a range of rows of a packed triangular matrix
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side packed triangular matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param rbegin The index of the first row to be computed.
+   // \param rend The index one past the last row to be computed.
+   // \param cbegin The index of the first column to be considered.
+   // \param cend The index one past the last column to be considered.
+   // \return void
+   //
+   // This function subtracts the rows \f$ [rbegin..rend) \f$ of the product from the elements
+   // \f$ [0..rend-rbegin) \f$ of the target vector, where the element \f$ x_0 \f$ of the
+   // right-hand side vector corresponds to column \a cbegin. Only the stored part of each row
+   // within the column range is traversed, i.e. the zero triangle is skipped completely.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename DisableIf< IsSymmetric<MT1> >::Type
+      packedSubAssignKernel( VT1& y, const MT1& A, const VT2& x,
+                         size_t rbegin, size_t rend, size_t cbegin, size_t cend )
+   {
+      typedef typename MT1::ConstPointer  ConstPointer;
+
+      for( size_t i=rbegin; i<rend; ++i )
+      {
+         const size_t jbegin( ( MT1::storesUpper )?( max( i, cbegin ) ):( cbegin ) );
+         const size_t jend  ( ( MT1::storesUpper )?( cend ):( min( i+1UL, cend ) ) );
+         const size_t first ( ( MT1::storesUpper )?( i ):( 0UL ) );
+
+         if( jbegin >= jend )
+            continue;
+
+         const ConstPointer a( A.packedBegin(i) - first );
+         ElementType value = ElementType();
+
+         for( size_t j=jbegin; j<jend; ++j ) {
+            value += a[j] * x[j-cbegin];
+         }
+
+         y[i-rbegin] -= value;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal subtraction assignment to dense vectors********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a compact diagonal matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=D*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side compact diagonal matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment of a multiplication with a diagonal matrix
+   // that only stores its diagonal elements to the scaling kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseDiagonalKernel<MT1> >::Type
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      DMatDVecMultExpr::scalingSubAssignKernel( y, diagonalOf( A ), diagonalRow( A )
+                                              , diagonalColumn( A ), x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default subtraction assignment kernel (scaling)*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default scaling kernel for the subtraction assignment of a compact diagonal
+   //        matrix-dense vector multiplication (\f$ \vec{y}-=D*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param d The vector of diagonal elements of the diagonal matrix.
+   // \param row The index of the first row of the diagonal matrix operand.
+   // \param column The index of the first column of the diagonal matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // The diagonal matrix operand is given by the block of the diagonal matrix starting at
+   // (\a row,\a column). The element \f$ y_i \f$ is updated with the element
+   // \f$ x_{row+i-column} \f$ scaled by the diagonal element \f$ d_{row+i} \f$. All elements of
+   // \a y that don't intersect with the diagonal remain unchanged.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT3    // Type of the vector of diagonal elements
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename DisableIf< UseVectorizedScalingKernel<VT1,VT2,VT3> >::Type
+      scalingSubAssignKernel( VT1& y, const VT3& d, size_t row, size_t column, const VT2& x )
+   {
+      const size_t M( y.size() );
+      const size_t N( x.size() );
+
+      const size_t ibegin( ( column > row )?( column - row ):( 0UL ) );
+      const size_t iend  ( ( column + N > row )?( min( M, column + N - row ) ):( 0UL ) );
+
+      for( size_t i=ibegin; i<iend; ++i ) {
+         y[i] -= d[row+i] * x[row+i-column];
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized subtraction assignment kernel (scaling)******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized scaling kernel for the subtraction assignment of a compact diagonal
+   //        matrix-dense vector multiplication (\f$ \vec{y}-=D*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param d The vector of diagonal elements of the diagonal matrix.
+   // \param row The index of the first row of the diagonal matrix operand.
+   // \param column The index of the first column of the diagonal matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // In case the diagonal matrix operand is a diagonal block, this function computes the
+   // elementwise product of the according section of the diagonal and \a x by means of
+   // intrinsics. Otherwise the elements are scaled individually.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT3    // Type of the vector of diagonal elements
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseVectorizedScalingKernel<VT1,VT2,VT3> >::Type
+      scalingSubAssignKernel( VT1& y, const VT3& d, size_t row, size_t column, const VT2& x )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      const size_t M( y.size() );
+      const size_t N( x.size() );
+
+      const size_t ibegin( ( column > row )?( column - row ):( 0UL ) );
+      const size_t iend  ( ( column + N > row )?( min( M, column + N - row ) ):( 0UL ) );
+      const size_t ipos  ( ( row == column )?( iend & size_t(-IT::size) ):( ibegin ) );
+
+      size_t i( ibegin );
+
+      for( ; i<ipos; i+=IT::size ) {
+         y.store( i, y.load(i) - d.loadu(row+i) * x.load(i) );
+      }
+      for( ; i<iend; ++i ) {
+         y[i] -= d[row+i] * x[row+i-column];
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Band subtraction assignment to dense vectors************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a band matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side band matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment of a multiplication with a band matrix that
+   // only stores the elements within its band to the band kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseBandKernel<MT1> >::Type
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      DMatDVecMultExpr::bandSubAssignKernel( y, bandOf( A ), bandRow( A ), bandColumn( A ), x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default subtraction assignment kernel (band)************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default band kernel for the subtraction assignment of a band matrix-dense vector
+   //        multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param B The band matrix.
+   // \param row The index of the first row of the band matrix operand.
+   // \param column The index of the first column of the band matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // The band matrix operand is given by the block of the band matrix starting at (\a row,
+   // \a column). The multiplication is computed diagonal by diagonal: for each diagonal of the
+   // band, the section of the diagonal that intersects with the block is multiplied elementwise
+   // with the according section of \a x and subtracted from the according section of \a y.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT2    // Type of the band matrix
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename DisableIf< UseVectorizedBandKernel<VT1,VT2,typename MT2::BandType> >::Type
+      bandSubAssignKernel( VT1& y, const MT2& B, size_t row, size_t column, const VT2& x )
+   {
+      const size_t M ( y.size() );
+      const size_t N ( x.size() );
+      const size_t kl( B.lowerBandwidth() );
+      const size_t ku( B.upperBandwidth() );
+
+      const typename MT2::BandType& band( B.band() );
+
+      for( size_t r=0UL; r<=kl+ku; ++r )
+      {
+         const size_t jbegin( max( column, ( row+ku > r )?( row+ku-r ):( 0UL ) ) );
+         const size_t jend  ( min( column+N, ( row+ku+M > r )?( row+ku+M-r ):( 0UL ) ) );
+
+         for( size_t j=jbegin; j<jend; ++j ) {
+            y[j+r-row-ku] -= band(r,j) * x[j-column];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized subtraction assignment kernel (band)*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized band kernel for the subtraction assignment of a band matrix-dense vector
+   //        multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param B The band matrix.
+   // \param row The index of the first row of the band matrix operand.
+   // \param column The index of the first column of the band matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function computes the multiplication diagonal by diagonal. Since each diagonal is
+   // stored contiguously in the band storage array, the elementwise products of the diagonals
+   // with the according sections of \a x are computed by means of intrinsics.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT2    // Type of the band matrix
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseVectorizedBandKernel<VT1,VT2,typename MT2::BandType> >::Type
+      bandSubAssignKernel( VT1& y, const MT2& B, size_t row, size_t column, const VT2& x )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      const size_t M ( y.size() );
+      const size_t N ( x.size() );
+      const size_t kl( B.lowerBandwidth() );
+      const size_t ku( B.upperBandwidth() );
+
+      const typename MT2::BandType& band( B.band() );
+
+      ElementType* const py( y.data() );
+      const ElementType* const px( x.data() );
+
+      for( size_t r=0UL; r<=kl+ku; ++r )
+      {
+         const size_t jbegin( max( column, ( row+ku > r )?( row+ku-r ):( 0UL ) ) );
+         const size_t jend  ( min( column+N, ( row+ku+M > r )?( row+ku+M-r ):( 0UL ) ) );
+
+         if( jbegin >= jend ) continue;
+
+         const size_t jpos( jbegin + ( ( jend - jbegin ) & size_t(-IT::size) ) );
+
+         size_t j( jbegin );
+
+         for( ; j<jpos; j+=IT::size ) {
+            ElementType* const pi( py+j+r-row-ku );
+            storeu( pi, loadu( pi ) - band.loadu(r,j) * loadu( px+j-column ) );
+         }
+         for( ; j<jend; ++j ) {
+            y[j+r-row-ku] -= band(r,j) * x[j-column];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -59,6 +59,7 @@
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
+#include <blaze/math/typetraits/HasDiagonalStorage.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
@@ -80,6 +81,7 @@
 #include <blaze/util/SelectType.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/RemoveReference.h>
+#include <blaze/util/Unused.h>
 
 
 namespace blaze {
@@ -121,15 +123,23 @@ class DMatSVecMultExpr : public DenseVector< DMatSVecMultExpr<MT,VT>, false >
    enum { evaluateVector = IsComputation<VT>::value || RequiresEvaluation<VT>::value };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Compilation switch for the scaling kernel.
+   /*! In case the dense matrix is a diagonal matrix that only stores its diagonal elements, the
+       multiplication is computed by scaling the non-zero elements of the sparse vector. */
+   enum { useScaling = HasDiagonalStorage<MT>::value };
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Compilation switch for the evaluation strategy of the multiplication expression.
    /*! The \a useAssign compile time constant expression represents a compilation switch for
        the evaluation strategy of the multiplication expression. In case either the matrix or
-       the vector operand requires an intermediate evaluation or the sparse vector expression
-       is a compound expression, \a useAssign will be set to \a true and the multiplication
-       expression will be evaluated via the \a assign function family. Otherwise \a useAssign
-       will be set to \a false and the expression will be evaluated via the subscript operator. */
-   enum { useAssign = evaluateMatrix || evaluateVector };
+       the vector operand requires an intermediate evaluation, the sparse vector expression is a
+       compound expression, or the multiplication is computed by the scaling kernel, \a useAssign
+       will be set to \a true and the multiplication expression will be evaluated via the
+       \a assign function family. Otherwise \a useAssign will be set to \a false and the
+       expression will be evaluated via the subscript operator. */
+   enum { useAssign = evaluateMatrix || evaluateVector || useScaling };
    //**********************************************************************************************
 
    //**********************************************************************************************
@@ -147,10 +157,11 @@ class DMatSVecMultExpr : public DenseVector< DMatSVecMultExpr<MT,VT>, false >
    //! Helper structure for the explicit application of the SFINAE principle.
    /*! The UseSMPAssign struct is a helper struct for the selection of the parallel evaluation
        strategy. In case either the matrix or the vector operand requires an intermediate
-       evaluation, the nested \value will be set to 1, otherwise it will be 0. */
+       evaluation and the scaling kernel is not used, the nested \value will be set to 1,
+       otherwise it will be 0. */
    template< typename T1 >
    struct UseSMPAssign {
-      enum { value = useAssign };
+      enum { value = ( evaluateMatrix || evaluateVector ) && !useScaling };
    };
    /*! \endcond */
    //**********************************************************************************************
@@ -361,7 +372,162 @@ class DMatSVecMultExpr : public DenseVector< DMatSVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
       // Performing the dense matrix-sparse vector multiplication
-      assign( ~lhs, A * x );
+      DMatSVecMultExpr::selectAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default assignment to dense vectors*********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default assignment of a dense matrix-sparse vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side sparse vector operand.
+   // \return void
+   //
+   // This function relays the assignment to the multiplication of the evaluated operands.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename DisableIf< HasDiagonalStorage<MT1> >::Type
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      assign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Scaling assignment to dense vectors*********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Scaling assignment of a compact diagonal matrix-sparse vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side compact diagonal matrix operand.
+   // \param x The right-hand side sparse vector operand.
+   // \return void
+   //
+   // This function implements the assignment of a multiplication between a diagonal matrix,
+   // which only stores its diagonal elements, and a sparse vector. Only the non-zero elements
+   // of the sparse vector are scaled by the according diagonal elements.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< HasDiagonalStorage<MT1> >::Type
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      reset( y );
+      scalingAddAssignKernel( y, diagonalOf( A ), diagonalRow( A ), diagonalColumn( A ), x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the vector of diagonal elements of a compact diagonal matrix operand.
+   // \ingroup dense_vector
+   //
+   // \param A The compact diagonal matrix operand.
+   // \return Reference to the vector of diagonal elements.
+   */
+   template< typename MT1 >  // Type of the diagonal matrix operand
+   static inline const typename MT1::DiagonalType& diagonalOf( const MT1& A )
+   {
+      return A.diagonal();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the vector of diagonal elements of the matrix underlying a dense submatrix.
+   // \ingroup dense_vector
+   //
+   // \param A The dense submatrix of a compact diagonal matrix.
+   // \return Reference to the vector of diagonal elements of the underlying matrix.
+   */
+   template< typename MT1  // Type of the underlying diagonal matrix
+           , bool AF >     // Alignment flag of the submatrix
+   static inline const typename MT1::DiagonalType&
+      diagonalOf( const DenseSubmatrix<MT1,AF,false>& A )
+   {
+      return A.operand().diagonal();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first row of a compact diagonal matrix operand.
+   // \ingroup dense_vector
+   //
+   // \param A The compact diagonal matrix operand.
+   // \return The row offset of the operand within the diagonal matrix (always 0).
+   */
+   template< typename MT1 >  // Type of the diagonal matrix operand
+   static inline size_t diagonalRow( const MT1& A )
+   {
+      UNUSED_PARAMETER( A );
+      return 0UL;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first row of a dense submatrix of a compact diagonal matrix.
+   // \ingroup dense_vector
+   //
+   // \param A The dense submatrix of a compact diagonal matrix.
+   // \return The row offset of the submatrix within the underlying diagonal matrix.
+   */
+   template< typename MT1  // Type of the underlying diagonal matrix
+           , bool AF >     // Alignment flag of the submatrix
+   static inline size_t diagonalRow( const DenseSubmatrix<MT1,AF,false>& A )
+   {
+      return A.row();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first column of a compact diagonal matrix operand.
+   // \ingroup dense_vector
+   //
+   // \param A The compact diagonal matrix operand.
+   // \return The column offset of the operand within the diagonal matrix (always 0).
+   */
+   template< typename MT1 >  // Type of the diagonal matrix operand
+   static inline size_t diagonalColumn( const MT1& A )
+   {
+      UNUSED_PARAMETER( A );
+      return 0UL;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first column of a dense submatrix of a compact diagonal
+   //        matrix.
+   // \ingroup dense_vector
+   //
+   // \param A The dense submatrix of a compact diagonal matrix.
+   // \return The column offset of the submatrix within the underlying diagonal matrix.
+   */
+   template< typename MT1  // Type of the underlying diagonal matrix
+           , bool AF >     // Alignment flag of the submatrix
+   static inline size_t diagonalColumn( const DenseSubmatrix<MT1,AF,false>& A )
+   {
+      return A.column();
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -440,7 +606,95 @@ class DMatSVecMultExpr : public DenseVector< DMatSVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
       // Performing the dense matrix-sparse vector multiplication
-      addAssign( ~lhs, A * x );
+      DMatSVecMultExpr::selectAddAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default addition assignment to dense vectors************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default addition assignment of a dense matrix-sparse vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side sparse vector operand.
+   // \return void
+   //
+   // This function relays the addition assignment to the multiplication of the evaluated
+   // operands.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename DisableIf< HasDiagonalStorage<MT1> >::Type
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      addAssign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Scaling addition assignment to dense vectors************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Scaling addition assignment of a compact diagonal matrix-sparse vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side compact diagonal matrix operand.
+   // \param x The right-hand side sparse vector operand.
+   // \return void
+   //
+   // This function selects the scaling kernel for the addition assignment of a multiplication
+   // between a diagonal matrix, which only stores its diagonal elements, and a sparse vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< HasDiagonalStorage<MT1> >::Type
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      scalingAddAssignKernel( y, diagonalOf( A ), diagonalRow( A ), diagonalColumn( A ), x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Scaling addition assignment kernel**********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Scaling addition assignment kernel for a compact diagonal matrix-sparse vector
+   //        multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param d The diagonal elements of the underlying diagonal matrix.
+   // \param row The index of the first row of the matrix operand.
+   // \param column The index of the first column of the matrix operand.
+   // \param x The right-hand side sparse vector operand.
+   // \return void
+   //
+   // This function traverses the non-zero elements of the sparse vector. The non-zero element
+   // at index \a k is multiplied with the diagonal element in column \a column+k of the
+   // underlying diagonal matrix, which only contributes to row \a column+k-row of the result.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the vector of diagonal elements
+           , typename VT3 >  // Type of the right-hand side vector operand
+   static inline void scalingAddAssignKernel( VT1& y, const VT2& d, size_t row, size_t column,
+                                              const VT3& x )
+   {
+      typedef typename RemoveReference<VT3>::Type::ConstIterator  ConstIterator;
+
+      const ConstIterator end( x.end() );
+
+      for( ConstIterator element=x.begin(); element!=end; ++element )
+      {
+         const size_t k( column + element->index() );
+         if( k < row ) continue;
+         if( k - row >= y.size() ) break;
+         y[k-row] += d[k] * element->value();
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -489,7 +743,95 @@ class DMatSVecMultExpr : public DenseVector< DMatSVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
       // Performing the dense matrix-sparse vector multiplication
-      subAssign( ~lhs, A * x );
+      DMatSVecMultExpr::selectSubAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default subtraction assignment to dense vectors*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default subtraction assignment of a dense matrix-sparse vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side dense matrix operand.
+   // \param x The right-hand side sparse vector operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment to the multiplication of the evaluated
+   // operands.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename DisableIf< HasDiagonalStorage<MT1> >::Type
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      subAssign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Scaling subtraction assignment to dense vectors*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Scaling subtraction assignment of a compact diagonal matrix-sparse vector
+   //        multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side compact diagonal matrix operand.
+   // \param x The right-hand side sparse vector operand.
+   // \return void
+   //
+   // This function selects the scaling kernel for the subtraction assignment of a multiplication
+   // between a diagonal matrix, which only stores its diagonal elements, and a sparse vector.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< HasDiagonalStorage<MT1> >::Type
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      scalingSubAssignKernel( y, diagonalOf( A ), diagonalRow( A ), diagonalColumn( A ), x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Scaling subtraction assignment kernel*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Scaling subtraction assignment kernel for a compact diagonal matrix-sparse vector
+   //        multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param d The diagonal elements of the underlying diagonal matrix.
+   // \param row The index of the first row of the matrix operand.
+   // \param column The index of the first column of the matrix operand.
+   // \param x The right-hand side sparse vector operand.
+   // \return void
+   //
+   // This function traverses the non-zero elements of the sparse vector. The non-zero element
+   // at index \a k is multiplied with the diagonal element in column \a column+k of the
+   // underlying diagonal matrix, which only contributes to row \a column+k-row of the result.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the vector of diagonal elements
+           , typename VT3 >  // Type of the right-hand side vector operand
+   static inline void scalingSubAssignKernel( VT1& y, const VT2& d, size_t row, size_t column,
+                                              const VT3& x )
+   {
+      typedef typename RemoveReference<VT3>::Type::ConstIterator  ConstIterator;
+
+      const ConstIterator end( x.end() );
+
+      for( ConstIterator element=x.begin(); element!=end; ++element )
+      {
+         const size_t k( column + element->index() );
+         if( k < row ) continue;
+         if( k - row >= y.size() ) break;
+         y[k-row] -= d[k] * element->value();
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
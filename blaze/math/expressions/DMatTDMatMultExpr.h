@@ -40,6 +40,18 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/system/SMP.h>
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+#  include <omp.h>
+#  include <blaze/math/smp/openmp/Functions.h>
+#endif
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <blaze/math/smp/threads/ThreadBackend.h>
+#endif
+
+#include <cmath>
 #include <stdexcept>
 #include <blaze/math/blas/Level3.h>
 #include <blaze/math/constraints/DenseMatrix.h>
@@ -54,6 +66,9 @@
 #include <blaze/math/Intrinsics.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/BlockPartition.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/traits/ColumnExprTrait.h>
 #include <blaze/math/traits/DMatDVecMultExprTrait.h>
 #include <blaze/math/traits/DMatSVecMultExprTrait.h>
@@ -109,6 +124,8 @@
 #include <blaze/util/typetraits/IsFloat.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+#include <blaze/util/Unused.h>
 #include <blaze/util/valuetraits/IsTrue.h>
 
 
@@ -282,6 +299,26 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The IsSymmetricProduct struct is a helper struct for the detection of the multiplication
+       of a general dense matrix with its own transpose (i.e. \f$ A*A^T \f$ for a row-major or
+       \f$ A^T*A \f$ for a column-major matrix \f$ A \f$). In case one of the two operands is
+       the transpose of the other operand, the nested \a value will be set to 1, otherwise it
+       will be 0. Whether both operands refer to the same matrix is checked at runtime. */
+   template< typename T1, typename T2, typename T3 >
+   struct IsSymmetricProduct {
+      enum { value = ( IsSame< T3, DMatTransExpr<T2,true> >::value &&
+                       IsSame< T2, typename T2::ResultType >::value &&
+                       !IsTriangular<T2>::value ) ||
+                     ( IsSame< T2, DMatTransExpr<T3,false> >::value &&
+                       IsSame< T3, typename T3::ResultType >::value &&
+                       !IsTriangular<T3>::value ) };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef DMatTDMatMultExpr<MT1,MT2>                  This;           //!< Type of this DMatTDMatMultExpr instance.
@@ -475,6 +512,79 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    //**********************************************************************************************
 
  private:
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression represents the product of a matrix with its transpose.
+   //
+   // \return \a true in case the result of the multiplication is symmetric, \a false if not.
+   //
+   // This function returns \a true in case the expression represents a multiplication of the
+   // form \f$ A*A^T \f$ or \f$ A^T*A \f$, i.e. in case one operand is the transpose of the other
+   // operand and both operands refer to the same matrix. Since the operands are guaranteed to
+   // be plain matrices, the isAliased() check is equivalent to a test for identity.
+   */
+   inline bool isSymmetricProduct() const {
+      return IsSymmetricProduct<ResultType,MT1,MT2>::value &&
+             ( lhs_.isAliased( &rhs_ ) || rhs_.isAliased( &lhs_ ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Auxiliary functor for the threaded execution of a block of a SYRK computation.
+   //
+   // A SyrkTask either computes the rows \f$ [begin..end) \f$ of the lower triangle of the
+   // symmetric target matrix or mirrors the given rows/columns of the lower triangle to the
+   // upper triangle.
+   */
+   template< typename MT3    // Type of the target dense matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   struct SyrkTask
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the SyrkTask functor.
+      //
+      // \param C The target dense matrix.
+      // \param A The left-hand side matrix operand.
+      // \param B The right-hand side matrix operand.
+      // \param begin The first row/column of the block.
+      // \param end The end of the block.
+      // \param mirror \a true for the mirroring of the block, \a false for its computation.
+      */
+      explicit inline SyrkTask( MT3& C, const MT4& A, const MT5& B,
+                                size_t begin, size_t end, bool mirror )
+         : C_     ( &C     )  // The target dense matrix
+         , A_     ( &A     )  // The left-hand side matrix operand
+         , B_     ( &B     )  // The right-hand side matrix operand
+         , begin_ ( begin  )  // The first row/column of the block
+         , end_   ( end    )  // The end of the block
+         , mirror_( mirror )  // Flag for the mirroring of the block
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Computes or mirrors the block of the symmetric target matrix.
+      //
+      // \return void
+      */
+      inline void operator()() const {
+         if( mirror_ )
+            mirrorLowerTriangle( *C_, begin_, end_ );
+         else
+            selectSyrkKernel( *C_, *A_, *B_, begin_, end_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      MT3*       C_;       //!< The target dense matrix.
+      const MT4* A_;       //!< The left-hand side matrix operand.
+      const MT5* B_;       //!< The right-hand side matrix operand.
+      size_t     begin_;   //!< The first row/column of the block.
+      size_t     end_;     //!< The end of the block.
+      bool       mirror_;  //!< Flag for the mirroring of the block.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    LeftOperand  lhs_;  //!< Left-hand side dense matrix of the multiplication expression.
    RightOperand rhs_;  //!< Right-hand side dense matrix of the multiplication expression.
@@ -520,7 +630,10 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
       BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
 
-      DMatTDMatMultExpr::selectAssignKernel( ~lhs, A, B );
+      if( rhs.isSymmetricProduct() )
+         DMatTDMatMultExpr::selectSyrkAssignKernel( ~lhs, A, B );
+      else
+         DMatTDMatMultExpr::selectAssignKernel( ~lhs, A, B );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1639,6 +1752,425 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
 #endif
    //**********************************************************************************************
 
+   //**Symmetric assignment to dense matrices (kernel selection)***********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the kernel for an assignment of a symmetric dense matrix-transpose dense
+   //        matrix multiplication to a dense matrix (\f$ C=A*A^T \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function selects the kernel for the assignment of the product of a dense matrix with
+   // its own transpose. Since the result is symmetric, only the lower triangle of \a C is computed
+   // and afterwards mirrored to the upper triangle.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline void selectSyrkAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      if( C.rows() * C.columns() < DMATTDMATMULT_THRESHOLD )
+         selectDefaultSyrkAssignKernel( C, A, B );
+      else
+         selectBlasSyrkAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default symmetric assignment to dense matrices**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default assignment of a symmetric dense matrix-transpose dense matrix multiplication
+   //        (\f$ C=A*A^T \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the default assignment of the product of a dense matrix with its
+   // own transpose to a dense matrix. The lower triangle of \a C is computed by the (vectorized)
+   // SYRK kernel, the upper triangle is mirrored from the lower triangle.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline void selectDefaultSyrkAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      selectSyrkKernel( C, A, B, 0UL, A.rows() );
+      mirrorLowerTriangle( C, 0UL, A.rows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default SYRK kernel*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default computation of a row range of the lower triangle of a symmetric dense
+   //        matrix-transpose dense matrix multiplication (\f$ C=A*A^T \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param ibegin The first row of the row range.
+   // \param iend The end of the row range.
+   // \return void
+   //
+   // This function computes the elements \f$ C_{ij} \f$ with \f$ j \leq i \f$ of all rows in the
+   // range \f$ [ibegin..iend) \f$. The upper triangle of \a C is not referenced.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename DisableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
+      selectSyrkKernel( MT3& C, const MT4& A, const MT5& B, size_t ibegin, size_t iend )
+   {
+      const size_t K( A.columns() );
+
+      BLAZE_INTERNAL_ASSERT( K > 0UL, "Invalid number of columns detected" );
+
+      for( size_t i=ibegin; i<iend; ++i ) {
+         for( size_t j=0UL; j<=i; ++j ) {
+            C(i,j) = A(i,0UL) * B(0UL,j);
+            for( size_t k=1UL; k<K; ++k ) {
+               C(i,j) += A(i,k) * B(k,j);
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized default SYRK kernel**************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized computation of a row range of the lower triangle of a symmetric dense
+   //        matrix-transpose dense matrix multiplication (\f$ C=A*A^T \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param ibegin The first row of the row range.
+   // \param iend The end of the row range.
+   // \return void
+   //
+   // This function computes the elements \f$ C_{ij} \f$ with \f$ j \leq i \f$ of all rows in the
+   // range \f$ [ibegin..iend) \f$ by vectorized dot products of the rows of \a A and the columns
+   // of \a B, which are both stored contiguously in memory. Rows are processed in pairs, which
+   // additionally computes the element \f$ C_{i,i+1} \f$ above the diagonal. Since its value is
+   // identical to the mirrored element \f$ C_{i+1,i} \f$, this doesn't affect the result.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseVectorizedDefaultKernel<MT3,MT4,MT5> >::Type
+      selectSyrkKernel( MT3& C, const MT4& A, const MT5& B, size_t ibegin, size_t iend )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      const size_t K( A.columns() );
+
+      size_t i( ibegin );
+
+      for( ; (i+2UL) <= iend; i+=2UL )
+      {
+         const size_t jend( i+2UL );
+         size_t j( 0UL );
+
+         for( ; (j+4UL) <= jend; j+=4UL )
+         {
+            IntrinsicType xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8;
+
+            for( size_t k=0UL; k<K; k+=IT::size ) {
+               const IntrinsicType a1( A.load(i    ,k) );
+               const IntrinsicType a2( A.load(i+1UL,k) );
+               const IntrinsicType b1( B.load(k,j    ) );
+               const IntrinsicType b2( B.load(k,j+1UL) );
+               const IntrinsicType b3( B.load(k,j+2UL) );
+               const IntrinsicType b4( B.load(k,j+3UL) );
+               xmm1 = xmm1 + a1 * b1;
+               xmm2 = xmm2 + a1 * b2;
+               xmm3 = xmm3 + a1 * b3;
+               xmm4 = xmm4 + a1 * b4;
+               xmm5 = xmm5 + a2 * b1;
+               xmm6 = xmm6 + a2 * b2;
+               xmm7 = xmm7 + a2 * b3;
+               xmm8 = xmm8 + a2 * b4;
+            }
+
+            C(i    ,j    ) = sum( xmm1 );
+            C(i    ,j+1UL) = sum( xmm2 );
+            C(i    ,j+2UL) = sum( xmm3 );
+            C(i    ,j+3UL) = sum( xmm4 );
+            C(i+1UL,j    ) = sum( xmm5 );
+            C(i+1UL,j+1UL) = sum( xmm6 );
+            C(i+1UL,j+2UL) = sum( xmm7 );
+            C(i+1UL,j+3UL) = sum( xmm8 );
+         }
+
+         if( j < jend )
+         {
+            IntrinsicType xmm1, xmm2, xmm3, xmm4;
+
+            for( size_t k=0UL; k<K; k+=IT::size ) {
+               const IntrinsicType a1( A.load(i    ,k) );
+               const IntrinsicType a2( A.load(i+1UL,k) );
+               const IntrinsicType b1( B.load(k,j    ) );
+               const IntrinsicType b2( B.load(k,j+1UL) );
+               xmm1 = xmm1 + a1 * b1;
+               xmm2 = xmm2 + a1 * b2;
+               xmm3 = xmm3 + a2 * b1;
+               xmm4 = xmm4 + a2 * b2;
+            }
+
+            C(i    ,j    ) = sum( xmm1 );
+            C(i    ,j+1UL) = sum( xmm2 );
+            C(i+1UL,j    ) = sum( xmm3 );
+            C(i+1UL,j+1UL) = sum( xmm4 );
+         }
+      }
+
+      if( i < iend )
+      {
+         size_t j( 0UL );
+
+         for( ; (j+4UL) <= i+1UL; j+=4UL )
+         {
+            IntrinsicType xmm1, xmm2, xmm3, xmm4;
+
+            for( size_t k=0UL; k<K; k+=IT::size ) {
+               const IntrinsicType a1( A.load(i,k) );
+               xmm1 = xmm1 + a1 * B.load(k,j    );
+               xmm2 = xmm2 + a1 * B.load(k,j+1UL);
+               xmm3 = xmm3 + a1 * B.load(k,j+2UL);
+               xmm4 = xmm4 + a1 * B.load(k,j+3UL);
+            }
+
+            C(i,j    ) = sum( xmm1 );
+            C(i,j+1UL) = sum( xmm2 );
+            C(i,j+2UL) = sum( xmm3 );
+            C(i,j+3UL) = sum( xmm4 );
+         }
+
+         for( ; j<=i; ++j )
+         {
+            IntrinsicType xmm1;
+
+            for( size_t k=0UL; k<K; k+=IT::size ) {
+               xmm1 = xmm1 + A.load(i,k) * B.load(k,j);
+            }
+
+            C(i,j) = sum( xmm1 );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Mirroring of the lower triangle of row-major dense matrices*********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mirroring of the lower triangle of a row-major dense matrix to its upper triangle.
+   // \ingroup dense_matrix
+   //
+   // \param C The target square dense matrix.
+   // \param ibegin The first row of the upper triangle to be written.
+   // \param iend The end of the row range.
+   // \return void
+   //
+   // This function copies the elements \f$ C_{ji} \f$ to the elements \f$ C_{ij} \f$ with
+   // \f$ j > i \f$ of all rows in the range \f$ [ibegin..iend) \f$.
+   */
+   template< typename MT3 >  // Type of the target matrix
+   static inline void mirrorLowerTriangle( DenseMatrix<MT3,false>& C, size_t ibegin, size_t iend )
+   {
+      const size_t N( (~C).columns() );
+
+      for( size_t i=ibegin; i<iend; ++i ) {
+         for( size_t j=i+1UL; j<N; ++j ) {
+            (~C)(i,j) = (~C)(j,i);
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Mirroring of the lower triangle of column-major dense matrices******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Mirroring of the lower triangle of a column-major dense matrix to its upper triangle.
+   // \ingroup dense_matrix
+   //
+   // \param C The target square dense matrix.
+   // \param jbegin The first column of the upper triangle to be written.
+   // \param jend The end of the column range.
+   // \return void
+   //
+   // This function copies the elements \f$ C_{ji} \f$ to the elements \f$ C_{ij} \f$ with
+   // \f$ i < j \f$ of all columns in the range \f$ [jbegin..jend) \f$.
+   */
+   template< typename MT3 >  // Type of the target matrix
+   static inline void mirrorLowerTriangle( DenseMatrix<MT3,true>& C, size_t jbegin, size_t jend )
+   {
+      for( size_t j=jbegin; j<jend; ++j ) {
+         for( size_t i=0UL; i<j; ++i ) {
+            (~C)(i,j) = (~C)(j,i);
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default symmetric assignment to dense matrices (large matrices)*****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default assignment of a large symmetric dense matrix-transpose dense matrix
+   //        multiplication (\f$ C=A*A^T \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function relays to the default implementation of the assignment of the product of a
+   // dense matrix with its own transpose to a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseDefaultKernel<MT3,MT4,MT4> >::Type
+      selectBlasSyrkAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      selectDefaultSyrkAssignKernel( C, A, B );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**BLAS-based symmetric assignment to dense matrices (single precision)************************
+#if BLAZE_BLAS_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief BLAS-based assignment of a symmetric dense matrix-transpose dense matrix
+   //        multiplication for single precision matrices (\f$ C=A*A^T \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function computes the lower triangle of the product of a single precision dense
+   // matrix with its own transpose based on the according BLAS functionality and mirrors it
+   // to the upper triangle.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseSinglePrecisionKernel<MT3,MT4,MT4> >::Type
+      selectBlasSyrkAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      UNUSED_PARAMETER( B );
+
+      ssyrk( C, A, CblasLower, 1.0F, 0.0F );
+      mirrorLowerTriangle( C, 0UL, A.rows() );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
+   //**BLAS-based symmetric assignment to dense matrices (double precision)************************
+#if BLAZE_BLAS_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief BLAS-based assignment of a symmetric dense matrix-transpose dense matrix
+   //        multiplication for double precision matrices (\f$ C=A*A^T \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function computes the lower triangle of the product of a double precision dense
+   // matrix with its own transpose based on the according BLAS functionality and mirrors it
+   // to the upper triangle.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseDoublePrecisionKernel<MT3,MT4,MT4> >::Type
+      selectBlasSyrkAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      UNUSED_PARAMETER( B );
+
+      dsyrk( C, A, CblasLower, 1.0, 0.0 );
+      mirrorLowerTriangle( C, 0UL, A.rows() );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
+   //**BLAS-based symmetric assignment to dense matrices (single precision complex)****************
+#if BLAZE_BLAS_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief BLAS-based assignment of a symmetric dense matrix-transpose dense matrix
+   //        multiplication for single precision complex matrices (\f$ C=A*A^T \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function computes the lower triangle of the product of a single precision complex
+   // matrix with its own transpose based on the according BLAS functionality and mirrors it
+   // to the upper triangle.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseSinglePrecisionComplexKernel<MT3,MT4,MT4> >::Type
+      selectBlasSyrkAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      UNUSED_PARAMETER( B );
+
+      csyrk( C, A, CblasLower, complex<float>( 1.0F, 0.0F ), complex<float>( 0.0F, 0.0F ) );
+      mirrorLowerTriangle( C, 0UL, A.rows() );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
+   //**BLAS-based symmetric assignment to dense matrices (double precision complex)****************
+#if BLAZE_BLAS_MODE
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief BLAS-based assignment of a symmetric dense matrix-transpose dense matrix
+   //        multiplication for double precision complex matrices (\f$ C=A*A^T \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function computes the lower triangle of the product of a double precision complex
+   // matrix with its own transpose based on the according BLAS functionality and mirrors it
+   // to the upper triangle.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseDoublePrecisionComplexKernel<MT3,MT4,MT4> >::Type
+      selectBlasSyrkAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      UNUSED_PARAMETER( B );
+
+      zsyrk( C, A, CblasLower, complex<double>( 1.0, 0.0 ), complex<double>( 0.0, 0.0 ) );
+      mirrorLowerTriangle( C, 0UL, A.rows() );
+   }
+   /*! \endcond */
+#endif
+   //**********************************************************************************************
+
    //**Assignment to sparse matrices***************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense matrix-transpose dense matrix multiplication to a sparse matrix
@@ -3968,6 +4500,111 @@ class DMatTDMatMultExpr : public DenseMatrix< DMatTDMatMultExpr<MT1,MT2>, false
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP symmetric assignment to dense matrices**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a symmetric dense matrix-transpose dense matrix multiplication to
+   //        a dense matrix (\f$ C=A*A^T \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of the product of a dense
+   // matrix with its own transpose to a dense matrix. Due to the explicit application of the
+   // SFINAE principle, this function can only be selected by the compiler in case one operand is
+   // the transpose of the other operand. In case both operands refer to the same matrix, the
+   // lower triangle of the target matrix is computed in parallel (by means of OpenMP or the
+   // C++11/Boost thread backend) and afterwards mirrored to the upper triangle. The rows of the
+   // two phases are split via a BlockPartition with an increasing or decreasing workload profile
+   // such that every thread processes approximately the same number of elements. In all other
+   // cases the default SMP assignment is used.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline typename EnableIf< IsSymmetricProduct<MT,MT1,MT2> >::Type
+      smpAssign( DenseMatrix<MT,SO>& lhs, const DMatTDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+#if BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+      if( !isSerialSectionActive() && rhs.canSMPAssign() && rhs.isSymmetricProduct() )
+      {
+         if( rhs.lhs_.columns() == 0UL ) {
+            reset( ~lhs );
+            return;
+         }
+
+         LT A( rhs.lhs_ );  // Evaluation of the left-hand side dense matrix operand
+         RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+         const size_t M( A.rows() );
+         const BlockPartition::Profile profile( ( SO )?( BlockPartition::increasing )
+                                                      :( BlockPartition::decreasing ) );
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+         const int blocks( static_cast<int>( getAvailableThreads() ) );
+
+         const BlockPartition compute( M, blocks, 2UL, BlockPartition::increasing );
+         const BlockPartition mirror ( M, blocks, 1UL, profile );
+
+         BLAZE_PARALLEL_SECTION
+         {
+#pragma omp parallel shared( lhs, A, B ) num_threads( blocks )
+            {
+#pragma omp for schedule(static,1)
+               for( int b=0; b<blocks; ++b ) {
+                  selectSyrkKernel( ~lhs, A, B, compute.begin( b ), compute.begin( b+1 ) );
+               }
+
+#pragma omp for schedule(static,1)
+               for( int b=0; b<blocks; ++b ) {
+                  mirrorLowerTriangle( ~lhs, mirror.begin( b ), mirror.begin( b+1 ) );
+               }
+            }
+         }
+#else
+         typedef SyrkTask< MT, typename RemoveReference<LT>::Type
+                             , typename RemoveReference<RT>::Type >  Task;
+
+         BLAZE_PARALLEL_SECTION
+         {
+            const TheThreadBackend::Team team;
+
+            const size_t threads( team.size() );
+            const BlockPartition compute( M, threads, 2UL, BlockPartition::increasing );
+            const BlockPartition mirror ( M, threads, 1UL, profile );
+
+            for( size_t i=0UL; i<threads; ++i ) {
+               if( compute.begin( i ) != compute.begin( i+1UL ) )
+                  TheThreadBackend::context().schedule(
+                     Task( ~lhs, A, B, compute.begin( i ), compute.begin( i+1UL ), false ) );
+            }
+
+            TheThreadBackend::wait();
+
+            for( size_t i=0UL; i<threads; ++i ) {
+               if( mirror.begin( i ) != mirror.begin( i+1UL ) )
+                  TheThreadBackend::context().schedule(
+                     Task( ~lhs, A, B, mirror.begin( i ), mirror.begin( i+1UL ), true ) );
+            }
+
+            TheThreadBackend::wait();
+         }
+#endif
+
+         return;
+      }
+#endif
+
+      smpAssign( ~lhs, static_cast<const DenseMatrix<DMatTDMatMultExpr,false>&>( rhs ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse matrices***********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a dense matrix-transpose dense matrix multiplication to a sparse
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <stdexcept>
+#include <vector>
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/SparseMatrix.h>
@@ -65,6 +66,9 @@
 #include <blaze/math/traits/TSVecDMatMultExprTrait.h>
 #include <blaze/math/traits/TSVecSMatMultExprTrait.h>
 #include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/HasBlockStorage.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasSoAStorage.h>
 #include <blaze/math/typetraits/IsColumnVector.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
@@ -86,6 +90,7 @@
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Rows.h>
+#include <blaze/math/views/Forward.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
@@ -96,6 +101,7 @@
 #include <blaze/util/mpl/Or.h>
 #include <blaze/util/SelectType.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
 #include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 #include <blaze/util/valuetraits/IsTrue.h>
@@ -172,6 +178,28 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the sparse matrix is stored in the block compressed format and all three involved
+       data types are suited for a vectorized computation of the matrix multiplication, the nested
+       \value will be set to 1 and the block-wise kernel is selected for row-major targets.
+       Otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseBlockKernel {
+      enum { value = HasBlockStorage<T2>::value &&
+                     !IsDiagonal<T3>::value &&
+                     T1::vectorizable && T3::vectorizable &&
+                     IsRowMajorMatrix<T1>::value &&
+                     IsSame<typename T1::ElementType,typename T2::ElementType>::value &&
+                     IsSame<typename T1::ElementType,typename T3::ElementType>::value &&
+                     IntrinsicTrait<typename T1::ElementType>::addition &&
+                     IntrinsicTrait<typename T1::ElementType>::subtraction &&
+                     IntrinsicTrait<typename T1::ElementType>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
@@ -179,7 +207,8 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
        matrix multiplication, the nested \value will be set to 1, otherwise it will be 0. */
    template< typename T1, typename T2, typename T3 >
    struct UseVectorizedKernel {
-      enum { value = !IsDiagonal<T3>::value &&
+      enum { value = !UseBlockKernel<T1,T2,T3>::value &&
+                     !IsDiagonal<T3>::value &&
                      T1::vectorizable && T3::vectorizable &&
                      IsRowMajorMatrix<T1>::value &&
                      IsSame<typename T1::ElementType,typename T2::ElementType>::value &&
@@ -199,7 +228,8 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
        it will be 0. */
    template< typename T1, typename T2, typename T3 >
    struct UseOptimizedKernel {
-      enum { value = !UseVectorizedKernel<T1,T2,T3>::value &&
+      enum { value = !UseBlockKernel<T1,T2,T3>::value &&
+                     !UseVectorizedKernel<T1,T2,T3>::value &&
                      !IsDiagonal<T3>::value &&
                      !IsResizable<typename T1::ElementType>::value &&
                      !IsResizable<ET1>::value };
@@ -210,16 +240,36 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
-   /*! In case neither a vectorized nor optimized computation is possible, the nested \value will
-       be set to 1, otherwise it will be 0. */
+   /*! In case neither a block-wise, vectorized, nor optimized computation is possible, the nested
+       \value will be set to 1, otherwise it will be 0. */
    template< typename T1, typename T2, typename T3 >
    struct UseDefaultKernel {
-      enum { value = !UseVectorizedKernel<T1,T2,T3>::value &&
+      enum { value = !UseBlockKernel<T1,T2,T3>::value &&
+                     !UseVectorizedKernel<T1,T2,T3>::value &&
                      !UseOptimizedKernel<T1,T2,T3>::value };
    };
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the sparse matrix stores its indices and values in separate arrays and the elements
+       of the dense matrix operand can be accessed directly, the nested \value will be set to 1
+       and the gather-based kernel is selected for column-major targets. Otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseSoAKernel {
+      enum { value = HasSoAStorage<T2>::value &&
+                     HasConstDataAccess<T3>::value &&
+                     IsSame<typename T1::ElementType,typename T2::ElementType>::value &&
+                     IsSame<typename T1::ElementType,typename T3::ElementType>::value &&
+                     IsFloatingPoint<typename T1::ElementType>::value &&
+                     IntrinsicTrait<typename T1::ElementType>::addition &&
+                     IntrinsicTrait<typename T1::ElementType>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef SMatDMatMultExpr<MT1,MT2>                   This;           //!< Type of this SMatDMatMultExpr instance.
@@ -724,6 +774,76 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Block-wise assignment to row-major dense matrices********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Block-wise assignment of a block compressed matrix-dense matrix multiplication
+   //        to row-major dense matrices (\f$ A=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function relays the assignment of a block compressed matrix to the block-wise kernel.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseBlockKernel<MT3,MT4,MT5> >::Type
+      selectAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
+   {
+      reset( ~C );
+      SMatDMatMultExpr::blockAddAssignKernel( ~C, A, B, 0UL, A.rows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block-wise assignment to row-major dense matrices (submatrices)******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Block-wise assignment of a block compressed submatrix-dense matrix multiplication
+   //        to row-major dense matrices (\f$ A=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse submatrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function handles submatrices of a block compressed matrix, which result from the
+   // splitting of the multiplication during SMP assignments. In case the submatrix spans all
+   // columns of the underlying matrix, the block-wise kernel is applied to the according range
+   // of rows. Otherwise the multiplication is computed element by element.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the underlying sparse matrix
+           , bool AF         // Alignment flag of the submatrix
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseBlockKernel<MT3,SparseSubmatrix<MT4,AF,false>,MT5> >::Type
+      selectAssignKernel( DenseMatrix<MT3,false>& C, const SparseSubmatrix<MT4,AF,false>& A, const MT5& B )
+   {
+      typedef typename SparseSubmatrix<MT4,AF,false>::ConstIterator  ConstIterator;
+
+      reset( ~C );
+
+      if( A.column() == 0UL && A.columns() == A.operand().columns() ) {
+         SMatDMatMultExpr::blockAddAssignKernel( ~C, A.operand(), B, A.row(), A.row()+A.rows() );
+         return;
+      }
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         const ConstIterator end( A.end(i) );
+         for( ConstIterator element=A.begin(i); element!=end; ++element ) {
+            for( size_t j=0UL; j<B.columns(); ++j ) {
+               (~C)(i,j) += element->value() * B(element->index(),j);
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default assignment to column-major dense matrices*******************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a sparse matrix-dense matrix multiplication to column-major
@@ -741,7 +861,8 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline void selectAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
+   static inline typename DisableIf< UseSoAKernel<MT3,MT4,MT5> >::Type
+      selectAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
       typedef typename MT4::ConstIterator  ConstIterator;
 
@@ -805,6 +926,71 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Gather-based assignment to column-major dense matrices**************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Gather-based assignment of a sparse matrix-dense matrix multiplication to
+   //        column-major dense matrices (\f$ A=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the column-major assignment kernel for sparse matrices with
+   // structure-of-arrays storage. The column indices of each row of \a A are converted once
+   // into offsets within the row-major matrix \a B, which are subsequently used to gather the
+   // elements of all columns of \a B. The values of \a A are loaded contiguously.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseSoAKernel<MT3,MT4,MT5> >::Type
+      selectAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename MT4::IndexType      IndexType;
+
+      const ElementType* const data( B.data() );
+      const size_t spacing( B.spacing() );
+
+      std::vector<size_t> offsets;
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         const ElementType* const values ( A.values ( i ) );
+         const IndexType*   const indices( A.indices( i ) );
+
+         const size_t nonzeros( A.nonZeros( i ) );
+         const size_t kpos( nonzeros & size_t(-IT::size) );
+         BLAZE_INTERNAL_ASSERT( ( nonzeros - ( nonzeros % IT::size ) ) == kpos, "Invalid end calculation" );
+
+         offsets.resize( nonzeros );
+         for( size_t k=0UL; k<nonzeros; ++k ) {
+            offsets[k] = indices[k] * spacing;
+         }
+
+         for( size_t j=0UL; j<B.columns(); ++j )
+         {
+            IntrinsicType xmm1;
+
+            for( size_t k=0UL; k<kpos; k+=IT::size ) {
+               xmm1 = xmm1 + loadu( values+k ) * gather( data+j, &offsets[k] );
+            }
+
+            ElementType value( sum( xmm1 ) );
+
+            for( size_t k=kpos; k<nonzeros; ++k ) {
+               value += values[k] * data[offsets[k]+j];
+            }
+
+            (~C)(i,j) = value;
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse matrices***************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-dense matrix multiplication to a sparse matrix
@@ -1164,6 +1350,152 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Block-wise addition assignment to row-major dense matrices***********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Block-wise addition assignment of a block compressed matrix-dense matrix multiplication
+   //        to row-major dense matrices (\f$ A+=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function relays the addition assignment of a block compressed matrix to the block-wise
+   // kernel.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseBlockKernel<MT3,MT4,MT5> >::Type
+      selectAddAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
+   {
+      SMatDMatMultExpr::blockAddAssignKernel( ~C, A, B, 0UL, A.rows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block-wise addition assignment to row-major dense matrices (submatrices)*********************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Block-wise addition assignment of a block compressed submatrix-dense matrix
+   //        multiplication to row-major dense matrices (\f$ A+=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse submatrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function handles submatrices of a block compressed matrix, which result from the
+   // splitting of the multiplication during SMP assignments. In case the submatrix spans all
+   // columns of the underlying matrix, the block-wise kernel is applied to the according range
+   // of rows. Otherwise the multiplication is computed element by element.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the underlying sparse matrix
+           , bool AF         // Alignment flag of the submatrix
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseBlockKernel<MT3,SparseSubmatrix<MT4,AF,false>,MT5> >::Type
+      selectAddAssignKernel( DenseMatrix<MT3,false>& C, const SparseSubmatrix<MT4,AF,false>& A, const MT5& B )
+   {
+      typedef typename SparseSubmatrix<MT4,AF,false>::ConstIterator  ConstIterator;
+
+      if( A.column() == 0UL && A.columns() == A.operand().columns() ) {
+         SMatDMatMultExpr::blockAddAssignKernel( ~C, A.operand(), B, A.row(), A.row()+A.rows() );
+         return;
+      }
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         const ConstIterator end( A.end(i) );
+         for( ConstIterator element=A.begin(i); element!=end; ++element ) {
+            for( size_t j=0UL; j<B.columns(); ++j ) {
+               (~C)(i,j) += element->value() * B(element->index(),j);
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block-wise addition assignment kernel********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Block-wise addition assignment kernel for a range of rows of a block compressed matrix
+   //        (\f$ A+=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side block compressed matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \param rbegin The index of the first row to be computed.
+   // \param rend The index one past the last row to be computed.
+   // \return void
+   //
+   // This function computes the rows \f$ [rbegin..rend) \f$ of the product and adds them to
+   // the rows \f$ [0..rend-rbegin) \f$ of the target matrix. For every non-zero block the
+   // according rows of the dense matrix are loaded once per intrinsic column and reused for all
+   // rows of the block, whose elements are broadcast in advance.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline void blockAddAssignKernel( MT3& C, const MT4& A, const MT5& B, size_t rbegin, size_t rend )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename MT4::BlockType      BlockType;
+
+      enum { BR = MT4::rowsPerBlock };     // Number of rows per block
+      enum { BC = MT4::columnsPerBlock };  // Number of columns per block
+
+      if( rbegin >= rend )
+         return;
+
+      const size_t K     ( A.columns() );
+      const size_t N     ( B.columns() );
+      const size_t bbegin( rbegin / BR );
+      const size_t bend  ( ( rend - 1UL ) / BR + 1UL );
+
+      IntrinsicType a[BR*BC];
+      IntrinsicType b[BC];
+
+      for( size_t bi=bbegin; bi<bend; ++bi )
+      {
+         const size_t ibegin( max( bi*BR, rbegin ) );
+         const size_t iend  ( min( bi*BR+BR, rend ) );
+
+         for( size_t k=A.blockBegin( bi ); k<A.blockEnd( bi ); ++k )
+         {
+            const BlockType& block( A.block( k ) );
+            const size_t jbegin( A.blockIndex( k ) * BC );
+            const size_t jn( ( jbegin + BC <= K )?( size_t( BC ) ):( K - jbegin ) );
+
+            for( size_t i=ibegin; i<iend; ++i ) {
+               for( size_t j=0UL; j<jn; ++j ) {
+                  a[(i-bi*BR)*BC+j] = set( block(i-bi*BR,j) );
+               }
+            }
+
+            for( size_t l=0UL; l<N; l+=IT::size )
+            {
+               for( size_t j=0UL; j<jn; ++j ) {
+                  b[j] = B.load( jbegin+j, l );
+               }
+
+               for( size_t i=ibegin; i<iend; ++i )
+               {
+                  IntrinsicType xmm1( C.load( i-rbegin, l ) );
+                  for( size_t j=0UL; j<jn; ++j ) {
+                     xmm1 = xmm1 + a[(i-bi*BR)*BC+j] * b[j];
+                  }
+                  C.store( i-rbegin, l, xmm1 );
+               }
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default addition assignment to column-major dense matrices**********************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default addition assignment of a sparse matrix-dense matrix multiplication to
@@ -1181,7 +1513,8 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline void selectAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
+   static inline typename DisableIf< UseSoAKernel<MT3,MT4,MT5> >::Type
+      selectAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
       typedef typename MT4::ConstIterator  ConstIterator;
 
@@ -1225,6 +1558,71 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Gather-based addition assignment to column-major dense matrices*****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Gather-based addition assignment of a sparse matrix-dense matrix multiplication to
+   //        column-major dense matrices (\f$ A+=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the column-major addition assignment kernel for sparse matrices with
+   // structure-of-arrays storage. The column indices of each row of \a A are converted once
+   // into offsets within the row-major matrix \a B, which are subsequently used to gather the
+   // elements of all columns of \a B. The values of \a A are loaded contiguously.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseSoAKernel<MT3,MT4,MT5> >::Type
+      selectAddAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename MT4::IndexType      IndexType;
+
+      const ElementType* const data( B.data() );
+      const size_t spacing( B.spacing() );
+
+      std::vector<size_t> offsets;
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         const ElementType* const values ( A.values ( i ) );
+         const IndexType*   const indices( A.indices( i ) );
+
+         const size_t nonzeros( A.nonZeros( i ) );
+         const size_t kpos( nonzeros & size_t(-IT::size) );
+         BLAZE_INTERNAL_ASSERT( ( nonzeros - ( nonzeros % IT::size ) ) == kpos, "Invalid end calculation" );
+
+         offsets.resize( nonzeros );
+         for( size_t k=0UL; k<nonzeros; ++k ) {
+            offsets[k] = indices[k] * spacing;
+         }
+
+         for( size_t j=0UL; j<B.columns(); ++j )
+         {
+            IntrinsicType xmm1;
+
+            for( size_t k=0UL; k<kpos; k+=IT::size ) {
+               xmm1 = xmm1 + loadu( values+k ) * gather( data+j, &offsets[k] );
+            }
+
+            ElementType value( sum( xmm1 ) );
+
+            for( size_t k=kpos; k<nonzeros; ++k ) {
+               value += values[k] * data[offsets[k]+j];
+            }
+
+            (~C)(i,j) += value;
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring addition assignment to column-major matrices**********************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring addition assignment of a sparse matrix-dense matrix multiplication to
@@ -1551,6 +1949,152 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Block-wise subtraction assignment to row-major dense matrices********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Block-wise subtraction assignment of a block compressed matrix-dense matrix
+   //        multiplication to row-major dense matrices (\f$ A-=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment of a block compressed matrix to the block-wise
+   // kernel.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseBlockKernel<MT3,MT4,MT5> >::Type
+      selectSubAssignKernel( DenseMatrix<MT3,false>& C, const MT4& A, const MT5& B )
+   {
+      SMatDMatMultExpr::blockSubAssignKernel( ~C, A, B, 0UL, A.rows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block-wise subtraction assignment to row-major dense matrices (submatrices)******************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Block-wise subtraction assignment of a block compressed submatrix-dense matrix
+   //        multiplication to row-major dense matrices (\f$ A-=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse submatrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function handles submatrices of a block compressed matrix, which result from the
+   // splitting of the multiplication during SMP assignments. In case the submatrix spans all
+   // columns of the underlying matrix, the block-wise kernel is applied to the according range
+   // of rows. Otherwise the multiplication is computed element by element.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the underlying sparse matrix
+           , bool AF         // Alignment flag of the submatrix
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseBlockKernel<MT3,SparseSubmatrix<MT4,AF,false>,MT5> >::Type
+      selectSubAssignKernel( DenseMatrix<MT3,false>& C, const SparseSubmatrix<MT4,AF,false>& A, const MT5& B )
+   {
+      typedef typename SparseSubmatrix<MT4,AF,false>::ConstIterator  ConstIterator;
+
+      if( A.column() == 0UL && A.columns() == A.operand().columns() ) {
+         SMatDMatMultExpr::blockSubAssignKernel( ~C, A.operand(), B, A.row(), A.row()+A.rows() );
+         return;
+      }
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         const ConstIterator end( A.end(i) );
+         for( ConstIterator element=A.begin(i); element!=end; ++element ) {
+            for( size_t j=0UL; j<B.columns(); ++j ) {
+               (~C)(i,j) -= element->value() * B(element->index(),j);
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block-wise subtraction assignment kernel*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Block-wise subtraction assignment kernel for a range of rows of a block compressed
+   //        matrix (\f$ A-=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side block compressed matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \param rbegin The index of the first row to be computed.
+   // \param rend The index one past the last row to be computed.
+   // \return void
+   //
+   // This function computes the rows \f$ [rbegin..rend) \f$ of the product and subtracts them from
+   // the rows \f$ [0..rend-rbegin) \f$ of the target matrix. For every non-zero block the
+   // according rows of the dense matrix are loaded once per intrinsic column and reused for all
+   // rows of the block, whose elements are broadcast in advance.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline void blockSubAssignKernel( MT3& C, const MT4& A, const MT5& B, size_t rbegin, size_t rend )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename MT4::BlockType      BlockType;
+
+      enum { BR = MT4::rowsPerBlock };     // Number of rows per block
+      enum { BC = MT4::columnsPerBlock };  // Number of columns per block
+
+      if( rbegin >= rend )
+         return;
+
+      const size_t K     ( A.columns() );
+      const size_t N     ( B.columns() );
+      const size_t bbegin( rbegin / BR );
+      const size_t bend  ( ( rend - 1UL ) / BR + 1UL );
+
+      IntrinsicType a[BR*BC];
+      IntrinsicType b[BC];
+
+      for( size_t bi=bbegin; bi<bend; ++bi )
+      {
+         const size_t ibegin( max( bi*BR, rbegin ) );
+         const size_t iend  ( min( bi*BR+BR, rend ) );
+
+         for( size_t k=A.blockBegin( bi ); k<A.blockEnd( bi ); ++k )
+         {
+            const BlockType& block( A.block( k ) );
+            const size_t jbegin( A.blockIndex( k ) * BC );
+            const size_t jn( ( jbegin + BC <= K )?( size_t( BC ) ):( K - jbegin ) );
+
+            for( size_t i=ibegin; i<iend; ++i ) {
+               for( size_t j=0UL; j<jn; ++j ) {
+                  a[(i-bi*BR)*BC+j] = set( block(i-bi*BR,j) );
+               }
+            }
+
+            for( size_t l=0UL; l<N; l+=IT::size )
+            {
+               for( size_t j=0UL; j<jn; ++j ) {
+                  b[j] = B.load( jbegin+j, l );
+               }
+
+               for( size_t i=ibegin; i<iend; ++i )
+               {
+                  IntrinsicType xmm1( C.load( i-rbegin, l ) );
+                  for( size_t j=0UL; j<jn; ++j ) {
+                     xmm1 = xmm1 - a[(i-bi*BR)*BC+j] * b[j];
+                  }
+                  C.store( i-rbegin, l, xmm1 );
+               }
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default subtraction assignment to column-major dense matrices*******************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default subtraction assignment of a sparse matrix-dense matrix multiplication to
@@ -1568,7 +2112,8 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline void selectSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
+   static inline typename DisableIf< UseSoAKernel<MT3,MT4,MT5> >::Type
+      selectSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
    {
       typedef typename MT4::ConstIterator  ConstIterator;
 
@@ -1612,6 +2157,71 @@ class SMatDMatMultExpr : public DenseMatrix< SMatDMatMultExpr<MT1,MT2>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Gather-based subtraction assignment to column-major dense matrices**************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Gather-based subtraction assignment of a sparse matrix-dense matrix multiplication to
+   //        column-major dense matrices (\f$ A-=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the column-major subtraction assignment kernel for sparse matrices with
+   // structure-of-arrays storage. The column indices of each row of \a A are converted once
+   // into offsets within the row-major matrix \a B, which are subsequently used to gather the
+   // elements of all columns of \a B. The values of \a A are loaded contiguously.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseSoAKernel<MT3,MT4,MT5> >::Type
+      selectSubAssignKernel( DenseMatrix<MT3,true>& C, const MT4& A, const MT5& B )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename MT4::IndexType      IndexType;
+
+      const ElementType* const data( B.data() );
+      const size_t spacing( B.spacing() );
+
+      std::vector<size_t> offsets;
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         const ElementType* const values ( A.values ( i ) );
+         const IndexType*   const indices( A.indices( i ) );
+
+         const size_t nonzeros( A.nonZeros( i ) );
+         const size_t kpos( nonzeros & size_t(-IT::size) );
+         BLAZE_INTERNAL_ASSERT( ( nonzeros - ( nonzeros % IT::size ) ) == kpos, "Invalid end calculation" );
+
+         offsets.resize( nonzeros );
+         for( size_t k=0UL; k<nonzeros; ++k ) {
+            offsets[k] = indices[k] * spacing;
+         }
+
+         for( size_t j=0UL; j<B.columns(); ++j )
+         {
+            IntrinsicType xmm1;
+
+            for( size_t k=0UL; k<kpos; k+=IT::size ) {
+               xmm1 = xmm1 + loadu( values+k ) * gather( data+j, &offsets[k] );
+            }
+
+            ElementType value( sum( xmm1 ) );
+
+            for( size_t k=kpos; k<nonzeros; ++k ) {
+               value += values[k] * data[offsets[k]+j];
+            }
+
+            (~C)(i,j) -= value;
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring subtraction assignment to column-major matrices*******************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring subtraction assignment of a sparse matrix-dense matrix multiplication
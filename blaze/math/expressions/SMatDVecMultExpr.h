@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
 #include <stdexcept>
 #include <blaze/math/constraints/DenseVector.h>
 #include <blaze/math/constraints/MatVecMultExpr.h>
@@ -51,26 +52,37 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatVecMultExpr.h>
+#include <blaze/math/Intrinsics.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/traits/MultExprTrait.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/typetraits/HasBlockStorage.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasHalfStorage.h>
+#include <blaze/math/typetraits/HasSlicedEllpackStorage.h>
+#include <blaze/math/typetraits/HasSoAStorage.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Rows.h>
 #include <blaze/math/typetraits/Size.h>
+#include <blaze/math/views/Forward.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Reference.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/Or.h>
 #include <blaze/util/SelectType.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -113,15 +125,113 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
    enum { evaluateVector = IsComputation<VT>::value || RequiresEvaluation<VT>::value };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the sparse matrix stores its indices and values in separate arrays and the dense
+       vector provides direct access to its elements, the nested \a value will be set to 1 and
+       the gather-based kernel is selected. Otherwise it will be 0. */
+   template< typename T1, typename T2 >
+   struct UseSoAKernel {
+      typedef typename RemoveReference<T1>::Type  MT1;
+      typedef typename RemoveReference<T2>::Type  VT1;
+      enum { value = HasSoAStorage<MT1>::value &&
+                     HasConstDataAccess<VT1>::value &&
+                     IsSame<typename MT1::ElementType,typename VT1::ElementType>::value &&
+                     IsFloatingPoint<typename MT1::ElementType>::value &&
+                     IntrinsicTrait<typename MT1::ElementType>::addition &&
+                     IntrinsicTrait<typename MT1::ElementType>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the sparse matrix is stored in the sliced ELLPACK format and the dense vector
+       provides direct access to its elements, the nested \a value will be set to 1 and the
+       chunk-wise vectorized kernel is selected. Otherwise it will be 0. */
+   template< typename T1, typename T2 >
+   struct UseSellKernel {
+      typedef typename RemoveReference<T1>::Type  MT1;
+      typedef typename RemoveReference<T2>::Type  VT1;
+      enum { value = HasSlicedEllpackStorage<MT1>::value &&
+                     HasConstDataAccess<VT1>::value &&
+                     IsSame<typename MT1::ElementType,typename VT1::ElementType>::value &&
+                     IsFloatingPoint<typename MT1::ElementType>::value &&
+                     IntrinsicTrait<typename MT1::ElementType>::addition &&
+                     IntrinsicTrait<typename MT1::ElementType>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the sparse matrix is stored in the block compressed format and the element type
+       of the matrix and the dense vector is vectorizable, the nested \a value will be set to 1
+       and the block-wise vectorized kernel is selected. Otherwise it will be 0. */
+   template< typename T1, typename T2 >
+   struct UseBlockKernel {
+      typedef typename RemoveReference<T1>::Type  MT1;
+      typedef typename RemoveReference<T2>::Type  VT1;
+      enum { value = HasBlockStorage<MT1>::value &&
+                     IsSame<typename MT1::ElementType,typename VT1::ElementType>::value &&
+                     IntrinsicTrait<typename MT1::ElementType>::addition &&
+                     IntrinsicTrait<typename MT1::ElementType>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the sparse matrix is a symmetric matrix that stores only a single triangle, the
+       nested \a value will be set to 1 and the half storage kernel is selected. Otherwise it
+       will be 0. */
+   template< typename T1, typename T2 >
+   struct UseHalfKernel {
+      typedef typename RemoveReference<T1>::Type  MT1;
+      enum { value = HasHalfStorage<MT1>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the gather-based kernel for structure-of-arrays sparse matrices.
+   enum { useSoAKernel = UseSoAKernel< typename SelectType< evaluateMatrix, MRT, MCT >::Type
+                                     , typename SelectType< evaluateVector, VRT, VCT >::Type >::value };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the chunk-wise kernel for sliced ELLPACK sparse matrices.
+   enum { useSellKernel = UseSellKernel< typename SelectType< evaluateMatrix, MRT, MCT >::Type
+                                       , typename SelectType< evaluateVector, VRT, VCT >::Type >::value };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the block-wise kernel for block compressed sparse matrices.
+   enum { useBlockKernel = UseBlockKernel< typename SelectType< evaluateMatrix, MRT, MCT >::Type
+                                         , typename SelectType< evaluateVector, VRT, VCT >::Type >::value };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the half storage kernel for symmetric sparse matrices.
+   enum { useHalfKernel = UseHalfKernel< typename SelectType< evaluateMatrix, MRT, MCT >::Type
+                                       , typename SelectType< evaluateVector, VRT, VCT >::Type >::value };
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Compilation switch for the evaluation strategy of the multiplication expression.
    /*! The \a useAssign compile time constant expression represents a compilation switch for
        the evaluation strategy of the multiplication expression. In case either the matrix or
-       the vector operand requires an intermediate evaluation or the dense vector expression
-       is a compound expression, \a useAssign will be set to \a true and the multiplication
-       expression will be evaluated via the \a assign function family. Otherwise \a useAssign
-       will be set to \a false and the expression will be evaluated via the subscript operator. */
-   enum { useAssign = evaluateMatrix || evaluateVector };
+       the vector operand requires an intermediate evaluation, the dense vector expression is a
+       compound expression, or the gather-based, chunk-wise, block-wise, or half storage kernel
+       can be used, \a useAssign will be set to \a true and the multiplication expression will
+       be evaluated via the \a assign function family. Otherwise \a useAssign will be set to
+       \a false and the expression will be evaluated via the subscript operator. */
+   enum { useAssign = evaluateMatrix || evaluateVector || useSoAKernel || useSellKernel ||
+                      useBlockKernel || useHalfKernel };
    //**********************************************************************************************
 
    //**********************************************************************************************
@@ -142,18 +252,19 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
        evaluation, the nested \value will be set to 1, otherwise it will be 0. */
    template< typename T1 >
    struct UseSMPAssign {
-      enum { value = useAssign };
+      enum { value = evaluateMatrix || evaluateVector };
    };
    /*! \endcond */
    //**********************************************************************************************
 
  public:
    //**Type definitions****************************************************************************
-   typedef SMatDVecMultExpr<MT,VT>             This;           //!< Type of this SMatDVecMultExpr instance.
-   typedef typename MultTrait<MRT,VRT>::Type   ResultType;     //!< Result type for expression template evaluations.
-   typedef typename ResultType::TransposeType  TransposeType;  //!< Transpose type for expression template evaluations.
-   typedef typename ResultType::ElementType    ElementType;    //!< Resulting element type.
-   typedef const ElementType                   ReturnType;     //!< Return type for expression template evaluations.
+   typedef SMatDVecMultExpr<MT,VT>                     This;           //!< Type of this SMatDVecMultExpr instance.
+   typedef typename MultTrait<MRT,VRT>::Type           ResultType;     //!< Result type for expression template evaluations.
+   typedef typename ResultType::TransposeType          TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef typename ResultType::ElementType            ElementType;    //!< Resulting element type.
+   typedef typename IntrinsicTrait<ElementType>::Type  IntrinsicType;  //!< Resulting intrinsic element type.
+   typedef const ElementType                           ReturnType;     //!< Return type for expression template evaluations.
 
    //! Data type for composite expression templates.
    typedef typename SelectType< useAssign, const ResultType, const SMatDVecMultExpr& >::Type  CompositeType;
@@ -388,7 +499,459 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      assign( ~lhs, A * x );
+      SMatDVecMultExpr::selectAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default assignment to dense vectors*********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default assignment of a sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the assignment to the evaluation via the subscript operator.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename DisableIf< Or< UseSoAKernel<MT1,VT2>, UseSellKernel<MT1,VT2>
+                                    , UseBlockKernel<MT1,VT2>, UseHalfKernel<MT1,VT2> > >::Type
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      assign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Gather-based assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Gather-based assignment of a sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the assignment kernel for sparse matrices with structure-of-arrays
+   // storage. The values of each row are loaded contiguously and the corresponding elements of
+   // the dense vector are collected via gather operations.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseSoAKernel<MT1,VT2> >::Type
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename MT1::IndexType      IndexType;
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         const ElementType* const values ( A.values ( i ) );
+         const IndexType*   const indices( A.indices( i ) );
+
+         const size_t nonzeros( A.nonZeros( i ) );
+         const size_t kpos( nonzeros & size_t(-IT::size) );
+         BLAZE_INTERNAL_ASSERT( ( nonzeros - ( nonzeros % IT::size ) ) == kpos, "Invalid end calculation" );
+
+         IntrinsicType xmm1;
+
+         for( size_t k=0UL; k<kpos; k+=IT::size ) {
+            xmm1 = xmm1 + loadu( values+k ) * gather( x.data(), indices+k );
+         }
+
+         ElementType value( sum( xmm1 ) );
+
+         for( size_t k=kpos; k<nonzeros; ++k ) {
+            value += values[k] * x[indices[k]];
+         }
+
+         y[i] = value;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Chunk-wise assignment to dense vectors*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Chunk-wise assignment of a sliced ELLPACK matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the assignment of a sliced ELLPACK matrix to the chunk-wise kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseSellKernel<MT1,VT2> >::Type
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      SMatDVecMultExpr::sellAssignKernel( y, A, x, 0UL, A.rows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Chunk-wise assignment to dense vectors (submatrices)*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Chunk-wise assignment of a sliced ELLPACK submatrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse submatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function handles submatrices of a sliced ELLPACK matrix, which result from the
+   // splitting of the multiplication during SMP assignments. In case the submatrix spans all
+   // columns of the underlying matrix, the chunk-wise kernel is applied to the according range
+   // of rows. Otherwise the multiplication is computed row by row.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the underlying sparse matrix
+           , bool AF         // Alignment flag of the submatrix
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseSellKernel<SparseSubmatrix<MT1,AF,false>,VT2> >::Type
+      selectAssignKernel( VT1& y, const SparseSubmatrix<MT1,AF,false>& A, const VT2& x )
+   {
+      typedef typename SparseSubmatrix<MT1,AF,false>::ConstIterator  ConstIterator;
+
+      if( A.column() == 0UL && A.columns() == A.operand().columns() ) {
+         SMatDVecMultExpr::sellAssignKernel( y, A.operand(), x, A.row(), A.row()+A.rows() );
+         return;
+      }
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         ElementType value = ElementType();
+
+         const ConstIterator end( A.end(i) );
+         for( ConstIterator element=A.begin(i); element!=end; ++element ) {
+            value += element->value() * x[element->index()];
+         }
+
+         y[i] = value;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Chunk-wise assignment kernel*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Chunk-wise assignment kernel for a range of rows of a sliced ELLPACK matrix
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sliced ELLPACK matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param rbegin The index of the first row to be computed.
+   // \param rend The index one past the last row to be computed.
+   // \return void
+   //
+   // This function computes the rows \f$ [rbegin..rend) \f$ of the product and writes them
+   // to the elements \f$ [0..rend-rbegin) \f$ of the target vector. All rows of a chunk are
+   // computed simultaneously by means of aligned loads of the interleaved values and gather
+   // operations on the dense vector. Since the rows are sorted within windows of \a sigma
+   // rows, all chunks of the windows touching the given range are processed.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline void sellAssignKernel( VT1& y, const MT1& A, const VT2& x, size_t rbegin, size_t rend )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename MT1::IndexType      IndexType;
+
+      BLAZE_INTERNAL_ASSERT( size_t( MT1::chunkSize ) == size_t( IT::size ), "Invalid chunk size" );
+
+      if( rbegin >= rend )
+         return;
+
+      const size_t sigma ( A.sigma() );
+      const size_t kbegin( ( rbegin / sigma ) * ( sigma / IT::size ) );
+      const size_t kend  ( min( A.chunks(), ( ( rend - 1UL ) / sigma + 1UL ) * ( sigma / IT::size ) ) );
+
+      ElementType tmp[IT::size];
+
+      for( size_t k=kbegin; k<kend; ++k )
+      {
+         const ElementType* const values ( A.chunkValues ( k ) );
+         const IndexType*   const indices( A.chunkIndices( k ) );
+         const size_t*      const rows   ( A.chunkRows   ( k ) );
+
+         const size_t length( A.chunkLength( k ) * IT::size );
+
+         IntrinsicType xmm1;
+
+         for( size_t l=0UL; l<length; l+=IT::size ) {
+            xmm1 = xmm1 + load( values+l ) * gather( x.data(), indices+l );
+         }
+
+         storeu( tmp, xmm1 );
+
+         for( size_t s=0UL; s<IT::size; ++s ) {
+            if( rows[s] >= rbegin && rows[s] < rend )
+               y[rows[s]-rbegin] = tmp[s];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block-wise assignment to dense vectors*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Block-wise assignment of a block compressed matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the assignment of a block compressed matrix to the block-wise kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseBlockKernel<MT1,VT2> >::Type
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      SMatDVecMultExpr::blockAssignKernel( y, A, x, 0UL, A.rows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block-wise assignment to dense vectors (submatrices)*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Block-wise assignment of a block compressed submatrix-dense vector
+   //        multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse submatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function handles submatrices of a block compressed matrix, which result from the
+   // splitting of the multiplication during SMP assignments. In case the submatrix spans all
+   // columns of the underlying matrix, the block-wise kernel is applied to the according range
+   // of rows. Otherwise the multiplication is computed row by row.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the underlying sparse matrix
+           , bool AF         // Alignment flag of the submatrix
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseBlockKernel<SparseSubmatrix<MT1,AF,false>,VT2> >::Type
+      selectAssignKernel( VT1& y, const SparseSubmatrix<MT1,AF,false>& A, const VT2& x )
+   {
+      typedef typename SparseSubmatrix<MT1,AF,false>::ConstIterator  ConstIterator;
+
+      if( A.column() == 0UL && A.columns() == A.operand().columns() ) {
+         SMatDVecMultExpr::blockAssignKernel( y, A.operand(), x, A.row(), A.row()+A.rows() );
+         return;
+      }
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         ElementType value = ElementType();
+
+         const ConstIterator end( A.end(i) );
+         for( ConstIterator element=A.begin(i); element!=end; ++element ) {
+            value += element->value() * x[element->index()];
+         }
+
+         y[i] = value;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block-wise assignment kernel*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Block-wise assignment kernel for a range of rows of a block compressed matrix
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side block compressed matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param rbegin The index of the first row to be computed.
+   // \param rend The index one past the last row to be computed.
+   // \return void
+   //
+   // This function computes the rows \f$ [rbegin..rend) \f$ of the product and writes them to
+   // the elements \f$ [0..rend-rbegin) \f$ of the target vector. All rows of a block row are
+   // computed simultaneously: each column of a non-zero block is loaded by means of aligned
+   // loads and multiplied with the broadcast element of the dense vector. Block rows that are
+   // only partially contained in the given range are computed completely, but only the rows
+   // within the range are written.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline void blockAssignKernel( VT1& y, const MT1& A, const VT2& x, size_t rbegin, size_t rend )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename MT1::BlockType      BlockType;
+
+      enum { R = MT1::rowsPerBlock };
+      enum { C = MT1::columnsPerBlock };
+      enum { NR = ( R + IT::size - 1UL ) / IT::size };
+
+      if( rbegin >= rend )
+         return;
+
+      const size_t N     ( A.columns() );
+      const size_t bbegin( rbegin / R );
+      const size_t bend  ( ( rend - 1UL ) / R + 1UL );
+
+      ElementType tmp[NR*IT::size];
+
+      for( size_t bi=bbegin; bi<bend; ++bi )
+      {
+         IntrinsicType xmm[NR];
+
+         for( size_t k=A.blockBegin( bi ); k<A.blockEnd( bi ); ++k )
+         {
+            const BlockType& block( A.block( k ) );
+            const size_t jbegin( A.blockIndex( k ) * C );
+            const size_t jn( ( jbegin + C <= N )?( size_t( C ) ):( N - jbegin ) );
+
+            for( size_t j=0UL; j<jn; ++j ) {
+               const IntrinsicType x1( set( x[jbegin+j] ) );
+               for( size_t r=0UL; r<NR; ++r ) {
+                  xmm[r] = xmm[r] + block.load( r*IT::size, j ) * x1;
+               }
+            }
+         }
+
+         for( size_t r=0UL; r<NR; ++r ) {
+            storeu( tmp+r*IT::size, xmm[r] );
+         }
+
+         const size_t ibegin( max( bi*R, rbegin ) );
+         const size_t iend  ( min( bi*R+R, rend ) );
+
+         for( size_t i=ibegin; i<iend; ++i ) {
+            y[i-rbegin] = tmp[i-bi*R];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Half storage assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a symmetric half storage matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the assignment of a symmetric matrix storing a single triangle to the
+   // half storage kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseHalfKernel<MT1,VT2> >::Type
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      SMatDVecMultExpr::halfAssignKernel( y, A, x, 0UL, A.rows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Half storage assignment to dense vectors (submatrices)***************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a symmetric half storage submatrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse submatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function handles submatrices of a symmetric half storage matrix, which result from the
+   // splitting of the multiplication during SMP assignments. In case the submatrix spans all
+   // columns of the underlying matrix, the half storage kernel is applied to the according range
+   // of rows. Otherwise the multiplication is computed row by row.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the underlying sparse matrix
+           , bool AF         // Alignment flag of the submatrix
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseHalfKernel<SparseSubmatrix<MT1,AF,false>,VT2> >::Type
+      selectAssignKernel( VT1& y, const SparseSubmatrix<MT1,AF,false>& A, const VT2& x )
+   {
+      typedef typename SparseSubmatrix<MT1,AF,false>::ConstIterator  ConstIterator;
+
+      if( A.column() == 0UL && A.columns() == A.operand().columns() ) {
+         SMatDVecMultExpr::halfAssignKernel( y, A.operand(), x, A.row(), A.row()+A.rows() );
+         return;
+      }
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         ElementType value = ElementType();
+
+         const ConstIterator end( A.end(i) );
+         for( ConstIterator element=A.begin(i); element!=end; ++element ) {
+            value += element->value() * x[element->index()];
+         }
+
+         y[i] = value;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Half storage assignment kernel***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment kernel for a range of rows of a symmetric half storage matrix
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side symmetric half storage matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param rbegin The index of the first row to be computed.
+   // \param rend The index one past the last row to be computed.
+   // \return void
+   //
+   // This function computes the rows \f$ [rbegin..rend) \f$ of the product and writes them to
+   // the elements \f$ [0..rend-rbegin) \f$ of the target vector by means of the according
+   // addition assignment kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline void halfAssignKernel( VT1& y, const MT1& A, const VT2& x, size_t rbegin, size_t rend )
+   {
+      for( size_t i=rbegin; i<rend; ++i ) {
+         reset( y[i-rbegin] );
+      }
+
+      SMatDVecMultExpr::halfAddAssignKernel( y, A, x, rbegin, rend );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -465,27 +1028,529 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      addAssign( ~lhs, A * x );
+      SMatDVecMultExpr::selectAddAssignKernel( ~lhs, A, x );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**Addition assignment to sparse vectors*******************************************************
-   // No special implementation for the addition assignment to sparse vectors.
-   //**********************************************************************************************
-
-   //**Subtraction assignment to dense vectors*****************************************************
+   //**Default addition assignment to dense vectors************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Subtraction assignment of a sparse matrix-dense vector multiplication to a dense
-   //        vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   /*!\brief Default addition assignment of a sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
    // \ingroup dense_vector
    //
-   // \param lhs The target left-hand side dense vector.
-   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
    // \return void
    //
-   // This function implements the performance optimized subtraction assignment of a sparse matrix-
-   // dense vector multiplication expression to a dense vector. Due to the explicit application
+   // This function relays the addition assignment to the evaluation via the subscript operator.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename DisableIf< Or< UseSoAKernel<MT1,VT2>, UseSellKernel<MT1,VT2>
+                                    , UseBlockKernel<MT1,VT2>, UseHalfKernel<MT1,VT2> > >::Type
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      addAssign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Gather-based addition assignment to dense vectors*******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Gather-based addition assignment of a sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the addition assignment kernel for sparse matrices with
+   // structure-of-arrays storage. The values of each row are loaded contiguously and the
+   // corresponding elements of the dense vector are collected via gather operations.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseSoAKernel<MT1,VT2> >::Type
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename MT1::IndexType      IndexType;
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         const ElementType* const values ( A.values ( i ) );
+         const IndexType*   const indices( A.indices( i ) );
+
+         const size_t nonzeros( A.nonZeros( i ) );
+         const size_t kpos( nonzeros & size_t(-IT::size) );
+         BLAZE_INTERNAL_ASSERT( ( nonzeros - ( nonzeros % IT::size ) ) == kpos, "Invalid end calculation" );
+
+         IntrinsicType xmm1;
+
+         for( size_t k=0UL; k<kpos; k+=IT::size ) {
+            xmm1 = xmm1 + loadu( values+k ) * gather( x.data(), indices+k );
+         }
+
+         ElementType value( sum( xmm1 ) );
+
+         for( size_t k=kpos; k<nonzeros; ++k ) {
+            value += values[k] * x[indices[k]];
+         }
+
+         y[i] += value;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Chunk-wise addition assignment to dense vectors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Chunk-wise addition assignment of a sliced ELLPACK matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the addition assignment of a sliced ELLPACK matrix to the chunk-wise
+   // kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseSellKernel<MT1,VT2> >::Type
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      SMatDVecMultExpr::sellAddAssignKernel( y, A, x, 0UL, A.rows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Chunk-wise addition assignment to dense vectors (submatrices)********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Chunk-wise addition assignment of a sliced ELLPACK submatrix-dense vector
+   //        multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse submatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function handles submatrices of a sliced ELLPACK matrix, which result from the
+   // splitting of the multiplication during SMP assignments. In case the submatrix spans all
+   // columns of the underlying matrix, the chunk-wise kernel is applied to the according range
+   // of rows. Otherwise the multiplication is computed row by row.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the underlying sparse matrix
+           , bool AF         // Alignment flag of the submatrix
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseSellKernel<SparseSubmatrix<MT1,AF,false>,VT2> >::Type
+      selectAddAssignKernel( VT1& y, const SparseSubmatrix<MT1,AF,false>& A, const VT2& x )
+   {
+      typedef typename SparseSubmatrix<MT1,AF,false>::ConstIterator  ConstIterator;
+
+      if( A.column() == 0UL && A.columns() == A.operand().columns() ) {
+         SMatDVecMultExpr::sellAddAssignKernel( y, A.operand(), x, A.row(), A.row()+A.rows() );
+         return;
+      }
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         ElementType value = ElementType();
+
+         const ConstIterator end( A.end(i) );
+         for( ConstIterator element=A.begin(i); element!=end; ++element ) {
+            value += element->value() * x[element->index()];
+         }
+
+         y[i] += value;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Chunk-wise addition assignment kernel********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Chunk-wise addition assignment kernel for a range of rows of a sliced ELLPACK matrix
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sliced ELLPACK matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param rbegin The index of the first row to be computed.
+   // \param rend The index one past the last row to be computed.
+   // \return void
+   //
+   // This function computes the rows \f$ [rbegin..rend) \f$ of the product and adds them
+   // to the elements \f$ [0..rend-rbegin) \f$ of the target vector. All rows of a chunk are
+   // computed simultaneously by means of aligned loads of the interleaved values and gather
+   // operations on the dense vector. Since the rows are sorted within windows of \a sigma
+   // rows, all chunks of the windows touching the given range are processed.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline void sellAddAssignKernel( VT1& y, const MT1& A, const VT2& x, size_t rbegin, size_t rend )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename MT1::IndexType      IndexType;
+
+      BLAZE_INTERNAL_ASSERT( size_t( MT1::chunkSize ) == size_t( IT::size ), "Invalid chunk size" );
+
+      if( rbegin >= rend )
+         return;
+
+      const size_t sigma ( A.sigma() );
+      const size_t kbegin( ( rbegin / sigma ) * ( sigma / IT::size ) );
+      const size_t kend  ( min( A.chunks(), ( ( rend - 1UL ) / sigma + 1UL ) * ( sigma / IT::size ) ) );
+
+      ElementType tmp[IT::size];
+
+      for( size_t k=kbegin; k<kend; ++k )
+      {
+         const ElementType* const values ( A.chunkValues ( k ) );
+         const IndexType*   const indices( A.chunkIndices( k ) );
+         const size_t*      const rows   ( A.chunkRows   ( k ) );
+
+         const size_t length( A.chunkLength( k ) * IT::size );
+
+         IntrinsicType xmm1;
+
+         for( size_t l=0UL; l<length; l+=IT::size ) {
+            xmm1 = xmm1 + load( values+l ) * gather( x.data(), indices+l );
+         }
+
+         storeu( tmp, xmm1 );
+
+         for( size_t s=0UL; s<IT::size; ++s ) {
+            if( rows[s] >= rbegin && rows[s] < rend )
+               y[rows[s]-rbegin] += tmp[s];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block-wise addition assignment to dense vectors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Block-wise addition assignment of a block compressed matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the addition assignment of a block compressed matrix to the block-wise
+   // kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseBlockKernel<MT1,VT2> >::Type
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      SMatDVecMultExpr::blockAddAssignKernel( y, A, x, 0UL, A.rows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block-wise addition assignment to dense vectors (submatrices)********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Block-wise addition assignment of a block compressed submatrix-dense vector
+   //        multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse submatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function handles submatrices of a block compressed matrix, which result from the
+   // splitting of the multiplication during SMP assignments. In case the submatrix spans all
+   // columns of the underlying matrix, the block-wise kernel is applied to the according range
+   // of rows. Otherwise the multiplication is computed row by row.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the underlying sparse matrix
+           , bool AF         // Alignment flag of the submatrix
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseBlockKernel<SparseSubmatrix<MT1,AF,false>,VT2> >::Type
+      selectAddAssignKernel( VT1& y, const SparseSubmatrix<MT1,AF,false>& A, const VT2& x )
+   {
+      typedef typename SparseSubmatrix<MT1,AF,false>::ConstIterator  ConstIterator;
+
+      if( A.column() == 0UL && A.columns() == A.operand().columns() ) {
+         SMatDVecMultExpr::blockAddAssignKernel( y, A.operand(), x, A.row(), A.row()+A.rows() );
+         return;
+      }
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         ElementType value = ElementType();
+
+         const ConstIterator end( A.end(i) );
+         for( ConstIterator element=A.begin(i); element!=end; ++element ) {
+            value += element->value() * x[element->index()];
+         }
+
+         y[i] += value;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block-wise addition assignment kernel********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Block-wise addition assignment kernel for a range of rows of a block compressed matrix
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side block compressed matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param rbegin The index of the first row to be computed.
+   // \param rend The index one past the last row to be computed.
+   // \return void
+   //
+   // This function computes the rows \f$ [rbegin..rend) \f$ of the product and adds them to
+   // the elements \f$ [0..rend-rbegin) \f$ of the target vector. All rows of a block row are
+   // computed simultaneously: each column of a non-zero block is loaded by means of aligned
+   // loads and multiplied with the broadcast element of the dense vector. Block rows that are
+   // only partially contained in the given range are computed completely, but only the rows
+   // within the range are written.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline void blockAddAssignKernel( VT1& y, const MT1& A, const VT2& x, size_t rbegin, size_t rend )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename MT1::BlockType      BlockType;
+
+      enum { R = MT1::rowsPerBlock };
+      enum { C = MT1::columnsPerBlock };
+      enum { NR = ( R + IT::size - 1UL ) / IT::size };
+
+      if( rbegin >= rend )
+         return;
+
+      const size_t N     ( A.columns() );
+      const size_t bbegin( rbegin / R );
+      const size_t bend  ( ( rend - 1UL ) / R + 1UL );
+
+      ElementType tmp[NR*IT::size];
+
+      for( size_t bi=bbegin; bi<bend; ++bi )
+      {
+         IntrinsicType xmm[NR];
+
+         for( size_t k=A.blockBegin( bi ); k<A.blockEnd( bi ); ++k )
+         {
+            const BlockType& block( A.block( k ) );
+            const size_t jbegin( A.blockIndex( k ) * C );
+            const size_t jn( ( jbegin + C <= N )?( size_t( C ) ):( N - jbegin ) );
+
+            for( size_t j=0UL; j<jn; ++j ) {
+               const IntrinsicType x1( set( x[jbegin+j] ) );
+               for( size_t r=0UL; r<NR; ++r ) {
+                  xmm[r] = xmm[r] + block.load( r*IT::size, j ) * x1;
+               }
+            }
+         }
+
+         for( size_t r=0UL; r<NR; ++r ) {
+            storeu( tmp+r*IT::size, xmm[r] );
+         }
+
+         const size_t ibegin( max( bi*R, rbegin ) );
+         const size_t iend  ( min( bi*R+R, rend ) );
+
+         for( size_t i=ibegin; i<iend; ++i ) {
+            y[i-rbegin] += tmp[i-bi*R];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Half storage addition assignment to dense vectors********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a symmetric half storage matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the addition assignment of a symmetric matrix storing a single triangle to the
+   // half storage kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseHalfKernel<MT1,VT2> >::Type
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      SMatDVecMultExpr::halfAddAssignKernel( y, A, x, 0UL, A.rows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Half storage addition assignment to dense vectors (submatrices)******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a symmetric half storage submatrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse submatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function handles submatrices of a symmetric half storage matrix, which result from the
+   // splitting of the multiplication during SMP assignments. In case the submatrix spans all
+   // columns of the underlying matrix, the half storage kernel is applied to the according range
+   // of rows. Otherwise the multiplication is computed row by row.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the underlying sparse matrix
+           , bool AF         // Alignment flag of the submatrix
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseHalfKernel<SparseSubmatrix<MT1,AF,false>,VT2> >::Type
+      selectAddAssignKernel( VT1& y, const SparseSubmatrix<MT1,AF,false>& A, const VT2& x )
+   {
+      typedef typename SparseSubmatrix<MT1,AF,false>::ConstIterator  ConstIterator;
+
+      if( A.column() == 0UL && A.columns() == A.operand().columns() ) {
+         SMatDVecMultExpr::halfAddAssignKernel( y, A.operand(), x, A.row(), A.row()+A.rows() );
+         return;
+      }
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         ElementType value = ElementType();
+
+         const ConstIterator end( A.end(i) );
+         for( ConstIterator element=A.begin(i); element!=end; ++element ) {
+            value += element->value() * x[element->index()];
+         }
+
+         y[i] += value;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Half storage addition assignment kernel******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment kernel for a range of rows of a symmetric half storage matrix
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side symmetric half storage matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param rbegin The index of the first row to be computed.
+   // \param rend The index one past the last row to be computed.
+   // \return void
+   //
+   // This function adds the rows \f$ [rbegin..rend) \f$ of the product to the elements
+   // \f$ [0..rend-rbegin) \f$ of the target vector. Each stored element \f$ a_{ij} \f$ of
+   // the rows within the range is read only once and applied twice: to row \a i as
+   // \f$ a_{ij} \cdot x_j \f$ and, in case column \a j lies within the range as well, to
+   // row \a j as \f$ a_{ij} \cdot x_i \f$. The contributions of stored elements outside the
+   // range to the rows within the range are gathered via the mirror index. Since only elements
+   // within the range are written, several row ranges can be computed concurrently without any
+   // synchronization or additional buffers.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline void halfAddAssignKernel( VT1& y, const MT1& A, const VT2& x, size_t rbegin, size_t rend )
+   {
+      typedef typename MT1::TriangleType            TriangleType;
+      typedef typename TriangleType::ConstIterator  ConstIterator;
+      typedef typename MT1::IndexType               IndexType;
+
+      const TriangleType& T( A.triangle() );
+
+      for( size_t i=rbegin; i<rend; ++i )
+      {
+         ElementType value = ElementType();
+
+         const ConstIterator end( T.end(i) );
+         for( ConstIterator element=T.begin(i); element!=end; ++element )
+         {
+            const size_t j( element->index() );
+
+            value += element->value() * x[j];
+
+            if( j != i && j >= rbegin && j < rend )
+               y[j-rbegin] += element->value() * x[i];
+         }
+
+         y[i-rbegin] += value;
+      }
+
+      if( ( MT1::storesUpper )?( rbegin == 0UL ):( rend == A.rows() ) )
+         return;
+
+      for( size_t i=rbegin; i<rend; ++i )
+      {
+         const IndexType* first( A.mirrorBegin(i) );
+         const IndexType* last ( A.mirrorEnd(i) );
+
+         if( MT1::storesUpper )
+            last  = std::lower_bound( first, last, static_cast<IndexType>( rbegin ) );
+         else
+            first = std::lower_bound( first, last, static_cast<IndexType>( rend ) );
+
+         if( first == last )
+            continue;
+
+         ElementType value = ElementType();
+
+         for( ; first!=last; ++first ) {
+            value += T.find( *first, i )->value() * x[*first];
+         }
+
+         y[i-rbegin] += value;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse vectors*******************************************************
+   // No special implementation for the addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a sparse matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a sparse matrix-
+   // dense vector multiplication expression to a dense vector. Due to the explicit application
    // of the SFINAE principle, this function can only be selected by the compiler in case either
    // the left-hand side matrix operand requires an intermediate evaluation or the right-hand
    // side vector operand is a compound expression.
@@ -512,7 +1577,509 @@ class SMatDVecMultExpr : public DenseVector< SMatDVecMultExpr<MT,VT>, false >
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      subAssign( ~lhs, A * x );
+      SMatDVecMultExpr::selectSubAssignKernel( ~lhs, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default subtraction assignment to dense vectors*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default subtraction assignment of a sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment to the evaluation via the subscript operator.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename DisableIf< Or< UseSoAKernel<MT1,VT2>, UseSellKernel<MT1,VT2>
+                                    , UseBlockKernel<MT1,VT2>, UseHalfKernel<MT1,VT2> > >::Type
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      subAssign( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Gather-based subtraction assignment to dense vectors****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Gather-based subtraction assignment of a sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the subtraction assignment kernel for sparse matrices with
+   // structure-of-arrays storage. The values of each row are loaded contiguously and the
+   // corresponding elements of the dense vector are collected via gather operations.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseSoAKernel<MT1,VT2> >::Type
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename MT1::IndexType      IndexType;
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         const ElementType* const values ( A.values ( i ) );
+         const IndexType*   const indices( A.indices( i ) );
+
+         const size_t nonzeros( A.nonZeros( i ) );
+         const size_t kpos( nonzeros & size_t(-IT::size) );
+         BLAZE_INTERNAL_ASSERT( ( nonzeros - ( nonzeros % IT::size ) ) == kpos, "Invalid end calculation" );
+
+         IntrinsicType xmm1;
+
+         for( size_t k=0UL; k<kpos; k+=IT::size ) {
+            xmm1 = xmm1 + loadu( values+k ) * gather( x.data(), indices+k );
+         }
+
+         ElementType value( sum( xmm1 ) );
+
+         for( size_t k=kpos; k<nonzeros; ++k ) {
+            value += values[k] * x[indices[k]];
+         }
+
+         y[i] -= value;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Chunk-wise subtraction assignment to dense vectors*******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Chunk-wise subtraction assignment of a sliced ELLPACK matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment of a sliced ELLPACK matrix to the chunk-wise
+   // kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseSellKernel<MT1,VT2> >::Type
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      SMatDVecMultExpr::sellSubAssignKernel( y, A, x, 0UL, A.rows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Chunk-wise subtraction assignment to dense vectors (submatrices)*****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Chunk-wise subtraction assignment of a sliced ELLPACK submatrix-dense vector
+   //        multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse submatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function handles submatrices of a sliced ELLPACK matrix, which result from the
+   // splitting of the multiplication during SMP assignments. In case the submatrix spans all
+   // columns of the underlying matrix, the chunk-wise kernel is applied to the according range
+   // of rows. Otherwise the multiplication is computed row by row.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the underlying sparse matrix
+           , bool AF         // Alignment flag of the submatrix
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseSellKernel<SparseSubmatrix<MT1,AF,false>,VT2> >::Type
+      selectSubAssignKernel( VT1& y, const SparseSubmatrix<MT1,AF,false>& A, const VT2& x )
+   {
+      typedef typename SparseSubmatrix<MT1,AF,false>::ConstIterator  ConstIterator;
+
+      if( A.column() == 0UL && A.columns() == A.operand().columns() ) {
+         SMatDVecMultExpr::sellSubAssignKernel( y, A.operand(), x, A.row(), A.row()+A.rows() );
+         return;
+      }
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         ElementType value = ElementType();
+
+         const ConstIterator end( A.end(i) );
+         for( ConstIterator element=A.begin(i); element!=end; ++element ) {
+            value += element->value() * x[element->index()];
+         }
+
+         y[i] -= value;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Chunk-wise subtraction assignment kernel*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Chunk-wise subtraction assignment kernel for a range of rows of a sliced ELLPACK matrix
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sliced ELLPACK matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param rbegin The index of the first row to be computed.
+   // \param rend The index one past the last row to be computed.
+   // \return void
+   //
+   // This function computes the rows \f$ [rbegin..rend) \f$ of the product and subtracts them
+   // to the elements \f$ [0..rend-rbegin) \f$ of the target vector. All rows of a chunk are
+   // computed simultaneously by means of aligned loads of the interleaved values and gather
+   // operations on the dense vector. Since the rows are sorted within windows of \a sigma
+   // rows, all chunks of the windows touching the given range are processed.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline void sellSubAssignKernel( VT1& y, const MT1& A, const VT2& x, size_t rbegin, size_t rend )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename MT1::IndexType      IndexType;
+
+      BLAZE_INTERNAL_ASSERT( size_t( MT1::chunkSize ) == size_t( IT::size ), "Invalid chunk size" );
+
+      if( rbegin >= rend )
+         return;
+
+      const size_t sigma ( A.sigma() );
+      const size_t kbegin( ( rbegin / sigma ) * ( sigma / IT::size ) );
+      const size_t kend  ( min( A.chunks(), ( ( rend - 1UL ) / sigma + 1UL ) * ( sigma / IT::size ) ) );
+
+      ElementType tmp[IT::size];
+
+      for( size_t k=kbegin; k<kend; ++k )
+      {
+         const ElementType* const values ( A.chunkValues ( k ) );
+         const IndexType*   const indices( A.chunkIndices( k ) );
+         const size_t*      const rows   ( A.chunkRows   ( k ) );
+
+         const size_t length( A.chunkLength( k ) * IT::size );
+
+         IntrinsicType xmm1;
+
+         for( size_t l=0UL; l<length; l+=IT::size ) {
+            xmm1 = xmm1 + load( values+l ) * gather( x.data(), indices+l );
+         }
+
+         storeu( tmp, xmm1 );
+
+         for( size_t s=0UL; s<IT::size; ++s ) {
+            if( rows[s] >= rbegin && rows[s] < rend )
+               y[rows[s]-rbegin] -= tmp[s];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block-wise subtraction assignment to dense vectors*******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Block-wise subtraction assignment of a block compressed matrix-dense vector
+   //        multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment of a block compressed matrix to the block-wise
+   // kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseBlockKernel<MT1,VT2> >::Type
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      SMatDVecMultExpr::blockSubAssignKernel( y, A, x, 0UL, A.rows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block-wise subtraction assignment to dense vectors (submatrices)*****************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Block-wise subtraction assignment of a block compressed submatrix-dense vector
+   //        multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse submatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function handles submatrices of a block compressed matrix, which result from the
+   // splitting of the multiplication during SMP assignments. In case the submatrix spans all
+   // columns of the underlying matrix, the block-wise kernel is applied to the according range
+   // of rows. Otherwise the multiplication is computed row by row.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the underlying sparse matrix
+           , bool AF         // Alignment flag of the submatrix
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseBlockKernel<SparseSubmatrix<MT1,AF,false>,VT2> >::Type
+      selectSubAssignKernel( VT1& y, const SparseSubmatrix<MT1,AF,false>& A, const VT2& x )
+   {
+      typedef typename SparseSubmatrix<MT1,AF,false>::ConstIterator  ConstIterator;
+
+      if( A.column() == 0UL && A.columns() == A.operand().columns() ) {
+         SMatDVecMultExpr::blockSubAssignKernel( y, A.operand(), x, A.row(), A.row()+A.rows() );
+         return;
+      }
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         ElementType value = ElementType();
+
+         const ConstIterator end( A.end(i) );
+         for( ConstIterator element=A.begin(i); element!=end; ++element ) {
+            value += element->value() * x[element->index()];
+         }
+
+         y[i] -= value;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block-wise subtraction assignment kernel*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Block-wise subtraction assignment kernel for a range of rows of a block compressed
+   //        matrix (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side block compressed matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param rbegin The index of the first row to be computed.
+   // \param rend The index one past the last row to be computed.
+   // \return void
+   //
+   // This function computes the rows \f$ [rbegin..rend) \f$ of the product and subtracts them from
+   // the elements \f$ [0..rend-rbegin) \f$ of the target vector. All rows of a block row are
+   // computed simultaneously: each column of a non-zero block is loaded by means of aligned
+   // loads and multiplied with the broadcast element of the dense vector. Block rows that are
+   // only partially contained in the given range are computed completely, but only the rows
+   // within the range are written.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline void blockSubAssignKernel( VT1& y, const MT1& A, const VT2& x, size_t rbegin, size_t rend )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename MT1::BlockType      BlockType;
+
+      enum { R = MT1::rowsPerBlock };
+      enum { C = MT1::columnsPerBlock };
+      enum { NR = ( R + IT::size - 1UL ) / IT::size };
+
+      if( rbegin >= rend )
+         return;
+
+      const size_t N     ( A.columns() );
+      const size_t bbegin( rbegin / R );
+      const size_t bend  ( ( rend - 1UL ) / R + 1UL );
+
+      ElementType tmp[NR*IT::size];
+
+      for( size_t bi=bbegin; bi<bend; ++bi )
+      {
+         IntrinsicType xmm[NR];
+
+         for( size_t k=A.blockBegin( bi ); k<A.blockEnd( bi ); ++k )
+         {
+            const BlockType& block( A.block( k ) );
+            const size_t jbegin( A.blockIndex( k ) * C );
+            const size_t jn( ( jbegin + C <= N )?( size_t( C ) ):( N - jbegin ) );
+
+            for( size_t j=0UL; j<jn; ++j ) {
+               const IntrinsicType x1( set( x[jbegin+j] ) );
+               for( size_t r=0UL; r<NR; ++r ) {
+                  xmm[r] = xmm[r] + block.load( r*IT::size, j ) * x1;
+               }
+            }
+         }
+
+         for( size_t r=0UL; r<NR; ++r ) {
+            storeu( tmp+r*IT::size, xmm[r] );
+         }
+
+         const size_t ibegin( max( bi*R, rbegin ) );
+         const size_t iend  ( min( bi*R+R, rend ) );
+
+         for( size_t i=ibegin; i<iend; ++i ) {
+            y[i-rbegin] -= tmp[i-bi*R];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Half storage subtraction assignment to dense vectors*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a symmetric half storage matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment of a symmetric matrix storing a single triangle to the
+   // half storage kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseHalfKernel<MT1,VT2> >::Type
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      SMatDVecMultExpr::halfSubAssignKernel( y, A, x, 0UL, A.rows() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Half storage subtraction assignment to dense vectors (submatrices)***************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a symmetric half storage submatrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse submatrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function handles submatrices of a symmetric half storage matrix, which result from the
+   // splitting of the multiplication during SMP assignments. In case the submatrix spans all
+   // columns of the underlying matrix, the half storage kernel is applied to the according range
+   // of rows. Otherwise the multiplication is computed row by row.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the underlying sparse matrix
+           , bool AF         // Alignment flag of the submatrix
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseHalfKernel<SparseSubmatrix<MT1,AF,false>,VT2> >::Type
+      selectSubAssignKernel( VT1& y, const SparseSubmatrix<MT1,AF,false>& A, const VT2& x )
+   {
+      typedef typename SparseSubmatrix<MT1,AF,false>::ConstIterator  ConstIterator;
+
+      if( A.column() == 0UL && A.columns() == A.operand().columns() ) {
+         SMatDVecMultExpr::halfSubAssignKernel( y, A.operand(), x, A.row(), A.row()+A.rows() );
+         return;
+      }
+
+      for( size_t i=0UL; i<A.rows(); ++i )
+      {
+         ElementType value = ElementType();
+
+         const ConstIterator end( A.end(i) );
+         for( ConstIterator element=A.begin(i); element!=end; ++element ) {
+            value += element->value() * x[element->index()];
+         }
+
+         y[i] -= value;
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Half storage subtraction assignment kernel***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment kernel for a range of rows of a symmetric half storage matrix
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side symmetric half storage matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param rbegin The index of the first row to be computed.
+   // \param rend The index one past the last row to be computed.
+   // \return void
+   //
+   // This function subtracts the rows \f$ [rbegin..rend) \f$ of the product from the elements
+   // \f$ [0..rend-rbegin) \f$ of the target vector. Each stored element \f$ a_{ij} \f$ of
+   // the rows within the range is read only once and applied twice: to row \a i as
+   // \f$ a_{ij} \cdot x_j \f$ and, in case column \a j lies within the range as well, to
+   // row \a j as \f$ a_{ij} \cdot x_i \f$. The contributions of stored elements outside the
+   // range to the rows within the range are gathered via the mirror index. Since only elements
+   // within the range are written, several row ranges can be computed concurrently without any
+   // synchronization or additional buffers.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline void halfSubAssignKernel( VT1& y, const MT1& A, const VT2& x, size_t rbegin, size_t rend )
+   {
+      typedef typename MT1::TriangleType            TriangleType;
+      typedef typename TriangleType::ConstIterator  ConstIterator;
+      typedef typename MT1::IndexType               IndexType;
+
+      const TriangleType& T( A.triangle() );
+
+      for( size_t i=rbegin; i<rend; ++i )
+      {
+         ElementType value = ElementType();
+
+         const ConstIterator end( T.end(i) );
+         for( ConstIterator element=T.begin(i); element!=end; ++element )
+         {
+            const size_t j( element->index() );
+
+            value += element->value() * x[j];
+
+            if( j != i && j >= rbegin && j < rend )
+               y[j-rbegin] -= element->value() * x[i];
+         }
+
+         y[i-rbegin] -= value;
+      }
+
+      if( ( MT1::storesUpper )?( rbegin == 0UL ):( rend == A.rows() ) )
+         return;
+
+      for( size_t i=rbegin; i<rend; ++i )
+      {
+         const IndexType* first( A.mirrorBegin(i) );
+         const IndexType* last ( A.mirrorEnd(i) );
+
+         if( MT1::storesUpper )
+            last  = std::lower_bound( first, last, static_cast<IndexType>( rbegin ) );
+         else
+            first = std::lower_bound( first, last, static_cast<IndexType>( rend ) );
+
+         if( first == last )
+            continue;
+
+         ElementType value = ElementType();
+
+         for( ; first!=last; ++first ) {
+            value += T.find( *first, i )->value() * x[*first];
+         }
+
+         y[i-rbegin] -= value;
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -62,7 +62,9 @@
 #include <blaze/math/traits/SubmatrixExprTrait.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
 #include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/HasBandStorage.h>
 #include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasDiagonalStorage.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/IsBlasCompatible.h>
 #include <blaze/math/typetraits/IsComputation.h>
@@ -85,6 +87,7 @@
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/logging/FunctionTrace.h>
+#include <blaze/util/mpl/Or.h>
 #include <blaze/util/SelectType.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsComplex.h>
@@ -92,6 +95,7 @@
 #include <blaze/util/typetraits/IsFloat.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/Unused.h>
 
 
 namespace blaze {
@@ -268,6 +272,70 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the dense matrix is a diagonal matrix that only stores its diagonal elements, the
+       nested \a value will be set to 1 and the multiplication is computed by means of the
+       scaling kernel. Otherwise it will be 0. */
+   template< typename T1 >
+   struct UseDiagonalKernel {
+      enum { value = HasDiagonalStorage<T1>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the dense matrix is a band matrix that only stores the elements within its band,
+       the nested \a value will be set to 1 and the multiplication is computed by means of the
+       band kernel. Otherwise it will be 0. */
+   template< typename T1 >
+   struct UseBandKernel {
+      enum { value = !HasDiagonalStorage<T1>::value && HasBandStorage<T1>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the two involved vector types and the band storage array of the band matrix are
+       suited for a vectorized computation of the band multiplication, the nested \value will be
+       set to 1, otherwise it will be 0. Since the sections of the vector operand are accessed at
+       arbitrary offsets, vector expressions are not considered suited. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseVectorizedBandKernel {
+      enum { value = T1::vectorizable && T2::vectorizable && T3::vectorizable &&
+                     !IsExpression<T2>::value &&
+                     IsSame<typename T1::ElementType,typename T2::ElementType>::value &&
+                     IsSame<typename T1::ElementType,typename T3::ElementType>::value &&
+                     IntrinsicTrait<typename T1::ElementType>::addition &&
+                     IntrinsicTrait<typename T1::ElementType>::subtraction &&
+                     IntrinsicTrait<typename T1::ElementType>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the two involved vector types and the vector of diagonal elements are suited for
+       a vectorized computation of the scaling, the nested \value will be set to 1, otherwise it
+       will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseVectorizedScalingKernel {
+      enum { value = T1::vectorizable && T2::vectorizable && T3::vectorizable &&
+                     IsSame<typename T1::ElementType,typename T2::ElementType>::value &&
+                     IsSame<typename T1::ElementType,typename T3::ElementType>::value &&
+                     IntrinsicTrait<typename T1::ElementType>::addition &&
+                     IntrinsicTrait<typename T1::ElementType>::subtraction &&
+                     IntrinsicTrait<typename T1::ElementType>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
    typedef TDVecDMatMultExpr<VT,MT>                    This;           //!< Type of this TDVecDMatMultExpr instance.
@@ -497,7 +565,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline void selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   static inline typename DisableIf< Or< UseDiagonalKernel<MT1>, UseBandKernel<MT1> > >::Type
+      selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -509,6 +578,137 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Diagonal assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a transpose dense vector-compact diagonal matrix multiplication
+   //        (\f$ \vec{y}^T=\vec{x}^T*D \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side compact diagonal matrix operand.
+   // \return void
+   //
+   // This function relays the assignment of a multiplication with a diagonal matrix that only
+   // stores its diagonal elements to the scaling kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseDiagonalKernel<MT1> >::Type
+      selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      reset( y );
+
+      TDVecDMatMultExpr::scalingAddAssignKernel( y, x, diagonalOf( A ), diagonalRow( A )
+                                               , diagonalColumn( A ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the vector of diagonal elements of a compact diagonal matrix operand.
+   // \ingroup dense_vector
+   //
+   // \param A The compact diagonal matrix operand.
+   // \return Reference to the vector of diagonal elements.
+   */
+   template< typename MT1 >  // Type of the diagonal matrix operand
+   static inline const typename MT1::DiagonalType& diagonalOf( const MT1& A )
+   {
+      return A.diagonal();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the vector of diagonal elements of the matrix underlying a dense submatrix.
+   // \ingroup dense_vector
+   //
+   // \param A The dense submatrix of a compact diagonal matrix.
+   // \return Reference to the vector of diagonal elements of the underlying matrix.
+   */
+   template< typename MT1  // Type of the underlying diagonal matrix
+           , bool AF >     // Alignment flag of the submatrix
+   static inline const typename MT1::DiagonalType&
+      diagonalOf( const DenseSubmatrix<MT1,AF,false>& A )
+   {
+      return A.operand().diagonal();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first row of a compact diagonal matrix operand.
+   // \ingroup dense_vector
+   //
+   // \param A The compact diagonal matrix operand.
+   // \return The row offset of the operand within the diagonal matrix (always 0).
+   */
+   template< typename MT1 >  // Type of the diagonal matrix operand
+   static inline size_t diagonalRow( const MT1& A )
+   {
+      UNUSED_PARAMETER( A );
+      return 0UL;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first row of a dense submatrix of a compact diagonal matrix.
+   // \ingroup dense_vector
+   //
+   // \param A The dense submatrix of a compact diagonal matrix.
+   // \return The row offset of the submatrix within the underlying diagonal matrix.
+   */
+   template< typename MT1  // Type of the underlying diagonal matrix
+           , bool AF >     // Alignment flag of the submatrix
+   static inline size_t diagonalRow( const DenseSubmatrix<MT1,AF,false>& A )
+   {
+      return A.row();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first column of a compact diagonal matrix operand.
+   // \ingroup dense_vector
+   //
+   // \param A The compact diagonal matrix operand.
+   // \return The column offset of the operand within the diagonal matrix (always 0).
+   */
+   template< typename MT1 >  // Type of the diagonal matrix operand
+   static inline size_t diagonalColumn( const MT1& A )
+   {
+      UNUSED_PARAMETER( A );
+      return 0UL;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Diagonal storage access functions***********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first column of a dense submatrix of a compact diagonal
+   //        matrix.
+   // \ingroup dense_vector
+   //
+   // \param A The dense submatrix of a compact diagonal matrix.
+   // \return The column offset of the submatrix within the underlying diagonal matrix.
+   */
+   template< typename MT1  // Type of the underlying diagonal matrix
+           , bool AF >     // Alignment flag of the submatrix
+   static inline size_t diagonalColumn( const DenseSubmatrix<MT1,AF,false>& A )
+   {
+      return A.column();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Default assignment to dense vectors*********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Default assignment of a transpose dense vector-dense matrix multiplication
@@ -1079,6 +1279,134 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 #endif
    //**********************************************************************************************
 
+   //**Band assignment to dense vectors************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a transpose dense vector-band matrix multiplication
+   //        (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side band matrix operand.
+   // \return void
+   //
+   // This function relays the assignment of a multiplication with a band matrix that only stores
+   // the elements within its band to the band kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseBandKernel<MT1> >::Type
+      selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      reset( y );
+
+      TDVecDMatMultExpr::bandAddAssignKernel( y, x, bandOf( A ), bandRow( A ), bandColumn( A ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Band storage access functions***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the band matrix underlying a band matrix operand.
+   // \ingroup dense_vector
+   //
+   // \param A The band matrix operand.
+   // \return Reference to the band matrix.
+   */
+   template< typename MT1 >  // Type of the band matrix operand
+   static inline const MT1& bandOf( const MT1& A )
+   {
+      return A;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Band storage access functions***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the band matrix underlying a dense submatrix.
+   // \ingroup dense_vector
+   //
+   // \param A The dense submatrix of a band matrix.
+   // \return Reference to the underlying band matrix.
+   */
+   template< typename MT1  // Type of the underlying band matrix
+           , bool AF >     // Alignment flag of the submatrix
+   static inline const MT1& bandOf( const DenseSubmatrix<MT1,AF,false>& A )
+   {
+      return A.operand();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Band storage access functions***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first row of a band matrix operand.
+   // \ingroup dense_vector
+   //
+   // \param A The band matrix operand.
+   // \return The row offset of the operand within the band matrix (always 0).
+   */
+   template< typename MT1 >  // Type of the band matrix operand
+   static inline size_t bandRow( const MT1& A )
+   {
+      UNUSED_PARAMETER( A );
+      return 0UL;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Band storage access functions***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first row of a dense submatrix of a band matrix.
+   // \ingroup dense_vector
+   //
+   // \param A The dense submatrix of a band matrix.
+   // \return The row offset of the submatrix within the underlying band matrix.
+   */
+   template< typename MT1  // Type of the underlying band matrix
+           , bool AF >     // Alignment flag of the submatrix
+   static inline size_t bandRow( const DenseSubmatrix<MT1,AF,false>& A )
+   {
+      return A.row();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Band storage access functions***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first column of a band matrix operand.
+   // \ingroup dense_vector
+   //
+   // \param A The band matrix operand.
+   // \return The column offset of the operand within the band matrix (always 0).
+   */
+   template< typename MT1 >  // Type of the band matrix operand
+   static inline size_t bandColumn( const MT1& A )
+   {
+      UNUSED_PARAMETER( A );
+      return 0UL;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Band storage access functions***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Returns the index of the first column of a dense submatrix of a band matrix.
+   // \ingroup dense_vector
+   //
+   // \param A The dense submatrix of a band matrix.
+   // \return The column offset of the submatrix within the underlying band matrix.
+   */
+   template< typename MT1  // Type of the underlying band matrix
+           , bool AF >     // Alignment flag of the submatrix
+   static inline size_t bandColumn( const DenseSubmatrix<MT1,AF,false>& A )
+   {
+      return A.column();
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a transpose dense vector-dense matrix multiplication to a transpose
@@ -1160,7 +1488,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline void selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   static inline typename DisableIf< Or< UseDiagonalKernel<MT1>, UseBandKernel<MT1> > >::Type
+      selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -1738,6 +2067,240 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 #endif
    //**********************************************************************************************
 
+   //**Diagonal addition assignment to dense vectors***********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a transpose dense vector-compact diagonal matrix
+   //        multiplication (\f$ \vec{y}^T+=\vec{x}^T*D \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side compact diagonal matrix operand.
+   // \return void
+   //
+   // This function relays the addition assignment of a multiplication with a diagonal matrix
+   // that only stores its diagonal elements to the scaling kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseDiagonalKernel<MT1> >::Type
+      selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      TDVecDMatMultExpr::scalingAddAssignKernel( y, x, diagonalOf( A ), diagonalRow( A )
+                                               , diagonalColumn( A ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default addition assignment kernel (scaling)************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default scaling kernel for the addition assignment of a transpose dense
+   //        vector-compact diagonal matrix multiplication (\f$ \vec{y}^T+=\vec{x}^T*D \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param d The vector of diagonal elements of the diagonal matrix.
+   // \param row The index of the first row of the diagonal matrix operand.
+   // \param column The index of the first column of the diagonal matrix operand.
+   // \return void
+   //
+   // The diagonal matrix operand is given by the block of the diagonal matrix starting at
+   // (\a row,\a column). The element \f$ y_j \f$ is updated with the element
+   // \f$ x_{column+j-row} \f$ scaled by the diagonal element \f$ d_{column+j} \f$. All elements
+   // of \a y that don't intersect with the diagonal remain unchanged.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename VT3 >  // Type of the vector of diagonal elements
+   static inline typename DisableIf< UseVectorizedScalingKernel<VT1,VT2,VT3> >::Type
+      scalingAddAssignKernel( VT1& y, const VT2& x, const VT3& d, size_t row, size_t column )
+   {
+      const size_t N( y.size() );
+      const size_t K( x.size() );
+
+      const size_t jbegin( ( row > column )?( row - column ):( 0UL ) );
+      const size_t jend  ( ( row + K > column )?( min( N, row + K - column ) ):( 0UL ) );
+
+      for( size_t j=jbegin; j<jend; ++j ) {
+         y[j] += x[column+j-row] * d[column+j];
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized addition assignment kernel (scaling)*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized scaling kernel for the addition assignment of a transpose dense
+   //        vector-compact diagonal matrix multiplication (\f$ \vec{y}^T+=\vec{x}^T*D \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param d The vector of diagonal elements of the diagonal matrix.
+   // \param row The index of the first row of the diagonal matrix operand.
+   // \param column The index of the first column of the diagonal matrix operand.
+   // \return void
+   //
+   // In case the diagonal matrix operand is a diagonal block, this function computes the
+   // elementwise product of \a x and the according section of the diagonal by means of
+   // intrinsics. Otherwise the elements are scaled individually.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename VT3 >  // Type of the vector of diagonal elements
+   static inline typename EnableIf< UseVectorizedScalingKernel<VT1,VT2,VT3> >::Type
+      scalingAddAssignKernel( VT1& y, const VT2& x, const VT3& d, size_t row, size_t column )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      const size_t N( y.size() );
+      const size_t K( x.size() );
+
+      const size_t jbegin( ( row > column )?( row - column ):( 0UL ) );
+      const size_t jend  ( ( row + K > column )?( min( N, row + K - column ) ):( 0UL ) );
+      const size_t jpos  ( ( row == column )?( jend & size_t(-IT::size) ):( jbegin ) );
+
+      size_t j( jbegin );
+
+      for( ; j<jpos; j+=IT::size ) {
+         y.store( j, y.load(j) + x.load(j) * d.loadu(column+j) );
+      }
+      for( ; j<jend; ++j ) {
+         y[j] += x[column+j-row] * d[column+j];
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Band addition assignment to dense vectors***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a transpose dense vector-band matrix multiplication
+   //        (\f$ \vec{y}^T+=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side band matrix operand.
+   // \return void
+   //
+   // This function relays the addition assignment of a multiplication with a band matrix that
+   // only stores the elements within its band to the band kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseBandKernel<MT1> >::Type
+      selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      TDVecDMatMultExpr::bandAddAssignKernel( y, x, bandOf( A ), bandRow( A ), bandColumn( A ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default addition assignment kernel (band)***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default band kernel for the addition assignment of a transpose dense vector-band
+   //        matrix multiplication (\f$ \vec{y}^T+=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param B The band matrix.
+   // \param row The index of the first row of the band matrix operand.
+   // \param column The index of the first column of the band matrix operand.
+   // \return void
+   //
+   // The band matrix operand is given by the block of the band matrix starting at (\a row,
+   // \a column). The multiplication is computed diagonal by diagonal: for each diagonal of the
+   // band, the section of the diagonal that intersects with the block is multiplied elementwise
+   // with the according section of \a x and added to the according section of \a y.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT2 >  // Type of the band matrix
+   static inline typename DisableIf< UseVectorizedBandKernel<VT1,VT2,typename MT2::BandType> >::Type
+      bandAddAssignKernel( VT1& y, const VT2& x, const MT2& B, size_t row, size_t column )
+   {
+      const size_t N ( y.size() );
+      const size_t K ( x.size() );
+      const size_t kl( B.lowerBandwidth() );
+      const size_t ku( B.upperBandwidth() );
+
+      const typename MT2::BandType& band( B.band() );
+
+      for( size_t r=0UL; r<=kl+ku; ++r )
+      {
+         const size_t jbegin( max( column, ( row+ku > r )?( row+ku-r ):( 0UL ) ) );
+         const size_t jend  ( min( column+N, ( row+ku+K > r )?( row+ku+K-r ):( 0UL ) ) );
+
+         for( size_t j=jbegin; j<jend; ++j ) {
+            y[j-column] += x[j+r-row-ku] * band(r,j);
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized addition assignment kernel (band)************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized band kernel for the addition assignment of a transpose dense vector-band
+   //        matrix multiplication (\f$ \vec{y}^T+=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param B The band matrix.
+   // \param row The index of the first row of the band matrix operand.
+   // \param column The index of the first column of the band matrix operand.
+   // \return void
+   //
+   // This function computes the multiplication diagonal by diagonal. Since each diagonal is
+   // stored contiguously in the band storage array, the elementwise products of the according
+   // sections of \a x with the diagonals are computed by means of intrinsics.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT2 >  // Type of the band matrix
+   static inline typename EnableIf< UseVectorizedBandKernel<VT1,VT2,typename MT2::BandType> >::Type
+      bandAddAssignKernel( VT1& y, const VT2& x, const MT2& B, size_t row, size_t column )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      const size_t N ( y.size() );
+      const size_t K ( x.size() );
+      const size_t kl( B.lowerBandwidth() );
+      const size_t ku( B.upperBandwidth() );
+
+      const typename MT2::BandType& band( B.band() );
+
+      ElementType* const py( y.data() );
+      const ElementType* const px( x.data() );
+
+      for( size_t r=0UL; r<=kl+ku; ++r )
+      {
+         const size_t jbegin( max( column, ( row+ku > r )?( row+ku-r ):( 0UL ) ) );
+         const size_t jend  ( min( column+N, ( row+ku+K > r )?( row+ku+K-r ):( 0UL ) ) );
+
+         if( jbegin >= jend ) continue;
+
+         const size_t jpos( jbegin + ( ( jend - jbegin ) & size_t(-IT::size) ) );
+
+         size_t j( jbegin );
+
+         for( ; j<jpos; j+=IT::size ) {
+            ElementType* const pj( py+j-column );
+            storeu( pj, loadu( pj ) + loadu( px+j+r-row-ku ) * band.loadu(r,j) );
+         }
+         for( ; j<jend; ++j ) {
+            y[j-column] += x[j+r-row-ku] * band(r,j);
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -1793,7 +2356,8 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline void selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   static inline typename DisableIf< Or< UseDiagonalKernel<MT1>, UseBandKernel<MT1> > >::Type
+      selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
    {
       if( ( IsDiagonal<MT1>::value ) ||
           ( IsComputation<MT>::value && !evaluateMatrix ) ||
@@ -2373,6 +2937,240 @@ class TDVecDMatMultExpr : public DenseVector< TDVecDMatMultExpr<VT,MT>, true >
 #endif
    //**********************************************************************************************
 
+   //**Diagonal subtraction assignment to dense vectors********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a transpose dense vector-compact diagonal matrix
+   //        multiplication (\f$ \vec{y}^T-=\vec{x}^T*D \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side compact diagonal matrix operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment of a multiplication with a diagonal matrix
+   // that only stores its diagonal elements to the scaling kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseDiagonalKernel<MT1> >::Type
+      selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      TDVecDMatMultExpr::scalingSubAssignKernel( y, x, diagonalOf( A ), diagonalRow( A )
+                                               , diagonalColumn( A ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default subtraction assignment kernel (scaling)*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default scaling kernel for the subtraction assignment of a transpose dense
+   //        vector-compact diagonal matrix multiplication (\f$ \vec{y}^T-=\vec{x}^T*D \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param d The vector of diagonal elements of the diagonal matrix.
+   // \param row The index of the first row of the diagonal matrix operand.
+   // \param column The index of the first column of the diagonal matrix operand.
+   // \return void
+   //
+   // The diagonal matrix operand is given by the block of the diagonal matrix starting at
+   // (\a row,\a column). The element \f$ y_j \f$ is updated with the element
+   // \f$ x_{column+j-row} \f$ scaled by the diagonal element \f$ d_{column+j} \f$. All elements
+   // of \a y that don't intersect with the diagonal remain unchanged.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename VT3 >  // Type of the vector of diagonal elements
+   static inline typename DisableIf< UseVectorizedScalingKernel<VT1,VT2,VT3> >::Type
+      scalingSubAssignKernel( VT1& y, const VT2& x, const VT3& d, size_t row, size_t column )
+   {
+      const size_t N( y.size() );
+      const size_t K( x.size() );
+
+      const size_t jbegin( ( row > column )?( row - column ):( 0UL ) );
+      const size_t jend  ( ( row + K > column )?( min( N, row + K - column ) ):( 0UL ) );
+
+      for( size_t j=jbegin; j<jend; ++j ) {
+         y[j] -= x[column+j-row] * d[column+j];
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized subtraction assignment kernel (scaling)******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized scaling kernel for the subtraction assignment of a transpose dense
+   //        vector-compact diagonal matrix multiplication (\f$ \vec{y}^T-=\vec{x}^T*D \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param d The vector of diagonal elements of the diagonal matrix.
+   // \param row The index of the first row of the diagonal matrix operand.
+   // \param column The index of the first column of the diagonal matrix operand.
+   // \return void
+   //
+   // In case the diagonal matrix operand is a diagonal block, this function computes the
+   // elementwise product of \a x and the according section of the diagonal by means of
+   // intrinsics. Otherwise the elements are scaled individually.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename VT3 >  // Type of the vector of diagonal elements
+   static inline typename EnableIf< UseVectorizedScalingKernel<VT1,VT2,VT3> >::Type
+      scalingSubAssignKernel( VT1& y, const VT2& x, const VT3& d, size_t row, size_t column )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      const size_t N( y.size() );
+      const size_t K( x.size() );
+
+      const size_t jbegin( ( row > column )?( row - column ):( 0UL ) );
+      const size_t jend  ( ( row + K > column )?( min( N, row + K - column ) ):( 0UL ) );
+      const size_t jpos  ( ( row == column )?( jend & size_t(-IT::size) ):( jbegin ) );
+
+      size_t j( jbegin );
+
+      for( ; j<jpos; j+=IT::size ) {
+         y.store( j, y.load(j) - x.load(j) * d.loadu(column+j) );
+      }
+      for( ; j<jend; ++j ) {
+         y[j] -= x[column+j-row] * d[column+j];
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Band subtraction assignment to dense vectors************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a transpose dense vector-band matrix multiplication
+   //        (\f$ \vec{y}^T-=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side band matrix operand.
+   // \return void
+   //
+   // This function relays the subtraction assignment of a multiplication with a band matrix that
+   // only stores the elements within its band to the band kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline typename EnableIf< UseBandKernel<MT1> >::Type
+      selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   {
+      TDVecDMatMultExpr::bandSubAssignKernel( y, x, bandOf( A ), bandRow( A ), bandColumn( A ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default subtraction assignment kernel (band)************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default band kernel for the subtraction assignment of a transpose dense vector-band
+   //        matrix multiplication (\f$ \vec{y}^T-=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param B The band matrix.
+   // \param row The index of the first row of the band matrix operand.
+   // \param column The index of the first column of the band matrix operand.
+   // \return void
+   //
+   // The band matrix operand is given by the block of the band matrix starting at (\a row,
+   // \a column). The multiplication is computed diagonal by diagonal: for each diagonal of the
+   // band, the section of the diagonal that intersects with the block is multiplied elementwise
+   // with the according section of \a x and subtracted from the according section of \a y.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT2 >  // Type of the band matrix
+   static inline typename DisableIf< UseVectorizedBandKernel<VT1,VT2,typename MT2::BandType> >::Type
+      bandSubAssignKernel( VT1& y, const VT2& x, const MT2& B, size_t row, size_t column )
+   {
+      const size_t N ( y.size() );
+      const size_t K ( x.size() );
+      const size_t kl( B.lowerBandwidth() );
+      const size_t ku( B.upperBandwidth() );
+
+      const typename MT2::BandType& band( B.band() );
+
+      for( size_t r=0UL; r<=kl+ku; ++r )
+      {
+         const size_t jbegin( max( column, ( row+ku > r )?( row+ku-r ):( 0UL ) ) );
+         const size_t jend  ( min( column+N, ( row+ku+K > r )?( row+ku+K-r ):( 0UL ) ) );
+
+         for( size_t j=jbegin; j<jend; ++j ) {
+            y[j-column] -= x[j+r-row-ku] * band(r,j);
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized subtraction assignment kernel (band)*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized band kernel for the subtraction assignment of a transpose dense vector-band
+   //        matrix multiplication (\f$ \vec{y}^T-=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param B The band matrix.
+   // \param row The index of the first row of the band matrix operand.
+   // \param column The index of the first column of the band matrix operand.
+   // \return void
+   //
+   // This function computes the multiplication diagonal by diagonal. Since each diagonal is
+   // stored contiguously in the band storage array, the elementwise products of the according
+   // sections of \a x with the diagonals are computed by means of intrinsics.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT2 >  // Type of the band matrix
+   static inline typename EnableIf< UseVectorizedBandKernel<VT1,VT2,typename MT2::BandType> >::Type
+      bandSubAssignKernel( VT1& y, const VT2& x, const MT2& B, size_t row, size_t column )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+
+      const size_t N ( y.size() );
+      const size_t K ( x.size() );
+      const size_t kl( B.lowerBandwidth() );
+      const size_t ku( B.upperBandwidth() );
+
+      const typename MT2::BandType& band( B.band() );
+
+      ElementType* const py( y.data() );
+      const ElementType* const px( x.data() );
+
+      for( size_t r=0UL; r<=kl+ku; ++r )
+      {
+         const size_t jbegin( max( column, ( row+ku > r )?( row+ku-r ):( 0UL ) ) );
+         const size_t jend  ( min( column+N, ( row+ku+K > r )?( row+ku+K-r ):( 0UL ) ) );
+
+         if( jbegin >= jend ) continue;
+
+         const size_t jpos( jbegin + ( ( jend - jbegin ) & size_t(-IT::size) ) );
+
+         size_t j( jbegin );
+
+         for( ; j<jpos; j+=IT::size ) {
+            ElementType* const pj( py+j-column );
+            storeu( pj, loadu( pj ) - loadu( px+j+r-row-ku ) * band.loadu(r,j) );
+         }
+         for( ; j<jend; ++j ) {
+            y[j-column] -= x[j+r-row-ku] * band(r,j);
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
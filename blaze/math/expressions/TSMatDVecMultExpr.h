@@ -51,6 +51,7 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatVecMultExpr.h>
+#include <blaze/math/Intrinsics.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
@@ -58,6 +59,8 @@
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/traits/SubmatrixExprTrait.h>
 #include <blaze/math/traits/SubvectorExprTrait.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/HasSoAStorage.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsMatMatMultExpr.h>
@@ -75,6 +78,8 @@
 #include <blaze/util/mpl/Or.h>
 #include <blaze/util/SelectType.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -130,14 +135,35 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the sparse matrix stores its indices and values in separate arrays and the target
+       vector provides direct access to its elements, the nested \a value will be set to 1 and
+       the gather-based kernel is selected. Otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseSoAKernel {
+      enum { value = HasSoAStorage<T2>::value &&
+                     HasMutableDataAccess<T1>::value &&
+                     IsSame<typename T1::ElementType,typename T2::ElementType>::value &&
+                     IsSame<typename T1::ElementType,typename T3::ElementType>::value &&
+                     IsFloatingPoint<typename T1::ElementType>::value &&
+                     IntrinsicTrait<typename T1::ElementType>::addition &&
+                     IntrinsicTrait<typename T1::ElementType>::subtraction &&
+                     IntrinsicTrait<typename T1::ElementType>::multiplication };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
  public:
    //**Type definitions****************************************************************************
-   typedef TSMatDVecMultExpr<MT,VT>            This;           //!< Type of this TSMatDVecMultExpr instance.
-   typedef typename MultTrait<MRT,VRT>::Type   ResultType;     //!< Result type for expression template evaluations.
-   typedef typename ResultType::TransposeType  TransposeType;  //!< Transpose type for expression template evaluations.
-   typedef typename ResultType::ElementType    ElementType;    //!< Resulting element type.
-   typedef const ElementType                   ReturnType;     //!< Return type for expression template evaluations.
-   typedef const ResultType                    CompositeType;  //!< Data type for composite expression templates.
+   typedef TSMatDVecMultExpr<MT,VT>                    This;           //!< Type of this TSMatDVecMultExpr instance.
+   typedef typename MultTrait<MRT,VRT>::Type           ResultType;     //!< Result type for expression template evaluations.
+   typedef typename ResultType::TransposeType          TransposeType;  //!< Transpose type for expression template evaluations.
+   typedef typename ResultType::ElementType            ElementType;    //!< Resulting element type.
+   typedef typename IntrinsicTrait<ElementType>::Type  IntrinsicType;  //!< Resulting intrinsic element type.
+   typedef const ElementType                           ReturnType;     //!< Return type for expression template evaluations.
+   typedef const ResultType                            CompositeType;  //!< Data type for composite expression templates.
 
    //! Composite type of the left-hand side sparse matrix expression.
    typedef typename SelectType< IsExpression<MT>::value, const MT, const MT& >::Type  LeftOperand;
@@ -333,7 +359,8 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline typename DisableIf< UseSoAKernel<VT1,MT1,VT2> >::Type
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       typedef typename RemoveReference<MT1>::Type::ConstIterator  ConstIterator;
 
@@ -354,6 +381,32 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Gather-based assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Gather-based assignment of a transpose sparse matrix-dense vector
+   //        multiplication (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the assignment kernel for sparse matrices with structure-of-arrays
+   // storage. Since the target vector has already been reset, the computation is relayed to the
+   // gather-based addition assignment kernel.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseSoAKernel<VT1,MT1,VT2> >::Type
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      selectAddAssignKernel( y, A, x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a transpose sparse matrix-dense vector multiplication to a sparse
@@ -436,7 +489,8 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline typename DisableIf< UseSoAKernel<VT1,MT1,VT2> >::Type
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       typedef typename RemoveReference<MT1>::Type::ConstIterator  ConstIterator;
 
@@ -453,6 +507,59 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Gather-based addition assignment to dense vectors*******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Gather-based addition assignment of a transpose sparse matrix-dense vector
+   //        multiplication (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the addition assignment kernel for sparse matrices with
+   // structure-of-arrays storage. The affected elements of the target vector are collected via
+   // gather operations and updated with contiguously loaded values of the current column. Since
+   // AVX2 does not provide scatter operations, the results are written back element-wise.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseSoAKernel<VT1,MT1,VT2> >::Type
+      selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename MT1::IndexType      IndexType;
+
+      ElementType* const data( y.data() );
+
+      for( size_t j=0UL; j<A.columns(); ++j )
+      {
+         const ElementType* const values ( A.values ( j ) );
+         const IndexType*   const indices( A.indices( j ) );
+
+         const size_t nonzeros( A.nonZeros( j ) );
+         const size_t kpos( nonzeros & size_t(-IT::size) );
+         BLAZE_INTERNAL_ASSERT( ( nonzeros - ( nonzeros % IT::size ) ) == kpos, "Invalid end calculation" );
+
+         const IntrinsicType x1( set( x[j] ) );
+
+         for( size_t k=0UL; k<kpos; k+=IT::size ) {
+            const IntrinsicType y1( gather( data, indices+k ) + loadu( values+k ) * x1 );
+            for( size_t l=0UL; l<IT::size; ++l ) {
+               data[indices[k+l]] = y1[l];
+            }
+         }
+
+         for( size_t k=kpos; k<nonzeros; ++k ) {
+            data[indices[k]] += values[k] * x[j];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -511,7 +618,8 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline typename DisableIf< UseSoAKernel<VT1,MT1,VT2> >::Type
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
       typedef typename RemoveReference<MT1>::Type::ConstIterator  ConstIterator;
 
@@ -528,6 +636,59 @@ class TSMatDVecMultExpr : public DenseVector< TSMatDVecMultExpr<MT,VT>, false >
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Gather-based subtraction assignment to dense vectors****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Gather-based subtraction assignment of a transpose sparse matrix-dense vector
+   //        multiplication (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the subtraction assignment kernel for sparse matrices with
+   // structure-of-arrays storage. The affected elements of the target vector are collected via
+   // gather operations and updated with contiguously loaded values of the current column. Since
+   // AVX2 does not provide scatter operations, the results are written back element-wise.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline typename EnableIf< UseSoAKernel<VT1,MT1,VT2> >::Type
+      selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   {
+      typedef IntrinsicTrait<ElementType>  IT;
+      typedef typename MT1::IndexType      IndexType;
+
+      ElementType* const data( y.data() );
+
+      for( size_t j=0UL; j<A.columns(); ++j )
+      {
+         const ElementType* const values ( A.values ( j ) );
+         const IndexType*   const indices( A.indices( j ) );
+
+         const size_t nonzeros( A.nonZeros( j ) );
+         const size_t kpos( nonzeros & size_t(-IT::size) );
+         BLAZE_INTERNAL_ASSERT( ( nonzeros - ( nonzeros % IT::size ) ) == kpos, "Invalid end calculation" );
+
+         const IntrinsicType x1( set( x[j] ) );
+
+         for( size_t k=0UL; k<kpos; k+=IT::size ) {
+            const IntrinsicType y1( gather( data, indices+k ) - loadu( values+k ) * x1 );
+            for( size_t l=0UL; l<IT::size; ++l ) {
+               data[indices[k+l]] = y1[l];
+            }
+         }
+
+         for( size_t k=kpos; k<nonzeros; ++k ) {
+            data[indices[k]] -= values[k] * x[j];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -43,6 +43,7 @@
 #include <blaze/math/intrinsics/Abs.h>
 #include <blaze/math/intrinsics/Addition.h>
 #include <blaze/math/intrinsics/Division.h>
+#include <blaze/math/intrinsics/Gather.h>
 #include <blaze/math/intrinsics/Load.h>
 #include <blaze/math/intrinsics/Loadu.h>
 #include <blaze/math/intrinsics/Multiplication.h>
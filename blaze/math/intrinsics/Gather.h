@@ -0,0 +1,308 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/intrinsics/Gather.h
+//  \brief Header file for the intrinsic gather functionality
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_INTRINSICS_GATHER_H_
+#define _BLAZE_MATH_INTRINSICS_GATHER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/intrinsics/BasicTypes.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/intrinsics/Loadu.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/HasSize.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+#include <blaze/util/typetraits/IsSigned.h>
+#include <blaze/util/typetraits/IsUnsigned.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTRINSIC GATHER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Element-wise fallback for the gather functions.
+// \ingroup intrinsics
+//
+// \param address The base address of the values to be gathered.
+// \param indices The first of the indices of the values to be gathered.
+// \return The vector of gathered values.
+//
+// This function is used whenever no native gather instruction is available for the current
+// combination of value type, index type and instruction set. Note that the AVX2 kernels below
+// use the masked gather instructions with a zero source operand and a full mask, which avoids
+// the dependency on the undefined previous content of the destination register.
+*/
+template< typename Type  // Type of the gathered values
+        , typename T >   // Type of the indices
+BLAZE_ALWAYS_INLINE typename IntrinsicTrait<Type>::Type
+   gather_backend( const Type* address, const T* indices )
+{
+   Type values[IntrinsicTrait<Type>::size];
+   for( size_t k=0UL; k<size_t( IntrinsicTrait<Type>::size ); ++k )
+      values[k] = address[indices[k]];
+   return loadu( values );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'float' values via 1-byte or 2-byte indices.
+// \ingroup intrinsics
+//
+// \param address The base address of the values to be gathered.
+// \param indices The first of the indices of the values to be gathered.
+// \return The vector of gathered values.
+//
+// This function loads a vector of 'float' values from the positions \a address[indices[0]],
+// \a address[indices[1]], .... The indices don't have to be sorted or unique.
+*/
+template< typename T >  // Type of the indices
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, Or< HasSize<T,1UL>, HasSize<T,2UL> > >
+                                     , sse_float_t >::Type
+   gather( const float* address, const T* indices )
+{
+   return gather_backend( address, indices );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'float' values via signed 4-byte indices.
+// \ingroup intrinsics
+//
+// \param address The base address of the values to be gathered.
+// \param indices The first of the indices of the values to be gathered.
+// \return The vector of gathered values.
+//
+// This function loads a vector of 'float' values from the positions \a address[indices[0]],
+// \a address[indices[1]], .... The indices don't have to be sorted or unique.
+*/
+template< typename T >  // Type of the indices
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, IsSigned<T>, HasSize<T,4UL> >
+                                     , sse_float_t >::Type
+   gather( const float* address, const T* indices )
+{
+#if BLAZE_AVX2_MODE
+   const __m256i vindex( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ) );
+   const __m256 mask( _mm256_castsi256_ps( _mm256_set1_epi32( -1 ) ) );
+   return _mm256_mask_i32gather_ps( _mm256_setzero_ps(), address, vindex, mask, 4 );
+#else
+   return gather_backend( address, indices );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'float' values via unsigned 4-byte indices.
+// \ingroup intrinsics
+//
+// \param address The base address of the values to be gathered.
+// \param indices The first of the indices of the values to be gathered.
+// \return The vector of gathered values.
+//
+// This function loads a vector of 'float' values from the positions \a address[indices[0]],
+// \a address[indices[1]], .... The indices don't have to be sorted or unique. Since the AVX2
+// gather instructions interpret 4-byte indices as signed values, the indices are zero-extended
+// to 8 bytes before the gather in order to support the full range of the index type.
+*/
+template< typename T >  // Type of the indices
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, IsUnsigned<T>, HasSize<T,4UL> >
+                                     , sse_float_t >::Type
+   gather( const float* address, const T* indices )
+{
+#if BLAZE_AVX2_MODE
+   const __m128i i1( _mm_loadu_si128( reinterpret_cast<const __m128i*>( indices     ) ) );
+   const __m128i i2( _mm_loadu_si128( reinterpret_cast<const __m128i*>( indices+4UL ) ) );
+   const __m128 mask( _mm_castsi128_ps( _mm_set1_epi32( -1 ) ) );
+   const __m128 v1( _mm256_mask_i64gather_ps( _mm_setzero_ps(), address, _mm256_cvtepu32_epi64( i1 ), mask, 4 ) );
+   const __m128 v2( _mm256_mask_i64gather_ps( _mm_setzero_ps(), address, _mm256_cvtepu32_epi64( i2 ), mask, 4 ) );
+   return _mm256_insertf128_ps( _mm256_castps128_ps256( v1 ), v2, 1 );
+#else
+   return gather_backend( address, indices );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'float' values via 8-byte indices.
+// \ingroup intrinsics
+//
+// \param address The base address of the values to be gathered.
+// \param indices The first of the indices of the values to be gathered.
+// \return The vector of gathered values.
+//
+// This function loads a vector of 'float' values from the positions \a address[indices[0]],
+// \a address[indices[1]], .... The indices don't have to be sorted or unique.
+*/
+template< typename T >  // Type of the indices
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> >, sse_float_t >::Type
+   gather( const float* address, const T* indices )
+{
+#if BLAZE_AVX2_MODE
+   const __m256i i1( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices     ) ) );
+   const __m256i i2( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices+4UL ) ) );
+   const __m128 mask( _mm_castsi128_ps( _mm_set1_epi32( -1 ) ) );
+   const __m128 v1( _mm256_mask_i64gather_ps( _mm_setzero_ps(), address, i1, mask, 4 ) );
+   const __m128 v2( _mm256_mask_i64gather_ps( _mm_setzero_ps(), address, i2, mask, 4 ) );
+   return _mm256_insertf128_ps( _mm256_castps128_ps256( v1 ), v2, 1 );
+#else
+   return gather_backend( address, indices );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'double' values via 1-byte or 2-byte indices.
+// \ingroup intrinsics
+//
+// \param address The base address of the values to be gathered.
+// \param indices The first of the indices of the values to be gathered.
+// \return The vector of gathered values.
+//
+// This function loads a vector of 'double' values from the positions \a address[indices[0]],
+// \a address[indices[1]], .... The indices don't have to be sorted or unique.
+*/
+template< typename T >  // Type of the indices
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, Or< HasSize<T,1UL>, HasSize<T,2UL> > >
+                                     , sse_double_t >::Type
+   gather( const double* address, const T* indices )
+{
+   return gather_backend( address, indices );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'double' values via signed 4-byte indices.
+// \ingroup intrinsics
+//
+// \param address The base address of the values to be gathered.
+// \param indices The first of the indices of the values to be gathered.
+// \return The vector of gathered values.
+//
+// This function loads a vector of 'double' values from the positions \a address[indices[0]],
+// \a address[indices[1]], .... The indices don't have to be sorted or unique.
+*/
+template< typename T >  // Type of the indices
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, IsSigned<T>, HasSize<T,4UL> >
+                                     , sse_double_t >::Type
+   gather( const double* address, const T* indices )
+{
+#if BLAZE_AVX2_MODE
+   const __m128i vindex( _mm_loadu_si128( reinterpret_cast<const __m128i*>( indices ) ) );
+   const __m256d mask( _mm256_castsi256_pd( _mm256_set1_epi64x( -1L ) ) );
+   return _mm256_mask_i32gather_pd( _mm256_setzero_pd(), address, vindex, mask, 8 );
+#else
+   return gather_backend( address, indices );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'double' values via unsigned 4-byte indices.
+// \ingroup intrinsics
+//
+// \param address The base address of the values to be gathered.
+// \param indices The first of the indices of the values to be gathered.
+// \return The vector of gathered values.
+//
+// This function loads a vector of 'double' values from the positions \a address[indices[0]],
+// \a address[indices[1]], .... The indices don't have to be sorted or unique. Since the AVX2
+// gather instructions interpret 4-byte indices as signed values, the indices are zero-extended
+// to 8 bytes before the gather in order to support the full range of the index type.
+*/
+template< typename T >  // Type of the indices
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, IsUnsigned<T>, HasSize<T,4UL> >
+                                     , sse_double_t >::Type
+   gather( const double* address, const T* indices )
+{
+#if BLAZE_AVX2_MODE
+   const __m128i vindex( _mm_loadu_si128( reinterpret_cast<const __m128i*>( indices ) ) );
+   const __m256d mask( _mm256_castsi256_pd( _mm256_set1_epi64x( -1L ) ) );
+   return _mm256_mask_i64gather_pd( _mm256_setzero_pd(), address, _mm256_cvtepu32_epi64( vindex ), mask, 8 );
+#else
+   return gather_backend( address, indices );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'double' values via 8-byte indices.
+// \ingroup intrinsics
+//
+// \param address The base address of the values to be gathered.
+// \param indices The first of the indices of the values to be gathered.
+// \return The vector of gathered values.
+//
+// This function loads a vector of 'double' values from the positions \a address[indices[0]],
+// \a address[indices[1]], .... The indices don't have to be sorted or unique.
+*/
+template< typename T >  // Type of the indices
+BLAZE_ALWAYS_INLINE typename EnableIf< And< IsIntegral<T>, HasSize<T,8UL> >, sse_double_t >::Type
+   gather( const double* address, const T* indices )
+{
+#if BLAZE_AVX2_MODE
+   const __m256i vindex( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ) );
+   const __m256d mask( _mm256_castsi256_pd( _mm256_set1_epi64x( -1L ) ) );
+   return _mm256_mask_i64gather_pd( _mm256_setzero_pd(), address, vindex, mask, 8 );
+#else
+   return gather_backend( address, indices );
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,7 +40,9 @@
 // Includes
 //*************************************************************************************************
 
+#include <ios>
 #include <stdexcept>
+#include <vector>
 #include <blaze/math/constraints/Matrix.h>
 #include <blaze/math/dense/DynamicMatrix.h>
 #include <blaze/math/expressions/DenseMatrix.h>
@@ -48,14 +50,21 @@
 #include <blaze/math/expressions/Matrix.h>
 #include <blaze/math/serialization/TypeValueMapping.h>
 #include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/typetraits/HasBandStorage.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 #include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSquare.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Numeric.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/mpl/Not.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/Unused.h>
 
 
 namespace blaze {
@@ -215,6 +224,9 @@ class MatrixSerializer
    //@{
    template< typename Archive, typename MT, bool SO >
    void serialize( Archive& archive, const Matrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   void serializeIndexed( Archive& archive, const Matrix<MT,SO>& mat );
    //@}
    //**********************************************************************************************
 
@@ -223,6 +235,13 @@ class MatrixSerializer
    //@{
    template< typename Archive, typename MT, bool SO >
    void deserialize( Archive& archive, Matrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   void deserialize( Archive& archive, Matrix<MT,SO>& mat,
+                     size_t row, size_t column, size_t m, size_t n );
+
+   template< typename Archive, typename MT, bool SO >
+   void deserializeRows( Archive& archive, Matrix<MT,SO>& mat, size_t row, size_t m );
    //@}
    //**********************************************************************************************
 
@@ -231,7 +250,13 @@ class MatrixSerializer
    /*!\name Serialization functions */
    //@{
    template< typename Archive, typename MT >
-   void serializeHeader( Archive& archive, const MT& mat );
+   void serializeHeader( Archive& archive, const MT& mat, uint8_t version = 1U );
+
+   template< typename Archive, typename MT, bool SO >
+   void serializeOffsets( Archive& archive, const DenseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   void serializeOffsets( Archive& archive, const SparseMatrix<MT,SO>& mat );
 
    template< typename Archive, typename MT, bool SO >
    void serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
@@ -247,6 +272,9 @@ class MatrixSerializer
    template< typename Archive, typename MT >
    void deserializeHeader( Archive& archive, const MT& mat );
 
+   template< typename Archive >
+   void skipOffsets( Archive& archive );
+
    template< typename MT, bool SO >
    typename DisableIf< IsResizable<MT> >::Type prepareMatrix( DenseMatrix<MT,SO>& mat );
 
@@ -254,7 +282,10 @@ class MatrixSerializer
    typename DisableIf< IsResizable<MT> >::Type prepareMatrix( SparseMatrix<MT,SO>& mat );
 
    template< typename MT >
-   typename EnableIf< IsResizable<MT> >::Type prepareMatrix( MT& mat );
+   typename EnableIf< And< IsResizable<MT>, Not< IsSquare<MT> > > >::Type prepareMatrix( MT& mat );
+
+   template< typename MT >
+   typename EnableIf< And< IsResizable<MT>, IsSquare<MT> > >::Type prepareMatrix( MT& mat );
 
    template< typename Archive, typename MT >
    void deserializeMatrix( Archive& archive, MT& mat );
@@ -309,6 +340,49 @@ class MatrixSerializer
    //@}
    //**********************************************************************************************
 
+   //**Partial deserialization functions***********************************************************
+   /*!
+ame Partial deserialization functions */
+   //@{
+   template< typename Archive, typename MT, bool SO >
+   void deserializeSubmatrix( Archive& archive, DenseMatrix<MT,SO>& mat,
+                              size_t row, size_t column, size_t m, size_t n );
+
+   template< typename Archive, typename MT, bool SO >
+   void deserializeSubmatrix( Archive& archive, SparseMatrix<MT,SO>& mat,
+                              size_t row, size_t column, size_t m, size_t n );
+
+   template< typename MT >
+   typename DisableIf< IsResizable<MT> >::Type prepareSubmatrix( MT& mat, size_t m, size_t n );
+
+   template< typename MT >
+   typename EnableIf< And< IsResizable<MT>, Not< IsSquare<MT> > > >::Type
+      prepareSubmatrix( MT& mat, size_t m, size_t n );
+
+   template< typename MT >
+   typename EnableIf< And< IsResizable<MT>, IsSquare<MT> > >::Type
+      prepareSubmatrix( MT& mat, size_t m, size_t n );
+
+   template< typename Archive, typename MT >
+   void readDenseSubmatrix( Archive& archive, MT& mat, size_t row, size_t column, size_t m, size_t n );
+
+   template< typename Archive, typename MT >
+   void readSparseSubmatrix( Archive& archive, MT& mat, size_t row, size_t column, size_t m, size_t n );
+
+   template< typename MT, bool SO >
+   void reserveLine( DenseMatrix<MT,SO>& mat, size_t line, size_t nonzeros );
+
+   template< typename Type, bool SO, typename IT >
+   void reserveLine( CompressedMatrix<Type,SO,IT>& mat, size_t line, size_t nonzeros );
+
+   template< typename MT, bool SO >
+   void storeElement( DenseMatrix<MT,SO>& mat, size_t i, size_t j, const typename MT::ElementType& value );
+
+   template< typename Type, bool SO, typename IT >
+   void storeElement( CompressedMatrix<Type,SO,IT>& mat, size_t i, size_t j, const Type& value );
+   //@}
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
@@ -319,6 +393,7 @@ class MatrixSerializer
    uint64_t rows_;         //!< The number of rows of the matrix.
    uint64_t columns_;      //!< The number of columns of the matrix.
    uint64_t number_;       //!< The total number of elements contained in the matrix.
+   std::streampos start_;  //!< The position of the first element (partial deserialization only).
    //@}
    //**********************************************************************************************
 };
@@ -344,6 +419,7 @@ MatrixSerializer::MatrixSerializer()
    , rows_       ( 0UL )  // The number of rows of the matrix
    , columns_    ( 0UL )  // The number of columns of the matrix
    , number_     ( 0UL )  // The total number of elements contained in the matrix
+   , start_      ()       // The position of the first element
 {}
 //*************************************************************************************************
 
@@ -379,21 +455,55 @@ void MatrixSerializer::serialize( Archive& archive, const Matrix<MT,SO>& mat )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serializes the given matrix including an offset table and writes it to the archive.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+// \exception std::runtime_error Error during serialization.
+//
+// In contrast to the serialize() function, this function additionally writes a table with the
+// byte offsets of all rows (row-major sparse matrices) or columns (column-major sparse matrices)
+// in front of the elements. This table enables the partial deserialization of the matrix from a
+// seekable archive without reading the preceding rows or columns. For dense matrices the offsets
+// can be computed from the matrix size and therefore no table is written. Note that the element
+// type of the matrix has to be a built-in or complex data type.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+void MatrixSerializer::serializeIndexed( Archive& archive, const Matrix<MT,SO>& mat )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( typename MT::ElementType );
+
+   if( !archive ) {
+      throw std::runtime_error( "Faulty archive detected" );
+   }
+
+   serializeHeader ( archive, ~mat, ( IsDenseMatrix<MT>::value )?( 1U ):( 2U ) );
+   serializeOffsets( archive, ~mat );
+   serializeMatrix ( archive, ~mat );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Serializes all meta information about the given matrix.
 //
 // \param archive The archive to be written.
 // \param mat The matrix to be serialized.
+// \param version The version of the serialization format (1 or 2 for indexed sparse matrices).
 // \return void
 // \exception std::runtime_error File header could not be serialized.
 */
 template< typename Archive  // Type of the archive
         , typename MT >     // Type of the matrix
-void MatrixSerializer::serializeHeader( Archive& archive, const MT& mat )
+void MatrixSerializer::serializeHeader( Archive& archive, const MT& mat, uint8_t version )
 {
    typedef typename MT::ElementType  ET;
 
-   archive << uint8_t ( 1U );
+   archive << uint8_t ( version );
    archive << uint8_t ( MatrixValueMapping<MT>::value );
    archive << uint8_t ( TypeValueMapping<ET>::value );
    archive << uint8_t ( sizeof( ET ) );
@@ -408,6 +518,62 @@ void MatrixSerializer::serializeHeader( Archive& archive, const MT& mat )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serializes the offset table of a dense matrix.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+//
+// The offsets of the rows/columns of a dense matrix can be computed from the size of the matrix.
+// Therefore no offset table is written.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+void MatrixSerializer::serializeOffsets( Archive& archive, const DenseMatrix<MT,SO>& mat )
+{
+   UNUSED_PARAMETER( archive, mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the offset table of a sparse matrix.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+// \exception std::runtime_error Offset table could not be serialized.
+//
+// This function writes the byte offsets of all rows (in case of a row-major matrix) or columns
+// (in case of a column-major matrix) relative to the first element of the matrix. The table
+// additionally contains the end offset of the matrix, i.e. it consists of \f$ M+1 \f$ entries
+// for a row-major matrix with \f$ M \f$ rows.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+void MatrixSerializer::serializeOffsets( Archive& archive, const SparseMatrix<MT,SO>& mat )
+{
+   const uint64_t entry( sizeof( size_t ) + sizeof( typename MT::ElementType ) );
+   const size_t   lines( ( SO == rowMajor )?( (~mat).rows() ):( (~mat).columns() ) );
+
+   uint64_t offset( 0UL );
+   archive << offset;
+
+   for( size_t k=0UL; k<lines; ++k ) {
+      offset += sizeof( uint64_t ) + (~mat).nonZeros( k ) * entry;
+      archive << offset;
+   }
+
+   if( !archive ) {
+      throw std::runtime_error( "Offset table could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Serializes the elements of a dense matrix.
 //
@@ -496,7 +662,14 @@ void MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,
 // \param archive The archive to be read from.
 // \param mat The matrix to be deserialized.
 // \return void
+// \exception std::invalid_argument Invalid assignment to a square matrix.
 // \exception std::runtime_error Error during deserialization.
+//
+// Resizable square matrices (as for instance symmetric or triangular matrices with a restricted
+// element access) are not reconstituted element-wise. Instead, the matrix is deserialized into a
+// general temporary matrix, which is subsequently assigned to the given matrix. Thus the matrix
+// is able to check the invariants of the serialized matrix. The same applies to band matrices,
+// which deduce their bandwidths from the non-zero elements of the sparse temporary matrix.
 */
 template< typename Archive  // Type of the archive
         , typename MT       // Type of the matrix
@@ -508,8 +681,110 @@ void MatrixSerializer::deserialize( Archive& archive, Matrix<MT,SO>& mat )
    }
 
    deserializeHeader( archive, ~mat );
+
+   if( !IsResizable<MT>::value && ( rows_ != (~mat).rows() || columns_ != (~mat).columns() ) ) {
+      throw std::runtime_error( "Invalid matrix size detected" );
+   }
+
+   if( version_ == 2U ) {
+      skipOffsets( archive );
+   }
+
    prepareMatrix( ~mat );
-   deserializeMatrix( archive, ~mat );
+
+   if( IsResizable<MT>::value && ( IsSquare<MT>::value || HasBandStorage<MT>::value ) ) {
+      typedef typename MT::ElementType  ET;
+      typedef typename If< And< IsDenseMatrix<MT>, Not< HasBandStorage<MT> > >
+                         , DynamicMatrix<ET,rowMajor>
+                         , CompressedMatrix<ET,rowMajor> >::Type  TmpType;
+      TmpType tmp;
+      prepareMatrix( tmp );
+      deserializeMatrix( archive, tmp );
+      (~mat) = tmp;
+   }
+   else {
+      deserializeMatrix( archive, ~mat );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a submatrix of a matrix from the given archive.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \param row The index of the first row of the submatrix.
+// \param column The index of the first column of the submatrix.
+// \param m The number of rows of the submatrix.
+// \param n The number of columns of the submatrix.
+// \return void
+// \exception std::invalid_argument Invalid submatrix specification.
+// \exception std::runtime_error Error during deserialization.
+//
+// This function reconstitutes only the \f$ m \times n \f$ submatrix starting at row \a row and
+// column \a column of the serialized matrix. In case the given matrix is resizable, it is
+// resized to \f$ m \times n \f$, else its size has to match the size of the submatrix. The
+// archive must be seekable: instead of reading the complete matrix, the function only reads
+// the required rows and columns and finally moves the read position of the archive behind the
+// serialized matrix.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+void MatrixSerializer::deserialize( Archive& archive, Matrix<MT,SO>& mat,
+                                    size_t row, size_t column, size_t m, size_t n )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( typename MT::ElementType );
+
+   if( !archive ) {
+      throw std::invalid_argument( "Faulty archive detected" );
+   }
+
+   deserializeHeader( archive, ~mat );
+
+   if( row + m > rows_ || column + n > columns_ ) {
+      throw std::invalid_argument( "Invalid submatrix specification" );
+   }
+
+   deserializeSubmatrix( archive, ~mat, row, column, m, n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a range of rows of a matrix from the given archive.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \param row The index of the first row.
+// \param m The number of rows.
+// \return void
+// \exception std::invalid_argument Invalid row range.
+// \exception std::runtime_error Error during deserialization.
+//
+// This function reconstitutes the rows \f$ [row..row+m) \f$ of the serialized matrix. It is
+// equivalent to the partial deserialization of the submatrix that starts at row \a row and
+// spans all columns of the serialized matrix.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+void MatrixSerializer::deserializeRows( Archive& archive, Matrix<MT,SO>& mat, size_t row, size_t m )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( typename MT::ElementType );
+
+   if( !archive ) {
+      throw std::invalid_argument( "Faulty archive detected" );
+   }
+
+   deserializeHeader( archive, ~mat );
+
+   if( row + m > rows_ ) {
+      throw std::invalid_argument( "Invalid row range" );
+   }
+
+   deserializeSubmatrix( archive, ~mat, row, 0UL, m, columns_ );
 }
 //*************************************************************************************************
 
@@ -531,24 +806,54 @@ void MatrixSerializer::deserializeHeader( Archive& archive, const MT& mat )
    if( !( archive >> version_ >> type_ >> elementType_ >> elementSize_ >> rows_ >> columns_ >> number_ ) ) {
       throw std::runtime_error( "Corrupt archive detected" );
    }
-   else if( version_ != 1UL ) {
+   else if( version_ != 1U && version_ != 2U ) {
       throw std::runtime_error( "Invalid version detected" );
    }
    else if( ( type_ & 1U ) != 1U || ( type_ & (~7U) ) != 0U ) {
       throw std::runtime_error( "Invalid matrix type detected" );
    }
+   else if( version_ == 2U && ( type_ & 2U ) != 2U ) {
+      throw std::runtime_error( "Invalid version detected" );
+   }
    else if( elementType_ != TypeValueMapping<ET>::value ) {
       throw std::runtime_error( "Invalid element type detected" );
    }
    else if( elementSize_ != sizeof( ET ) ) {
       throw std::runtime_error( "Invalid element size detected" );
    }
-   else if( !IsResizable<MT>::value && ( rows_ != mat.rows() || columns_ != mat.columns() ) ) {
-      throw std::runtime_error( "Invalid matrix size detected" );
-   }
    else if( number_ > rows_*columns_ ) {
       throw std::runtime_error( "Invalid number of elements detected" );
    }
+
+   UNUSED_PARAMETER( mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skips the offset table of an indexed sparse matrix.
+//
+// \param archive The archive to be read from.
+// \return void
+// \exception std::runtime_error Corrupt archive detected.
+//
+// This function skips the offset table that precedes the elements of a sparse matrix that has
+// been serialized via the serializeIndexed() function (version 2 of the serialization format).
+*/
+template< typename Archive >  // Type of the archive
+void MatrixSerializer::skipOffsets( Archive& archive )
+{
+   const uint64_t lines( ( type_ & 4U )?( columns_ ):( rows_ ) );
+
+   uint64_t offset( 0UL );
+
+   for( uint64_t k=0UL; k<=lines; ++k ) {
+      archive >> offset;
+   }
+
+   if( !archive ) {
+      throw std::runtime_error( "Corrupt archive detected" );
+   }
 }
 //*************************************************************************************************
 
@@ -591,7 +896,8 @@ typename DisableIf< IsResizable<MT> >::Type MatrixSerializer::prepareMatrix( Spa
 // \return void
 */
 template< typename MT >  // Type of the matrix
-typename EnableIf< IsResizable<MT> >::Type MatrixSerializer::prepareMatrix( MT& mat )
+typename EnableIf< And< IsResizable<MT>, Not< IsSquare<MT> > > >::Type
+   MatrixSerializer::prepareMatrix( MT& mat )
 {
    mat.resize ( rows_, columns_, false );
    mat.reserve( number_ );
@@ -600,6 +906,28 @@ typename EnableIf< IsResizable<MT> >::Type MatrixSerializer::prepareMatrix( MT&
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Prepares the given resizable square matrix for the deserialization process.
+//
+// \param mat The square matrix to be prepared.
+// \return void
+// \exception std::runtime_error Invalid matrix size detected.
+*/
+template< typename MT >  // Type of the matrix
+typename EnableIf< And< IsResizable<MT>, IsSquare<MT> > >::Type
+   MatrixSerializer::prepareMatrix( MT& mat )
+{
+   if( rows_ != columns_ ) {
+      throw std::runtime_error( "Invalid matrix size detected" );
+   }
+
+   mat.resize ( rows_, false );
+   mat.reserve( number_ );
+   reset( mat );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Deserializes a matrix from the archive.
 //
@@ -1128,6 +1456,411 @@ void MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, SparseMa
 
 
 
+//=================================================================================================
+//
+//  PARTIAL DESERIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Deserializes a submatrix into the given dense matrix.
+//
+// \param archive The archive to be read from.
+// \param mat The dense matrix to be reconstituted.
+// \param row The index of the first row of the submatrix.
+// \param column The index of the first column of the submatrix.
+// \param m The number of rows of the submatrix.
+// \param n The number of columns of the submatrix.
+// \return void
+// \exception std::invalid_argument Invalid matrix size detected.
+// \exception std::runtime_error Error during deserialization.
+//
+// In case the given dense matrix is a resizable square matrix, the submatrix is read into a
+// temporary dense matrix, which is subsequently assigned to the given matrix.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+void MatrixSerializer::deserializeSubmatrix( Archive& archive, DenseMatrix<MT,SO>& mat,
+                                             size_t row, size_t column, size_t m, size_t n )
+{
+   prepareSubmatrix( ~mat, m, n );
+
+   start_ = archive.tellg();
+
+   if( IsResizable<MT>::value && ( IsSquare<MT>::value || HasBandStorage<MT>::value ) ) {
+      DynamicMatrix<typename MT::ElementType,rowMajor> tmp;
+      prepareSubmatrix( tmp, m, n );
+      if( type_ & 2U )
+         readSparseSubmatrix( archive, tmp, row, column, m, n );
+      else
+         readDenseSubmatrix( archive, tmp, row, column, m, n );
+      (~mat) = tmp;
+   }
+   else if( type_ & 2U ) {
+      readSparseSubmatrix( archive, ~mat, row, column, m, n );
+   }
+   else {
+      readDenseSubmatrix( archive, ~mat, row, column, m, n );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a submatrix into the given sparse matrix.
+//
+// \param archive The archive to be read from.
+// \param mat The sparse matrix to be reconstituted.
+// \param row The index of the first row of the submatrix.
+// \param column The index of the first column of the submatrix.
+// \param m The number of rows of the submatrix.
+// \param n The number of columns of the submatrix.
+// \return void
+// \exception std::invalid_argument Invalid matrix size detected.
+// \exception std::runtime_error Error during deserialization.
+//
+// The elements are appended to a temporary compressed matrix with the storage order of the
+// serialized matrix, which is subsequently assigned to the given (previously reset) sparse
+// matrix in case it contains any non-zero elements.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+void MatrixSerializer::deserializeSubmatrix( Archive& archive, SparseMatrix<MT,SO>& mat,
+                                             size_t row, size_t column, size_t m, size_t n )
+{
+   typedef typename MT::ElementType  ET;
+
+   prepareSubmatrix( ~mat, m, n );
+
+   start_ = archive.tellg();
+
+   if( ( type_ & 4U ) == 0U ) {
+      CompressedMatrix<ET,rowMajor> tmp( m, n );
+      if( type_ & 2U )
+         readSparseSubmatrix( archive, tmp, row, column, m, n );
+      else
+         readDenseSubmatrix( archive, tmp, row, column, m, n );
+      if( tmp.nonZeros() != 0UL )
+         (~mat) = tmp;
+   }
+   else {
+      CompressedMatrix<ET,columnMajor> tmp( m, n );
+      if( type_ & 2U )
+         readSparseSubmatrix( archive, tmp, row, column, m, n );
+      else
+         readDenseSubmatrix( archive, tmp, row, column, m, n );
+      if( tmp.nonZeros() != 0UL )
+         (~mat) = tmp;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Prepares the given non-resizable matrix for the partial deserialization process.
+//
+// \param mat The matrix to be prepared.
+// \param m The number of rows of the submatrix.
+// \param n The number of columns of the submatrix.
+// \return void
+// \exception std::invalid_argument Invalid matrix size detected.
+*/
+template< typename MT >  // Type of the matrix
+typename DisableIf< IsResizable<MT> >::Type
+   MatrixSerializer::prepareSubmatrix( MT& mat, size_t m, size_t n )
+{
+   if( mat.rows() != m || mat.columns() != n ) {
+      throw std::invalid_argument( "Invalid matrix size detected" );
+   }
+
+   reset( mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Prepares the given resizable matrix for the partial deserialization process.
+//
+// \param mat The matrix to be prepared.
+// \param m The number of rows of the submatrix.
+// \param n The number of columns of the submatrix.
+// \return void
+*/
+template< typename MT >  // Type of the matrix
+typename EnableIf< And< IsResizable<MT>, Not< IsSquare<MT> > > >::Type
+   MatrixSerializer::prepareSubmatrix( MT& mat, size_t m, size_t n )
+{
+   mat.resize( m, n, false );
+   reset( mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Prepares the given resizable square matrix for the partial deserialization process.
+//
+// \param mat The square matrix to be prepared.
+// \param m The number of rows of the submatrix.
+// \param n The number of columns of the submatrix.
+// \return void
+// \exception std::invalid_argument Invalid matrix size detected.
+*/
+template< typename MT >  // Type of the matrix
+typename EnableIf< And< IsResizable<MT>, IsSquare<MT> > >::Type
+   MatrixSerializer::prepareSubmatrix( MT& mat, size_t m, size_t n )
+{
+   if( m != n ) {
+      throw std::invalid_argument( "Invalid matrix size detected" );
+   }
+
+   mat.resize( m, false );
+   reset( mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a submatrix of a serialized dense matrix.
+//
+// \param archive The archive to be read from.
+// \param mat The target matrix.
+// \param row The index of the first row of the submatrix.
+// \param column The index of the first column of the submatrix.
+// \param m The number of rows of the submatrix.
+// \param n The number of columns of the submatrix.
+// \return void
+// \exception std::runtime_error Dense matrix could not be deserialized.
+//
+// Since all rows (row-major matrix) or columns (column-major matrix) of a serialized dense
+// matrix have the same size, the position of each required segment can be computed directly.
+// The function reads one contiguous segment per row/column of the submatrix and only seeks in
+// case the segments are not adjacent. Afterwards the read position is moved behind the matrix.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT >     // Type of the target matrix
+void MatrixSerializer::readDenseSubmatrix( Archive& archive, MT& mat,
+                                           size_t row, size_t column, size_t m, size_t n )
+{
+   typedef typename MT::ElementType  ET;
+
+   const bool   rowWise( ( type_ & 4U ) == 0U );
+   const size_t length ( rowWise ? columns_ : rows_ );
+   const size_t first  ( rowWise ? row : column );
+   const size_t count  ( rowWise ? m : n );
+   const size_t offset ( rowWise ? column : row );
+   const size_t size   ( rowWise ? n : m );
+
+   if( size > 0UL )
+   {
+      std::vector<ET> buffer( size );
+
+      for( size_t k=0UL; k<count; ++k )
+      {
+         if( k == 0UL || size != length ) {
+            archive.seekg( start_ + std::streamoff( ( ( first + k ) * length + offset ) * sizeof( ET ) ) );
+         }
+
+         archive.read( &buffer[0], size );
+         reserveLine( mat, k, size );
+
+         for( size_t l=0UL; l<size; ++l ) {
+            if( rowWise )
+               storeElement( mat, k, l, buffer[l] );
+            else
+               storeElement( mat, l, k, buffer[l] );
+         }
+      }
+   }
+
+   archive.seekg( start_ + std::streamoff( rows_ * columns_ * sizeof( ET ) ) );
+
+   if( !archive ) {
+      throw std::runtime_error( "Dense matrix could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a submatrix of a serialized sparse matrix.
+//
+// \param archive The archive to be read from.
+// \param mat The target matrix.
+// \param row The index of the first row of the submatrix.
+// \param column The index of the first column of the submatrix.
+// \param m The number of rows of the submatrix.
+// \param n The number of columns of the submatrix.
+// \return void
+// \exception std::runtime_error Sparse matrix could not be deserialized.
+//
+// In case the sparse matrix has been serialized via serializeIndexed(), the position of the
+// first required row (row-major matrix) or column (column-major matrix) and the end of the
+// matrix are taken from the offset table. Otherwise the preceding and subsequent rows/columns
+// are skipped based on their number of non-zero elements. Within each row/column the reading
+// stops as soon as the first element behind the submatrix has been encountered.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT >     // Type of the target matrix
+void MatrixSerializer::readSparseSubmatrix( Archive& archive, MT& mat,
+                                            size_t row, size_t column, size_t m, size_t n )
+{
+   typedef typename MT::ElementType  ET;
+
+   const bool   rowWise( ( type_ & 4U ) == 0U );
+   const size_t lines  ( rowWise ? rows_ : columns_ );
+   const size_t first  ( rowWise ? row : column );
+   const size_t count  ( rowWise ? m : n );
+   const size_t lower  ( rowWise ? column : row );
+   const size_t upper  ( lower + ( rowWise ? n : m ) );
+
+   const std::streamoff entry( sizeof( size_t ) + sizeof( ET ) );
+
+   uint64_t number( 0UL );
+   uint64_t offset( 0UL );
+   size_t   index ( 0UL );
+   ET       value = ET();
+
+   std::streampos data( start_ );
+
+   // Moving the read position to the first required row/column
+   if( version_ == 2U ) {
+      data += std::streamoff( ( lines + 1UL ) * sizeof( uint64_t ) );
+      archive.seekg( start_ + std::streamoff( first * sizeof( uint64_t ) ) );
+      archive >> offset;
+      archive.seekg( data + std::streamoff( offset ) );
+   }
+   else {
+      for( size_t k=0UL; k<first && archive; ++k ) {
+         archive >> number;
+         archive.seekg( archive.tellg() + std::streamoff( number ) * entry );
+      }
+   }
+
+   // Reading the required rows/columns
+   for( size_t k=0UL; k<count && archive; ++k )
+   {
+      archive >> number;
+      reserveLine( mat, k, ( number < upper-lower )?( number ):( upper-lower ) );
+
+      size_t j( 0UL );
+      while( ( j != number ) && ( archive >> index >> value ) )
+      {
+         ++j;
+
+         if( index >= upper ) {
+            archive.seekg( archive.tellg() + std::streamoff( number - j ) * entry );
+            break;
+         }
+         else if( index < lower ) {
+            continue;
+         }
+
+         if( rowWise )
+            storeElement( mat, k, index - lower, value );
+         else
+            storeElement( mat, index - lower, k, value );
+      }
+   }
+
+   // Moving the read position behind the matrix
+   if( version_ == 2U ) {
+      archive.seekg( start_ + std::streamoff( lines * sizeof( uint64_t ) ) );
+      archive >> offset;
+      archive.seekg( data + std::streamoff( offset ) );
+   }
+   else {
+      for( size_t k=first+count; k<lines && archive; ++k ) {
+         archive >> number;
+         archive.seekg( archive.tellg() + std::streamoff( number ) * entry );
+      }
+   }
+
+   if( !archive ) {
+      throw std::runtime_error( "Sparse matrix could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reserves memory for a row/column of a dense target matrix.
+//
+// \param mat The target matrix.
+// \param line The index of the row/column.
+// \param nonzeros The number of elements of the row/column.
+// \return void
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void MatrixSerializer::reserveLine( DenseMatrix<MT,SO>& mat, size_t line, size_t nonzeros )
+{
+   UNUSED_PARAMETER( mat, line, nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reserves memory for a row/column of a compressed target matrix.
+//
+// \param mat The target matrix.
+// \param line The index of the row/column.
+// \param nonzeros The maximum number of non-zero elements of the row/column.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void MatrixSerializer::reserveLine( CompressedMatrix<Type,SO,IT>& mat, size_t line, size_t nonzeros )
+{
+   mat.reserve( line, nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stores a single element in a dense target matrix.
+//
+// \param mat The target matrix.
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \param value The value of the element.
+// \return void
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order
+void MatrixSerializer::storeElement( DenseMatrix<MT,SO>& mat, size_t i, size_t j,
+                                     const typename MT::ElementType& value )
+{
+   (~mat)(i,j) = value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stores a single element in a compressed target matrix.
+//
+// \param mat The target matrix.
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \param value The value of the element.
+// \return void
+//
+// The element is appended to the matrix in case it is not a default value.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void MatrixSerializer::storeElement( CompressedMatrix<Type,SO,IT>& mat, size_t i, size_t j, const Type& value )
+{
+   mat.append( i, j, value, true );
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  MATRIXVALUEMAPPINGHELPER SPECIALIZATIONS
@@ -1290,6 +2023,120 @@ void deserialize( Archive& archive, Matrix<MT,SO>& mat )
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Serializes the given matrix including an offset table and writes it to the archive.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+// \exception std::runtime_error Matrix could not be serialized.
+//
+// The serializeIndexed() function converts the given matrix into a portable, binary
+// representation, which in contrast to the serialize() function additionally contains a
+// table with the offsets of all rows/columns of a sparse matrix. This enables the efficient
+// partial deserialization of the matrix from a seekable archive:
+
+   \code
+   // Serialization of a large sparse matrix
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> A;
+      // ... Resizing and initialization
+
+      blaze::Archive<std::ofstream> archive( "matrix.blaze", std::ofstream::binary );
+      serializeIndexed( archive, A );
+   }
+
+   // Reconstitution of the rows [1000..2000) of the matrix
+   {
+      blaze::CompressedMatrix<double,blaze::rowMajor> B;
+
+      blaze::Archive<std::ifstream> archive( "matrix.blaze", std::ifstream::binary );
+      deserializeRows( archive, B, 1000UL, 1000UL );
+   }
+   \endcode
+
+// Note that the resulting archive can still be read via the deserialize() function and that
+// the element type of the matrix has to be a built-in or complex data type.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+void serializeIndexed( Archive& archive, const Matrix<MT,SO>& mat )
+{
+   MatrixSerializer().serializeIndexed( archive, ~mat );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a submatrix of a matrix from the given archive.
+//
+// \param archive The seekable archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \param row The index of the first row of the submatrix.
+// \param column The index of the first column of the submatrix.
+// \param m The number of rows of the submatrix.
+// \param n The number of columns of the submatrix.
+// \return void
+// \exception std::invalid_argument Invalid submatrix specification.
+// \exception std::runtime_error Matrix could not be deserialized.
+//
+// This function reconstitutes only the \f$ m \times n \f$ submatrix starting at row \a row and
+// column \a column of the serialized matrix. Instead of reading the complete matrix, only the
+// required parts of the archive are read. For that purpose, the archive has to be bound to a
+// seekable stream (e.g. a file or string stream). In case the given matrix is resizable, it is
+// resized to \f$ m \times n \f$. Otherwise its size has to match the size of the submatrix,
+// which for instance enables the deserialization directly into a submatrix view:
+
+   \code
+   blaze::DynamicMatrix<double> A( 200UL, 100UL );
+   blaze::DenseSubmatrix< blaze::DynamicMatrix<double> > sm( submatrix( A, 50UL, 0UL, 100UL, 100UL ) );
+
+   blaze::Archive<std::ifstream> archive( "matrix.blaze", std::ifstream::binary );
+   deserialize( archive, sm, 500UL, 0UL, 100UL, 100UL );
+   \endcode
+
+// Dense matrices can always be partially deserialized. For sparse matrices the function makes
+// use of the offset table written by the serializeIndexed() function. In case the table is not
+// available, all preceding rows/columns are skipped based on their number of non-zero elements.
+// After the deserialization, the read position of the archive is located behind the matrix.
+// Note that the element type of the matrix has to be a built-in or complex data type.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+void deserialize( Archive& archive, Matrix<MT,SO>& mat,
+                  size_t row, size_t column, size_t m, size_t n )
+{
+   MatrixSerializer().deserialize( archive, ~mat, row, column, m, n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a range of rows of a matrix from the given archive.
+//
+// \param archive The seekable archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \param row The index of the first row.
+// \param m The number of rows.
+// \return void
+// \exception std::invalid_argument Invalid row range.
+// \exception std::runtime_error Matrix could not be deserialized.
+//
+// This function reconstitutes the rows \f$ [row..row+m) \f$ of the serialized matrix. For
+// more details see the partial deserialize() function.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+void deserializeRows( Archive& archive, Matrix<MT,SO>& mat, size_t row, size_t m )
+{
+   MatrixSerializer().deserializeRows( archive, ~mat, row, m );
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -0,0 +1,379 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/BlockPartition.h
+//  \brief Header file for the workload-balanced block partitioning of SMP assignments
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_BLOCKPARTITION_H_
+#define _BLAZE_MATH_SMP_BLOCKPARTITION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsMatMatMultExpr.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of a row or column range into blocks of (approximately) equal workload.
+// \ingroup smp
+//
+// The BlockPartition class splits the \a n rows (or columns) of the target of an SMP assignment
+// into a given number of consecutive blocks, one per thread. In case the work per row is uniform
+// the blocks are of equal size (except for the last block), which corresponds to the classical
+// partitioning of the SMP backends. In case of a product with a lower or upper triangular
+// operand, however, the submatrix of the product assigned to a block only spans the non-zero
+// part of the triangular operand (see the submatrix() function for matrix/matrix
+// multiplications). Therefore the work of a block of rows \f$ [r_0..r_1) \f$ is proportional
+// to \f$ (r_1-r_0) \cdot r_1 \f$ (increasing workload) or \f$ (r_1-r_0) \cdot (n-r_0) \f$
+// (decreasing workload). For these cases the block boundaries are chosen such that all blocks
+// perform the same number of floating point operations instead of the same number of rows. All
+// boundaries except for the last one are rounded down to a multiple of the given alignment.
+// Blocks that turn out to be empty are supposed to be skipped by the SMP backends.
+*/
+class BlockPartition
+{
+ public:
+   //**Type definitions****************************************************************************
+   //! Workload profile of the rows/columns to be partitioned.
+   enum Profile {
+      uniform    = 0,  //!< The work per row/column is constant.
+      increasing = 1,  //!< The work of a block grows with its last row/column.
+      decreasing = 2   //!< The work of a block shrinks with its first row/column.
+   };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline BlockPartition( size_t n, size_t blocks, size_t alignment, Profile profile );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t begin( size_t block ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline double boundary( size_t block ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t  n_;          //!< The total number of rows/columns.
+   size_t  blocks_;     //!< The number of blocks.
+   size_t  alignment_;  //!< The alignment of the block boundaries.
+   size_t  share_;      //!< The number of rows/columns per block in case of a uniform workload.
+   Profile profile_;    //!< The workload profile of the rows/columns.
+   double  cost_;       //!< The normalized work per block in case of a non-uniform workload.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for the BlockPartition class.
+//
+// \param n The total number of rows/columns to be partitioned.
+// \param blocks The number of blocks \f$[1..\infty)\f$.
+// \param alignment The alignment of the block boundaries \f$[1..\infty)\f$.
+// \param profile The workload profile of the rows/columns.
+//
+// In case of a non-uniform workload the normalized work per block is determined by a bisection
+// such that the blocks computed backwards from the last row/column exactly cover the first
+// block (see the boundary() function).
+*/
+inline BlockPartition::BlockPartition( size_t n, size_t blocks, size_t alignment, Profile profile )
+   : n_        ( n         )  // The total number of rows/columns
+   , blocks_   ( blocks    )  // The number of blocks
+   , alignment_( alignment )  // The alignment of the block boundaries
+   , share_    ( 0UL       )  // The number of rows/columns per block
+   , profile_  ( profile   )  // The workload profile of the rows/columns
+   , cost_     ( 0.0       )  // The normalized work per block
+{
+   BLAZE_INTERNAL_ASSERT( blocks    > 0UL, "Invalid number of blocks" );
+   BLAZE_INTERNAL_ASSERT( alignment > 0UL, "Invalid block alignment" );
+
+   const size_t addon     ( ( ( n % blocks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare( n / blocks + addon );
+   const size_t rest      ( equalShare % alignment );
+
+   share_ = ( rest )?( equalShare - rest + alignment ):( equalShare );
+
+   if( profile_ == uniform || blocks_ == 1UL )
+      return;
+
+   double lower( 0.0 );
+   double upper( 1.0 );
+
+   for( size_t iteration=0UL; iteration<64UL; ++iteration )
+   {
+      cost_ = 0.5 * ( lower + upper );
+
+      const double first( boundary( 1UL ) );
+
+      if( first * first > cost_ )
+         lower = cost_;
+      else
+         upper = cost_;
+   }
+
+   cost_ = lower;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the first row/column of the given block.
+//
+// \param block The index of the block \f$[0..blocks]\f$.
+// \return The first row/column of the block.
+//
+// The function returns the index of the first row/column of the given block. The end of the
+// block is given by the first row/column of the next block, i.e. passing the total number of
+// blocks returns the total number of rows/columns. Note that due to the alignment of the block
+// boundaries a block might be empty.
+*/
+inline size_t BlockPartition::begin( size_t block ) const
+{
+   if( block == 0UL )
+      return 0UL;
+
+   if( block >= blocks_ )
+      return n_;
+
+   if( profile_ == uniform )
+      return ( block*share_ < n_ )?( block*share_ ):( n_ );
+
+   size_t index( ( profile_ == increasing )
+                 ?( static_cast<size_t>( boundary( block ) * n_ ) )
+                 :( n_ - static_cast<size_t>( boundary( blocks_ - block ) * n_ ) ) );
+
+   index -= index % alignment_;
+
+   return ( index < n_ )?( index ):( n_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the normalized boundary of the given block in case of an increasing workload.
+//
+// \param block The index of the block \f$[1..blocks)\f$.
+// \return The normalized first row/column of the block \f$[0..1]\f$.
+//
+// Starting from the end of the last block the boundaries \f$ x_i \f$ are computed backwards
+// such that each block \f$ [x_i..x_{i+1}) \f$ performs the normalized work
+// \f$ (x_{i+1}-x_i) \cdot x_{i+1} = c \f$.
+*/
+inline double BlockPartition::boundary( size_t block ) const
+{
+   double x( 1.0 );
+
+   for( size_t i=blocks_; i>block && x>0.0; --i ) {
+      x -= cost_ / x;
+   }
+
+   return ( x > 0.0 )?( x ):( 0.0 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the determination of the workload profile of a dense matrix.
+// \ingroup smp
+//
+// In case the given dense matrix type is a matrix/matrix multiplication with a lower or upper
+// triangular operand, the work required to evaluate a row (or column) depends on its index.
+// The row profile is determined by the left-hand side operand, the column profile by the
+// right-hand side operand of the multiplication. For all other types (including products
+// with diagonal operands) the work per row and column is uniform.
+*/
+template< typename MT                               // Type of the dense matrix
+        , bool IsProduct = IsMatMatMultExpr<MT>::value >
+struct BlockPartitionProfile
+{
+   //**********************************************************************************************
+   enum { rows    = BlockPartition::uniform };
+   enum { columns = BlockPartition::uniform };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the BlockPartitionProfile class template for matrix/matrix
+//        multiplications.
+// \ingroup smp
+*/
+template< typename MT >  // Type of the dense matrix
+struct BlockPartitionProfile<MT,true>
+{
+   //**********************************************************************************************
+   typedef typename RemoveReference<typename MT::LeftOperand>::Type   MT1;
+   typedef typename RemoveReference<typename MT::RightOperand>::Type  MT2;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum { rows = ( IsLower<MT1>::value && !IsUpper<MT1>::value )
+                 ?( BlockPartition::increasing )
+                 :( ( IsUpper<MT1>::value && !IsLower<MT1>::value )
+                    ?( BlockPartition::decreasing )
+                    :( BlockPartition::uniform ) ) };
+
+   enum { columns = ( IsUpper<MT2>::value && !IsLower<MT2>::value )
+                    ?( BlockPartition::increasing )
+                    :( ( IsLower<MT2>::value && !IsUpper<MT2>::value )
+                       ?( BlockPartition::decreasing )
+                       :( BlockPartition::uniform ) ) };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the rows of the given dense matrix for an SMP assignment.
+// \ingroup smp
+//
+// \param dm The dense matrix to be assigned.
+// \param blocks The number of blocks \f$[1..\infty)\f$.
+// \param alignment The alignment of the block boundaries \f$[1..\infty)\f$.
+// \return The partition of the rows of the dense matrix.
+//
+// This function returns a partition of the rows of the given dense matrix into \a blocks blocks
+// of (approximately) equal workload. In case of a multiplication with a lower or upper left-hand
+// side operand the blocks are balanced by the number of floating point operations.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline const BlockPartition
+   rowPartition( const DenseMatrix<MT,SO>& dm, size_t blocks, size_t alignment )
+{
+   const BlockPartition::Profile profile(
+      static_cast<BlockPartition::Profile>( BlockPartitionProfile<MT>::rows ) );
+
+   return BlockPartition( (~dm).rows(), blocks, alignment, profile );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitions the columns of the given dense matrix for an SMP assignment.
+// \ingroup smp
+//
+// \param dm The dense matrix to be assigned.
+// \param blocks The number of blocks \f$[1..\infty)\f$.
+// \param alignment The alignment of the block boundaries \f$[1..\infty)\f$.
+// \return The partition of the columns of the dense matrix.
+//
+// This function returns a partition of the columns of the given dense matrix into \a blocks
+// blocks of (approximately) equal workload. In case of a multiplication with a lower or upper
+// right-hand side operand the blocks are balanced by the number of floating point operations.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline const BlockPartition
+   columnPartition( const DenseMatrix<MT,SO>& dm, size_t blocks, size_t alignment )
+{
+   const BlockPartition::Profile profile(
+      static_cast<BlockPartition::Profile>( BlockPartitionProfile<MT>::columns ) );
+
+   return BlockPartition( (~dm).columns(), blocks, alignment, profile );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
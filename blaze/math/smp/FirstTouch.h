@@ -0,0 +1,405 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/FirstTouch.h
+//  \brief Header file for the parallel first-touch initialization of dense vectors and matrices
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_FIRSTTOUCH_H_
+#define _BLAZE_MATH_SMP_FIRSTTOUCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/SMP.h>
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+#  include <omp.h>
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <blaze/math/smp/threads/ThreadBackend.h>
+#endif
+
+#include <blaze/math/Functions.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/smp/BlockPartition.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY CLASS TEMPLATES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief First-touch initialization of a block of consecutive rows or columns.
+// \ingroup smp
+//
+// The FirstTouchTask class template represents the initialization of \a lines consecutive rows
+// (or columns) of a dense vector or matrix, which are \a spacing elements apart. The first \a n
+// elements of each row/column are set to the given value, the remaining padding elements are
+// reset to their default value.
+*/
+template< typename Type >  // Data type of the elements
+struct FirstTouchTask
+{
+   //**Function call operator**********************************************************************
+   /*!\brief Initializes the elements of the block.
+   //
+   // \return void
+   */
+   inline void operator()() const {
+      for( size_t i=0UL; i<lines_; ++i ) {
+         Type* line( begin_ + i*spacing_ );
+         for( size_t j=0UL; j<n_; ++j )
+            line[j] = value_;
+         for( size_t j=n_; j<spacing_; ++j )
+            line[j] = Type();
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Type*  begin_;    //!< The first element of the block.
+   size_t lines_;    //!< The number of rows/columns of the block.
+   size_t n_;        //!< The number of elements per row/column to be set to the given value.
+   size_t spacing_;  //!< The spacing between the beginning of two rows/columns.
+   Type   value_;    //!< The initial value of the elements.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief First-touch initialization of the elements of a dense vector.
+// \ingroup smp
+//
+// The VectorFirstTouch class template splits the first-touch initialization of a dense vector
+// into blocks of consecutive elements. The last block additionally initializes the padding
+// elements up to the capacity of the vector.
+*/
+template< typename Type >  // Data type of the elements
+struct VectorFirstTouch
+{
+   //**Type definitions****************************************************************************
+   typedef Type  ElementType;  //!< Type of the vector elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for the partitioning of the contiguous dimension.
+   enum { contiguous = 1 };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the number of elements to be partitioned.
+   //
+   // \return The size of the vector.
+   */
+   inline size_t size() const {
+      return n_;
+   }
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the initialization of the given block of elements.
+   //
+   // \param index The first element of the block.
+   // \param size The number of elements of the block.
+   // \return The initialization of the block.
+   */
+   inline const FirstTouchTask<Type> block( size_t index, size_t size ) const {
+      const size_t spacing( ( index+size == n_ )?( capacity_-index ):( size ) );
+      const FirstTouchTask<Type> task = { array_+index, 1UL, size, spacing, value_ };
+      return task;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Type*  array_;     //!< The elements of the vector.
+   size_t n_;         //!< The size of the vector.
+   size_t capacity_;  //!< The capacity of the array.
+   Type   value_;     //!< The initial value of the elements.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief First-touch initialization of the elements of a dense matrix.
+// \ingroup smp
+//
+// The MatrixFirstTouch class template splits the first-touch initialization of a dense matrix
+// into blocks of consecutive rows (or columns in case of a column-major matrix).
+*/
+template< typename Type >  // Data type of the elements
+struct MatrixFirstTouch
+{
+   //**Type definitions****************************************************************************
+   typedef Type  ElementType;  //!< Type of the matrix elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for the partitioning of the contiguous dimension.
+   enum { contiguous = 0 };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the number of rows/columns to be partitioned.
+   //
+   // \return The number of rows of a row-major matrix (columns of a column-major matrix).
+   */
+   inline size_t size() const {
+      return m_;
+   }
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Returns the initialization of the given block of rows/columns.
+   //
+   // \param index The first row/column of the block.
+   // \param size The number of rows/columns of the block.
+   // \return The initialization of the block.
+   */
+   inline const FirstTouchTask<Type> block( size_t index, size_t size ) const {
+      const FirstTouchTask<Type> task = { array_+index*nn_, size, n_, nn_, value_ };
+      return task;
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Type*  array_;  //!< The elements of the matrix.
+   size_t m_;      //!< The number of rows (columns) of the matrix.
+   size_t n_;      //!< The number of columns (rows) of the matrix.
+   size_t nn_;     //!< The spacing between two rows (columns) of the matrix.
+   Type   value_;  //!< The initial value of the elements.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of threads available for a parallel first-touch initialization.
+// \ingroup smp
+//
+// \return The number of threads (1 in case the first-touch initialization is disabled).
+*/
+inline size_t firstTouchThreads()
+{
+#if BLAZE_USE_PARALLEL_FIRST_TOUCH
+   return getAvailableThreads();
+#else
+   return 1UL;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel execution of a first-touch initialization.
+// \ingroup smp
+//
+// \param init The first-touch initialization to be executed.
+// \return void
+//
+// This function partitions the given first-touch initialization in exactly the same way as the
+// SMP assignment backends partition a dense vector or a dense matrix with uniform workload:
+// In case of the OpenMP-based parallelization the rows/columns are split into the same number
+// of aligned blocks, which are distributed among the threads of the team via the same loop
+// schedule (see the \c BLAZE_OPENMP_SCHEDULING configuration). In case of a static schedule
+// every block is therefore initialized by the thread that later assigns it. In case of the
+// C++11 and Boost thread-based parallelization the rows/columns are split into one block per
+// thread of the team, which are scheduled via the execution context of the calling thread.
+*/
+template< typename FT >  // Type of the first-touch initialization
+void smpFirstTouch_backend( const FT& init )
+{
+#if BLAZE_OPENMP_PARALLEL_MODE
+   typedef typename FT::ElementType  ET;
+
+   BLAZE_PARALLEL_SECTION
+   {
+#pragma omp parallel shared( init ) num_threads( getAvailableThreads() )
+      {
+         const int    blocks   ( getNumBlocks() );
+         const size_t alignment( getBlockAlignment<ET>( IsVectorizable<ET>::value,
+                                                        FT::contiguous ) );
+         const BlockPartition partition( init.size(), blocks, alignment, BlockPartition::uniform );
+
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+         for( int i=0; i<blocks; ++i )
+         {
+            const size_t index( partition.begin( i ) );
+            const size_t size ( partition.begin( i+1 ) - index );
+
+            if( size != 0UL )
+               init.block( index, size )();
+         }
+      }
+   }
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   typedef typename FT::ElementType  ET;
+   typedef IntrinsicTrait<ET>        IT;
+
+   BLAZE_PARALLEL_SECTION
+   {
+      const TheThreadBackend::Team team;
+
+      const size_t threads  ( team.size() );
+      const size_t alignment( ( IsVectorizable<ET>::value )?( size_t( IT::size ) ):( 1UL ) );
+      const BlockPartition partition( init.size(), threads, alignment, BlockPartition::uniform );
+
+      for( size_t i=0UL; i<threads; ++i )
+      {
+         const size_t index( partition.begin( i ) );
+         const size_t size ( partition.begin( i+1UL ) - index );
+
+         if( size != 0UL )
+            TheThreadBackend::context().schedule( init.block( index, size ) );
+      }
+
+      TheThreadBackend::wait();
+   }
+#else
+   init.block( 0UL, init.size() )();
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FIRST-TOUCH INITIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel first-touch initialization of the elements of a dense vector.
+// \ingroup smp
+//
+// \param array The newly allocated elements of the vector.
+// \param n The size of the vector.
+// \param capacity The capacity of the array \f$[n..\infty)\f$.
+// \param value The initial value of the first \a n elements.
+// \return \a true in case the elements have been initialized, \a false if not.
+//
+// This function initializes the first \a n elements of the given array with \a value and the
+// remaining \a capacity - \a n elements with their default value. The elements are partitioned
+// among the threads in the same way as by the SMP assignment of a dense vector, such that the
+// memory pages of each block are placed on the memory node of a thread that is going to work
+// on the block. In case the parallel first-touch initialization is disabled, the vector is too
+// small to be assigned in parallel, the element type is not numeric, or a serial or parallel
+// section is active, the function returns \a false without touching the array.
+*/
+template< typename Type >  // Data type of the elements
+inline bool smpFirstTouch( Type* array, size_t n, size_t capacity, const Type& value )
+{
+   if( !IsNumeric<Type>::value || n <= SMP_DVECASSIGN_THRESHOLD ||
+       isSerialSectionActive() || isParallelSectionActive() || firstTouchThreads() < 2UL )
+      return false;
+
+   const VectorFirstTouch<Type> init = { array, n, capacity, value };
+   smpFirstTouch_backend( init );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel first-touch initialization of the elements of a dense matrix.
+// \ingroup smp
+//
+// \param array The newly allocated elements of the matrix.
+// \param m The number of rows of a row-major matrix (columns of a column-major matrix).
+// \param n The number of columns of a row-major matrix (rows of a column-major matrix).
+// \param nn The spacing between two rows (columns) of the matrix \f$[n..\infty)\f$.
+// \param value The initial value of the matrix elements.
+// \return \a true in case the elements have been initialized, \a false if not.
+//
+// This function initializes the first \a n elements of each of the \a m rows (or columns) of
+// the given array with \a value and the remaining padding elements with their default value.
+// The rows (or columns) are partitioned among the threads in the same way as by the SMP
+// assignment of a dense matrix with the same storage order, such that the memory pages of each
+// block are placed on the memory node of a thread that is going to work on the block. In case
+// the parallel first-touch initialization is disabled, the matrix is too small to be assigned
+// in parallel, the element type is not numeric, or a serial or parallel section is active, the
+// function returns \a false without touching the array.
+*/
+template< typename Type >  // Data type of the elements
+inline bool smpFirstTouch( Type* array, size_t m, size_t n, size_t nn, const Type& value )
+{
+   if( !IsNumeric<Type>::value || m <= SMP_DMATASSIGN_THRESHOLD ||
+       isSerialSectionActive() || isParallelSectionActive() || firstTouchThreads() < 2UL )
+      return false;
+
+   const MatrixFirstTouch<Type> init = { array, m, n, nn, value };
+   smpFirstTouch_backend( init );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
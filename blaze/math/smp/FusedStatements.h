@@ -0,0 +1,601 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/FusedStatements.h
+//  \brief Header file for the cache-blocked fusion of dense vector statements
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_FUSEDSTATEMENTS_H_
+#define _BLAZE_MATH_SMP_FUSEDSTATEMENTS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/SMP.h>
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+#  include <omp.h>
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <blaze/math/smp/threads/ThreadBackend.h>
+#endif
+
+#include <stdexcept>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/DenseSubvector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/smp/BlockPartition.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/traits/SubvectorExprTrait.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/PtrVector.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  AUXILIARY CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Block-wise plain assignment of a fused statement.
+// \ingroup smp
+*/
+struct FusedAssign
+{
+   template< typename VT1, typename VT2 >
+   static inline void apply( VT1& lhs, const VT2& rhs ) { assign( lhs, rhs ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Block-wise addition assignment of a fused statement.
+// \ingroup smp
+*/
+struct FusedAddAssign
+{
+   template< typename VT1, typename VT2 >
+   static inline void apply( VT1& lhs, const VT2& rhs ) { addAssign( lhs, rhs ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Block-wise subtraction assignment of a fused statement.
+// \ingroup smp
+*/
+struct FusedSubAssign
+{
+   template< typename VT1, typename VT2 >
+   static inline void apply( VT1& lhs, const VT2& rhs ) { subAssign( lhs, rhs ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Cache-blocked evaluation of a sequence of dense vector statements.
+// \ingroup smp
+//
+// The FusedStatements class records a sequence of dense vector (compound) assignments and
+// evaluates them block by block. Instead of streaming all operands of the first statement from
+// main memory, then all operands of the second statement, and so on, each block of all vectors
+// is processed by all statements before proceeding with the next block. Since the size of the
+// blocks is adapted to the cache size (see the \c blaze::cacheSize constant), operands that are
+// used in several statements are loaded from main memory only once. The blocks are distributed
+// among the available threads in the same way as by the SMP assignment of dense vectors:
+
+   \code
+   blaze::FusedStatements cg;
+
+   cg.subAssign( r, alpha * Ap );   // r -= alpha * Ap
+   cg.assign   ( p, r + beta * p ); // p  = r + beta * p
+   cg.addAssign( x, alpha * p );    // x += alpha * p
+
+   cg.run();  // Streams r, Ap, p and x from main memory only once
+   \endcode
+
+// Since every statement is evaluated block by block, only element-wise statements can be fused,
+// i.e. the value of an element of the right-hand side may only depend on the elements at the
+// same index of the operands. Expressions that require an intermediate evaluation, as for
+// instance matrix/vector multiplications, result in a compilation error. Also, all statements
+// have to be of the same size and in contrast to regular assignments the targets are not
+// resized. Both the targets and the operands can be dense vectors as well as dense subvectors
+// (which have to be passed as named objects in case of a target). However, in case a target is
+// also used as operand of the same or another statement, both have to refer to the same range
+// of elements. Note that the targets and operands are referenced by the fused statements,
+// whereas scalars are copied at the time of the recording, i.e. the recording has to be
+// repeated (see the clear() function) in case a scalar changes.
+*/
+class FusedStatements : private NonCopyable
+{
+ private:
+   //**Private class Statement*********************************************************************
+   /*!\brief Base class for all recorded statements.
+   */
+   struct Statement : private NonCopyable
+   {
+      //**Destructor*******************************************************************************
+      /*!\brief Destructor of the Statement class.
+      */
+      virtual ~Statement() {}
+      //*******************************************************************************************
+
+      //**Utility functions************************************************************************
+      /*!\brief Evaluates a single block of the statement.
+      //
+      // \param index The index of the first element of the block.
+      // \param size The number of elements of the block.
+      // \return void
+      */
+      virtual void execute( size_t index, size_t size ) = 0;
+
+      /*!\brief Returns the number of bytes of a single target element.
+      //
+      // \return The size of the target element type.
+      */
+      virtual size_t bytes() const = 0;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class StatementImpl*****************************************************************
+   /*!\brief Implementation of a single recorded statement.
+   */
+   template< typename Target  // Type of the target dense vector
+           , typename Source  // Type of the source dense vector
+           , typename OP >    // Type of the assignment operation
+   struct StatementImpl : public Statement
+   {
+      //**Type definitions*************************************************************************
+      //! Composite type of the source operand.
+      typedef typename SelectType< IsExpression<Source>::value, const Source, const Source& >::Type
+         Operand;
+
+      typedef typename Target::ElementType                         ET1;  //!< Target element type.
+      typedef typename Source::ElementType                         ET2;  //!< Source element type.
+      typedef typename SubvectorExprTrait<Target,aligned>::Type    AlignedTarget;
+      typedef typename SubvectorExprTrait<Target,unaligned>::Type  UnalignedTarget;
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the StatementImpl class template.
+      //
+      // \param target The target dense vector.
+      // \param source The source dense vector (expression).
+      */
+      explicit inline StatementImpl( Target& target, const Source& source )
+         : target_( &target )  // The target dense vector
+         , source_( source  )  // The source dense vector (expression)
+      {}
+      //*******************************************************************************************
+
+      //**Utility functions************************************************************************
+      /*!\brief Evaluates a single block of the statement.
+      //
+      // \param index The index of the first element of the block.
+      // \param size The number of elements of the block.
+      // \return void
+      */
+      virtual void execute( size_t index, size_t size )
+      {
+         const bool vectorizable( Target::vectorizable && Source::vectorizable &&
+                                  IsSame<ET1,ET2>::value );
+         const bool lhsAligned  ( vectorizable && target_->isAligned() );
+         const bool rhsAligned  ( vectorizable && source_.isAligned() );
+
+         if( lhsAligned && rhsAligned ) {
+            AlignedTarget target( subvector<aligned>( *target_, index, size ) );
+            OP::apply( target, subvector<aligned>( source_, index, size ) );
+         }
+         else if( lhsAligned ) {
+            AlignedTarget target( subvector<aligned>( *target_, index, size ) );
+            OP::apply( target, subvector<unaligned>( source_, index, size ) );
+         }
+         else if( rhsAligned ) {
+            UnalignedTarget target( subvector<unaligned>( *target_, index, size ) );
+            OP::apply( target, subvector<aligned>( source_, index, size ) );
+         }
+         else {
+            UnalignedTarget target( subvector<unaligned>( *target_, index, size ) );
+            OP::apply( target, subvector<unaligned>( source_, index, size ) );
+         }
+      }
+
+      /*!\brief Returns the number of bytes of a single target element.
+      //
+      // \return The size of the target element type.
+      */
+      virtual size_t bytes() const {
+         return sizeof( ET1 );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Target* target_;  //!< The target dense vector.
+      Operand source_;  //!< The source dense vector (expression).
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class Task**************************************************************************
+   /*!\brief Evaluation of a range of elements by a single thread.
+   */
+   struct Task
+   {
+      //**Function call operator*******************************************************************
+      /*!\brief Evaluates all statements for the range of elements.
+      //
+      // \return void
+      */
+      inline void operator()() const {
+         fused_->execute( begin_, end_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      FusedStatements* fused_;  //!< The fused statements.
+      size_t begin_;            //!< The first element of the range.
+      size_t end_;              //!< The end of the range.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline FusedStatements();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Recording functions*************************************************************************
+   /*!\name Recording functions */
+   //@{
+   template< typename VT1, bool TF, typename VT2 >
+   inline void assign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+   template< typename VT1, bool TF, typename VT2 >
+   inline void addAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+   template< typename VT1, bool TF, typename VT2 >
+   inline void subAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size () const;
+   inline void   clear();
+   inline void   run  ();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename OP, typename VT1, typename VT2 >
+   inline void record( VT1& lhs, const VT2& rhs );
+
+   inline void execute( size_t begin, size_t end );
+
+   static inline size_t threads();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   PtrVector<Statement> statements_;  //!< The recorded statements.
+   size_t n_;                         //!< The size of all statements.
+   size_t block_;                     //!< The number of elements per cache block.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor of FusedStatements.
+*/
+inline FusedStatements::FusedStatements()
+   : statements_()       // The recorded statements
+   , n_         ( 0UL )  // The size of all statements
+   , block_     ( 0UL )  // The number of elements per cache block
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RECORDING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Records the assignment of a dense vector to a dense vector.
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector (expression) to be assigned.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , bool TF         // Transpose flag of both vectors
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline void FusedStatements::assign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   record<FusedAssign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the addition assignment of a dense vector to a dense vector.
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector (expression) to be added.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , bool TF         // Transpose flag of both vectors
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline void FusedStatements::addAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   record<FusedAddAssign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the subtraction assignment of a dense vector to a dense vector.
+//
+// \param lhs The target left-hand side dense vector.
+// \param rhs The right-hand side dense vector (expression) to be subtracted.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , bool TF         // Transpose flag of both vectors
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline void FusedStatements::subAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   record<FusedSubAssign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of recorded statements.
+//
+// \return The number of recorded statements.
+*/
+inline size_t FusedStatements::size() const
+{
+   return statements_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes all recorded statements.
+//
+// \return void
+*/
+inline void FusedStatements::clear()
+{
+   statements_.clear();
+   n_     = 0UL;
+   block_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Evaluates all recorded statements.
+//
+// \return void
+//
+// This function evaluates all recorded statements block by block. In case the statements are
+// large enough to be assigned in parallel (see the \c BLAZE_SMP_DVECASSIGN_THRESHOLD), the
+// elements are partitioned among the available threads and every thread evaluates its share
+// block by block. Within a serial or parallel section the statements are evaluated by the
+// calling thread only.
+*/
+inline void FusedStatements::run()
+{
+   const size_t nthreads( threads() );
+
+   if( n_ <= SMP_DVECASSIGN_THRESHOLD || nthreads < 2UL ||
+       isSerialSectionActive() || isParallelSectionActive() ) {
+      execute( 0UL, n_ );
+      return;
+   }
+
+   const BlockPartition partition( n_, nthreads, 64UL, BlockPartition::uniform );
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+   BLAZE_PARALLEL_SECTION
+   {
+      const int n( static_cast<int>( nthreads ) );
+
+#pragma omp parallel shared( partition ) num_threads( n )
+      {
+         const int team( omp_get_num_threads() );
+
+         for( int i=omp_get_thread_num(); i<n; i+=team ) {
+            execute( partition.begin( i ), partition.begin( i+1 ) );
+         }
+      }
+   }
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   BLAZE_PARALLEL_SECTION
+   {
+      for( size_t i=0UL; i<nthreads; ++i )
+      {
+         const Task task = { this, partition.begin( i ), partition.begin( i+1UL ) };
+
+         if( task.begin_ < task.end_ )
+            TheThreadBackend::context().schedule( task );
+      }
+
+      TheThreadBackend::wait();
+   }
+#else
+   execute( 0UL, n_ );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the given statement.
+//
+// \param lhs The target dense vector.
+// \param rhs The source dense vector (expression).
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// The number of elements per cache block is chosen such that one block of the target and one
+// block of an operand of every statement fit into half of the cache of each thread. The block
+// size is a multiple of 64 elements in order to preserve the alignment of aligned operands.
+*/
+template< typename OP     // Type of the assignment operation
+        , typename VT1    // Type of the target dense vector
+        , typename VT2 >  // Type of the source dense vector
+inline void FusedStatements::record( VT1& lhs, const VT2& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( VT2 );
+
+   if( lhs.size() != rhs.size() || ( !statements_.isEmpty() && lhs.size() != n_ ) )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   statements_.pushBack( new StatementImpl<VT1,VT2,OP>( lhs, rhs ) );
+
+   size_t bytes( 0UL );
+   for( size_t i=0UL; i<statements_.size(); ++i ) {
+      bytes += 2UL * statements_[i]->bytes();
+   }
+
+   const size_t elements( cacheSize / ( 2UL * threads() * bytes ) );
+
+   n_     = lhs.size();
+   block_ = max( elements - elements % 64UL, 64UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Evaluates all statements for the given range of elements.
+//
+// \param begin The first element of the range.
+// \param end The end of the range.
+// \return void
+*/
+inline void FusedStatements::execute( size_t begin, size_t end )
+{
+   for( size_t index=begin; index<end; index+=block_ )
+   {
+      const size_t size( min( block_, end - index ) );
+
+      for( size_t i=0UL; i<statements_.size(); ++i ) {
+         statements_[i]->execute( index, size );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of threads available for the evaluation of the statements.
+//
+// \return The number of threads (1 in case the parallelization is deactivated).
+*/
+inline size_t FusedStatements::threads()
+{
+   return getAvailableThreads();
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
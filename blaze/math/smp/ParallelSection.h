@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <stdexcept>
+#include <blaze/system/SMP.h>
 #include <blaze/util/Suffix.h>
 
 
@@ -89,15 +90,19 @@ class ParallelSection
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static bool active_;  //!< Activity flag for the parallel section.
-                         /*!< In case a parallel section is active (i.e. the currently executed
-                              code is inside a parallel section), the flag is set to \a true,
-                              otherwise it is \a false. */
+   static BLAZE_THREAD_LOCAL bool active_;  //!< Activity flag for the parallel section.
+                                            /*!< In case a parallel section is active (i.e. the
+                                                 currently executed code is inside a parallel
+                                                 section), the flag is set to \a true,
+                                                 otherwise it is \a false. In case of the
+                                                 thread-based parallelization the flag is
+                                                 kept separately for every thread. */
    //@}
    //**********************************************************************************************
 
    //**Friend declarations*************************************************************************
    /*! \cond BLAZE_INTERNAL */
+   template< typename > friend class TaskSection;
    friend bool isParallelSectionActive();
    /*! \endcond */
    //**********************************************************************************************
@@ -116,7 +121,7 @@ class ParallelSection
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename T >
-bool ParallelSection<T>::active_ = false;
+BLAZE_THREAD_LOCAL bool ParallelSection<T>::active_ = false;
 /*! \endcond */
 //*************************************************************************************************
 
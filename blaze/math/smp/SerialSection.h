@@ -41,6 +41,9 @@
 //*************************************************************************************************
 
 #include <stdexcept>
+#include <blaze/math/smp/TaskSection.h>
+#include <blaze/math/smp/ThreadLimit.h>
+#include <blaze/system/SMP.h>
 #include <blaze/util/Suffix.h>
 
 
@@ -89,10 +92,13 @@ class SerialSection
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static bool active_;  //!< Activity flag for the serial section.
-                         /*!< In case a serial section is active (i.e. the currently executed
-                              code is inside a serial section), the flag is set to \a true,
-                              otherwise it is \a false. */
+   static BLAZE_THREAD_LOCAL bool active_;  //!< Activity flag for the serial section.
+                                            /*!< In case a serial section is active (i.e. the
+                                                 currently executed code is inside a serial
+                                                 section), the flag is set to \a true,
+                                                 otherwise it is \a false. In case of the
+                                                 thread-based parallelization the flag is
+                                                 kept separately for every thread. */
    //@}
    //**********************************************************************************************
 
@@ -116,7 +122,7 @@ class SerialSection
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename T >
-bool SerialSection<T>::active_ = false;
+BLAZE_THREAD_LOCAL bool SerialSection<T>::active_ = false;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -208,10 +214,15 @@ inline bool isSerialSectionActive();
 // \ingroup smp
 //
 // \return \a true if a serial section is active, \a false if not.
+//
+// Note that a thread limit of 1 (see the \a BLAZE_THREAD_LIMIT macro) is treated as an active
+// serial section. The same applies to the execution of a task of the C++11 or Boost thread-based
+// parallelization, i.e. parallel operations that are started from within a task (as for instance
+// by an element functor) are executed serially.
 */
 inline bool isSerialSectionActive()
 {
-   return SerialSection<int>::active_;
+   return SerialSection<int>::active_ || getThreadLimit() == 1UL || isTaskSectionActive();
 }
 //*************************************************************************************************
 
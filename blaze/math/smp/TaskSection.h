@@ -0,0 +1,206 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/TaskSection.h
+//  \brief Header file for the task section implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_TASKSECTION_H_
+#define _BLAZE_MATH_SMP_TASKSECTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/system/SMP.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Section for the execution of a task of the thread-based parallelization.
+// \ingroup smp
+//
+// The TaskSection class marks the execution of a task that has been scheduled via the C++11 or
+// Boost thread-based parallelization. Inside an active task section all parallel operations are
+// executed serially (see the isSerialSectionActive() function), since a parallel operation of a
+// task would wait for the completion of its partial operations, which are possibly queued behind
+// the task itself. In order to allow the execution of a task by the scheduling thread (which is
+// itself inside a parallel section), a task section additionally suspends the parallel section
+// of the executing thread. In contrast to serial and parallel sections, task sections may be
+// nested. On destruction the state of the enclosing section is restored.\n
+// This class must \b NOT be used explicitly! It is reserved for internal use only. Using
+// this class explicitly might result in erroneous results and/or in undefined behavior.
+*/
+template< typename T >
+class TaskSection
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline TaskSection( bool activate );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~TaskSection();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   bool active_;    //!< The activity flag of the enclosing task section.
+   bool parallel_;  //!< The activity flag of the enclosing parallel section.
+
+   static BLAZE_THREAD_LOCAL bool task_;  //!< Activity flag for the task section.
+                                          /*!< In case the calling thread executes a task,
+                                               the flag is set to \a true, otherwise it is
+                                               \a false. The flag is kept separately for
+                                               every thread. */
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   friend bool isTaskSectionActive();
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+BLAZE_THREAD_LOCAL bool TaskSection<T>::task_ = false;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the TaskSection class.
+//
+// \param activate \a true to enter a task section, \a false to leave the enclosing task section.
+*/
+template< typename T >
+inline TaskSection<T>::TaskSection( bool activate )
+   : active_  ( task_ )                        // Activity flag of the enclosing task section
+   , parallel_( ParallelSection<T>::active_ )  // Activity flag of the enclosing parallel section
+{
+   task_ = activate;
+
+   if( activate )
+      ParallelSection<T>::active_ = false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor of the TaskSection class.
+*/
+template< typename T >
+inline TaskSection<T>::~TaskSection()
+{
+   task_ = active_;                         // Restoring the enclosing task section
+   ParallelSection<T>::active_ = parallel_;  // Restoring the enclosing parallel section
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name TaskSection functions */
+//@{
+inline bool isTaskSectionActive();
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the calling thread executes a task of the thread-based parallelization.
+// \ingroup smp
+//
+// \return \a true if a task section is active, \a false if not.
+*/
+inline bool isTaskSectionActive()
+{
+   return TaskSection<int>::task_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
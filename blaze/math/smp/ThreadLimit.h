@@ -0,0 +1,283 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/ThreadLimit.h
+//  \brief Header file for the thread limit implementation
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADLIMIT_H_
+#define _BLAZE_MATH_SMP_THREADLIMIT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Suffix.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Section to limit the number of threads used by parallel operations.
+// \ingroup smp
+//
+// The ThreadLimit class is an auxiliary helper class for the \a BLAZE_THREAD_LIMIT macro. It
+// provides the functionality to restrict the number of threads used by all parallel operations
+// that are executed inside a thread limit section. In contrast to serial and parallel sections,
+// thread limit sections may be nested. In that case the smaller of both limits is in effect.
+*/
+template< typename T >
+class ThreadLimit
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   inline ThreadLimit( size_t limit );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~ThreadLimit();
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator bool() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t previous_;  //!< The thread limit of the enclosing section.
+
+   static BLAZE_THREAD_LOCAL size_t limit_;  //!< The currently active thread limit.
+                                             /*!< In case no thread limit is active, the limit
+                                                  is set to the largest possible value. In
+                                                  case of the thread-based parallelization
+                                                  the limit is kept separately for every
+                                                  thread. */
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   friend size_t getThreadLimit();
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+BLAZE_THREAD_LOCAL size_t ThreadLimit<T>::limit_ = ~size_t( 0UL );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThreadLimit class.
+//
+// \param limit The maximum number of threads \f$[1..\infty)\f$.
+// \exception std::invalid_argument Invalid thread limit.
+*/
+template< typename T >
+inline ThreadLimit<T>::ThreadLimit( size_t limit )
+   : previous_( limit_ )  // The thread limit of the enclosing section
+{
+   if( limit == 0UL )
+      throw std::invalid_argument( "Invalid thread limit" );
+
+   if( limit < limit_ )
+      limit_ = limit;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor of the ThreadLimit class.
+*/
+template< typename T >
+inline ThreadLimit<T>::~ThreadLimit()
+{
+   limit_ = previous_;  // Restoring the limit of the enclosing section
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion operator to \a bool.
+//
+// The conversion operator always returns \a true, i.e. the thread limit section is entered.
+*/
+template< typename T >
+inline ThreadLimit<T>::operator bool() const
+{
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name ThreadLimit functions */
+//@{
+inline size_t getThreadLimit();
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the currently active thread limit.
+// \ingroup smp
+//
+// \return The maximum number of threads for parallel operations of the calling thread.
+//
+// This function returns the maximum number of threads that may be used by a parallel operation
+// started by the calling thread. In case no thread limit section is active, the function returns
+// the largest possible \a size_t value.
+*/
+inline size_t getThreadLimit()
+{
+   return ThreadLimit<int>::limit_;
+}
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  THREAD LIMIT MACRO
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Section to limit the number of threads used by parallel operations.
+// \ingroup smp
+//
+// This macro provides the option to restrict the number of threads used by the parallel
+// operations within a section of code. The macro can either be applied to a block of code or
+// to a single statement, which allows to specify the number of threads per operation:
+
+   \code
+   using blaze::rowMajor;
+   using blaze::columnVector;
+
+   blaze::DynamicMatrix<double,rowMajor> A;
+   blaze::DynamicVector<double,columnVector> b, c, x, y;
+
+   // ... Resizing and initialization
+
+   // All operations within the section use at most two threads
+   BLAZE_THREAD_LIMIT( 2UL ) {
+      x = A * b;
+      y = A * c;
+   }
+
+   // Only this assignment is restricted to four threads
+   BLAZE_THREAD_LIMIT( 4UL ) x = A * b + c;
+   \endcode
+
+// Thread limit sections may be nested, in which case the smaller limit applies. A thread limit
+// of 1 enforces the serial execution of all operations (see \a BLAZE_SERIAL_SECTION). Note that
+// the limit only restricts the number of threads; the actual number of threads used by an
+// operation may be smaller, for instance if it is started from within an enclosing parallel
+// region. In case a thread limit of 0 is specified, a \a std::invalid_argument exception is
+// thrown.
+*/
+#define BLAZE_THREAD_LIMIT( LIMIT ) \
+   if( blaze::ThreadLimit<int> BLAZE_JOIN( threadLimit, __LINE__ ) = ( LIMIT ) )
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
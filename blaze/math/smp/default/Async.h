@@ -0,0 +1,210 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/Async.h
+//  \brief Header file for the default asynchronous assignment
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_ASYNC_H_
+#define _BLAZE_MATH_SMP_DEFAULT_ASYNC_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/smp/DenseMatrix.h>
+#include <blaze/math/smp/DenseVector.h>
+#include <blaze/math/smp/SparseMatrix.h>
+#include <blaze/math/smp/SparseVector.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Handle for an asynchronous assignment.
+// \ingroup smp
+//
+// The Future class represents a handle for an assignment that has been started via one of the
+// asyncAssign() functions. In case neither the C++11 nor the Boost thread-based parallelization
+// is active, all assignments are executed synchronously, i.e. the handle is always ready.
+*/
+class Future
+{
+ public:
+   //**Constructor*********************************************************************************
+   // No explicitly declared constructor.
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool isReady() const;
+   inline void wait   () const;
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the assignment has been completed.
+//
+// \return \a true.
+*/
+inline bool Future::isReady() const
+{
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for the completion of the assignment.
+//
+// \return void
+*/
+inline void Future::wait() const
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Asynchronous assignment functions */
+//@{
+template< typename VT1, bool TF, typename VT2 >
+inline Future asyncAssign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline Future asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the asynchronous assignment of a vector to a vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector (expression) to be assigned.
+// \return The handle for the assignment.
+// \exception std::invalid_argument Vector sizes do not match.
+// \exception std::invalid_argument Aliased target vector detected.
+//
+// This function implements the default asynchronous assignment of a vector to a vector, which
+// performs the SMP assignment of the two vectors synchronously. The function is selected in case
+// neither the C++11 nor the Boost thread-based parallelization is active. In case the sizes of
+// the two vectors don't match or in case the target vector is aliased by the expression, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename VT1    // Type of the left-hand side vector
+        , bool TF         // Transpose flag of both vectors
+        , typename VT2 >  // Type of the right-hand side vector
+inline Future asyncAssign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs )
+{
+   if( (~lhs).size() != (~rhs).size() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   if( (~rhs).isAliased( &~lhs ) )
+      throw std::invalid_argument( "Aliased target vector detected" );
+
+   smpAssign( ~lhs, ~rhs );
+
+   return Future();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the asynchronous assignment of a matrix to a matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix (expression) to be assigned.
+// \return The handle for the assignment.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Aliased target matrix detected.
+//
+// This function implements the default asynchronous assignment of a matrix to a matrix, which
+// performs the SMP assignment of the two matrices synchronously. The function is selected in
+// case neither the C++11 nor the Boost thread-based parallelization is active. In case the sizes
+// of the two matrices don't match or in case the target matrix is aliased by the expression, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline Future asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   if( (~lhs).rows() != (~rhs).rows() || (~lhs).columns() != (~rhs).columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( (~rhs).isAliased( &~lhs ) )
+      throw std::invalid_argument( "Aliased target matrix detected" );
+
+   smpAssign( ~lhs, ~rhs );
+
+   return Future();
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
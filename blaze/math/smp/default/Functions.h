@@ -58,9 +58,10 @@ namespace blaze {
 //*************************************************************************************************
 /*!\name SMP utility functions */
 //@{
-BLAZE_ALWAYS_INLINE size_t getNumThreads  ();
-BLAZE_ALWAYS_INLINE void   setNumThreads  ( size_t number );
-BLAZE_ALWAYS_INLINE void   shutDownThreads();
+BLAZE_ALWAYS_INLINE size_t getNumThreads      ();
+BLAZE_ALWAYS_INLINE size_t getAvailableThreads();
+BLAZE_ALWAYS_INLINE void   setNumThreads      ( size_t number );
+BLAZE_ALWAYS_INLINE void   shutDownThreads    ();
 //@}
 //*************************************************************************************************
 
@@ -81,6 +82,25 @@ BLAZE_ALWAYS_INLINE size_t getNumThreads()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns the number of threads available for a parallel operation of the calling thread.
+// \ingroup smp
+//
+// \return The number of threads available for a parallel operation.
+//
+// Via this function the number of threads that would be used by a parallel operation started
+// by the calling thread can be queried. In contrast to the getNumThreads() function, the result
+// takes the active thread limit (see the \a BLAZE_THREAD_LIMIT macro) and any enclosing parallel
+// region into account. Note that in case no parallelization is active the function will always
+// return 1.
+*/
+BLAZE_ALWAYS_INLINE size_t getAvailableThreads()
+{
+   return 1UL;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Sets the number of threads to be used for thread parallel operations.
 // \ingroup smp
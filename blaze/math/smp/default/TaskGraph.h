@@ -0,0 +1,451 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/TaskGraph.h
+//  \brief Header file for the default task graph
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_TASKGRAPH_H_
+#define _BLAZE_MATH_SMP_DEFAULT_TASKGRAPH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/PtrVector.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Deferred execution of a sequence of assignments.
+// \ingroup smp
+//
+// The TaskGraph class records a sequence of (compound) assignments and executes them on request.
+// In case neither the C++11 nor the Boost thread-based parallelization is active, the recorded
+// assignments are executed one after another in the order of their recording. The recorded
+// assignments can be executed any number of times. Note however that the operands are referenced
+// by the task graph, whereas scalars are copied at the time of the recording. In contrast to
+// regular assignments the targets are not resized, i.e. the sizes of the targets have to match
+// the sizes of the assigned expressions.
+*/
+class TaskGraph : private NonCopyable
+{
+ private:
+   //**Private class Node**************************************************************************
+   /*!\brief Base class for all recorded assignments.
+   */
+   struct Node : private NonCopyable
+   {
+      //**Destructor*******************************************************************************
+      /*!\brief Destructor of the Node class.
+      */
+      virtual ~Node() {}
+      //*******************************************************************************************
+
+      //**Utility functions************************************************************************
+      /*!\brief Executes the assignment.
+      //
+      // \return void
+      */
+      virtual void execute() = 0;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class Statement*********************************************************************
+   /*!\brief Implementation of a single recorded assignment.
+   */
+   template< typename Target  // Type of the target operand
+           , typename Source  // Type of the source operand
+           , typename OP >    // Type of the assignment operation
+   struct Statement : public Node
+   {
+      //**Type definitions*************************************************************************
+      //! Composite type of the source operand.
+      typedef typename SelectType< IsExpression<Source>::value, const Source, const Source& >::Type
+         Operand;
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Statement class template.
+      //
+      // \param target The target operand to be assigned to.
+      // \param source The source operand to be assigned to the target.
+      */
+      explicit inline Statement( Target& target, const Source& source )
+         : target_( &target )  // The target operand
+         , source_( source  )  // The source operand
+      {}
+      //*******************************************************************************************
+
+      //**Utility functions************************************************************************
+      /*!\brief Executes the assignment.
+      //
+      // \return void
+      */
+      virtual void execute() {
+         OP::apply( *target_, source_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Target* target_;  //!< The target operand.
+      Operand source_;  //!< The source operand.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class Assign************************************************************************
+   /*!\brief Plain assignment operation.
+   */
+   struct Assign {
+      template< typename T1, typename T2 >
+      static inline void apply( T1& lhs, const T2& rhs ) { lhs = rhs; }
+   };
+   //**********************************************************************************************
+
+   //**Private class AddAssign*********************************************************************
+   /*!\brief Addition assignment operation.
+   */
+   struct AddAssign {
+      template< typename T1, typename T2 >
+      static inline void apply( T1& lhs, const T2& rhs ) { lhs += rhs; }
+   };
+   //**********************************************************************************************
+
+   //**Private class SubAssign*********************************************************************
+   /*!\brief Subtraction assignment operation.
+   */
+   struct SubAssign {
+      template< typename T1, typename T2 >
+      static inline void apply( T1& lhs, const T2& rhs ) { lhs -= rhs; }
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline TaskGraph();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Recording functions*************************************************************************
+   /*!\name Recording functions */
+   //@{
+   template< typename VT1, bool TF, typename VT2 >
+   inline void assign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs );
+
+   template< typename VT1, bool TF, typename VT2 >
+   inline void addAssign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs );
+
+   template< typename VT1, bool TF, typename VT2 >
+   inline void subAssign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs );
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   inline void assign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   inline void addAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   inline void subAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size () const;
+   inline void   clear();
+   inline void   run  ();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename OP, typename T1, typename T2 >
+   inline void record( T1& lhs, const T2& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   PtrVector<Node> nodes_;  //!< The recorded assignments.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor of TaskGraph.
+*/
+inline TaskGraph::TaskGraph()
+   : nodes_()  // The recorded assignments
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RECORDING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Records the assignment of a vector to a vector.
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector (expression) to be assigned.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT1    // Type of the left-hand side vector
+        , bool TF         // Transpose flag of both vectors
+        , typename VT2 >  // Type of the right-hand side vector
+inline void TaskGraph::assign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs )
+{
+   if( (~lhs).size() != (~rhs).size() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   record<Assign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the addition assignment of a vector to a vector.
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector (expression) to be added.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT1    // Type of the left-hand side vector
+        , bool TF         // Transpose flag of both vectors
+        , typename VT2 >  // Type of the right-hand side vector
+inline void TaskGraph::addAssign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs )
+{
+   if( (~lhs).size() != (~rhs).size() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   record<AddAssign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the subtraction assignment of a vector to a vector.
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector (expression) to be subtracted.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT1    // Type of the left-hand side vector
+        , bool TF         // Transpose flag of both vectors
+        , typename VT2 >  // Type of the right-hand side vector
+inline void TaskGraph::subAssign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs )
+{
+   if( (~lhs).size() != (~rhs).size() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   record<SubAssign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the assignment of a matrix to a matrix.
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix (expression) to be assigned.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void TaskGraph::assign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   if( (~lhs).rows() != (~rhs).rows() || (~lhs).columns() != (~rhs).columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   record<Assign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the addition assignment of a matrix to a matrix.
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix (expression) to be added.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void TaskGraph::addAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   if( (~lhs).rows() != (~rhs).rows() || (~lhs).columns() != (~rhs).columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   record<AddAssign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the subtraction assignment of a matrix to a matrix.
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix (expression) to be subtracted.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void TaskGraph::subAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   if( (~lhs).rows() != (~rhs).rows() || (~lhs).columns() != (~rhs).columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   record<SubAssign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of recorded assignments.
+//
+// \return The number of recorded assignments.
+*/
+inline size_t TaskGraph::size() const
+{
+   return nodes_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes all recorded assignments.
+//
+// \return void
+*/
+inline void TaskGraph::clear()
+{
+   nodes_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes all recorded assignments.
+//
+// \return void
+//
+// This function executes all recorded assignments in the order of their recording.
+*/
+inline void TaskGraph::run()
+{
+   for( size_t i=0UL; i<nodes_.size(); ++i ) {
+      nodes_[i]->execute();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the given assignment.
+//
+// \param lhs The target operand.
+// \param rhs The source operand.
+// \return void
+*/
+template< typename OP    // Type of the assignment operation
+        , typename T1    // Type of the target operand
+        , typename T2 >  // Type of the source operand
+inline void TaskGraph::record( T1& lhs, const T2& rhs )
+{
+   nodes_.pushBack( new Statement<T1,T2,OP>( lhs, rhs ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -46,7 +46,8 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Functions.h>
-#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/smp/BlockPartition.h>
+#include <blaze/math/smp/openmp/Functions.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/SparseSubmatrix.h>
@@ -97,11 +98,10 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( omp_get_level() > 0, "Invalid call outside a parallel region" );
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
    typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
@@ -109,22 +109,19 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int    blocks   ( getNumBlocks() );
+   const size_t alignment( getBlockAlignment<ET1>( vectorizable, SO == columnMajor ) );
+   const BlockPartition partition( rowPartition( ~rhs, blocks, alignment ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<blocks; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( partition.begin( i ) );
+      const size_t m  ( partition.begin( i+1UL ) - row );
 
-      if( row >= (~lhs).rows() )
+      if( m == 0UL )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
          assign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
@@ -170,11 +167,10 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMa
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( omp_get_level() > 0, "Invalid call outside a parallel region" );
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
    typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
@@ -182,22 +178,19 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int    blocks   ( getNumBlocks() );
+   const size_t alignment( getBlockAlignment<ET1>( vectorizable, SO == rowMajor ) );
+   const BlockPartition partition( columnPartition( ~rhs, blocks, alignment ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<blocks; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( partition.begin( i ) );
+      const size_t n     ( partition.begin( i+1UL ) - column );
 
-      if( column >= (~lhs).columns() )
+      if( n == 0UL )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
          assign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
@@ -243,25 +236,28 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowMajo
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( omp_get_level() > 0, "Invalid call outside a parallel region" );
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
+   const int    blocks      ( getNumBlocks() );
+   const size_t alignment   ( getBlockAlignment<ET1>( false, SO == columnMajor ) );
+   const size_t addon       ( ( ( (~lhs).rows() % blocks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare  ( (~lhs).rows() / blocks + addon );
+   const size_t rest        ( equalShare % alignment );
+   const size_t rowsPerBlock( ( rest )?( equalShare - rest + alignment ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<blocks; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( i*rowsPerBlock );
 
       if( row >= (~lhs).rows() )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+      const size_t m( min( rowsPerBlock, (~lhs).rows() - row ) );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
       assign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
    }
@@ -293,25 +289,28 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,columnM
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( omp_get_level() > 0, "Invalid call outside a parallel region" );
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const int    blocks      ( getNumBlocks() );
+   const size_t alignment   ( getBlockAlignment<ET1>( false, SO == rowMajor ) );
+   const size_t addon       ( ( ( (~lhs).columns() % blocks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare  ( (~lhs).columns() / blocks + addon );
+   const size_t rest        ( equalShare % alignment );
+   const size_t colsPerBlock( ( rest )?( equalShare - rest + alignment ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<blocks; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( i*colsPerBlock );
 
       if( column >= (~lhs).columns() )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t n( min( colsPerBlock, (~lhs).columns() - column ) );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
       assign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
    }
@@ -399,7 +398,7 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
          assign( ~lhs, ~rhs );
       }
       else {
-#pragma omp parallel shared( lhs, rhs )
+#pragma omp parallel shared( lhs, rhs ) num_threads( getAvailableThreads() )
          smpAssign_backend( ~lhs, ~rhs );
       }
    }
@@ -440,11 +439,10 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( omp_get_level() > 0, "Invalid call outside a parallel region" );
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
    typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
@@ -452,22 +450,19 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int    blocks   ( getNumBlocks() );
+   const size_t alignment( getBlockAlignment<ET1>( vectorizable, SO == columnMajor ) );
+   const BlockPartition partition( rowPartition( ~rhs, blocks, alignment ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<blocks; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( partition.begin( i ) );
+      const size_t m  ( partition.begin( i+1UL ) - row );
 
-      if( row >= (~lhs).rows() )
+      if( m == 0UL )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
          addAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
@@ -514,11 +509,10 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( omp_get_level() > 0, "Invalid call outside a parallel region" );
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
    typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
@@ -526,22 +520,19 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int    blocks   ( getNumBlocks() );
+   const size_t alignment( getBlockAlignment<ET1>( vectorizable, SO == rowMajor ) );
+   const BlockPartition partition( columnPartition( ~rhs, blocks, alignment ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<blocks; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( partition.begin( i ) );
+      const size_t n     ( partition.begin( i+1UL ) - column );
 
-      if( column >= (~lhs).columns() )
+      if( n == 0UL )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
          addAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
@@ -588,25 +579,28 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowM
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( omp_get_level() > 0, "Invalid call outside a parallel region" );
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
+   const int    blocks      ( getNumBlocks() );
+   const size_t alignment   ( getBlockAlignment<ET1>( false, SO == columnMajor ) );
+   const size_t addon       ( ( ( (~lhs).rows() % blocks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare  ( (~lhs).rows() / blocks + addon );
+   const size_t rest        ( equalShare % alignment );
+   const size_t rowsPerBlock( ( rest )?( equalShare - rest + alignment ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<blocks; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( i*rowsPerBlock );
 
       if( row >= (~lhs).rows() )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+      const size_t m( min( rowsPerBlock, (~lhs).rows() - row ) );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
       addAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
    }
@@ -639,25 +633,28 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,colu
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( omp_get_level() > 0, "Invalid call outside a parallel region" );
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const int    blocks      ( getNumBlocks() );
+   const size_t alignment   ( getBlockAlignment<ET1>( false, SO == rowMajor ) );
+   const size_t addon       ( ( ( (~lhs).columns() % blocks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare  ( (~lhs).columns() / blocks + addon );
+   const size_t rest        ( equalShare % alignment );
+   const size_t colsPerBlock( ( rest )?( equalShare - rest + alignment ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<blocks; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( i*colsPerBlock );
 
       if( column >= (~lhs).columns() )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t n( min( colsPerBlock, (~lhs).columns() - column ) );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
       addAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
    }
@@ -745,7 +742,7 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
          addAssign( ~lhs, ~rhs );
       }
       else {
-#pragma omp parallel shared( lhs, rhs )
+#pragma omp parallel shared( lhs, rhs ) num_threads( getAvailableThreads() )
          smpAddAssign_backend( ~lhs, ~rhs );
       }
    }
@@ -786,11 +783,10 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( omp_get_level() > 0, "Invalid call outside a parallel region" );
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
    typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
@@ -798,22 +794,19 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int    blocks   ( getNumBlocks() );
+   const size_t alignment( getBlockAlignment<ET1>( vectorizable, SO == columnMajor ) );
+   const BlockPartition partition( rowPartition( ~rhs, blocks, alignment ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<blocks; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( partition.begin( i ) );
+      const size_t m  ( partition.begin( i+1UL ) - row );
 
-      if( row >= (~lhs).rows() )
+      if( m == 0UL )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
          subAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
@@ -860,11 +853,10 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( omp_get_level() > 0, "Invalid call outside a parallel region" );
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename MT1::ElementType>         IT;
    typedef typename SubmatrixExprTrait<MT1,aligned>::Type    AlignedTarget;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
@@ -872,22 +864,19 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int    blocks   ( getNumBlocks() );
+   const size_t alignment( getBlockAlignment<ET1>( vectorizable, SO == rowMajor ) );
+   const BlockPartition partition( columnPartition( ~rhs, blocks, alignment ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<blocks; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( partition.begin( i ) );
+      const size_t n     ( partition.begin( i+1UL ) - column );
 
-      if( column >= (~lhs).columns() )
+      if( n == 0UL )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
          subAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
@@ -934,25 +923,28 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowM
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( omp_get_level() > 0, "Invalid call outside a parallel region" );
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t rowsPerThread( (~lhs).rows() / threads + addon );
+   const int    blocks      ( getNumBlocks() );
+   const size_t alignment   ( getBlockAlignment<ET1>( false, SO == columnMajor ) );
+   const size_t addon       ( ( ( (~lhs).rows() % blocks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare  ( (~lhs).rows() / blocks + addon );
+   const size_t rest        ( equalShare % alignment );
+   const size_t rowsPerBlock( ( rest )?( equalShare - rest + alignment ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<blocks; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( i*rowsPerBlock );
 
       if( row >= (~lhs).rows() )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
+      const size_t m( min( rowsPerBlock, (~lhs).rows() - row ) );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
       subAssign( target, submatrix<unaligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
    }
@@ -985,25 +977,28 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,colu
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( omp_get_level() > 0, "Invalid call outside a parallel region" );
 
    typedef typename MT1::ElementType                         ET1;
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t colsPerThread( (~lhs).columns() / threads + addon );
+   const int    blocks      ( getNumBlocks() );
+   const size_t alignment   ( getBlockAlignment<ET1>( false, SO == rowMajor ) );
+   const size_t addon       ( ( ( (~lhs).columns() % blocks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare  ( (~lhs).columns() / blocks + addon );
+   const size_t rest        ( equalShare % alignment );
+   const size_t colsPerBlock( ( rest )?( equalShare - rest + alignment ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<blocks; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( i*colsPerBlock );
 
       if( column >= (~lhs).columns() )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+      const size_t n( min( colsPerBlock, (~lhs).columns() - column ) );
       UnalignedTarget target( submatrix<unaligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
       subAssign( target, submatrix<unaligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
    }
@@ -1091,7 +1086,7 @@ inline typename EnableIf< And< IsDenseMatrix<MT1>
          subAssign( ~lhs, ~rhs );
       }
       else {
-#pragma omp parallel shared( lhs, rhs )
+#pragma omp parallel shared( lhs, rhs ) num_threads( getAvailableThreads() )
          smpSubAssign_backend( ~lhs, ~rhs );
       }
    }
@@ -46,7 +46,7 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/Functions.h>
-#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/smp/openmp/Functions.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/SparseSubvector.h>
@@ -97,11 +97,10 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& r
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( omp_get_level() > 0, "Invalid call outside a parallel region" );
 
    typedef typename VT1::ElementType                         ET1;
    typedef typename VT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename VT1::ElementType>         IT;
    typedef typename SubvectorExprTrait<VT1,aligned>::Type    AlignedTarget;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
@@ -109,21 +108,22 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& r
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int    blocks      ( getNumBlocks() );
+   const size_t alignment   ( getBlockAlignment<ET1>( vectorizable, true ) );
+   const size_t addon       ( ( ( (~lhs).size() % blocks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare  ( (~lhs).size() / blocks + addon );
+   const size_t rest        ( equalShare % alignment );
+   const size_t sizePerBlock( ( rest )?( equalShare - rest + alignment ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<blocks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerBlock );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerBlock, (~lhs).size() - index ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
@@ -171,25 +171,28 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>&
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( omp_get_level() > 0, "Invalid call outside a parallel region" );
 
    typedef typename VT1::ElementType                         ET1;
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const int    blocks      ( getNumBlocks() );
+   const size_t alignment   ( getBlockAlignment<ET1>( false, true ) );
+   const size_t addon       ( ( ( (~lhs).size() % blocks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare  ( (~lhs).size() / blocks + addon );
+   const size_t rest        ( equalShare % alignment );
+   const size_t sizePerBlock( ( rest )?( equalShare - rest + alignment ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<blocks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerBlock );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerBlock, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       assign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -275,7 +278,7 @@ inline typename EnableIf< And< IsDenseVector<VT1>
          assign( ~lhs, ~rhs );
       }
       else {
-#pragma omp parallel shared( lhs, rhs )
+#pragma omp parallel shared( lhs, rhs ) num_threads( getAvailableThreads() )
          smpAssign_backend( ~lhs, ~rhs );
       }
    }
@@ -316,11 +319,10 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( omp_get_level() > 0, "Invalid call outside a parallel region" );
 
    typedef typename VT1::ElementType                         ET1;
    typedef typename VT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename VT1::ElementType>         IT;
    typedef typename SubvectorExprTrait<VT1,aligned>::Type    AlignedTarget;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
@@ -328,21 +330,22 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int    blocks      ( getNumBlocks() );
+   const size_t alignment   ( getBlockAlignment<ET1>( vectorizable, true ) );
+   const size_t addon       ( ( ( (~lhs).size() % blocks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare  ( (~lhs).size() / blocks + addon );
+   const size_t rest        ( equalShare % alignment );
+   const size_t sizePerBlock( ( rest )?( equalShare - rest + alignment ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<blocks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerBlock );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerBlock, (~lhs).size() - index ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
@@ -390,25 +393,28 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( omp_get_level() > 0, "Invalid call outside a parallel region" );
 
    typedef typename VT1::ElementType                         ET1;
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const int    blocks      ( getNumBlocks() );
+   const size_t alignment   ( getBlockAlignment<ET1>( false, true ) );
+   const size_t addon       ( ( ( (~lhs).size() % blocks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare  ( (~lhs).size() / blocks + addon );
+   const size_t rest        ( equalShare % alignment );
+   const size_t sizePerBlock( ( rest )?( equalShare - rest + alignment ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<blocks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerBlock );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerBlock, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       addAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -494,7 +500,7 @@ inline typename EnableIf< And< IsDenseVector<VT1>
          addAssign( ~lhs, ~rhs );
       }
       else {
-#pragma omp parallel shared( lhs, rhs )
+#pragma omp parallel shared( lhs, rhs ) num_threads( getAvailableThreads() )
          smpAddAssign_backend( ~lhs, ~rhs );
       }
    }
@@ -535,11 +541,10 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( omp_get_level() > 0, "Invalid call outside a parallel region" );
 
    typedef typename VT1::ElementType                         ET1;
    typedef typename VT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename VT1::ElementType>         IT;
    typedef typename SubvectorExprTrait<VT1,aligned>::Type    AlignedTarget;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
@@ -547,21 +552,22 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int    blocks      ( getNumBlocks() );
+   const size_t alignment   ( getBlockAlignment<ET1>( vectorizable, true ) );
+   const size_t addon       ( ( ( (~lhs).size() % blocks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare  ( (~lhs).size() / blocks + addon );
+   const size_t rest        ( equalShare % alignment );
+   const size_t sizePerBlock( ( rest )?( equalShare - rest + alignment ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<blocks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerBlock );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerBlock, (~lhs).size() - index ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
@@ -609,25 +615,28 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( omp_get_level() > 0, "Invalid call outside a parallel region" );
 
    typedef typename VT1::ElementType                         ET1;
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const int    blocks      ( getNumBlocks() );
+   const size_t alignment   ( getBlockAlignment<ET1>( false, true ) );
+   const size_t addon       ( ( ( (~lhs).size() % blocks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare  ( (~lhs).size() / blocks + addon );
+   const size_t rest        ( equalShare % alignment );
+   const size_t sizePerBlock( ( rest )?( equalShare - rest + alignment ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<blocks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerBlock );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerBlock, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       subAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -713,7 +722,7 @@ inline typename EnableIf< And< IsDenseVector<VT1>
          subAssign( ~lhs, ~rhs );
       }
       else {
-#pragma omp parallel shared( lhs, rhs )
+#pragma omp parallel shared( lhs, rhs ) num_threads( getAvailableThreads() )
          smpSubAssign_backend( ~lhs, ~rhs );
       }
    }
@@ -755,11 +764,10 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( omp_get_level() > 0, "Invalid call outside a parallel region" );
 
    typedef typename VT1::ElementType                         ET1;
    typedef typename VT2::ElementType                         ET2;
-   typedef IntrinsicTrait<typename VT1::ElementType>         IT;
    typedef typename SubvectorExprTrait<VT1,aligned>::Type    AlignedTarget;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
@@ -767,21 +775,22 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).size() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t sizePerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const int    blocks      ( getNumBlocks() );
+   const size_t alignment   ( getBlockAlignment<ET1>( vectorizable, true ) );
+   const size_t addon       ( ( ( (~lhs).size() % blocks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare  ( (~lhs).size() / blocks + addon );
+   const size_t rest        ( equalShare % alignment );
+   const size_t sizePerBlock( ( rest )?( equalShare - rest + alignment ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<blocks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerBlock );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerBlock, (~lhs).size() - index ) );
 
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( subvector<aligned>( ~lhs, index, size ) );
@@ -830,25 +839,28 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF
 {
    BLAZE_FUNCTION_TRACE;
 
-   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+   BLAZE_INTERNAL_ASSERT( omp_get_level() > 0, "Invalid call outside a parallel region" );
 
    typedef typename VT1::ElementType                         ET1;
    typedef typename VT2::ElementType                         ET2;
    typedef typename SubvectorExprTrait<VT1,unaligned>::Type  UnalignedTarget;
 
-   const int    threads      ( omp_get_num_threads() );
-   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t sizePerThread( (~lhs).size() / threads + addon );
+   const int    blocks      ( getNumBlocks() );
+   const size_t alignment   ( getBlockAlignment<ET1>( false, true ) );
+   const size_t addon       ( ( ( (~lhs).size() % blocks ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare  ( (~lhs).size() / blocks + addon );
+   const size_t rest        ( equalShare % alignment );
+   const size_t sizePerBlock( ( rest )?( equalShare - rest + alignment ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
-   for( int i=0UL; i<threads; ++i )
+#pragma omp for schedule(BLAZE_OPENMP_SCHEDULE) nowait
+   for( int i=0UL; i<blocks; ++i )
    {
-      const size_t index( i*sizePerThread );
+      const size_t index( i*sizePerBlock );
 
       if( index >= (~lhs).size() )
          continue;
 
-      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+      const size_t size( min( sizePerBlock, (~lhs).size() - index ) );
       UnalignedTarget target( subvector<unaligned>( ~lhs, index, size ) );
       multAssign( target, subvector<unaligned>( ~rhs, index, size ) );
    }
@@ -934,7 +946,7 @@ inline typename EnableIf< And< IsDenseVector<VT1>
          multAssign( ~lhs, ~rhs );
       }
       else {
-#pragma omp parallel shared( lhs, rhs )
+#pragma omp parallel shared( lhs, rhs ) num_threads( getAvailableThreads() )
          smpMultAssign_backend( ~lhs, ~rhs );
       }
    }
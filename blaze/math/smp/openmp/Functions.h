@@ -42,6 +42,8 @@
 
 #include <stdexcept>
 #include <omp.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/smp/ThreadLimit.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/StaticAssert.h>
@@ -75,6 +77,105 @@ BLAZE_ALWAYS_INLINE size_t getNumThreads()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of threads available for an OpenMP parallel operation of the calling
+//        thread.
+// \ingroup smp
+//
+// \return The number of threads available for an OpenMP parallel operation.
+//
+// This function returns the number of threads used by an OpenMP parallel operation started by
+// the calling thread. In case the calling thread is part of an active enclosing parallel region
+// (as for instance an OpenMP loop over independent subproblems), the operation is executed
+// serially if nested parallelism is disabled (see \c omp_set_max_active_levels()). Otherwise
+// the operation only uses its share of the available processors, i.e. the number of processors
+// divided by the number of threads of all enclosing teams. Additionally, the result respects
+// the thread limit of the calling thread (see the \a BLAZE_THREAD_LIMIT macro).
+*/
+BLAZE_ALWAYS_INLINE size_t getAvailableThreads()
+{
+   size_t threads( omp_get_max_threads() );
+
+   if( omp_in_parallel() )
+   {
+      if( omp_get_active_level() >= omp_get_max_active_levels() ) {
+         threads = 1UL;
+      }
+      else {
+         size_t busy( 1UL );
+         for( int level=1; level<=omp_get_level(); ++level ) {
+            busy *= omp_get_team_size( level );
+         }
+
+         const size_t share( omp_get_num_procs() / busy );
+         threads = ( share > 1UL )?( ( share < threads )?( share ):( threads ) ):( 1UL );
+      }
+   }
+
+   const size_t limit( getThreadLimit() );
+   return ( limit < threads )?( limit ):( threads );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of blocks of an OpenMP parallel assignment.
+// \ingroup smp
+//
+// \return The number of blocks of the parallel assignment.
+//
+// This function returns the number of blocks into which the target of an OpenMP parallel
+// assignment is split, i.e. the number of threads of the current team multiplied by the
+// number of blocks per thread (see the \c BLAZE_OPENMP_BLOCKS_PER_THREAD configuration). The
+// function must only be called within an OpenMP parallel region.
+*/
+BLAZE_ALWAYS_INLINE int getNumBlocks()
+{
+   return omp_get_num_threads() * BLAZE_OPENMP_BLOCKS_PER_THREAD;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the alignment of the blocks of an OpenMP parallel assignment.
+// \ingroup smp
+//
+// \param vectorizable \a true in case the assignment is vectorized, \a false if not.
+// \param contiguous \a true in case the partitioned dimension is contiguous in memory.
+// \return The alignment of the block boundaries (in number of elements).
+//
+// This function returns the number of elements to which the boundaries of the blocks of an
+// OpenMP parallel assignment are aligned. In case of a vectorized assignment the alignment is
+// a multiple of the number of elements per intrinsic operation, which enables the use of aligned
+// vectorized kernels for all blocks. In case the blocks split the contiguous dimension of the
+// target (i.e. the elements of a vector, the rows of a column-major or the columns of a
+// row-major matrix), the alignment is additionally a multiple of the number of elements of a
+// cache line, which prevents false sharing between neighboring blocks. Blocks of rows of a
+// row-major matrix (or columns of a column-major matrix) consist of complete rows (columns) and
+// therefore only require the alignment to the number of elements per intrinsic operation.
+*/
+template< typename T >  // Element type of the assignment target
+BLAZE_ALWAYS_INLINE size_t getBlockAlignment( bool vectorizable, bool contiguous )
+{
+   const size_t cacheLineSize( 64UL );
+   const size_t simd( ( vectorizable )?( size_t( IntrinsicTrait<T>::size ) ):( 1UL ) );
+
+   if( !contiguous )
+      return simd;
+
+   const size_t line( ( sizeof(T) < cacheLineSize )?( cacheLineSize / sizeof(T) ):( 1UL ) );
+
+   return ( simd > line )?( simd ):( line );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Sets the number of threads to be used for OpenMP parallel operations.
@@ -88,7 +189,7 @@ BLAZE_ALWAYS_INLINE size_t getNumThreads()
 // Note that the given \a number must be in the range \f$[1..infty)\f$. In case an invalid
 // number of threads is specified, a \a std::invalid_argument exception is thrown.
 */
-BLAZE_ALWAYS_INLINE size_t setNumThreads( size_t number )
+BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 {
    if( number == 0UL )
       throw std::invalid_argument( "Invalid number of threads" );
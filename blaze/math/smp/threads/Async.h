@@ -0,0 +1,316 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/Async.h
+//  \brief Header file for the C++11/Boost thread-based asynchronous assignment
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_ASYNC_H_
+#define _BLAZE_MATH_SMP_THREADS_ASYNC_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <boost/shared_ptr.hpp>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/smp/DenseMatrix.h>
+#include <blaze/math/smp/DenseVector.h>
+#include <blaze/math/smp/SparseMatrix.h>
+#include <blaze/math/smp/SparseVector.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/StaticAssert.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Handle for an asynchronous assignment.
+// \ingroup smp
+//
+// The Future class represents a handle for an assignment that has been started via one of the
+// asyncAssign() functions. It allows to query whether the assignment has been completed and to
+// wait for its completion:
+
+   \code
+   blaze::Future future( blaze::asyncAssign( y1, A1 * x1 ) );
+
+   y2 = A2 * x2;   // Executed concurrently to the first multiplication
+   future.wait();  // Waiting for the completion of the first multiplication
+   \endcode
+
+// All copies of a Future refer to the same assignment. The destruction of the last copy blocks
+// until the assignment has been completed, i.e. the target and the operands of the assignment
+// must not be destroyed before all handles have been destroyed.
+*/
+class Future
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef TheThreadBackend::Context  Context;  //!< Type of the execution context.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline Future();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Copy assignment operator********************************************************************
+   // No explicitly declared copy assignment operator.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool isReady() const;
+   inline void wait   () const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   boost::shared_ptr<Context> context_;  //!< The execution context of the assignment.
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   template< typename VT1, bool TF, typename VT2 >
+   friend Future asyncAssign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs );
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   friend Future asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor of Future.
+//
+// The default constructor creates a handle that is not associated with any assignment and is
+// therefore always ready.
+*/
+inline Future::Future()
+   : context_()  // The execution context of the assignment
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the assignment has been completed.
+//
+// \return \a true in case the assignment has been completed, \a false if not.
+*/
+inline bool Future::isReady() const
+{
+   return !context_ || context_->isIdle();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for the completion of the assignment.
+//
+// \return void
+*/
+inline void Future::wait() const
+{
+   if( context_ )
+      context_->wait();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Asynchronous assignment functions */
+//@{
+template< typename VT1, bool TF, typename VT2 >
+inline Future asyncAssign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline Future asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a vector to a vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector (expression) to be assigned.
+// \return The handle for the assignment.
+// \exception std::invalid_argument Vector sizes do not match.
+// \exception std::invalid_argument Aliased target vector detected.
+//
+// This function starts the assignment of the given vector (expression) to the given target
+// vector and returns immediately. The assignment is executed by the process-wide worker threads
+// by means of the usual SMP assignment, i.e. large operations are again split among several
+// worker threads. The returned handle can be used to wait for the completion of the assignment
+// (see the Future class). In contrast to a regular assignment the target vector is not resized,
+// i.e. in case the sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown. Since the assignment is executed without intermediate temporary, the target vector
+// must not be used as an operand of the right-hand side expression. In case the target vector
+// is aliased by the expression, a \a std::invalid_argument exception is thrown.
+//
+// Note that the target vector and all operands of the expression must neither be destroyed nor
+// modified before the assignment has been completed. Also note that an asynchronous assignment
+// that would occupy the last idle worker thread is executed serially by this thread, since at
+// least one worker thread is required to execute the partial assignments of a parallel one.
+*/
+template< typename VT1    // Type of the left-hand side vector
+        , bool TF         // Transpose flag of both vectors
+        , typename VT2 >  // Type of the right-hand side vector
+inline Future asyncAssign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs )
+{
+   if( (~lhs).size() != (~rhs).size() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   if( (~rhs).isAliased( &~lhs ) )
+      throw std::invalid_argument( "Aliased target vector detected" );
+
+   Future future;
+   future.context_.reset( new Future::Context() );
+   TheThreadBackend::scheduleAsyncAssign( *future.context_, ~lhs, ~rhs );
+
+   return future;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a matrix to a matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix (expression) to be assigned.
+// \return The handle for the assignment.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Aliased target matrix detected.
+//
+// This function starts the assignment of the given matrix (expression) to the given target
+// matrix and returns immediately. The assignment is executed by the process-wide worker threads
+// by means of the usual SMP assignment. The returned handle can be used to wait for the
+// completion of the assignment (see the Future class). In contrast to a regular assignment the
+// target matrix is not resized, i.e. in case the sizes of the two matrices don't match, a
+// \a std::invalid_argument exception is thrown. In case the target matrix is aliased by the
+// expression, a \a std::invalid_argument exception is thrown.
+//
+// Note that the target matrix and all operands of the expression must neither be destroyed nor
+// modified before the assignment has been completed.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline Future asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   if( (~lhs).rows() != (~rhs).rows() || (~lhs).columns() != (~rhs).columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( (~rhs).isAliased( &~lhs ) )
+      throw std::invalid_argument( "Aliased target matrix detected" );
+
+   Future future;
+   future.context_.reset( new Future::Context() );
+   TheThreadBackend::scheduleAsyncAssign( *future.context_, ~lhs, ~rhs );
+
+   return future;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -46,6 +46,7 @@
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/smp/BlockPartition.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
@@ -110,21 +111,20 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMajor
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const TheThreadBackend::Team team;
+
+   const size_t threads  ( team.size() );
+   const size_t alignment( ( vectorizable )?( size_t( IT::size ) ):( 1UL ) );
+   const BlockPartition partition( rowPartition( ~rhs, threads, alignment ) );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( partition.begin( i ) );
+      const size_t m  ( partition.begin( i+1UL ) - row );
 
-      if( row >= (~lhs).rows() )
+      if( m == 0UL )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
          TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
@@ -185,21 +185,20 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,columnMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const TheThreadBackend::Team team;
+
+   const size_t threads  ( team.size() );
+   const size_t alignment( ( vectorizable )?( size_t( IT::size ) ):( 1UL ) );
+   const BlockPartition partition( columnPartition( ~rhs, threads, alignment ) );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( partition.begin( i ) );
+      const size_t n     ( partition.begin( i+1UL ) - column );
 
-      if( column >= (~lhs).columns() )
+      if( n == 0UL )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
          TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
@@ -254,7 +253,9 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowMajo
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
+   const TheThreadBackend::Team team;
+
+   const size_t threads      ( team.size() );
    const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
    const size_t rowsPerThread( (~lhs).rows() / threads + addon );
 
@@ -306,7 +307,9 @@ void smpAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,columnM
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
+   const TheThreadBackend::Team team;
+
+   const size_t threads      ( team.size() );
    const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
    const size_t colsPerThread( (~lhs).columns() / threads + addon );
 
@@ -459,21 +462,20 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const TheThreadBackend::Team team;
+
+   const size_t threads  ( team.size() );
+   const size_t alignment( ( vectorizable )?( size_t( IT::size ) ):( 1UL ) );
+   const BlockPartition partition( rowPartition( ~rhs, threads, alignment ) );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( partition.begin( i ) );
+      const size_t m  ( partition.begin( i+1UL ) - row );
 
-      if( row >= (~lhs).rows() )
+      if( m == 0UL )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
          TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
@@ -534,21 +536,20 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const TheThreadBackend::Team team;
+
+   const size_t threads  ( team.size() );
+   const size_t alignment( ( vectorizable )?( size_t( IT::size ) ):( 1UL ) );
+   const BlockPartition partition( columnPartition( ~rhs, threads, alignment ) );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( partition.begin( i ) );
+      const size_t n     ( partition.begin( i+1UL ) - column );
 
-      if( column >= (~lhs).columns() )
+      if( n == 0UL )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
          TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
@@ -603,7 +604,9 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowM
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
+   const TheThreadBackend::Team team;
+
+   const size_t threads      ( team.size() );
    const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
    const size_t rowsPerThread( (~lhs).rows() / threads + addon );
 
@@ -655,7 +658,9 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,colu
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
+   const TheThreadBackend::Team team;
+
+   const size_t threads      ( team.size() );
    const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
    const size_t colsPerThread( (~lhs).columns() / threads + addon );
 
@@ -809,21 +814,20 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,rowMa
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).rows() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t rowsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const TheThreadBackend::Team team;
+
+   const size_t threads  ( team.size() );
+   const size_t alignment( ( vectorizable )?( size_t( IT::size ) ):( 1UL ) );
+   const BlockPartition partition( rowPartition( ~rhs, threads, alignment ) );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t row( i*rowsPerThread );
+      const size_t row( partition.begin( i ) );
+      const size_t m  ( partition.begin( i+1UL ) - row );
 
-      if( row >= (~lhs).rows() )
+      if( m == 0UL )
          continue;
 
-      const size_t m( min( rowsPerThread, (~lhs).rows() - row ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, row, 0UL, m, (~lhs).columns() ) );
          TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, row, 0UL, m, (~lhs).columns() ) );
@@ -884,21 +888,20 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,colum
    const bool lhsAligned  ( (~lhs).isAligned() );
    const bool rhsAligned  ( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
-   const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
-   const size_t equalShare   ( (~lhs).columns() / threads + addon );
-   const size_t rest         ( equalShare & ( IT::size - 1UL ) );
-   const size_t colsPerThread( ( vectorizable && rest )?( equalShare - rest + IT::size ):( equalShare ) );
+   const TheThreadBackend::Team team;
+
+   const size_t threads  ( team.size() );
+   const size_t alignment( ( vectorizable )?( size_t( IT::size ) ):( 1UL ) );
+   const BlockPartition partition( columnPartition( ~rhs, threads, alignment ) );
 
    for( size_t i=0UL; i<threads; ++i )
    {
-      const size_t column( i*colsPerThread );
+      const size_t column( partition.begin( i ) );
+      const size_t n     ( partition.begin( i+1UL ) - column );
 
-      if( column >= (~lhs).columns() )
+      if( n == 0UL )
          continue;
 
-      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-
       if( vectorizable && lhsAligned && rhsAligned ) {
          AlignedTarget target( submatrix<aligned>( ~lhs, 0UL, column, (~lhs).rows(), n ) );
          TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, 0UL, column, (~lhs).rows(), n ) );
@@ -953,7 +956,9 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,rowM
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
+   const TheThreadBackend::Team team;
+
+   const size_t threads      ( team.size() );
    const size_t addon        ( ( ( (~lhs).rows() % threads ) != 0UL )? 1UL : 0UL );
    const size_t rowsPerThread( (~lhs).rows() / threads + addon );
 
@@ -1005,7 +1010,9 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,colu
    typedef typename MT2::ElementType                         ET2;
    typedef typename SubmatrixExprTrait<MT1,unaligned>::Type  UnalignedTarget;
 
-   const size_t threads      ( TheThreadBackend::size() );
+   const TheThreadBackend::Team team;
+
+   const size_t threads      ( team.size() );
    const size_t addon        ( ( ( (~lhs).columns() % threads ) != 0UL )? 1UL : 0UL );
    const size_t colsPerThread( (~lhs).columns() / threads + addon );
 
@@ -0,0 +1,209 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/ExecutionContext.h
+//  \brief Header file for the execution contexts of the thread-based parallelization
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_EXECUTIONCONTEXT_H_
+#define _BLAZE_MATH_SMP_THREADS_EXECUTIONCONTEXT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/StaticAssert.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Execution context of the thread-based parallelization.
+// \ingroup smp
+//
+// An execution context represents a set of worker threads and keeps track of the tasks that are
+// scheduled by the thread-based parallelization on behalf of a caller. A context either owns
+// its own worker threads or borrows the process-wide worker threads of the Blaze library:
+
+   \code
+   blaze::ExecutionContext shared;            // Borrows the process-wide worker threads
+   blaze::ExecutionContext dedicated( 4UL );  // Owns four worker threads
+   \endcode
+
+// Independent of the ownership of the workers, waiting for the completion of an operation only
+// waits for the tasks of the context itself. Therefore several application threads can execute
+// parallel operations concurrently, as long as every thread uses its own context. A context is
+// activated for the calling thread by means of an ExecutionScope.
+*/
+typedef TheThreadBackend::Context  ExecutionContext;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scope for the activation of an execution context for the calling thread.
+// \ingroup smp
+//
+// The ExecutionScope class activates the given execution context for the calling thread for the
+// lifetime of the scope object. All parallel operations executed by the calling thread within
+// the scope are scheduled via the given context. On destruction of the scope the previously
+// active context of the thread is restored, i.e. scopes can be nested. The following example
+// demonstrates how several application threads can evaluate parallel operations concurrently,
+// each thread using a separate context:
+
+   \code
+   void handleRequest( const blaze::DynamicMatrix<double>& A, const blaze::DynamicMatrix<double>& B,
+                       blaze::DynamicMatrix<double>& C )
+   {
+      // Each request thread uses its own context, which borrows the process-wide workers
+      blaze::ExecutionContext context;
+      blaze::ExecutionScope scope( context );
+
+      C = A * B;  // Scheduled via the context of this thread
+   }
+   \endcode
+
+// Note that the ExecutionScope cannot be created inside a parallel section. In this case a
+// \a std::runtime_error exception is thrown. Also note that the scope only affects the calling
+// thread and that the context must not be destroyed before the scope.
+*/
+class ExecutionScope : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline ExecutionScope( ExecutionContext& context );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~ExecutionScope();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   ExecutionContext* previous_;  //!< The previously active context of the calling thread.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ExecutionScope class.
+//
+// \param context The execution context to be activated for the calling thread.
+// \exception std::runtime_error Execution scope inside a parallel section detected.
+*/
+inline ExecutionScope::ExecutionScope( ExecutionContext& context )
+   : previous_( 0 )  // The previously active context of the calling thread
+{
+   if( isParallelSectionActive() )
+      throw std::runtime_error( "Execution scope inside a parallel section detected" );
+
+   previous_ = TheThreadBackend::activate( &context );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor of the ExecutionScope class.
+//
+// The destructor restores the previously active execution context of the calling thread.
+*/
+inline ExecutionScope::~ExecutionScope()
+{
+   TheThreadBackend::activate( previous_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -64,6 +64,8 @@ namespace blaze {
 // \return The number of threads used for thread parallel operations.
 //
 // Via this function the number of threads used for thread parallel operations can be queried.
+// The function returns the number of worker threads of the execution context that is active
+// for the calling thread (see the ExecutionScope class).
 */
 BLAZE_ALWAYS_INLINE size_t getNumThreads()
 {
@@ -73,6 +75,29 @@ BLAZE_ALWAYS_INLINE size_t getNumThreads()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of threads available for a thread parallel operation of the calling
+//        thread.
+// \ingroup smp
+//
+// \return The number of threads available for a thread parallel operation.
+//
+// This function returns the number of threads used by a thread parallel operation started by
+// the calling thread. In case several threads concurrently execute parallel operations via the
+// process-wide worker threads (for instance several application threads or an OpenMP loop over
+// independent subproblems), every operation only uses its share of the worker threads.
+// Additionally, the result respects the thread limit of the calling thread (see the
+// \a BLAZE_THREAD_LIMIT macro).
+*/
+BLAZE_ALWAYS_INLINE size_t getAvailableThreads()
+{
+   return TheThreadBackend::available();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Sets the number of threads to be used for thread parallel operations.
@@ -84,9 +109,11 @@ BLAZE_ALWAYS_INLINE size_t getNumThreads()
 //
 // Via this function the maximum number of threads for thread parallel operations can be specified.
 // Note that the given \a number must be in the range \f$[1..\infty)\f$. In case an invalid
-// number of threads is specified, a \a std::invalid_argument exception is thrown.
+// number of threads is specified, a \a std::invalid_argument exception is thrown. Note that
+// the function resizes the worker threads of the execution context that is active for the
+// calling thread (see the ExecutionScope class).
 */
-BLAZE_ALWAYS_INLINE size_t setNumThreads( size_t number )
+BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 {
    if( number == 0UL )
       throw std::invalid_argument( "Invalid number of threads" );
@@ -0,0 +1,709 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/SpinningPool.h
+//  \brief Header file for the low-latency pool of spinning worker threads
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_SPINNINGPOOL_H_
+#define _BLAZE_MATH_SMP_THREADS_SPINNINGPOOL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/SMP.h>
+#include <blaze/system/Vectorization.h>
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+#  include <atomic>
+#elif BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <boost/atomic.hpp>
+#endif
+
+#if BLAZE_SSE2_MODE
+#  include <emmintrin.h>
+#endif
+
+#include <new>
+#include <stdexcept>
+#include <vector>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Low-latency pool of spinning worker threads.
+// \ingroup smp
+//
+// The SpinningPool class template represents a pool of persistent worker threads for the
+// low-latency mode of the C++11 and Boost thread-based parallelization (see the configuration
+// switch BLAZE_USE_SPINNING_WORKERS). In contrast to the ThreadPool class template, which
+// manages a mutex-protected queue of heap-allocated tasks and wakes its workers via a condition
+// variable, every worker of a spinning pool owns a single cache-line padded dispatch slot. A
+// task is scheduled by claiming a free slot via an atomic compare-and-swap, by copying the task
+// into the storage of the slot and by publishing it via an atomic store. The worker of the slot
+// actively waits for new tasks, i.e. a task is usually picked up within a few hundred cycles.
+// Tasks that fit into the storage of a slot are scheduled without any dynamic memory allocation.
+//
+// In order not to waste CPU time during longer idle periods, a worker falls asleep on a condition
+// variable after spinning for a certain number of iterations without receiving a new task. In
+// case all slots are occupied at the time a task is scheduled, the task is executed directly by
+// the scheduling thread.
+//
+// The pool may be resized while other threads schedule tasks. For that purpose the slots and
+// the worker threads are combined into a generation, which is replaced as a whole by resize().
+// Every scheduling thread registers itself for the current epoch before accessing the current
+// generation. A replaced generation is only destroyed after all scheduling threads registered
+// for the previous epoch have left the schedule() function.\n
+// This class must \b NOT be used explicitly! It is reserved for internal use only. Using
+// this class explicitly might result in erroneous results and/or in undefined behavior.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+class SpinningPool : private NonCopyable
+{
+ public:
+   //**Type definitions****************************************************************************
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+   typedef std::atomic<size_t>    Counter;    //!< Type of the atomic counters and flags.
+#else
+   typedef boost::atomic<size_t>  Counter;    //!< Type of the atomic counters and flags.
+#endif
+   //**********************************************************************************************
+
+ private:
+   //**Forward declarations************************************************************************
+   struct Generation;
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+   typedef std::atomic<Generation*>    Pointer;  //!< Type of the atomic generation pointer.
+#else
+   typedef boost::atomic<Generation*>  Pointer;  //!< Type of the atomic generation pointer.
+#endif
+   //**********************************************************************************************
+
+ public:
+
+   //**Compilation flags***************************************************************************
+   //! Number of spinning iterations before an idle thread falls asleep.
+   enum { spinLimit = 20000 };
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef MT  Mutex;      //!< Type of the mutex.
+   typedef LT  Lock;       //!< Type of a locking object.
+   typedef CT  Condition;  //!< Condition variable type.
+   //**********************************************************************************************
+
+   //**Enumerations********************************************************************************
+   //! States of a dispatch slot.
+   enum State {
+      idle    = 0,  //!< The slot is available for a new task.
+      claimed = 1,  //!< The slot has been claimed by a scheduling thread.
+      ready   = 2,  //!< The slot contains a task ready for execution.
+      stopped = 3   //!< The worker of the slot has to terminate.
+   };
+
+   //! Size of the task storage of a dispatch slot (in bytes).
+   enum { storageSize = 512 };
+
+   //! Size of a cache line (in bytes).
+   enum { cacheLineSize = 64 };
+   //**********************************************************************************************
+
+   //**Private union Storage***********************************************************************
+   /*!\brief Suitably aligned raw storage for a task.
+   */
+   union Storage
+   {
+      char        bytes[storageSize];  //!< The raw bytes of the storage.
+      long double ld;                  //!< Alignment of long double.
+      double      d;                   //!< Alignment of double.
+      void*       ptr;                 //!< Alignment of pointers.
+   };
+   //**********************************************************************************************
+
+   //**Private struct Slot*************************************************************************
+   /*!\brief Cache-line padded dispatch slot of a single worker thread.
+   */
+   struct Slot : private NonCopyable
+   {
+      //**Constructor******************************************************************************
+      inline Slot() : state_( idle ), sleeping_( 0UL ), invoke_( 0 ), mutex_(), wakeup_() {}
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      char      front_[cacheLineSize];     //!< Padding against false sharing.
+      Counter   state_;                    //!< The state of the slot.
+      Counter   sleeping_;                 //!< Sleeping flag of the worker thread.
+      void    (*invoke_)( Storage& );      //!< Execution function of the stored task.
+      Storage   storage_;                  //!< Storage of the scheduled task.
+      Mutex     mutex_;                    //!< Synchronization mutex for the sleeping worker.
+      Condition wakeup_;                   //!< Wake-up condition of the sleeping worker.
+      char      back_[cacheLineSize];      //!< Padding against false sharing.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private struct Generation*******************************************************************
+   /*!\brief The dispatch slots and the worker threads of a single configuration of the pool.
+   */
+   struct Generation : private NonCopyable
+   {
+      //**Constructor******************************************************************************
+      explicit inline Generation( size_t n ) : slots_( new Slot[n] ), threads_() {}
+      //*******************************************************************************************
+
+      //**Destructor*******************************************************************************
+      inline ~Generation() { delete[] slots_; }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Slot*            slots_;    //!< The dispatch slots of the worker threads.
+      std::vector<TT*> threads_;  //!< The worker threads.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private struct Dispatch*********************************************************************
+   /*!\brief Storage and execution of a task within the storage of a dispatch slot.
+   */
+   template< typename Callable                      // Type of the task
+           , bool Fits = ( sizeof(Callable) <= sizeof(Storage) &&
+                           static_cast<size_t>( AlignmentOf<Callable>::value ) <=
+                           static_cast<size_t>( AlignmentOf<Storage>::value ) ) >
+   struct Dispatch
+   {
+      static inline void store( Storage& storage, const Callable& func ) {
+         ::new( storage.bytes ) Callable( func );
+      }
+
+      static void invoke( Storage& storage ) {
+         Callable* func( reinterpret_cast<Callable*>( storage.bytes ) );
+         (*func)();
+         func->~Callable();
+      }
+   };
+   //**********************************************************************************************
+
+   //**Private struct Dispatch*********************************************************************
+   /*!\brief Storage and execution of a task exceeding the storage of a dispatch slot.
+   */
+   template< typename Callable >  // Type of the task
+   struct Dispatch<Callable,false>
+   {
+      static inline void store( Storage& storage, const Callable& func ) {
+         storage.ptr = new Callable( func );
+      }
+
+      static void invoke( Storage& storage ) {
+         Callable* func( static_cast<Callable*>( storage.ptr ) );
+         (*func)();
+         delete func;
+      }
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit SpinningPool( size_t n, void (*init)() = 0 );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~SpinningPool();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const;
+          void   resize( size_t n, bool block=false );
+
+   template< typename Callable >
+   void schedule( const Callable& func );
+
+   static inline void relax();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Thread execution functions******************************************************************
+   /*!\name Thread execution functions */
+   //@{
+   Generation* start( size_t n );
+   void        stop ( Generation* generation );
+   void        work ( Slot* slot );
+   //@}
+   //**********************************************************************************************
+
+   //**Epoch functions*****************************************************************************
+   /*!\name Epoch functions */
+   //@{
+   inline size_t enter() const;
+   inline void   leave( size_t epoch ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Pointer         current_;    //!< The current generation of slots and worker threads.
+   mutable Counter epoch_;      //!< The current epoch of the pool.
+   mutable Counter active_[2];  //!< The number of scheduling threads per epoch parity.
+   Counter         next_;       //!< The first slot to be tried by the next scheduled task.
+   Mutex           mutex_;      //!< Synchronization mutex for the resizing of the pool.
+   void (*init_)();             //!< Initialization function of the worker threads.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SpinningPool class.
+//
+// \param n Initial number of worker threads \f$[1..\infty)\f$.
+// \param init The initialization function of the worker threads (optional).
+// \exception std::invalid_argument Invalid number of threads.
+//
+// The optional initialization function is executed once by every worker thread (including
+// workers added via resize()) before it executes its first task. It is never executed by a
+// thread that executes a task because all slots are occupied.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+SpinningPool<TT,MT,LT,CT>::SpinningPool( size_t n, void (*init)() )
+   : current_( 0 )     // The current generation of slots and worker threads
+   , epoch_  ( 0UL )   // The current epoch of the pool
+   , next_   ( 0UL )   // The first slot to be tried by the next scheduled task
+   , mutex_  ()        // Synchronization mutex for the resizing of the pool
+   , init_   ( init )  // Initialization function of the worker threads
+{
+   if( n == 0UL )
+      throw std::invalid_argument( "Invalid number of threads" );
+
+   active_[0].store( 0UL );
+   active_[1].store( 0UL );
+
+   current_.store( start( n ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the SpinningPool class.
+//
+// The destructor waits for all scheduled tasks to be completed and joins all worker threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+SpinningPool<TT,MT,LT,CT>::~SpinningPool()
+{
+   Generation* generation( current_.load() );
+   stop( generation );
+   delete generation;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of worker threads of the pool.
+//
+// \return The number of worker threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t SpinningPool<TT,MT,LT,CT>::size() const
+{
+   const size_t epoch( enter() );
+   const size_t n( current_.load()->threads_.size() );
+   leave( epoch );
+
+   return n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changes the number of worker threads of the pool.
+//
+// \param n The new number of threads \f$[1..\infty)\f$.
+// \param block Ignored; the function always blocks until the previous workers have terminated.
+// \return void
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This function starts \a n new worker threads, which receive all subsequently scheduled tasks,
+// waits for all tasks scheduled to the previous worker threads to be completed and terminates
+// the previous worker threads. The function may be called while other threads schedule tasks
+// via the same pool.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void SpinningPool<TT,MT,LT,CT>::resize( size_t n, bool block )
+{
+   UNUSED_PARAMETER( block );
+
+#if !(defined _MSC_VER)
+   if( n == 0UL )
+      throw std::invalid_argument( "Invalid number of threads" );
+#endif
+
+   Lock lock( mutex_ );
+
+   Generation* previous( current_.load() );
+
+   if( n == previous->threads_.size() )
+      return;
+
+   current_.store( start( n ) );
+
+   const size_t epoch( epoch_.fetch_add( 1UL ) );
+
+   stop( previous );
+
+   while( active_[epoch%2UL].load() != 0UL ) {
+      relax();
+   }
+
+   delete previous;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given zero argument function/functor for execution.
+//
+// \param func The given function/functor.
+// \return void
+//
+// This function hands the given task to an idle worker thread. In case all worker threads are
+// busy, the task is executed directly by the calling thread.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the function/functor
+void SpinningPool<TT,MT,LT,CT>::schedule( const Callable& func )
+{
+   const size_t epoch( enter() );
+
+   Generation& generation( *current_.load() );
+
+   const size_t n    ( generation.threads_.size() );
+   const size_t first( next_.fetch_add( 1UL ) );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      Slot& slot( generation.slots_[(first+i)%n] );
+      size_t expected( idle );
+
+      if( slot.state_.load() != idle || !slot.state_.compare_exchange_strong( expected, claimed ) )
+         continue;
+
+      Dispatch<Callable>::store( slot.storage_, func );
+      slot.invoke_ = &Dispatch<Callable>::invoke;
+      slot.state_.store( ready );
+
+      if( slot.sleeping_.load() != 0UL ) {
+         Lock lock( slot.mutex_ );
+         slot.wakeup_.notify_one();
+      }
+
+      leave( epoch );
+      return;
+   }
+
+   leave( epoch );
+
+   Callable task( func );
+   task();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Hint to the processor that the calling thread is in a spin-wait loop.
+//
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void SpinningPool<TT,MT,LT,CT>::relax()
+{
+#if BLAZE_SSE2_MODE
+   _mm_pause();
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EPOCH FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Registers the calling thread for the current epoch.
+//
+// \return The epoch the calling thread has been registered for.
+//
+// After this function returns, the current generation of slots and worker threads is not
+// destroyed before the calling thread has left the epoch via the leave() function.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t SpinningPool<TT,MT,LT,CT>::enter() const
+{
+   while( true )
+   {
+      const size_t epoch( epoch_.load() );
+      active_[epoch%2UL].fetch_add( 1UL );
+
+      if( epoch_.load() == epoch )
+         return epoch;
+
+      active_[epoch%2UL].fetch_sub( 1UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unregisters the calling thread from the given epoch.
+//
+// \param epoch The epoch returned by the enter() function.
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void SpinningPool<TT,MT,LT,CT>::leave( size_t epoch ) const
+{
+   active_[epoch%2UL].fetch_sub( 1UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD EXECUTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Starts the given number of worker threads.
+//
+// \param n The number of worker threads.
+// \return The new generation of slots and worker threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+typename SpinningPool<TT,MT,LT,CT>::Generation* SpinningPool<TT,MT,LT,CT>::start( size_t n )
+{
+   Generation* generation( new Generation( n ) );
+   generation->threads_.reserve( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      generation->threads_.push_back( new TT( &SpinningPool::work, this, generation->slots_+i ) );
+   }
+
+   return generation;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waits for all scheduled tasks and terminates all worker threads of a generation.
+//
+// \param generation The generation of slots and worker threads.
+// \return void
+//
+// Once a slot has been stopped it cannot be claimed anymore. Therefore tasks scheduled
+// concurrently to this function are either executed by the worker of the slot before it
+// terminates or by the scheduling thread itself. Note that the slots are not released.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void SpinningPool<TT,MT,LT,CT>::stop( Generation* generation )
+{
+   std::vector<TT*>& threads( generation->threads_ );
+
+   for( size_t i=0UL; i<threads.size(); ++i )
+   {
+      Slot& slot( generation->slots_[i] );
+      size_t expected( idle );
+
+      while( !slot.state_.compare_exchange_strong( expected, stopped ) ) {
+         expected = idle;
+         relax();
+      }
+
+      Lock lock( slot.mutex_ );
+      slot.wakeup_.notify_one();
+   }
+
+   for( size_t i=0UL; i<threads.size(); ++i ) {
+      threads[i]->join();
+      delete threads[i];
+   }
+
+   threads.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Execution loop of a single worker thread.
+//
+// \param slot The dispatch slot of the worker thread.
+// \return void
+//
+// The worker thread actively waits for tasks published in its dispatch slot. After spinning for
+// \a spinLimit iterations without receiving a task, the worker falls asleep until it is woken
+// up by the next scheduled task. Before its first task the worker thread executes the
+// initialization function of the pool (if any).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void SpinningPool<TT,MT,LT,CT>::work( Slot* slot )
+{
+   if( init_ )
+      init_();
+
+   while( true )
+   {
+      size_t state( slot->state_.load() );
+
+      for( size_t spins=0UL; state != ready && state != stopped; state=slot->state_.load() )
+      {
+         if( ++spins < spinLimit ) {
+            relax();
+            continue;
+         }
+
+         slot->sleeping_.store( 1UL );
+
+         {
+            Lock lock( slot->mutex_ );
+            while( ( state = slot->state_.load() ) != ready && state != stopped ) {
+               slot->wakeup_.wait( lock );
+            }
+         }
+
+         slot->sleeping_.store( 0UL );
+         spins = 0UL;
+      }
+
+      if( state == stopped )
+         return;
+
+      slot->invoke_( slot->storage_ );
+      slot->state_.store( idle );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,669 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/TaskGraph.h
+//  \brief Header file for the C++11/Boost thread-based task graph
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_TASKGRAPH_H_
+#define _BLAZE_MATH_SMP_THREADS_TASKGRAPH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsView.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/PtrVector.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Deferred execution of a sequence of assignments.
+// \ingroup smp
+//
+// The TaskGraph class records a sequence of (compound) assignments and executes them as a graph
+// of tasks. The dependencies between the recorded assignments are determined from the aliasing
+// of their operands: An assignment depends on all previously recorded assignments that read its
+// target (write-after-read), that write one of its operands (read-after-write), or that write
+// the same target (write-after-write). On execution, every assignment is started as soon as all
+// assignments it depends on have been completed. Therefore independent assignments are executed
+// concurrently and the calling thread only has to wait once for the completion of all of them,
+// instead of once per assignment:
+
+   \code
+   blaze::TaskGraph graph;
+
+   graph.assign   ( q, A * p );          // Independent of the second assignment
+   graph.assign   ( s, B * p );          // Independent of the first assignment
+   graph.addAssign( x, alpha * p );      // Independent of the first two assignments
+   graph.subAssign( r, alpha * q + s );  // Depends on the first two assignments
+
+   graph.run();  // Executes all four assignments and waits for their completion
+   \endcode
+
+// Each single assignment is executed by means of the usual SMP assignment, i.e. large operations
+// are still split among several worker threads. The recorded assignments can be executed any
+// number of times. Note however that the operands are referenced by the task graph, whereas
+// scalars are copied at the time of the recording. Therefore the target and the operands of all
+// assignments must not be destroyed before the task graph and the recording has to be repeated
+// (see the clear() function) in case scalar factors change.
+//
+// Also note that in contrast to regular assignments the targets are not resized, i.e. the sizes
+// of the targets have to match the sizes of the assigned expressions. Views (as for instance
+// subvectors or rows) can only be used as targets in the form of named objects. Assignments to
+// views are executed in order with respect to all other assignments, since the overlap of views
+// cannot be determined.
+*/
+class TaskGraph : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef TheThreadBackend::Context  Context;  //!< Type of the execution context.
+   typedef TheThreadBackend::Counter  Counter;  //!< Type of the atomic counters.
+   //**********************************************************************************************
+
+   //**Private class Node**************************************************************************
+   /*!\brief Base class for all recorded assignments.
+   */
+   struct Node : private NonCopyable
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Node class.
+      //
+      // \param address The address of the target of the assignment (0 in case of a view).
+      */
+      explicit inline Node( const void* address )
+         : address_     ( address )  // The address of the target
+         , dependencies_( 0UL     )  // The number of predecessors
+         , remaining_   ( 0UL     )  // The number of uncompleted predecessors
+         , successors_  ()           // The indices of the dependent assignments
+      {}
+      //*******************************************************************************************
+
+      //**Destructor*******************************************************************************
+      /*!\brief Destructor of the Node class.
+      */
+      virtual ~Node() {}
+      //*******************************************************************************************
+
+      //**Utility functions************************************************************************
+      /*!\brief Executes the assignment.
+      //
+      // \return void
+      */
+      virtual void execute() = 0;
+
+      /*!\brief Returns whether the given address is read by the assignment.
+      //
+      // \param address The address to be checked.
+      // \return \a true in case the address is aliased by the source operand, \a false if not.
+      */
+      virtual bool reads( const void* address ) const = 0;
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const void* address_;              //!< The address of the target (0 in case of a view).
+      size_t dependencies_;              //!< The number of predecessors of the assignment.
+      Counter remaining_;                //!< The number of uncompleted predecessors.
+      std::vector<size_t> successors_;   //!< The indices of the dependent assignments.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class Statement*********************************************************************
+   /*!\brief Implementation of a single recorded assignment.
+   */
+   template< typename Target  // Type of the target operand
+           , typename Source  // Type of the source operand
+           , typename OP >    // Type of the assignment operation
+   struct Statement : public Node
+   {
+      //**Type definitions*************************************************************************
+      //! Composite type of the source operand.
+      typedef typename SelectType< IsExpression<Source>::value, const Source, const Source& >::Type
+         Operand;
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Statement class template.
+      //
+      // \param target The target operand to be assigned to.
+      // \param source The source operand to be assigned to the target.
+      */
+      explicit inline Statement( Target& target, const Source& source )
+         : Node( IsView<Target>::value ? static_cast<const void*>( 0 ) : &target )
+         , target_( &target )  // The target operand
+         , source_( source  )  // The source operand
+      {}
+      //*******************************************************************************************
+
+      //**Utility functions************************************************************************
+      /*!\brief Executes the assignment.
+      //
+      // \return void
+      */
+      virtual void execute() {
+         OP::apply( *target_, source_ );
+      }
+
+      /*!\brief Returns whether the given address is read by the assignment.
+      //
+      // \param address The address to be checked.
+      // \return \a true in case the address is aliased by the source operand, \a false if not.
+      */
+      virtual bool reads( const void* address ) const {
+         return source_.isAliased( address );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Target* target_;  //!< The target operand.
+      Operand source_;  //!< The source operand.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class Assign************************************************************************
+   /*!\brief Plain assignment operation.
+   */
+   struct Assign {
+      template< typename T1, typename T2 >
+      static inline void apply( T1& lhs, const T2& rhs ) { lhs = rhs; }
+   };
+   //**********************************************************************************************
+
+   //**Private class AddAssign*********************************************************************
+   /*!\brief Addition assignment operation.
+   */
+   struct AddAssign {
+      template< typename T1, typename T2 >
+      static inline void apply( T1& lhs, const T2& rhs ) { lhs += rhs; }
+   };
+   //**********************************************************************************************
+
+   //**Private class SubAssign*********************************************************************
+   /*!\brief Subtraction assignment operation.
+   */
+   struct SubAssign {
+      template< typename T1, typename T2 >
+      static inline void apply( T1& lhs, const T2& rhs ) { lhs -= rhs; }
+   };
+   //**********************************************************************************************
+
+   //**Private class Launcher**********************************************************************
+   /*!\brief Auxiliary functor for the execution of a single assignment of the task graph.
+   */
+   struct Launcher
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Launcher class.
+      //
+      // \param graph The task graph.
+      // \param index The index of the assignment to be executed.
+      */
+      explicit inline Launcher( TaskGraph& graph, size_t index )
+         : graph_( &graph )  // The task graph
+         , index_( index  )  // The index of the assignment
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes the assignment and starts all assignments that became ready.
+      //
+      // \return void
+      */
+      inline void operator()() const {
+         graph_->nodes_[index_]->execute();
+         graph_->release( index_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      TaskGraph* graph_;  //!< The task graph.
+      size_t     index_;  //!< The index of the assignment to be executed.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline TaskGraph();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Recording functions*************************************************************************
+   /*!\name Recording functions */
+   //@{
+   template< typename VT1, bool TF, typename VT2 >
+   inline void assign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs );
+
+   template< typename VT1, bool TF, typename VT2 >
+   inline void addAssign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs );
+
+   template< typename VT1, bool TF, typename VT2 >
+   inline void subAssign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs );
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   inline void assign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   inline void addAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   inline void subAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size () const;
+   inline void   clear();
+   inline void   run  ();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename OP, typename T1, typename T2 >
+   inline void record( T1& lhs, const T2& rhs );
+
+   inline void launch ( size_t index );
+   inline void release( size_t index );
+
+   static inline bool conflict( const Node& first, const Node& second );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   PtrVector<Node> nodes_;  //!< The recorded assignments.
+   Context context_;        //!< The execution context of the assignments.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor of TaskGraph.
+//
+// The default constructor creates an empty task graph, whose assignments are executed by the
+// process-wide worker threads.
+*/
+inline TaskGraph::TaskGraph()
+   : nodes_  ()  // The recorded assignments
+   , context_()  // The execution context of the assignments
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RECORDING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Records the assignment of a vector to a vector.
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector (expression) to be assigned.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT1    // Type of the left-hand side vector
+        , bool TF         // Transpose flag of both vectors
+        , typename VT2 >  // Type of the right-hand side vector
+inline void TaskGraph::assign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs )
+{
+   if( (~lhs).size() != (~rhs).size() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   record<Assign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the addition assignment of a vector to a vector.
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector (expression) to be added.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT1    // Type of the left-hand side vector
+        , bool TF         // Transpose flag of both vectors
+        , typename VT2 >  // Type of the right-hand side vector
+inline void TaskGraph::addAssign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs )
+{
+   if( (~lhs).size() != (~rhs).size() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   record<AddAssign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the subtraction assignment of a vector to a vector.
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector (expression) to be subtracted.
+// \return void
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT1    // Type of the left-hand side vector
+        , bool TF         // Transpose flag of both vectors
+        , typename VT2 >  // Type of the right-hand side vector
+inline void TaskGraph::subAssign( Vector<VT1,TF>& lhs, const Vector<VT2,TF>& rhs )
+{
+   if( (~lhs).size() != (~rhs).size() )
+      throw std::invalid_argument( "Vector sizes do not match" );
+
+   record<SubAssign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the assignment of a matrix to a matrix.
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix (expression) to be assigned.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void TaskGraph::assign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   if( (~lhs).rows() != (~rhs).rows() || (~lhs).columns() != (~rhs).columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   record<Assign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the addition assignment of a matrix to a matrix.
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix (expression) to be added.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void TaskGraph::addAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   if( (~lhs).rows() != (~rhs).rows() || (~lhs).columns() != (~rhs).columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   record<AddAssign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the subtraction assignment of a matrix to a matrix.
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix (expression) to be subtracted.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void TaskGraph::subAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   if( (~lhs).rows() != (~rhs).rows() || (~lhs).columns() != (~rhs).columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   record<SubAssign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of recorded assignments.
+//
+// \return The number of recorded assignments.
+*/
+inline size_t TaskGraph::size() const
+{
+   return nodes_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes all recorded assignments.
+//
+// \return void
+*/
+inline void TaskGraph::clear()
+{
+   nodes_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes all recorded assignments.
+//
+// \return void
+//
+// This function executes all recorded assignments and blocks until all of them have been
+// completed. Assignments without pending dependencies are executed concurrently by the
+// process-wide worker threads. In case the function is called within a serial section, all
+// assignments are executed serially by the calling thread in the order of their recording.
+*/
+inline void TaskGraph::run()
+{
+   if( isSerialSectionActive() ) {
+      for( size_t i=0UL; i<nodes_.size(); ++i ) {
+         nodes_[i]->execute();
+      }
+      return;
+   }
+
+   for( size_t i=0UL; i<nodes_.size(); ++i ) {
+      nodes_[i]->remaining_.store( nodes_[i]->dependencies_ );
+   }
+
+   for( size_t i=0UL; i<nodes_.size(); ++i ) {
+      if( nodes_[i]->dependencies_ == 0UL )
+         launch( i );
+   }
+
+   context_.wait();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the given assignment and determines its dependencies.
+//
+// \param lhs The target operand.
+// \param rhs The source operand.
+// \return void
+*/
+template< typename OP    // Type of the assignment operation
+        , typename T1    // Type of the target operand
+        , typename T2 >  // Type of the source operand
+inline void TaskGraph::record( T1& lhs, const T2& rhs )
+{
+   const size_t index( nodes_.size() );
+
+   nodes_.pushBack( new Statement<T1,T2,OP>( lhs, rhs ) );
+
+   Node& node( *nodes_[index] );
+
+   for( size_t i=0UL; i<index; ++i ) {
+      if( conflict( *nodes_[i], node ) ) {
+         nodes_[i]->successors_.push_back( index );
+         ++node.dependencies_;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Schedules the given assignment for execution.
+//
+// \param index The index of the assignment.
+// \return void
+*/
+inline void TaskGraph::launch( size_t index )
+{
+   TheThreadBackend::scheduleAsync( context_, Launcher( *this, index ), false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reports the completion of the given assignment to all dependent assignments.
+//
+// \param index The index of the completed assignment.
+// \return void
+//
+// This function starts all dependent assignments, whose last pending dependency is the given
+// assignment. Since the dependent assignments are scheduled before the completion of the given
+// assignment is reported to the execution context, the context cannot run out of pending tasks
+// before all assignments have been completed.
+*/
+inline void TaskGraph::release( size_t index )
+{
+   const std::vector<size_t>& successors( nodes_[index]->successors_ );
+
+   for( size_t i=0UL; i<successors.size(); ++i ) {
+      if( nodes_[successors[i]]->remaining_.fetch_sub( 1UL ) == 1UL )
+         launch( successors[i] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether two assignments have to be executed in order.
+//
+// \param first The first assignment.
+// \param second The second assignment.
+// \return \a true in case the assignments depend on each other, \a false if not.
+*/
+inline bool TaskGraph::conflict( const Node& first, const Node& second )
+{
+   if( first.address_ == 0 || second.address_ == 0 )
+      return true;
+
+   return first.address_ == second.address_ ||
+          first.reads( second.address_ ) || second.reads( first.address_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,464 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/ThreadAffinity.h
+//  \brief Header file for the CPU affinity of the worker threads of the thread backend system
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_THREADAFFINITY_H_
+#define _BLAZE_MATH_SMP_THREADS_THREADAFFINITY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(_MSC_VER)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#elif defined(__linux__)
+#  include <fstream>
+#  include <sstream>
+#  include <pthread.h>
+#  include <sched.h>
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include <vector>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief CPU affinity of the worker threads of the C++11 and Boost thread-based parallelization.
+// \ingroup smp
+//
+// The ThreadAffinity class template pins the worker threads of the thread backend system to
+// individual CPUs. The placement of the workers is configured via the \c BLAZE_THREAD_AFFINITY
+// environment variable, which is evaluated once when the first worker is pinned:
+//
+//  - \c compact: The workers are placed on consecutive CPUs, filling one processor package
+//    (socket) after another.
+//  - \c scatter: The workers are distributed round-robin over the processor packages, i.e.
+//    consecutive workers are placed on different sockets.
+//  - An explicit list of CPUs, as for instance \c "0,2,4-7": The i-th worker is pinned to the
+//    i-th CPU of the list.
+//
+// In case the variable is not set or its value cannot be interpreted, the workers are not pinned.
+// Each worker pins itself before executing its first task. In case there are more workers than
+// listed CPUs (for instance due to several execution contexts owning their own workers), the
+// placement is continued cyclically. Only CPUs the process is allowed to run on are considered
+// for the \c compact and \c scatter placements. Note that pinning is only supported on Linux and
+// Windows; on all other platforms the variable has no effect.\n
+// This class must \b NOT be used explicitly! It is reserved for internal use only. Using
+// this class explicitly might result in erroneous results and/or in undefined behavior.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT >  // Type of the mutex lock
+class ThreadAffinity
+{
+ private:
+   //**Type definitions****************************************************************************
+   typedef MT  Mutex;  //!< Type of the mutex.
+   typedef LT  Lock;   //!< Type of a locking object.
+   //**********************************************************************************************
+
+ public:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline void pin();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Initialization functions********************************************************************
+   /*!\name Initialization functions */
+   //@{
+   static inline void initPlacement();
+   static inline void parseList( const char* list );
+   static inline void availableCpus( std::vector<size_t>& cpus );
+   static inline size_t package( size_t cpu );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline void setAffinity( size_t cpu );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   static Mutex mutex_;                       //!< Synchronization mutex.
+   static bool initialized_;                  //!< Initialization flag of the placement.
+   static size_t next_;                       //!< The index of the next worker to be pinned.
+   static std::vector<size_t>* placement_;    //!< The CPUs the workers are placed on.
+   static BLAZE_THREAD_LOCAL bool pinned_;    //!< Pinning flag of the calling worker thread.
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, typename LT >
+MT ThreadAffinity<MT,LT>::mutex_;
+
+template< typename MT, typename LT >
+bool ThreadAffinity<MT,LT>::initialized_ = false;
+
+template< typename MT, typename LT >
+size_t ThreadAffinity<MT,LT>::next_ = 0UL;
+
+template< typename MT, typename LT >
+std::vector<size_t>* ThreadAffinity<MT,LT>::placement_ = 0;
+
+template< typename MT, typename LT >
+BLAZE_THREAD_LOCAL bool ThreadAffinity<MT,LT>::pinned_ = false;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the calling worker thread to its CPU.
+//
+// \return void
+//
+// This function pins the calling worker thread to the next CPU of the placement configured via
+// the \c BLAZE_THREAD_AFFINITY environment variable. Each thread is pinned only once, i.e. all
+// subsequent calls by the same thread return immediately.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT >  // Type of the mutex lock
+inline void ThreadAffinity<MT,LT>::pin()
+{
+   if( pinned_ )
+      return;
+
+   pinned_ = true;
+
+   size_t cpu( 0UL );
+
+   {
+      Lock lock( mutex_ );
+
+      if( !initialized_ ) {
+         initPlacement();
+         initialized_ = true;
+      }
+
+      if( placement_ == 0 || placement_->empty() )
+         return;
+
+      cpu = (*placement_)[ next_ % placement_->size() ];
+      ++next_;
+   }
+
+   setAffinity( cpu );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Pins the calling thread to the given CPU.
+//
+// \param cpu The index of the CPU.
+// \return void
+//
+// In case the affinity cannot be set (e.g. because the CPU is not available), the thread remains
+// unpinned.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT >  // Type of the mutex lock
+inline void ThreadAffinity<MT,LT>::setAffinity( size_t cpu )
+{
+#if defined(_MSC_VER)
+   if( cpu < 8UL*sizeof( DWORD_PTR ) )
+      SetThreadAffinityMask( GetCurrentThread(), static_cast<DWORD_PTR>( 1 ) << cpu );
+#elif defined(__linux__)
+   if( cpu < static_cast<size_t>( CPU_SETSIZE ) ) {
+      cpu_set_t set;
+      CPU_ZERO( &set );
+      CPU_SET( cpu, &set );
+      pthread_setaffinity_np( pthread_self(), sizeof( set ), &set );
+   }
+#else
+   UNUSED_PARAMETER( cpu );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INITIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initializes the placement of the worker threads.
+//
+// \return void
+//
+// This function evaluates the \c BLAZE_THREAD_AFFINITY environment variable. For a \c compact
+// placement the available CPUs are ordered by their processor package, for a \c scatter
+// placement consecutive entries are taken round-robin from the different packages.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+template< typename MT    // Type of the synchronization mutex
+        , typename LT >  // Type of the mutex lock
+inline void ThreadAffinity<MT,LT>::initPlacement()
+{
+   const char* env = std::getenv( "BLAZE_THREAD_AFFINITY" );
+
+   if( env == NULL )
+      return;
+
+   placement_ = new std::vector<size_t>();
+
+   const bool compact( std::strcmp( env, "compact" ) == 0 );
+   const bool scatter( std::strcmp( env, "scatter" ) == 0 );
+
+   if( !compact && !scatter ) {
+      parseList( env );
+      return;
+   }
+
+   std::vector<size_t> cpus;
+   availableCpus( cpus );
+
+   std::vector< std::pair<size_t,size_t> > order;
+   order.reserve( cpus.size() );
+
+   for( size_t i=0UL; i<cpus.size(); ++i ) {
+      order.push_back( std::make_pair( package( cpus[i] ), cpus[i] ) );
+   }
+
+   std::sort( order.begin(), order.end() );
+
+   if( compact ) {
+      for( size_t i=0UL; i<order.size(); ++i )
+         placement_->push_back( order[i].second );
+      return;
+   }
+
+   // Splitting the ordered CPUs into packages and taking one CPU per package in turn
+   std::vector<size_t> first;
+
+   for( size_t i=0UL; i<order.size(); ++i ) {
+      if( i == 0UL || order[i].first != order[i-1UL].first )
+         first.push_back( i );
+   }
+   first.push_back( order.size() );
+
+   for( size_t round=0UL; placement_->size()<order.size(); ++round ) {
+      for( size_t p=0UL; p+1UL<first.size(); ++p ) {
+         if( first[p]+round < first[p+1UL] )
+            placement_->push_back( order[first[p]+round].second );
+      }
+   }
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parses an explicit list of CPUs.
+//
+// \param list The comma-separated list of CPUs and CPU ranges (as for instance "0,2,4-7").
+// \return void
+//
+// In case the list contains an invalid entry, the entire list is discarded and the worker
+// threads are not pinned.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT >  // Type of the mutex lock
+inline void ThreadAffinity<MT,LT>::parseList( const char* list )
+{
+   const char* pos( list );
+
+   while( *pos != '\0' )
+   {
+      char* end( 0 );
+      const long first( std::strtol( pos, &end, 10 ) );
+      long last( first );
+
+      if( end == pos || first < 0L ) {
+         placement_->clear();
+         return;
+      }
+
+      pos = end;
+
+      if( *pos == '-' ) {
+         ++pos;
+         last = std::strtol( pos, &end, 10 );
+         if( end == pos || last < first ) {
+            placement_->clear();
+            return;
+         }
+         pos = end;
+      }
+
+      for( long cpu=first; cpu<=last; ++cpu ) {
+         placement_->push_back( static_cast<size_t>( cpu ) );
+      }
+
+      if( *pos == ',' ) {
+         ++pos;
+      }
+      else if( *pos != '\0' ) {
+         placement_->clear();
+         return;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the CPUs the process is allowed to run on.
+//
+// \param cpus The resulting list of CPUs in ascending order.
+// \return void
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT >  // Type of the mutex lock
+inline void ThreadAffinity<MT,LT>::availableCpus( std::vector<size_t>& cpus )
+{
+#if defined(_MSC_VER)
+   DWORD_PTR process( 0 ), system( 0 );
+   if( GetProcessAffinityMask( GetCurrentProcess(), &process, &system ) ) {
+      for( size_t cpu=0UL; cpu<8UL*sizeof( DWORD_PTR ); ++cpu )
+         if( process & ( static_cast<DWORD_PTR>( 1 ) << cpu ) )
+            cpus.push_back( cpu );
+   }
+#elif defined(__linux__)
+   cpu_set_t set;
+   CPU_ZERO( &set );
+   if( sched_getaffinity( 0, sizeof( set ), &set ) == 0 ) {
+      for( size_t cpu=0UL; cpu<static_cast<size_t>( CPU_SETSIZE ); ++cpu )
+         if( CPU_ISSET( cpu, &set ) )
+            cpus.push_back( cpu );
+   }
+#else
+   UNUSED_PARAMETER( cpus );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the processor package (socket) of the given CPU.
+//
+// \param cpu The index of the CPU.
+// \return The index of the processor package.
+//
+// In case the processor package cannot be determined, the function returns 0.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT >  // Type of the mutex lock
+inline size_t ThreadAffinity<MT,LT>::package( size_t cpu )
+{
+#if defined(__linux__)
+   std::ostringstream path;
+   path << "/sys/devices/system/cpu/cpu" << cpu << "/topology/physical_package_id";
+
+   std::ifstream file( path.str().c_str() );
+   long id( 0L );
+
+   if( file >> id && id >= 0L )
+      return static_cast<size_t>( id );
+#else
+   UNUSED_PARAMETER( cpu );
+#endif
+
+   return 0UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -53,8 +53,16 @@
 #include <cstdlib>
 #include <blaze/math/constraints/Expression.h>
 #include <blaze/math/Functions.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/TaskSection.h>
+#include <blaze/math/smp/ThreadLimit.h>
+#include <blaze/math/smp/threads/ThreadAffinity.h>
+#include <blaze/math/smp/threads/ThreadContext.h>
+#include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/constraints/Const.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/SelectType.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/ThreadPool.h>
 #include <blaze/util/Types.h>
@@ -75,7 +83,10 @@ namespace blaze {
 //
 // The ThreadBackend class template represents the backend system for the C++11 and Boost
 // thread-based parallelization. It provides the functionality to manage a pool of active
-// threads and to schedule (compound) assignment tasks for execution.\n
+// threads and to schedule (compound) assignment tasks for execution. All tasks are scheduled
+// via the execution context that is active for the calling thread (see the ExecutionScope
+// class). In case no context has been activated by the calling thread, the tasks are scheduled
+// via the default context, which uses the process-wide pool of worker threads.\n
 // This class must \b NOT be used explicitly! It is reserved for internal use only. Using
 // this class explicitly might result in erroneous results and/or in undefined behavior.
 */
@@ -86,12 +97,72 @@ template< typename TT    // Type of the encapsulated thread
 class ThreadBackend
 {
  public:
+   //**Type definitions****************************************************************************
+   typedef ThreadContext<TT,MT,LT,CT>  Context;  //!< Type of the execution contexts.
+
+   //! Type of the atomic counters.
+   typedef typename SpinningPool<TT,MT,LT,CT>::Counter  Counter;
+   //**********************************************************************************************
+
+   //**Class Team**********************************************************************************
+   /*!\brief The team of threads executing a single parallel operation.
+   //
+   // A Team determines the number of threads used by a parallel operation of the calling thread
+   // (see the available() function) and registers the operation for its lifetime. Thus parallel
+   // operations that are started concurrently by several threads via the process-wide worker
+   // threads divide the worker threads among each other instead of each of them using all of
+   // the worker threads.
+   */
+   class Team : private NonCopyable
+   {
+    public:
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Team class.
+      */
+      explicit inline Team()
+         : size_  ( 1UL )                   // The number of threads of the team
+         , shared_( !context().isOwner() )  // Flag for the use of the process-wide workers
+      {
+         if( shared_ ) ++operations_;
+         size_ = available( 0UL );
+      }
+      //*******************************************************************************************
+
+      //**Destructor*******************************************************************************
+      /*!\brief Destructor of the Team class.
+      */
+      inline ~Team() {
+         if( shared_ ) --operations_;
+      }
+      //*******************************************************************************************
+
+      //**Utility functions************************************************************************
+      /*!\brief Returns the number of threads of the team.
+      //
+      // \return The number of threads used by the parallel operation.
+      */
+      inline size_t size() const {
+         return size_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      size_t size_;    //!< The number of threads of the team.
+      bool   shared_;  //!< Flag for the use of the process-wide worker threads.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   static inline size_t size  ();
-   static inline void   resize( size_t n, bool block=false );
-   static inline void   wait  ();
+   static inline size_t   size     ();
+   static inline size_t   available( size_t starting=1UL );
+   static inline void     resize   ( size_t n, bool block=false );
+   static inline void     wait     ();
+   static inline Context& context  ();
+   static inline Context* activate ( Context* context );
    //@}
    //**********************************************************************************************
 
@@ -109,6 +180,12 @@ class ThreadBackend
 
    template< typename Target, typename Source >
    static inline void scheduleMultAssign( Target& target, const Source& source );
+
+   template< typename Target, typename Source >
+   static inline void scheduleAsyncAssign( Context& context, Target& target, const Source& source );
+
+   template< typename Callable >
+   static inline void scheduleAsync( Context& context, const Callable& func, bool serial );
    //@}
    //**********************************************************************************************
 
@@ -277,24 +354,153 @@ class ThreadBackend
    };
    //**********************************************************************************************
 
+   //**Private class AsyncAssigner*****************************************************************
+   /*!\brief Auxiliary functor for an entire SMP assignment.
+   */
+   template< typename Target    // Type of the target operand
+           , typename Source >  // Type of the source operand
+   struct AsyncAssigner
+   {
+      //**Type definitions*************************************************************************
+      //! Composite type of the source operand.
+      typedef typename SelectType< IsExpression<Source>::value, const Source, const Source& >::Type
+         Operand;
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the AsyncAssigner class template.
+      //
+      // \param target The target operand to be assigned to.
+      // \param source The source operand to be assigned to the target.
+      */
+      explicit inline AsyncAssigner( Target& target, const Source& source )
+         : target_( &target )  // The target operand
+         , source_( source  )  // The source operand
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Performs the SMP assignment between the two given operands.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         smpAssign( *target_, source_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Target* target_;  //!< The target operand.
+      Operand source_;  //!< The source operand.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class AsyncTask*********************************************************************
+   /*!\brief Auxiliary functor for the asynchronous execution of parallel operations.
+   //
+   // In contrast to the assigners, an AsyncTask executes an entire parallel operation, i.e. the
+   // operation partitions its operands among the worker threads and waits for the completion of
+   // the partial operations via an execution context of its own. In order to guarantee that the
+   // partial operations can always be executed, at least one worker thread must not be blocked
+   // by an asynchronous task. Therefore an asynchronous task is executed serially in case it
+   // would occupy the last available worker thread.
+   */
+   template< typename Callable >  // Type of the function/functor
+   struct AsyncTask
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the AsyncTask class template.
+      //
+      // \param func The function/functor to be executed.
+      // \param serial \a true in case the function shall be executed serially, \a false if not.
+      */
+      explicit inline AsyncTask( const Callable& func, bool serial )
+         : func_  ( func   )            // The function/functor to be executed
+         , serial_( serial )            // Serial execution flag
+         , limit_ ( getThreadLimit() )  // The thread limit of the scheduling thread
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes the function/functor.
+      //
+      // \return void
+      //
+      // The function/functor is executed within the thread limit of the scheduling thread. In
+      // contrast to all other tasks, an asynchronous task leaves the enclosing task section,
+      // since its parallel operations are executed via an execution context of its own.
+      */
+      inline void operator()() {
+         const TaskSection<int> section( false );
+
+         if( isSerialSectionActive() ) {
+            func_();
+            return;
+         }
+
+         const ThreadLimit<int> limit( limit_ );
+
+         const bool parallel( !serial_ && drivers_.fetch_add( 1UL ) + 1UL < threadpool_.size() );
+
+         if( parallel ) {
+            Context context;
+            Context* const previous( activate( &context ) );
+            func_();
+            activate( previous );
+         }
+         else BLAZE_SERIAL_SECTION {
+            func_();
+         }
+
+         if( !serial_ )
+            drivers_.fetch_sub( 1UL );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Callable func_;    //!< The function/functor to be executed.
+      bool     serial_;  //!< Flag for the serial execution of the function.
+      size_t   limit_;   //!< The thread limit of the scheduling thread.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Initialization functions********************************************************************
    /*!\name Initialization functions */
    //@{
    static inline size_t initPool();
+   static        void   initWorker();
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static ThreadPool<TT,MT,LT,CT> threadpool_;  //!< The pool of active threads of the backend system.
+   static typename Context::Pool threadpool_;   //!< The pool of active threads of the backend.
                                                 /*!< It is initialized with the number of threads
                                                      specified via the environment variable
                                                      \c BLAZE_NUM_THREADS. However, it can be
                                                      explicitly resized to arbitrary numbers of
                                                      threads. */
+   static Context default_;  //!< The default execution context.
+                             /*!< The default context borrows the process-wide pool of worker
+                                  threads and is used by all threads that have not activated
+                                  an execution context of their own. */
+   static BLAZE_THREAD_LOCAL Context* current_;  //!< The context activated by the calling thread.
+
+   static Counter drivers_;     //!< The number of asynchronous tasks executed in parallel.
+   static Counter operations_;  //!< The number of concurrent parallel operations.
+                                /*!< This counter only comprises the parallel operations
+                                     that are executed via the process-wide worker threads. */
    //@}
    //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   friend class ThreadContext<TT,MT,LT,CT>;
+   /*! \endcond */
+   //**********************************************************************************************
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -311,7 +517,21 @@ class ThreadBackend
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename TT, typename MT, typename LT, typename CT >
-ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
+typename ThreadBackend<TT,MT,LT,CT>::Context::Pool
+   ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool(), &initWorker );
+
+template< typename TT, typename MT, typename LT, typename CT >
+typename ThreadBackend<TT,MT,LT,CT>::Context ThreadBackend<TT,MT,LT,CT>::default_;
+
+template< typename TT, typename MT, typename LT, typename CT >
+BLAZE_THREAD_LOCAL typename ThreadBackend<TT,MT,LT,CT>::Context*
+   ThreadBackend<TT,MT,LT,CT>::current_ = 0;
+
+template< typename TT, typename MT, typename LT, typename CT >
+typename ThreadBackend<TT,MT,LT,CT>::Counter ThreadBackend<TT,MT,LT,CT>::drivers_( 0UL );
+
+template< typename TT, typename MT, typename LT, typename CT >
+typename ThreadBackend<TT,MT,LT,CT>::Counter ThreadBackend<TT,MT,LT,CT>::operations_( 0UL );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -329,6 +549,9 @@ ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
 /*!\brief Returns the total number of threads managed by the thread backend system.
 //
 // \return The total number of threads of the thread backend system.
+//
+// This function returns the number of worker threads of the execution context of the calling
+// thread.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -336,7 +559,43 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline size_t ThreadBackend<TT,MT,LT,CT>::size()
 {
-   return threadpool_.size();
+   return context().size();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of threads available for a parallel operation of the calling thread.
+//
+// \param starting The number of parallel operations about to be started by the calling thread.
+// \return The number of threads available for a parallel operation.
+//
+// This function returns the number of worker threads of the execution context of the calling
+// thread, restricted to the thread limit of the calling thread (see the \a BLAZE_THREAD_LIMIT
+// macro). In case the context borrows the process-wide worker threads, the worker threads are
+// evenly divided among all parallel operations that are concurrently executed via these worker
+// threads (including the given number of operations about to be started).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadBackend<TT,MT,LT,CT>::available( size_t starting )
+{
+   const Context& context( ThreadBackend::context() );
+
+   size_t threads( context.size() );
+
+   if( !context.isOwner() ) {
+      const size_t operations( operations_.load() + starting );
+      if( operations > 1UL )
+         threads = ( threads > operations )?( threads / operations ):( 1UL );
+   }
+
+   const size_t limit( getThreadLimit() );
+   return ( limit < threads )?( limit ):( threads );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -356,7 +615,8 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::size()
 // removed from the backend system, otherwise new threads are added to the backend system. In
 // case an invalid number of threads is specified, an \a std::invalid_argument exception is
 // thrown. Via the \a block flag it is possible to block the function until the desired
-// number of threads is available.
+// number of threads is available. Note that this function resizes the worker threads of the
+// execution context of the calling thread.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -364,7 +624,7 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline void ThreadBackend<TT,MT,LT,CT>::resize( size_t n, bool block )
 {
-   return threadpool_.resize( n, block );
+   return context().resize( n, block );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -376,7 +636,8 @@ inline void ThreadBackend<TT,MT,LT,CT>::resize( size_t n, bool block )
 //
 // \return void
 //
-// This function blocks until all scheduled tasks have been completed.
+// This function blocks until all tasks scheduled via the execution context of the calling
+// thread have been completed.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -384,7 +645,55 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline void ThreadBackend<TT,MT,LT,CT>::wait()
 {
-   threadpool_.wait();
+   context().wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the execution context of the calling thread.
+//
+// \return Reference to the active execution context.
+//
+// This function returns the execution context activated by the calling thread. In case the
+// calling thread has not activated a context, the default context is returned.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadBackend<TT,MT,LT,CT>::Context& ThreadBackend<TT,MT,LT,CT>::context()
+{
+   Context* const context( current_ );
+   return ( context != 0 )?( *context ):( default_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Activates the given execution context for the calling thread.
+//
+// \param context The execution context to be activated (0 for the default context).
+// \return The previously active execution context of the calling thread.
+//
+// This function activates the given execution context for the calling thread. All subsequent
+// tasks scheduled by the calling thread are scheduled via this context. The function returns
+// the previously active context, which allows to restore it afterwards.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadBackend<TT,MT,LT,CT>::Context*
+   ThreadBackend<TT,MT,LT,CT>::activate( Context* context )
+{
+   Context* const previous( current_ );
+   current_ = context;
+   return previous;
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -417,7 +726,7 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( Assigner<Target,Source>( target, source ) );
+   context().schedule( Assigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -442,7 +751,7 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleAddAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( AddAssigner<Target,Source>( target, source ) );
+   context().schedule( AddAssigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -467,7 +776,7 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleSubAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( SubAssigner<Target,Source>( target, source ) );
+   context().schedule( SubAssigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -492,7 +801,67 @@ template< typename Target    // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::scheduleMultAssign( Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( MultAssigner<Target,Source>( target, source ) );
+   context().schedule( MultAssigner<Target,Source>( target, source ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling an asynchronous SMP assignment of the given operands for execution.
+//
+// \param context The execution context tracking the completion of the assignment.
+// \param target The target operand to be assigned to.
+// \param source The source operand to be assigned to the target.
+// \return void
+//
+// This function schedules an entire SMP assignment of the two given operands for execution
+// by the process-wide worker threads. The assignment is scheduled via the given context, i.e.
+// its completion can be awaited via this context. In case the calling thread is within a serial
+// section, the assignment is executed serially.
+*/
+template< typename TT        // Type of the encapsulated thread
+        , typename MT        // Type of the synchronization mutex
+        , typename LT        // Type of the mutex lock
+        , typename CT >      // Type of the condition variable
+template< typename Target    // Type of the target operand
+        , typename Source >  // Type of the source operand
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleAsyncAssign( Context& context, Target& target,
+                                                             const Source& source )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
+   scheduleAsync( context, AsyncAssigner<Target,Source>( target, source ),
+                  isSerialSectionActive() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling a function that executes parallel operations for execution.
+//
+// \param context The execution context tracking the completion of the function.
+// \param func The given function/functor.
+// \param serial \a true in case the function shall be executed serially, \a false if not.
+// \return void
+//
+// This function schedules the given function/functor for execution by the process-wide worker
+// threads. In contrast to the tasks scheduled by the assignment functions, the function may
+// itself execute parallel operations, which are scheduled via an execution context of their
+// own. The function is scheduled via the given context, i.e. its completion can be awaited via
+// this context.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the function/functor
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleAsync( Context& context, const Callable& func,
+                                                       bool serial )
+{
+   context.schedule( AsyncTask<Callable>( func, serial ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -539,6 +908,30 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::initPool()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initializes a worker thread of the thread backend system.
+//
+// \return void
+//
+// This function is executed once by every worker thread of the thread backend system before
+// the worker executes its first task. It pins the worker according to the \c BLAZE_THREAD_AFFINITY
+// environment variable (see the ThreadAffinity class). Since the function is executed by the
+// worker threads only, threads executing a task within the scheduling function (for instance
+// in case all workers are busy) are not affected.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadBackend<TT,MT,LT,CT>::initWorker()
+{
+   ThreadAffinity<MT,LT>::pin();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,467 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/ThreadContext.h
+//  \brief Header file for the execution contexts of the C++11 and Boost thread backend system
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_THREADCONTEXT_H_
+#define _BLAZE_MATH_SMP_THREADS_THREADCONTEXT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <stdexcept>
+#include <blaze/math/smp/TaskSection.h>
+#include <blaze/math/smp/threads/SpinningPool.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/ThreadPool.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/UniquePtr.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ::blaze NAMESPACE FORWARD DECLARATIONS
+//
+//=================================================================================================
+
+template< typename TT, typename MT, typename LT, typename CT > class ThreadBackend;
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Execution context of the C++11 and Boost thread-based parallelization.
+// \ingroup smp
+//
+// The ThreadContext class template represents a set of worker threads together with the tasks
+// that have been scheduled by a single caller. A context either owns its own pool of worker
+// threads or borrows the process-wide pool of the thread backend system. In both cases it keeps
+// track of its own scheduled tasks, i.e. waiting for the completion of the tasks of a context
+// is not affected by tasks scheduled via any other context, even if both contexts share the
+// same workers. Therefore several application threads can use the thread-based parallelization
+// concurrently by means of separate contexts (see the ExecutionScope class for details).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+class ThreadContext : private NonCopyable
+{
+ public:
+   //**Type definitions****************************************************************************
+#if BLAZE_USE_SPINNING_WORKERS
+   typedef SpinningPool<TT,MT,LT,CT>  Pool;  //!< Type of the pool of worker threads.
+#else
+   typedef ThreadPool<TT,MT,LT,CT>    Pool;  //!< Type of the pool of worker threads.
+#endif
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef MT  Mutex;      //!< Type of the mutex.
+   typedef LT  Lock;       //!< Type of a locking object.
+   typedef CT  Condition;  //!< Condition variable type.
+
+   //! Type of the atomic counter of pending tasks.
+   typedef typename SpinningPool<TT,MT,LT,CT>::Counter  Counter;
+   //**********************************************************************************************
+
+   //**Private class Task**************************************************************************
+   /*!\brief Auxiliary functor for the completion tracking of a scheduled task.
+   */
+   template< typename Callable >  // Type of the function/functor
+   struct Task
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Task class template.
+      //
+      // \param context The context the task is scheduled for.
+      // \param func The function/functor to be executed.
+      */
+      explicit inline Task( ThreadContext& context, const Callable& func )
+         : context_( &context )  // The context the task is scheduled for
+         , func_   ( func     )  // The function/functor to be executed
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Executes the task and reports its completion to the context.
+      //
+      // \return void
+      //
+      // The task is executed within a task section, i.e. all parallel operations started by
+      // the task are executed serially (see the TaskSection class).
+      */
+      inline void operator()() {
+         {
+            const TaskSection<int> section( true );
+            func_();
+         }
+         context_->finish();
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      ThreadContext* context_;  //!< The context the task is scheduled for.
+      Callable func_;           //!< The function/functor to be executed.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline ThreadContext();
+   explicit inline ThreadContext( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~ThreadContext();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size   () const;
+   inline bool   isOwner() const;
+   inline bool   isIdle () const;
+   inline void   resize ( size_t n, bool block=false );
+   inline void   wait   ();
+
+   template< typename Callable >
+   inline void schedule( const Callable& func );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void finish();
+
+   static inline size_t sleeping();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   UniquePtr<Pool> owned_;    //!< The pool of worker threads owned by the context (if any).
+   Pool* pool_;               //!< The pool of worker threads used by the context.
+   Counter pending_;          //!< The number of scheduled, but not yet completed tasks.
+                              /*!< The most significant bit of the counter indicates that at
+                                   least one thread is blocked in the wait() function. */
+   mutable Mutex mutex_;      //!< Synchronization mutex.
+   Condition finished_;       //!< Wait condition for the completion of all scheduled tasks.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for the ThreadContext class.
+//
+// This constructor creates a context that borrows the process-wide worker threads of the thread
+// backend system (which are initialized via the \c BLAZE_NUM_THREADS environment variable).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline ThreadContext<TT,MT,LT,CT>::ThreadContext()
+   : owned_   ()                                            // The owned pool of worker threads
+   , pool_    ( &ThreadBackend<TT,MT,LT,CT>::threadpool_ )  // The used pool of worker threads
+   , pending_ ( 0UL )                                       // The number of pending tasks
+   , mutex_   ()                                            // Synchronization mutex
+   , finished_()                                            // Wait condition for the tasks
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a context with \a n own worker threads.
+//
+// \param n The number of worker threads \f$[1..\infty)\f$.
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This constructor creates a context with its own pool of \a n worker threads, which is not
+// shared with any other context. In case \a n is 0, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline ThreadContext<TT,MT,LT,CT>::ThreadContext( size_t n )
+   : owned_   ( new Pool( n, &ThreadBackend<TT,MT,LT,CT>::initWorker ) )  // The owned pool
+   , pool_    ( owned_.get() )  // The used pool of worker threads
+   , pending_ ( 0UL )           // The number of pending tasks
+   , mutex_   ()                // Synchronization mutex
+   , finished_()                // Wait condition for the tasks
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the ThreadContext class.
+//
+// The destructor waits for the completion of all tasks scheduled via the context before the
+// worker threads owned by the context (if any) are released.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline ThreadContext<TT,MT,LT,CT>::~ThreadContext()
+{
+   wait();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of worker threads of the context.
+//
+// \return The number of worker threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadContext<TT,MT,LT,CT>::size() const
+{
+   return pool_->size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the context owns its worker threads.
+//
+// \return \a true in case the context owns its worker threads, \a false if they are borrowed.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool ThreadContext<TT,MT,LT,CT>::isOwner() const
+{
+   return owned_.get() != 0;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether all tasks scheduled via the context have been completed.
+//
+// \return \a true in case no scheduled task is pending, \a false if not.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool ThreadContext<TT,MT,LT,CT>::isIdle() const
+{
+   return ( pending_.load() & ~sleeping() ) == 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changes the number of worker threads of the context.
+//
+// \param n The new number of threads \f$[1..\infty)\f$.
+// \param block \a true if the function shall block, \a false if not.
+// \return void
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This function changes the number of worker threads of the context. Note that in case the
+// context borrows the process-wide worker threads, all contexts sharing these threads are
+// affected.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadContext<TT,MT,LT,CT>::resize( size_t n, bool block )
+{
+   pool_->resize( n, block );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for all tasks scheduled via the context to be completed.
+//
+// \return void
+//
+// This function blocks until all tasks scheduled via this context have been completed. Tasks
+// scheduled via other contexts sharing the same worker threads are not waited for. In case of
+// a spinning pool (see the BLAZE_USE_SPINNING_WORKERS switch) the calling thread actively waits
+// for a short period of time before it falls asleep.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadContext<TT,MT,LT,CT>::wait()
+{
+#if BLAZE_USE_SPINNING_WORKERS
+   for( size_t spins=0UL; spins<Pool::spinLimit; ++spins ) {
+      if( pending_.load() == 0UL )
+         return;
+      Pool::relax();
+   }
+#endif
+
+   Lock lock( mutex_ );
+
+   for( size_t pending=pending_.load(); pending!=0UL; pending=pending_.load() )
+   {
+      // Announcing the blocked thread to the finishing task (again after every wake-up, since
+      // the flag is reset by every notification)
+      if( ( pending & sleeping() ) == 0UL &&
+          !pending_.compare_exchange_strong( pending, pending | sleeping() ) )
+         continue;
+
+      finished_.wait( lock );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given zero argument function/functor for execution.
+//
+// \param func The given function/functor.
+// \return void
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the function/functor
+inline void ThreadContext<TT,MT,LT,CT>::schedule( const Callable& func )
+{
+   pending_.fetch_add( 1UL );
+   pool_->schedule( Task<Callable>( *this, func ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reports the completion of a single scheduled task.
+//
+// \return void
+//
+// In case the last pending task is completed while a thread is blocked in the wait() function,
+// the counter is reset and the blocked threads are notified under the lock of the mutex (unless
+// further tasks have been scheduled in the meantime). Since blocked threads only return from
+// wait() once the counter is reset, this guarantees that the context is not destroyed before
+// the notification has been completed. Otherwise the atomic decrement of the counter is the
+// last access to the context.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadContext<TT,MT,LT,CT>::finish()
+{
+   if( pending_.fetch_sub( 1UL ) == ( sleeping() | 1UL ) ) {
+      Lock lock( mutex_ );
+      size_t expected( sleeping() );
+      if( pending_.compare_exchange_strong( expected, 0UL ) )
+         finished_.notify_all();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the flag of the pending counter indicating blocked threads.
+//
+// \return The most significant bit of the counter.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadContext<TT,MT,LT,CT>::sleeping()
+{
+   return ~( ~size_t( 0UL ) >> 1 );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,2528 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/BlockCompressedMatrix.h
+//  \brief Implementation of a block compressed sparse row (BCSR) MxN matrix
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+
+#ifndef _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/SparseElement.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MathTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/HasBlockStorage.h>
+#include <blaze/math/views/Forward.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup block_compressed_matrix BlockCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Row-major \f$ M \times N \f$ sparse matrix in the block compressed sparse row format.
+// \ingroup block_compressed_matrix
+//
+// The BlockCompressedMatrix class template is a row-major sparse matrix that stores its non-zero
+// elements in small dense blocks of \f$ R \times C \f$ elements (block compressed sparse row or
+// BCSR format). The matrix is partitioned into block rows of \a R consecutive rows and block
+// columns of \a C consecutive columns. For every block row only the non-zero blocks are stored,
+// each one with a single block column index. This format is well suited for matrices with a
+// natural block structure, as for instance matrices resulting from finite element methods with
+// several degrees of freedom per node: in comparison to a CompressedMatrix the number of stored
+// indices is reduced by a factor of \f$ R \cdot C \f$ and the multiplication kernels can apply
+// vectorized small dense matrix operations to every block. The type of the elements, the size
+// of the blocks, and the type of the stored block indices can be specified via the four template
+// parameters:
+
+   \code
+   template< typename Type, size_t R, size_t C, typename IT >
+   class BlockCompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. BlockCompressedMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - R   : specifies the number of rows of each block.
+//  - C   : specifies the number of columns of each block.
+//  - IT  : specifies the integral type used to store the block column index of each non-zero
+//          block. The default value is \a size_t. The number of block columns must not exceed
+//          the range of this type.
+//
+// Each block is stored as a column-major StaticMatrix (see the nested \a BlockType), i.e. the
+// columns of a block are padded to full SIMD registers. The sparsity pattern of a matrix is
+// determined by its blocks: within a non-zero block all elements are stored, including explicit
+// zeros. A BlockCompressedMatrix can be created from any other dense or sparse matrix (for
+// instance a CompressedMatrix), which determines the non-zero blocks automatically, or filled
+// block by block via the appendBlock() and finalizeBlockRow() functions:
+
+   \code
+   using blaze::BlockCompressedMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::StaticMatrix;
+
+   CompressedMatrix<double> A( 3000UL, 3000UL );
+   // ... Initialization of the compressed matrix
+
+   BlockCompressedMatrix<double,3UL,3UL> B( A );  // Conversion into 3x3 blocks
+
+   StaticMatrix<double,3UL,3UL> K;
+   // ... Initialization of the element matrix
+
+   BlockCompressedMatrix<double,3UL,3UL> C( 6UL, 6UL, 3UL );  // 2x2 block rows/columns, 3 blocks
+   C.appendBlock( 0UL, 0UL, K );  // Appending the block (0,0)
+   C.appendBlock( 0UL, 1UL, K );  // Appending the block (0,1)
+   C.finalizeBlockRow( 0UL );     // Finalizing block row 0
+   C.appendBlock( 1UL, 1UL, K );  // Appending the block (1,1)
+   C.finalizeBlockRow( 1UL );     // Finalizing block row 1
+
+   DynamicVector<double> x( 3000UL ), y;
+   // ... Initialization of the dense vector
+
+   y = B * x;  // Vectorized (and possibly parallel) block sparse matrix/dense vector multiplication
+
+   CompressedMatrix<double> D( B );  // Conversion back to a compressed matrix
+   \endcode
+
+// In case the number of rows or columns is not a multiple of the block size, the blocks of the
+// last block row and column are only partially used. The unused elements of these blocks are
+// zero and are neither visited by the iterators nor taken into account by the multiplication
+// kernels.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+class BlockCompressedMatrix : public SparseMatrix< BlockCompressedMatrix<Type,R,C,IT>, false >
+{
+ public:
+   //**Compilation flags***************************************************************************
+   //! The number of rows of each block.
+   enum { rowsPerBlock = R };
+
+   //! The number of columns of each block.
+   enum { columnsPerBlock = C };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef StaticMatrix<Type,R,C,columnMajor>  BlockType;  //!< Type of the non-zero blocks.
+   //**********************************************************************************************
+
+   //**BlockElement class definition***************************************************************
+   /*!\brief Access proxy for a single element of a non-zero block of a BlockCompressedMatrix.
+   //
+   // The BlockElement class combines the value of an element of a non-zero block with its
+   // column index and provides the same interface as the value-index-pairs of CompressedMatrix.
+   */
+   template< typename VT >  // Type of the value (Type or const Type)
+   class BlockElement : private SparseElement
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef Type           ValueType;       //!< The value type of the element.
+      typedef size_t         IndexType;       //!< The index type of the element.
+      typedef VT&            Reference;       //!< Reference return type.
+      typedef const Type&    ConstReference;  //!< Reference-to-const return type.
+      typedef BlockElement*  Pointer;         //!< Pointer return type.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the BlockElement class.
+      //
+      // \param value Pointer to the value of the element.
+      // \param index The column index of the element.
+      */
+      inline BlockElement( VT* value, size_t index )
+         : value_( value )  // Pointer to the value of the element
+         , index_( index )  // The column index of the element
+      {}
+      //*******************************************************************************************
+
+      //**Assignment operator**********************************************************************
+      /*!\brief Assignment to the accessed sparse matrix element.
+      //
+      // \param v The new value of the sparse matrix element.
+      // \return Reference to the sparse matrix element.
+      */
+      template< typename T > inline BlockElement& operator=( const T& v ) {
+         *value_ = v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment to the accessed sparse matrix element.
+      //
+      // \param v The right-hand side value for the addition.
+      // \return Reference to the sparse matrix element.
+      */
+      template< typename T > inline BlockElement& operator+=( const T& v ) {
+         *value_ += v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment to the accessed sparse matrix element.
+      //
+      // \param v The right-hand side value for the subtraction.
+      // \return Reference to the sparse matrix element.
+      */
+      template< typename T > inline BlockElement& operator-=( const T& v ) {
+         *value_ -= v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Multiplication assignment operator*******************************************************
+      /*!\brief Multiplication assignment to the accessed sparse matrix element.
+      //
+      // \param v The right-hand side value for the multiplication.
+      // \return Reference to the sparse matrix element.
+      */
+      template< typename T > inline BlockElement& operator*=( const T& v ) {
+         *value_ *= v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Division assignment operator*************************************************************
+      /*!\brief Division assignment to the accessed sparse matrix element.
+      //
+      // \param v The right-hand side value for the division.
+      // \return Reference to the sparse matrix element.
+      */
+      template< typename T > inline BlockElement& operator/=( const T& v ) {
+         *value_ /= v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline Pointer operator->() {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline Reference value() const {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline IndexType index() const {
+         return index_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      VT*    value_;  //!< Pointer to the value of the element.
+      size_t index_;  //!< The column index of the element.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**BlockIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of a row of a BlockCompressedMatrix.
+   //
+   // The BlockIterator traverses the elements of a single row of all non-zero blocks of the
+   // according block row. Elements of the last block column that lie beyond the number of
+   // columns of the matrix are skipped.
+   */
+   template< typename VT >  // Type of the value (Type or const Type)
+   class BlockIterator
+   {
+    private:
+      //**Type definitions*************************************************************************
+      //! Type of the traversed blocks.
+      typedef typename SelectType< IsConst<VT>::value, const BlockType, BlockType >::Type  BT;
+      //*******************************************************************************************
+
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::forward_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef BlockElement<VT>           ValueType;         //!< Type of the underlying elements.
+      typedef ValueType                  PointerType;       //!< Pointer return type.
+      typedef ValueType                  ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                  DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Default constructor**********************************************************************
+      /*!\brief Default constructor for the BlockIterator class.
+      */
+      inline BlockIterator()
+         : block_( NULL )  // Pointer to the current non-zero block
+         , index_( NULL )  // Pointer to the block column index of the current block
+         , row_  ( 0UL  )  // The row of the traversed elements within the blocks
+         , col_  ( 0UL  )  // The column of the current element within the current block
+         , n_    ( 0UL  )  // The number of columns of the matrix
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the BlockIterator class.
+      //
+      // \param block Pointer to the current non-zero block.
+      // \param index Pointer to the block column index of the current block.
+      // \param row The row of the traversed elements within the blocks.
+      // \param col The column of the current element within the current block.
+      // \param n The number of columns of the matrix.
+      */
+      inline BlockIterator( BT* block, const IT* index, size_t row, size_t col, size_t n )
+         : block_( block )  // Pointer to the current non-zero block
+         , index_( index )  // Pointer to the block column index of the current block
+         , row_  ( row   )  // The row of the traversed elements within the blocks
+         , col_  ( col   )  // The column of the current element within the current block
+         , n_    ( n     )  // The number of columns of the matrix
+      {}
+      //*******************************************************************************************
+
+      //**Conversion constructor*******************************************************************
+      /*!\brief Conversion constructor from different BlockIterator instances.
+      //
+      // \param it The iterator to be copied.
+      */
+      template< typename VT2 >
+      inline BlockIterator( const BlockIterator<VT2>& it )
+         : block_( it.block_ )  // Pointer to the current non-zero block
+         , index_( it.index_ )  // Pointer to the block column index of the current block
+         , row_  ( it.row_   )  // The row of the traversed elements within the blocks
+         , col_  ( it.col_   )  // The column of the current element within the current block
+         , n_    ( it.n_     )  // The number of columns of the matrix
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline BlockIterator& operator++() {
+         if( ++col_ == C || static_cast<size_t>( *index_ )*C + col_ == n_ ) {
+            col_ = 0UL;
+            ++block_;
+            ++index_;
+         }
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const BlockIterator operator++( int ) {
+         const BlockIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the current sparse matrix element.
+      //
+      // \return Access proxy for the current sparse matrix element.
+      */
+      inline ReferenceType operator*() const {
+         return ReferenceType( &(*block_)(row_,col_), static_cast<size_t>( *index_ )*C + col_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the current sparse matrix element.
+      //
+      // \return Access proxy for the current sparse matrix element.
+      */
+      inline PointerType operator->() const {
+         return PointerType( &(*block_)(row_,col_), static_cast<size_t>( *index_ )*C + col_ );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two BlockIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator==( const BlockIterator<VT2>& rhs ) const {
+         return index_ == rhs.index_ && col_ == rhs.col_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two BlockIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      template< typename VT2 >
+      inline bool operator!=( const BlockIterator<VT2>& rhs ) const {
+         return index_ != rhs.index_ || col_ != rhs.col_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two BlockIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      //
+      // Both iterators have to refer to the same row of the matrix and the left-hand side
+      // iterator must not precede the right-hand side iterator.
+      */
+      template< typename VT2 >
+      inline DifferenceType operator-( const BlockIterator<VT2>& rhs ) const {
+         DifferenceType diff( ( index_ - rhs.index_ ) * DifferenceType( C ) +
+                              DifferenceType( col_ ) - DifferenceType( rhs.col_ ) );
+         if( index_ != rhs.index_ ) {
+            const size_t last( static_cast<size_t>( *( index_-1 ) )*C );
+            if( last + C > n_ )
+               diff -= DifferenceType( last + C - n_ );
+         }
+         return diff;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      BT*       block_;  //!< Pointer to the current non-zero block.
+      const IT* index_;  //!< Pointer to the block column index of the current block.
+      size_t    row_;    //!< The row of the traversed elements within the blocks.
+      size_t    col_;    //!< The column of the current element within the current block.
+      size_t    n_;      //!< The number of columns of the matrix.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      /*! \cond BLAZE_INTERNAL */
+      template< typename VT2 > friend class BlockIterator;
+      /*! \endcond */
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef BlockCompressedMatrix<Type,R,C,IT>  This;            //!< Type of this BlockCompressedMatrix instance.
+   typedef This                                ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,true>         OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,true>         TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                                ElementType;     //!< Type of the sparse matrix elements.
+   typedef IT                                  IndexType;       //!< Type of the stored block indices.
+   typedef const Type&                         ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                         CompositeType;   //!< Data type for composite expression templates.
+   typedef const Type&                         Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                         ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef BlockIterator<Type>                 Iterator;        //!< Iterator over non-constant elements.
+   typedef BlockIterator<const Type>           ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a BlockCompressedMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef BlockCompressedMatrix<ET,R,C,IT>  Other;  //!< The type of the other BlockCompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since a BlockCompressedMatrix is never the target of an SMP assignment, the
+       flag only enables the parallel evaluation of expressions involving the matrix. */
+   enum { smpAssignable = 1 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BlockCompressedMatrix();
+   explicit inline BlockCompressedMatrix( size_t m, size_t n );
+   explicit inline BlockCompressedMatrix( size_t m, size_t n, size_t nonzeroBlocks );
+            inline BlockCompressedMatrix( const BlockCompressedMatrix& sm );
+
+   template< typename MT, bool SO >
+   inline BlockCompressedMatrix( const Matrix<MT,SO>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~BlockCompressedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline BlockCompressedMatrix& operator=( const BlockCompressedMatrix& rhs );
+
+   template< typename MT, bool SO > inline BlockCompressedMatrix& operator=( const Matrix<MT,SO>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, BlockCompressedMatrix >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, BlockCompressedMatrix >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t                 rows() const;
+                              inline size_t                 columns() const;
+                              inline size_t                 blockRows() const;
+                              inline size_t                 blockColumns() const;
+                              inline size_t                 capacity() const;
+                              inline size_t                 capacity( size_t i ) const;
+                              inline size_t                 nonZeros() const;
+                              inline size_t                 nonZeros( size_t i ) const;
+                              inline size_t                 nonZeroBlocks() const;
+                              inline size_t                 nonZeroBlocks( size_t bi ) const;
+                              inline void                   reset();
+                              inline void                   reset( size_t i );
+                              inline void                   clear();
+                                     void                   reserve( size_t nonzeroBlocks );
+   template< typename Other > inline BlockCompressedMatrix& scale( const Other& scalar );
+                              inline void                   swap( BlockCompressedMatrix& sm ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline Iterator      upperBound( size_t i, size_t j );
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   template< typename MT, bool SO >
+   inline void appendBlock( size_t bi, size_t bj, const DenseMatrix<MT,SO>& block );
+
+   inline void             finalizeBlockRow( size_t bi );
+   inline size_t           blockBegin( size_t bi ) const;
+   inline size_t           blockEnd  ( size_t bi ) const;
+   inline size_t           blockIndex( size_t k ) const;
+   inline BlockType&       block     ( size_t k );
+   inline const BlockType& block     ( size_t k ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool canSMPAssign() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >           void initialize( const SparseMatrix<MT,false>& sm );
+   template< typename MT, bool SO >  void initialize( const Matrix<MT,SO>& m );
+
+   inline size_t lowerBoundBlock( size_t bi, size_t bj ) const;
+
+   static inline size_t checkIndexRange( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t     m_;         //!< The current number of rows of the sparse matrix.
+   size_t     n_;         //!< The current number of columns of the sparse matrix.
+   size_t     mb_;        //!< The current number of block rows of the sparse matrix.
+   size_t     nb_;        //!< The current number of block columns of the sparse matrix.
+   size_t     capacity_;  //!< The maximum number of non-zero blocks of the sparse matrix.
+   size_t*    begin_;     //!< Offset of the first non-zero block of each block row.
+   size_t*    end_;       //!< Offset one past the last non-zero block of each block row.
+   IT*        index_;     //!< The block column indices of all non-zero blocks.
+   BlockType* blocks_;    //!< The non-zero blocks of the sparse matrix.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE     ( IT   );
+   BLAZE_STATIC_ASSERT( R > 0UL && C > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+const Type BlockCompressedMatrix<Type,R,C,IT>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BlockCompressedMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline BlockCompressedMatrix<Type,R,C,IT>::BlockCompressedMatrix()
+   : m_       ( 0UL )            // The current number of rows of the sparse matrix
+   , n_       ( 0UL )            // The current number of columns of the sparse matrix
+   , mb_      ( 0UL )            // The current number of block rows of the sparse matrix
+   , nb_      ( 0UL )            // The current number of block columns of the sparse matrix
+   , capacity_( 0UL )            // The maximum number of non-zero blocks of the sparse matrix
+   , begin_   ( new size_t[2] )  // Offset of the first non-zero block of each block row
+   , end_     ( begin_+1 )       // Offset one past the last non-zero block of each block row
+   , index_   ( NULL )           // The block column indices of all non-zero blocks
+   , blocks_  ( NULL )           // The non-zero blocks of the sparse matrix
+{
+   begin_[0] = end_[0] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline BlockCompressedMatrix<Type,R,C,IT>::BlockCompressedMatrix( size_t m, size_t n )
+   : m_       ( m )                            // The current number of rows of the sparse matrix
+   , n_       ( checkIndexRange( n ) )         // The current number of columns of the sparse matrix
+   , mb_      ( ( m + R - 1UL ) / R )          // The current number of block rows of the sparse matrix
+   , nb_      ( ( n + C - 1UL ) / C )          // The current number of block columns of the sparse matrix
+   , capacity_( 0UL )                          // The maximum number of non-zero blocks of the sparse matrix
+   , begin_   ( new size_t[2UL*mb_+2UL] )      // Offset of the first non-zero block of each block row
+   , end_     ( begin_+mb_+1UL )               // Offset one past the last non-zero block of each block row
+   , index_   ( NULL )                         // The block column indices of all non-zero blocks
+   , blocks_  ( NULL )                         // The non-zero blocks of the sparse matrix
+{
+   std::fill( begin_, begin_+2UL*mb_+2UL, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$ with capacity for the given number
+//        of non-zero blocks.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeroBlocks The number of expected non-zero blocks.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix. The reserved capacity can be filled by means
+// of the appendBlock() and finalizeBlockRow() functions.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline BlockCompressedMatrix<Type,R,C,IT>::BlockCompressedMatrix( size_t m, size_t n, size_t nonzeroBlocks )
+   : m_       ( m )                                  // The current number of rows of the sparse matrix
+   , n_       ( checkIndexRange( n ) )               // The current number of columns of the sparse matrix
+   , mb_      ( ( m + R - 1UL ) / R )                // The current number of block rows of the sparse matrix
+   , nb_      ( ( n + C - 1UL ) / C )                // The current number of block columns of the sparse matrix
+   , capacity_( nonzeroBlocks )                      // The maximum number of non-zero blocks of the sparse matrix
+   , begin_   ( new size_t[2UL*mb_+2UL] )            // Offset of the first non-zero block of each block row
+   , end_     ( begin_+mb_+1UL )                     // Offset one past the last non-zero block of each block row
+   , index_   ( allocate<IT>( nonzeroBlocks ) )      // The block column indices of all non-zero blocks
+   , blocks_  ( allocate<BlockType>( nonzeroBlocks ) )  // The non-zero blocks of the sparse matrix
+{
+   std::fill( begin_, begin_+2UL*mb_+2UL, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for BlockCompressedMatrix.
+//
+// \param sm Sparse matrix to be copied.
+//
+// The non-zero blocks of the given matrix are stored contiguously in the new matrix, which has
+// no free capacity.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline BlockCompressedMatrix<Type,R,C,IT>::BlockCompressedMatrix( const BlockCompressedMatrix& sm )
+   : m_       ( sm.m_ )                                     // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )                                     // The current number of columns of the sparse matrix
+   , mb_      ( sm.mb_ )                                    // The current number of block rows of the sparse matrix
+   , nb_      ( sm.nb_ )                                    // The current number of block columns of the sparse matrix
+   , capacity_( sm.nonZeroBlocks() )                        // The maximum number of non-zero blocks of the sparse matrix
+   , begin_   ( new size_t[2UL*mb_+2UL] )                   // Offset of the first non-zero block of each block row
+   , end_     ( begin_+mb_+1UL )                            // Offset one past the last non-zero block of each block row
+   , index_   ( allocate<IT>( capacity_ ) )                 // The block column indices of all non-zero blocks
+   , blocks_  ( allocate<BlockType>( capacity_ ) )          // The non-zero blocks of the sparse matrix
+{
+   size_t k( 0UL );
+
+   for( size_t bi=0UL; bi<mb_; ++bi ) {
+      begin_[bi] = k;
+      for( size_t l=sm.begin_[bi]; l<sm.end_[bi]; ++l, ++k ) {
+         index_ [k] = sm.index_ [l];
+         blocks_[k] = sm.blocks_[l];
+      }
+      end_[bi] = k;
+   }
+
+   begin_[mb_] = end_[mb_] = k;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense and sparse matrices.
+//
+// \param m Matrix to be converted.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// This constructor creates a BlockCompressedMatrix from the given dense or sparse matrix. All
+// blocks containing at least one non-zero element of the given matrix are stored.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+template< typename MT    // Type of the foreign matrix
+        , bool SO >      // Storage order of the foreign matrix
+inline BlockCompressedMatrix<Type,R,C,IT>::BlockCompressedMatrix( const Matrix<MT,SO>& m )
+   : m_       ( (~m).rows() )                         // The current number of rows of the sparse matrix
+   , n_       ( checkIndexRange( (~m).columns() ) )   // The current number of columns of the sparse matrix
+   , mb_      ( ( m_ + R - 1UL ) / R )                // The current number of block rows of the sparse matrix
+   , nb_      ( ( n_ + C - 1UL ) / C )                // The current number of block columns of the sparse matrix
+   , capacity_( 0UL )                                 // The maximum number of non-zero blocks of the sparse matrix
+   , begin_   ( new size_t[2UL*mb_+2UL] )             // Offset of the first non-zero block of each block row
+   , end_     ( begin_+mb_+1UL )                      // Offset one past the last non-zero block of each block row
+   , index_   ( NULL )                                // The block column indices of all non-zero blocks
+   , blocks_  ( NULL )                                // The non-zero blocks of the sparse matrix
+{
+   std::fill( begin_, begin_+2UL*mb_+2UL, 0UL );
+   initialize( ~m );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for BlockCompressedMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline BlockCompressedMatrix<Type,R,C,IT>::~BlockCompressedMatrix()
+{
+   delete [] begin_;
+   deallocate( index_ );
+   deallocate( blocks_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the element at the given position or to a zero element.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline typename BlockCompressedMatrix<Type,R,C,IT>::ConstReference
+   BlockCompressedMatrix<Type,R,C,IT>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( lowerBoundBlock( i/R, j/C ) );
+
+   if( k != end_[i/R] && static_cast<size_t>( index_[k] ) == j/C )
+      return blocks_[k](i%R,j%C);
+   else
+      return zero_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline typename BlockCompressedMatrix<Type,R,C,IT>::Iterator
+   BlockCompressedMatrix<Type,R,C,IT>::begin( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t k( begin_[i/R] );
+   return Iterator( blocks_+k, index_+k, i%R, 0UL, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline typename BlockCompressedMatrix<Type,R,C,IT>::ConstIterator
+   BlockCompressedMatrix<Type,R,C,IT>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t k( begin_[i/R] );
+   return ConstIterator( blocks_+k, index_+k, i%R, 0UL, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline typename BlockCompressedMatrix<Type,R,C,IT>::ConstIterator
+   BlockCompressedMatrix<Type,R,C,IT>::cbegin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t k( begin_[i/R] );
+   return ConstIterator( blocks_+k, index_+k, i%R, 0UL, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline typename BlockCompressedMatrix<Type,R,C,IT>::Iterator
+   BlockCompressedMatrix<Type,R,C,IT>::end( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t k( end_[i/R] );
+   return Iterator( blocks_+k, index_+k, i%R, 0UL, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline typename BlockCompressedMatrix<Type,R,C,IT>::ConstIterator
+   BlockCompressedMatrix<Type,R,C,IT>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t k( end_[i/R] );
+   return ConstIterator( blocks_+k, index_+k, i%R, 0UL, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline typename BlockCompressedMatrix<Type,R,C,IT>::ConstIterator
+   BlockCompressedMatrix<Type,R,C,IT>::cend( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t k( end_[i/R] );
+   return ConstIterator( blocks_+k, index_+k, i%R, 0UL, n_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for BlockCompressedMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+//
+// The sparse matrix is resized according to the given sparse matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline BlockCompressedMatrix<Type,R,C,IT>&
+   BlockCompressedMatrix<Type,R,C,IT>::operator=( const BlockCompressedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   BlockCompressedMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense and sparse matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The sparse matrix is resized according to the given matrix and initialized as a copy of
+// this matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO >      // Storage order of the right-hand side matrix
+inline BlockCompressedMatrix<Type,R,C,IT>&
+   BlockCompressedMatrix<Type,R,C,IT>::operator=( const Matrix<MT,SO>& rhs )
+{
+   BlockCompressedMatrix tmp( ~rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a sparse matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t R          // Number of rows per block
+        , size_t C          // Number of columns per block
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, BlockCompressedMatrix<Type,R,C,IT> >::Type&
+   BlockCompressedMatrix<Type,R,C,IT>::operator*=( Other rhs )
+{
+   for( size_t bi=0UL; bi<mb_; ++bi )
+      for( size_t k=begin_[bi]; k<end_[bi]; ++k )
+         blocks_[k] *= rhs;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a sparse matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t R          // Number of rows per block
+        , size_t C          // Number of columns per block
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, BlockCompressedMatrix<Type,R,C,IT> >::Type&
+   BlockCompressedMatrix<Type,R,C,IT>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   for( size_t bi=0UL; bi<mb_; ++bi )
+      for( size_t k=begin_[bi]; k<end_[bi]; ++k )
+         blocks_[k] /= rhs;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of block rows of the sparse matrix.
+//
+// \return The number of block rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::blockRows() const
+{
+   return mb_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of block columns of the sparse matrix.
+//
+// \return The number of block columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::blockColumns() const
+{
+   return nb_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+//
+// The capacity of the matrix corresponds to the number of elements of all reserved blocks.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::capacity() const
+{
+   return capacity_*R*C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row.
+//
+// \param i The index of the row.
+// \return The current capacity of row \a i.
+//
+// The capacity of a row corresponds to the number of columns of all non-zero blocks of its
+// block row.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::capacity( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return ( end_[i/R] - begin_[i/R] ) * C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+//
+// All elements of the non-zero blocks within the bounds of the matrix are counted, including
+// explicit zeros.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t bi=0UL; bi<mb_; ++bi ) {
+      nonzeros += nonZeros( bi*R ) * min( R, m_ - bi*R );
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t bi( i/R );
+
+   if( begin_[bi] == end_[bi] )
+      return 0UL;
+
+   const size_t last( static_cast<size_t>( index_[end_[bi]-1UL] )*C );
+   return ( end_[bi] - begin_[bi] ) * C - ( ( last + C > n_ )?( last + C - n_ ):( 0UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero blocks in the sparse matrix
+//
+// \return The number of non-zero blocks in the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::nonZeroBlocks() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t bi=0UL; bi<mb_; ++bi ) {
+      nonzeros += end_[bi] - begin_[bi];
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero blocks in the specified block row.
+//
+// \param bi The index of the block row.
+// \return The number of non-zero blocks of block row \a bi.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::nonZeroBlocks( size_t bi ) const
+{
+   BLAZE_USER_ASSERT( bi < blockRows(), "Invalid block row access index" );
+   return end_[bi] - begin_[bi];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function removes all non-zero blocks from the matrix. Note that the size and the
+// capacity of the matrix remain unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline void BlockCompressedMatrix<Type,R,C,IT>::reset()
+{
+   std::fill( begin_, begin_+2UL*mb_+2UL, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row to the default initial values.
+//
+// \param i The index of the row to be resetted.
+// \return void
+//
+// This function resets the values in the specified row to their default value. Since the
+// non-zero blocks are shared by all rows of a block row, the elements remain stored as
+// explicit zeros.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline void BlockCompressedMatrix<Type,R,C,IT>::reset( size_t i )
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   for( size_t k=begin_[i/R]; k<end_[i/R]; ++k )
+      for( size_t j=0UL; j<C; ++j )
+         blocks_[k](i%R,j) = Type();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline void BlockCompressedMatrix<Type,R,C,IT>::clear()
+{
+   BlockCompressedMatrix tmp;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the sparse matrix.
+//
+// \param nonzeroBlocks The new minimum number of non-zero blocks of the sparse matrix.
+// \return void
+//
+// This function increases the capacity of the sparse matrix to at least \a nonzeroBlocks
+// blocks. The current non-zero blocks of the matrix are preserved.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+void BlockCompressedMatrix<Type,R,C,IT>::reserve( size_t nonzeroBlocks )
+{
+   if( nonzeroBlocks <= capacity_ )
+      return;
+
+   IT*        index ( allocate<IT>( nonzeroBlocks ) );
+   BlockType* blocks( allocate<BlockType>( nonzeroBlocks ) );
+
+   std::copy( index_ , index_ +capacity_, index  );
+   std::copy( blocks_, blocks_+capacity_, blocks );
+
+   std::swap( index_ , index  );
+   std::swap( blocks_, blocks );
+   capacity_ = nonzeroBlocks;
+
+   deallocate( index  );
+   deallocate( blocks );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the sparse matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the sparse matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t R          // Number of rows per block
+        , size_t C          // Number of columns per block
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the scalar value
+inline BlockCompressedMatrix<Type,R,C,IT>& BlockCompressedMatrix<Type,R,C,IT>::scale( const Other& scalar )
+{
+   for( size_t bi=0UL; bi<mb_; ++bi )
+      for( size_t k=begin_[bi]; k<end_[bi]; ++k )
+         blocks_[k] *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline void BlockCompressedMatrix<Type,R,C,IT>::swap( BlockCompressedMatrix& sm ) /* throw() */
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( mb_, sm.mb_ );
+   std::swap( nb_, sm.nb_ );
+   std::swap( capacity_, sm.capacity_ );
+   std::swap( begin_, sm.begin_ );
+   std::swap( end_, sm.end_ );
+   std::swap( index_, sm.index_ );
+   std::swap( blocks_, sm.blocks_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking whether the number of block columns can be represented by the index type.
+//
+// \param n The number of columns of the matrix.
+// \return The given number \a n.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::checkIndexRange( size_t n )
+{
+   if( n > 0UL && (n-1UL)/C > static_cast<size_t>( std::numeric_limits<IT>::max() ) )
+      throw std::invalid_argument( "Matrix size exceeds the range of the index type" );
+   return n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting up the non-zero blocks of the matrix from a row-major sparse matrix.
+//
+// \param sm The row-major sparse matrix to be converted.
+// \return void
+//
+// This function determines the non-zero blocks of each block row, i.e. all blocks containing
+// at least one non-zero element of the given matrix, and copies the non-zero elements into
+// these blocks.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+template< typename MT >  // Type of the foreign sparse matrix
+void BlockCompressedMatrix<Type,R,C,IT>::initialize( const SparseMatrix<MT,false>& sm )
+{
+   typedef typename MT::CompositeType                         CT;
+   typedef typename RemoveReference<CT>::Type::ConstIterator  RhsIterator;
+
+   CT A( ~sm );  // Evaluation of the sparse matrix operand
+
+   BLAZE_INTERNAL_ASSERT( A.rows()    == m_, "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( A.columns() == n_, "Invalid number of columns" );
+
+   std::vector<size_t> marker( nb_, mb_ );  // The last block row touching each block column
+   std::vector<size_t> pos( nb_ );          // The position of each block of the current block row
+
+   // Counting the non-zero blocks
+   size_t nonzeros( 0UL );
+
+   for( size_t bi=0UL; bi<mb_; ++bi ) {
+      for( size_t i=bi*R; i<min( bi*R+R, m_ ); ++i ) {
+         for( RhsIterator element=A.begin(i); element!=A.end(i); ++element ) {
+            const size_t bj( element->index() / C );
+            if( marker[bj] != bi ) {
+               marker[bj] = bi;
+               ++nonzeros;
+            }
+         }
+      }
+   }
+
+   index_    = allocate<IT>( nonzeros );
+   blocks_   = allocate<BlockType>( nonzeros );
+   capacity_ = nonzeros;
+
+   // Determining the non-zero blocks of each block row and copying the elements
+   std::fill( marker.begin(), marker.end(), mb_ );
+   size_t k( 0UL );
+
+   for( size_t bi=0UL; bi<mb_; ++bi )
+   {
+      const size_t iend( min( bi*R+R, m_ ) );
+
+      begin_[bi] = k;
+
+      for( size_t i=bi*R; i<iend; ++i ) {
+         for( RhsIterator element=A.begin(i); element!=A.end(i); ++element ) {
+            const size_t bj( element->index() / C );
+            if( marker[bj] != bi ) {
+               marker[bj] = bi;
+               index_[k++] = static_cast<IT>( bj );
+            }
+         }
+      }
+
+      end_[bi] = k;
+
+      std::sort( index_+begin_[bi], index_+end_[bi] );
+
+      for( size_t l=begin_[bi]; l<end_[bi]; ++l ) {
+         pos[index_[l]] = l;
+      }
+
+      for( size_t i=bi*R; i<iend; ++i ) {
+         for( RhsIterator element=A.begin(i); element!=A.end(i); ++element ) {
+            const size_t j( element->index() );
+            blocks_[pos[j/C]](i-bi*R,j%C) = element->value();
+         }
+      }
+   }
+
+   begin_[mb_] = end_[mb_] = k;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting up the non-zero blocks of the matrix from an arbitrary dense or sparse matrix.
+//
+// \param m The matrix to be converted.
+// \return void
+//
+// The given matrix is first converted into a row-major compressed matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+template< typename MT    // Type of the foreign matrix
+        , bool SO >      // Storage order of the foreign matrix
+void BlockCompressedMatrix<Type,R,C,IT>::initialize( const Matrix<MT,SO>& m )
+{
+   const CompressedMatrix<Type,false> tmp( ~m );
+   initialize( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// All elements of the non-zero blocks are found, including explicit zeros.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline typename BlockCompressedMatrix<Type,R,C,IT>::Iterator
+   BlockCompressedMatrix<Type,R,C,IT>::find( size_t i, size_t j )
+{
+   const Iterator pos( lowerBound( i, j ) );
+
+   if( pos != end( i ) && pos->index() == j )
+      return pos;
+   else return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// All elements of the non-zero blocks are found, including explicit zeros.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline typename BlockCompressedMatrix<Type,R,C,IT>::ConstIterator
+   BlockCompressedMatrix<Type,R,C,IT>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+
+   if( pos != end( i ) && pos->index() == j )
+      return pos;
+   else return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline typename BlockCompressedMatrix<Type,R,C,IT>::Iterator
+   BlockCompressedMatrix<Type,R,C,IT>::lowerBound( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( lowerBoundBlock( i/R, j/C ) );
+   const size_t col( ( k != end_[i/R] && static_cast<size_t>( index_[k] ) == j/C )?( j%C ):( 0UL ) );
+
+   return Iterator( blocks_+k, index_+k, i%R, col, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline typename BlockCompressedMatrix<Type,R,C,IT>::ConstIterator
+   BlockCompressedMatrix<Type,R,C,IT>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( lowerBoundBlock( i/R, j/C ) );
+   const size_t col( ( k != end_[i/R] && static_cast<size_t>( index_[k] ) == j/C )?( j%C ):( 0UL ) );
+
+   return ConstIterator( blocks_+k, index_+k, i%R, col, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline typename BlockCompressedMatrix<Type,R,C,IT>::Iterator
+   BlockCompressedMatrix<Type,R,C,IT>::upperBound( size_t i, size_t j )
+{
+   if( j+1UL < n_ )
+      return lowerBound( i, j+1UL );
+   else return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline typename BlockCompressedMatrix<Type,R,C,IT>::ConstIterator
+   BlockCompressedMatrix<Type,R,C,IT>::upperBound( size_t i, size_t j ) const
+{
+   if( j+1UL < n_ )
+      return lowerBound( i, j+1UL );
+   else return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for the first non-zero block of a block row not left of the given block column.
+//
+// \param bi The index of the block row.
+// \param bj The index of the block column.
+// \return Offset of the first non-zero block not left of block column \a bj.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::lowerBoundBlock( size_t bi, size_t bj ) const
+{
+   return std::lower_bound( index_+begin_[bi], index_+end_[bi], static_cast<IT>( bj ) ) - index_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Appending a non-zero block to the specified block row of the sparse matrix.
+//
+// \param bi The block row index of the new block. The index has to be in the range \f$[0..MB-1]\f$.
+// \param bj The block column index of the new block. The index has to be in the range \f$[0..NB-1]\f$.
+// \param block The \f$ R \times C \f$ dense block to be appended.
+// \return void
+//
+// This function provides a very efficient way to fill a block compressed matrix block by block.
+// However, it has some preconditions: the block has to be appended to the last block row that
+// has not yet been finalized, the block column index has to be greater than the indices of all
+// previously appended blocks of the block row, and the capacity of the matrix has to suffice
+// for the new block. After all blocks of a block row have been appended, the block row has to
+// be finalized via the finalizeBlockRow() function:
+
+   \code
+   blaze::BlockCompressedMatrix<double,2UL,2UL> A( 4UL, 6UL, 3UL );  // Capacity for 3 blocks
+   blaze::StaticMatrix<double,2UL,2UL> B( 1.0 );
+
+   A.appendBlock( 0UL, 0UL, B );  // Appending the block (0,0)
+   A.appendBlock( 0UL, 2UL, B );  // Appending the block (0,2)
+   A.finalizeBlockRow( 0UL );     // Finalizing block row 0
+   A.appendBlock( 1UL, 1UL, B );  // Appending the block (1,1)
+   A.finalizeBlockRow( 1UL );     // Finalizing block row 1
+   \endcode
+
+// Elements of blocks of the last block row or column that lie outside of the matrix are not
+// accessible.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+template< typename MT    // Type of the dense block
+        , bool SO >      // Storage order of the dense block
+inline void BlockCompressedMatrix<Type,R,C,IT>::appendBlock( size_t bi, size_t bj, const DenseMatrix<MT,SO>& block )
+{
+   BLAZE_USER_ASSERT( bi < mb_, "Invalid block row access index"    );
+   BLAZE_USER_ASSERT( bj < nb_, "Invalid block column access index" );
+   BLAZE_USER_ASSERT( end_[bi] < capacity_, "Not enough reserved capacity left" );
+   BLAZE_USER_ASSERT( begin_[bi] == end_[bi] || bj > static_cast<size_t>( index_[end_[bi]-1UL] ), "Index order violation" );
+   BLAZE_USER_ASSERT( (~block).rows() == R && (~block).columns() == C, "Invalid block size" );
+
+   index_ [end_[bi]] = static_cast<IT>( bj );
+   blocks_[end_[bi]] = ~block;
+   ++end_[bi];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the non-zero blocks of the specified block row.
+//
+// \param bi The index of the block row to be finalized \f$[0..MB-1]\f$.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill the matrix with
+// non-zero blocks. After completion of block row \a bi via the appendBlock() function,
+// this function can be called to finalize block row \a bi and prepare the next block
+// row for the insertion process via appendBlock().
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline void BlockCompressedMatrix<Type,R,C,IT>::finalizeBlockRow( size_t bi )
+{
+   BLAZE_USER_ASSERT( bi < mb_, "Invalid block row access index" );
+
+   begin_[bi+1UL] = end_[bi+1UL] = end_[bi];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the first non-zero block of the specified block row.
+//
+// \param bi The index of the block row.
+// \return Offset of the first non-zero block of block row \a bi.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::blockBegin( size_t bi ) const
+{
+   BLAZE_USER_ASSERT( bi < mb_, "Invalid block row access index" );
+   return begin_[bi];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset one past the last non-zero block of the specified block row.
+//
+// \param bi The index of the block row.
+// \return Offset one past the last non-zero block of block row \a bi.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::blockEnd( size_t bi ) const
+{
+   BLAZE_USER_ASSERT( bi < mb_, "Invalid block row access index" );
+   return end_[bi];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the block column index of the specified non-zero block.
+//
+// \param k The offset of the non-zero block.
+// \return The block column index of block \a k.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::blockIndex( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k < capacity_, "Invalid block access index" );
+   return index_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the specified non-zero block.
+//
+// \param k The offset of the non-zero block.
+// \return Reference to block \a k.
+//
+// Elements of the block that lie outside of the matrix are never accessed by the matrix and
+// should remain zero.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline typename BlockCompressedMatrix<Type,R,C,IT>::BlockType&
+   BlockCompressedMatrix<Type,R,C,IT>::block( size_t k )
+{
+   BLAZE_USER_ASSERT( k < capacity_, "Invalid block access index" );
+   return blocks_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the specified non-zero block.
+//
+// \param k The offset of the non-zero block.
+// \return Reference to block \a k.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline const typename BlockCompressedMatrix<Type,R,C,IT>::BlockType&
+   BlockCompressedMatrix<Type,R,C,IT>::block( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k < capacity_, "Invalid block access index" );
+   return blocks_[k];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t R          // Number of rows per block
+        , size_t C          // Number of columns per block
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockCompressedMatrix<Type,R,C,IT>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , size_t R          // Number of rows per block
+        , size_t C          // Number of columns per block
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockCompressedMatrix<Type,R,C,IT>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline bool BlockCompressedMatrix<Type,R,C,IT>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCKCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BlockCompressedMatrix operators */
+//@{
+template< typename Type, size_t R, size_t C, typename IT >
+inline void reset( BlockCompressedMatrix<Type,R,C,IT>& m );
+
+template< typename Type, size_t R, size_t C, typename IT >
+inline void reset( BlockCompressedMatrix<Type,R,C,IT>& m, size_t i );
+
+template< typename Type, size_t R, size_t C, typename IT >
+inline void clear( BlockCompressedMatrix<Type,R,C,IT>& m );
+
+template< typename Type, size_t R, size_t C, typename IT >
+inline bool isDefault( const BlockCompressedMatrix<Type,R,C,IT>& m );
+
+template< typename Type, size_t R, size_t C, typename IT >
+inline void swap( BlockCompressedMatrix<Type,R,C,IT>& a, BlockCompressedMatrix<Type,R,C,IT>& b ) /* throw() */;
+
+template< typename Type, size_t R, size_t C, typename IT >
+inline void move( BlockCompressedMatrix<Type,R,C,IT>& dst, BlockCompressedMatrix<Type,R,C,IT>& src ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given block compressed matrix.
+// \ingroup block_compressed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline void reset( BlockCompressedMatrix<Type,R,C,IT>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row of the given block compressed matrix.
+// \ingroup block_compressed_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row to be resetted.
+// \return void
+//
+// This function resets the values in the specified row of the given block compressed matrix
+// to their default value. Note that the non-zero blocks of the matrix remain unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline void reset( BlockCompressedMatrix<Type,R,C,IT>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given block compressed matrix.
+// \ingroup block_compressed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline void clear( BlockCompressedMatrix<Type,R,C,IT>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given block compressed matrix is in default state.
+// \ingroup block_compressed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the block compressed matrix is in default (constructed) state,
+// i.e. if it's number of rows and columns is 0. In case it is in default state, the function
+// returns \a true, else it will return \a false.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline bool isDefault( const BlockCompressedMatrix<Type,R,C,IT>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two block compressed matrices.
+// \ingroup block_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline void swap( BlockCompressedMatrix<Type,R,C,IT>& a, BlockCompressedMatrix<Type,R,C,IT>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving the contents of one block compressed matrix to another.
+// \ingroup block_compressed_matrix
+//
+// \param dst The destination matrix.
+// \param src The source matrix.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Index type
+inline void move( BlockCompressedMatrix<Type,R,C,IT>& dst, BlockCompressedMatrix<Type,R,C,IT>& src ) /* throw() */
+{
+   dst.swap( src );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASBLOCKSTORAGE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t R, size_t C, typename IT >
+struct HasBlockStorage< BlockCompressedMatrix<T,R,C,IT> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+
+template< typename T, size_t R, size_t C, typename IT, bool AF >
+struct HasBlockStorage< SparseSubmatrix<BlockCompressedMatrix<T,R,C,IT>,AF,false> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+
+template< typename T, size_t R, size_t C, typename IT, bool AF >
+struct HasBlockStorage< SparseSubmatrix<const BlockCompressedMatrix<T,R,C,IT>,AF,false> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t R, size_t C, typename IT, typename T2, bool SO >
+struct AddTrait< BlockCompressedMatrix<T1,R,C,IT>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t R, size_t C, typename IT >
+struct AddTrait< DynamicMatrix<T1,SO>, BlockCompressedMatrix<T2,R,C,IT> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t R, size_t C, typename IT1, typename T2, bool SO, typename IT2 >
+struct AddTrait< BlockCompressedMatrix<T1,R,C,IT1>, CompressedMatrix<T2,SO,IT2> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename IT1, typename T2, size_t R, size_t C, typename IT2 >
+struct AddTrait< CompressedMatrix<T1,SO,IT1>, BlockCompressedMatrix<T2,R,C,IT2> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t R, size_t C, typename IT1, typename T2, typename IT2 >
+struct AddTrait< BlockCompressedMatrix<T1,R,C,IT1>, BlockCompressedMatrix<T2,R,C,IT2> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type, false >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t R, size_t C, typename IT, typename T2, bool SO >
+struct SubTrait< BlockCompressedMatrix<T1,R,C,IT>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t R, size_t C, typename IT >
+struct SubTrait< DynamicMatrix<T1,SO>, BlockCompressedMatrix<T2,R,C,IT> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t R, size_t C, typename IT1, typename T2, bool SO, typename IT2 >
+struct SubTrait< BlockCompressedMatrix<T1,R,C,IT1>, CompressedMatrix<T2,SO,IT2> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename IT1, typename T2, size_t R, size_t C, typename IT2 >
+struct SubTrait< CompressedMatrix<T1,SO,IT1>, BlockCompressedMatrix<T2,R,C,IT2> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t R, size_t C, typename IT1, typename T2, typename IT2 >
+struct SubTrait< BlockCompressedMatrix<T1,R,C,IT1>, BlockCompressedMatrix<T2,R,C,IT2> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type, false >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t R, size_t C, typename IT, typename T2 >
+struct MultTrait< BlockCompressedMatrix<T1,R,C,IT>, T2 >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false, IT >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+
+template< typename T1, typename T2, size_t R, size_t C, typename IT >
+struct MultTrait< T1, BlockCompressedMatrix<T2,R,C,IT> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false, IT >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
+};
+
+template< typename T1, size_t R, size_t C, typename IT, typename T2, size_t N >
+struct MultTrait< BlockCompressedMatrix<T1,R,C,IT>, StaticVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, size_t R, size_t C, typename IT >
+struct MultTrait< StaticVector<T1,N,true>, BlockCompressedMatrix<T2,R,C,IT> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, size_t R, size_t C, typename IT, typename T2, size_t N >
+struct MultTrait< BlockCompressedMatrix<T1,R,C,IT>, HybridVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, size_t R, size_t C, typename IT >
+struct MultTrait< HybridVector<T1,N,true>, BlockCompressedMatrix<T2,R,C,IT> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, size_t R, size_t C, typename IT, typename T2 >
+struct MultTrait< BlockCompressedMatrix<T1,R,C,IT>, DynamicVector<T2,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2, size_t R, size_t C, typename IT >
+struct MultTrait< DynamicVector<T1,true>, BlockCompressedMatrix<T2,R,C,IT> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, size_t R, size_t C, typename IT1, typename T2, typename IT2 >
+struct MultTrait< BlockCompressedMatrix<T1,R,C,IT1>, CompressedVector<T2,false,IT2> >
+{
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename IT1, typename T2, size_t R, size_t C, typename IT2 >
+struct MultTrait< CompressedVector<T1,true,IT1>, BlockCompressedMatrix<T2,R,C,IT2> >
+{
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, size_t R, size_t C, typename IT, typename T2, bool SO >
+struct MultTrait< BlockCompressedMatrix<T1,R,C,IT>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t R, size_t C, typename IT >
+struct MultTrait< DynamicMatrix<T1,SO>, BlockCompressedMatrix<T2,R,C,IT> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t R, size_t C, typename IT1, typename T2, bool SO, typename IT2 >
+struct MultTrait< BlockCompressedMatrix<T1,R,C,IT1>, CompressedMatrix<T2,SO,IT2> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename IT1, typename T2, size_t R, size_t C, typename IT2 >
+struct MultTrait< CompressedMatrix<T1,SO,IT1>, BlockCompressedMatrix<T2,R,C,IT2> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, size_t R, size_t C, typename IT1, typename T2, typename IT2 >
+struct MultTrait< BlockCompressedMatrix<T1,R,C,IT1>, BlockCompressedMatrix<T2,R,C,IT2> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t R, size_t C, typename IT, typename T2 >
+struct DivTrait< BlockCompressedMatrix<T1,R,C,IT>, T2 >
+{
+   typedef CompressedMatrix< typename DivTrait<T1,T2>::Type, false, IT >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATHTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t R, size_t C, typename IT1, typename T2, typename IT2 >
+struct MathTrait< BlockCompressedMatrix<T1,R,C,IT1>, BlockCompressedMatrix<T2,R,C,IT2> >
+{
+   typedef BlockCompressedMatrix< typename MathTrait<T1,T2>::HighType, R, C >  HighType;
+   typedef BlockCompressedMatrix< typename MathTrait<T1,T2>::LowType, R, C  >  LowType;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t R, size_t C, typename IT >
+struct SubmatrixTrait< BlockCompressedMatrix<T1,R,C,IT> >
+{
+   typedef CompressedMatrix<T1,false,IT>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t R, size_t C, typename IT >
+struct RowTrait< BlockCompressedMatrix<T1,R,C,IT> >
+{
+   typedef CompressedVector<T1,true,IT>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, size_t R, size_t C, typename IT >
+struct ColumnTrait< BlockCompressedMatrix<T1,R,C,IT> >
+{
+   typedef CompressedVector<T1,false,IT>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -42,6 +42,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <limits>
 #include <stdexcept>
 #include <vector>
 #include <blaze/math/constraints/Symmetric.h>
@@ -103,11 +104,11 @@ namespace blaze {
 //
 // The CompressedMatrix class template is the representation of an arbitrary sized sparse
 // matrix with \f$ M \cdot N \f$ dynamically allocated elements of arbitrary type. The type
-// of the elements and the storage order of the matrix can be specified via the two template
-// parameters:
+// of the elements, the storage order of the matrix, and the type of the stored indices can be
+// specified via the three template parameters:
 
    \code
-   template< typename Type, bool SO >
+   template< typename Type, bool SO, typename IT >
    class CompressedMatrix;
    \endcode
 
@@ -115,6 +116,14 @@ namespace blaze {
 //          any non-cv-qualified, non-reference, non-pointer element type.
 //  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
 //          The default value is blaze::rowMajor.
+//  - IT  : specifies the unsigned integral type used to store the column index (row-major) or
+//          the row index (column-major) of each non-zero element. The default value is \a size_t.
+//          A narrower type such as \a uint32_t or \a uint16_t reduces the memory footprint of
+//          each element and therefore the memory traffic of all sparse kernels, provided that
+//          the element type does not pad the value/index pair back to its original size (for
+//          instance \a float values with \a uint32_t indices require 8 instead of 16 bytes,
+//          whereas \a double values still require 16 bytes). The number of columns (row-major)
+//          or rows (column-major) must not exceed the range of this type.
 //
 // Inserting/accessing elements in a compressed matrix can be done by several alternative
 // functions. The following example demonstrates all options:
@@ -205,12 +214,13 @@ namespace blaze {
    \endcode
 */
 template< typename Type                    // Data type of the sparse matrix
-        , bool SO = defaultStorageOrder >  // Storage order
-class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
+        , bool SO = defaultStorageOrder    // Storage order
+        , typename IT >                    // Index type
+class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO,IT>, SO >
 {
  private:
    //**Type definitions****************************************************************************
-   typedef ValueIndexPair<Type>  ElementBase;  //!< Base class for the sparse matrix element.
+   typedef ValueIndexPair<Type,IT>  ElementBase;  //!< Base class for the sparse matrix element.
    //**********************************************************************************************
 
    //**Private class Element***********************************************************************
@@ -254,17 +264,17 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
 
  public:
    //**Type definitions****************************************************************************
-   typedef CompressedMatrix<Type,SO>   This;            //!< Type of this CompressedMatrix instance.
-   typedef This                        ResultType;      //!< Result type for expression template evaluations.
-   typedef CompressedMatrix<Type,!SO>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
-   typedef CompressedMatrix<Type,!SO>  TransposeType;   //!< Transpose type for expression template evaluations.
-   typedef Type                        ElementType;     //!< Type of the sparse matrix elements.
-   typedef const Type&                 ReturnType;      //!< Return type for expression template evaluations.
-   typedef const This&                 CompositeType;   //!< Data type for composite expression templates.
-   typedef MatrixAccessProxy<This>     Reference;       //!< Reference to a sparse matrix value.
-   typedef const Type&                 ConstReference;  //!< Reference to a constant sparse matrix value.
-   typedef Element*                    Iterator;        //!< Iterator over non-constant elements.
-   typedef const Element*              ConstIterator;   //!< Iterator over constant elements.
+   typedef CompressedMatrix<Type,SO,IT>   This;            //!< Type of this CompressedMatrix instance.
+   typedef This                           ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,!SO,IT>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,!SO,IT>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                           ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                    ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                    CompositeType;   //!< Data type for composite expression templates.
+   typedef MatrixAccessProxy<This>        Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                    ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef Element*                       Iterator;        //!< Iterator over non-constant elements.
+   typedef const Element*                 ConstIterator;   //!< Iterator over constant elements.
    //**********************************************************************************************
 
    //**Rebind struct definition********************************************************************
@@ -272,7 +282,7 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
    */
    template< typename ET >  // Data type of the other matrix
    struct Rebind {
-      typedef CompressedMatrix<ET,SO>  Other;  //!< The type of the other CompressedMatrix.
+      typedef CompressedMatrix<ET,SO,IT>  Other;  //!< The type of the other CompressedMatrix.
    };
    //**********************************************************************************************
 
@@ -412,6 +422,8 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
           Iterator insert( Iterator pos, size_t i, size_t j, const Type& value );
    inline size_t   extendCapacity() const;
           void     reserveElements( size_t nonzeros );
+
+   static inline size_t checkIndexRange( size_t n );
    //@}
    //**********************************************************************************************
 
@@ -449,8 +461,8 @@ class CompressedMatrix : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
 //
 //=================================================================================================
 
-template< typename Type, bool SO >
-const Type CompressedMatrix<Type,SO>::zero_ = Type();
+template< typename Type, bool SO, typename IT >
+const Type CompressedMatrix<Type,SO,IT>::zero_ = Type();
 
 
 
@@ -465,8 +477,9 @@ const Type CompressedMatrix<Type,SO>::zero_ = Type();
 /*!\brief The default constructor for CompressedMatrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix()
    : m_       ( 0UL )           // The current number of rows of the sparse matrix
    , n_       ( 0UL )           // The current number of columns of the sparse matrix
    , capacity_( 0UL )           // The current capacity of the pointer array
@@ -487,10 +500,11 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix()
 // The matrix is initialized to the zero matrix and has no free capacity.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( size_t m, size_t n )
    : m_       ( m )                     // The current number of rows of the sparse matrix
-   , n_       ( n )                     // The current number of columns of the sparse matrix
+   , n_       ( checkIndexRange( n ) )  // The current number of columns of the sparse matrix
    , capacity_( m )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*m+2UL] )  // Pointers to the first non-zero element of each row
    , end_  ( begin_+(m+1UL) )           // Pointers one past the last non-zero element of each row
@@ -511,10 +525,11 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n )
 // The matrix is initialized to the zero matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
    : m_       ( m )                     // The current number of rows of the sparse matrix
-   , n_       ( n )                     // The current number of columns of the sparse matrix
+   , n_       ( checkIndexRange( n ) )  // The current number of columns of the sparse matrix
    , capacity_( m )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*m+2UL] )  // Pointers to the first non-zero element of each row
    , end_  ( begin_+(m+1UL) )           // Pointers one past the last non-zero element of each row
@@ -539,10 +554,11 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, size_t n
 // \a m elements, in case of a column-major matrix at least \a n elements.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+CompressedMatrix<Type,SO,IT>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
    : m_       ( m )                      // The current number of rows of the sparse matrix
-   , n_       ( n )                      // The current number of columns of the sparse matrix
+   , n_       ( checkIndexRange( n ) )   // The current number of columns of the sparse matrix
    , capacity_( m )                      // The current capacity of the pointer array
    , begin_( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
    , end_  ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
@@ -567,8 +583,9 @@ CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vect
 // \param sm Sparse matrix to be copied.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( const CompressedMatrix& sm )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( const CompressedMatrix& sm )
    : m_       ( sm.m_ )                     // The current number of rows of the sparse matrix
    , n_       ( sm.n_ )                     // The current number of columns of the sparse matrix
    , capacity_( sm.m_ )                     // The current capacity of the pointer array
@@ -591,15 +608,16 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const CompressedMatrix& sm )
 // \param dm Dense matrix to be copied.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the foreign dense matrix
         , bool SO2 >     // Storage order of the foreign dense matrix
-inline CompressedMatrix<Type,SO>::CompressedMatrix( const DenseMatrix<MT,SO2>& dm )
-   : m_       ( (~dm).rows() )              // The current number of rows of the sparse matrix
-   , n_       ( (~dm).columns() )           // The current number of columns of the sparse matrix
-   , capacity_( m_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
-   , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( const DenseMatrix<MT,SO2>& dm )
+   : m_       ( (~dm).rows() )                        // The current number of rows of the sparse matrix
+   , n_       ( checkIndexRange( (~dm).columns() ) )  // The current number of columns of the sparse matrix
+   , capacity_( m_ )                                  // The current capacity of the pointer array
+   , begin_   ( new Iterator[2UL*m_+2UL] )            // Pointers to the first non-zero element of each row
+   , end_     ( begin_+(m_+1UL) )                     // Pointers one past the last non-zero element of each row
 {
    using blaze::assign;
 
@@ -617,15 +635,16 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const DenseMatrix<MT,SO2>& d
 // \param sm Sparse matrix to be copied.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the foreign sparse matrix
         , bool SO2 >     // Storage order of the foreign sparse matrix
-inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>& sm )
-   : m_       ( (~sm).rows() )              // The current number of rows of the sparse matrix
-   , n_       ( (~sm).columns() )           // The current number of columns of the sparse matrix
-   , capacity_( m_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
-   , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( const SparseMatrix<MT,SO2>& sm )
+   : m_       ( (~sm).rows() )                        // The current number of rows of the sparse matrix
+   , n_       ( checkIndexRange( (~sm).columns() ) )  // The current number of columns of the sparse matrix
+   , capacity_( m_ )                                  // The current capacity of the pointer array
+   , begin_   ( new Iterator[2UL*m_+2UL] )            // Pointers to the first non-zero element of each row
+   , end_     ( begin_+(m_+1UL) )                     // Pointers one past the last non-zero element of each row
 {
    using blaze::assign;
 
@@ -653,8 +672,9 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>&
 /*!\brief The destructor for CompressedMatrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::~CompressedMatrix()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::~CompressedMatrix()
 {
    deallocate( begin_[0UL] );
    delete [] begin_;
@@ -678,9 +698,10 @@ inline CompressedMatrix<Type,SO>::~CompressedMatrix()
 // \return Reference to the accessed value.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Reference
-   CompressedMatrix<Type,SO>::operator()( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Reference
+   CompressedMatrix<Type,SO,IT>::operator()( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -698,9 +719,10 @@ inline typename CompressedMatrix<Type,SO>::Reference
 // \return Reference to the accessed value.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstReference
-   CompressedMatrix<Type,SO>::operator()( size_t i, size_t j ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstReference
+   CompressedMatrix<Type,SO,IT>::operator()( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -727,9 +749,10 @@ inline typename CompressedMatrix<Type,SO>::ConstReference
 // returns an iterator to the first non-zero element of column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::begin( size_t i )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::begin( size_t i )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return begin_[i];
@@ -749,9 +772,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // returns an iterator to the first non-zero element of column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::begin( size_t i ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::begin( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return begin_[i];
@@ -771,9 +795,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // returns an iterator to the first non-zero element of column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::cbegin( size_t i ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::cbegin( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return begin_[i];
@@ -793,9 +818,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // the function returns an iterator just past the last non-zero element of column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::end( size_t i )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::end( size_t i )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return end_[i];
@@ -815,9 +841,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // the function returns an iterator just past the last non-zero element of column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::end( size_t i ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::end( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return end_[i];
@@ -837,9 +864,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // the function returns an iterator just past the last non-zero element of column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::cend( size_t i ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::cend( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
    return end_[i];
@@ -865,9 +893,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // copy of this matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( const CompressedMatrix& rhs )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator=( const CompressedMatrix& rhs )
 {
    if( &rhs == this ) return *this;
 
@@ -914,11 +943,12 @@ inline CompressedMatrix<Type,SO>&
 // copy of this matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( const DenseMatrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator=( const DenseMatrix<MT,SO2>& rhs )
 {
    using blaze::assign;
 
@@ -946,11 +976,12 @@ inline CompressedMatrix<Type,SO>&
 // copy of this matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side sparse matrix
         , bool SO2 >     // Storage order of the right-hand side sparse matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( const SparseMatrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator=( const SparseMatrix<MT,SO2>& rhs )
 {
    using blaze::assign;
 
@@ -982,11 +1013,12 @@ inline CompressedMatrix<Type,SO>&
 // is thrown.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator+=( const Matrix<MT,SO2>& rhs )
 {
    using blaze::addAssign;
 
@@ -1010,10 +1042,11 @@ inline CompressedMatrix<Type,SO>&
 // is thrown.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,IT>& CompressedMatrix<Type,SO,IT>::operator-=( const Matrix<MT,SO2>& rhs )
 {
    using blaze::subAssign;
 
@@ -1037,11 +1070,12 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::operator-=( const M
 // is thrown.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator*=( const Matrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator*=( const Matrix<MT,SO2>& rhs )
 {
    if( (~rhs).rows() != n_ )
       throw std::invalid_argument( "Matrix sizes do not match" );
@@ -1062,10 +1096,11 @@ inline CompressedMatrix<Type,SO>&
 // \return Reference to the sparse matrix.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO> >::Type&
-   CompressedMatrix<Type,SO>::operator*=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO,IT> >::Type&
+   CompressedMatrix<Type,SO,IT>::operator*=( Other rhs )
 {
    for( size_t i=0UL; i<m_; ++i ) {
       const Iterator last( end(i) );
@@ -1085,10 +1120,11 @@ inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO> >::Type&
 // \return Reference to the matrix.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO> >::Type&
-   CompressedMatrix<Type,SO>::operator/=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO,IT> >::Type&
+   CompressedMatrix<Type,SO,IT>::operator/=( Other rhs )
 {
    BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
 
@@ -1132,8 +1168,9 @@ inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,SO> >::Type&
 // \return The number of rows of the sparse matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::rows() const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::rows() const
 {
    return m_;
 }
@@ -1146,8 +1183,9 @@ inline size_t CompressedMatrix<Type,SO>::rows() const
 // \return The number of columns of the sparse matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::columns() const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::columns() const
 {
    return n_;
 }
@@ -1160,8 +1198,9 @@ inline size_t CompressedMatrix<Type,SO>::columns() const
 // \return The capacity of the sparse matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::capacity() const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::capacity() const
 {
    return end_[m_] - begin_[0UL];
 }
@@ -1180,8 +1219,9 @@ inline size_t CompressedMatrix<Type,SO>::capacity() const
 // of column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::capacity( size_t i ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::capacity( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return begin_[i+1UL] - begin_[i];
@@ -1195,8 +1235,9 @@ inline size_t CompressedMatrix<Type,SO>::capacity( size_t i ) const
 // \return The number of non-zero elements in the sparse matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::nonZeros() const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::nonZeros() const
 {
    size_t nonzeros( 0UL );
 
@@ -1220,8 +1261,9 @@ inline size_t CompressedMatrix<Type,SO>::nonZeros() const
 // the number of non-zero elements in column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::nonZeros( size_t i ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::nonZeros( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return end_[i] - begin_[i];
@@ -1235,8 +1277,9 @@ inline size_t CompressedMatrix<Type,SO>::nonZeros( size_t i ) const
 // \return void
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::reset()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::reset()
 {
    for( size_t i=0UL; i<m_; ++i )
       end_[i] = begin_[i];
@@ -1256,8 +1299,9 @@ inline void CompressedMatrix<Type,SO>::reset()
 // Note that the capacity of the row/column remains unchanged.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::reset( size_t i )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::reset( size_t i )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    end_[i] = begin_[i];
@@ -1273,8 +1317,9 @@ inline void CompressedMatrix<Type,SO>::reset( size_t i )
 // After the clear() function, the size of the sparse matrix is 0.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::clear()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::clear()
 {
    end_[0UL] = end_[m_];
    m_ = 0UL;
@@ -1296,9 +1341,10 @@ inline void CompressedMatrix<Type,SO>::clear()
 // modified, else a new element with the given \a value is inserted.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::set( size_t i, size_t j, const Type& value )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::set( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -1328,9 +1374,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // and column index \a j, a \a std::invalid_argument exception is thrown.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::insert( size_t i, size_t j, const Type& value )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::insert( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -1356,9 +1403,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // \exception std::invalid_argument Invalid compressed matrix access index.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::insert( Iterator pos, size_t i, size_t j, const Type& value )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::insert( Iterator pos, size_t i, size_t j, const Type& value )
 {
    if( begin_[i+1UL] - end_[i] != 0 ) {
       std::copy_backward( pos, end_[i], end_[i]+1 );
@@ -1432,8 +1480,9 @@ typename CompressedMatrix<Type,SO>::Iterator
 // This function erases an element from the sparse matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::erase( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::erase( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -1457,9 +1506,10 @@ inline void CompressedMatrix<Type,SO>::erase( size_t i, size_t j )
 // \a columnMajor the function erases an element from column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::erase( size_t i, Iterator pos )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::erase( size_t i, Iterator pos )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    BLAZE_USER_ASSERT( pos >= begin_[i] && pos <= end_[i], "Invalid compressed matrix iterator" );
@@ -1485,9 +1535,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // flag is set to \a columnMajor the function erases a range of elements from column \a i.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::erase( size_t i, Iterator first, Iterator last )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::erase( size_t i, Iterator first, Iterator last )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index" );
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
@@ -1509,6 +1560,7 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // \param n The new number of columns of the sparse matrix.
 // \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
 // \return void
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
 //
 // This function resizes the matrix using the given size to \f$ m \times n \f$. During this
 // operation, new dynamic memory may be allocated in case the capacity of the matrix is too
@@ -1518,9 +1570,12 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // \a preserve flag can be set to \a true.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void CompressedMatrix<Type,SO,IT>::resize( size_t m, size_t n, bool preserve )
 {
+   checkIndexRange( n );
+
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
    BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
 
@@ -1602,8 +1657,9 @@ void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 // are preserved.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::reserve( size_t nonzeros )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::reserve( size_t nonzeros )
 {
    if( nonzeros > capacity() )
       reserveElements( nonzeros );
@@ -1626,8 +1682,9 @@ inline void CompressedMatrix<Type,SO>::reserve( size_t nonzeros )
 // \a i and the index has to be in the range \f$[0..N-1]\f$.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void CompressedMatrix<Type,SO,IT>::reserve( size_t i, size_t nonzeros )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
 
@@ -1696,8 +1753,9 @@ void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
 // remove the overall capacity but only reduces the capacity per row/column.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::trim()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::trim()
 {
    for( size_t i=0UL; i<m_; ++i )
       trim( i );
@@ -1717,8 +1775,9 @@ inline void CompressedMatrix<Type,SO>::trim()
 // subsequent row/column.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::trim( size_t i )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::trim( size_t i )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
 
@@ -1735,8 +1794,9 @@ inline void CompressedMatrix<Type,SO>::trim( size_t i )
 // \return Reference to the transposed matrix.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::transpose()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>& CompressedMatrix<Type,SO,IT>::transpose()
 {
    CompressedMatrix tmp( trans( *this ) );
    swap( tmp );
@@ -1752,9 +1812,10 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::transpose()
 // \return Reference to the sparse matrix.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the scalar value
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scale( const Other& scalar )
+inline CompressedMatrix<Type,SO,IT>& CompressedMatrix<Type,SO,IT>::scale( const Other& scalar )
 {
    for( size_t i=0UL; i<m_; ++i )
       for( Iterator element=begin_[i]; element!=end_[i]; ++element )
@@ -1772,9 +1833,10 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scale( const Other&
 // \return Reference to the sparse matrix.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the scalar value
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scaleDiagonal( Other scalar )
+inline CompressedMatrix<Type,SO,IT>& CompressedMatrix<Type,SO,IT>::scaleDiagonal( Other scalar )
 {
    const size_t size( blaze::min( m_, n_ ) );
 
@@ -1797,8 +1859,9 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scaleDiagonal( Othe
 // \exception no-throw guarantee.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::swap( CompressedMatrix& sm ) /* throw() */
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::swap( CompressedMatrix& sm ) /* throw() */
 {
    std::swap( m_, sm.m_ );
    std::swap( n_, sm.n_ );
@@ -1818,8 +1881,9 @@ inline void CompressedMatrix<Type,SO>::swap( CompressedMatrix& sm ) /* throw() *
 // matrix. Note that the new capacity is restricted to the interval \f$[7..M \cdot N]\f$.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::extendCapacity() const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::extendCapacity() const
 {
    size_t nonzeros( 2UL*capacity()+1UL );
    nonzeros = blaze::max( nonzeros, 7UL   );
@@ -1831,6 +1895,30 @@ inline size_t CompressedMatrix<Type,SO>::extendCapacity() const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking whether all column indices of the matrix can be stored.
+//
+// \param n The number of columns of the compressed matrix.
+// \return The given number \a n.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// This function checks whether the largest column index of a matrix with \a n columns can be
+// represented by the index type \a IT. In case the number of columns exceeds the range of the
+// index type, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::checkIndexRange( size_t n )
+{
+   if( n > 0UL && n-1UL > static_cast<size_t>( std::numeric_limits<IT>::max() ) )
+      throw std::invalid_argument( "Matrix size exceeds the range of the index type" );
+
+   return n;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Reserving the specified number of sparse matrix elements.
 //
@@ -1838,8 +1926,9 @@ inline size_t CompressedMatrix<Type,SO>::extendCapacity() const
 // \return void
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-void CompressedMatrix<Type,SO>::reserveElements( size_t nonzeros )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void CompressedMatrix<Type,SO,IT>::reserveElements( size_t nonzeros )
 {
    Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
    Iterator* newEnd   = newBegin+capacity_+1UL;
@@ -1886,9 +1975,10 @@ void CompressedMatrix<Type,SO>::reserveElements( size_t nonzeros )
 // function!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::find( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::find( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).find( i, j ) );
 }
@@ -1911,9 +2001,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // function!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::find( size_t i, size_t j ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::find( size_t i, size_t j ) const
 {
    const ConstIterator pos( lowerBound( i, j ) );
    if( pos != end_[i] && pos->index_ == j )
@@ -1939,9 +2030,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // or the insert() function!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::lowerBound( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( i, j ) );
 }
@@ -1964,9 +2056,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // or the insert() function!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::lowerBound( size_t i, size_t j ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return std::lower_bound( begin_[i], end_[i], j, FindIndex() );
@@ -1990,9 +2083,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // or the insert() function!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::upperBound( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::upperBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).upperBound( i, j ) );
 }
@@ -2015,9 +2109,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // or the insert() function!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::upperBound( size_t i, size_t j ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::upperBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return std::upper_bound( begin_[i], end_[i], j, FindIndex() );
@@ -2078,8 +2173,9 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // returned by the end() functions!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::append( size_t i, size_t j, const Type& value, bool check )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::append( size_t i, size_t j, const Type& value, bool check )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
@@ -2110,8 +2206,9 @@ inline void CompressedMatrix<Type,SO>::append( size_t i, size_t j, const Type& v
 // returned by the end() functions!
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::finalize( size_t i )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::finalize( size_t i )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
 
@@ -2141,9 +2238,10 @@ inline void CompressedMatrix<Type,SO>::finalize( size_t i )
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,SO>::canAlias( const Other* alias ) const
+inline bool CompressedMatrix<Type,SO,IT>::canAlias( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2161,9 +2259,10 @@ inline bool CompressedMatrix<Type,SO>::canAlias( const Other* alias ) const
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the sparse matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,SO>::isAliased( const Other* alias ) const
+inline bool CompressedMatrix<Type,SO,IT>::isAliased( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2181,8 +2280,9 @@ inline bool CompressedMatrix<Type,SO>::isAliased( const Other* alias ) const
 // rows and/or columns of the matrix).
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline bool CompressedMatrix<Type,SO>::canSMPAssign() const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool CompressedMatrix<Type,SO,IT>::canSMPAssign() const
 {
    return false;
 }
@@ -2201,10 +2301,11 @@ inline bool CompressedMatrix<Type,SO>::canSMPAssign() const
 // assignment operator.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::assign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2260,9 +2361,10 @@ inline void CompressedMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT >  // Type of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2291,9 +2393,10 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT >  // Type of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2337,10 +2440,11 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::addAssign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2363,10 +2467,11 @@ inline void CompressedMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs
 // assignment operator.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side sparse matrix
         , bool SO2 >     // Storage order of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::addAssign( const SparseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2389,10 +2494,11 @@ inline void CompressedMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO2>& rh
 // assignment operator.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::subAssign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2415,10 +2521,11 @@ inline void CompressedMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs
 // assignment operator.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side sparse matrix
         , bool SO2 >     // Storage order of the right-hand sparse matrix
-inline void CompressedMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::subAssign( const SparseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2449,12 +2556,13 @@ inline void CompressedMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO2>& rh
 // This specialization of CompressedMatrix adapts the class template to the requirements of
 // column-major matrices.
 */
-template< typename Type >  // Data type of the sparse matrix
-class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,true>, true >
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+class CompressedMatrix<Type,true,IT> : public SparseMatrix< CompressedMatrix<Type,true,IT>, true >
 {
  private:
    //**Type definitions****************************************************************************
-   typedef ValueIndexPair<Type>  ElementBase;  //!< Base class for the sparse matrix element.
+   typedef ValueIndexPair<Type,IT>  ElementBase;  //!< Base class for the sparse matrix element.
    //**********************************************************************************************
 
    //**Private class Element***********************************************************************
@@ -2498,17 +2606,17 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
 
  public:
    //**Type definitions****************************************************************************
-   typedef CompressedMatrix<Type,true>   This;            //!< Type of this CompressedMatrix instance.
-   typedef This                          ResultType;      //!< Result type for expression template evaluations.
-   typedef CompressedMatrix<Type,false>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
-   typedef CompressedMatrix<Type,false>  TransposeType;   //!< Transpose type for expression template evaluations.
-   typedef Type                          ElementType;     //!< Type of the sparse matrix elements.
-   typedef const Type&                   ReturnType;      //!< Return type for expression template evaluations.
-   typedef const This&                   CompositeType;   //!< Data type for composite expression templates.
-   typedef MatrixAccessProxy<This>       Reference;       //!< Reference to a non-constant matrix value.
-   typedef const Type&                   ConstReference;  //!< Reference to a constant matrix value.
-   typedef Element*                      Iterator;        //!< Iterator over non-constant elements.
-   typedef const Element*                ConstIterator;   //!< Iterator over constant elements.
+   typedef CompressedMatrix<Type,true,IT>   This;            //!< Type of this CompressedMatrix instance.
+   typedef This                             ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,false,IT>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,false,IT>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                             ElementType;     //!< Type of the sparse matrix elements.
+   typedef const Type&                      ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                      CompositeType;   //!< Data type for composite expression templates.
+   typedef MatrixAccessProxy<This>          Reference;       //!< Reference to a non-constant matrix value.
+   typedef const Type&                      ConstReference;  //!< Reference to a constant matrix value.
+   typedef Element*                         Iterator;        //!< Iterator over non-constant elements.
+   typedef const Element*                   ConstIterator;   //!< Iterator over constant elements.
    //**********************************************************************************************
 
    //**Rebind struct definition********************************************************************
@@ -2516,7 +2624,7 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
    */
    template< typename ET >  // Data type of the other matrix
    struct Rebind {
-      typedef CompressedMatrix<ET,true>  Other;  //!< The type of the other CompressedMatrix.
+      typedef CompressedMatrix<ET,true,IT>  Other;  //!< The type of the other CompressedMatrix.
    };
    //**********************************************************************************************
 
@@ -2656,6 +2764,8 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
           Iterator insert( Iterator pos, size_t i, size_t j, const Type& value );
    inline size_t   extendCapacity() const;
           void     reserveElements( size_t nonzeros );
+
+   static inline size_t checkIndexRange( size_t n );
    //@}
    //**********************************************************************************************
 
@@ -2694,8 +2804,8 @@ class CompressedMatrix<Type,true> : public SparseMatrix< CompressedMatrix<Type,t
 //
 //=================================================================================================
 
-template< typename Type >
-const Type CompressedMatrix<Type,true>::zero_ = Type();
+template< typename Type, typename IT >
+const Type CompressedMatrix<Type,true,IT>::zero_ = Type();
 
 
 
@@ -2710,8 +2820,9 @@ const Type CompressedMatrix<Type,true>::zero_ = Type();
 /*! \cond BLAZE_INTERNAL */
 /*!\brief The default constructor for CompressedMatrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix()
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix()
    : m_       ( 0UL )             // The current number of rows of the sparse matrix
    , n_       ( 0UL )             // The current number of columns of the sparse matrix
    , capacity_( 0UL )             // The current capacity of the pointer array
@@ -2733,9 +2844,10 @@ inline CompressedMatrix<Type,true>::CompressedMatrix()
 //
 // The matrix is initialized to the zero matrix and has no free capacity.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n )
-   : m_       ( m )                     // The current number of rows of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( size_t m, size_t n )
+   : m_       ( checkIndexRange( m ) )  // The current number of rows of the sparse matrix
    , n_       ( n )                     // The current number of columns of the sparse matrix
    , capacity_( n )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*n+2UL] )  // Pointers to the first non-zero element of each column
@@ -2758,9 +2870,10 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n )
 //
 // The matrix is initialized to the zero matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
-   : m_       ( m )                     // The current number of rows of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
+   : m_       ( checkIndexRange( m ) )  // The current number of rows of the sparse matrix
    , n_       ( n )                     // The current number of columns of the sparse matrix
    , capacity_( n )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*n+2UL] )  // Pointers to the first non-zero element of each column
@@ -2786,9 +2899,10 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, size_t
 // The matrix is initialized to the zero matrix and will have the specified capacity in each
 // column. Note that the given vector must have at least \a n elements.
 */
-template< typename Type >  // Data type of the sparse matrix
-CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
-   : m_       ( m )                      // The current number of rows of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+CompressedMatrix<Type,true,IT>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+   : m_       ( checkIndexRange( m ) )   // The current number of rows of the sparse matrix
    , n_       ( n )                      // The current number of columns of the sparse matrix
    , capacity_( n )                      // The current capacity of the pointer array
    , begin_( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
@@ -2815,8 +2929,9 @@ CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::ve
 //
 // \param sm Sparse matrix to be copied.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( const CompressedMatrix& sm )
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( const CompressedMatrix& sm )
    : m_       ( sm.m_ )                     // The current number of rows of the sparse matrix
    , n_       ( sm.n_ )                     // The current number of columns of the sparse matrix
    , capacity_( sm.n_ )                     // The current capacity of the pointer array
@@ -2840,15 +2955,16 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const CompressedMatrix& sm
 //
 // \param dm Dense matrix to be copied.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the foreign dense matrix
         , bool SO >        // Storage order of the foreign dense matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( const DenseMatrix<MT,SO>& dm )
-   : m_       ( (~dm).rows() )              // The current number of rows of the sparse matrix
-   , n_       ( (~dm).columns() )           // The current number of columns of the sparse matrix
-   , capacity_( n_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
-   , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( const DenseMatrix<MT,SO>& dm )
+   : m_       ( checkIndexRange( (~dm).rows() ) )  // The current number of rows of the sparse matrix
+   , n_       ( (~dm).columns() )                  // The current number of columns of the sparse matrix
+   , capacity_( n_ )                               // The current capacity of the pointer array
+   , begin_   ( new Iterator[2UL*n_+2UL] )         // Pointers to the first non-zero element of each column
+   , end_     ( begin_+(n_+1UL) )                  // Pointers one past the last non-zero element of each column
 {
    using blaze::assign;
 
@@ -2867,15 +2983,16 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const DenseMatrix<MT,SO>&
 //
 // \param sm Sparse matrix to be copied.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the foreign sparse matrix
         , bool SO >        // Storage order of the foreign sparse matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>& sm )
-   : m_       ( (~sm).rows() )              // The current number of rows of the sparse matrix
-   , n_       ( (~sm).columns() )           // The current number of columns of the sparse matrix
-   , capacity_( n_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
-   , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( const SparseMatrix<MT,SO>& sm )
+   : m_       ( checkIndexRange( (~sm).rows() ) )  // The current number of rows of the sparse matrix
+   , n_       ( (~sm).columns() )                  // The current number of columns of the sparse matrix
+   , capacity_( n_ )                               // The current capacity of the pointer array
+   , begin_   ( new Iterator[2UL*n_+2UL] )         // Pointers to the first non-zero element of each column
+   , end_     ( begin_+(n_+1UL) )                  // Pointers one past the last non-zero element of each column
 {
    using blaze::assign;
 
@@ -2904,8 +3021,9 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>&
 /*! \cond BLAZE_INTERNAL */
 /*!\brief The destructor for CompressedMatrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>::~CompressedMatrix()
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline CompressedMatrix<Type,true,IT>::~CompressedMatrix()
 {
    deallocate( begin_[0UL] );
    delete [] begin_;
@@ -2930,9 +3048,10 @@ inline CompressedMatrix<Type,true>::~CompressedMatrix()
 // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
 // \return Reference to the accessed value.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Reference
-   CompressedMatrix<Type,true>::operator()( size_t i, size_t j )
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::Reference
+   CompressedMatrix<Type,true,IT>::operator()( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -2951,9 +3070,10 @@ inline typename CompressedMatrix<Type,true>::Reference
 // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
 // \return Reference to the accessed value.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstReference
-   CompressedMatrix<Type,true>::operator()( size_t i, size_t j ) const
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstReference
+   CompressedMatrix<Type,true,IT>::operator()( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -2976,9 +3096,10 @@ inline typename CompressedMatrix<Type,true>::ConstReference
 // \param j The column index.
 // \return Iterator to the first non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::begin( size_t j )
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::begin( size_t j )
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return begin_[j];
@@ -2994,9 +3115,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \param j The column index.
 // \return Iterator to the first non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::begin( size_t j ) const
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::begin( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return begin_[j];
@@ -3012,9 +3134,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator to the first non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::cbegin( size_t j ) const
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::cbegin( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return begin_[j];
@@ -3030,9 +3153,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator just past the last non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::end( size_t j )
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::end( size_t j )
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return end_[j];
@@ -3048,9 +3172,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \param j The column index.
 // \return Iterator just past the last non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::end( size_t j ) const
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::end( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return end_[j];
@@ -3066,9 +3191,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator just past the last non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::cend( size_t j ) const
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::cend( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid sparse matrix column access index" );
    return end_[j];
@@ -3095,9 +3221,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // The sparse matrix is resized according to the given sparse matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( const CompressedMatrix& rhs )
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline CompressedMatrix<Type,true,IT>&
+   CompressedMatrix<Type,true,IT>::operator=( const CompressedMatrix& rhs )
 {
    if( &rhs == this ) return *this;
 
@@ -3145,11 +3272,12 @@ inline CompressedMatrix<Type,true>&
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( const DenseMatrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,IT>&
+   CompressedMatrix<Type,true,IT>::operator=( const DenseMatrix<MT,SO>& rhs )
 {
    using blaze::assign;
 
@@ -3178,11 +3306,12 @@ inline CompressedMatrix<Type,true>&
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side sparse matrix
         , bool SO >        // Storage order of the right-hand side sparse matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( const SparseMatrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,IT>&
+   CompressedMatrix<Type,true,IT>::operator=( const SparseMatrix<MT,SO>& rhs )
 {
    using blaze::assign;
 
@@ -3215,10 +3344,11 @@ inline CompressedMatrix<Type,true>&
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator+=( const Matrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,IT>& CompressedMatrix<Type,true,IT>::operator+=( const Matrix<MT,SO>& rhs )
 {
    using blaze::addAssign;
 
@@ -3243,10 +3373,11 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator+=( con
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator-=( const Matrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,IT>& CompressedMatrix<Type,true,IT>::operator-=( const Matrix<MT,SO>& rhs )
 {
    using blaze::subAssign;
 
@@ -3271,11 +3402,12 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator-=( con
 // In case the current sizes of the two given matrices don't match, a \a std::invalid_argument
 // is thrown.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator*=( const Matrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,IT>&
+   CompressedMatrix<Type,true,IT>::operator*=( const Matrix<MT,SO>& rhs )
 {
    if( (~rhs).rows() != n_ )
       throw std::invalid_argument( "Matrix sizes do not match" );
@@ -3297,10 +3429,11 @@ inline CompressedMatrix<Type,true>&
 // \param rhs The right-hand side scalar value for the multiplication.
 // \return Reference to the sparse matrix.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true> >::Type&
-   CompressedMatrix<Type,true>::operator*=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true,IT> >::Type&
+   CompressedMatrix<Type,true,IT>::operator*=( Other rhs )
 {
    for( size_t j=0UL; j<n_; ++j ) {
       const Iterator last( end(j) );
@@ -3321,10 +3454,11 @@ inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true> >::Type&
 // \param rhs The right-hand side scalar value for the division.
 // \return Reference to the matrix.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true> >::Type&
-   CompressedMatrix<Type,true>::operator/=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true,IT> >::Type&
+   CompressedMatrix<Type,true,IT>::operator/=( Other rhs )
 {
    BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
 
@@ -3369,8 +3503,9 @@ inline typename EnableIf< IsNumeric<Other>, CompressedMatrix<Type,true> >::Type&
 //
 // \return The number of rows of the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::rows() const
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline size_t CompressedMatrix<Type,true,IT>::rows() const
 {
    return m_;
 }
@@ -3384,8 +3519,9 @@ inline size_t CompressedMatrix<Type,true>::rows() const
 //
 // \return The number of columns of the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::columns() const
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline size_t CompressedMatrix<Type,true,IT>::columns() const
 {
    return n_;
 }
@@ -3399,8 +3535,9 @@ inline size_t CompressedMatrix<Type,true>::columns() const
 //
 // \return The capacity of the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::capacity() const
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline size_t CompressedMatrix<Type,true,IT>::capacity() const
 {
    return end_[n_] - begin_[0UL];
 }
@@ -3415,8 +3552,9 @@ inline size_t CompressedMatrix<Type,true>::capacity() const
 // \param j The index of the column.
 // \return The current capacity of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::capacity( size_t j ) const
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline size_t CompressedMatrix<Type,true,IT>::capacity( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return begin_[j+1UL] - begin_[j];
@@ -3431,8 +3569,9 @@ inline size_t CompressedMatrix<Type,true>::capacity( size_t j ) const
 //
 // \return The number of non-zero elements in the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::nonZeros() const
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline size_t CompressedMatrix<Type,true,IT>::nonZeros() const
 {
    size_t nonzeros( 0UL );
 
@@ -3452,8 +3591,9 @@ inline size_t CompressedMatrix<Type,true>::nonZeros() const
 // \param j The index of the column.
 // \return The number of non-zero elements of column \a j.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::nonZeros( size_t j ) const
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline size_t CompressedMatrix<Type,true,IT>::nonZeros( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return end_[j] - begin_[j];
@@ -3468,8 +3608,9 @@ inline size_t CompressedMatrix<Type,true>::nonZeros( size_t j ) const
 //
 // \return void
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::reset()
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline void CompressedMatrix<Type,true,IT>::reset()
 {
    for( size_t j=0UL; j<n_; ++j )
       end_[j] = begin_[j];
@@ -3488,8 +3629,9 @@ inline void CompressedMatrix<Type,true>::reset()
 // This function reset the values in the specified column to their default value. Note that
 // the capacity of the column remains unchanged.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::reset( size_t j )
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline void CompressedMatrix<Type,true,IT>::reset( size_t j )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    end_[j] = begin_[j];
@@ -3506,8 +3648,9 @@ inline void CompressedMatrix<Type,true>::reset( size_t j )
 //
 // After the clear() function, the size of the sparse matrix is 0.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::clear()
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline void CompressedMatrix<Type,true,IT>::clear()
 {
    end_[0UL] = end_[n_];
    m_ = 0UL;
@@ -3530,9 +3673,10 @@ inline void CompressedMatrix<Type,true>::clear()
 // matrix already contains an element with row index \a i and column index \a j its value is
 // modified, else a new element with the given \a value is inserted.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::set( size_t i, size_t j, const Type& value )
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::set( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -3563,9 +3707,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // are not allowed. In case the compressed matrix already contains an element with row index \a i
 // and column index \a j, a \a std::invalid_argument exception is thrown.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::insert( size_t i, size_t j, const Type& value )
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::insert( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -3592,9 +3737,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \return Iterator to the newly inserted element.
 // \exception std::invalid_argument Invalid compressed matrix access index.
 */
-template< typename Type >  // Data type of the sparse matrix
-typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::insert( Iterator pos, size_t i, size_t j, const Type& value )
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::insert( Iterator pos, size_t i, size_t j, const Type& value )
 {
    if( begin_[j+1UL] - end_[j] != 0 ) {
       std::copy_backward( pos, end_[j], end_[j]+1 );
@@ -3669,8 +3815,9 @@ typename CompressedMatrix<Type,true>::Iterator
 //
 // This function erases an element from the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::erase( size_t i, size_t j )
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline void CompressedMatrix<Type,true,IT>::erase( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -3693,9 +3840,10 @@ inline void CompressedMatrix<Type,true>::erase( size_t i, size_t j )
 //
 // This function erases an element from column \a j of the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::erase( size_t j, Iterator pos )
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::erase( size_t j, Iterator pos )
 {
    BLAZE_USER_ASSERT( j < columns()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( pos >= begin_[j] && pos <= end_[j], "Invalid compressed matrix iterator" );
@@ -3720,9 +3868,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 //
 // This function erases a range of elements from column \a j of the sparse matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::erase( size_t j, Iterator first, Iterator last )
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::erase( size_t j, Iterator first, Iterator last )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid row access index" );
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
@@ -3746,6 +3895,7 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \param n The new number of columns of the sparse matrix.
 // \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
 // \return void
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
 //
 // This function resizes the matrix using the given size to \f$ m \times n \f$. During this
 // operation, new dynamic memory may be allocated in case the capacity of the matrix is too
@@ -3754,9 +3904,12 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // potentially changes all matrix elements. In order to preserve the old matrix values, the
 // \a preserve flag can be set to \a true.
 */
-template< typename Type >  // Data type of the sparse matrix
-void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+void CompressedMatrix<Type,true,IT>::resize( size_t m, size_t n, bool preserve )
 {
+   checkIndexRange( m );
+
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
    BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
 
@@ -3839,8 +3992,9 @@ void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 // The current values of the matrix elements and the individual capacities of the matrix rows
 // are preserved.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::reserve( size_t nonzeros )
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline void CompressedMatrix<Type,true,IT>::reserve( size_t nonzeros )
 {
    if( nonzeros > capacity() )
       reserveElements( nonzeros );
@@ -3861,8 +4015,9 @@ inline void CompressedMatrix<Type,true>::reserve( size_t nonzeros )
 // elements. The current values of the sparse matrix and all other individual column capacities are
 // preserved.
 */
-template< typename Type >  // Data type of the sparse matrix
-void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+void CompressedMatrix<Type,true,IT>::reserve( size_t j, size_t nonzeros )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
@@ -3931,8 +4086,9 @@ void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
 // It removes all excessive capacity from all columns. Note that this function does not remove
 // the overall capacity but only reduces the capacity per column.
 */
-template< typename Type >  // Data type of the sparse matrix
-void CompressedMatrix<Type,true>::trim()
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+void CompressedMatrix<Type,true,IT>::trim()
 {
    for( size_t j=0UL; j<n_; ++j )
       trim( j );
@@ -3952,8 +4108,9 @@ void CompressedMatrix<Type,true>::trim()
 // removes all excessive capacity from the specified column. The excessive capacity is assigned
 // to the subsequent column.
 */
-template< typename Type >  // Data type of the sparse matrix
-void CompressedMatrix<Type,true>::trim( size_t j )
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+void CompressedMatrix<Type,true,IT>::trim( size_t j )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
@@ -3971,8 +4128,9 @@ void CompressedMatrix<Type,true>::trim( size_t j )
 //
 // \return Reference to the transposed matrix.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::transpose()
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline CompressedMatrix<Type,true,IT>& CompressedMatrix<Type,true,IT>::transpose()
 {
    CompressedMatrix tmp( trans( *this ) );
    swap( tmp );
@@ -3989,9 +4147,10 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::transpose()
 // \param scalar The scalar value for the matrix scaling.
 // \return Reference to the sparse matrix.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the scalar value
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::scale( const Other& scalar )
+inline CompressedMatrix<Type,true,IT>& CompressedMatrix<Type,true,IT>::scale( const Other& scalar )
 {
    for( size_t j=0UL; j<n_; ++j )
       for( Iterator element=begin_[j]; element!=end_[j]; ++element )
@@ -4010,9 +4169,10 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::scale( const Ot
 // \param scalar The scalar value for the diagonal scaling.
 // \return Reference to the sparse matrix.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the scalar value
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::scaleDiagonal( Other scalar )
+inline CompressedMatrix<Type,true,IT>& CompressedMatrix<Type,true,IT>::scaleDiagonal( Other scalar )
 {
    const size_t size( blaze::min( m_, n_ ) );
 
@@ -4036,8 +4196,9 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::scaleDiagonal(
 // \return void
 // \exception no-throw guarantee.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::swap( CompressedMatrix& sm ) /* throw() */
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline void CompressedMatrix<Type,true,IT>::swap( CompressedMatrix& sm ) /* throw() */
 {
    std::swap( m_, sm.m_ );
    std::swap( n_, sm.n_ );
@@ -4058,8 +4219,9 @@ inline void CompressedMatrix<Type,true>::swap( CompressedMatrix& sm ) /* throw()
 // This function calculates a new matrix capacity based on the current capacity of the sparse
 // matrix. Note that the new capacity is restricted to the interval \f$[7..M \cdot N]\f$.
 */
-template< typename Type >  // Data type of the sparse matrix
-inline size_t CompressedMatrix<Type,true>::extendCapacity() const
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline size_t CompressedMatrix<Type,true,IT>::extendCapacity() const
 {
    size_t nonzeros( 2UL*capacity()+1UL );
    nonzeros = blaze::max( nonzeros, 7UL );
@@ -4079,8 +4241,9 @@ inline size_t CompressedMatrix<Type,true>::extendCapacity() const
 // \param nonzeros The number of matrix elements to be reserved.
 // \return void
 */
-template< typename Type >  // Data type of the sparse matrix
-void CompressedMatrix<Type,true>::reserveElements( size_t nonzeros )
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+void CompressedMatrix<Type,true,IT>::reserveElements( size_t nonzeros )
 {
    Iterator* newBegin = new Iterator[2UL*capacity_+2UL];
    Iterator* newEnd   = newBegin+capacity_+1UL;
@@ -4127,9 +4290,10 @@ void CompressedMatrix<Type,true>::reserveElements( size_t nonzeros )
 // Note that the returned sparse matrix iterator is subject to invalidation due to inserting
 // operations via the subscript operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::find( size_t i, size_t j )
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::find( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).find( i, j ) );
 }
@@ -4152,9 +4316,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // Note that the returned sparse matrix iterator is subject to invalidation due to inserting
 // operations via the subscript operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::find( size_t i, size_t j ) const
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::find( size_t i, size_t j ) const
 {
    const ConstIterator pos( lowerBound( i, j ) );
    if( pos != end_[j] && pos->index_ == i )
@@ -4179,9 +4344,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::lowerBound( size_t i, size_t j )
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::lowerBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( i, j ) );
 }
@@ -4203,9 +4369,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::lowerBound( size_t i, size_t j ) const
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::lowerBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return std::lower_bound( begin_[j], end_[j], i, FindIndex() );
@@ -4228,9 +4395,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::upperBound( size_t i, size_t j )
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::upperBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).upperBound( i, j ) );
 }
@@ -4252,9 +4420,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator or the insert() function!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::upperBound( size_t i, size_t j ) const
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::upperBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return std::upper_bound( begin_[j], end_[j], i, FindIndex() );
@@ -4313,8 +4482,9 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \b Note: Although append() does not allocate new memory, it still invalidates all iterators
 // returned by the end() functions!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::append( size_t i, size_t j, const Type& value, bool check )
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline void CompressedMatrix<Type,true,IT>::append( size_t i, size_t j, const Type& value, bool check )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
@@ -4346,8 +4516,9 @@ inline void CompressedMatrix<Type,true>::append( size_t i, size_t j, const Type&
 // \b Note: Although finalize() does not allocate new memory, it still invalidates all iterators
 // returned by the end() functions!
 */
-template< typename Type >  // Data type of the sparse matrix
-inline void CompressedMatrix<Type,true>::finalize( size_t j )
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline void CompressedMatrix<Type,true,IT>::finalize( size_t j )
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid row access index" );
 
@@ -4378,9 +4549,10 @@ inline void CompressedMatrix<Type,true>::finalize( size_t j )
 // to the isAliased() function this function is allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,true>::canAlias( const Other* alias ) const
+inline bool CompressedMatrix<Type,true,IT>::canAlias( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -4399,9 +4571,10 @@ inline bool CompressedMatrix<Type,true>::canAlias( const Other* alias ) const
 // to the canAlias() function this function is not allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< typename Type >   // Data type of the sparse matrix
+template< typename Type     // Data type of the sparse matrix
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,true>::isAliased( const Other* alias ) const
+inline bool CompressedMatrix<Type,true,IT>::isAliased( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -4420,8 +4593,9 @@ inline bool CompressedMatrix<Type,true>::isAliased( const Other* alias ) const
 // function additionally provides runtime information (as for instance the current number of
 // rows and/or columns of the matrix).
 */
-template< typename Type >  // Data type of the sparse matrix
-inline bool CompressedMatrix<Type,true>::canSMPAssign() const
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
+inline bool CompressedMatrix<Type,true,IT>::canSMPAssign() const
 {
    return false;
 }
@@ -4441,10 +4615,11 @@ inline bool CompressedMatrix<Type,true>::canSMPAssign() const
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::assign( const DenseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,IT>::assign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4501,9 +4676,10 @@ inline void CompressedMatrix<Type,true>::assign( const DenseMatrix<MT,SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
 template< typename MT >    // Type of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,true>& rhs )
+inline void CompressedMatrix<Type,true,IT>::assign( const SparseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4533,9 +4709,10 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,true>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
 template< typename MT >    // Type of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,false>& rhs )
+inline void CompressedMatrix<Type,true,IT>::assign( const SparseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -4580,10 +4757,11 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,false>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::addAssign( const DenseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,IT>::addAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4607,10 +4785,11 @@ inline void CompressedMatrix<Type,true>::addAssign( const DenseMatrix<MT,SO>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side sparse matrix
         , bool SO >        // Storage order of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,true>::addAssign( const SparseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,IT>::addAssign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4634,10 +4813,11 @@ inline void CompressedMatrix<Type,true>::addAssign( const SparseMatrix<MT,SO>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::subAssign( const DenseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,IT>::subAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4661,10 +4841,11 @@ inline void CompressedMatrix<Type,true>::subAssign( const DenseMatrix<MT,SO>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the sparse matrix
+template< typename Type    // Data type of the sparse matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side sparse matrix
         , bool SO >        // Storage order of the right-hand side sparse matrix
-inline void CompressedMatrix<Type,true>::subAssign( const SparseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,IT>::subAssign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -4691,23 +4872,23 @@ inline void CompressedMatrix<Type,true>::subAssign( const SparseMatrix<MT,SO>& r
 //*************************************************************************************************
 /*!\name CompressedMatrix operators */
 //@{
-template< typename Type, bool SO >
-inline void reset( CompressedMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename IT >
+inline void reset( CompressedMatrix<Type,SO,IT>& m );
 
-template< typename Type, bool SO >
-inline void reset( CompressedMatrix<Type,SO>& m, size_t i );
+template< typename Type, bool SO, typename IT >
+inline void reset( CompressedMatrix<Type,SO,IT>& m, size_t i );
 
-template< typename Type, bool SO >
-inline void clear( CompressedMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename IT >
+inline void clear( CompressedMatrix<Type,SO,IT>& m );
 
-template< typename Type, bool SO >
-inline bool isDefault( const CompressedMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename IT >
+inline bool isDefault( const CompressedMatrix<Type,SO,IT>& m );
 
-template< typename Type, bool SO >
-inline void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) /* throw() */;
+template< typename Type, bool SO, typename IT >
+inline void swap( CompressedMatrix<Type,SO,IT>& a, CompressedMatrix<Type,SO,IT>& b ) /* throw() */;
 
-template< typename Type, bool SO >
-inline void move( CompressedMatrix<Type,SO>& dst, CompressedMatrix<Type,SO>& src ) /* throw() */;
+template< typename Type, bool SO, typename IT >
+inline void move( CompressedMatrix<Type,SO,IT>& dst, CompressedMatrix<Type,SO,IT>& src ) /* throw() */;
 //@}
 //*************************************************************************************************
 
@@ -4720,14 +4901,38 @@ inline void move( CompressedMatrix<Type,SO>& dst, CompressedMatrix<Type,SO>& src
 // \return void
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void reset( CompressedMatrix<Type,SO>& m )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void reset( CompressedMatrix<Type,SO,IT>& m )
 {
    m.reset();
 }
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking whether all row indices of the matrix can be stored.
+//
+// \param n The number of rows of the compressed matrix.
+// \return The given number \a n.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// This function checks whether the largest row index of a matrix with \a n rows can be
+// represented by the index type \a IT. In case the number of rows exceeds the range of the
+// index type, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,true,IT>::checkIndexRange( size_t n )
+{
+   if( n > 0UL && n-1UL > static_cast<size_t>( std::numeric_limits<IT>::max() ) )
+      throw std::invalid_argument( "Matrix size exceeds the range of the index type" );
+
+   return n;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Reset the specified row/column of the given compressed matrix.
 // \ingroup compressed_matrix
@@ -4742,8 +4947,9 @@ inline void reset( CompressedMatrix<Type,SO>& m )
 // \a i. Note that the capacity of the row/column remains unchanged.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void reset( CompressedMatrix<Type,SO>& m, size_t i )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void reset( CompressedMatrix<Type,SO,IT>& m, size_t i )
 {
    m.reset( i );
 }
@@ -4758,8 +4964,9 @@ inline void reset( CompressedMatrix<Type,SO>& m, size_t i )
 // \return void
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void clear( CompressedMatrix<Type,SO>& m )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void clear( CompressedMatrix<Type,SO,IT>& m )
 {
    m.clear();
 }
@@ -4785,8 +4992,9 @@ inline void clear( CompressedMatrix<Type,SO>& m )
    \endcode
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline bool isDefault( const CompressedMatrix<Type,SO>& m )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool isDefault( const CompressedMatrix<Type,SO,IT>& m )
 {
    return ( m.rows() == 0UL && m.columns() == 0UL );
 }
@@ -4803,8 +5011,9 @@ inline bool isDefault( const CompressedMatrix<Type,SO>& m )
 // \exception no-throw guarantee.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) /* throw() */
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void swap( CompressedMatrix<Type,SO,IT>& a, CompressedMatrix<Type,SO,IT>& b ) /* throw() */
 {
    a.swap( b );
 }
@@ -4821,8 +5030,9 @@ inline void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) /
 // \exception no-throw guarantee.
 */
 template< typename Type  // Data type of the sparse matrix
-        , bool SO >      // Storage order
-inline void move( CompressedMatrix<Type,SO>& dst, CompressedMatrix<Type,SO>& src ) /* throw() */
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void move( CompressedMatrix<Type,SO,IT>& dst, CompressedMatrix<Type,SO,IT>& src ) /* throw() */
 {
    dst.swap( src );
 }
@@ -4839,8 +5049,8 @@ inline void move( CompressedMatrix<Type,SO>& dst, CompressedMatrix<Type,SO>& src
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct IsResizable< CompressedMatrix<T,SO> > : public TrueType
+template< typename T, bool SO, typename IT >
+struct IsResizable< CompressedMatrix<T,SO,IT> > : public TrueType
 {
    enum { value = 1 };
    typedef TrueType  Type;
@@ -4859,86 +5069,86 @@ struct IsResizable< CompressedMatrix<T,SO> > : public TrueType
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct AddTrait< CompressedMatrix<T1,SO>, StaticMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename IT >
+struct AddTrait< CompressedMatrix<T1,SO,IT>, StaticMatrix<T2,M,N,SO> >
 {
    typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct AddTrait< CompressedMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct AddTrait< CompressedMatrix<T1,SO1,IT>, StaticMatrix<T2,M,N,SO2> >
 {
    typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO2 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct AddTrait< StaticMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename IT >
+struct AddTrait< StaticMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO,IT> >
 {
    typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct AddTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,IT> >
 {
    typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct AddTrait< CompressedMatrix<T1,SO>, HybridMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename IT >
+struct AddTrait< CompressedMatrix<T1,SO,IT>, HybridMatrix<T2,M,N,SO> >
 {
    typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct AddTrait< CompressedMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct AddTrait< CompressedMatrix<T1,SO1,IT>, HybridMatrix<T2,M,N,SO2> >
 {
    typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO2 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct AddTrait< HybridMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename IT >
+struct AddTrait< HybridMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO,IT> >
 {
    typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct AddTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,IT> >
 {
    typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct AddTrait< CompressedMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename IT >
+struct AddTrait< CompressedMatrix<T1,SO,IT>, DynamicMatrix<T2,SO> >
 {
    typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct AddTrait< CompressedMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< CompressedMatrix<T1,SO1,IT>, DynamicMatrix<T2,SO2> >
 {
    typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO2 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct AddTrait< DynamicMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename IT >
+struct AddTrait< DynamicMatrix<T1,SO>, CompressedMatrix<T2,SO,IT> >
 {
    typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct AddTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2,IT> >
 {
    typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct AddTrait< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename IT1, typename IT2 >
+struct AddTrait< CompressedMatrix<T1,SO,IT1>, CompressedMatrix<T2,SO,IT2> >
 {
    typedef CompressedMatrix< typename AddTrait<T1,T2>::Type , SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct AddTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename IT2 >
+struct AddTrait< CompressedMatrix<T1,SO1,IT1>, CompressedMatrix<T2,SO2,IT2> >
 {
    typedef CompressedMatrix< typename AddTrait<T1,T2>::Type , false >  Type;
 };
@@ -4956,86 +5166,86 @@ struct AddTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct SubTrait< CompressedMatrix<T1,SO>, StaticMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename IT >
+struct SubTrait< CompressedMatrix<T1,SO,IT>, StaticMatrix<T2,M,N,SO> >
 {
    typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct SubTrait< CompressedMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct SubTrait< CompressedMatrix<T1,SO1,IT>, StaticMatrix<T2,M,N,SO2> >
 {
    typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO2 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct SubTrait< StaticMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename IT >
+struct SubTrait< StaticMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO,IT> >
 {
    typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct SubTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,IT> >
 {
    typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2, size_t M, size_t N >
-struct SubTrait< CompressedMatrix<T1,SO>, HybridMatrix<T2,M,N,SO> >
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename IT >
+struct SubTrait< CompressedMatrix<T1,SO,IT>, HybridMatrix<T2,M,N,SO> >
 {
    typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct SubTrait< CompressedMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct SubTrait< CompressedMatrix<T1,SO1,IT>, HybridMatrix<T2,M,N,SO2> >
 {
    typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO2 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO, typename T2 >
-struct SubTrait< HybridMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename IT >
+struct SubTrait< HybridMatrix<T1,M,N,SO>, CompressedMatrix<T2,SO,IT> >
 {
    typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct SubTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,IT> >
 {
    typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct SubTrait< CompressedMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename IT >
+struct SubTrait< CompressedMatrix<T1,SO,IT>, DynamicMatrix<T2,SO> >
 {
    typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct SubTrait< CompressedMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< CompressedMatrix<T1,SO1,IT>, DynamicMatrix<T2,SO2> >
 {
    typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO2 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct SubTrait< DynamicMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename IT >
+struct SubTrait< DynamicMatrix<T1,SO>, CompressedMatrix<T2,SO,IT> >
 {
    typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct SubTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2,IT> >
 {
    typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO1 >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct SubTrait< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename IT1, typename IT2 >
+struct SubTrait< CompressedMatrix<T1,SO,IT1>, CompressedMatrix<T2,SO,IT2> >
 {
    typedef CompressedMatrix< typename SubTrait<T1,T2>::Type , SO >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct SubTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename IT2 >
+struct SubTrait< CompressedMatrix<T1,SO1,IT1>, CompressedMatrix<T2,SO2,IT2> >
 {
    typedef CompressedMatrix< typename SubTrait<T1,T2>::Type , false >  Type;
 };
@@ -5053,106 +5263,106 @@ struct SubTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< CompressedMatrix<T1,SO>, T2 >
+template< typename T1, bool SO, typename T2, typename IT >
+struct MultTrait< CompressedMatrix<T1,SO,IT>, T2 >
 {
-   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO, IT >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< T1, CompressedMatrix<T2,SO> >
+template< typename T1, typename T2, bool SO, typename IT >
+struct MultTrait< T1, CompressedMatrix<T2,SO,IT> >
 {
-   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO, IT >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
 };
 
-template< typename T1, bool SO, typename T2, size_t N >
-struct MultTrait< CompressedMatrix<T1,SO>, StaticVector<T2,N,false> >
+template< typename T1, bool SO, typename T2, size_t N, typename IT >
+struct MultTrait< CompressedMatrix<T1,SO,IT>, StaticVector<T2,N,false> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, size_t N, typename T2, bool SO >
-struct MultTrait< StaticVector<T1,N,true>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t N, typename T2, bool SO, typename IT >
+struct MultTrait< StaticVector<T1,N,true>, CompressedMatrix<T2,SO,IT> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, bool SO, typename T2, size_t N >
-struct MultTrait< CompressedMatrix<T1,SO>, HybridVector<T2,N,false> >
+template< typename T1, bool SO, typename T2, size_t N, typename IT >
+struct MultTrait< CompressedMatrix<T1,SO,IT>, HybridVector<T2,N,false> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, size_t N, typename T2, bool SO >
-struct MultTrait< HybridVector<T1,N,true>, CompressedMatrix<T2,SO> >
+template< typename T1, size_t N, typename T2, bool SO, typename IT >
+struct MultTrait< HybridVector<T1,N,true>, CompressedMatrix<T2,SO,IT> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< CompressedMatrix<T1,SO>, DynamicVector<T2,false> >
+template< typename T1, bool SO, typename T2, typename IT >
+struct MultTrait< CompressedMatrix<T1,SO,IT>, DynamicVector<T2,false> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< DynamicVector<T1,true>, CompressedMatrix<T2,SO> >
+template< typename T1, typename T2, bool SO, typename IT >
+struct MultTrait< DynamicVector<T1,true>, CompressedMatrix<T2,SO,IT> >
 {
    typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, bool SO, typename T2 >
-struct MultTrait< CompressedMatrix<T1,SO>, CompressedVector<T2,false> >
+template< typename T1, bool SO, typename T2, typename IT1, typename IT2 >
+struct MultTrait< CompressedMatrix<T1,SO,IT1>, CompressedVector<T2,false,IT2> >
 {
    typedef CompressedVector< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, typename T2, bool SO >
-struct MultTrait< CompressedVector<T1,true>, CompressedMatrix<T2,SO> >
+template< typename T1, typename T2, bool SO, typename IT1, typename IT2 >
+struct MultTrait< CompressedVector<T1,true,IT1>, CompressedMatrix<T2,SO,IT2> >
 {
    typedef CompressedVector< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct MultTrait< CompressedMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct MultTrait< CompressedMatrix<T1,SO1,IT>, StaticMatrix<T2,M,N,SO2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct MultTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< StaticMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,IT> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
-struct MultTrait< CompressedMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct MultTrait< CompressedMatrix<T1,SO1,IT>, HybridMatrix<T2,M,N,SO2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
-struct MultTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< HybridMatrix<T1,M,N,SO1>, CompressedMatrix<T2,SO2,IT> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct MultTrait< CompressedMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< CompressedMatrix<T1,SO1,IT>, DynamicMatrix<T2,SO2> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct MultTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< DynamicMatrix<T1,SO1>, CompressedMatrix<T2,SO2,IT> >
 {
    typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
 
-template< typename T1, bool SO1, typename T2, bool SO2 >
-struct MultTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename IT2 >
+struct MultTrait< CompressedMatrix<T1,SO1,IT1>, CompressedMatrix<T2,SO2,IT2> >
 {
    typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
 };
@@ -5170,10 +5380,10 @@ struct MultTrait< CompressedMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct DivTrait< CompressedMatrix<T1,SO>, T2 >
+template< typename T1, bool SO, typename T2, typename IT >
+struct DivTrait< CompressedMatrix<T1,SO,IT>, T2 >
 {
-   typedef CompressedMatrix< typename DivTrait<T1,T2>::Type, SO >  Type;
+   typedef CompressedMatrix< typename DivTrait<T1,T2>::Type, SO, IT >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
 };
 /*! \endcond */
@@ -5190,8 +5400,8 @@ struct DivTrait< CompressedMatrix<T1,SO>, T2 >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct MathTrait< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename T2, typename IT1, typename IT2 >
+struct MathTrait< CompressedMatrix<T1,SO,IT1>, CompressedMatrix<T2,SO,IT2> >
 {
    typedef CompressedMatrix< typename MathTrait<T1,T2>::HighType, SO >  HighType;
    typedef CompressedMatrix< typename MathTrait<T1,T2>::LowType , SO >  LowType;
@@ -5210,10 +5420,10 @@ struct MathTrait< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO >
-struct SubmatrixTrait< CompressedMatrix<T1,SO> >
+template< typename T1, bool SO, typename IT >
+struct SubmatrixTrait< CompressedMatrix<T1,SO,IT> >
 {
-   typedef CompressedMatrix<T1,SO>  Type;
+   typedef CompressedMatrix<T1,SO,IT>  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -5229,10 +5439,10 @@ struct SubmatrixTrait< CompressedMatrix<T1,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO >
-struct RowTrait< CompressedMatrix<T1,SO> >
+template< typename T1, bool SO, typename IT >
+struct RowTrait< CompressedMatrix<T1,SO,IT> >
 {
-   typedef CompressedVector<T1,true>  Type;
+   typedef CompressedVector<T1,true,IT>  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -5248,10 +5458,10 @@ struct RowTrait< CompressedMatrix<T1,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO >
-struct ColumnTrait< CompressedMatrix<T1,SO> >
+template< typename T1, bool SO, typename IT >
+struct ColumnTrait< CompressedMatrix<T1,SO,IT> >
 {
-   typedef CompressedVector<T1,false>  Type;
+   typedef CompressedVector<T1,false,IT>  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -0,0 +1,3642 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/CompressedSoAMatrix.h
+//  \brief Implementation of a compressed MxN matrix with structure-of-arrays storage
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_COMPRESSEDSOAMATRIX_H_
+#define _BLAZE_MATH_SPARSE_COMPRESSEDSOAMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/MatrixAccessProxy.h>
+#include <blaze/math/sparse/SparseElement.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MathTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/HasSoAStorage.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsStrictlyLower.h>
+#include <blaze/math/typetraits/IsStrictlyUpper.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup compressed_soa_matrix CompressedSoAMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Compressed \f$ M \times N \f$ matrix with structure-of-arrays storage.
+// \ingroup compressed_soa_matrix
+//
+// The CompressedSoAMatrix class template is a sparse matrix in the classic CSR (row-major) or
+// CSC (column-major) format. In contrast to CompressedMatrix, which stores the value and the
+// index of each non-zero element in a single value-index-pair, CompressedSoAMatrix stores the
+// values and the indices of all non-zero elements in two separate, properly aligned arrays.
+// The type of the elements, the storage order of the matrix, and the type of the stored indices
+// can be specified via the three template parameters:
+
+   \code
+   template< typename Type, bool SO, typename IT >
+   class CompressedSoAMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. CompressedSoAMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//  - IT  : specifies the integral type used to store the column index (row-major) or the row
+//          index (column-major) of each non-zero element. The default value is \a size_t. The
+//          number of columns (row-major) or rows (column-major) must not exceed the range of
+//          this type.
+//
+// The separate arrays avoid the padding of value-index-pairs (for instance \a double values
+// with \a uint32_t indices require 12 instead of 16 bytes per element) and enable contiguous
+// vector loads of the values of a row/column. Combined with the gather instructions of AVX2,
+// the multiplications of a CompressedSoAMatrix with a dense vector or a dense matrix are
+// therefore fully vectorized.
+//
+// CompressedSoAMatrix provides the same interface as CompressedMatrix. Since the values and the
+// indices are not stored in a common element, the iterators of the matrix return an access
+// proxy instead of a reference to an element. This proxy provides the familiar \a value() and
+// \a index() member functions:
+
+   \code
+   using blaze::CompressedSoAMatrix;
+   using blaze::rowMajor;
+
+   CompressedSoAMatrix<double,rowMajor,unsigned int> A( 4, 3 );
+
+   A(1,2) = 2.0;            // Access via the function call operator
+   A.set( 2, 0, -1.2 );     // Setting a (new) element
+   A.insert( 2, 1, 3.7 );   // Inserting a new element
+   A.reserve( 3, 2 );       // Reserving space for 2 non-zero elements in row 3
+   A.append( 3, 1, -2.1 );  // Appending the value -2.1 at column index 1 in row 3
+
+   for( CompressedSoAMatrix<double,rowMajor,unsigned int>::Iterator i=A.begin(1); i!=A.end(1); ++i ) {
+      ... = i->value();  // Access to the value of the non-zero element
+      ... = i->index();  // Access to the index of the non-zero element
+   }
+
+   // Low-level access to the values and indices of the non-zero elements of row 2
+   const double*       values ( A.values ( 2 ) );
+   const unsigned int* indices( A.indices( 2 ) );
+   \endcode
+
+// Note that in contrast to CompressedMatrix a CompressedSoAMatrix is not used in SMP (shared
+// memory parallel) assignments, i.e. all multiplications with a CompressedSoAMatrix are executed
+// by the serial, vectorized kernels.
+*/
+template< typename Type                    // Data type of the sparse matrix
+        , bool SO = defaultStorageOrder    // Storage order
+        , typename IT >                    // Index type
+class CompressedSoAMatrix : public SparseMatrix< CompressedSoAMatrix<Type,SO,IT>, SO >
+{
+ private:
+   //**Private class FindIndex*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Helper class for the lower_bound() and upper_bound() functions.
+   */
+   struct FindIndex : public std::binary_function<size_t,size_t,bool>
+   {
+      inline bool operator()( size_t index1, size_t index2 ) const {
+         return index1 < index2;
+      }
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**SoAElement class definition*****************************************************************
+   /*!\brief Access proxy for a single non-zero element of a CompressedSoAMatrix.
+   //
+   // The SoAElement class combines the value and the index of a non-zero element, which are
+   // stored in two separate arrays, and provides the same interface as the value-index-pairs
+   // of CompressedMatrix.
+   */
+   template< typename VT >  // Type of the value (Type or const Type)
+   class SoAElement : private SparseElement
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef Type          ValueType;       //!< The value type of the element.
+      typedef size_t        IndexType;       //!< The index type of the element.
+      typedef VT&           Reference;       //!< Reference return type.
+      typedef const Type&   ConstReference;  //!< Reference-to-const return type.
+      typedef SoAElement*   Pointer;         //!< Pointer return type.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the SoAElement class.
+      //
+      // \param value Pointer to the value of the non-zero element.
+      // \param index Pointer to the index of the non-zero element.
+      */
+      inline SoAElement( VT* value, const IT* index )
+         : value_( value )  // Pointer to the value of the non-zero element
+         , index_( index )  // Pointer to the index of the non-zero element
+      {}
+      //*******************************************************************************************
+
+      //**Assignment operator**********************************************************************
+      /*!\brief Assignment to the accessed sparse matrix element.
+      //
+      // \param v The new value of the sparse matrix element.
+      // \return Reference to the sparse matrix element.
+      */
+      template< typename T > inline SoAElement& operator=( const T& v ) {
+         *value_ = v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment to the accessed sparse matrix element.
+      //
+      // \param v The right-hand side value for the addition.
+      // \return Reference to the sparse matrix element.
+      */
+      template< typename T > inline SoAElement& operator+=( const T& v ) {
+         *value_ += v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment to the accessed sparse matrix element.
+      //
+      // \param v The right-hand side value for the subtraction.
+      // \return Reference to the sparse matrix element.
+      */
+      template< typename T > inline SoAElement& operator-=( const T& v ) {
+         *value_ -= v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Multiplication assignment operator*******************************************************
+      /*!\brief Multiplication assignment to the accessed sparse matrix element.
+      //
+      // \param v The right-hand side value for the multiplication.
+      // \return Reference to the sparse matrix element.
+      */
+      template< typename T > inline SoAElement& operator*=( const T& v ) {
+         *value_ *= v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Division assignment operator*************************************************************
+      /*!\brief Division assignment to the accessed sparse matrix element.
+      //
+      // \param v The right-hand side value for the division.
+      // \return Reference to the sparse matrix element.
+      */
+      template< typename T > inline SoAElement& operator/=( const T& v ) {
+         *value_ /= v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline Pointer operator->() {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline Reference value() const {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline IndexType index() const {
+         return *index_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      VT*       value_;  //!< Pointer to the value of the non-zero element.
+      const IT* index_;  //!< Pointer to the index of the non-zero element.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**SoAIterator class definition****************************************************************
+   /*!\brief Iterator over the non-zero elements of a row/column of a CompressedSoAMatrix.
+   */
+   template< typename VT >  // Type of the value (Type or const Type)
+   class SoAIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::forward_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef SoAElement<VT>             ValueType;         //!< Type of the underlying elements.
+      typedef ValueType                  PointerType;       //!< Pointer return type.
+      typedef ValueType                  ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                  DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Default constructor**********************************************************************
+      /*!\brief Default constructor for the SoAIterator class.
+      */
+      inline SoAIterator()
+         : value_( NULL )  // Pointer to the value of the current non-zero element
+         , index_( NULL )  // Pointer to the index of the current non-zero element
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the SoAIterator class.
+      //
+      // \param value Pointer to the value of the current non-zero element.
+      // \param index Pointer to the index of the current non-zero element.
+      */
+      inline SoAIterator( VT* value, const IT* index )
+         : value_( value )  // Pointer to the value of the current non-zero element
+         , index_( index )  // Pointer to the index of the current non-zero element
+      {}
+      //*******************************************************************************************
+
+      //**Conversion constructor*******************************************************************
+      /*!\brief Conversion constructor from different SoAIterator instances.
+      //
+      // \param it The iterator to be copied.
+      */
+      template< typename VT2 >
+      inline SoAIterator( const SoAIterator<VT2>& it )
+         : value_( it.value_ )  // Pointer to the value of the current non-zero element
+         , index_( it.index_ )  // Pointer to the index of the current non-zero element
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline SoAIterator& operator++() {
+         ++value_;
+         ++index_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const SoAIterator operator++( int ) {
+         const SoAIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the current sparse matrix element.
+      //
+      // \return Access proxy for the current sparse matrix element.
+      */
+      inline ReferenceType operator*() const {
+         return ReferenceType( value_, index_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the current sparse matrix element.
+      //
+      // \return Access proxy for the current sparse matrix element.
+      */
+      inline PointerType operator->() const {
+         return PointerType( value_, index_ );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two SoAIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator==( const SoAIterator<VT2>& rhs ) const {
+         return index_ == rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two SoAIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      template< typename VT2 >
+      inline bool operator!=( const SoAIterator<VT2>& rhs ) const {
+         return index_ != rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two SoAIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      template< typename VT2 >
+      inline DifferenceType operator-( const SoAIterator<VT2>& rhs ) const {
+         return index_ - rhs.index_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      VT*       value_;  //!< Pointer to the value of the current non-zero element.
+      const IT* index_;  //!< Pointer to the index of the current non-zero element.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      /*! \cond BLAZE_INTERNAL */
+      template< typename VT2 > friend class SoAIterator;
+      friend class CompressedSoAMatrix;
+      /*! \endcond */
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef CompressedSoAMatrix<Type,SO,IT>   This;            //!< Type of this CompressedSoAMatrix instance.
+   typedef This                              ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedSoAMatrix<Type,!SO,IT>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedSoAMatrix<Type,!SO,IT>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                              ElementType;     //!< Type of the sparse matrix elements.
+   typedef IT                                IndexType;       //!< Type of the stored indices.
+   typedef const Type&                       ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                       CompositeType;   //!< Data type for composite expression templates.
+   typedef MatrixAccessProxy<This>           Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                       ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef SoAIterator<Type>                 Iterator;        //!< Iterator over non-constant elements.
+   typedef SoAIterator<const Type>           ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a CompressedSoAMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef CompressedSoAMatrix<ET,SO,IT>  Other;  //!< The type of the other CompressedSoAMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since the vectorized multiplication kernels for CompressedSoAMatrix work
+       on the complete matrix, the matrix is not used in SMP assignments. */
+   enum { smpAssignable = 0 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+                            explicit inline CompressedSoAMatrix();
+                            explicit inline CompressedSoAMatrix( size_t m, size_t n );
+                            explicit inline CompressedSoAMatrix( size_t m, size_t n, size_t nonzeros );
+                            explicit        CompressedSoAMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros );
+                                     inline CompressedSoAMatrix( const CompressedSoAMatrix& sm );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix( const DenseMatrix<MT,SO2>&  dm );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix( const SparseMatrix<MT,SO2>& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~CompressedSoAMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j );
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Iterator       begin  ( size_t i );
+   inline ConstIterator  begin  ( size_t i ) const;
+   inline ConstIterator  cbegin ( size_t i ) const;
+   inline Iterator       end    ( size_t i );
+   inline ConstIterator  end    ( size_t i ) const;
+   inline ConstIterator  cend   ( size_t i ) const;
+   inline Type*          values ( size_t i );
+   inline const Type*    values ( size_t i ) const;
+   inline const IT*      indices( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+                                     inline CompressedSoAMatrix& operator= ( const CompressedSoAMatrix& rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator= ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator= ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator*=( const Matrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, CompressedSoAMatrix >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, CompressedSoAMatrix >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t               rows() const;
+                              inline size_t               columns() const;
+                              inline size_t               capacity() const;
+                              inline size_t               capacity( size_t i ) const;
+                              inline size_t               nonZeros() const;
+                              inline size_t               nonZeros( size_t i ) const;
+                              inline void                 reset();
+                              inline void                 reset( size_t i );
+                              inline void                 clear();
+                              inline Iterator             set    ( size_t i, size_t j, const Type& value );
+                              inline Iterator             insert ( size_t i, size_t j, const Type& value );
+                              inline void                 erase  ( size_t i, size_t j );
+                              inline Iterator             erase  ( size_t i, Iterator pos );
+                              inline Iterator             erase  ( size_t i, Iterator first, Iterator last );
+                                     void                 resize ( size_t m, size_t n, bool preserve=true );
+                              inline void                 reserve( size_t nonzeros );
+                                     void                 reserve( size_t i, size_t nonzeros );
+                              inline void                 trim   ();
+                              inline void                 trim   ( size_t i );
+                              inline CompressedSoAMatrix& transpose();
+   template< typename Other > inline CompressedSoAMatrix& scale( const Other& scalar );
+   template< typename Other > inline CompressedSoAMatrix& scaleDiagonal( Other scalar );
+                              inline void                 swap( CompressedSoAMatrix& sm ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline Iterator      upperBound( size_t i, size_t j );
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline void append  ( size_t i, size_t j, const Type& value, bool check=false );
+   inline void finalize( size_t i );
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool canSMPAssign() const;
+
+   template< typename MT, bool SO2 > inline void assign   ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT >           inline void assign   ( const SparseMatrix<MT,SO>&  rhs );
+   template< typename MT >           inline void assign   ( const SparseMatrix<MT,!SO>& rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void addAssign( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void subAssign( const SparseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t   lines() const;
+   inline Iterator iterator( size_t pos );
+   inline ConstIterator iterator( size_t pos ) const;
+   inline size_t   lowerBoundOffset( size_t k, size_t l ) const;
+   inline size_t   upperBoundOffset( size_t k, size_t l ) const;
+          Iterator insert( size_t pos, size_t k, size_t l, const Type& value );
+   inline void     copyElements( size_t first, size_t last, size_t dest );
+   inline void     copyElementsBackward( size_t first, size_t last, size_t dest );
+   inline size_t   extendCapacity() const;
+          void     reserveElements( size_t nonzeros );
+
+   static inline size_t checkIndexRange( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t  m_;         //!< The current number of rows of the sparse matrix.
+   size_t  n_;         //!< The current number of columns of the sparse matrix.
+   size_t  capacity_;  //!< The current capacity of the offset arrays.
+   size_t* begin_;     //!< Offsets of the first non-zero element of each row/column.
+   size_t* end_;       //!< Offsets one past the last non-zero element of each row/column.
+   IT*     index_;     //!< The indices of all non-zero elements.
+   Type*   value_;     //!< The values of all non-zero elements.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE     ( IT   );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+const Type CompressedSoAMatrix<Type,SO,IT>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CompressedSoAMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix()
+   : m_       ( 0UL )            // The current number of rows of the sparse matrix
+   , n_       ( 0UL )            // The current number of columns of the sparse matrix
+   , capacity_( 0UL )            // The current capacity of the offset arrays
+   , begin_   ( new size_t[2] )  // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+1 )       // Offsets one past the last non-zero element of each row/column
+   , index_   ( NULL )           // The indices of all non-zero elements
+   , value_   ( NULL )           // The values of all non-zero elements
+{
+   begin_[0UL] = end_[0UL] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix( size_t m, size_t n )
+   : m_       ( SO ? checkIndexRange( m ) : m )       // The current number of rows of the sparse matrix
+   , n_       ( SO ? n : checkIndexRange( n ) )       // The current number of columns of the sparse matrix
+   , capacity_( SO ? n : m )                          // The current capacity of the offset arrays
+   , begin_   ( new size_t[2UL*capacity_+2UL] )       // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+(capacity_+1UL) )              // Offsets one past the last non-zero element of each row/column
+   , index_   ( NULL )                                // The indices of all non-zero elements
+   , value_   ( NULL )                                // The values of all non-zero elements
+{
+   std::fill( begin_, begin_+2UL*capacity_+2UL, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of expected non-zero elements.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix( size_t m, size_t n, size_t nonzeros )
+   : m_       ( SO ? checkIndexRange( m ) : m )       // The current number of rows of the sparse matrix
+   , n_       ( SO ? n : checkIndexRange( n ) )       // The current number of columns of the sparse matrix
+   , capacity_( SO ? n : m )                          // The current capacity of the offset arrays
+   , begin_   ( new size_t[2UL*capacity_+2UL] )       // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+(capacity_+1UL) )              // Offsets one past the last non-zero element of each row/column
+   , index_   ( allocate<IT>( nonzeros ) )            // The indices of all non-zero elements
+   , value_   ( allocate<Type>( nonzeros ) )          // The values of all non-zero elements
+{
+   std::fill( begin_, begin_+2UL*capacity_+1UL, 0UL );
+   end_[capacity_] = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The expected number of non-zero elements in each row/column.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix and will have the specified capacity in each
+// row/column. Note that in case of a row-major matrix the given vector must have at least
+// \a m elements, in case of a column-major matrix at least \a n elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+   : m_       ( SO ? checkIndexRange( m ) : m )       // The current number of rows of the sparse matrix
+   , n_       ( SO ? n : checkIndexRange( n ) )       // The current number of columns of the sparse matrix
+   , capacity_( SO ? n : m )                          // The current capacity of the offset arrays
+   , begin_   ( new size_t[2UL*capacity_+2UL] )       // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+(capacity_+1UL) )              // Offsets one past the last non-zero element of each row/column
+   , index_   ( NULL )                                // The indices of all non-zero elements
+   , value_   ( NULL )                                // The values of all non-zero elements
+{
+   BLAZE_USER_ASSERT( nonzeros.size() == capacity_, "Size of capacity vector and number of rows/columns don't match" );
+
+   size_t newCapacity( 0UL );
+   for( std::vector<size_t>::const_iterator it=nonzeros.begin(); it!=nonzeros.end(); ++it )
+      newCapacity += *it;
+
+   index_ = allocate<IT>( newCapacity );
+   value_ = allocate<Type>( newCapacity );
+
+   begin_[0UL] = end_[0UL] = 0UL;
+   for( size_t k=0UL; k<capacity_; ++k ) {
+      begin_[k+1UL] = end_[k+1UL] = begin_[k] + nonzeros[k];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for CompressedSoAMatrix.
+//
+// \param sm Sparse matrix to be copied.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix( const CompressedSoAMatrix& sm )
+   : m_       ( sm.m_ )                               // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )                               // The current number of columns of the sparse matrix
+   , capacity_( sm.lines() )                          // The current capacity of the offset arrays
+   , begin_   ( new size_t[2UL*capacity_+2UL] )       // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+(capacity_+1UL) )              // Offsets one past the last non-zero element of each row/column
+   , index_   ( allocate<IT>( sm.nonZeros() ) )       // The indices of all non-zero elements
+   , value_   ( allocate<Type>( sm.nonZeros() ) )     // The values of all non-zero elements
+{
+   begin_[0UL] = 0UL;
+   for( size_t k=0UL; k<capacity_; ++k ) {
+      std::copy( sm.index_+sm.begin_[k], sm.index_+sm.end_[k], index_+begin_[k] );
+      std::copy( sm.value_+sm.begin_[k], sm.value_+sm.end_[k], value_+begin_[k] );
+      begin_[k+1UL] = end_[k] = begin_[k] + sm.nonZeros( k );
+   }
+   end_[capacity_] = begin_[capacity_];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense matrices.
+//
+// \param dm Dense matrix to be copied.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the foreign dense matrix
+        , bool SO2 >     // Storage order of the foreign dense matrix
+inline CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix( const DenseMatrix<MT,SO2>& dm )
+   : m_       ( SO ? checkIndexRange( (~dm).rows() ) : (~dm).rows() )        // The current number of rows of the sparse matrix
+   , n_       ( SO ? (~dm).columns() : checkIndexRange( (~dm).columns() ) )  // The current number of columns of the sparse matrix
+   , capacity_( SO ? n_ : m_ )                                               // The current capacity of the offset arrays
+   , begin_   ( new size_t[2UL*capacity_+2UL] )                              // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+(capacity_+1UL) )                                     // Offsets one past the last non-zero element of each row/column
+   , index_   ( NULL )                                                       // The indices of all non-zero elements
+   , value_   ( NULL )                                                       // The values of all non-zero elements
+{
+   using blaze::assign;
+
+   std::fill( begin_, begin_+2UL*capacity_+2UL, 0UL );
+
+   assign( *this, ~dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different sparse matrices.
+//
+// \param sm Sparse matrix to be copied.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the foreign sparse matrix
+        , bool SO2 >     // Storage order of the foreign sparse matrix
+inline CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix( const SparseMatrix<MT,SO2>& sm )
+   : m_       ( SO ? checkIndexRange( (~sm).rows() ) : (~sm).rows() )        // The current number of rows of the sparse matrix
+   , n_       ( SO ? (~sm).columns() : checkIndexRange( (~sm).columns() ) )  // The current number of columns of the sparse matrix
+   , capacity_( SO ? n_ : m_ )                                               // The current capacity of the offset arrays
+   , begin_   ( new size_t[2UL*capacity_+2UL] )                              // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+(capacity_+1UL) )                                     // Offsets one past the last non-zero element of each row/column
+   , index_   ( allocate<IT>( (~sm).nonZeros() ) )                           // The indices of all non-zero elements
+   , value_   ( allocate<Type>( (~sm).nonZeros() ) )                         // The values of all non-zero elements
+{
+   using blaze::assign;
+
+   std::fill( begin_, begin_+2UL*capacity_+1UL, 0UL );
+   end_[capacity_] = (~sm).nonZeros();
+
+   assign( *this, ~sm );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for CompressedSoAMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedSoAMatrix<Type,SO,IT>::~CompressedSoAMatrix()
+{
+   deallocate( index_ );
+   deallocate( value_ );
+   delete [] begin_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::Reference
+   CompressedSoAMatrix<Type,SO,IT>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return Reference( *this, i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstReference
+   CompressedSoAMatrix<Type,SO,IT>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( lowerBoundOffset( k, l ) );
+
+   if( pos == end_[k] || index_[pos] != l )
+      return zero_;
+   else
+      return value_[pos];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::begin( size_t i )
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   return iterator( begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,IT>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   return iterator( begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,IT>::cbegin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   return iterator( begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::end( size_t i )
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   return iterator( end_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,IT>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   return iterator( end_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,IT>::cend( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   return iterator( end_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the values of the non-zero elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the value of the first non-zero element of row/column \a i.
+//
+// This function returns a pointer to the contiguously stored values of the nonZeros(i) non-zero
+// elements of row/column \a i. Note that the returned pointer is not necessarily aligned.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline Type* CompressedSoAMatrix<Type,SO,IT>::values( size_t i )
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   return value_ + begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the values of the non-zero elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the value of the first non-zero element of row/column \a i.
+//
+// This function returns a pointer to the contiguously stored values of the nonZeros(i) non-zero
+// elements of row/column \a i. Note that the returned pointer is not necessarily aligned.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline const Type* CompressedSoAMatrix<Type,SO,IT>::values( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   return value_ + begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the indices of the non-zero elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the index of the first non-zero element of row/column \a i.
+//
+// This function returns a pointer to the contiguously stored, strictly increasing indices of
+// the nonZeros(i) non-zero elements of row/column \a i. Note that the returned pointer is not
+// necessarily aligned.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline const IT* CompressedSoAMatrix<Type,SO,IT>::indices( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid sparse matrix row/column access index" );
+   return index_ + begin_[i];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for CompressedSoAMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+//
+// The sparse matrix is resized according to the given sparse matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator=( const CompressedSoAMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   const size_t lines( rhs.lines() );
+
+   if( lines > capacity_ || rhs.nonZeros() > capacity() )
+   {
+      CompressedSoAMatrix tmp( rhs );
+      swap( tmp );
+   }
+   else
+   {
+      const size_t total( capacity() );
+
+      for( size_t k=0UL; k<lines; ++k ) {
+         std::copy( rhs.index_+rhs.begin_[k], rhs.index_+rhs.end_[k], index_+begin_[k] );
+         std::copy( rhs.value_+rhs.begin_[k], rhs.value_+rhs.end_[k], value_+begin_[k] );
+         begin_[k+1UL] = end_[k] = begin_[k] + rhs.nonZeros( k );
+      }
+      end_[lines] = total;
+
+      m_ = rhs.m_;
+      n_ = rhs.n_;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense matrices.
+//
+// \param rhs Dense matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator=( const DenseMatrix<MT,SO2>& rhs )
+{
+   using blaze::assign;
+
+   if( (~rhs).canAlias( this ) ) {
+      CompressedSoAMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false );
+      assign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different sparse matrices.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator=( const SparseMatrix<MT,SO2>& rhs )
+{
+   using blaze::assign;
+
+   if( (~rhs).canAlias( this ) ||
+       ( SO ? (~rhs).columns() : (~rhs).rows() ) > capacity_ ||
+       (~rhs).nonZeros() > capacity() ) {
+      CompressedSoAMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false );
+      reset();
+      assign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::addAssign;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   addAssign( *this, ~rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::subAssign;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   subAssign( *this, ~rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two given matrices don't match, a \a std::invalid_argument
+// is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator*=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   CompressedSoAMatrix tmp( *this * (~rhs) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a sparse matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, CompressedSoAMatrix<Type,SO,IT> >::Type&
+   CompressedSoAMatrix<Type,SO,IT>::operator*=( Other rhs )
+{
+   const size_t lines( this->lines() );
+
+   for( size_t k=0UL; k<lines; ++k )
+      for( size_t pos=begin_[k]; pos<end_[k]; ++pos )
+         value_[pos] *= rhs;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a sparse matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, CompressedSoAMatrix<Type,SO,IT> >::Type&
+   CompressedSoAMatrix<Type,SO,IT>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   typedef typename DivTrait<Type,Other>::Type  DT;
+   typedef typename If< IsNumeric<DT>, DT, Other >::Type  Tmp;
+
+   const size_t lines( this->lines() );
+
+   // Depending on the two involved data types, an integer division is applied or a
+   // floating point division is selected.
+   if( IsNumeric<DT>::value && IsFloatingPoint<DT>::value ) {
+      const Tmp tmp( Tmp(1)/static_cast<Tmp>( rhs ) );
+      for( size_t k=0UL; k<lines; ++k )
+         for( size_t pos=begin_[k]; pos<end_[k]; ++pos )
+            value_[pos] *= tmp;
+   }
+   else {
+      for( size_t k=0UL; k<lines; ++k )
+         for( size_t pos=begin_[k]; pos<end_[k]; ++pos )
+            value_[pos] /= rhs;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedSoAMatrix<Type,SO,IT>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedSoAMatrix<Type,SO,IT>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedSoAMatrix<Type,SO,IT>::capacity() const
+{
+   return end_[lines()];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// This function returns the current capacity of the specified row/column. In case the
+// storage order is set to \a rowMajor the function returns the capacity of row \a i,
+// in case the storage flag is set to \a columnMajor the function returns the capacity
+// of column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedSoAMatrix<Type,SO,IT>::capacity( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   return begin_[i+1UL] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedSoAMatrix<Type,SO,IT>::nonZeros() const
+{
+   const size_t lines( this->lines() );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<lines; ++k )
+      nonzeros += nonZeros( k );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedSoAMatrix<Type,SO,IT>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   return end_[i] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedSoAMatrix<Type,SO,IT>::reset()
+{
+   const size_t lines( this->lines() );
+
+   for( size_t k=0UL; k<lines; ++k )
+      end_[k] = begin_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column to be reset.
+// \return void
+//
+// This function resets the values in the specified row/column to their default value. In case
+// the storage order is set to \a rowMajor the function resets the values in row \a i, in case
+// the storage order is set to \a columnMajor the function resets the values in column \a i.
+// Note that the capacity of the row/column remains unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedSoAMatrix<Type,SO,IT>::reset( size_t i )
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   end_[i] = begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedSoAMatrix<Type,SO,IT>::clear()
+{
+   end_[0UL] = end_[lines()];
+   m_ = 0UL;
+   n_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting an element of the compressed matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Iterator to the set element.
+//
+// This function sets the value of an element of the compressed matrix. In case the sparse matrix
+// already contains an element with row index \a i and column index \a j its value is modified,
+// else a new element with the given \a value is inserted.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::set( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( lowerBoundOffset( k, l ) );
+
+   if( pos != end_[k] && index_[pos] == l ) {
+      value_[pos] = value;
+      return iterator( pos );
+   }
+   else return insert( pos, k, l, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the compressed matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+// \exception std::invalid_argument Invalid compressed matrix access index.
+//
+// This function inserts a new element into the compressed matrix. However, duplicate elements are
+// not allowed. In case the sparse matrix already contains an element with row index \a i and
+// column index \a j, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::insert( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( lowerBoundOffset( k, l ) );
+
+   if( pos != end_[k] && index_[pos] == l )
+      throw std::invalid_argument( "Bad access index" );
+
+   return insert( pos, k, l, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the compressed matrix.
+//
+// \param pos The offset of the new element within the index and value arrays.
+// \param k The row/column index of the new element.
+// \param l The column/row index of the new element.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::insert( size_t pos, size_t k, size_t l, const Type& value )
+{
+   const size_t lines( this->lines() );
+
+   if( begin_[k+1UL] - end_[k] != 0UL ) {
+      copyElementsBackward( pos, end_[k], end_[k]+1UL );
+      ++end_[k];
+   }
+   else {
+      if( end_[lines] - begin_[lines] == 0UL ) {
+         reserveElements( extendCapacity() );
+      }
+
+      copyElementsBackward( pos, end_[lines-1UL], end_[lines-1UL]+1UL );
+
+      for( size_t kk=k+1UL; kk<lines+1UL; ++kk ) {
+         ++begin_[kk];
+         ++end_[kk-1UL];
+      }
+   }
+
+   index_[pos] = l;
+   value_[pos] = value;
+
+   return iterator( pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the sparse matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedSoAMatrix<Type,SO,IT>::erase( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( lowerBoundOffset( k, l ) );
+
+   if( pos != end_[k] && index_[pos] == l ) {
+      copyElements( pos+1UL, end_[k], pos );
+      --end_[k];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the sparse matrix.
+//
+// \param i The row/column index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param pos Iterator to the element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases an element from the sparse matrix. In case the storage order is set to
+// \a rowMajor the function erases an element from row \a i, in case the storage flag is set to
+// \a columnMajor the function erases an element from column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::erase( size_t i, Iterator pos )
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+
+   const size_t offset( pos.index_ - index_ );
+
+   BLAZE_USER_ASSERT( offset >= begin_[i] && offset <= end_[i], "Invalid compressed matrix iterator" );
+
+   if( offset != end_[i] ) {
+      copyElements( offset+1UL, end_[i], offset );
+      --end_[i];
+   }
+
+   return pos;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing a range of elements from the sparse matrix.
+//
+// \param i The row/column index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param first Iterator to first element to be erased.
+// \param last Iterator just past the last element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases a range of elements from the sparse matrix. In case the storage order is
+// set to \a rowMajor the function erases a range of elements element from row \a i, in case the
+// storage flag is set to \a columnMajor the function erases a range of elements from column \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::erase( size_t i, Iterator first, Iterator last )
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+
+   const size_t offset1( first.index_ - index_ );
+   const size_t offset2( last.index_  - index_ );
+
+   BLAZE_USER_ASSERT( offset1 <= offset2, "Invalid iterator range" );
+   BLAZE_USER_ASSERT( offset1 >= begin_[i] && offset1 <= end_[i], "Invalid compressed matrix iterator" );
+   BLAZE_USER_ASSERT( offset2 >= begin_[i] && offset2 <= end_[i], "Invalid compressed matrix iterator" );
+
+   if( offset1 != offset2 ) {
+      copyElements( offset2, end_[i], offset1 );
+      end_[i] -= offset2 - offset1;
+   }
+
+   return first;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the sparse matrix.
+//
+// \param m The new number of rows of the sparse matrix.
+// \param n The new number of columns of the sparse matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
+// potentially changes all matrix elements. In order to preserve the old matrix values, the
+// \a preserve flag can be set to \a true.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void CompressedSoAMatrix<Type,SO,IT>::resize( size_t m, size_t n, bool preserve )
+{
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+
+   checkIndexRange( SO ? m : n );
+
+   if( m == m_ && n == n_ ) return;
+
+   const size_t oldLines( lines() );
+   const size_t newLines( SO ? n : m );
+   const size_t newMinor( SO ? m : n );
+
+   if( newLines > capacity_ )
+   {
+      size_t* newBegin( new size_t[2UL*newLines+2UL] );
+      size_t* newEnd  ( newBegin+newLines+1UL );
+
+      newBegin[0UL] = 0UL;
+
+      if( preserve ) {
+         for( size_t k=0UL; k<oldLines; ++k ) {
+            newEnd  [k]     = end_  [k];
+            newBegin[k+1UL] = begin_[k+1UL];
+         }
+         for( size_t k=oldLines; k<newLines; ++k ) {
+            newBegin[k+1UL] = newEnd[k] = begin_[oldLines];
+         }
+      }
+      else {
+         for( size_t k=0UL; k<newLines; ++k ) {
+            newBegin[k+1UL] = newEnd[k] = 0UL;
+         }
+      }
+
+      newEnd[newLines] = end_[oldLines];
+
+      std::swap( newBegin, begin_ );
+      delete [] newBegin;
+      end_ = newEnd;
+      capacity_ = newLines;
+   }
+   else if( newLines > oldLines )
+   {
+      end_[newLines] = end_[oldLines];
+
+      if( !preserve ) {
+         for( size_t k=0UL; k<oldLines; ++k )
+            end_[k] = begin_[k];
+      }
+
+      for( size_t k=oldLines; k<newLines; ++k )
+         begin_[k+1UL] = end_[k] = begin_[oldLines];
+   }
+   else
+   {
+      const size_t total( end_[oldLines] );
+
+      if( !preserve ) {
+         for( size_t k=0UL; k<newLines; ++k )
+            end_[k] = begin_[k];
+      }
+
+      end_[newLines] = total;
+   }
+
+   if( preserve ) {
+      const size_t lines( blaze::min( oldLines, newLines ) );
+      for( size_t k=0UL; k<lines; ++k )
+         end_[k] = lowerBoundOffset( k, newMinor );
+   }
+
+   m_ = m;
+   n_ = n;
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the sparse matrix.
+//
+// \param nonzeros The new minimum capacity of the sparse matrix.
+// \return void
+//
+// This function increases the capacity of the sparse matrix to at least \a nonzeros elements.
+// The current values of the matrix elements and the individual capacities of the matrix rows
+// are preserved.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedSoAMatrix<Type,SO,IT>::reserve( size_t nonzeros )
+{
+   if( nonzeros > capacity() )
+      reserveElements( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of a specific row/column of the sparse matrix.
+//
+// \param i The row/column index \f$[0..M-1]\f$ or \f$[0..N-1]\f$.
+// \param nonzeros The new minimum capacity of the specified row/column.
+// \return void
+//
+// This function increases the capacity of row/column \a i of the sparse matrix to at least
+// \a nonzeros elements. The current values of the sparse matrix and all other individual
+// row/column capacities are preserved. In case the storage order is set to \a rowMajor, the
+// function reserves capacity for row \a i and the index has to be in the range \f$[0..M-1]\f$.
+// In case the storage order is set to \a columnMajor, the function reserves capacity for column
+// \a i and the index has to be in the range \f$[0..N-1]\f$.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void CompressedSoAMatrix<Type,SO,IT>::reserve( size_t i, size_t nonzeros )
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+
+   const size_t current( capacity(i) );
+
+   if( current >= nonzeros ) return;
+
+   const size_t lines( this->lines() );
+   const size_t additional( nonzeros - current );
+
+   if( end_[lines] - begin_[lines] < additional )
+   {
+      const size_t newCapacity( begin_[lines] + additional );
+      BLAZE_INTERNAL_ASSERT( newCapacity > capacity(), "Invalid capacity value" );
+
+      size_t* newBegin( new size_t[2UL*lines+2UL] );
+      size_t* newEnd  ( newBegin+lines+1UL );
+      IT*     newIndex( allocate<IT>( newCapacity ) );
+      Type*   newValue( allocate<Type>( newCapacity ) );
+
+      newBegin[0UL] = 0UL;
+
+      for( size_t k=0UL; k<lines; ++k ) {
+         std::copy( index_+begin_[k], index_+end_[k], newIndex+newBegin[k] );
+         std::copy( value_+begin_[k], value_+end_[k], newValue+newBegin[k] );
+         newEnd  [k]     = newBegin[k] + nonZeros(k);
+         newBegin[k+1UL] = newBegin[k] + ( ( k == i )?( nonzeros ):( capacity(k) ) );
+      }
+      newEnd[lines] = newCapacity;
+
+      BLAZE_INTERNAL_ASSERT( newBegin[lines] == newEnd[lines], "Invalid offset calculations" );
+
+      std::swap( newBegin, begin_ );
+      std::swap( newIndex, index_ );
+      std::swap( newValue, value_ );
+      delete [] newBegin;
+      deallocate( newIndex );
+      deallocate( newValue );
+      end_ = newEnd;
+      capacity_ = lines;
+   }
+   else
+   {
+      begin_[lines] += additional;
+      for( size_t k=lines-1UL; k>i; --k ) {
+         copyElementsBackward( begin_[k], end_[k], end_[k]+additional );
+         begin_[k] += additional;
+         end_  [k] += additional;
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity from all rows/columns.
+//
+// \return void
+//
+// The trim() function can be used to reverse the effect of all row/column-specific reserve()
+// calls. The function removes all excessive capacity from all rows (in case of a rowMajor
+// matrix) or columns (in case of a columnMajor matrix). Note that this function does not
+// remove the overall capacity but only reduces the capacity per row/column.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedSoAMatrix<Type,SO,IT>::trim()
+{
+   const size_t lines( this->lines() );
+
+   for( size_t k=0UL; k<lines; ++k )
+      trim( k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity of a specific row/column of the sparse matrix.
+//
+// \param i The index of the row/column to be trimmed (\f$[0..M-1]\f$ or \f$[0..N-1]\f$).
+// \return void
+//
+// This function can be used to reverse the effect of a row/column-specific reserve() call.
+// It removes all excessive capacity from the specified row (in case of a rowMajor matrix)
+// or column (in case of a columnMajor matrix). The excessive capacity is assigned to the
+// subsequent row/column.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedSoAMatrix<Type,SO,IT>::trim( size_t i )
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+
+   if( i < ( lines() - 1UL ) ) {
+      const size_t nonzeros( nonZeros( i+1UL ) );
+      copyElements( begin_[i+1UL], end_[i+1UL], end_[i] );
+      end_[i+1UL] = end_[i] + nonzeros;
+   }
+   begin_[i+1UL] = end_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Transposing the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedSoAMatrix<Type,SO,IT>& CompressedSoAMatrix<Type,SO,IT>::transpose()
+{
+   CompressedSoAMatrix tmp( trans( *this ) );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the sparse matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the sparse matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the scalar value
+inline CompressedSoAMatrix<Type,SO,IT>& CompressedSoAMatrix<Type,SO,IT>::scale( const Other& scalar )
+{
+   const size_t lines( this->lines() );
+
+   for( size_t k=0UL; k<lines; ++k )
+      for( size_t pos=begin_[k]; pos<end_[k]; ++pos )
+         value_[pos] *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling the diagonal of the sparse matrix by the scalar value \a scalar.
+//
+// \param scalar The scalar value for the diagonal scaling.
+// \return Reference to the sparse matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the scalar value
+inline CompressedSoAMatrix<Type,SO,IT>& CompressedSoAMatrix<Type,SO,IT>::scaleDiagonal( Other scalar )
+{
+   const size_t size( blaze::min( m_, n_ ) );
+
+   for( size_t k=0UL; k<size; ++k ) {
+      const size_t pos( lowerBoundOffset( k, k ) );
+      if( pos != end_[k] && index_[pos] == k )
+         value_[pos] *= scalar;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedSoAMatrix<Type,SO,IT>::swap( CompressedSoAMatrix& sm ) /* throw() */
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( capacity_, sm.capacity_ );
+   std::swap( begin_, sm.begin_ );
+   std::swap( end_  , sm.end_   );
+   std::swap( index_, sm.index_ );
+   std::swap( value_, sm.value_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows (row-major) or columns (column-major) of the matrix.
+//
+// \return The number of rows/columns of the matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedSoAMatrix<Type,SO,IT>::lines() const
+{
+   return ( SO )?( n_ ):( m_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates an iterator to the element at the given offset.
+//
+// \param pos The offset of the element within the index and value arrays.
+// \return Iterator to the element at the given offset.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::iterator( size_t pos )
+{
+   return Iterator( value_+pos, index_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates an iterator to the element at the given offset.
+//
+// \param pos The offset of the element within the index and value arrays.
+// \return Iterator to the element at the given offset.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,IT>::iterator( size_t pos ) const
+{
+   return ConstIterator( value_+pos, index_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving a range of elements towards the front of the index and value arrays.
+//
+// \param first The offset of the first element to be moved.
+// \param last The offset one past the last element to be moved.
+// \param dest The new offset of the first element (\f$ dest \le first \f$).
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedSoAMatrix<Type,SO,IT>::copyElements( size_t first, size_t last, size_t dest )
+{
+   std::copy( index_+first, index_+last, index_+dest );
+   std::copy( value_+first, value_+last, value_+dest );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving a range of elements towards the back of the index and value arrays.
+//
+// \param first The offset of the first element to be moved.
+// \param last The offset one past the last element to be moved.
+// \param dest The new offset one past the last element (\f$ dest \ge last \f$).
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedSoAMatrix<Type,SO,IT>::copyElementsBackward( size_t first, size_t last, size_t dest )
+{
+   std::copy_backward( index_+first, index_+last, index_+dest );
+   std::copy_backward( value_+first, value_+last, value_+dest );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating a new matrix capacity.
+//
+// \return The new compressed matrix capacity.
+//
+// This function calculates a new matrix capacity based on the current capacity of the sparse
+// matrix. Note that the new capacity is restricted to the interval \f$[7..M \cdot N]\f$.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedSoAMatrix<Type,SO,IT>::extendCapacity() const
+{
+   size_t nonzeros( 2UL*capacity()+1UL );
+   nonzeros = blaze::max( nonzeros, 7UL   );
+
+   BLAZE_INTERNAL_ASSERT( nonzeros > capacity(), "Invalid capacity value" );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking whether all minor indices of the matrix can be stored.
+//
+// \param n The number of columns (row-major) or rows (column-major) of the matrix.
+// \return The given number \a n.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// This function checks whether the largest column index (row-major) or row index (column-major)
+// of a matrix with \a n columns/rows can be represented by the index type \a IT. In case the
+// number exceeds the range of the index type, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedSoAMatrix<Type,SO,IT>::checkIndexRange( size_t n )
+{
+   if( n > 0UL && n-1UL > static_cast<size_t>( std::numeric_limits<IT>::max() ) )
+      throw std::invalid_argument( "Matrix size exceeds the range of the index type" );
+   return n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reserving the specified number of sparse matrix elements.
+//
+// \param nonzeros The number of matrix elements to be reserved.
+// \return void
+//
+// Since the positions of the rows/columns are stored as offsets, reallocating the index and
+// value arrays does not affect the layout of the matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void CompressedSoAMatrix<Type,SO,IT>::reserveElements( size_t nonzeros )
+{
+   const size_t lines( this->lines() );
+
+   IT*   newIndex( allocate<IT>( nonzeros ) );
+   Type* newValue( allocate<Type>( nonzeros ) );
+
+   for( size_t k=0UL; k<lines; ++k ) {
+      BLAZE_INTERNAL_ASSERT( begin_[k] <= end_[k], "Invalid row/column offsets" );
+      std::copy( index_+begin_[k], index_+end_[k], newIndex+begin_[k] );
+      std::copy( value_+begin_[k], value_+end_[k], newValue+begin_[k] );
+   }
+
+   end_[lines] = nonzeros;
+
+   std::swap( newIndex, index_ );
+   std::swap( newValue, value_ );
+   deallocate( newIndex );
+   deallocate( newValue );
+}
+//*************************************************************************************************
+
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned. Note that the returned compressed matrix iterator is subject
+// to invalidation due to inserting operations via the function call operator or the insert()
+// function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::find( size_t i, size_t j )
+{
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( lowerBoundOffset( k, l ) );
+
+   if( pos != end_[k] && index_[pos] == l )
+      return iterator( pos );
+   else return iterator( end_[k] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned. Note that the returned compressed matrix iterator is subject
+// to invalidation due to inserting operations via the function call operator or the insert()
+// function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,IT>::find( size_t i, size_t j ) const
+{
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( lowerBoundOffset( k, l ) );
+
+   if( pos != end_[k] && index_[pos] == l )
+      return iterator( pos );
+   else return iterator( end_[k] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed matrix
+// iterator is subject to invalidation due to inserting operations via the function call
+// operator or the insert() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j )
+{
+   return iterator( lowerBoundOffset( SO ? j : i, SO ? i : j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed matrix
+// iterator is subject to invalidation due to inserting operations via the function call
+// operator or the insert() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j ) const
+{
+   return iterator( lowerBoundOffset( SO ? j : i, SO ? i : j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the lowerBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed matrix
+// iterator is subject to invalidation due to inserting operations via the function call
+// operator or the insert() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::upperBound( size_t i, size_t j )
+{
+   return iterator( upperBoundOffset( SO ? j : i, SO ? i : j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the lowerBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed matrix
+// iterator is subject to invalidation due to inserting operations via the function call
+// operator or the insert() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,IT>::upperBound( size_t i, size_t j ) const
+{
+   return iterator( upperBoundOffset( SO ? j : i, SO ? i : j ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the first element of row/column \a k with an index not less
+//        than \a l.
+//
+// \param k The row/column index.
+// \param l The column/row index of the search element.
+// \return The offset of the element within the index and value arrays.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedSoAMatrix<Type,SO,IT>::lowerBoundOffset( size_t k, size_t l ) const
+{
+   BLAZE_USER_ASSERT( k < lines(), "Invalid row/column access index" );
+   return std::lower_bound( index_+begin_[k], index_+end_[k], l, FindIndex() ) - index_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the first element of row/column \a k with an index greater
+//        than \a l.
+//
+// \param k The row/column index.
+// \param l The column/row index of the search element.
+// \return The offset of the element within the index and value arrays.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedSoAMatrix<Type,SO,IT>::upperBoundOffset( size_t k, size_t l ) const
+{
+   BLAZE_USER_ASSERT( k < lines(), "Invalid row/column access index" );
+   return std::upper_bound( index_+begin_[k], index_+end_[k], l, FindIndex() ) - index_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Appending an element to the specified row/column of the sparse matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be appended.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+//
+// This function provides a very efficient way to fill a compressed matrix with elements. It
+// appends a new element to the end of the specified row/column without any additional memory
+// allocation. Therefore it is strictly necessary to keep the following preconditions in mind:
+//
+//  - the index of the new element must be strictly larger than the largest index of non-zero
+//    elements in the specified row/column of the sparse matrix
+//  - the current number of non-zero elements in the matrix must be smaller than the capacity
+//    of the matrix
+//
+// Ignoring these preconditions might result in undefined behavior! The optional \a check
+// parameter specifies whether the new value should be tested for a default value. If the new
+// value is a default value (for instance 0 in case of an integral element type) the value is
+// not appended. Per default the values are not tested.
+//
+// \note Although append() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedSoAMatrix<Type,SO,IT>::append( size_t i, size_t j, const Type& value, bool check )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+
+   BLAZE_USER_ASSERT( end_[k] < end_[lines()], "Not enough reserved capacity left" );
+   BLAZE_USER_ASSERT( begin_[k] == end_[k] || l > index_[end_[k]-1UL], "Index is not strictly increasing" );
+
+   value_[end_[k]] = value;
+
+   if( !check || !isDefault( value_[end_[k]] ) ) {
+      index_[end_[k]] = static_cast<IT>( l );
+      ++end_[k];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the element insertion of a row/column.
+//
+// \param i The index of the row/column to be finalized \f$[0..M-1]\f$.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill a matrix with elements.
+// After completion of row/column \a i via the append() function, this function can be called to
+// finalize row/column \a i and prepare the next row/column for insertion process via append().
+//
+// \note Although finalize() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedSoAMatrix<Type,SO,IT>::finalize( size_t i )
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+
+   begin_[i+1UL] = end_[i];
+   if( i != lines()-1UL )
+      end_[i+1UL] = end_[i];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool CompressedSoAMatrix<Type,SO,IT>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool CompressedSoAMatrix<Type,SO,IT>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool CompressedSoAMatrix<Type,SO,IT>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompressedSoAMatrix<Type,SO,IT>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t lines( this->lines() );
+   const size_t minor( SO ? m_ : n_ );
+
+   // The lower (row-major) or upper (column-major) part of an upper/lower matrix is zero
+   const bool cutFront   ( SO ? bool( IsLower<MT>::value )
+                              : bool( IsUpper<MT>::value ) );
+   const bool strictFront( SO ? bool( IsStrictlyLower<MT>::value )
+                              : bool( IsStrictlyUpper<MT>::value ) );
+   const bool cutBack    ( SO ? bool( IsUpper<MT>::value )
+                              : bool( IsLower<MT>::value ) );
+   const bool strictBack ( SO ? bool( IsStrictlyUpper<MT>::value )
+                              : bool( IsStrictlyLower<MT>::value ) );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t k=1UL; k<=lines; ++k )
+      begin_[k] = end_[k] = end_[lines];
+
+   for( size_t k=0UL; k<lines; ++k )
+   {
+      begin_[k] = end_[k] = nonzeros;
+
+      const size_t lbegin( ( cutFront )?( strictFront ? k+1UL : k ):( 0UL ) );
+      const size_t lend  ( ( cutBack  )?( strictBack  ? k : k+1UL ):( minor ) );
+
+      for( size_t l=lbegin; l<lend; ++l )
+      {
+         if( nonzeros == capacity() ) {
+            reserveElements( extendCapacity() );
+         }
+
+         value_[nonzeros] = ( SO )?( (~rhs)(l,k) ):( (~rhs)(k,l) );
+
+         if( !isDefault( value_[nonzeros] ) ) {
+            index_[nonzeros] = static_cast<IT>( l );
+            ++end_[k];
+            ++nonzeros;
+         }
+      }
+   }
+
+   begin_[lines] = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix with the same storage order.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CompressedSoAMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+
+   typedef typename MT::ConstIterator  RhsIterator;
+
+   const size_t lines( this->lines() );
+
+   for( size_t k=0UL; k<lines; ++k )
+   {
+      size_t pos( begin_[k] );
+
+      for( RhsIterator element=(~rhs).begin(k); element!=(~rhs).end(k); ++element, ++pos ) {
+         index_[pos] = static_cast<IT>( element->index() );
+         value_[pos] = element->value();
+      }
+
+      begin_[k+1UL] = end_[k] = pos;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix with opposite storage order.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CompressedSoAMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+
+   typedef typename MT::ConstIterator  RhsIterator;
+
+   const size_t lines( this->lines() );
+   const size_t minor( SO ? m_ : n_ );
+
+   // Counting the number of elements per row/column
+   std::vector<size_t> lengths( lines, 0UL );
+   for( size_t l=0UL; l<minor; ++l ) {
+      for( RhsIterator element=(~rhs).begin(l); element!=(~rhs).end(l); ++element )
+         ++lengths[element->index()];
+   }
+
+   // Resizing the sparse matrix
+   for( size_t k=0UL; k<lines; ++k ) {
+      end_[k] = begin_[k];
+      begin_[k+1UL] = begin_[k] + lengths[k];
+   }
+
+   // Appending the elements to the rows/columns of the sparse matrix
+   for( size_t l=0UL; l<minor; ++l ) {
+      for( RhsIterator element=(~rhs).begin(l); element!=(~rhs).end(l); ++element )
+      {
+         const size_t k( element->index() );
+         index_[end_[k]] = static_cast<IT>( l );
+         value_[end_[k]] = element->value();
+         ++end_[k];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompressedSoAMatrix<Type,SO,IT>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void CompressedSoAMatrix<Type,SO,IT>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompressedSoAMatrix<Type,SO,IT>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand sparse matrix
+inline void CompressedSoAMatrix<Type,SO,IT>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPRESSEDSOAMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CompressedSoAMatrix operators */
+//@{
+template< typename Type, bool SO, typename IT >
+inline void reset( CompressedSoAMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+inline void reset( CompressedSoAMatrix<Type,SO,IT>& m, size_t i );
+
+template< typename Type, bool SO, typename IT >
+inline void clear( CompressedSoAMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+inline bool isDefault( const CompressedSoAMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+inline void swap( CompressedSoAMatrix<Type,SO,IT>& a, CompressedSoAMatrix<Type,SO,IT>& b ) /* throw() */;
+
+template< typename Type, bool SO, typename IT >
+inline void move( CompressedSoAMatrix<Type,SO,IT>& dst, CompressedSoAMatrix<Type,SO,IT>& src ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given compressed matrix.
+// \ingroup compressed_soa_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void reset( CompressedSoAMatrix<Type,SO,IT>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column of the given compressed matrix.
+// \ingroup compressed_soa_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// This function resets the values in the specified row/column of the given compressed matrix to
+// their default value. In case the given matrix is a \a rowMajor matrix the function resets the
+// values in row \a i, if it is a \a columnMajor matrix the function resets the values in column
+// \a i. Note that the capacity of the row/column remains unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void reset( CompressedSoAMatrix<Type,SO,IT>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given compressed matrix.
+// \ingroup compressed_soa_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void clear( CompressedSoAMatrix<Type,SO,IT>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given compressed matrix is in default state.
+// \ingroup compressed_soa_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the compressed matrix is in default (constructed) state, i.e. if
+// it's number of rows and columns is 0. In case it is in default state, the function returns
+// \a true, else it will return \a false. The following example demonstrates the use of the
+// \a isDefault() function:
+
+   \code
+   blaze::CompressedSoAMatrix<int> A;
+   // ... Resizing and initialization
+   if( isDefault( A ) ) { ... }
+   \endcode
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool isDefault( const CompressedSoAMatrix<Type,SO,IT>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compressed matrices.
+// \ingroup compressed_soa_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void swap( CompressedSoAMatrix<Type,SO,IT>& a, CompressedSoAMatrix<Type,SO,IT>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving the contents of one compressed matrix to another.
+// \ingroup compressed_soa_matrix
+//
+// \param dst The destination matrix.
+// \param src The source matrix.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void move( CompressedSoAMatrix<Type,SO,IT>& dst, CompressedSoAMatrix<Type,SO,IT>& src ) /* throw() */
+{
+   dst.swap( src );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename IT >
+struct IsResizable< CompressedSoAMatrix<T,SO,IT> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASSOASTORAGE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename IT >
+struct HasSoAStorage< CompressedSoAMatrix<T,SO,IT> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename IT >
+struct AddTrait< CompressedSoAMatrix<T1,SO,IT>, StaticMatrix<T2,M,N,SO> >
+{
+   typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct AddTrait< CompressedSoAMatrix<T1,SO1,IT>, StaticMatrix<T2,M,N,SO2> >
+{
+   typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO2 >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename IT >
+struct AddTrait< StaticMatrix<T1,M,N,SO>, CompressedSoAMatrix<T2,SO,IT> >
+{
+   typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< StaticMatrix<T1,M,N,SO1>, CompressedSoAMatrix<T2,SO2,IT> >
+{
+   typedef StaticMatrix< typename AddTrait<T1,T2>::Type, M, N, SO1 >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename IT >
+struct AddTrait< CompressedSoAMatrix<T1,SO,IT>, HybridMatrix<T2,M,N,SO> >
+{
+   typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct AddTrait< CompressedSoAMatrix<T1,SO1,IT>, HybridMatrix<T2,M,N,SO2> >
+{
+   typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO2 >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename IT >
+struct AddTrait< HybridMatrix<T1,M,N,SO>, CompressedSoAMatrix<T2,SO,IT> >
+{
+   typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< HybridMatrix<T1,M,N,SO1>, CompressedSoAMatrix<T2,SO2,IT> >
+{
+   typedef HybridMatrix< typename AddTrait<T1,T2>::Type, M, N, SO1 >  Type;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct AddTrait< CompressedSoAMatrix<T1,SO,IT>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< CompressedSoAMatrix<T1,SO1,IT>, DynamicMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO2 >  Type;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct AddTrait< DynamicMatrix<T1,SO>, CompressedSoAMatrix<T2,SO,IT> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct AddTrait< DynamicMatrix<T1,SO1>, CompressedSoAMatrix<T2,SO2,IT> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type , SO1 >  Type;
+};
+
+template< typename T1, bool SO, typename T2, typename IT1, typename IT2 >
+struct AddTrait< CompressedSoAMatrix<T1,SO,IT1>, CompressedSoAMatrix<T2,SO,IT2> >
+{
+   typedef CompressedSoAMatrix< typename AddTrait<T1,T2>::Type , SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename IT2 >
+struct AddTrait< CompressedSoAMatrix<T1,SO1,IT1>, CompressedSoAMatrix<T2,SO2,IT2> >
+{
+   typedef CompressedSoAMatrix< typename AddTrait<T1,T2>::Type , false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, typename IT1, typename IT2 >
+struct AddTrait< CompressedSoAMatrix<T1,SO,IT1>, CompressedMatrix<T2,SO,IT2> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type , SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename IT2 >
+struct AddTrait< CompressedSoAMatrix<T1,SO1,IT1>, CompressedMatrix<T2,SO2,IT2> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type , false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, typename IT1, typename IT2 >
+struct AddTrait< CompressedMatrix<T1,SO,IT1>, CompressedSoAMatrix<T2,SO,IT2> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type , SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename IT2 >
+struct AddTrait< CompressedMatrix<T1,SO1,IT1>, CompressedSoAMatrix<T2,SO2,IT2> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type , false >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename IT >
+struct SubTrait< CompressedSoAMatrix<T1,SO,IT>, StaticMatrix<T2,M,N,SO> >
+{
+   typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct SubTrait< CompressedSoAMatrix<T1,SO1,IT>, StaticMatrix<T2,M,N,SO2> >
+{
+   typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO2 >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename IT >
+struct SubTrait< StaticMatrix<T1,M,N,SO>, CompressedSoAMatrix<T2,SO,IT> >
+{
+   typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< StaticMatrix<T1,M,N,SO1>, CompressedSoAMatrix<T2,SO2,IT> >
+{
+   typedef StaticMatrix< typename SubTrait<T1,T2>::Type, M, N, SO1 >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t M, size_t N, typename IT >
+struct SubTrait< CompressedSoAMatrix<T1,SO,IT>, HybridMatrix<T2,M,N,SO> >
+{
+   typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct SubTrait< CompressedSoAMatrix<T1,SO1,IT>, HybridMatrix<T2,M,N,SO2> >
+{
+   typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO2 >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2, typename IT >
+struct SubTrait< HybridMatrix<T1,M,N,SO>, CompressedSoAMatrix<T2,SO,IT> >
+{
+   typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< HybridMatrix<T1,M,N,SO1>, CompressedSoAMatrix<T2,SO2,IT> >
+{
+   typedef HybridMatrix< typename SubTrait<T1,T2>::Type, M, N, SO1 >  Type;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct SubTrait< CompressedSoAMatrix<T1,SO,IT>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< CompressedSoAMatrix<T1,SO1,IT>, DynamicMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO2 >  Type;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct SubTrait< DynamicMatrix<T1,SO>, CompressedSoAMatrix<T2,SO,IT> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct SubTrait< DynamicMatrix<T1,SO1>, CompressedSoAMatrix<T2,SO2,IT> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type , SO1 >  Type;
+};
+
+template< typename T1, bool SO, typename T2, typename IT1, typename IT2 >
+struct SubTrait< CompressedSoAMatrix<T1,SO,IT1>, CompressedSoAMatrix<T2,SO,IT2> >
+{
+   typedef CompressedSoAMatrix< typename SubTrait<T1,T2>::Type , SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename IT2 >
+struct SubTrait< CompressedSoAMatrix<T1,SO1,IT1>, CompressedSoAMatrix<T2,SO2,IT2> >
+{
+   typedef CompressedSoAMatrix< typename SubTrait<T1,T2>::Type , false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, typename IT1, typename IT2 >
+struct SubTrait< CompressedSoAMatrix<T1,SO,IT1>, CompressedMatrix<T2,SO,IT2> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type , SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename IT2 >
+struct SubTrait< CompressedSoAMatrix<T1,SO1,IT1>, CompressedMatrix<T2,SO2,IT2> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type , false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, typename IT1, typename IT2 >
+struct SubTrait< CompressedMatrix<T1,SO,IT1>, CompressedSoAMatrix<T2,SO,IT2> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type , SO >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename IT2 >
+struct SubTrait< CompressedMatrix<T1,SO1,IT1>, CompressedSoAMatrix<T2,SO2,IT2> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type , false >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, typename IT >
+struct MultTrait< CompressedSoAMatrix<T1,SO,IT>, T2 >
+{
+   typedef CompressedSoAMatrix< typename MultTrait<T1,T2>::Type, SO, IT >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+
+template< typename T1, typename T2, bool SO, typename IT >
+struct MultTrait< T1, CompressedSoAMatrix<T2,SO,IT> >
+{
+   typedef CompressedSoAMatrix< typename MultTrait<T1,T2>::Type, SO, IT >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
+};
+
+template< typename T1, bool SO, typename T2, size_t N, typename IT >
+struct MultTrait< CompressedSoAMatrix<T1,SO,IT>, StaticVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, bool SO, typename IT >
+struct MultTrait< StaticVector<T1,N,true>, CompressedSoAMatrix<T2,SO,IT> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool SO, typename T2, size_t N, typename IT >
+struct MultTrait< CompressedSoAMatrix<T1,SO,IT>, HybridVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, bool SO, typename IT >
+struct MultTrait< HybridVector<T1,N,true>, CompressedSoAMatrix<T2,SO,IT> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct MultTrait< CompressedSoAMatrix<T1,SO,IT>, DynamicVector<T2,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2, bool SO, typename IT >
+struct MultTrait< DynamicVector<T1,true>, CompressedSoAMatrix<T2,SO,IT> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool SO, typename T2, typename IT1, typename IT2 >
+struct MultTrait< CompressedSoAMatrix<T1,SO,IT1>, CompressedVector<T2,false,IT2> >
+{
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2, bool SO, typename IT1, typename IT2 >
+struct MultTrait< CompressedVector<T1,true,IT1>, CompressedSoAMatrix<T2,SO,IT2> >
+{
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct MultTrait< CompressedSoAMatrix<T1,SO1,IT>, StaticMatrix<T2,M,N,SO2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< StaticMatrix<T1,M,N,SO1>, CompressedSoAMatrix<T2,SO2,IT> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2, typename IT >
+struct MultTrait< CompressedSoAMatrix<T1,SO1,IT>, HybridMatrix<T2,M,N,SO2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< HybridMatrix<T1,M,N,SO1>, CompressedSoAMatrix<T2,SO2,IT> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< CompressedSoAMatrix<T1,SO1,IT>, DynamicMatrix<T2,SO2> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT >
+struct MultTrait< DynamicMatrix<T1,SO1>, CompressedSoAMatrix<T2,SO2,IT> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename IT2 >
+struct MultTrait< CompressedSoAMatrix<T1,SO1,IT1>, CompressedSoAMatrix<T2,SO2,IT2> >
+{
+   typedef CompressedSoAMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename IT2 >
+struct MultTrait< CompressedSoAMatrix<T1,SO1,IT1>, CompressedMatrix<T2,SO2,IT2> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2, typename IT1, typename IT2 >
+struct MultTrait< CompressedMatrix<T1,SO1,IT1>, CompressedSoAMatrix<T2,SO2,IT2> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO1 >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, typename IT >
+struct DivTrait< CompressedSoAMatrix<T1,SO,IT>, T2 >
+{
+   typedef CompressedSoAMatrix< typename DivTrait<T1,T2>::Type, SO, IT >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATHTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, typename IT1, typename IT2 >
+struct MathTrait< CompressedSoAMatrix<T1,SO,IT1>, CompressedSoAMatrix<T2,SO,IT2> >
+{
+   typedef CompressedSoAMatrix< typename MathTrait<T1,T2>::HighType, SO >  HighType;
+   typedef CompressedSoAMatrix< typename MathTrait<T1,T2>::LowType , SO >  LowType;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename IT >
+struct SubmatrixTrait< CompressedSoAMatrix<T1,SO,IT> >
+{
+   typedef CompressedSoAMatrix<T1,SO,IT>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename IT >
+struct RowTrait< CompressedSoAMatrix<T1,SO,IT> >
+{
+   typedef CompressedVector<T1,true,IT>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename IT >
+struct ColumnTrait< CompressedSoAMatrix<T1,SO,IT> >
+{
+   typedef CompressedVector<T1,false,IT>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -42,6 +42,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <limits>
 #include <stdexcept>
 #include <blaze/math/constraints/DenseVector.h>
 #include <blaze/math/constraints/TransposeFlag.h>
@@ -97,11 +98,12 @@ namespace blaze {
 // \ingroup compressed_vector
 //
 // The CompressedVector class is the representation of an arbitrarily sized sparse vector,
-// which stores only non-zero elements of arbitrary type. The type of the elements and the
-// transpose flag of the vector can be specified via the two template parameters:
+// which stores only non-zero elements of arbitrary type. The type of the elements, the
+// transpose flag of the vector, and the type of the stored indices can be specified via the
+// three template parameters:
 
    \code
-   template< typename Type, bool TF >
+   template< typename Type, bool TF, typename IT >
    class CompressedVector;
    \endcode
 
@@ -109,6 +111,13 @@ namespace blaze {
 //          non-cv-qualified, non-reference, non-pointer element type.
 //  - TF  : specifies whether the vector is a row vector (\a blaze::rowVector) or a column
 //          vector (\a blaze::columnVector). The default value is \a blaze::columnVector.
+//  - IT  : specifies the unsigned integral type used to store the index of each non-zero
+//          element. The default value is \a size_t. A narrower type such as \a uint32_t or
+//          \a uint16_t reduces the memory footprint of each element and therefore the memory
+//          traffic of all sparse kernels, provided that the element type does not pad the
+//          value/index pair back to its original size (for instance \a float values with
+//          \a uint32_t indices require 8 instead of 16 bytes). The size of the vector must not
+//          exceed the range of this type.
 //
 // Inserting/accessing elements in a compressed vector can be done by several alternative
 // functions. The following example demonstrates all options:
@@ -184,12 +193,13 @@ namespace blaze {
    \endcode
 */
 template< typename Type                     // Data type of the vector
-        , bool TF = defaultTransposeFlag >  // Transpose flag
-class CompressedVector : public SparseVector< CompressedVector<Type,TF>, TF >
+        , bool TF = defaultTransposeFlag    // Transpose flag
+        , typename IT >                     // Index type
+class CompressedVector : public SparseVector< CompressedVector<Type,TF,IT>, TF >
 {
  private:
    //**Type definitions****************************************************************************
-   typedef ValueIndexPair<Type>  ElementBase;  //!< Base class for the compressed vector element.
+   typedef ValueIndexPair<Type,IT>  ElementBase;  //!< Base class for the compressed vector element.
    //**********************************************************************************************
 
    //**Private class Element***********************************************************************
@@ -233,16 +243,16 @@ class CompressedVector : public SparseVector< CompressedVector<Type,TF>, TF >
 
  public:
    //**Type definitions****************************************************************************
-   typedef CompressedVector<Type,TF>   This;            //!< Type of this CompressedVector instance.
-   typedef This                        ResultType;      //!< Result type for expression template evaluations.
-   typedef CompressedVector<Type,!TF>  TransposeType;   //!< Transpose type for expression template evaluations.
-   typedef Type                        ElementType;     //!< Type of the compressed vector elements.
-   typedef const Type&                 ReturnType;      //!< Return type for expression template evaluations.
-   typedef const CompressedVector&     CompositeType;   //!< Data type for composite expression templates.
-   typedef VectorAccessProxy<This>     Reference;       //!< Reference to a non-constant vector value.
-   typedef const Type&                 ConstReference;  //!< Reference to a constant vector value.
-   typedef Element*                    Iterator;        //!< Iterator over non-constant elements.
-   typedef const Element*              ConstIterator;   //!< Iterator over constant elements.
+   typedef CompressedVector<Type,TF,IT>   This;            //!< Type of this CompressedVector instance.
+   typedef This                           ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedVector<Type,!TF,IT>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                           ElementType;     //!< Type of the compressed vector elements.
+   typedef const Type&                    ReturnType;      //!< Return type for expression template evaluations.
+   typedef const CompressedVector&        CompositeType;   //!< Data type for composite expression templates.
+   typedef VectorAccessProxy<This>        Reference;       //!< Reference to a non-constant vector value.
+   typedef const Type&                    ConstReference;  //!< Reference to a constant vector value.
+   typedef Element*                       Iterator;        //!< Iterator over non-constant elements.
+   typedef const Element*                 ConstIterator;   //!< Iterator over constant elements.
    //**********************************************************************************************
 
    //**Rebind struct definition********************************************************************
@@ -250,7 +260,7 @@ class CompressedVector : public SparseVector< CompressedVector<Type,TF>, TF >
    */
    template< typename ET >  // Data type of the other vector
    struct Rebind {
-      typedef CompressedVector<ET,TF>  Other;  //!< The type of the other CompressedVector.
+      typedef CompressedVector<ET,TF,IT>  Other;  //!< The type of the other CompressedVector.
    };
    //**********************************************************************************************
 
@@ -377,6 +387,8 @@ class CompressedVector : public SparseVector< CompressedVector<Type,TF>, TF >
    //@{
           Iterator insert( Iterator pos, size_t index, const Type& value );
    inline size_t   extendCapacity() const;
+
+   static inline size_t checkIndexRange( size_t n );
    //@}
    //**********************************************************************************************
 
@@ -414,8 +426,9 @@ class CompressedVector : public SparseVector< CompressedVector<Type,TF>, TF >
 //=================================================================================================
 
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-const Type CompressedVector<Type,TF>::zero_ = Type();
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+const Type CompressedVector<Type,TF,IT>::zero_ = Type();
 
 
 
@@ -430,8 +443,9 @@ const Type CompressedVector<Type,TF>::zero_ = Type();
 /*!\brief The default constructor for CompressedVector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::CompressedVector()
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>::CompressedVector()
    : size_    ( 0UL )   // The current size/dimension of the compressed vector
    , capacity_( 0UL )   // The maximum capacity of the compressed vector
    , begin_   ( NULL )  // Pointer to the first non-zero element of the compressed vector
@@ -446,12 +460,13 @@ inline CompressedVector<Type,TF>::CompressedVector()
 // \param n The size of the vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::CompressedVector( size_t n )
-   : size_    ( n   )   // The current size/dimension of the compressed vector
-   , capacity_( 0UL )   // The maximum capacity of the compressed vector
-   , begin_   ( NULL )  // Pointer to the first non-zero element of the compressed vector
-   , end_     ( NULL )  // Pointer to the last non-zero element of the compressed vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>::CompressedVector( size_t n )
+   : size_    ( checkIndexRange( n ) )  // The current size/dimension of the compressed vector
+   , capacity_( 0UL )                   // The maximum capacity of the compressed vector
+   , begin_   ( NULL )                  // Pointer to the first non-zero element of the compressed vector
+   , end_     ( NULL )                  // Pointer to the last non-zero element of the compressed vector
 {}
 //*************************************************************************************************
 
@@ -463,9 +478,10 @@ inline CompressedVector<Type,TF>::CompressedVector( size_t n )
 // \param nonzeros The number of expected non-zero elements.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::CompressedVector( size_t n, size_t nonzeros )
-   : size_    ( n )                               // The current size/dimension of the compressed vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>::CompressedVector( size_t n, size_t nonzeros )
+   : size_    ( checkIndexRange( n ) )            // The current size/dimension of the compressed vector
    , capacity_( nonzeros )                        // The maximum capacity of the compressed vector
    , begin_   ( allocate<Element>( capacity_ ) )  // Pointer to the first non-zero element of the compressed vector
    , end_     ( begin_ )                          // Pointer to the last non-zero element of the compressed vector
@@ -482,8 +498,9 @@ inline CompressedVector<Type,TF>::CompressedVector( size_t n, size_t nonzeros )
 // and in order to enable/facilitate NRV optimization.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::CompressedVector( const CompressedVector& sv )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>::CompressedVector( const CompressedVector& sv )
    : size_    ( sv.size_ )                        // The current size/dimension of the compressed vector
    , capacity_( sv.nonZeros() )                   // The maximum capacity of the compressed vector
    , begin_   ( allocate<Element>( capacity_ ) )  // Pointer to the first non-zero element of the compressed vector
@@ -500,13 +517,14 @@ inline CompressedVector<Type,TF>::CompressedVector( const CompressedVector& sv )
 // \param dv Dense vector to be copied.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the foreign dense vector
-inline CompressedVector<Type,TF>::CompressedVector( const DenseVector<VT,TF>& dv )
-   : size_    ( (~dv).size() )  // The current size/dimension of the compressed vector
-   , capacity_( 0UL  )          // The maximum capacity of the compressed vector
-   , begin_   ( NULL )          // Pointer to the first non-zero element of the compressed vector
-   , end_     ( NULL )          // Pointer to the last non-zero element of the compressed vector
+inline CompressedVector<Type,TF,IT>::CompressedVector( const DenseVector<VT,TF>& dv )
+   : size_    ( checkIndexRange( (~dv).size() ) )  // The current size/dimension of the compressed vector
+   , capacity_( 0UL  )                             // The maximum capacity of the compressed vector
+   , begin_   ( NULL )                             // Pointer to the first non-zero element of the compressed vector
+   , end_     ( NULL )                             // Pointer to the last non-zero element of the compressed vector
 {
    using blaze::assign;
    assign( *this, ~dv );
@@ -520,13 +538,14 @@ inline CompressedVector<Type,TF>::CompressedVector( const DenseVector<VT,TF>& dv
 // \param sv Sparse vector to be copied.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the foreign sparse vector
-inline CompressedVector<Type,TF>::CompressedVector( const SparseVector<VT,TF>& sv )
-   : size_    ( (~sv).size() )                    // The current size/dimension of the compressed vector
-   , capacity_( (~sv).nonZeros() )                // The maximum capacity of the compressed vector
-   , begin_   ( allocate<Element>( capacity_ ) )  // Pointer to the first non-zero element of the compressed vector
-   , end_     ( begin_ )                          // Pointer to the last non-zero element of the compressed vector
+inline CompressedVector<Type,TF,IT>::CompressedVector( const SparseVector<VT,TF>& sv )
+   : size_    ( checkIndexRange( (~sv).size() ) )  // The current size/dimension of the compressed vector
+   , capacity_( (~sv).nonZeros() )                 // The maximum capacity of the compressed vector
+   , begin_   ( allocate<Element>( capacity_ ) )   // Pointer to the first non-zero element of the compressed vector
+   , end_     ( begin_ )                           // Pointer to the last non-zero element of the compressed vector
 {
    using blaze::assign;
    assign( *this, ~sv );
@@ -546,8 +565,9 @@ inline CompressedVector<Type,TF>::CompressedVector( const SparseVector<VT,TF>& s
 /*!\brief The destructor for CompressedVector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::~CompressedVector()
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>::~CompressedVector()
 {
    deallocate( begin_ );
 }
@@ -574,9 +594,10 @@ inline CompressedVector<Type,TF>::~CompressedVector()
 // vector are the begin() and end() functions.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Reference
-   CompressedVector<Type,TF>::operator[]( size_t index )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Reference
+   CompressedVector<Type,TF,IT>::operator[]( size_t index )
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
 
@@ -592,9 +613,10 @@ inline typename CompressedVector<Type,TF>::Reference
 // \return Reference to the accessed value.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstReference
-   CompressedVector<Type,TF>::operator[]( size_t index ) const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstReference
+   CompressedVector<Type,TF,IT>::operator[]( size_t index ) const
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
 
@@ -614,8 +636,9 @@ inline typename CompressedVector<Type,TF>::ConstReference
 // \return Iterator to the first non-zero element of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::begin()
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator CompressedVector<Type,TF,IT>::begin()
 {
    return Iterator( begin_ );
 }
@@ -628,8 +651,9 @@ inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::b
 // \return Iterator to the first non-zero element of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,TF>::begin() const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstIterator CompressedVector<Type,TF,IT>::begin() const
 {
    return ConstIterator( begin_ );
 }
@@ -642,8 +666,9 @@ inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,T
 // \return Iterator to the first non-zero element of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,TF>::cbegin() const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstIterator CompressedVector<Type,TF,IT>::cbegin() const
 {
    return ConstIterator( begin_ );
 }
@@ -656,8 +681,9 @@ inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,T
 // \return Iterator just past the last non-zero element of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::end()
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator CompressedVector<Type,TF,IT>::end()
 {
    return Iterator( end_ );
 }
@@ -670,8 +696,9 @@ inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::e
 // \return Iterator just past the last non-zero element of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,TF>::end() const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstIterator CompressedVector<Type,TF,IT>::end() const
 {
    return ConstIterator( end_ );
 }
@@ -684,8 +711,9 @@ inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,T
 // \return Iterator just past the last non-zero element of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,TF>::cend() const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstIterator CompressedVector<Type,TF,IT>::cend() const
 {
    return ConstIterator( end_ );
 }
@@ -710,9 +738,10 @@ inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,T
 // as a copy of this vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>&
-   CompressedVector<Type,TF>::operator=( const CompressedVector& rhs )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>&
+   CompressedVector<Type,TF,IT>::operator=( const CompressedVector& rhs )
 {
    if( &rhs == this ) return *this;
 
@@ -747,10 +776,11 @@ inline CompressedVector<Type,TF>&
 // this vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side dense vector
-inline CompressedVector<Type,TF>&
-   CompressedVector<Type,TF>::operator=( const DenseVector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,IT>&
+   CompressedVector<Type,TF,IT>::operator=( const DenseVector<VT,TF>& rhs )
 {
    using blaze::assign;
 
@@ -779,10 +809,11 @@ inline CompressedVector<Type,TF>&
 // this vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side sparse vector
-inline CompressedVector<Type,TF>&
-   CompressedVector<Type,TF>::operator=( const SparseVector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,IT>&
+   CompressedVector<Type,TF,IT>::operator=( const SparseVector<VT,TF>& rhs )
 {
    using blaze::assign;
 
@@ -812,9 +843,10 @@ inline CompressedVector<Type,TF>&
 // is thrown.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side vector
-inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator+=( const Vector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,IT>& CompressedVector<Type,TF,IT>::operator+=( const Vector<VT,TF>& rhs )
 {
    using blaze::addAssign;
 
@@ -839,9 +871,10 @@ inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator+=( const V
 // is thrown.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side vector
-inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator-=( const Vector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,IT>& CompressedVector<Type,TF,IT>::operator-=( const Vector<VT,TF>& rhs )
 {
    using blaze::subAssign;
 
@@ -867,14 +900,15 @@ inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator-=( const V
 // is thrown.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side vector
-inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator*=( const Vector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,IT>& CompressedVector<Type,TF,IT>::operator*=( const Vector<VT,TF>& rhs )
 {
    if( (~rhs).size() != size_ )
       throw std::invalid_argument( "Vector sizes do not match" );
 
-   CompressedVector<Type,TF> tmp( *this * (~rhs) );
+   CompressedVector<Type,TF,IT> tmp( *this * (~rhs) );
    swap( tmp );
 
    return *this;
@@ -894,10 +928,11 @@ inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator*=( const V
 // built-in data type.
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, CompressedVector<Type,TF> >::Type&
-   CompressedVector<Type,TF>::operator*=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, CompressedVector<Type,TF,IT> >::Type&
+   CompressedVector<Type,TF,IT>::operator*=( Other rhs )
 {
    for( Iterator element=begin_; element!=end_; ++element )
       element->value_ *= rhs;
@@ -919,10 +954,11 @@ inline typename EnableIf< IsNumeric<Other>, CompressedVector<Type,TF> >::Type&
 // type.
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the right-hand side scalar
-inline typename EnableIf< IsNumeric<Other>, CompressedVector<Type,TF> >::Type&
-   CompressedVector<Type,TF>::operator/=( Other rhs )
+inline typename EnableIf< IsNumeric<Other>, CompressedVector<Type,TF,IT> >::Type&
+   CompressedVector<Type,TF,IT>::operator/=( Other rhs )
 {
    BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
 
@@ -960,8 +996,9 @@ inline typename EnableIf< IsNumeric<Other>, CompressedVector<Type,TF> >::Type&
 // \return The size of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t CompressedVector<Type,TF>::size() const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline size_t CompressedVector<Type,TF,IT>::size() const
 {
    return size_;
 }
@@ -974,8 +1011,9 @@ inline size_t CompressedVector<Type,TF>::size() const
 // \return The capacity of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t CompressedVector<Type,TF>::capacity() const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline size_t CompressedVector<Type,TF,IT>::capacity() const
 {
    return capacity_;
 }
@@ -991,8 +1029,9 @@ inline size_t CompressedVector<Type,TF>::capacity() const
 // compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t CompressedVector<Type,TF>::nonZeros() const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline size_t CompressedVector<Type,TF,IT>::nonZeros() const
 {
    return end_ - begin_;
 }
@@ -1005,8 +1044,9 @@ inline size_t CompressedVector<Type,TF>::nonZeros() const
 // \return void
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::reset()
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void CompressedVector<Type,TF,IT>::reset()
 {
    end_ = begin_;
 }
@@ -1021,8 +1061,9 @@ inline void CompressedVector<Type,TF>::reset()
 // After the clear() function, the size of the compressed vector is 0.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::clear()
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void CompressedVector<Type,TF,IT>::clear()
 {
    size_ = 0UL;
    end_  = begin_;
@@ -1042,9 +1083,10 @@ inline void CompressedVector<Type,TF>::clear()
 // the given \a value is inserted.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::set( size_t index, const Type& value )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator
+   CompressedVector<Type,TF,IT>::set( size_t index, const Type& value )
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
 
@@ -1072,9 +1114,10 @@ inline typename CompressedVector<Type,TF>::Iterator
 // a \a std::invalid_argument exception is thrown.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::insert( size_t index, const Type& value )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+typename CompressedVector<Type,TF,IT>::Iterator
+   CompressedVector<Type,TF,IT>::insert( size_t index, const Type& value )
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
 
@@ -1098,9 +1141,10 @@ typename CompressedVector<Type,TF>::Iterator
 // \exception std::invalid_argument Invalid compressed vector access index.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::insert( Iterator pos, size_t index, const Type& value )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+typename CompressedVector<Type,TF,IT>::Iterator
+   CompressedVector<Type,TF,IT>::insert( Iterator pos, size_t index, const Type& value )
 {
     if( nonZeros() != capacity_ ) {
       std::copy_backward( pos, end_, end_+1 );
@@ -1138,8 +1182,9 @@ typename CompressedVector<Type,TF>::Iterator
 // This function erases an element from the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::erase( size_t index )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void CompressedVector<Type,TF,IT>::erase( size_t index )
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
 
@@ -1159,8 +1204,9 @@ inline void CompressedVector<Type,TF>::erase( size_t index )
 // This function erases an element from the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::erase( Iterator pos )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator CompressedVector<Type,TF,IT>::erase( Iterator pos )
 {
    BLAZE_USER_ASSERT( pos >= begin_ && pos <= end_, "Invalid compressed vector iterator" );
 
@@ -1181,9 +1227,10 @@ inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::e
 // This function erases a range of elements from the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::erase( Iterator first, Iterator last )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator
+   CompressedVector<Type,TF,IT>::erase( Iterator first, Iterator last )
 {
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range" );
    BLAZE_USER_ASSERT( first >= begin_ && first <= end_, "Invalid compressed vector iterator" );
@@ -1202,6 +1249,7 @@ inline typename CompressedVector<Type,TF>::Iterator
 // \param n The new size of the compressed vector.
 // \param preserve \a true if the old values of the vector should be preserved, \a false if not.
 // \return void
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
 //
 // This function resizes the compressed vector using the given size to \a n. During this
 // operation, new dynamic memory may be allocated in case the capacity of the compressed
@@ -1211,9 +1259,12 @@ inline typename CompressedVector<Type,TF>::Iterator
 // \a preserve flag can be set to \a true.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::resize( size_t n, bool preserve )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void CompressedVector<Type,TF,IT>::resize( size_t n, bool preserve )
 {
+   checkIndexRange( n );
+
    if( preserve ) {
       end_ = lowerBound( n );
    }
@@ -1236,8 +1287,9 @@ inline void CompressedVector<Type,TF>::resize( size_t n, bool preserve )
 // current values of the vector elements are preserved.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-void CompressedVector<Type,TF>::reserve( size_t n )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+void CompressedVector<Type,TF,IT>::reserve( size_t n )
 {
    if( n > capacity_ ) {
       const size_t newCapacity( n );
@@ -1262,9 +1314,10 @@ void CompressedVector<Type,TF>::reserve( size_t n )
 // \return Reference to the compressed vector.
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the scalar value
-inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::scale( const Other& scalar )
+inline CompressedVector<Type,TF,IT>& CompressedVector<Type,TF,IT>::scale( const Other& scalar )
 {
    for( Iterator element=begin_; element!=end_; ++element )
       element->value_ *= scalar;
@@ -1281,8 +1334,9 @@ inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::scale( const Other&
 // \exception no-throw guarantee.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::swap( CompressedVector& sv ) /* throw() */
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void CompressedVector<Type,TF,IT>::swap( CompressedVector& sv ) /* throw() */
 {
    std::swap( size_, sv.size_ );
    std::swap( capacity_, sv.capacity_ );
@@ -1301,8 +1355,9 @@ inline void CompressedVector<Type,TF>::swap( CompressedVector& sv ) /* throw() *
 // vector. Note that the new capacity is restricted to the interval \f$[7..size]\f$.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t CompressedVector<Type,TF>::extendCapacity() const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline size_t CompressedVector<Type,TF,IT>::extendCapacity() const
 {
    using blaze::max;
    using blaze::min;
@@ -1318,6 +1373,30 @@ inline size_t CompressedVector<Type,TF>::extendCapacity() const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking whether all indices of a vector of the given size can be stored.
+//
+// \param n The size of the compressed vector.
+// \return The given size \a n.
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+//
+// This function checks whether the largest index of a vector of size \a n can be represented
+// by the index type \a IT. In case the size exceeds the range of the index type, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline size_t CompressedVector<Type,TF,IT>::checkIndexRange( size_t n )
+{
+   if( n > 0UL && n-1UL > static_cast<size_t>( std::numeric_limits<IT>::max() ) )
+      throw std::invalid_argument( "Vector size exceeds the range of the index type" );
+
+   return n;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -1340,8 +1419,9 @@ inline size_t CompressedVector<Type,TF>::extendCapacity() const
 // operations via the subscript operator or the insert() function!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::find( size_t index )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator CompressedVector<Type,TF,IT>::find( size_t index )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).find( index ) );
 }
@@ -1362,8 +1442,9 @@ inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::f
 // operations via the subscript operator or the insert() function!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,TF>::find( size_t index ) const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstIterator CompressedVector<Type,TF,IT>::find( size_t index ) const
 {
    const ConstIterator pos( lowerBound( index ) );
    if( pos != end_ && pos->index_ == index )
@@ -1386,9 +1467,10 @@ inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,T
 // or the insert() function!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::lowerBound( size_t index )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator
+   CompressedVector<Type,TF,IT>::lowerBound( size_t index )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( index ) );
 }
@@ -1408,9 +1490,10 @@ inline typename CompressedVector<Type,TF>::Iterator
 // or the insert() function!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator
-   CompressedVector<Type,TF>::lowerBound( size_t index ) const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstIterator
+   CompressedVector<Type,TF,IT>::lowerBound( size_t index ) const
 {
    return std::lower_bound( begin_, end_, index, FindIndex() );
 }
@@ -1430,9 +1513,10 @@ inline typename CompressedVector<Type,TF>::ConstIterator
 // or the insert() function!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::upperBound( size_t index )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator
+   CompressedVector<Type,TF,IT>::upperBound( size_t index )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).upperBound( index ) );
 }
@@ -1452,9 +1536,10 @@ inline typename CompressedVector<Type,TF>::Iterator
 // or the insert() function!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator
-   CompressedVector<Type,TF>::upperBound( size_t index ) const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstIterator
+   CompressedVector<Type,TF,IT>::upperBound( size_t index ) const
 {
    return std::upper_bound( begin_, end_, index, FindIndex() );
 }
@@ -1494,8 +1579,9 @@ inline typename CompressedVector<Type,TF>::ConstIterator
 // returned by the end() functions!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::append( size_t index, const Type& value, bool check )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void CompressedVector<Type,TF,IT>::append( size_t index, const Type& value, bool check )
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
    BLAZE_USER_ASSERT( nonZeros() < capacity(), "Not enough reserved capacity" );
@@ -1530,9 +1616,10 @@ inline void CompressedVector<Type,TF>::append( size_t index, const Type& value,
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedVector<Type,TF>::canAlias( const Other* alias ) const
+inline bool CompressedVector<Type,TF,IT>::canAlias( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -1550,9 +1637,10 @@ inline bool CompressedVector<Type,TF>::canAlias( const Other* alias ) const
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedVector<Type,TF>::isAliased( const Other* alias ) const
+inline bool CompressedVector<Type,TF,IT>::isAliased( const Other* alias ) const
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -1570,8 +1658,9 @@ inline bool CompressedVector<Type,TF>::isAliased( const Other* alias ) const
 // vector).
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline bool CompressedVector<Type,TF>::canSMPAssign() const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline bool CompressedVector<Type,TF,IT>::canSMPAssign() const
 {
    return false;
 }
@@ -1590,9 +1679,10 @@ inline bool CompressedVector<Type,TF>::canSMPAssign() const
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side dense vector
-inline void CompressedVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,IT>::assign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
@@ -1628,9 +1718,10 @@ inline void CompressedVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side sparse vector
-inline void CompressedVector<Type,TF>::assign( const SparseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,IT>::assign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
@@ -1659,9 +1750,10 @@ inline void CompressedVector<Type,TF>::assign( const SparseVector<VT,TF>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side dense vector
-inline void CompressedVector<Type,TF>::addAssign( const DenseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,IT>::addAssign( const DenseVector<VT,TF>& rhs )
 {
    typedef typename AddTrait<This,typename VT::ResultType>::Type  AddType;
 
@@ -1690,13 +1782,14 @@ inline void CompressedVector<Type,TF>::addAssign( const DenseVector<VT,TF>& rhs
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side sparse vector
-inline void CompressedVector<Type,TF>::addAssign( const SparseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,IT>::addAssign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
-   CompressedVector<Type,TF> tmp( serial( *this + (~rhs) ) );
+   CompressedVector<Type,TF,IT> tmp( serial( *this + (~rhs) ) );
    swap( tmp );
 }
 //*************************************************************************************************
@@ -1714,9 +1807,10 @@ inline void CompressedVector<Type,TF>::addAssign( const SparseVector<VT,TF>& rhs
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side dense vector
-inline void CompressedVector<Type,TF>::subAssign( const DenseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,IT>::subAssign( const DenseVector<VT,TF>& rhs )
 {
    typedef typename SubTrait<This,typename VT::ResultType>::Type  SubType;
 
@@ -1745,13 +1839,14 @@ inline void CompressedVector<Type,TF>::subAssign( const DenseVector<VT,TF>& rhs
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side sparse vector
-inline void CompressedVector<Type,TF>::subAssign( const SparseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,IT>::subAssign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
-   CompressedVector<Type,TF> tmp( serial( *this - (~rhs) ) );
+   CompressedVector<Type,TF,IT> tmp( serial( *this - (~rhs) ) );
    swap( tmp );
 }
 //*************************************************************************************************
@@ -1768,20 +1863,20 @@ inline void CompressedVector<Type,TF>::subAssign( const SparseVector<VT,TF>& rhs
 //*************************************************************************************************
 /*!\name CompressedVector operators */
 //@{
-template< typename Type, bool TF >
-inline void reset( CompressedVector<Type,TF>& v );
+template< typename Type, bool TF, typename IT >
+inline void reset( CompressedVector<Type,TF,IT>& v );
 
-template< typename Type, bool TF >
-inline void clear( CompressedVector<Type,TF>& v );
+template< typename Type, bool TF, typename IT >
+inline void clear( CompressedVector<Type,TF,IT>& v );
 
-template< typename Type, bool TF >
-inline bool isDefault( const CompressedVector<Type,TF>& v );
+template< typename Type, bool TF, typename IT >
+inline bool isDefault( const CompressedVector<Type,TF,IT>& v );
 
-template< typename Type, bool TF >
-inline void swap( CompressedVector<Type,TF>& a, CompressedVector<Type,TF>& b ) /* throw() */;
+template< typename Type, bool TF, typename IT >
+inline void swap( CompressedVector<Type,TF,IT>& a, CompressedVector<Type,TF,IT>& b ) /* throw() */;
 
-template< typename Type, bool TF >
-inline void move( CompressedVector<Type,TF>& dst, CompressedVector<Type,TF>& src ) /* throw() */;
+template< typename Type, bool TF, typename IT >
+inline void move( CompressedVector<Type,TF,IT>& dst, CompressedVector<Type,TF,IT>& src ) /* throw() */;
 //@}
 //*************************************************************************************************
 
@@ -1794,8 +1889,9 @@ inline void move( CompressedVector<Type,TF>& dst, CompressedVector<Type,TF>& src
 // \return void
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void reset( CompressedVector<Type,TF>& v )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void reset( CompressedVector<Type,TF,IT>& v )
 {
    v.reset();
 }
@@ -1810,8 +1906,9 @@ inline void reset( CompressedVector<Type,TF>& v )
 // \return void
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void clear( CompressedVector<Type,TF>& v )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void clear( CompressedVector<Type,TF,IT>& v )
 {
    v.clear();
 }
@@ -1836,8 +1933,9 @@ inline void clear( CompressedVector<Type,TF>& v )
    \endcode
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline bool isDefault( const CompressedVector<Type,TF>& v )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline bool isDefault( const CompressedVector<Type,TF,IT>& v )
 {
    return ( v.size() == 0UL );
 }
@@ -1854,8 +1952,9 @@ inline bool isDefault( const CompressedVector<Type,TF>& v )
 // \exception no-throw guarantee.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void swap( CompressedVector<Type,TF>& a, CompressedVector<Type,TF>& b ) /* throw() */
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void swap( CompressedVector<Type,TF,IT>& a, CompressedVector<Type,TF,IT>& b ) /* throw() */
 {
    a.swap( b );
 }
@@ -1872,8 +1971,9 @@ inline void swap( CompressedVector<Type,TF>& a, CompressedVector<Type,TF>& b ) /
 // \exception no-throw guarantee.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void move( CompressedVector<Type,TF>& dst, CompressedVector<Type,TF>& src ) /* throw() */
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void move( CompressedVector<Type,TF,IT>& dst, CompressedVector<Type,TF,IT>& src ) /* throw() */
 {
    dst.swap( src );
 }
@@ -1890,8 +1990,8 @@ inline void move( CompressedVector<Type,TF>& dst, CompressedVector<Type,TF>& src
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF >
-struct IsResizable< CompressedVector<T,TF> > : public TrueType
+template< typename T, bool TF, typename IT >
+struct IsResizable< CompressedVector<T,TF,IT> > : public TrueType
 {
    enum { value = 1 };
    typedef TrueType  Type;
@@ -1910,44 +2010,44 @@ struct IsResizable< CompressedVector<T,TF> > : public TrueType
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2, size_t N >
-struct AddTrait< CompressedVector<T1,TF>, StaticVector<T2,N,TF> >
+template< typename T1, bool TF, typename T2, size_t N, typename IT >
+struct AddTrait< CompressedVector<T1,TF,IT>, StaticVector<T2,N,TF> >
 {
    typedef StaticVector< typename AddTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct AddTrait< StaticVector<T1,N,TF>, CompressedVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename IT >
+struct AddTrait< StaticVector<T1,N,TF>, CompressedVector<T2,TF,IT> >
 {
    typedef StaticVector< typename AddTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2, size_t N >
-struct AddTrait< CompressedVector<T1,TF>, HybridVector<T2,N,TF> >
+template< typename T1, bool TF, typename T2, size_t N, typename IT >
+struct AddTrait< CompressedVector<T1,TF,IT>, HybridVector<T2,N,TF> >
 {
    typedef HybridVector< typename AddTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct AddTrait< HybridVector<T1,N,TF>, CompressedVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename IT >
+struct AddTrait< HybridVector<T1,N,TF>, CompressedVector<T2,TF,IT> >
 {
    typedef HybridVector< typename AddTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct AddTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename IT >
+struct AddTrait< CompressedVector<T1,TF,IT>, DynamicVector<T2,TF> >
 {
    typedef DynamicVector< typename AddTrait<T1,T2>::Type, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct AddTrait< DynamicVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename IT >
+struct AddTrait< DynamicVector<T1,TF>, CompressedVector<T2,TF,IT> >
 {
    typedef DynamicVector< typename AddTrait<T1,T2>::Type, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct AddTrait< CompressedVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename IT1, typename IT2 >
+struct AddTrait< CompressedVector<T1,TF,IT1>, CompressedVector<T2,TF,IT2> >
 {
    typedef CompressedVector< typename AddTrait<T1,T2>::Type, TF >  Type;
 };
@@ -1965,44 +2065,44 @@ struct AddTrait< CompressedVector<T1,TF>, CompressedVector<T2,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2, size_t N >
-struct SubTrait< CompressedVector<T1,TF>, StaticVector<T2,N,TF> >
+template< typename T1, bool TF, typename T2, size_t N, typename IT >
+struct SubTrait< CompressedVector<T1,TF,IT>, StaticVector<T2,N,TF> >
 {
    typedef StaticVector< typename SubTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct SubTrait< StaticVector<T1,N,TF>, CompressedVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename IT >
+struct SubTrait< StaticVector<T1,N,TF>, CompressedVector<T2,TF,IT> >
 {
    typedef StaticVector< typename SubTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2, size_t N >
-struct SubTrait< CompressedVector<T1,TF>, HybridVector<T2,N,TF> >
+template< typename T1, bool TF, typename T2, size_t N, typename IT >
+struct SubTrait< CompressedVector<T1,TF,IT>, HybridVector<T2,N,TF> >
 {
    typedef HybridVector< typename SubTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct SubTrait< HybridVector<T1,N,TF>, CompressedVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename IT >
+struct SubTrait< HybridVector<T1,N,TF>, CompressedVector<T2,TF,IT> >
 {
    typedef HybridVector< typename SubTrait<T1,T2>::Type, N, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct SubTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename IT >
+struct SubTrait< CompressedVector<T1,TF,IT>, DynamicVector<T2,TF> >
 {
    typedef DynamicVector< typename SubTrait<T1,T2>::Type, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct SubTrait< DynamicVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename IT >
+struct SubTrait< DynamicVector<T1,TF>, CompressedVector<T2,TF,IT> >
 {
    typedef DynamicVector< typename SubTrait<T1,T2>::Type, TF >  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct SubTrait< CompressedVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename IT1, typename IT2 >
+struct SubTrait< CompressedVector<T1,TF,IT1>, CompressedVector<T2,TF,IT2> >
 {
    typedef CompressedVector< typename SubTrait<T1,T2>::Type, TF >  Type;
 };
@@ -2020,142 +2120,142 @@ struct SubTrait< CompressedVector<T1,TF>, CompressedVector<T2,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2 >
-struct MultTrait< CompressedVector<T1,TF>, T2 >
+template< typename T1, bool TF, typename T2, typename IT >
+struct MultTrait< CompressedVector<T1,TF,IT>, T2 >
 {
-   typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF >  Type;
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF, IT >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
 };
 
-template< typename T1, typename T2, bool TF >
-struct MultTrait< T1, CompressedVector<T2,TF> >
+template< typename T1, typename T2, bool TF, typename IT >
+struct MultTrait< T1, CompressedVector<T2,TF,IT> >
 {
-   typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF >  Type;
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF, IT >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
 };
 
-template< typename T1, bool TF, typename T2, size_t N >
-struct MultTrait< CompressedVector<T1,TF>, StaticVector<T2,N,TF> >
+template< typename T1, bool TF, typename T2, size_t N, typename IT >
+struct MultTrait< CompressedVector<T1,TF,IT>, StaticVector<T2,N,TF> >
 {
    typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF >  Type;
 };
 
-template< typename T1, typename T2, size_t N >
-struct MultTrait< CompressedVector<T1,false>, StaticVector<T2,N,true> >
+template< typename T1, typename T2, size_t N, typename IT >
+struct MultTrait< CompressedVector<T1,false,IT>, StaticVector<T2,N,true> >
 {
    typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, typename T2, size_t N >
-struct MultTrait< CompressedVector<T1,true>, StaticVector<T2,N,false> >
+template< typename T1, typename T2, size_t N, typename IT >
+struct MultTrait< CompressedVector<T1,true,IT>, StaticVector<T2,N,false> >
 {
    typedef typename MultTrait<T1,T2>::Type  Type;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct MultTrait< StaticVector<T1,N,TF>, CompressedVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename IT >
+struct MultTrait< StaticVector<T1,N,TF>, CompressedVector<T2,TF,IT> >
 {
    typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF >  Type;
 };
 
-template< typename T1, size_t N, typename T2 >
-struct MultTrait< StaticVector<T1,N,false>, CompressedVector<T2,true> >
+template< typename T1, size_t N, typename T2, typename IT >
+struct MultTrait< StaticVector<T1,N,false>, CompressedVector<T2,true,IT> >
 {
    typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, size_t N, typename T2 >
-struct MultTrait< StaticVector<T1,N,true>, CompressedVector<T2,false> >
+template< typename T1, size_t N, typename T2, typename IT >
+struct MultTrait< StaticVector<T1,N,true>, CompressedVector<T2,false,IT> >
 {
    typedef typename MultTrait<T1,T2>::Type  Type;
 };
 
-template< typename T1, bool TF, typename T2, size_t N >
-struct MultTrait< CompressedVector<T1,TF>, HybridVector<T2,N,TF> >
+template< typename T1, bool TF, typename T2, size_t N, typename IT >
+struct MultTrait< CompressedVector<T1,TF,IT>, HybridVector<T2,N,TF> >
 {
    typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF >  Type;
 };
 
-template< typename T1, typename T2, size_t N >
-struct MultTrait< CompressedVector<T1,false>, HybridVector<T2,N,true> >
+template< typename T1, typename T2, size_t N, typename IT >
+struct MultTrait< CompressedVector<T1,false,IT>, HybridVector<T2,N,true> >
 {
    typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, typename T2, size_t N >
-struct MultTrait< CompressedVector<T1,true>, HybridVector<T2,N,false> >
+template< typename T1, typename T2, size_t N, typename IT >
+struct MultTrait< CompressedVector<T1,true,IT>, HybridVector<T2,N,false> >
 {
    typedef typename MultTrait<T1,T2>::Type  Type;
 };
 
-template< typename T1, size_t N, bool TF, typename T2 >
-struct MultTrait< HybridVector<T1,N,TF>, CompressedVector<T2,TF> >
+template< typename T1, size_t N, bool TF, typename T2, typename IT >
+struct MultTrait< HybridVector<T1,N,TF>, CompressedVector<T2,TF,IT> >
 {
    typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF >  Type;
 };
 
-template< typename T1, size_t N, typename T2 >
-struct MultTrait< HybridVector<T1,N,false>, CompressedVector<T2,true> >
+template< typename T1, size_t N, typename T2, typename IT >
+struct MultTrait< HybridVector<T1,N,false>, CompressedVector<T2,true,IT> >
 {
    typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, size_t N, typename T2 >
-struct MultTrait< HybridVector<T1,N,true>, CompressedVector<T2,false> >
+template< typename T1, size_t N, typename T2, typename IT >
+struct MultTrait< HybridVector<T1,N,true>, CompressedVector<T2,false,IT> >
 {
    typedef typename MultTrait<T1,T2>::Type  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct MultTrait< CompressedVector<T1,TF>, DynamicVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename IT >
+struct MultTrait< CompressedVector<T1,TF,IT>, DynamicVector<T2,TF> >
 {
    typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF >  Type;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< CompressedVector<T1,false>, DynamicVector<T2,true> >
+template< typename T1, typename T2, typename IT >
+struct MultTrait< CompressedVector<T1,false,IT>, DynamicVector<T2,true> >
 {
    typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, true >  Type;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< CompressedVector<T1,true>, DynamicVector<T2,false> >
+template< typename T1, typename T2, typename IT >
+struct MultTrait< CompressedVector<T1,true,IT>, DynamicVector<T2,false> >
 {
    typedef typename MultTrait<T1,T2>::Type  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct MultTrait< DynamicVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename IT >
+struct MultTrait< DynamicVector<T1,TF>, CompressedVector<T2,TF,IT> >
 {
    typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF >  Type;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< DynamicVector<T1,false>, CompressedVector<T2,true> >
+template< typename T1, typename T2, typename IT >
+struct MultTrait< DynamicVector<T1,false>, CompressedVector<T2,true,IT> >
 {
    typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< DynamicVector<T1,true>, CompressedVector<T2,false> >
+template< typename T1, typename T2, typename IT >
+struct MultTrait< DynamicVector<T1,true>, CompressedVector<T2,false,IT> >
 {
    typedef typename MultTrait<T1,T2>::Type  Type;
 };
 
-template< typename T1, bool TF, typename T2 >
-struct MultTrait< CompressedVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename IT1, typename IT2 >
+struct MultTrait< CompressedVector<T1,TF,IT1>, CompressedVector<T2,TF,IT2> >
 {
    typedef CompressedVector< typename MultTrait<T1,T2>::Type, TF >  Type;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< CompressedVector<T1,false>, CompressedVector<T2,true> >
+template< typename T1, typename T2, typename IT1, typename IT2 >
+struct MultTrait< CompressedVector<T1,false,IT1>, CompressedVector<T2,true,IT2> >
 {
    typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
 };
 
-template< typename T1, typename T2 >
-struct MultTrait< CompressedVector<T1,true>, CompressedVector<T2,false> >
+template< typename T1, typename T2, typename IT1, typename IT2 >
+struct MultTrait< CompressedVector<T1,true,IT1>, CompressedVector<T2,false,IT2> >
 {
    typedef typename MultTrait<T1,T2>::Type  Type;
 };
@@ -2173,8 +2273,8 @@ struct MultTrait< CompressedVector<T1,true>, CompressedVector<T2,false> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, typename T2 >
-struct CrossTrait< CompressedVector<T1,false>, StaticVector<T2,3UL,false> >
+template< typename T1, typename T2, typename IT >
+struct CrossTrait< CompressedVector<T1,false,IT>, StaticVector<T2,3UL,false> >
 {
  private:
    typedef typename MultTrait<T1,T2>::Type  T;
@@ -2183,8 +2283,8 @@ struct CrossTrait< CompressedVector<T1,false>, StaticVector<T2,3UL,false> >
    typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
 };
 
-template< typename T1, typename T2 >
-struct CrossTrait< StaticVector<T1,3UL,false>, CompressedVector<T2,false> >
+template< typename T1, typename T2, typename IT >
+struct CrossTrait< StaticVector<T1,3UL,false>, CompressedVector<T2,false,IT> >
 {
  private:
    typedef typename MultTrait<T1,T2>::Type  T;
@@ -2193,8 +2293,8 @@ struct CrossTrait< StaticVector<T1,3UL,false>, CompressedVector<T2,false> >
    typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
 };
 
-template< typename T1, typename T2, size_t N >
-struct CrossTrait< CompressedVector<T1,false>, HybridVector<T2,N,false> >
+template< typename T1, typename T2, size_t N, typename IT >
+struct CrossTrait< CompressedVector<T1,false,IT>, HybridVector<T2,N,false> >
 {
  private:
    typedef typename MultTrait<T1,T2>::Type  T;
@@ -2203,8 +2303,8 @@ struct CrossTrait< CompressedVector<T1,false>, HybridVector<T2,N,false> >
    typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
 };
 
-template< typename T1, size_t N, typename T2 >
-struct CrossTrait< HybridVector<T1,N,false>, CompressedVector<T2,false> >
+template< typename T1, size_t N, typename T2, typename IT >
+struct CrossTrait< HybridVector<T1,N,false>, CompressedVector<T2,false,IT> >
 {
  private:
    typedef typename MultTrait<T1,T2>::Type  T;
@@ -2213,8 +2313,8 @@ struct CrossTrait< HybridVector<T1,N,false>, CompressedVector<T2,false> >
    typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
 };
 
-template< typename T1, typename T2 >
-struct CrossTrait< CompressedVector<T1,false>, DynamicVector<T2,false> >
+template< typename T1, typename T2, typename IT >
+struct CrossTrait< CompressedVector<T1,false,IT>, DynamicVector<T2,false> >
 {
  private:
    typedef typename MultTrait<T1,T2>::Type  T;
@@ -2223,8 +2323,8 @@ struct CrossTrait< CompressedVector<T1,false>, DynamicVector<T2,false> >
    typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
 };
 
-template< typename T1, typename T2 >
-struct CrossTrait< DynamicVector<T1,false>, CompressedVector<T2,false> >
+template< typename T1, typename T2, typename IT >
+struct CrossTrait< DynamicVector<T1,false>, CompressedVector<T2,false,IT> >
 {
  private:
    typedef typename MultTrait<T1,T2>::Type  T;
@@ -2233,8 +2333,8 @@ struct CrossTrait< DynamicVector<T1,false>, CompressedVector<T2,false> >
    typedef StaticVector< typename SubTrait<T,T>::Type, 3UL, false >  Type;
 };
 
-template< typename T1, typename T2 >
-struct CrossTrait< CompressedVector<T1,false>, CompressedVector<T2,false> >
+template< typename T1, typename T2, typename IT1, typename IT2 >
+struct CrossTrait< CompressedVector<T1,false,IT1>, CompressedVector<T2,false,IT2> >
 {
  private:
    typedef typename MultTrait<T1,T2>::Type  T;
@@ -2256,10 +2356,10 @@ struct CrossTrait< CompressedVector<T1,false>, CompressedVector<T2,false> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2 >
-struct DivTrait< CompressedVector<T1,TF>, T2 >
+template< typename T1, bool TF, typename T2, typename IT >
+struct DivTrait< CompressedVector<T1,TF,IT>, T2 >
 {
-   typedef CompressedVector< typename DivTrait<T1,T2>::Type, TF >  Type;
+   typedef CompressedVector< typename DivTrait<T1,T2>::Type, TF, IT >  Type;
    BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
 };
 /*! \endcond */
@@ -2276,8 +2376,8 @@ struct DivTrait< CompressedVector<T1,TF>, T2 >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2 >
-struct MathTrait< CompressedVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename T2, typename IT1, typename IT2 >
+struct MathTrait< CompressedVector<T1,TF,IT1>, CompressedVector<T2,TF,IT2> >
 {
    typedef CompressedVector< typename MathTrait<T1,T2>::HighType, TF >  HighType;
    typedef CompressedVector< typename MathTrait<T1,T2>::LowType , TF >  LowType;
@@ -2296,10 +2396,10 @@ struct MathTrait< CompressedVector<T1,TF>, CompressedVector<T2,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF >
-struct SubvectorTrait< CompressedVector<T1,TF> >
+template< typename T1, bool TF, typename IT >
+struct SubvectorTrait< CompressedVector<T1,TF,IT> >
 {
-   typedef CompressedVector<T1,TF>  Type;
+   typedef CompressedVector<T1,TF,IT>  Type;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -36,6 +36,13 @@
 #define _BLAZE_MATH_SPARSE_FORWARD_H_
 
 
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Types.h>
+
+
 namespace blaze {
 
 //=================================================================================================
@@ -44,8 +51,12 @@ namespace blaze {
 //
 //=================================================================================================
 
-template< typename, bool > class CompressedMatrix;
-template< typename, bool > class CompressedVector;
+template< typename, size_t, size_t, typename = size_t > class BlockCompressedMatrix;
+template< typename, bool, typename = size_t > class CompressedMatrix;
+template< typename, bool, typename = size_t > class CompressedSoAMatrix;
+template< typename, bool, typename = size_t > class CompressedVector;
+template< typename, typename = size_t > class SlicedEllpackMatrix;
+template< typename, bool = true, typename = size_t > class SymmetricCompressedMatrix;
 
 } // namespace blaze
 
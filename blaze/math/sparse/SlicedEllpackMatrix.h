@@ -0,0 +1,2253 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SlicedEllpackMatrix.h
+//  \brief Implementation of a sparse MxN matrix in the sliced ELLPACK (SELL-C-sigma) format
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_SLICEDELLPACKMATRIX_H_
+#define _BLAZE_MATH_SPARSE_SLICEDELLPACKMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/intrinsics/IntrinsicTrait.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/SparseElement.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MathTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/HasSlicedEllpackStorage.h>
+#include <blaze/math/views/Forward.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup sliced_ellpack_matrix SlicedEllpackMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Row-major \f$ M \times N \f$ sparse matrix in the sliced ELLPACK format.
+// \ingroup sliced_ellpack_matrix
+//
+// The SlicedEllpackMatrix class template is a row-major sparse matrix in the SELL-C-sigma
+// format, which is tailored to vectorized sparse matrix/dense vector multiplications. The
+// rows of the matrix are combined to chunks of \a C consecutive rows, where \a C is the number
+// of elements of the element type that fit into a single SIMD register (see the \a chunkSize
+// member enumeration). The non-zero elements of a chunk are stored column by column, i.e. the
+// first non-zero elements of all \a C rows are followed by the second non-zero elements of all
+// rows, and so on. Rows with fewer non-zero elements than the longest row of the chunk are
+// padded with explicit zeros. In order to reduce the amount of padding, the rows are sorted by
+// their number of non-zero elements within windows of \a sigma rows. The type of the elements
+// and the type of the stored column indices can be specified via the two template parameters:
+
+   \code
+   template< typename Type, typename IT >
+   class SlicedEllpackMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. SlicedEllpackMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - IT  : specifies the integral type used to store the column index of each non-zero element.
+//          The default value is \a size_t. The number of columns must not exceed the range of
+//          this type.
+//
+// The sparsity pattern of a SlicedEllpackMatrix is fixed at construction: the matrix is created
+// from any other dense or sparse matrix (for instance a CompressedMatrix) and can be converted
+// back into a CompressedMatrix at any time. The values of the existing non-zero elements can be
+// modified via iterators, but it is not possible to insert new non-zero elements:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::SlicedEllpackMatrix;
+   using blaze::DynamicVector;
+
+   CompressedMatrix<double> A( 1000UL, 1000UL );
+   // ... Initialization of the compressed matrix
+
+   SlicedEllpackMatrix<double> B( A );         // Conversion with the default window size
+   SlicedEllpackMatrix<double> C( A, 256UL );  // Sorting the rows within windows of 256 rows
+
+   DynamicVector<double> x( 1000UL ), y;
+   // ... Initialization of the dense vector
+
+   y = B * x;  // Vectorized (and possibly parallel) sparse matrix/dense vector multiplication
+
+   CompressedMatrix<double> D( B );  // Conversion back to a compressed matrix
+   \endcode
+
+// Note that the multiplication kernel processes all rows of a chunk including the padded zeros.
+// Therefore the result of a row can be affected by infinite or NaN values in the dense vector
+// even if the row has no non-zero element at the according position.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+class SlicedEllpackMatrix : public SparseMatrix< SlicedEllpackMatrix<Type,IT>, false >
+{
+ private:
+   //**Private class LongerRow*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Helper class for sorting the rows of a window by their number of non-zero elements.
+   */
+   struct LongerRow
+   {
+      explicit inline LongerRow( const size_t* length )
+         : length_( length )  // The number of non-zero elements of each row
+      {}
+
+      inline bool operator()( size_t row1, size_t row2 ) const {
+         return length_[row1] > length_[row2];
+      }
+
+      const size_t* length_;  //!< The number of non-zero elements of each row.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Compilation flags***************************************************************************
+   //! The number of rows per chunk.
+   /*! The \a chunkSize compile time constant corresponds to the number of elements of the
+       element type that fit into a single SIMD register. */
+   enum { chunkSize = IntrinsicTrait<Type>::size };
+
+   //! The default number of rows per sorting window.
+   enum { defaultSigma = 32*chunkSize };
+   //**********************************************************************************************
+
+   //**SellElement class definition****************************************************************
+   /*!\brief Access proxy for a single non-zero element of a SlicedEllpackMatrix.
+   //
+   // The SellElement class combines the value and the index of a non-zero element, which are
+   // stored in two separate arrays, and provides the same interface as the value-index-pairs
+   // of CompressedMatrix.
+   */
+   template< typename VT >  // Type of the value (Type or const Type)
+   class SellElement : private SparseElement
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef Type          ValueType;       //!< The value type of the element.
+      typedef size_t        IndexType;       //!< The index type of the element.
+      typedef VT&           Reference;       //!< Reference return type.
+      typedef const Type&   ConstReference;  //!< Reference-to-const return type.
+      typedef SellElement*  Pointer;         //!< Pointer return type.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the SellElement class.
+      //
+      // \param value Pointer to the value of the non-zero element.
+      // \param index Pointer to the index of the non-zero element.
+      */
+      inline SellElement( VT* value, const IT* index )
+         : value_( value )  // Pointer to the value of the non-zero element
+         , index_( index )  // Pointer to the index of the non-zero element
+      {}
+      //*******************************************************************************************
+
+      //**Assignment operator**********************************************************************
+      /*!\brief Assignment to the accessed sparse matrix element.
+      //
+      // \param v The new value of the sparse matrix element.
+      // \return Reference to the sparse matrix element.
+      */
+      template< typename T > inline SellElement& operator=( const T& v ) {
+         *value_ = v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment to the accessed sparse matrix element.
+      //
+      // \param v The right-hand side value for the addition.
+      // \return Reference to the sparse matrix element.
+      */
+      template< typename T > inline SellElement& operator+=( const T& v ) {
+         *value_ += v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment to the accessed sparse matrix element.
+      //
+      // \param v The right-hand side value for the subtraction.
+      // \return Reference to the sparse matrix element.
+      */
+      template< typename T > inline SellElement& operator-=( const T& v ) {
+         *value_ -= v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Multiplication assignment operator*******************************************************
+      /*!\brief Multiplication assignment to the accessed sparse matrix element.
+      //
+      // \param v The right-hand side value for the multiplication.
+      // \return Reference to the sparse matrix element.
+      */
+      template< typename T > inline SellElement& operator*=( const T& v ) {
+         *value_ *= v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Division assignment operator*************************************************************
+      /*!\brief Division assignment to the accessed sparse matrix element.
+      //
+      // \param v The right-hand side value for the division.
+      // \return Reference to the sparse matrix element.
+      */
+      template< typename T > inline SellElement& operator/=( const T& v ) {
+         *value_ /= v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline Pointer operator->() {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline Reference value() const {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline IndexType index() const {
+         return *index_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      VT*       value_;  //!< Pointer to the value of the non-zero element.
+      const IT* index_;  //!< Pointer to the index of the non-zero element.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**SellIterator class definition***************************************************************
+   /*!\brief Iterator over the non-zero elements of a row of a SlicedEllpackMatrix.
+   //
+   // Since the non-zero elements of the rows of a chunk are interleaved, the SellIterator
+   // advances by \a chunkSize elements in each step.
+   */
+   template< typename VT >  // Type of the value (Type or const Type)
+   class SellIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::forward_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef SellElement<VT>            ValueType;         //!< Type of the underlying elements.
+      typedef ValueType                  PointerType;       //!< Pointer return type.
+      typedef ValueType                  ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                  DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Default constructor**********************************************************************
+      /*!\brief Default constructor for the SellIterator class.
+      */
+      inline SellIterator()
+         : value_( NULL )  // Pointer to the value of the current non-zero element
+         , index_( NULL )  // Pointer to the index of the current non-zero element
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the SellIterator class.
+      //
+      // \param value Pointer to the value of the current non-zero element.
+      // \param index Pointer to the index of the current non-zero element.
+      */
+      inline SellIterator( VT* value, const IT* index )
+         : value_( value )  // Pointer to the value of the current non-zero element
+         , index_( index )  // Pointer to the index of the current non-zero element
+      {}
+      //*******************************************************************************************
+
+      //**Conversion constructor*******************************************************************
+      /*!\brief Conversion constructor from different SellIterator instances.
+      //
+      // \param it The iterator to be copied.
+      */
+      template< typename VT2 >
+      inline SellIterator( const SellIterator<VT2>& it )
+         : value_( it.value_ )  // Pointer to the value of the current non-zero element
+         , index_( it.index_ )  // Pointer to the index of the current non-zero element
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline SellIterator& operator++() {
+         value_ += chunkSize;
+         index_ += chunkSize;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const SellIterator operator++( int ) {
+         const SellIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the current sparse matrix element.
+      //
+      // \return Access proxy for the current sparse matrix element.
+      */
+      inline ReferenceType operator*() const {
+         return ReferenceType( value_, index_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the current sparse matrix element.
+      //
+      // \return Access proxy for the current sparse matrix element.
+      */
+      inline PointerType operator->() const {
+         return PointerType( value_, index_ );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two SellIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator==( const SellIterator<VT2>& rhs ) const {
+         return index_ == rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two SellIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      template< typename VT2 >
+      inline bool operator!=( const SellIterator<VT2>& rhs ) const {
+         return index_ != rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two SellIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      template< typename VT2 >
+      inline DifferenceType operator-( const SellIterator<VT2>& rhs ) const {
+         return ( index_ - rhs.index_ ) / DifferenceType( chunkSize );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      VT*       value_;  //!< Pointer to the value of the current non-zero element.
+      const IT* index_;  //!< Pointer to the index of the current non-zero element.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      /*! \cond BLAZE_INTERNAL */
+      template< typename VT2 > friend class SellIterator;
+      /*! \endcond */
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef SlicedEllpackMatrix<Type,IT>    This;            //!< Type of this SlicedEllpackMatrix instance.
+   typedef This                            ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,true,IT>  OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,true,IT>  TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                            ElementType;     //!< Type of the sparse matrix elements.
+   typedef IT                              IndexType;       //!< Type of the stored indices.
+   typedef const Type&                     ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                     CompositeType;   //!< Data type for composite expression templates.
+   typedef const Type&                     Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                     ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef SellIterator<Type>              Iterator;        //!< Iterator over non-constant elements.
+   typedef SellIterator<const Type>        ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SlicedEllpackMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef SlicedEllpackMatrix<ET,IT>  Other;  //!< The type of the other SlicedEllpackMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since a SlicedEllpackMatrix is never the target of an SMP assignment, the
+       flag only enables the parallel evaluation of expressions involving the matrix. */
+   enum { smpAssignable = 1 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SlicedEllpackMatrix();
+   explicit inline SlicedEllpackMatrix( size_t m, size_t n, size_t sigma=defaultSigma );
+            inline SlicedEllpackMatrix( const SlicedEllpackMatrix& sm );
+
+   template< typename MT, bool SO >
+   inline SlicedEllpackMatrix( const Matrix<MT,SO>& m, size_t sigma=defaultSigma );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~SlicedEllpackMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline SlicedEllpackMatrix& operator=( const SlicedEllpackMatrix& rhs );
+
+   template< typename MT, bool SO > inline SlicedEllpackMatrix& operator=( const Matrix<MT,SO>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, SlicedEllpackMatrix >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, SlicedEllpackMatrix >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t               rows() const;
+                              inline size_t               columns() const;
+                              inline size_t               sigma() const;
+                              inline size_t               capacity() const;
+                              inline size_t               capacity( size_t i ) const;
+                              inline size_t               nonZeros() const;
+                              inline size_t               nonZeros( size_t i ) const;
+                              inline void                 reset();
+                              inline void                 reset( size_t i );
+                              inline void                 clear();
+   template< typename Other > inline SlicedEllpackMatrix& scale( const Other& scalar );
+                              inline void                 swap( SlicedEllpackMatrix& sm ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline Iterator      upperBound( size_t i, size_t j );
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline size_t        chunks() const;
+   inline size_t        chunkLength ( size_t k ) const;
+   inline const Type*   chunkValues ( size_t k ) const;
+   inline const IT*     chunkIndices( size_t k ) const;
+   inline const size_t* chunkRows   ( size_t k ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool canSMPAssign() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >           void initialize( const SparseMatrix<MT,false>& sm );
+   template< typename MT, bool SO >  void initialize( const Matrix<MT,SO>& m );
+
+   inline size_t lowerBoundOffset( size_t i, size_t j ) const;
+   inline size_t upperBoundOffset( size_t i, size_t j ) const;
+
+   static inline size_t checkIndexRange( size_t n );
+   static inline size_t adjustSigma( size_t sigma );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t  m_;         //!< The current number of rows of the sparse matrix.
+   size_t  n_;         //!< The current number of columns of the sparse matrix.
+   size_t  sigma_;     //!< The number of rows of each sorting window.
+   size_t  chunks_;    //!< The number of chunks of the sparse matrix.
+   size_t  nonzeros_;  //!< The number of non-zero elements of the sparse matrix.
+   size_t* start_;     //!< Offset of the first non-zero element of each row.
+   size_t* length_;    //!< The number of non-zero elements of each row.
+   size_t* capacity_;  //!< The number of stored (padded) elements of each row.
+   size_t* rows_;      //!< The row index of each chunk slot (\a m_ for padded slots).
+   size_t* offset_;    //!< Offset of the first element of each chunk.
+   IT*     index_;     //!< The column indices of all (padded) elements.
+   Type*   value_;     //!< The values of all (padded) elements.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE     ( IT   );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+const Type SlicedEllpackMatrix<Type,IT>::zero_ = Type();
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SlicedEllpackMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline SlicedEllpackMatrix<Type,IT>::SlicedEllpackMatrix()
+   : m_       ( 0UL )                          // The current number of rows of the sparse matrix
+   , n_       ( 0UL )                          // The current number of columns of the sparse matrix
+   , sigma_   ( adjustSigma( defaultSigma ) )  // The number of rows of each sorting window
+   , chunks_  ( 0UL )                          // The number of chunks of the sparse matrix
+   , nonzeros_( 0UL )                          // The number of non-zero elements of the sparse matrix
+   , start_   ( new size_t[1] )                // Offset of the first non-zero element of each row
+   , length_  ( start_ )                       // The number of non-zero elements of each row
+   , capacity_( start_ )                       // The number of stored elements of each row
+   , rows_    ( start_ )                       // The row index of each chunk slot
+   , offset_  ( start_ )                       // Offset of the first element of each chunk
+   , index_   ( NULL )                         // The column indices of all (padded) elements
+   , value_   ( NULL )                         // The values of all (padded) elements
+{
+   offset_[0UL] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param sigma The number of rows of each sorting window.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix. Note that the given window size \a sigma is
+// rounded up to the next multiple of \a chunkSize.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline SlicedEllpackMatrix<Type,IT>::SlicedEllpackMatrix( size_t m, size_t n, size_t sigma )
+   : m_       ( m )                                                // The current number of rows of the sparse matrix
+   , n_       ( checkIndexRange( n ) )                             // The current number of columns of the sparse matrix
+   , sigma_   ( adjustSigma( sigma ) )                             // The number of rows of each sorting window
+   , chunks_  ( ( m + chunkSize - 1UL ) / chunkSize )              // The number of chunks of the sparse matrix
+   , nonzeros_( 0UL )                                              // The number of non-zero elements of the sparse matrix
+   , start_   ( new size_t[3UL*m_+(chunkSize+1UL)*chunks_+1UL] )  // Offset of the first non-zero element of each row
+   , length_  ( start_+m_ )                                        // The number of non-zero elements of each row
+   , capacity_( length_+m_ )                                       // The number of stored elements of each row
+   , rows_    ( capacity_+m_ )                                     // The row index of each chunk slot
+   , offset_  ( rows_+chunks_*chunkSize )                          // Offset of the first element of each chunk
+   , index_   ( NULL )                                             // The column indices of all (padded) elements
+   , value_   ( NULL )                                             // The values of all (padded) elements
+{
+   for( size_t p=0UL; p<chunks_*chunkSize; ++p ) {
+      rows_[p] = ( p < m_ )?( p ):( m_ );
+   }
+
+   std::fill( start_ , start_+m_ , 0UL );
+   std::fill( length_, length_+m_, 0UL );
+   std::fill( capacity_, capacity_+m_, 0UL );
+   std::fill( offset_, offset_+chunks_+1UL, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for SlicedEllpackMatrix.
+//
+// \param sm Sparse matrix to be copied.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline SlicedEllpackMatrix<Type,IT>::SlicedEllpackMatrix( const SlicedEllpackMatrix& sm )
+   : m_       ( sm.m_ )                                            // The current number of rows of the sparse matrix
+   , n_       ( sm.n_ )                                            // The current number of columns of the sparse matrix
+   , sigma_   ( sm.sigma_ )                                        // The number of rows of each sorting window
+   , chunks_  ( sm.chunks_ )                                       // The number of chunks of the sparse matrix
+   , nonzeros_( sm.nonzeros_ )                                     // The number of non-zero elements of the sparse matrix
+   , start_   ( new size_t[3UL*m_+(chunkSize+1UL)*chunks_+1UL] )  // Offset of the first non-zero element of each row
+   , length_  ( start_+m_ )                                        // The number of non-zero elements of each row
+   , capacity_( length_+m_ )                                       // The number of stored elements of each row
+   , rows_    ( capacity_+m_ )                                     // The row index of each chunk slot
+   , offset_  ( rows_+chunks_*chunkSize )                          // Offset of the first element of each chunk
+   , index_   ( allocate<IT>( sm.capacity() ) )                    // The column indices of all (padded) elements
+   , value_   ( allocate<Type>( sm.capacity() ) )                  // The values of all (padded) elements
+{
+   std::copy( sm.start_, sm.start_+3UL*m_+(chunkSize+1UL)*chunks_+1UL, start_ );
+   std::copy( sm.index_, sm.index_+sm.capacity(), index_ );
+   std::copy( sm.value_, sm.value_+sm.capacity(), value_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense and sparse matrices.
+//
+// \param m Matrix to be converted.
+// \param sigma The number of rows of each sorting window.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// This constructor creates a SlicedEllpackMatrix from the given dense or sparse matrix. The
+// rows of the matrix are sorted by their number of non-zero elements within windows of
+// \a sigma rows. Note that the given window size is rounded up to the next multiple of
+// \a chunkSize.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+template< typename MT    // Type of the foreign matrix
+        , bool SO >      // Storage order of the foreign matrix
+inline SlicedEllpackMatrix<Type,IT>::SlicedEllpackMatrix( const Matrix<MT,SO>& m, size_t sigma )
+   : m_       ( (~m).rows() )                                      // The current number of rows of the sparse matrix
+   , n_       ( checkIndexRange( (~m).columns() ) )                // The current number of columns of the sparse matrix
+   , sigma_   ( adjustSigma( sigma ) )                             // The number of rows of each sorting window
+   , chunks_  ( ( m_ + chunkSize - 1UL ) / chunkSize )             // The number of chunks of the sparse matrix
+   , nonzeros_( 0UL )                                              // The number of non-zero elements of the sparse matrix
+   , start_   ( new size_t[3UL*m_+(chunkSize+1UL)*chunks_+1UL] )  // Offset of the first non-zero element of each row
+   , length_  ( start_+m_ )                                        // The number of non-zero elements of each row
+   , capacity_( length_+m_ )                                       // The number of stored elements of each row
+   , rows_    ( capacity_+m_ )                                     // The row index of each chunk slot
+   , offset_  ( rows_+chunks_*chunkSize )                          // Offset of the first element of each chunk
+   , index_   ( NULL )                                             // The column indices of all (padded) elements
+   , value_   ( NULL )                                             // The values of all (padded) elements
+{
+   initialize( ~m );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for SlicedEllpackMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline SlicedEllpackMatrix<Type,IT>::~SlicedEllpackMatrix()
+{
+   delete [] start_;
+   deallocate( index_ );
+   deallocate( value_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the element at the given position or to a zero element.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename SlicedEllpackMatrix<Type,IT>::ConstReference
+   SlicedEllpackMatrix<Type,IT>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos == end( i ) )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename SlicedEllpackMatrix<Type,IT>::Iterator
+   SlicedEllpackMatrix<Type,IT>::begin( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   return Iterator( value_+start_[i], index_+start_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   return ConstIterator( value_+start_[i], index_+start_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::cbegin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   return ConstIterator( value_+start_[i], index_+start_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename SlicedEllpackMatrix<Type,IT>::Iterator
+   SlicedEllpackMatrix<Type,IT>::end( size_t i )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t pos( start_[i] + length_[i]*chunkSize );
+   return Iterator( value_+pos, index_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t pos( start_[i] + length_[i]*chunkSize );
+   return ConstIterator( value_+pos, index_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::cend( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t pos( start_[i] + length_[i]*chunkSize );
+   return ConstIterator( value_+pos, index_+pos );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SlicedEllpackMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+//
+// The sparse matrix is resized according to the given sparse matrix and initialized as a
+// copy of this matrix, including its window size.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline SlicedEllpackMatrix<Type,IT>&
+   SlicedEllpackMatrix<Type,IT>::operator=( const SlicedEllpackMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   SlicedEllpackMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense and sparse matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The sparse matrix is resized according to the given matrix and initialized as a copy of
+// this matrix. The window size of the sparse matrix is preserved.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO >      // Storage order of the right-hand side matrix
+inline SlicedEllpackMatrix<Type,IT>&
+   SlicedEllpackMatrix<Type,IT>::operator=( const Matrix<MT,SO>& rhs )
+{
+   SlicedEllpackMatrix tmp( ~rhs, sigma_ );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a sparse matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, SlicedEllpackMatrix<Type,IT> >::Type&
+   SlicedEllpackMatrix<Type,IT>::operator*=( Other rhs )
+{
+   for( size_t i=0UL; i<m_; ++i ) {
+      const size_t end( start_[i] + length_[i]*chunkSize );
+      for( size_t pos=start_[i]; pos<end; pos+=chunkSize )
+         value_[pos] *= rhs;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a sparse matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, SlicedEllpackMatrix<Type,IT> >::Type&
+   SlicedEllpackMatrix<Type,IT>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   typedef typename DivTrait<Type,Other>::Type  DT;
+   typedef typename If< IsNumeric<DT>, DT, Other >::Type  Tmp;
+
+   // Depending on the two involved data types, an integer division is applied or a
+   // floating point division is selected.
+   if( IsNumeric<DT>::value && IsFloatingPoint<DT>::value ) {
+      const Tmp tmp( Tmp(1)/static_cast<Tmp>( rhs ) );
+      for( size_t i=0UL; i<m_; ++i ) {
+         const size_t end( start_[i] + length_[i]*chunkSize );
+         for( size_t pos=start_[i]; pos<end; pos+=chunkSize )
+            value_[pos] *= tmp;
+      }
+   }
+   else {
+      for( size_t i=0UL; i<m_; ++i ) {
+         const size_t end( start_[i] + length_[i]*chunkSize );
+         for( size_t pos=start_[i]; pos<end; pos+=chunkSize )
+            value_[pos] /= rhs;
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::rows() const
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::columns() const
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of each sorting window.
+//
+// \return The number of rows of each sorting window.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::sigma() const
+{
+   return sigma_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of stored elements of the sparse matrix.
+//
+// \return The total number of stored elements including the padded zeros.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::capacity() const
+{
+   return offset_[chunks_];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of the specified row.
+//
+// \param i The index of the row.
+// \return The number of stored elements of row \a i.
+//
+// The capacity of a row corresponds to the number of non-zero elements of the longest row of
+// its chunk.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::capacity( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return capacity_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::nonZeros() const
+{
+   return nonzeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return length_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function resets all stored elements to zero and removes them from the rows. Note that
+// the size and the capacity of the matrix remain unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline void SlicedEllpackMatrix<Type,IT>::reset()
+{
+   std::fill( value_, value_+capacity(), Type() );
+   std::fill( length_, length_+m_, 0UL );
+   nonzeros_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row to the default initial values.
+//
+// \param i The index of the row to be resetted.
+// \return void
+//
+// This function resets the values in the specified row to their default value and removes
+// them from the row. Note that the capacity of the row remains unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline void SlicedEllpackMatrix<Type,IT>::reset( size_t i )
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t end( start_[i] + length_[i]*chunkSize );
+   for( size_t pos=start_[i]; pos<end; pos+=chunkSize )
+      value_[pos] = Type();
+
+   nonzeros_ -= length_[i];
+   length_[i] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0. The window size is preserved.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline void SlicedEllpackMatrix<Type,IT>::clear()
+{
+   SlicedEllpackMatrix tmp( 0UL, 0UL, sigma_ );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the sparse matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the sparse matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the scalar value
+inline SlicedEllpackMatrix<Type,IT>& SlicedEllpackMatrix<Type,IT>::scale( const Other& scalar )
+{
+   for( size_t i=0UL; i<m_; ++i ) {
+      const size_t end( start_[i] + length_[i]*chunkSize );
+      for( size_t pos=start_[i]; pos<end; pos+=chunkSize )
+         value_[pos] *= scalar;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The sparse matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline void SlicedEllpackMatrix<Type,IT>::swap( SlicedEllpackMatrix& sm ) /* throw() */
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( sigma_, sm.sigma_ );
+   std::swap( chunks_, sm.chunks_ );
+   std::swap( nonzeros_, sm.nonzeros_ );
+   std::swap( start_, sm.start_ );
+   std::swap( length_, sm.length_ );
+   std::swap( capacity_, sm.capacity_ );
+   std::swap( rows_, sm.rows_ );
+   std::swap( offset_, sm.offset_ );
+   std::swap( index_, sm.index_ );
+   std::swap( value_, sm.value_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking whether the given number of columns can be represented by the index type.
+//
+// \param n The number of columns of the matrix.
+// \return The given number \a n.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::checkIndexRange( size_t n )
+{
+   if( n > 0UL && n-1UL > static_cast<size_t>( std::numeric_limits<IT>::max() ) )
+      throw std::invalid_argument( "Matrix size exceeds the range of the index type" );
+   return n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rounding the given window size up to the next multiple of the chunk size.
+//
+// \param sigma The requested number of rows of each sorting window.
+// \return The adjusted window size (at least \a chunkSize).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::adjustSigma( size_t sigma )
+{
+   if( sigma < size_t( chunkSize ) )
+      return chunkSize;
+   return ( ( sigma + chunkSize - 1UL ) / chunkSize ) * chunkSize;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting up the chunks of the matrix from a row-major sparse matrix.
+//
+// \param sm The row-major sparse matrix to be converted.
+// \return void
+//
+// This function sorts the rows within each window of \a sigma rows by their number of non-zero
+// elements, determines the width of each chunk, and copies the non-zero elements into the
+// interleaved, padded chunk storage. Padded elements are zero and repeat the last column index
+// of their row in order to keep the accesses to the dense vector within the same cache line.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+template< typename MT >  // Type of the foreign sparse matrix
+void SlicedEllpackMatrix<Type,IT>::initialize( const SparseMatrix<MT,false>& sm )
+{
+   typedef typename MT::CompositeType                         CT;
+   typedef typename RemoveReference<CT>::Type::ConstIterator  RhsIterator;
+
+   CT A( ~sm );  // Evaluation of the sparse matrix operand
+
+   BLAZE_INTERNAL_ASSERT( A.rows()    == m_, "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( A.columns() == n_, "Invalid number of columns" );
+
+   // Counting the non-zero elements of each row
+   nonzeros_ = 0UL;
+   for( size_t i=0UL; i<m_; ++i ) {
+      length_[i] = 0UL;
+      for( RhsIterator element=A.begin(i); element!=A.end(i); ++element )
+         ++length_[i];
+      nonzeros_ += length_[i];
+   }
+
+   // Sorting the rows within each window by their number of non-zero elements
+   for( size_t p=0UL; p<chunks_*chunkSize; ++p ) {
+      rows_[p] = ( p < m_ )?( p ):( m_ );
+   }
+
+   for( size_t wbegin=0UL; wbegin<m_; wbegin+=sigma_ ) {
+      const size_t wend( std::min( wbegin+sigma_, m_ ) );
+      std::stable_sort( rows_+wbegin, rows_+wend, LongerRow( length_ ) );
+   }
+
+   // Computing the width and the offset of each chunk
+   offset_[0UL] = 0UL;
+   for( size_t k=0UL; k<chunks_; ++k )
+   {
+      size_t width( 0UL );
+      for( size_t s=0UL; s<chunkSize; ++s ) {
+         const size_t row( rows_[k*chunkSize+s] );
+         if( row < m_ && length_[row] > width )
+            width = length_[row];
+      }
+
+      offset_[k+1UL] = offset_[k] + width*chunkSize;
+   }
+
+   index_ = allocate<IT>  ( capacity() );
+   value_ = allocate<Type>( capacity() );
+
+   // Copying the non-zero elements into the interleaved chunk storage
+   for( size_t k=0UL; k<chunks_; ++k )
+   {
+      const size_t width( ( offset_[k+1UL] - offset_[k] ) / chunkSize );
+
+      for( size_t s=0UL; s<chunkSize; ++s )
+      {
+         const size_t row( rows_[k*chunkSize+s] );
+         size_t pos( offset_[k]+s );
+         size_t l( 0UL );
+         IT last( 0 );
+
+         if( row < m_ ) {
+            start_[row]    = pos;
+            capacity_[row] = width;
+
+            for( RhsIterator element=A.begin(row); element!=A.end(row); ++element, ++l, pos+=chunkSize ) {
+               last = static_cast<IT>( element->index() );
+               index_[pos] = last;
+               value_[pos] = element->value();
+            }
+         }
+
+         for( ; l<width; ++l, pos+=chunkSize ) {
+            index_[pos] = last;
+            value_[pos] = Type();
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting up the chunks of the matrix from an arbitrary dense or sparse matrix.
+//
+// \param m The matrix to be converted.
+// \return void
+//
+// The given matrix is first converted into a row-major compressed matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+template< typename MT    // Type of the foreign matrix
+        , bool SO >      // Storage order of the foreign matrix
+void SlicedEllpackMatrix<Type,IT>::initialize( const Matrix<MT,SO>& m )
+{
+   const CompressedMatrix<Type,false,IT> tmp( ~m );
+   initialize( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename SlicedEllpackMatrix<Type,IT>::Iterator
+   SlicedEllpackMatrix<Type,IT>::find( size_t i, size_t j )
+{
+   const size_t pos( lowerBoundOffset( i, j ) );
+
+   if( pos != start_[i] + length_[i]*chunkSize && index_[pos] == j )
+      return Iterator( value_+pos, index_+pos );
+   else return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::find( size_t i, size_t j ) const
+{
+   const size_t pos( lowerBoundOffset( i, j ) );
+
+   if( pos != start_[i] + length_[i]*chunkSize && index_[pos] == j )
+      return ConstIterator( value_+pos, index_+pos );
+   else return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename SlicedEllpackMatrix<Type,IT>::Iterator
+   SlicedEllpackMatrix<Type,IT>::lowerBound( size_t i, size_t j )
+{
+   const size_t pos( lowerBoundOffset( i, j ) );
+   return Iterator( value_+pos, index_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::lowerBound( size_t i, size_t j ) const
+{
+   const size_t pos( lowerBoundOffset( i, j ) );
+   return ConstIterator( value_+pos, index_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename SlicedEllpackMatrix<Type,IT>::Iterator
+   SlicedEllpackMatrix<Type,IT>::upperBound( size_t i, size_t j )
+{
+   const size_t pos( upperBoundOffset( i, j ) );
+   return Iterator( value_+pos, index_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::upperBound( size_t i, size_t j ) const
+{
+   const size_t pos( upperBoundOffset( i, j ) );
+   return ConstIterator( value_+pos, index_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the first element of row \a i not less then the given index.
+//
+// \param i The row index of the search element.
+// \param j The column index of the search element.
+// \return Offset of the first element not less then \a j.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::lowerBoundOffset( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   size_t first( start_[i] );
+   size_t count( length_[i] );
+
+   while( count > 0UL ) {
+      const size_t step( count / 2UL );
+      const size_t pos ( first + step*chunkSize );
+      if( static_cast<size_t>( index_[pos] ) < j ) {
+         first  = pos + chunkSize;
+         count -= step + 1UL;
+      }
+      else count = step;
+   }
+
+   return first;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the first element of row \a i greater then the given index.
+//
+// \param i The row index of the search element.
+// \param j The column index of the search element.
+// \return Offset of the first element greater then \a j.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::upperBoundOffset( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   size_t first( start_[i] );
+   size_t count( length_[i] );
+
+   while( count > 0UL ) {
+      const size_t step( count / 2UL );
+      const size_t pos ( first + step*chunkSize );
+      if( static_cast<size_t>( index_[pos] ) <= j ) {
+         first  = pos + chunkSize;
+         count -= step + 1UL;
+      }
+      else count = step;
+   }
+
+   return first;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of chunks of the sparse matrix.
+//
+// \return The number of chunks of \a chunkSize rows.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::chunks() const
+{
+   return chunks_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements per row of the specified chunk.
+//
+// \param k The index of the chunk.
+// \return The number of stored elements per row of chunk \a k.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline size_t SlicedEllpackMatrix<Type,IT>::chunkLength( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k < chunks_, "Invalid chunk access index" );
+   return ( offset_[k+1UL] - offset_[k] ) / chunkSize;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the values of the specified chunk.
+//
+// \param k The index of the chunk.
+// \return Pointer to the values of chunk \a k.
+//
+// The values of the chunk are stored column by column, i.e. the element \a l of the row in
+// slot \a s is located at position \f$ l \cdot C + s \f$, where \a C is the chunk size.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline const Type* SlicedEllpackMatrix<Type,IT>::chunkValues( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k < chunks_, "Invalid chunk access index" );
+   return value_ + offset_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the column indices of the specified chunk.
+//
+// \param k The index of the chunk.
+// \return Pointer to the column indices of chunk \a k.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline const IT* SlicedEllpackMatrix<Type,IT>::chunkIndices( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k < chunks_, "Invalid chunk access index" );
+   return index_ + offset_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the row indices of the slots of the specified chunk.
+//
+// \param k The index of the chunk.
+// \return Pointer to the \a chunkSize row indices of chunk \a k.
+//
+// The row index of padded slots at the end of the matrix is equal to the number of rows.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline const size_t* SlicedEllpackMatrix<Type,IT>::chunkRows( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k < chunks_, "Invalid chunk access index" );
+   return rows_ + k*chunkSize;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool SlicedEllpackMatrix<Type,IT>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool SlicedEllpackMatrix<Type,IT>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline bool SlicedEllpackMatrix<Type,IT>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SLICEDELLPACKMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SlicedEllpackMatrix operators */
+//@{
+template< typename Type, typename IT >
+inline void reset( SlicedEllpackMatrix<Type,IT>& m );
+
+template< typename Type, typename IT >
+inline void reset( SlicedEllpackMatrix<Type,IT>& m, size_t i );
+
+template< typename Type, typename IT >
+inline void clear( SlicedEllpackMatrix<Type,IT>& m );
+
+template< typename Type, typename IT >
+inline bool isDefault( const SlicedEllpackMatrix<Type,IT>& m );
+
+template< typename Type, typename IT >
+inline void swap( SlicedEllpackMatrix<Type,IT>& a, SlicedEllpackMatrix<Type,IT>& b ) /* throw() */;
+
+template< typename Type, typename IT >
+inline void move( SlicedEllpackMatrix<Type,IT>& dst, SlicedEllpackMatrix<Type,IT>& src ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given sliced ELLPACK matrix.
+// \ingroup sliced_ellpack_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline void reset( SlicedEllpackMatrix<Type,IT>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row of the given sliced ELLPACK matrix.
+// \ingroup sliced_ellpack_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row to be resetted.
+// \return void
+//
+// This function resets the values in the specified row of the given sliced ELLPACK matrix to
+// their default value. Note that the capacity of the row remains unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline void reset( SlicedEllpackMatrix<Type,IT>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given sliced ELLPACK matrix.
+// \ingroup sliced_ellpack_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline void clear( SlicedEllpackMatrix<Type,IT>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given sliced ELLPACK matrix is in default state.
+// \ingroup sliced_ellpack_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the sliced ELLPACK matrix is in default (constructed) state,
+// i.e. if it's number of rows and columns is 0. In case it is in default state, the function
+// returns \a true, else it will return \a false.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline bool isDefault( const SlicedEllpackMatrix<Type,IT>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sliced ELLPACK matrices.
+// \ingroup sliced_ellpack_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline void swap( SlicedEllpackMatrix<Type,IT>& a, SlicedEllpackMatrix<Type,IT>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving the contents of one sliced ELLPACK matrix to another.
+// \ingroup sliced_ellpack_matrix
+//
+// \param dst The destination matrix.
+// \param src The source matrix.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , typename IT >  // Index type
+inline void move( SlicedEllpackMatrix<Type,IT>& dst, SlicedEllpackMatrix<Type,IT>& src ) /* throw() */
+{
+   dst.swap( src );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASSLICEDELLPACKSTORAGE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, typename IT >
+struct HasSlicedEllpackStorage< SlicedEllpackMatrix<T,IT> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+
+template< typename T, typename IT, bool AF >
+struct HasSlicedEllpackStorage< SparseSubmatrix<SlicedEllpackMatrix<T,IT>,AF,false> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+
+template< typename T, typename IT, bool AF >
+struct HasSlicedEllpackStorage< SparseSubmatrix<const SlicedEllpackMatrix<T,IT>,AF,false> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename IT, typename T2, bool SO >
+struct AddTrait< SlicedEllpackMatrix<T1,IT>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct AddTrait< DynamicMatrix<T1,SO>, SlicedEllpackMatrix<T2,IT> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, typename IT1, typename T2, bool SO, typename IT2 >
+struct AddTrait< SlicedEllpackMatrix<T1,IT1>, CompressedMatrix<T2,SO,IT2> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename IT1, typename T2, typename IT2 >
+struct AddTrait< CompressedMatrix<T1,SO,IT1>, SlicedEllpackMatrix<T2,IT2> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename IT1, typename T2, typename IT2 >
+struct AddTrait< SlicedEllpackMatrix<T1,IT1>, SlicedEllpackMatrix<T2,IT2> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type, false >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename IT, typename T2, bool SO >
+struct SubTrait< SlicedEllpackMatrix<T1,IT>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct SubTrait< DynamicMatrix<T1,SO>, SlicedEllpackMatrix<T2,IT> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, typename IT1, typename T2, bool SO, typename IT2 >
+struct SubTrait< SlicedEllpackMatrix<T1,IT1>, CompressedMatrix<T2,SO,IT2> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename IT1, typename T2, typename IT2 >
+struct SubTrait< CompressedMatrix<T1,SO,IT1>, SlicedEllpackMatrix<T2,IT2> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename IT1, typename T2, typename IT2 >
+struct SubTrait< SlicedEllpackMatrix<T1,IT1>, SlicedEllpackMatrix<T2,IT2> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type, false >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename IT, typename T2 >
+struct MultTrait< SlicedEllpackMatrix<T1,IT>, T2 >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false, IT >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+
+template< typename T1, typename T2, typename IT >
+struct MultTrait< T1, SlicedEllpackMatrix<T2,IT> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false, IT >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
+};
+
+template< typename T1, typename IT, typename T2, size_t N >
+struct MultTrait< SlicedEllpackMatrix<T1,IT>, StaticVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, typename IT >
+struct MultTrait< StaticVector<T1,N,true>, SlicedEllpackMatrix<T2,IT> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, typename IT, typename T2, size_t N >
+struct MultTrait< SlicedEllpackMatrix<T1,IT>, HybridVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, typename IT >
+struct MultTrait< HybridVector<T1,N,true>, SlicedEllpackMatrix<T2,IT> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, typename IT, typename T2 >
+struct MultTrait< SlicedEllpackMatrix<T1,IT>, DynamicVector<T2,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2, typename IT >
+struct MultTrait< DynamicVector<T1,true>, SlicedEllpackMatrix<T2,IT> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, typename IT1, typename T2, typename IT2 >
+struct MultTrait< SlicedEllpackMatrix<T1,IT1>, CompressedVector<T2,false,IT2> >
+{
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename IT1, typename T2, typename IT2 >
+struct MultTrait< CompressedVector<T1,true,IT1>, SlicedEllpackMatrix<T2,IT2> >
+{
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, typename IT, typename T2, bool SO >
+struct MultTrait< SlicedEllpackMatrix<T1,IT>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, typename IT >
+struct MultTrait< DynamicMatrix<T1,SO>, SlicedEllpackMatrix<T2,IT> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, typename IT1, typename T2, bool SO, typename IT2 >
+struct MultTrait< SlicedEllpackMatrix<T1,IT1>, CompressedMatrix<T2,SO,IT2> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename IT1, typename T2, typename IT2 >
+struct MultTrait< CompressedMatrix<T1,SO,IT1>, SlicedEllpackMatrix<T2,IT2> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, typename IT1, typename T2, typename IT2 >
+struct MultTrait< SlicedEllpackMatrix<T1,IT1>, SlicedEllpackMatrix<T2,IT2> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename IT, typename T2 >
+struct DivTrait< SlicedEllpackMatrix<T1,IT>, T2 >
+{
+   typedef CompressedMatrix< typename DivTrait<T1,T2>::Type, false, IT >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATHTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename IT1, typename T2, typename IT2 >
+struct MathTrait< SlicedEllpackMatrix<T1,IT1>, SlicedEllpackMatrix<T2,IT2> >
+{
+   typedef SlicedEllpackMatrix< typename MathTrait<T1,T2>::HighType >  HighType;
+   typedef SlicedEllpackMatrix< typename MathTrait<T1,T2>::LowType  >  LowType;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename IT >
+struct SubmatrixTrait< SlicedEllpackMatrix<T1,IT> >
+{
+   typedef CompressedMatrix<T1,false,IT>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename IT >
+struct RowTrait< SlicedEllpackMatrix<T1,IT> >
+{
+   typedef CompressedVector<T1,true,IT>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename IT >
+struct ColumnTrait< SlicedEllpackMatrix<T1,IT> >
+{
+   typedef CompressedVector<T1,false,IT>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,2874 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SymmetricCompressedMatrix.h
+//  \brief Implementation of a symmetric sparse NxN matrix storing a single triangle
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+
+
+
+#ifndef _BLAZE_MATH_SPARSE_SYMMETRICCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_SYMMETRICCOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/SparseElement.h>
+#include <blaze/math/sparse/SparseMatrix.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MathTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/HasHalfStorage.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSquare.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/views/Forward.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Null.h>
+#include <blaze/util/SelectType.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup symmetric_compressed_matrix SymmetricCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Symmetric \f$ N \times N \f$ sparse matrix storing only a single triangle.
+// \ingroup symmetric_compressed_matrix
+//
+// The SymmetricCompressedMatrix class template is a row-major symmetric sparse matrix that only
+// stores the elements of either its upper or its lower triangle (including the diagonal) in a
+// CompressedMatrix. In comparison to a SymmetricMatrix< CompressedMatrix<Type> >, which stores
+// both triangles, this halves the memory requirements of the matrix and the memory traffic of
+// the sparse matrix/dense vector multiplication: every stored off-diagonal element \f$ a_{ij} \f$
+// is read only once and applied twice, once as \f$ a_{ij} \f$ and once as \f$ a_{ji} \f$. The
+// type of the elements, the stored triangle, and the type of the stored indices can be specified
+// via the three template parameters:
+
+   \code
+   template< typename Type, bool UF, typename IT >
+   class SymmetricCompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. SymmetricCompressedMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - UF  : specifies the stored triangle. In case the flag is set to \a true (the default), the
+//          upper triangle is stored, otherwise the lower triangle.
+//  - IT  : specifies the integral type used to store the column indices of the non-zero elements.
+//          The default value is \a size_t. The number of rows and columns must not exceed the
+//          range of this type.
+//
+// The matrix provides the same interface as a SymmetricMatrix< CompressedMatrix<Type> >: it can
+// be created from and assigned any symmetric dense or sparse matrix, any modification of an
+// element \f$ a_{ij} \f$ implicitly modifies \f$ a_{ji} \f$, and the iterators traverse complete
+// rows including the elements of the opposite triangle. In order to provide full row access,
+// the matrix maintains a compact mirror index, which lists the row indices of all stored elements
+// of each column. Since only indices and no values are duplicated, accesses to elements of the
+// opposite triangle are slightly slower than accesses to stored elements (a binary search in the
+// according stored row):
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::SymmetricCompressedMatrix;
+   using blaze::SymmetricMatrix;
+
+   SymmetricMatrix< CompressedMatrix<double> > A( 3000UL );
+   // ... Initialization of the symmetric matrix
+
+   SymmetricCompressedMatrix<double> B( A );  // Storing only the upper triangle of A
+
+   B(0,2) = 4.0;  // Modifies both B(0,2) and B(2,0)
+   B(3,1) = 2.0;  // Modifies both B(3,1) and B(1,3)
+
+   DynamicVector<double> x( 3000UL ), y;
+   // ... Initialization of the dense vector
+
+   y = B * x;  // Sparse matrix/dense vector multiplication reading every element only once
+   \endcode
+
+// Note that any attempt to setup or assign a non-symmetric matrix results in a
+// \a std::invalid_argument exception.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+class SymmetricCompressedMatrix : public SparseMatrix< SymmetricCompressedMatrix<Type,UF,IT>, false >
+{
+ public:
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for the stored triangle.
+   /*! The \a storesUpper compilation flag indicates whether the matrix stores its upper (1) or
+       lower (0) triangle. */
+   enum { storesUpper = UF };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef CompressedMatrix<Type,false,IT>  TriangleType;  //!< Type of the stored triangle.
+   //**********************************************************************************************
+
+   //**SymElement class definition*****************************************************************
+   /*!\brief Access proxy for a single element of a SymmetricCompressedMatrix.
+   //
+   // The SymElement class combines the value of an element of the stored triangle with a column
+   // index and provides the same interface as the value-index-pairs of CompressedMatrix.
+   */
+   template< typename VT >  // Type of the value (Type or const Type)
+   class SymElement : private SparseElement
+   {
+    public:
+      //**Type definitions*************************************************************************
+      typedef Type         ValueType;       //!< The value type of the element.
+      typedef size_t       IndexType;       //!< The index type of the element.
+      typedef VT&          Reference;       //!< Reference return type.
+      typedef const Type&  ConstReference;  //!< Reference-to-const return type.
+      typedef SymElement*  Pointer;         //!< Pointer return type.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the SymElement class.
+      //
+      // \param value Pointer to the value of the element.
+      // \param index The column index of the element.
+      */
+      inline SymElement( VT* value, size_t index )
+         : value_( value )  // Pointer to the value of the element
+         , index_( index )  // The column index of the element
+      {}
+      //*******************************************************************************************
+
+      //**Assignment operator**********************************************************************
+      /*!\brief Assignment to the accessed sparse matrix element.
+      //
+      // \param v The new value of the sparse matrix element.
+      // \return Reference to the sparse matrix element.
+      */
+      template< typename T > inline SymElement& operator=( const T& v ) {
+         *value_ = v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment to the accessed sparse matrix element.
+      //
+      // \param v The right-hand side value for the addition.
+      // \return Reference to the sparse matrix element.
+      */
+      template< typename T > inline SymElement& operator+=( const T& v ) {
+         *value_ += v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment to the accessed sparse matrix element.
+      //
+      // \param v The right-hand side value for the subtraction.
+      // \return Reference to the sparse matrix element.
+      */
+      template< typename T > inline SymElement& operator-=( const T& v ) {
+         *value_ -= v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Multiplication assignment operator*******************************************************
+      /*!\brief Multiplication assignment to the accessed sparse matrix element.
+      //
+      // \param v The right-hand side value for the multiplication.
+      // \return Reference to the sparse matrix element.
+      */
+      template< typename T > inline SymElement& operator*=( const T& v ) {
+         *value_ *= v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Division assignment operator*************************************************************
+      /*!\brief Division assignment to the accessed sparse matrix element.
+      //
+      // \param v The right-hand side value for the division.
+      // \return Reference to the sparse matrix element.
+      */
+      template< typename T > inline SymElement& operator/=( const T& v ) {
+         *value_ /= v;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline Pointer operator->() {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline Reference value() const {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline IndexType index() const {
+         return index_;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      VT*    value_;  //!< Pointer to the value of the element.
+      size_t index_;  //!< The column index of the element.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**SymIterator class definition****************************************************************
+   /*!\brief Iterator over the elements of a row of a SymmetricCompressedMatrix.
+   //
+   // The SymIterator traverses a complete row of the symmetric matrix in ascending order of the
+   // column indices. It consists of two positions: a position within the mirror index of the row
+   // (i.e. the elements of the opposite triangle, which are stored in other rows) and a position
+   // within the according row of the stored triangle. In case the upper triangle is stored, the
+   // mirrored elements precede the stored elements, otherwise they follow the stored elements.
+   */
+   template< typename VT >  // Type of the value (Type or const Type)
+   class SymIterator
+   {
+    private:
+      //**Type definitions*************************************************************************
+      //! Type of the stored triangle.
+      typedef typename SelectType< IsConst<VT>::value, const TriangleType, TriangleType >::Type  MT;
+
+      //! Iterator type of the stored triangle.
+      typedef typename SelectType< IsConst<VT>::value, typename TriangleType::ConstIterator
+                                                     , typename TriangleType::Iterator >::Type  TI;
+      //*******************************************************************************************
+
+    public:
+      //**Type definitions*************************************************************************
+      typedef std::forward_iterator_tag  IteratorCategory;  //!< The iterator category.
+      typedef SymElement<VT>             ValueType;         //!< Type of the underlying elements.
+      typedef ValueType                  PointerType;       //!< Pointer return type.
+      typedef ValueType                  ReferenceType;     //!< Reference return type.
+      typedef ptrdiff_t                  DifferenceType;    //!< Difference between two iterators.
+
+      // STL iterator requirements
+      typedef IteratorCategory  iterator_category;  //!< The iterator category.
+      typedef ValueType         value_type;         //!< Type of the underlying elements.
+      typedef PointerType       pointer;            //!< Pointer return type.
+      typedef ReferenceType     reference;          //!< Reference return type.
+      typedef DifferenceType    difference_type;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Default constructor**********************************************************************
+      /*!\brief Default constructor for the SymIterator class.
+      */
+      inline SymIterator()
+         : matrix_( NULL )  // Pointer to the stored triangle
+         , row_   ( 0UL  )  // The index of the traversed row
+         , mpos_  ( NULL )  // Current position within the mirror index of the row
+         , mend_  ( NULL )  // End of the mirror index of the row
+         , pos_   ()        // Current position within the stored row
+         , end_   ()        // End of the stored row
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the SymIterator class.
+      //
+      // \param matrix The stored triangle.
+      // \param row The index of the traversed row.
+      // \param mpos Current position within the mirror index of the row.
+      // \param mend End of the mirror index of the row.
+      // \param pos Current position within the stored row.
+      // \param end End of the stored row.
+      */
+      inline SymIterator( MT* matrix, size_t row, const IT* mpos, const IT* mend, TI pos, TI end )
+         : matrix_( matrix )  // Pointer to the stored triangle
+         , row_   ( row    )  // The index of the traversed row
+         , mpos_  ( mpos   )  // Current position within the mirror index of the row
+         , mend_  ( mend   )  // End of the mirror index of the row
+         , pos_   ( pos    )  // Current position within the stored row
+         , end_   ( end    )  // End of the stored row
+      {}
+      //*******************************************************************************************
+
+      //**Conversion constructor*******************************************************************
+      /*!\brief Conversion constructor from different SymIterator instances.
+      //
+      // \param it The iterator to be copied.
+      */
+      template< typename VT2 >
+      inline SymIterator( const SymIterator<VT2>& it )
+         : matrix_( it.matrix_ )  // Pointer to the stored triangle
+         , row_   ( it.row_    )  // The index of the traversed row
+         , mpos_  ( it.mpos_   )  // Current position within the mirror index of the row
+         , mend_  ( it.mend_   )  // End of the mirror index of the row
+         , pos_   ( it.pos_    )  // Current position within the stored row
+         , end_   ( it.end_    )  // End of the stored row
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline SymIterator& operator++() {
+         if( isMirrored() ) ++mpos_;
+         else ++pos_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const SymIterator operator++( int ) {
+         const SymIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the current sparse matrix element.
+      //
+      // \return Access proxy for the current sparse matrix element.
+      */
+      inline ReferenceType operator*() const {
+         if( isMirrored() )
+            return ReferenceType( &matrix_->find( *mpos_, row_ )->value(), *mpos_ );
+         else
+            return ReferenceType( &pos_->value(), pos_->index() );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the current sparse matrix element.
+      //
+      // \return Access proxy for the current sparse matrix element.
+      */
+      inline PointerType operator->() const {
+         return **this;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two SymIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      template< typename VT2 >
+      inline bool operator==( const SymIterator<VT2>& rhs ) const {
+         return mpos_ == rhs.mpos_ && pos_ == rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two SymIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      template< typename VT2 >
+      inline bool operator!=( const SymIterator<VT2>& rhs ) const {
+         return mpos_ != rhs.mpos_ || pos_ != rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two SymIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      template< typename VT2 >
+      inline DifferenceType operator-( const SymIterator<VT2>& rhs ) const {
+         return ( mpos_ - rhs.mpos_ ) + ( pos_ - rhs.pos_ );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Mirror check*****************************************************************************
+      /*!\brief Returns whether the iterator refers to an element of the opposite triangle.
+      //
+      // \return \a true in case the current element is mirrored, \a false if it is stored.
+      */
+      inline bool isMirrored() const {
+         return ( UF )?( mpos_ != mend_ ):( pos_ == end_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      MT*       matrix_;  //!< Pointer to the stored triangle.
+      size_t    row_;     //!< The index of the traversed row.
+      const IT* mpos_;    //!< Current position within the mirror index of the row.
+      const IT* mend_;    //!< End of the mirror index of the row.
+      TI        pos_;     //!< Current position within the stored row.
+      TI        end_;     //!< End of the stored row.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      /*! \cond BLAZE_INTERNAL */
+      template< typename VT2 > friend class SymIterator;
+      /*! \endcond */
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef SymmetricCompressedMatrix<Type,UF,IT>  This;            //!< Type of this SymmetricCompressedMatrix instance.
+   typedef This                                   ResultType;      //!< Result type for expression template evaluations.
+   typedef CompressedMatrix<Type,true,IT>         OppositeType;    //!< Result type with opposite storage order for expression template evaluations.
+   typedef CompressedMatrix<Type,true,IT>         TransposeType;   //!< Transpose type for expression template evaluations.
+   typedef Type                                   ElementType;     //!< Type of the sparse matrix elements.
+   typedef IT                                     IndexType;       //!< Type of the stored indices.
+   typedef const Type&                            ReturnType;      //!< Return type for expression template evaluations.
+   typedef const This&                            CompositeType;   //!< Data type for composite expression templates.
+   typedef Type&                                  Reference;       //!< Reference to a sparse matrix value.
+   typedef const Type&                            ConstReference;  //!< Reference to a constant sparse matrix value.
+   typedef SymIterator<Type>                      Iterator;        //!< Iterator over non-constant elements.
+   typedef SymIterator<const Type>                ConstIterator;   //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SymmetricCompressedMatrix with different data/element type.
+   */
+   template< typename ET >  // Data type of the other matrix
+   struct Rebind {
+      typedef SymmetricCompressedMatrix<ET,UF,IT>  Other;  //!< The type of the other SymmetricCompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since a SymmetricCompressedMatrix is never the target of an SMP assignment,
+       the flag only enables the parallel evaluation of expressions involving the matrix. */
+   enum { smpAssignable = 1 };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SymmetricCompressedMatrix();
+   explicit inline SymmetricCompressedMatrix( size_t n );
+   explicit inline SymmetricCompressedMatrix( size_t n, size_t nonzeros );
+   explicit inline SymmetricCompressedMatrix( size_t n, const std::vector<size_t>& nonzeros );
+            inline SymmetricCompressedMatrix( const SymmetricCompressedMatrix& m );
+
+   template< typename MT, bool SO >
+   inline SymmetricCompressedMatrix( const Matrix<MT,SO>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~SymmetricCompressedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j );
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline SymmetricCompressedMatrix& operator=( const SymmetricCompressedMatrix& rhs );
+
+   template< typename MT, bool SO > inline SymmetricCompressedMatrix& operator= ( const Matrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline SymmetricCompressedMatrix& operator+=( const Matrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline SymmetricCompressedMatrix& operator-=( const Matrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline SymmetricCompressedMatrix& operator*=( const Matrix<MT,SO>& rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, SymmetricCompressedMatrix >::Type&
+      operator*=( Other rhs );
+
+   template< typename Other >
+   inline typename EnableIf< IsNumeric<Other>, SymmetricCompressedMatrix >::Type&
+      operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+                              inline size_t                     rows() const;
+                              inline size_t                     columns() const;
+                              inline size_t                     capacity() const;
+                              inline size_t                     capacity( size_t i ) const;
+                              inline size_t                     nonZeros() const;
+                              inline size_t                     nonZeros( size_t i ) const;
+                              inline void                       reset();
+                              inline void                       reset( size_t i );
+                              inline void                       clear();
+                              inline Iterator                   set    ( size_t i, size_t j, const Type& value );
+                              inline Iterator                   insert ( size_t i, size_t j, const Type& value );
+                              inline void                       erase  ( size_t i, size_t j );
+                              inline Iterator                   erase  ( size_t i, Iterator pos );
+                              inline Iterator                   erase  ( size_t i, Iterator first, Iterator last );
+                              inline void                       resize ( size_t n, bool preserve=true );
+                              inline void                       reserve( size_t nonzeros );
+                              inline void                       reserve( size_t i, size_t nonzeros );
+                              inline void                       trim   ();
+                              inline void                       trim   ( size_t i );
+                              inline SymmetricCompressedMatrix& transpose();
+   template< typename Other > inline SymmetricCompressedMatrix& scale( const Other& scalar );
+   template< typename Other > inline SymmetricCompressedMatrix& scaleDiagonal( Other scalar );
+                              inline void                       swap( SymmetricCompressedMatrix& m ) /* throw() */;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline Iterator      upperBound( size_t i, size_t j );
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Low-level utility functions*****************************************************************
+   /*!\name Low-level utility functions */
+   //@{
+   inline void                append     ( size_t i, size_t j, const Type& value, bool check=false );
+   inline void                finalize   ( size_t i );
+   inline const TriangleType& triangle   () const;
+   inline const IT*           mirrorBegin( size_t i ) const;
+   inline const IT*           mirrorEnd  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const;
+   template< typename Other > inline bool isAliased( const Other* alias ) const;
+
+   inline bool canSMPAssign() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO > bool initialize( const Matrix<MT,SO>& m );
+
+   inline bool isStored( size_t i, size_t j ) const;
+          void updateMirrorIndex();
+          void insertMirror( size_t i, size_t k );
+          void eraseMirror ( size_t i, size_t k );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   TriangleType matrix_;     //!< The stored upper or lower triangle of the symmetric matrix.
+   size_t       mcapacity_;  //!< The capacity of the mirror index.
+   size_t*      mbegin_;     //!< Offset of the first mirror index entry of each row.
+   IT*          mindex_;     //!< The row indices of the stored elements of each column.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE     ( IT   );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SymmetricCompressedMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline SymmetricCompressedMatrix<Type,UF,IT>::SymmetricCompressedMatrix()
+   : matrix_   ()                 // The stored upper or lower triangle of the symmetric matrix
+   , mcapacity_( 0UL )            // The capacity of the mirror index
+   , mbegin_   ( new size_t[1] )  // Offset of the first mirror index entry of each row
+   , mindex_   ( NULL )           // The row indices of the stored elements of each column
+{
+   mbegin_[0] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ N \times N \f$.
+//
+// \param n The number of rows and columns of the matrix.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline SymmetricCompressedMatrix<Type,UF,IT>::SymmetricCompressedMatrix( size_t n )
+   : matrix_   ( n, n )               // The stored upper or lower triangle of the symmetric matrix
+   , mcapacity_( 0UL )                // The capacity of the mirror index
+   , mbegin_   ( new size_t[n+1UL] )  // Offset of the first mirror index entry of each row
+   , mindex_   ( NULL )               // The row indices of the stored elements of each column
+{
+   std::fill( mbegin_, mbegin_+n+1UL, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ N \times N \f$ with capacity for the given number
+//        of stored non-zero elements.
+//
+// \param n The number of rows and columns of the matrix.
+// \param nonzeros The number of expected non-zero elements of the stored triangle.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix. Note that the capacity refers to the elements
+// of the stored triangle only, i.e. each off-diagonal element \f$ a_{ij} \f$ and its symmetric
+// counterpart \f$ a_{ji} \f$ require a single element of capacity.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline SymmetricCompressedMatrix<Type,UF,IT>::SymmetricCompressedMatrix( size_t n, size_t nonzeros )
+   : matrix_   ( n, n, nonzeros )     // The stored upper or lower triangle of the symmetric matrix
+   , mcapacity_( 0UL )                // The capacity of the mirror index
+   , mbegin_   ( new size_t[n+1UL] )  // Offset of the first mirror index entry of each row
+   , mindex_   ( NULL )               // The row indices of the stored elements of each column
+{
+   std::fill( mbegin_, mbegin_+n+1UL, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ N \times N \f$ with individual capacities for
+//        the stored rows.
+//
+// \param n The number of rows and columns of the matrix.
+// \param nonzeros The expected number of stored non-zero elements for each row.
+// \exception std::invalid_argument Matrix size exceeds the range of the index type.
+//
+// The matrix is initialized to the zero matrix. The given vector must have at least \a n
+// elements. Note that the capacities refer to the rows of the stored triangle only.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline SymmetricCompressedMatrix<Type,UF,IT>::SymmetricCompressedMatrix( size_t n, const std::vector<size_t>& nonzeros )
+   : matrix_   ( n, n, nonzeros )     // The stored upper or lower triangle of the symmetric matrix
+   , mcapacity_( 0UL )                // The capacity of the mirror index
+   , mbegin_   ( new size_t[n+1UL] )  // Offset of the first mirror index entry of each row
+   , mindex_   ( NULL )               // The row indices of the stored elements of each column
+{
+   std::fill( mbegin_, mbegin_+n+1UL, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for SymmetricCompressedMatrix.
+//
+// \param m Sparse matrix to be copied.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline SymmetricCompressedMatrix<Type,UF,IT>::SymmetricCompressedMatrix( const SymmetricCompressedMatrix& m )
+   : matrix_   ( m.matrix_ )                   // The stored upper or lower triangle of the symmetric matrix
+   , mcapacity_( m.mbegin_[m.rows()] )         // The capacity of the mirror index
+   , mbegin_   ( new size_t[m.rows()+1UL] )    // Offset of the first mirror index entry of each row
+   , mindex_   ( allocate<IT>( mcapacity_ ) )  // The row indices of the stored elements of each column
+{
+   std::copy( m.mbegin_, m.mbegin_+m.rows()+1UL, mbegin_ );
+   std::copy( m.mindex_, m.mindex_+mcapacity_, mindex_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense and sparse matrices.
+//
+// \param m Matrix to be converted.
+// \exception std::invalid_argument Invalid setup of symmetric matrix.
+//
+// This constructor creates a SymmetricCompressedMatrix from the given dense or sparse matrix.
+// In case the given matrix is not symmetric, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+template< typename MT    // Type of the foreign matrix
+        , bool SO >      // Storage order of the foreign matrix
+inline SymmetricCompressedMatrix<Type,UF,IT>::SymmetricCompressedMatrix( const Matrix<MT,SO>& m )
+   : matrix_   ()                 // The stored upper or lower triangle of the symmetric matrix
+   , mcapacity_( 0UL )            // The capacity of the mirror index
+   , mbegin_   ( new size_t[1] )  // Offset of the first mirror index entry of each row
+   , mindex_   ( NULL )           // The row indices of the stored elements of each column
+{
+   mbegin_[0] = 0UL;
+
+   if( !initialize( ~m ) ) {
+      delete [] mbegin_;
+      deallocate( mindex_ );
+      throw std::invalid_argument( "Invalid setup of symmetric matrix" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for SymmetricCompressedMatrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline SymmetricCompressedMatrix<Type,UF,IT>::~SymmetricCompressedMatrix()
+{
+   delete [] mbegin_;
+   deallocate( mindex_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function returns a reference to the stored element \f$ a_{ij} \f$ or \f$ a_{ji} \f$,
+// respectively. In case the element is not contained in the matrix, it is inserted as a
+// default element. Note that a modification of the element via the returned reference
+// implicitly modifies both \f$ a_{ij} \f$ and \f$ a_{ji} \f$.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline typename SymmetricCompressedMatrix<Type,UF,IT>::Reference
+   SymmetricCompressedMatrix<Type,UF,IT>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   if( !isStored( i, j ) )
+      std::swap( i, j );
+
+   typename TriangleType::Iterator pos( matrix_.find( i, j ) );
+
+   if( pos == matrix_.end( i ) ) {
+      pos = matrix_.insert( i, j, Type() );
+      if( i != j ) insertMirror( j, i );
+   }
+
+   return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline typename SymmetricCompressedMatrix<Type,UF,IT>::ConstReference
+   SymmetricCompressedMatrix<Type,UF,IT>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   if( isStored( i, j ) )
+      return matrix_(i,j);
+   else
+      return matrix_(j,i);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline typename SymmetricCompressedMatrix<Type,UF,IT>::Iterator
+   SymmetricCompressedMatrix<Type,UF,IT>::begin( size_t i )
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid sparse matrix row access index" );
+   return Iterator( &matrix_, i, mindex_+mbegin_[i], mindex_+mbegin_[i+1UL],
+                    matrix_.begin( i ), matrix_.end( i ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline typename SymmetricCompressedMatrix<Type,UF,IT>::ConstIterator
+   SymmetricCompressedMatrix<Type,UF,IT>::begin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid sparse matrix row access index" );
+   return ConstIterator( &matrix_, i, mindex_+mbegin_[i], mindex_+mbegin_[i+1UL],
+                         matrix_.begin( i ), matrix_.end( i ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline typename SymmetricCompressedMatrix<Type,UF,IT>::ConstIterator
+   SymmetricCompressedMatrix<Type,UF,IT>::cbegin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid sparse matrix row access index" );
+   return ConstIterator( &matrix_, i, mindex_+mbegin_[i], mindex_+mbegin_[i+1UL],
+                         matrix_.begin( i ), matrix_.end( i ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline typename SymmetricCompressedMatrix<Type,UF,IT>::Iterator
+   SymmetricCompressedMatrix<Type,UF,IT>::end( size_t i )
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid sparse matrix row access index" );
+   return Iterator( &matrix_, i, mindex_+mbegin_[i+1UL], mindex_+mbegin_[i+1UL],
+                    matrix_.end( i ), matrix_.end( i ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline typename SymmetricCompressedMatrix<Type,UF,IT>::ConstIterator
+   SymmetricCompressedMatrix<Type,UF,IT>::end( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid sparse matrix row access index" );
+   return ConstIterator( &matrix_, i, mindex_+mbegin_[i+1UL], mindex_+mbegin_[i+1UL],
+                         matrix_.end( i ), matrix_.end( i ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline typename SymmetricCompressedMatrix<Type,UF,IT>::ConstIterator
+   SymmetricCompressedMatrix<Type,UF,IT>::cend( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid sparse matrix row access index" );
+   return ConstIterator( &matrix_, i, mindex_+mbegin_[i+1UL], mindex_+mbegin_[i+1UL],
+                         matrix_.end( i ), matrix_.end( i ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SymmetricCompressedMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline SymmetricCompressedMatrix<Type,UF,IT>&
+   SymmetricCompressedMatrix<Type,UF,IT>::operator=( const SymmetricCompressedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   SymmetricCompressedMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense and sparse matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned sparse matrix.
+// \exception std::invalid_argument Invalid assignment to symmetric matrix.
+//
+// The matrix is resized according to the given \f$ N \times N \f$ matrix and initialized as a
+// copy of this matrix. In case the given matrix is not symmetric, a \a std::invalid_argument
+// exception is thrown and the matrix remains unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO >      // Storage order of the right-hand side matrix
+inline SymmetricCompressedMatrix<Type,UF,IT>&
+   SymmetricCompressedMatrix<Type,UF,IT>::operator=( const Matrix<MT,SO>& rhs )
+{
+   if( !initialize( ~rhs ) )
+      throw std::invalid_argument( "Invalid assignment to symmetric matrix" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to symmetric matrix.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown. Also, in case the result of the addition is not symmetric, a
+// \a std::invalid_argument exception is thrown and the matrix remains unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO >      // Storage order of the right-hand side matrix
+inline SymmetricCompressedMatrix<Type,UF,IT>&
+   SymmetricCompressedMatrix<Type,UF,IT>::operator+=( const Matrix<MT,SO>& rhs )
+{
+   if( (~rhs).rows() != rows() || (~rhs).columns() != columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( !initialize( *this + ~rhs ) )
+      throw std::invalid_argument( "Invalid assignment to symmetric matrix" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to symmetric matrix.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown. Also, in case the result of the subtraction is not symmetric, a
+// \a std::invalid_argument exception is thrown and the matrix remains unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO >      // Storage order of the right-hand side matrix
+inline SymmetricCompressedMatrix<Type,UF,IT>&
+   SymmetricCompressedMatrix<Type,UF,IT>::operator-=( const Matrix<MT,SO>& rhs )
+{
+   if( (~rhs).rows() != rows() || (~rhs).columns() != columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( !initialize( *this - ~rhs ) )
+      throw std::invalid_argument( "Invalid assignment to symmetric matrix" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to symmetric matrix.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown. Also, in case the result of the multiplication is not symmetric, a
+// \a std::invalid_argument exception is thrown and the matrix remains unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO >      // Storage order of the right-hand side matrix
+inline SymmetricCompressedMatrix<Type,UF,IT>&
+   SymmetricCompressedMatrix<Type,UF,IT>::operator*=( const Matrix<MT,SO>& rhs )
+{
+   if( (~rhs).rows() != columns() )
+      throw std::invalid_argument( "Matrix sizes do not match" );
+
+   if( !initialize( *this * ~rhs ) )
+      throw std::invalid_argument( "Invalid assignment to symmetric matrix" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a sparse matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool UF           // Upper triangle storage flag
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, SymmetricCompressedMatrix<Type,UF,IT> >::Type&
+   SymmetricCompressedMatrix<Type,UF,IT>::operator*=( Other rhs )
+{
+   matrix_ *= rhs;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a sparse matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool UF           // Upper triangle storage flag
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the right-hand side scalar
+inline typename EnableIf< IsNumeric<Other>, SymmetricCompressedMatrix<Type,UF,IT> >::Type&
+   SymmetricCompressedMatrix<Type,UF,IT>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   matrix_ /= rhs;
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline size_t SymmetricCompressedMatrix<Type,UF,IT>::rows() const
+{
+   return matrix_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline size_t SymmetricCompressedMatrix<Type,UF,IT>::columns() const
+{
+   return matrix_.columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+//
+// The capacity of the matrix is given by the capacity of the stored triangle plus the number
+// of mirrored elements of the opposite triangle.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline size_t SymmetricCompressedMatrix<Type,UF,IT>::capacity() const
+{
+   return matrix_.capacity() + mbegin_[rows()];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row.
+//
+// \param i The index of the row.
+// \return The current capacity of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline size_t SymmetricCompressedMatrix<Type,UF,IT>::capacity( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return matrix_.capacity( i ) + mbegin_[i+1UL] - mbegin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the sparse matrix.
+//
+// \return The number of non-zero elements in the sparse matrix.
+//
+// The returned number includes the elements of both triangles, i.e. every stored off-diagonal
+// element is counted twice.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline size_t SymmetricCompressedMatrix<Type,UF,IT>::nonZeros() const
+{
+   return matrix_.nonZeros() + mbegin_[rows()];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline size_t SymmetricCompressedMatrix<Type,UF,IT>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return matrix_.nonZeros( i ) + mbegin_[i+1UL] - mbegin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline void SymmetricCompressedMatrix<Type,UF,IT>::reset()
+{
+   matrix_.reset();
+   std::fill( mbegin_, mbegin_+rows()+1UL, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row \b and column to the default initial values.
+//
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// This function resets the values in the specified row \b and column to their default value,
+// i.e. all elements \f$ a_{ij} \f$ and \f$ a_{ji} \f$ of row/column \a i are removed from the
+// matrix. Note that the reset() function has no impact on the capacity of the matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline void SymmetricCompressedMatrix<Type,UF,IT>::reset( size_t i )
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   for( size_t k=mbegin_[i]; k<mbegin_[i+1UL]; ++k )
+      matrix_.erase( mindex_[k], i );
+
+   matrix_.reset( i );
+   updateMirrorIndex();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the symmetric matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the symmetric matrix is 0.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline void SymmetricCompressedMatrix<Type,UF,IT>::clear()
+{
+   matrix_.clear();
+   mbegin_[0] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting elements of the symmetric matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Iterator to the set element.
+//
+// This function sets the value of both the elements \f$ a_{ij} \f$ and \f$ a_{ji} \f$ of the
+// symmetric matrix and returns an iterator to the successfully set element \f$ a_{ij} \f$. In
+// case the element is not yet contained in the matrix, it is inserted into the matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline typename SymmetricCompressedMatrix<Type,UF,IT>::Iterator
+   SymmetricCompressedMatrix<Type,UF,IT>::set( size_t i, size_t j, const Type& value )
+{
+   const size_t r( isStored( i, j ) ? i : j );
+   const size_t c( isStored( i, j ) ? j : i );
+   const size_t nonzeros( matrix_.nonZeros( r ) );
+
+   matrix_.set( r, c, value );
+
+   if( r != c && matrix_.nonZeros( r ) != nonzeros )
+      insertMirror( c, r );
+
+   return find( i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting elements into the symmetric matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+// \exception std::invalid_argument Invalid sparse matrix access index.
+//
+// This function inserts both the elements \f$ a_{ij} \f$ and \f$ a_{ji} \f$ into the symmetric
+// matrix and returns an iterator to the successfully inserted element \f$ a_{ij} \f$. However,
+// duplicate elements are not allowed. In case the matrix already contains an element with row
+// index \a i and column index \a j, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline typename SymmetricCompressedMatrix<Type,UF,IT>::Iterator
+   SymmetricCompressedMatrix<Type,UF,IT>::insert( size_t i, size_t j, const Type& value )
+{
+   const size_t r( isStored( i, j ) ? i : j );
+   const size_t c( isStored( i, j ) ? j : i );
+
+   matrix_.insert( r, c, value );
+
+   if( r != c )
+      insertMirror( c, r );
+
+   return find( i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing elements from the symmetric matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+//
+// This function erases both elements \f$ a_{ij} \f$ and \f$ a_{ji} \f$ from the symmetric matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline void SymmetricCompressedMatrix<Type,UF,IT>::erase( size_t i, size_t j )
+{
+   const size_t r( isStored( i, j ) ? i : j );
+   const size_t c( isStored( i, j ) ? j : i );
+   const size_t nonzeros( matrix_.nonZeros( r ) );
+
+   matrix_.erase( r, c );
+
+   if( r != c && matrix_.nonZeros( r ) != nonzeros )
+      eraseMirror( c, r );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing elements from the symmetric matrix.
+//
+// \param i The row/column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \param pos Iterator to the element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases both the specified element and its according symmetric counterpart from
+// the symmetric matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline typename SymmetricCompressedMatrix<Type,UF,IT>::Iterator
+   SymmetricCompressedMatrix<Type,UF,IT>::erase( size_t i, Iterator pos )
+{
+   if( pos == end( i ) )
+      return pos;
+
+   const size_t j( pos->index() );
+
+   erase( i, j );
+
+   return upperBound( i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing a range of elements from the symmetric matrix.
+//
+// \param i The row/column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \param first Iterator to first element to be erased.
+// \param last Iterator just past the last element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases both the range of elements specified by the iterator pair \a first and
+// \a last and their according symmetric counterparts from the symmetric matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline typename SymmetricCompressedMatrix<Type,UF,IT>::Iterator
+   SymmetricCompressedMatrix<Type,UF,IT>::erase( size_t i, Iterator first, Iterator last )
+{
+   if( first == last )
+      return last;
+
+   std::vector<size_t> indices;
+   for( Iterator element=first; element!=last; ++element )
+      indices.push_back( element->index() );
+
+   for( size_t k=0UL; k<indices.size(); ++k ) {
+      if( isStored( i, indices[k] ) )
+         matrix_.erase( i, indices[k] );
+      else
+         matrix_.erase( indices[k], i );
+   }
+
+   updateMirrorIndex();
+
+   return upperBound( i, indices.back() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the symmetric matrix.
+//
+// \param n The new number of rows and columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ n \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
+// potentially changes all matrix elements. In order to preserve the old matrix values, the
+// \a preserve flag can be set to \a true.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline void SymmetricCompressedMatrix<Type,UF,IT>::resize( size_t n, bool preserve )
+{
+   UNUSED_PARAMETER( preserve );
+
+   if( n == rows() ) return;
+
+   matrix_.resize( n, n, true );
+
+   size_t* tmp( new size_t[n+1UL] );
+   std::swap( mbegin_, tmp );
+   delete [] tmp;
+
+   updateMirrorIndex();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the symmetric matrix.
+//
+// \param nonzeros The new minimum capacity of the stored triangle.
+// \return void
+//
+// This function increases the capacity of the stored triangle to at least \a nonzeros elements.
+// The current values of the matrix elements and the individual capacities of the matrix rows
+// are preserved.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline void SymmetricCompressedMatrix<Type,UF,IT>::reserve( size_t nonzeros )
+{
+   matrix_.reserve( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of a specific row of the symmetric matrix.
+//
+// \param i The row index of the new element \f$[0..N-1]\f$.
+// \param nonzeros The new minimum capacity of the specified row of the stored triangle.
+// \return void
+//
+// This function increases the capacity of row \a i of the stored triangle to at least
+// \a nonzeros elements. The current values of the matrix and all other individual row
+// capacities are preserved.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline void SymmetricCompressedMatrix<Type,UF,IT>::reserve( size_t i, size_t nonzeros )
+{
+   matrix_.reserve( i, nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity from all rows.
+//
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline void SymmetricCompressedMatrix<Type,UF,IT>::trim()
+{
+   matrix_.trim();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity of a specific row of the symmetric matrix.
+//
+// \param i The index of the row to be trimmed (\f$[0..N-1]\f$).
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline void SymmetricCompressedMatrix<Type,UF,IT>::trim( size_t i )
+{
+   matrix_.trim( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Transposing the symmetric matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline SymmetricCompressedMatrix<Type,UF,IT>& SymmetricCompressedMatrix<Type,UF,IT>::transpose()
+{
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the symmetric matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool UF           // Upper triangle storage flag
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the scalar value
+inline SymmetricCompressedMatrix<Type,UF,IT>&
+   SymmetricCompressedMatrix<Type,UF,IT>::scale( const Other& scalar )
+{
+   matrix_.scale( scalar );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling the diagonal of the symmetric matrix by the scalar value \a scalar.
+//
+// \param scalar The scalar value for the diagonal scaling.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool UF           // Upper triangle storage flag
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the scalar value
+inline SymmetricCompressedMatrix<Type,UF,IT>&
+   SymmetricCompressedMatrix<Type,UF,IT>::scaleDiagonal( Other scalar )
+{
+   matrix_.scaleDiagonal( scalar );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two symmetric matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline void SymmetricCompressedMatrix<Type,UF,IT>::swap( SymmetricCompressedMatrix& m ) /* throw() */
+{
+   matrix_.swap( m.matrix_ );
+   std::swap( mcapacity_, m.mcapacity_ );
+   std::swap( mbegin_, m.mbegin_ );
+   std::swap( mindex_, m.mindex_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the element \f$ a_{ij} \f$ belongs to the stored triangle.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return \a true in case the element is part of the stored triangle, \a false if not.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline bool SymmetricCompressedMatrix<Type,UF,IT>::isStored( size_t i, size_t j ) const
+{
+   return ( UF )?( i <= j ):( j <= i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Rebuilding the mirror index from the stored triangle.
+//
+// \return void
+//
+// This function sets up the mirror index, which lists the row indices of all stored
+// off-diagonal elements of each column in ascending order, from scratch. Its complexity is
+// linear in the number of rows and stored non-zero elements.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+void SymmetricCompressedMatrix<Type,UF,IT>::updateMirrorIndex()
+{
+   typedef typename TriangleType::ConstIterator  TriangleIterator;
+
+   const TriangleType& tm( matrix_ );
+   const size_t n( tm.rows() );
+
+   std::fill( mbegin_, mbegin_+n+1UL, 0UL );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      for( TriangleIterator element=tm.begin(k); element!=tm.end(k); ++element ) {
+         if( element->index() != k )
+            ++mbegin_[element->index()+1UL];
+      }
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      mbegin_[i+1UL] += mbegin_[i];
+   }
+
+   if( mbegin_[n] > mcapacity_ ) {
+      IT* tmp( allocate<IT>( mbegin_[n] ) );
+      std::swap( mindex_, tmp );
+      deallocate( tmp );
+      mcapacity_ = mbegin_[n];
+   }
+
+   for( size_t k=0UL; k<n; ++k ) {
+      for( TriangleIterator element=tm.begin(k); element!=tm.end(k); ++element ) {
+         if( element->index() != k )
+            mindex_[mbegin_[element->index()]++] = static_cast<IT>( k );
+      }
+   }
+
+   for( size_t i=n; i>0UL; --i ) {
+      mbegin_[i] = mbegin_[i-1UL];
+   }
+   mbegin_[0] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Adding an entry to the mirror index.
+//
+// \param i The row of the mirrored element.
+// \param k The row of the stored element \f$ a_{ki} \f$.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+void SymmetricCompressedMatrix<Type,UF,IT>::insertMirror( size_t i, size_t k )
+{
+   const size_t n( rows() );
+
+   if( mbegin_[n] == mcapacity_ ) {
+      const size_t newCapacity( max( 2UL*mcapacity_, 7UL ) );
+      IT* tmp( allocate<IT>( newCapacity ) );
+      std::copy( mindex_, mindex_+mbegin_[n], tmp );
+      std::swap( mindex_, tmp );
+      deallocate( tmp );
+      mcapacity_ = newCapacity;
+   }
+
+   IT* const pos( std::lower_bound( mindex_+mbegin_[i], mindex_+mbegin_[i+1UL], static_cast<IT>( k ) ) );
+   std::copy_backward( pos, mindex_+mbegin_[n], mindex_+mbegin_[n]+1UL );
+   *pos = static_cast<IT>( k );
+
+   for( size_t l=i+1UL; l<=n; ++l ) {
+      ++mbegin_[l];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing an entry from the mirror index.
+//
+// \param i The row of the mirrored element.
+// \param k The row of the stored element \f$ a_{ki} \f$.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+void SymmetricCompressedMatrix<Type,UF,IT>::eraseMirror( size_t i, size_t k )
+{
+   const size_t n( rows() );
+
+   IT* const pos( std::lower_bound( mindex_+mbegin_[i], mindex_+mbegin_[i+1UL], static_cast<IT>( k ) ) );
+
+   BLAZE_INTERNAL_ASSERT( pos != mindex_+mbegin_[i+1UL] && static_cast<size_t>( *pos ) == k,
+                          "Missing mirror index entry detected" );
+
+   std::copy( pos+1UL, mindex_+mbegin_[n], pos );
+
+   for( size_t l=i+1UL; l<=n; ++l ) {
+      --mbegin_[l];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting up the symmetric matrix from the given dense or sparse matrix.
+//
+// \param m The matrix to be converted.
+// \return \a true in case the given matrix is symmetric, \a false if not.
+//
+// This function copies the stored triangle of the given matrix. In case the given matrix is
+// not symmetric, the function returns \a false and the symmetric matrix remains unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+template< typename MT    // Type of the foreign matrix
+        , bool SO >      // Storage order of the foreign matrix
+bool SymmetricCompressedMatrix<Type,UF,IT>::initialize( const Matrix<MT,SO>& m )
+{
+   typedef typename TriangleType::ConstIterator  TriangleIterator;
+
+   const TriangleType tmp( ~m );
+
+   if( !IsSymmetric<MT>::value && !isSymmetric( tmp ) )
+      return false;
+
+   const size_t n( tmp.rows() );
+
+   size_t nonzeros( 0UL );
+   for( size_t i=0UL; i<n; ++i ) {
+      nonzeros += ( UF )?( tmp.end(i) - tmp.lowerBound(i,i) ):( tmp.upperBound(i,i) - tmp.begin(i) );
+   }
+
+   TriangleType triangle( n, n, nonzeros );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const TriangleIterator first( ( UF )?( tmp.lowerBound(i,i) ):( tmp.begin(i) ) );
+      const TriangleIterator last ( ( UF )?( tmp.end(i) ):( tmp.upperBound(i,i) ) );
+      for( TriangleIterator element=first; element!=last; ++element ) {
+         triangle.append( i, element->index(), element->value() );
+      }
+      triangle.finalize( i );
+   }
+
+   size_t* mbegin( new size_t[n+1UL] );
+   std::swap( mbegin_, mbegin );
+   delete [] mbegin;
+
+   matrix_.swap( triangle );
+   updateMirrorIndex();
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the symmetric
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row iterator to the element. Otherwise
+// an iterator just past the last non-zero element of row \a i (the end() iterator) is returned.
+// Note that the returned symmetric matrix iterator is subject to invalidation due to inserting
+// operations via the function call operator or the insert() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline typename SymmetricCompressedMatrix<Type,UF,IT>::Iterator
+   SymmetricCompressedMatrix<Type,UF,IT>::find( size_t i, size_t j )
+{
+   const Iterator pos( lowerBound( i, j ) );
+
+   if( pos != end( i ) && pos->index() == j )
+      return pos;
+   else
+      return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the symmetric
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row iterator to the element. Otherwise
+// an iterator just past the last non-zero element of row \a i (the end() iterator) is returned.
+// Note that the returned symmetric matrix iterator is subject to invalidation due to inserting
+// operations via the function call operator or the insert() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline typename SymmetricCompressedMatrix<Type,UF,IT>::ConstIterator
+   SymmetricCompressedMatrix<Type,UF,IT>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+
+   if( pos != end( i ) && pos->index() == j )
+      return pos;
+   else
+      return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// This function returns a row iterator to the first element with an index not less then the
+// given column index. In combination with the upperBound() function this function can be used
+// to create a pair of iterators specifying a range of indices. Note that the returned symmetric
+// matrix iterator is subject to invalidation due to inserting operations via the function call
+// operator or the insert() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline typename SymmetricCompressedMatrix<Type,UF,IT>::Iterator
+   SymmetricCompressedMatrix<Type,UF,IT>::lowerBound( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid sparse matrix row access index" );
+
+   const IT* const mbegin( mindex_+mbegin_[i] );
+   const IT* const mend  ( mindex_+mbegin_[i+1UL] );
+
+   if( isStored( i, j ) )
+      return Iterator( &matrix_, i, ( UF )?( mend ):( mbegin ), mend,
+                       matrix_.lowerBound( i, j ), matrix_.end( i ) );
+   else
+      return Iterator( &matrix_, i, std::lower_bound( mbegin, mend, static_cast<IT>( j ) ), mend,
+                       ( UF )?( matrix_.begin( i ) ):( matrix_.end( i ) ), matrix_.end( i ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// This function returns a row iterator to the first element with an index not less then the
+// given column index. In combination with the upperBound() function this function can be used
+// to create a pair of iterators specifying a range of indices. Note that the returned symmetric
+// matrix iterator is subject to invalidation due to inserting operations via the function call
+// operator or the insert() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline typename SymmetricCompressedMatrix<Type,UF,IT>::ConstIterator
+   SymmetricCompressedMatrix<Type,UF,IT>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid sparse matrix row access index" );
+
+   const IT* const mbegin( mindex_+mbegin_[i] );
+   const IT* const mend  ( mindex_+mbegin_[i+1UL] );
+
+   if( isStored( i, j ) )
+      return ConstIterator( &matrix_, i, ( UF )?( mend ):( mbegin ), mend,
+                            matrix_.lowerBound( i, j ), matrix_.end( i ) );
+   else
+      return ConstIterator( &matrix_, i, std::lower_bound( mbegin, mend, static_cast<IT>( j ) ), mend,
+                            ( UF )?( matrix_.begin( i ) ):( matrix_.end( i ) ), matrix_.end( i ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// This function returns a row iterator to the first element with an index greater then the
+// given column index. In combination with the lowerBound() function this function can be used
+// to create a pair of iterators specifying a range of indices. Note that the returned symmetric
+// matrix iterator is subject to invalidation due to inserting operations via the function call
+// operator or the insert() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline typename SymmetricCompressedMatrix<Type,UF,IT>::Iterator
+   SymmetricCompressedMatrix<Type,UF,IT>::upperBound( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid sparse matrix row access index" );
+
+   const IT* const mbegin( mindex_+mbegin_[i] );
+   const IT* const mend  ( mindex_+mbegin_[i+1UL] );
+
+   if( isStored( i, j ) )
+      return Iterator( &matrix_, i, ( UF )?( mend ):( mbegin ), mend,
+                       matrix_.upperBound( i, j ), matrix_.end( i ) );
+   else
+      return Iterator( &matrix_, i, std::upper_bound( mbegin, mend, static_cast<IT>( j ) ), mend,
+                       ( UF )?( matrix_.begin( i ) ):( matrix_.end( i ) ), matrix_.end( i ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// This function returns a row iterator to the first element with an index greater then the
+// given column index. In combination with the lowerBound() function this function can be used
+// to create a pair of iterators specifying a range of indices. Note that the returned symmetric
+// matrix iterator is subject to invalidation due to inserting operations via the function call
+// operator or the insert() function!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline typename SymmetricCompressedMatrix<Type,UF,IT>::ConstIterator
+   SymmetricCompressedMatrix<Type,UF,IT>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid sparse matrix row access index" );
+
+   const IT* const mbegin( mindex_+mbegin_[i] );
+   const IT* const mend  ( mindex_+mbegin_[i+1UL] );
+
+   if( isStored( i, j ) )
+      return ConstIterator( &matrix_, i, ( UF )?( mend ):( mbegin ), mend,
+                            matrix_.upperBound( i, j ), matrix_.end( i ) );
+   else
+      return ConstIterator( &matrix_, i, std::upper_bound( mbegin, mend, static_cast<IT>( j ) ), mend,
+                            ( UF )?( matrix_.begin( i ) ):( matrix_.end( i ) ), matrix_.end( i ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOW-LEVEL UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Appending an element to the specified row of the symmetric matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be appended.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+//
+// This function provides a very efficient way to fill a symmetric sparse matrix with elements.
+// It appends a new element to the end of the specified row, which implicitly also sets the
+// symmetric counterpart of the element. The function follows the same rules as the append()
+// function of a SymmetricMatrix< CompressedMatrix<Type> >: the elements of each row have to
+// be appended in ascending order and the capacity of the rows has to be reserved in advance.
+// Elements of the stored triangle are appended to the stored row, elements of the opposite
+// triangle are inserted into the according row of the stored triangle. In case only elements
+// of the stored triangle are appended, a single reservation for the whole matrix suffices:
+
+   \code
+   using blaze::SymmetricCompressedMatrix;
+
+   // Setup of the upper triangle of the symmetric matrix
+   //
+   //       ( 0 1 3 )
+   //   A = ( 1 2 0 )
+   //       ( 3 0 0 )
+   //
+   SymmetricCompressedMatrix<double> A( 3UL, 4UL );
+   A.append( 0UL, 1UL, 1.0 );  // Appending the elements (0,1) and (1,0)
+   A.append( 0UL, 2UL, 3.0 );  // Appending the elements (0,2) and (2,0)
+   A.finalize( 0UL );          // Finalizing row 0
+   A.append( 1UL, 1UL, 2.0 );  // Appending the element (1,1)
+   A.finalize( 1UL );          // Finalizing row 1
+   A.finalize( 2UL );          // Finalizing row 2
+   \endcode
+
+// Note that the mirror index of the matrix is only updated by the finalization of the last row
+// of the matrix. Therefore all rows of the matrix have to be finalized before the matrix can
+// be used.
+//
+// \note Although append() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline void SymmetricCompressedMatrix<Type,UF,IT>::append( size_t i, size_t j, const Type& value, bool check )
+{
+   if( isStored( i, j ) )
+      matrix_.append( i, j, value, check );
+   else if( !check || !isDefault( value ) )
+      matrix_.insert( j, i, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the element insertion of a row.
+//
+// \param i The index of the row to be finalized \f$[0..N-1]\f$.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill the matrix with elements.
+// After completion of row \a i via the append() function, this function can be called to
+// finalize row \a i and prepare the next row for insertion process via append(). The
+// finalization of the last row completes the setup of the matrix.
+//
+// \note Although finalize() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline void SymmetricCompressedMatrix<Type,UF,IT>::finalize( size_t i )
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   matrix_.trim( i );
+
+   if( i+1UL == rows() )
+      updateMirrorIndex();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the stored triangle of the symmetric matrix.
+//
+// \return Reference to the stored upper or lower triangle.
+//
+// The returned row-major compressed matrix contains all elements \f$ a_{ij} \f$ with
+// \f$ i \le j \f$ (upper storage) or \f$ j \le i \f$ (lower storage), respectively.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline const typename SymmetricCompressedMatrix<Type,UF,IT>::TriangleType&
+   SymmetricCompressedMatrix<Type,UF,IT>::triangle() const
+{
+   return matrix_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first mirror index entry of the specified row.
+//
+// \param i The row index \f$[0..N-1]\f$.
+// \return Pointer to the first mirror index entry of row \a i.
+//
+// The mirror index of row \a i lists the row indices \a k of all stored off-diagonal elements
+// \f$ a_{ki} \f$ in ascending order, i.e. the elements of row \a i that belong to the opposite
+// triangle.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline const IT* SymmetricCompressedMatrix<Type,UF,IT>::mirrorBegin( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return mindex_+mbegin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer just past the last mirror index entry of the specified row.
+//
+// \param i The row index \f$[0..N-1]\f$.
+// \return Pointer just past the last mirror index entry of row \a i.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline const IT* SymmetricCompressedMatrix<Type,UF,IT>::mirrorEnd( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return mindex_+mbegin_[i+1UL];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool UF           // Upper triangle storage flag
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool SymmetricCompressedMatrix<Type,UF,IT>::canAlias( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the sparse matrix
+        , bool UF           // Upper triangle storage flag
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool SymmetricCompressedMatrix<Type,UF,IT>::isAliased( const Other* alias ) const
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline bool SymmetricCompressedMatrix<Type,UF,IT>::canSMPAssign() const
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SYMMETRICCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SymmetricCompressedMatrix operators */
+//@{
+template< typename Type, bool UF, typename IT >
+inline void reset( SymmetricCompressedMatrix<Type,UF,IT>& m );
+
+template< typename Type, bool UF, typename IT >
+inline void reset( SymmetricCompressedMatrix<Type,UF,IT>& m, size_t i );
+
+template< typename Type, bool UF, typename IT >
+inline void clear( SymmetricCompressedMatrix<Type,UF,IT>& m );
+
+template< typename Type, bool UF, typename IT >
+inline bool isDefault( const SymmetricCompressedMatrix<Type,UF,IT>& m );
+
+template< typename Type, bool UF, typename IT >
+inline void swap( SymmetricCompressedMatrix<Type,UF,IT>& a, SymmetricCompressedMatrix<Type,UF,IT>& b ) /* throw() */;
+
+template< typename Type, bool UF, typename IT >
+inline void move( SymmetricCompressedMatrix<Type,UF,IT>& dst, SymmetricCompressedMatrix<Type,UF,IT>& src ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given symmetric compressed matrix.
+// \ingroup symmetric_compressed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline void reset( SymmetricCompressedMatrix<Type,UF,IT>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row of the given symmetric compressed matrix.
+// \ingroup symmetric_compressed_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row to be resetted.
+// \return void
+//
+// This function resets the values in the specified row of the given symmetric compressed matrix
+// to their default value. Note that the non-zero blocks of the matrix remain unchanged.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline void reset( SymmetricCompressedMatrix<Type,UF,IT>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given symmetric compressed matrix.
+// \ingroup symmetric_compressed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline void clear( SymmetricCompressedMatrix<Type,UF,IT>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given symmetric compressed matrix is in default state.
+// \ingroup symmetric_compressed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the symmetric compressed matrix is in default (constructed) state,
+// i.e. if it's number of rows and columns is 0. In case it is in default state, the function
+// returns \a true, else it will return \a false.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline bool isDefault( const SymmetricCompressedMatrix<Type,UF,IT>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two symmetric compressed matrices.
+// \ingroup symmetric_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline void swap( SymmetricCompressedMatrix<Type,UF,IT>& a, SymmetricCompressedMatrix<Type,UF,IT>& b ) /* throw() */
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moving the contents of one symmetric compressed matrix to another.
+// \ingroup symmetric_compressed_matrix
+//
+// \param dst The destination matrix.
+// \param src The source matrix.
+// \return void
+// \exception no-throw guarantee.
+*/
+template< typename Type  // Data type of the sparse matrix
+        , bool UF        // Upper triangle storage flag
+        , typename IT >  // Index type
+inline void move( SymmetricCompressedMatrix<Type,UF,IT>& dst, SymmetricCompressedMatrix<Type,UF,IT>& src ) /* throw() */
+{
+   dst.swap( src );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSQUARE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool UF, typename IT >
+struct IsSquare< SymmetricCompressedMatrix<T,UF,IT> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSYMMETRIC SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool UF, typename IT >
+struct IsSymmetric< SymmetricCompressedMatrix<T,UF,IT> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool UF, typename IT >
+struct IsResizable< SymmetricCompressedMatrix<T,UF,IT> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HASHALFSTORAGE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool UF, typename IT >
+struct HasHalfStorage< SymmetricCompressedMatrix<T,UF,IT> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+
+template< typename T, bool UF, typename IT, bool AF >
+struct HasHalfStorage< SparseSubmatrix<SymmetricCompressedMatrix<T,UF,IT>,AF,false> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+
+template< typename T, bool UF, typename IT, bool AF >
+struct HasHalfStorage< SparseSubmatrix<const SymmetricCompressedMatrix<T,UF,IT>,AF,false> > : public TrueType
+{
+   enum { value = 1 };
+   typedef TrueType  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool UF, typename IT, typename T2, bool SO >
+struct AddTrait< SymmetricCompressedMatrix<T1,UF,IT>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool SO, typename T2, bool UF, typename IT >
+struct AddTrait< DynamicMatrix<T1,SO>, SymmetricCompressedMatrix<T2,UF,IT> >
+{
+   typedef DynamicMatrix< typename AddTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool UF, typename IT1, typename T2, bool SO, typename IT2 >
+struct AddTrait< SymmetricCompressedMatrix<T1,UF,IT1>, CompressedMatrix<T2,SO,IT2> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename IT1, typename T2, bool UF, typename IT2 >
+struct AddTrait< CompressedMatrix<T1,SO,IT1>, SymmetricCompressedMatrix<T2,UF,IT2> >
+{
+   typedef CompressedMatrix< typename AddTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool UF1, typename IT1, typename T2, bool UF2, typename IT2 >
+struct AddTrait< SymmetricCompressedMatrix<T1,UF1,IT1>, SymmetricCompressedMatrix<T2,UF2,IT2> >
+{
+   typedef SymmetricCompressedMatrix< typename AddTrait<T1,T2>::Type, UF1 >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool UF, typename IT, typename T2, bool SO >
+struct SubTrait< SymmetricCompressedMatrix<T1,UF,IT>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool SO, typename T2, bool UF, typename IT >
+struct SubTrait< DynamicMatrix<T1,SO>, SymmetricCompressedMatrix<T2,UF,IT> >
+{
+   typedef DynamicMatrix< typename SubTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool UF, typename IT1, typename T2, bool SO, typename IT2 >
+struct SubTrait< SymmetricCompressedMatrix<T1,UF,IT1>, CompressedMatrix<T2,SO,IT2> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename IT1, typename T2, bool UF, typename IT2 >
+struct SubTrait< CompressedMatrix<T1,SO,IT1>, SymmetricCompressedMatrix<T2,UF,IT2> >
+{
+   typedef CompressedMatrix< typename SubTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool UF1, typename IT1, typename T2, bool UF2, typename IT2 >
+struct SubTrait< SymmetricCompressedMatrix<T1,UF1,IT1>, SymmetricCompressedMatrix<T2,UF2,IT2> >
+{
+   typedef SymmetricCompressedMatrix< typename SubTrait<T1,T2>::Type, UF1 >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool UF, typename IT, typename T2 >
+struct MultTrait< SymmetricCompressedMatrix<T1,UF,IT>, T2 >
+{
+   typedef SymmetricCompressedMatrix< typename MultTrait<T1,T2>::Type, UF, IT >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+
+template< typename T1, typename T2, bool UF, typename IT >
+struct MultTrait< T1, SymmetricCompressedMatrix<T2,UF,IT> >
+{
+   typedef SymmetricCompressedMatrix< typename MultTrait<T1,T2>::Type, UF, IT >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T1 );
+};
+
+template< typename T1, bool UF, typename IT, typename T2, size_t N >
+struct MultTrait< SymmetricCompressedMatrix<T1,UF,IT>, StaticVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, bool UF, typename IT >
+struct MultTrait< StaticVector<T1,N,true>, SymmetricCompressedMatrix<T2,UF,IT> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool UF, typename IT, typename T2, size_t N >
+struct MultTrait< SymmetricCompressedMatrix<T1,UF,IT>, HybridVector<T2,N,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, size_t N, typename T2, bool UF, typename IT >
+struct MultTrait< HybridVector<T1,N,true>, SymmetricCompressedMatrix<T2,UF,IT> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool UF, typename IT, typename T2 >
+struct MultTrait< SymmetricCompressedMatrix<T1,UF,IT>, DynamicVector<T2,false> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename T2, bool UF, typename IT >
+struct MultTrait< DynamicVector<T1,true>, SymmetricCompressedMatrix<T2,UF,IT> >
+{
+   typedef DynamicVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool UF, typename IT1, typename T2, typename IT2 >
+struct MultTrait< SymmetricCompressedMatrix<T1,UF,IT1>, CompressedVector<T2,false,IT2> >
+{
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, typename IT1, typename T2, bool UF, typename IT2 >
+struct MultTrait< CompressedVector<T1,true,IT1>, SymmetricCompressedMatrix<T2,UF,IT2> >
+{
+   typedef CompressedVector< typename MultTrait<T1,T2>::Type, true >  Type;
+};
+
+template< typename T1, bool UF, typename IT, typename T2, bool SO >
+struct MultTrait< SymmetricCompressedMatrix<T1,UF,IT>, DynamicMatrix<T2,SO> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename T2, bool UF, typename IT >
+struct MultTrait< DynamicMatrix<T1,SO>, SymmetricCompressedMatrix<T2,UF,IT> >
+{
+   typedef DynamicMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool UF, typename IT1, typename T2, bool SO, typename IT2 >
+struct MultTrait< SymmetricCompressedMatrix<T1,UF,IT1>, CompressedMatrix<T2,SO,IT2> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+
+template< typename T1, bool SO, typename IT1, typename T2, bool UF, typename IT2 >
+struct MultTrait< CompressedMatrix<T1,SO,IT1>, SymmetricCompressedMatrix<T2,UF,IT2> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, SO >  Type;
+};
+
+template< typename T1, bool UF1, typename IT1, typename T2, bool UF2, typename IT2 >
+struct MultTrait< SymmetricCompressedMatrix<T1,UF1,IT1>, SymmetricCompressedMatrix<T2,UF2,IT2> >
+{
+   typedef CompressedMatrix< typename MultTrait<T1,T2>::Type, false >  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool UF, typename IT, typename T2 >
+struct DivTrait< SymmetricCompressedMatrix<T1,UF,IT>, T2 >
+{
+   typedef SymmetricCompressedMatrix< typename DivTrait<T1,T2>::Type, UF, IT >  Type;
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T2 );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATHTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool UF1, typename IT1, typename T2, bool UF2, typename IT2 >
+struct MathTrait< SymmetricCompressedMatrix<T1,UF1,IT1>, SymmetricCompressedMatrix<T2,UF2,IT2> >
+{
+   typedef SymmetricCompressedMatrix< typename MathTrait<T1,T2>::HighType, UF1 >  HighType;
+   typedef SymmetricCompressedMatrix< typename MathTrait<T1,T2>::LowType , UF1 >  LowType;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool UF, typename IT >
+struct SubmatrixTrait< SymmetricCompressedMatrix<T1,UF,IT> >
+{
+   typedef CompressedMatrix<T1,false,IT>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool UF, typename IT >
+struct RowTrait< SymmetricCompressedMatrix<T1,UF,IT> >
+{
+   typedef CompressedVector<T1,true,IT>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool UF, typename IT >
+struct ColumnTrait< SymmetricCompressedMatrix<T1,UF,IT> >
+{
+   typedef CompressedVector<T1,false,IT>  Type;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -958,6 +958,9 @@ class DenseSubmatrix : public DenseMatrix< DenseSubmatrix<MT,AF,SO>, SO >
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
+                              inline Operand         operand() const;
+                              inline size_t          row() const;
+                              inline size_t          column() const;
                               inline size_t          rows() const;
                               inline size_t          columns() const;
                               inline size_t          spacing() const;
@@ -1965,6 +1968,51 @@ inline typename EnableIf< IsNumeric<Other>, DenseSubmatrix<MT,AF,SO> >::Type&
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Returns the matrix containing the dense submatrix.
+//
+// \return The matrix containing the dense submatrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool AF      // Alignment flag
+        , bool SO >    // Storage order
+inline typename DenseSubmatrix<MT,AF,SO>::Operand DenseSubmatrix<MT,AF,SO>::operand() const
+{
+   return matrix_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the first row of the dense submatrix in the underlying matrix.
+//
+// \return The index of the first row.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool AF      // Alignment flag
+        , bool SO >    // Storage order
+inline size_t DenseSubmatrix<MT,AF,SO>::row() const
+{
+   return row_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the first column of the dense submatrix in the underlying matrix.
+//
+// \return The index of the first column.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool AF      // Alignment flag
+        , bool SO >    // Storage order
+inline size_t DenseSubmatrix<MT,AF,SO>::column() const
+{
+   return column_;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Returns the number of rows of the dense submatrix.
 //
@@ -4349,6 +4397,9 @@ class DenseSubmatrix<MT,unaligned,true> : public DenseMatrix< DenseSubmatrix<MT,
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
+                              inline Operand         operand() const;
+                              inline size_t          row() const;
+                              inline size_t          column() const;
                               inline size_t          rows() const;
                               inline size_t          columns() const;
                               inline size_t          spacing() const;
@@ -5324,6 +5375,51 @@ inline typename EnableIf< IsNumeric<Other>, DenseSubmatrix<MT,unaligned,true> >:
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the matrix containing the dense submatrix.
+//
+// \return The matrix containing the dense submatrix.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename DenseSubmatrix<MT,unaligned,true>::Operand DenseSubmatrix<MT,unaligned,true>::operand() const
+{
+   return matrix_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the index of the first row of the dense submatrix in the underlying matrix.
+//
+// \return The index of the first row.
+*/
+template< typename MT >  // Type of the dense matrix
+inline size_t DenseSubmatrix<MT,unaligned,true>::row() const
+{
+   return row_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the index of the first column of the dense submatrix in the underlying matrix.
+//
+// \return The index of the first column.
+*/
+template< typename MT >  // Type of the dense matrix
+inline size_t DenseSubmatrix<MT,unaligned,true>::column() const
+{
+   return column_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Returns the number of rows of the dense submatrix.
@@ -7334,6 +7430,9 @@ class DenseSubmatrix<MT,aligned,false> : public DenseMatrix< DenseSubmatrix<MT,a
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
+                              inline Operand         operand() const;
+                              inline size_t          row() const;
+                              inline size_t          column() const;
                               inline size_t          rows() const;
                               inline size_t          columns() const;
                               inline size_t          spacing() const;
@@ -8316,6 +8415,51 @@ inline typename EnableIf< IsNumeric<Other>, DenseSubmatrix<MT,aligned,false> >::
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the matrix containing the dense submatrix.
+//
+// \return The matrix containing the dense submatrix.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename DenseSubmatrix<MT,aligned,false>::Operand DenseSubmatrix<MT,aligned,false>::operand() const
+{
+   return matrix_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the index of the first row of the dense submatrix in the underlying matrix.
+//
+// \return The index of the first row.
+*/
+template< typename MT >  // Type of the dense matrix
+inline size_t DenseSubmatrix<MT,aligned,false>::row() const
+{
+   return row_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the index of the first column of the dense submatrix in the underlying matrix.
+//
+// \return The index of the first column.
+*/
+template< typename MT >  // Type of the dense matrix
+inline size_t DenseSubmatrix<MT,aligned,false>::column() const
+{
+   return column_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Returns the number of rows of the dense submatrix.
@@ -10336,6 +10480,9 @@ class DenseSubmatrix<MT,aligned,true> : public DenseMatrix< DenseSubmatrix<MT,al
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
+                              inline Operand         operand() const;
+                              inline size_t          row() const;
+                              inline size_t          column() const;
                               inline size_t          rows() const;
                               inline size_t          columns() const;
                               inline size_t          spacing() const;
@@ -11287,6 +11434,51 @@ inline typename EnableIf< IsNumeric<Other>, DenseSubmatrix<MT,aligned,true> >::T
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the matrix containing the dense submatrix.
+//
+// \return The matrix containing the dense submatrix.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename DenseSubmatrix<MT,aligned,true>::Operand DenseSubmatrix<MT,aligned,true>::operand() const
+{
+   return matrix_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the index of the first row of the dense submatrix in the underlying matrix.
+//
+// \return The index of the first row.
+*/
+template< typename MT >  // Type of the dense matrix
+inline size_t DenseSubmatrix<MT,aligned,true>::row() const
+{
+   return row_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the index of the first column of the dense submatrix in the underlying matrix.
+//
+// \return The index of the first column.
+*/
+template< typename MT >  // Type of the dense matrix
+inline size_t DenseSubmatrix<MT,aligned,true>::column() const
+{
+   return column_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Returns the number of rows of the dense submatrix.
@@ -877,6 +877,9 @@ class SparseSubmatrix : public SparseMatrix< SparseSubmatrix<MT,AF,SO>, SO >
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
+                              inline Operand          operand() const;
+                              inline size_t           row() const;
+                              inline size_t           column() const;
                               inline size_t           rows() const;
                               inline size_t           columns() const;
                               inline size_t           capacity() const;
@@ -1682,6 +1685,51 @@ inline typename EnableIf< IsNumeric<Other>, SparseSubmatrix<MT,AF,SO> >::Type&
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*!\brief Returns the matrix containing the sparse submatrix.
+//
+// \return The matrix containing the sparse submatrix.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool AF      // Alignment flag
+        , bool SO >    // Storage order
+inline typename SparseSubmatrix<MT,AF,SO>::Operand SparseSubmatrix<MT,AF,SO>::operand() const
+{
+   return matrix_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the first row of the sparse submatrix in the underlying matrix.
+//
+// \return The index of the first row.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool AF      // Alignment flag
+        , bool SO >    // Storage order
+inline size_t SparseSubmatrix<MT,AF,SO>::row() const
+{
+   return row_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the first column of the sparse submatrix in the underlying matrix.
+//
+// \return The index of the first column.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool AF      // Alignment flag
+        , bool SO >    // Storage order
+inline size_t SparseSubmatrix<MT,AF,SO>::column() const
+{
+   return column_;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Returns the number of rows of the sparse submatrix.
 //
@@ -3882,6 +3930,9 @@ class SparseSubmatrix<MT,AF,true> : public SparseMatrix< SparseSubmatrix<MT,AF,t
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
+                              inline Operand          operand() const;
+                              inline size_t           row() const;
+                              inline size_t           column() const;
                               inline size_t           rows() const;
                               inline size_t           columns() const;
                               inline size_t           capacity() const;
@@ -4670,6 +4721,54 @@ inline typename EnableIf< IsNumeric<Other>, SparseSubmatrix<MT,AF,true> >::Type&
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the matrix containing the sparse submatrix.
+//
+// \return The matrix containing the sparse submatrix.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool AF >    // Alignment flag
+inline typename SparseSubmatrix<MT,AF,true>::Operand SparseSubmatrix<MT,AF,true>::operand() const
+{
+   return matrix_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the index of the first row of the sparse submatrix in the underlying matrix.
+//
+// \return The index of the first row.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool AF >    // Alignment flag
+inline size_t SparseSubmatrix<MT,AF,true>::row() const
+{
+   return row_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the index of the first column of the sparse submatrix in the underlying matrix.
+//
+// \return The index of the first column.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool AF >    // Alignment flag
+inline size_t SparseSubmatrix<MT,AF,true>::column() const
+{
+   return column_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Returns the number of rows of the sparse submatrix.
@@ -0,0 +1,579 @@
+//=================================================================================================
+/*!
+//  \file blaze/system/RuntimeThresholds.h
+//  \brief Header file for the runtime configuration of the Blaze thresholds
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_SYSTEM_RUNTIMETHRESHOLDS_H_
+#define _BLAZE_SYSTEM_RUNTIMETHRESHOLDS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <fstream>
+#include <istream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <blaze/util/NonCreatable.h>
+#include <blaze/util/Suffix.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+
+
+//=================================================================================================
+//
+//  THRESHOLD DEFINITION MACROS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Definition of a threshold of the Blaze library.
+// \ingroup config
+//
+// This macro defines the threshold \a NAME with the default value \a VALUE. Depending on the
+// BLAZE_USE_RUNTIME_THRESHOLDS switch the threshold is either defined as compile time constant
+// or as runtime threshold, which can be modified via the setThreshold() and loadThresholds()
+// functions (see the RuntimeThreshold class template).
+*/
+#define BLAZE_THRESHOLD( NAME, VALUE ) \
+   BLAZE_JOIN( BLAZE_THRESHOLD_, BLAZE_USE_RUNTIME_THRESHOLDS )( NAME, VALUE )
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Definition of a compile time threshold.
+// \ingroup config
+*/
+#define BLAZE_THRESHOLD_0( NAME, VALUE ) \
+   const size_t NAME = VALUE
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Definition of a runtime threshold.
+// \ingroup config
+*/
+#define BLAZE_THRESHOLD_1( NAME, VALUE ) \
+   namespace thresholds { \
+      struct NAME { \
+         static inline const char* name () { return #NAME; } \
+         static inline size_t      value() { return VALUE; } \
+      }; \
+   } \
+   const RuntimeThreshold<thresholds::NAME> NAME
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS THRESHOLDTABLE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Process-wide table of all runtime thresholds.
+// \ingroup config
+//
+// The ThresholdTable class template manages the current values of all runtime thresholds (see
+// the BLAZE_USE_RUNTIME_THRESHOLDS switch). Every runtime threshold registers itself during the
+// static initialization of the program. On first use the table loads the threshold file named
+// by the \c BLAZE_THRESHOLD_FILE environment variable (if any), whose values take precedence
+// over the default values of the thresholds. Since this happens at program startup, missing
+// files, malformed lines and unknown thresholds are silently ignored. The loadThresholds()
+// function can be used to strictly load a threshold file at a later point in time.
+*/
+template< typename T >  // Type of the threshold values
+class ThresholdTable : private NonCreatable
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Current value and storage of a single threshold.
+   struct Entry {
+      T  value_;   //!< The current value of the threshold.
+      T* target_;  //!< The storage of the registered threshold (0 in case it is not registered).
+   };
+
+   typedef std::map<std::string,Entry>  Table;  //!< Type of the threshold table.
+   typedef std::pair<std::string,T>     Value;  //!< Type of a single threshold setting.
+   //**********************************************************************************************
+
+ public:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static T    attach( const char* name, T value, T* target );
+   static T    get   ( const std::string& name );
+   static void set   ( const std::string& name, T value );
+   static void load  ( const std::string& file );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static Table& table();
+   static Table* init ();
+   static bool   parse( std::istream& is, std::vector<Value>& values );
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Registration of a runtime threshold.
+//
+// \param name The name of the threshold.
+// \param value The default value of the threshold.
+// \param target The storage of the threshold.
+// \return The initial value of the threshold.
+//
+// This function registers the given threshold and returns its initial value, which is either
+// the value specified in the threshold file or the given default value.
+*/
+template< typename T >  // Type of the threshold values
+T ThresholdTable<T>::attach( const char* name, T value, T* target )
+{
+   Table& thresholds( table() );
+   typename Table::iterator pos( thresholds.find( name ) );
+
+   if( pos == thresholds.end() ) {
+      const Entry entry = { value, target };
+      thresholds.insert( std::make_pair( std::string( name ), entry ) );
+      return value;
+   }
+
+   pos->second.target_ = target;
+   return pos->second.value_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current value of the given threshold.
+//
+// \param name The name of the threshold.
+// \return The current value of the threshold.
+// \exception std::invalid_argument Invalid threshold name.
+*/
+template< typename T >  // Type of the threshold values
+T ThresholdTable<T>::get( const std::string& name )
+{
+   Table& thresholds( table() );
+   typename Table::const_iterator pos( thresholds.find( name ) );
+
+   if( pos == thresholds.end() || pos->second.target_ == 0 )
+      throw std::invalid_argument( "Invalid threshold name" );
+
+   return pos->second.value_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changes the value of the given threshold.
+//
+// \param name The name of the threshold.
+// \param value The new value of the threshold.
+// \return void
+// \exception std::invalid_argument Invalid threshold name.
+*/
+template< typename T >  // Type of the threshold values
+void ThresholdTable<T>::set( const std::string& name, T value )
+{
+   Table& thresholds( table() );
+   typename Table::iterator pos( thresholds.find( name ) );
+
+   if( pos == thresholds.end() || pos->second.target_ == 0 )
+      throw std::invalid_argument( "Invalid threshold name" );
+
+   pos->second.value_ = value;
+   *pos->second.target_ = value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loading the given threshold file.
+//
+// \param file The name of the threshold file.
+// \return void
+// \exception std::runtime_error Invalid threshold file.
+// \exception std::invalid_argument Invalid threshold name.
+//
+// This function changes the thresholds according to the given threshold file. In case the file
+// cannot be opened or contains malformed lines, a \a std::runtime_error exception is thrown.
+// In case the file contains an unknown threshold, a \a std::invalid_argument exception is
+// thrown. In both cases none of the thresholds is modified.
+*/
+template< typename T >  // Type of the threshold values
+void ThresholdTable<T>::load( const std::string& file )
+{
+   std::ifstream in( file.c_str() );
+   std::vector<Value> values;
+
+   if( !in || !parse( in, values ) )
+      throw std::runtime_error( "Invalid threshold file" );
+
+   for( size_t i=0UL; i<values.size(); ++i ) {
+      get( values[i].first );
+   }
+
+   for( size_t i=0UL; i<values.size(); ++i ) {
+      set( values[i].first, values[i].second );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the threshold table.
+//
+// \return Reference to the threshold table.
+//
+// The table is deliberately never destroyed, since runtime thresholds may still be used during
+// the destruction of static objects.
+*/
+template< typename T >  // Type of the threshold values
+typename ThresholdTable<T>::Table& ThresholdTable<T>::table()
+{
+   static Table* thresholds( init() );
+   return *thresholds;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the threshold table and loads the threshold file of the environment.
+//
+// \return Pointer to the newly created threshold table.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+template< typename T >  // Type of the threshold values
+typename ThresholdTable<T>::Table* ThresholdTable<T>::init()
+{
+   Table* thresholds( new Table() );
+
+   const char* env = std::getenv( "BLAZE_THRESHOLD_FILE" );
+
+   if( env == NULL )
+      return thresholds;
+
+   std::ifstream in( env );
+   std::vector<Value> values;
+
+   if( in && parse( in, values ) ) {
+      for( size_t i=0UL; i<values.size(); ++i ) {
+         const Entry entry = { values[i].second, 0 };
+         (*thresholds)[values[i].first] = entry;
+      }
+   }
+
+   return thresholds;
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parsing of a threshold file.
+//
+// \param is The input stream of the threshold file.
+// \param values The threshold settings of the file.
+// \return \a true in case the file could be parsed successfully, \a false if not.
+//
+// Each line of a threshold file either specifies a single threshold in the form "NAME VALUE"
+// or is empty. Everything following a '#' character is treated as comment. Negative values are
+// rejected, since the stream extraction would silently wrap them around for unsigned types.
+*/
+template< typename T >  // Type of the threshold values
+bool ThresholdTable<T>::parse( std::istream& is, std::vector<Value>& values )
+{
+   std::string line;
+
+   while( std::getline( is, line ) )
+   {
+      const std::string::size_type comment( line.find( '#' ) );
+      if( comment != std::string::npos )
+         line.erase( comment );
+
+      std::istringstream iss( line );
+      std::string name, rest;
+      T value;
+
+      if( !( iss >> name ) )
+         continue;
+
+      if( ( iss >> std::ws ).peek() == '-' || !( iss >> value ) || ( iss >> rest ) )
+         return false;
+
+      values.push_back( Value( name, value ) );
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS RUNTIMETHRESHOLD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Threshold of the Blaze library that can be modified at runtime.
+// \ingroup config
+//
+// The RuntimeThreshold class template represents a single threshold in case the runtime mode
+// of the thresholds is activated (see the BLAZE_USE_RUNTIME_THRESHOLDS switch). A runtime
+// threshold implicitly converts to its current value and can therefore be used in the same way
+// as a compile time threshold. The given tag type provides the name and the default value of
+// the threshold. Note that the value of a runtime threshold is set during the dynamic
+// initialization of the program. Operations executed during the initialization of other static
+// objects may therefore still observe the value 0.
+*/
+template< typename Tag >  // Type of the threshold tag
+class RuntimeThreshold
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   inline RuntimeThreshold();
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator size_t() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   static size_t value_;  //!< The current value of the threshold.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename Tag >
+size_t RuntimeThreshold<Tag>::value_(
+   ThresholdTable<size_t>::attach( Tag::name(), Tag::value(), &RuntimeThreshold<Tag>::value_ ) );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for RuntimeThreshold.
+//
+// The constructor guarantees that the threshold is registered, even if it is not used.
+*/
+template< typename Tag >  // Type of the threshold tag
+inline RuntimeThreshold<Tag>::RuntimeThreshold()
+{
+   UNUSED_PARAMETER( value_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion to the current value of the threshold.
+//
+// \return The current value of the threshold.
+*/
+template< typename Tag >  // Type of the threshold tag
+inline RuntimeThreshold<Tag>::operator size_t() const
+{
+   return value_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Runtime threshold functions */
+//@{
+inline size_t getThreshold( const std::string& name );
+inline void setThreshold( const std::string& name, size_t value );
+inline void loadThresholds( const std::string& file );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current value of the given threshold.
+// \ingroup config
+//
+// \param name The name of the threshold (as for instance "SMP_DVECASSIGN_THRESHOLD").
+// \return The current value of the threshold.
+// \exception std::invalid_argument Invalid threshold name.
+//
+// This function returns the current value of the given threshold. Note that this function
+// requires the runtime mode of the thresholds (see the BLAZE_USE_RUNTIME_THRESHOLDS switch).
+// Otherwise all thresholds are compile time constants and a \a std::invalid_argument exception
+// is thrown.
+*/
+inline size_t getThreshold( const std::string& name )
+{
+   return ThresholdTable<size_t>::get( name );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changes the value of the given threshold.
+// \ingroup config
+//
+// \param name The name of the threshold (as for instance "SMP_DVECASSIGN_THRESHOLD").
+// \param value The new value of the threshold.
+// \return void
+// \exception std::invalid_argument Invalid threshold name.
+//
+// This function changes the value of the given threshold. Note that this function requires the
+// runtime mode of the thresholds (see the BLAZE_USE_RUNTIME_THRESHOLDS switch). Otherwise all
+// thresholds are compile time constants and a \a std::invalid_argument exception is thrown.
+// Also note that the function must not be called while other threads execute Blaze operations.
+*/
+inline void setThreshold( const std::string& name, size_t value )
+{
+   ThresholdTable<size_t>::set( name, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loading the thresholds from the given threshold file.
+// \ingroup config
+//
+// \param file The name of the threshold file.
+// \return void
+// \exception std::runtime_error Invalid threshold file.
+// \exception std::invalid_argument Invalid threshold name.
+//
+// This function changes the thresholds according to the given threshold file. Each line of the
+// file specifies a single threshold in the form "NAME VALUE". Empty lines and everything
+// following a '#' character are ignored:
+
+   \code
+   # Thresholds for a 16-core system
+   SMP_DVECASSIGN_THRESHOLD   12000
+   SMP_DMATDMATMULT_THRESHOLD 32
+   \endcode
+
+// In case the file cannot be opened or contains malformed lines, a \a std::runtime_error
+// exception is thrown. In case the file contains an unknown threshold, a \a std::invalid_argument
+// exception is thrown. In both cases none of the thresholds is modified. Note that this function
+// requires the runtime mode of the thresholds (see the BLAZE_USE_RUNTIME_THRESHOLDS switch) and
+// must not be called while other threads execute Blaze operations.
+*/
+inline void loadThresholds( const std::string& file )
+{
+   ThresholdTable<size_t>::load( file );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
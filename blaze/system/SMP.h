@@ -123,4 +123,76 @@
 #endif
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  OPENMP LOOP SCHEDULING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\def BLAZE_OPENMP_SCHEDULE
+// \brief The OpenMP loop schedule of the OpenMP-based SMP assignments.
+// \ingroup system
+//
+// This macro expands to the OpenMP schedule kind selected via the \c BLAZE_OPENMP_SCHEDULING
+// switch in the <em>./blaze/config/SMP.h</em> configuration file. It is used within the
+// \c schedule clause of the loops of the OpenMP-based SMP assignments.
+*/
+#if BLAZE_OPENMP_SCHEDULING == 0
+#  define BLAZE_OPENMP_SCHEDULE static
+#elif BLAZE_OPENMP_SCHEDULING == 1
+#  define BLAZE_OPENMP_SCHEDULE dynamic
+#elif BLAZE_OPENMP_SCHEDULING == 2
+#  define BLAZE_OPENMP_SCHEDULE guided
+#else
+#  error Invalid OpenMP loop scheduling!
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if BLAZE_OPENMP_BLOCKS_PER_THREAD < 1
+#  error Invalid number of blocks per thread!
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD-LOCAL STORAGE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\def BLAZE_THREAD_LOCAL
+// \brief Platform dependent setup of the storage class of the SMP state of a calling thread.
+// \ingroup system
+//
+// In case the shared memory parallelization is active, the Blaze library keeps the state of
+// the parallelization (as for instance active serial or parallel sections, thread limits and
+// the currently active execution context) separately for every thread calling into the library.
+// This enables several application threads (as for instance the threads of an enclosing OpenMP
+// parallel region) to use the parallelization concurrently. In case the parallelization is not
+// active, the state is shared among all threads. Note that this setting is only applicable to
+// trivially constructible variables.
+*/
+#if BLAZE_OPENMP_PARALLEL_MODE || \
+    BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  if defined(_MSC_VER)
+#    define BLAZE_THREAD_LOCAL __declspec(thread)
+#  else
+#    define BLAZE_THREAD_LOCAL __thread
+#  endif
+#else
+#  define BLAZE_THREAD_LOCAL
+#endif
+//*************************************************************************************************
+
 #endif
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/system/RuntimeThresholds.h>
 #include <blaze/util/StaticAssert.h>
 
 
@@ -64,6 +65,7 @@
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
+#if !BLAZE_USE_RUNTIME_THRESHOLDS
 namespace {
 
 BLAZE_STATIC_ASSERT( blaze::DMATDVECMULT_THRESHOLD   > 0UL );
@@ -119,8 +121,11 @@ BLAZE_STATIC_ASSERT( blaze::SMP_SMATTSMATMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_THRESHOLD >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DVECTDVECMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_BATCH_THRESHOLD          >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_BATCHMULT_THRESHOLD      >= 0UL );
 
 }
+#endif
 /*! \endcond */
 //*************************************************************************************************
 
@@ -41,5 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/util/serialization/Archive.h>
+#include <blaze/util/serialization/CompressedStream.h>
+#include <blaze/util/serialization/LZCodec.h>
 
 #endif
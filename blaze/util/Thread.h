@@ -40,10 +40,9 @@
 // Includes
 //*************************************************************************************************
 
-#include <boost/bind.hpp>
-#include <boost/scoped_ptr.hpp>
 #include <blaze/util/Assert.h>
 #include <blaze/util/NonCopyable.h>
+#include <blaze/util/UniquePtr.h>
 
 
 namespace blaze {
@@ -253,7 +252,7 @@ class Thread : private NonCopyable
    //**Type definitions****************************************************************************
    typedef TT                             ThreadType;      //!< Type of the encapsulated thread.
    typedef ThreadPool<TT,MT,LT,CT>        ThreadPoolType;  //!< Type of the managing thread pool.
-   typedef boost::scoped_ptr<ThreadType>  ThreadHandle;    //!< Handle for a single thread.
+   typedef UniquePtr<ThreadType>          ThreadHandle;    //!< Handle for a single thread.
    //**********************************************************************************************
 
    //**Constructors********************************************************************************
@@ -363,7 +362,7 @@ Thread<TT,MT,LT,CT>::Thread( ThreadPoolType* pool )
    , pool_      ( pool  )  // Handle to the managing thread pool
    , thread_    ( 0     )  // Handle to the thread of execution
 {
-   thread_.reset( new ThreadType( boost::bind( &Thread::run, this ) ) );
+   thread_.reset( new ThreadType( &Thread::run, this ) );
 }
 //*************************************************************************************************
 
@@ -632,7 +631,8 @@ inline bool Thread<TT,MT,LT,CT>::hasTerminated() const
 //*************************************************************************************************
 /*!\brief Execution function for threads in a thread pool.
 //
-// This function is executed by any thread managed by a thread pool.
+// This function is executed by any thread managed by a thread pool. Before executing the
+// scheduled tasks the thread executes the initialization function of the thread pool (if any).
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -643,6 +643,10 @@ void Thread<TT,MT,LT,CT>::run()
    // Checking the thread pool handle
    BLAZE_INTERNAL_ASSERT( pool_, "Uninitialized pool handle detected" );
 
+   // Initializing the thread
+   if( pool_->init_ )
+      pool_->init_();
+
    // Executing scheduled tasks
    while( pool_->executeTask() ) {}
 
@@ -40,13 +40,14 @@
 // Includes
 //*************************************************************************************************
 
+#include <deque>
 #include <stdexcept>
-#include <boost/bind.hpp>
 #include <blaze/util/Assert.h>
 #include <blaze/util/NonCopyable.h>
 #include <blaze/util/PtrVector.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Thread.h>
+#include <blaze/util/threadpool/Counter.h>
 #include <blaze/util/threadpool/Task.h>
 #include <blaze/util/threadpool/TaskQueue.h>
 #include <blaze/util/Types.h>
@@ -192,6 +193,26 @@ namespace blaze {
 // for the given functions/functors.
 //
 //
+// \section threadpool_tasks Task storage and scheduling overhead
+//
+// The scheduled functions/functors are stored in a lock-free, bounded task queue, which can hold
+// up to \a capacity (i.e. 256) tasks. Functors of up to 384 bytes (including the bound arguments)
+// are stored within the preallocated slots of the task queue, i.e. scheduling a task does not
+// involve any dynamic memory allocation. Only larger functors are stored on the heap. Neither
+// the scheduling thread nor the worker threads acquire the synchronization mutex as long as
+// tasks are available; the mutex is only used to put idle threads to sleep and to wake them up
+// again. In case the task queue is full, schedule() does neither block nor execute the given
+// task within the scheduling thread. Instead, the task is moved to an unbounded overflow list,
+// which is protected by the synchronization mutex and which is processed by the worker threads
+// as soon as the task queue runs empty. Thus a burst of more than \a capacity tasks is still
+// executed completely by the worker threads, at the cost of a dynamic memory allocation and a
+// mutex acquisition for every task exceeding the capacity of the task queue.
+//
+// In case the C++11 thread-based parallelization is active, the thread pool and its tasks
+// solely rely on the C++11 thread primitives. Otherwise the atomic counters are based on the
+// Boost library.
+//
+//
 // \section threadpool_exception Throwing exceptions in a thread parallel environment
 //
 // It can happen that during the execution of a given task a thread encounters an erroneous
@@ -311,19 +332,132 @@ class ThreadPool : private NonCopyable
 {
  private:
    //**Type definitions****************************************************************************
-   typedef Thread<TT,MT,LT,CT>       ManagedThread;  //!< Type of the managed threads.
-   typedef PtrVector<ManagedThread>  Threads;        //!< Type of the thread container.
-   typedef threadpool::TaskQueue     TaskQueue;      //!< Type of the task queue.
-   typedef MT                        Mutex;          //!< Type of the mutex.
-   typedef LT                        Lock;           //!< Type of a locking object.
-   typedef CT                        Condition;      //!< Condition variable type.
+   typedef Thread<TT,MT,LT,CT>           ManagedThread;  //!< Type of the managed threads.
+   typedef PtrVector<ManagedThread>      Threads;        //!< Type of the thread container.
+   typedef threadpool::TaskQueue         TaskQueue;      //!< Type of the task queue.
+   typedef MT                            Mutex;          //!< Type of the mutex.
+   typedef LT                            Lock;           //!< Type of a locking object.
+   typedef CT                            Condition;      //!< Condition variable type.
+   typedef threadpool::Counter           Counter;        //!< Type of the atomic counters.
+   typedef std::deque<threadpool::Task>  Overflow;       //!< Type of the overflow list.
+   //**********************************************************************************************
+
+   //**Private class PendingGuard******************************************************************
+   /*!\brief Withdrawal of a newly announced task in case it cannot be scheduled.
+   */
+   struct PendingGuard : private NonCopyable
+   {
+      explicit inline PendingGuard( ThreadPool& pool )
+         : pool_( &pool ) { ++pool_->pending_; }
+
+      inline ~PendingGuard() { if( pool_ ) pool_->finishTasks( 1UL ); }
+
+      inline void release() { pool_ = 0; }
+
+      ThreadPool* pool_;  //!< The thread pool the task is scheduled on.
+   };
+   //**********************************************************************************************
+
+   //**Private class Binder1***********************************************************************
+   /*!\brief Binding of a unary function/functor and its arguments.
+   */
+   template< typename Callable, typename A1 >
+   struct Binder1
+   {
+      inline Binder1( Callable func, A1 a1 )
+         : func_( func ), a1_( a1 ) {}
+
+      inline void operator()() { func_( a1_ ); }
+
+      Callable func_;  //!< The bound function/functor.
+      A1 a1_;          //!< The first argument.
+   };
+   //**********************************************************************************************
+
+   //**Private class Binder2***********************************************************************
+   /*!\brief Binding of a binary function/functor and its arguments.
+   */
+   template< typename Callable, typename A1, typename A2 >
+   struct Binder2
+   {
+      inline Binder2( Callable func, A1 a1, A2 a2 )
+         : func_( func ), a1_( a1 ), a2_( a2 ) {}
+
+      inline void operator()() { func_( a1_, a2_ ); }
+
+      Callable func_;  //!< The bound function/functor.
+      A1 a1_;          //!< The first argument.
+      A2 a2_;          //!< The second argument.
+   };
+   //**********************************************************************************************
+
+   //**Private class Binder3***********************************************************************
+   /*!\brief Binding of a ternary function/functor and its arguments.
+   */
+   template< typename Callable, typename A1, typename A2, typename A3 >
+   struct Binder3
+   {
+      inline Binder3( Callable func, A1 a1, A2 a2, A3 a3 )
+         : func_( func ), a1_( a1 ), a2_( a2 ), a3_( a3 ) {}
+
+      inline void operator()() { func_( a1_, a2_, a3_ ); }
+
+      Callable func_;  //!< The bound function/functor.
+      A1 a1_;          //!< The first argument.
+      A2 a2_;          //!< The second argument.
+      A3 a3_;          //!< The third argument.
+   };
+   //**********************************************************************************************
+
+   //**Private class Binder4***********************************************************************
+   /*!\brief Binding of a four argument function/functor and its arguments.
+   */
+   template< typename Callable, typename A1, typename A2, typename A3, typename A4 >
+   struct Binder4
+   {
+      inline Binder4( Callable func, A1 a1, A2 a2, A3 a3, A4 a4 )
+         : func_( func ), a1_( a1 ), a2_( a2 ), a3_( a3 ), a4_( a4 ) {}
+
+      inline void operator()() { func_( a1_, a2_, a3_, a4_ ); }
+
+      Callable func_;  //!< The bound function/functor.
+      A1 a1_;          //!< The first argument.
+      A2 a2_;          //!< The second argument.
+      A3 a3_;          //!< The third argument.
+      A4 a4_;          //!< The fourth argument.
+   };
+   //**********************************************************************************************
+
+   //**Private class Binder5***********************************************************************
+   /*!\brief Binding of a five argument function/functor and its arguments.
+   */
+   template< typename Callable, typename A1, typename A2, typename A3, typename A4, typename A5 >
+   struct Binder5
+   {
+      inline Binder5( Callable func, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5 )
+         : func_( func ), a1_( a1 ), a2_( a2 ), a3_( a3 ), a4_( a4 ), a5_( a5 ) {}
+
+      inline void operator()() { func_( a1_, a2_, a3_, a4_, a5_ ); }
+
+      Callable func_;  //!< The bound function/functor.
+      A1 a1_;          //!< The first argument.
+      A2 a2_;          //!< The second argument.
+      A3 a3_;          //!< The third argument.
+      A4 a4_;          //!< The fourth argument.
+      A5 a5_;          //!< The fifth argument.
+   };
    //**********************************************************************************************
 
  public:
+   //**Compilation flags***************************************************************************
+   //! Maximum number of tasks that can be queued for execution.
+   enum { capacity = 256 };
+   //**********************************************************************************************
+
    //**Constructor*********************************************************************************
    /*!\name Constructor */
    //@{
-   explicit ThreadPool( size_t n );
+   explicit ThreadPool( size_t n, void (*init)() = 0 );
    //@}
    //**********************************************************************************************
 
@@ -382,6 +516,7 @@ class ThreadPool : private NonCopyable
    //@{
    void createThread();
    bool executeTask();
+   void finishTasks( size_t n );
    //@}
    //**********************************************************************************************
 
@@ -392,12 +527,16 @@ class ThreadPool : private NonCopyable
    volatile size_t expected_;  //!< Expected number of threads in the thread pool.
                                /*!< This number may differ from the total number of threads
                                     during a resize of the thread pool. */
-   volatile size_t active_;    //!< Number of currently active/busy threads.
+   Counter active_;            //!< Number of currently active/busy threads.
+   Counter sleeping_;          //!< Number of threads waiting for a new task.
+   Counter pending_;           //!< Number of scheduled but not yet completed tasks.
    Threads threads_;           //!< The threads contained in the thread pool.
    TaskQueue taskqueue_;       //!< Task queue for the scheduled tasks.
+   Overflow overflow_;         //!< Overflow list for the tasks exceeding the task queue.
    mutable Mutex mutex_;       //!< Synchronization mutex.
    Condition waitForTask_;     //!< Wait condition for idle threads.
    Condition waitForThread_;   //!< Wait condition for the thread management.
+   void (*init_)();            //!< Initialization function of the threads.
    //@}
    //**********************************************************************************************
 
@@ -422,23 +561,30 @@ class ThreadPool : private NonCopyable
 /*!\brief Constructor for the ThreadPool class.
 //
 // \param n Initial number of threads \f$[1..\infty)\f$.
+// \param init The initialization function of the threads (optional).
 //
 // This constructor creates a thread pool with initially \a n new threads. All threads are
-// initially idle until a task is scheduled.
+// initially idle until a task is scheduled. The optional initialization function is executed
+// once by every thread of the thread pool (including threads added via resize()) before it
+// executes its first task. It is never executed by a thread calling schedule().
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n )
-   : total_     ( 0 )  // Total number of threads in the thread pool
-   , expected_  ( 0 )  // Expected number of threads in the thread pool
-   , active_    ( 0 )  // Number of currently active/busy threads
-   , threads_      ()  // The threads contained in the thread pool
-   , taskqueue_    ()  // Task queue for the scheduled tasks
-   , mutex_        ()  // Synchronization mutex
-   , waitForTask_  ()  // Wait condition for idle threads
-   , waitForThread_()  // Wait condition for the thread management
+ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n, void (*init)() )
+   : total_        ( 0 )         // Total number of threads in the thread pool
+   , expected_     ( 0 )         // Expected number of threads in the thread pool
+   , active_       ( 0 )         // Number of currently active/busy threads
+   , sleeping_     ( 0 )         // Number of threads waiting for a new task
+   , pending_      ( 0 )         // Number of scheduled but not yet completed tasks
+   , threads_      ()            // The threads contained in the thread pool
+   , taskqueue_    ( capacity )  // Task queue for the scheduled tasks
+   , overflow_     ()            // Overflow list for the tasks exceeding the task queue
+   , mutex_        ()            // Synchronization mutex
+   , waitForTask_  ()            // Wait condition for idle threads
+   , waitForThread_()            // Wait condition for the thread management
+   , init_         ( init )      // Initialization function of the threads
 {
    resize( n );
 }
@@ -465,10 +611,10 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 ThreadPool<TT,MT,LT,CT>::~ThreadPool()
 {
-   Lock lock( mutex_ );
-
    // Removing all currently queued tasks
-   taskqueue_.clear();
+   clear();
+
+   Lock lock( mutex_ );
 
    // Setting the expected number of threads
    expected_ = 0;
@@ -511,8 +657,11 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline bool ThreadPool<TT,MT,LT,CT>::isEmpty() const
 {
+   if( !taskqueue_.isEmpty() )
+      return false;
+
    Lock lock( mutex_ );
-   return taskqueue_.isEmpty();
+   return overflow_.empty();
 }
 //*************************************************************************************************
 
@@ -545,7 +694,6 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline size_t ThreadPool<TT,MT,LT,CT>::active() const
 {
-   Lock lock( mutex_ );
    return active_;
 }
 //*************************************************************************************************
@@ -583,7 +731,9 @@ inline size_t ThreadPool<TT,MT,LT,CT>::ready() const
 // \return void
 //
 // This function schedules the given function/functor for execution. The given function/functor
-// must be copyable, must be callable without arguments and must return void.
+// must be copyable, must be callable without arguments and must return void. In case the task
+// queue is full, the function/functor is appended to the overflow list of the thread pool. In
+// case the task cannot be stored, the task is not scheduled and the exception is propagated.
 */
 template< typename TT          // Type of the encapsulated thread
         , typename MT          // Type of the synchronization mutex
@@ -592,9 +742,22 @@ template< typename TT          // Type of the encapsulated thread
 template< typename Callable >  // Type of the function/functor
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( func );
-   waitForTask_.notify_one();
+   PendingGuard guard( *this );
+
+   if( !taskqueue_.push( func ) ) {
+      Lock lock( mutex_ );
+      overflow_.push_back( threadpool::Task( func ) );
+      guard.release();
+      waitForTask_.notify_one();
+      return;
+   }
+
+   guard.release();
+
+   if( sleeping_ > 0UL ) {
+      Lock lock( mutex_ );
+      waitForTask_.notify_one();
+   }
 }
 //*************************************************************************************************
 
@@ -617,9 +780,7 @@ template< typename Callable  // Type of the function/functor
         , typename A1 >      // Type of the first argument
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, A1 a1 )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( boost::bind<void>( func, a1 ) );
-   waitForTask_.notify_one();
+   schedule( Binder1<Callable, A1>( func, a1 ) );
 }
 //*************************************************************************************************
 
@@ -644,9 +805,7 @@ template< typename Callable  // Type of the function/functor
         , typename A2 >      // Type of the second argument
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, A1 a1, A2 a2 )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( boost::bind<void>( func, a1, a2 ) );
-   waitForTask_.notify_one();
+   schedule( Binder2<Callable, A1, A2>( func, a1, a2 ) );
 }
 //*************************************************************************************************
 
@@ -673,9 +832,7 @@ template< typename Callable  // Type of the function/functor
         , typename A3 >      // Type of the third argument
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, A1 a1, A2 a2, A3 a3 )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( boost::bind<void>( func, a1, a2, a3 ) );
-   waitForTask_.notify_one();
+   schedule( Binder3<Callable, A1, A2, A3>( func, a1, a2, a3 ) );
 }
 //*************************************************************************************************
 
@@ -704,9 +861,7 @@ template< typename Callable  // Type of the function/functor
         , typename A4 >      // Type of the fourth argument
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, A1 a1, A2 a2, A3 a3, A4 a4 )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( boost::bind<void>( func, a1, a2, a3, a4 ) );
-   waitForTask_.notify_one();
+   schedule( Binder4<Callable, A1, A2, A3, A4>( func, a1, a2, a3, a4 ) );
 }
 //*************************************************************************************************
 
@@ -737,9 +892,7 @@ template< typename Callable  // Type of the function/functor
         , typename A5 >      // Type of the fifth argument
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, A1 a1, A2 a2, A3 a3, A4 a4, A5 a5 )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( boost::bind<void>( func, a1, a2, a3, a4, a5 ) );
-   waitForTask_.notify_one();
+   schedule( Binder5<Callable, A1, A2, A3, A4, A5>( func, a1, a2, a3, a4, a5 ) );
 }
 //*************************************************************************************************
 
@@ -852,7 +1005,7 @@ void ThreadPool<TT,MT,LT,CT>::wait()
 {
    Lock lock( mutex_ );
 
-   while( !taskqueue_.isEmpty() || active_ > 0 ) {
+   while( pending_ > 0UL ) {
       waitForThread_.wait( lock );
    }
 }
@@ -873,8 +1026,20 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 void ThreadPool<TT,MT,LT,CT>::clear()
 {
-   Lock lock( mutex_ );
-   taskqueue_.clear();
+   threadpool::Task task;
+   size_t removed( 0UL );
+
+   while( taskqueue_.pop( task ) ) {
+      ++removed;
+   }
+
+   {
+      Lock lock( mutex_ );
+      removed += overflow_.size();
+      overflow_.clear();
+   }
+
+   finishTasks( removed );
 }
 //*************************************************************************************************
 
@@ -901,7 +1066,6 @@ void ThreadPool<TT,MT,LT,CT>::createThread()
    threads_.pushBack( new ManagedThread( this ) );
    ++total_;
    ++expected_;
-   ++active_;
 }
 //*************************************************************************************************
 
@@ -912,8 +1076,8 @@ void ThreadPool<TT,MT,LT,CT>::createThread()
 // \return \a true in case a task was successfully finished, \a false if not.
 //
 // This function is repeatedly called by every thread to execute one of the scheduled tasks.
-// In case there is no task available, the thread blocks and waits for a new task to be
-// scheduled.
+// The tasks of the overflow list are executed as soon as the task queue runs empty. In case
+// there is no task available, the thread blocks and waits for a new task to be scheduled.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -924,34 +1088,67 @@ bool ThreadPool<TT,MT,LT,CT>::executeTask()
    threadpool::Task task;
 
    // Acquiring a scheduled task
+   if( !taskqueue_.pop( task ) )
    {
       Lock lock( mutex_ );
 
-      while( taskqueue_.isEmpty() )
+      while( !taskqueue_.pop( task ) )
       {
-         --active_;
-         waitForThread_.notify_all();
+         if( !overflow_.empty() ) {
+            task.swap( overflow_.front() );
+            overflow_.pop_front();
+            break;
+         }
 
          if( total_ > expected_ ) {
             --total_;
+            waitForThread_.notify_all();
             return false;
          }
 
-         waitForTask_.wait( lock );
-         ++active_;
+         // The sleeping threads have to be announced before the final check of the task queue
+         // to guarantee that any concurrently scheduled task sends a wake-up notification.
+         ++sleeping_;
+         if( taskqueue_.isEmpty() && overflow_.empty() )
+            waitForTask_.wait( lock );
+         --sleeping_;
       }
-
-      BLAZE_INTERNAL_ASSERT( !taskqueue_.isEmpty(), "Empty task queue detected" );
-      task = taskqueue_.pop();
    }
 
    // Executing the task
+   ++active_;
    task();
+   --active_;
+
+   finishTasks( 1UL );
 
    return true;
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Marking the given number of scheduled tasks as completed.
+//
+// \param n The number of completed tasks.
+// \return void
+//
+// This function is called for every completed or removed task. In case no more tasks are
+// pending, all threads waiting for the completion of the scheduled tasks are notified.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::finishTasks( size_t n )
+{
+   if( n > 0UL && pending_.fetch_sub( n ) == n ) {
+      Lock lock( mutex_ );
+      waitForThread_.notify_all();
+   }
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
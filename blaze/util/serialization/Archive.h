@@ -42,7 +42,10 @@
 
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
 #include <blaze/util/NonCopyable.h>
+#include <blaze/util/serialization/IsTypedStream.h>
+#include <blaze/util/TrueType.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/UniquePtr.h>
@@ -135,7 +138,10 @@ namespace blaze {
 // Note that the Archive class can be bound to any kind of input or output stream (or also
 // iostream) that supports the standard write or read functions, respectively. Therefore
 // the serialization of a C++ data structure is not restricted to binary files, but allows
-// for any possible destination.
+// for any possible destination. In case the bound stream provides typed input and output
+// functions (see the IsTypedStream type trait), the archive passes the type information of
+// all built-in data values on to the stream. This enables streams as for instance the
+// CompressedStream class template to apply type-specific transformations to the data.
 */
 template< typename Stream >  // Type of the bound stream
 class Archive : private NonCopyable
@@ -220,7 +226,32 @@ class Archive : private NonCopyable
    //@}
    //**********************************************************************************************
 
+   //**Positioning functions***********************************************************************
+   /*!
+ame Positioning functions */
+   //@{
+   inline std::streampos tellg();
+   inline Archive&       seekg( std::streampos pos );
+   //@}
+   //**********************************************************************************************
+
  private:
+   //**Input/output functions*********************************************************************
+   /*!\name Input/output functions */
+   //@{
+   template< typename Type >
+   inline void writeData( const Type* array, size_t count, FalseType );
+
+   template< typename Type >
+   inline void writeData( const Type* array, size_t count, TrueType );
+
+   template< typename Type >
+   inline void readData( Type* array, size_t count, FalseType );
+
+   template< typename Type >
+   inline void readData( Type* array, size_t count, TrueType );
+   //@}
+   //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
@@ -440,8 +471,7 @@ template< typename T >       // Type of the value to be serialized
 typename EnableIf< IsNumeric<T>, Archive<Stream>& >::Type
    Archive<Stream>::operator<<( const T& value )
 {
-   typedef typename Stream::char_type  CharType;
-   stream_.write( reinterpret_cast<const CharType*>( &value ), sizeof( T ) );
+   writeData( &value, 1UL, typename IsTypedStream<Stream>::Type() );
    return *this;
 }
 //*************************************************************************************************
@@ -475,8 +505,7 @@ template< typename T >       // Type of the value to be deserialized
 typename EnableIf< IsNumeric<T>, Archive<Stream>& >::Type
    Archive<Stream>::operator>>( T& value )
 {
-   typedef typename Stream::char_type  CharType;
-   stream_.read( reinterpret_cast<CharType*>( &value ), sizeof( T ) );
+   readData( &value, 1UL, typename IsTypedStream<Stream>::Type() );
    return *this;
 }
 //*************************************************************************************************
@@ -513,8 +542,7 @@ template< typename Type >    // Type of the array elements
 inline typename EnableIf< IsNumeric<Type>, Archive<Stream>& >::Type
    Archive<Stream>::write( const Type* array, size_t count )
 {
-   typedef typename Stream::char_type  CharType;
-   stream_.write( reinterpret_cast<const CharType*>( array ), count*sizeof(Type) );
+   writeData( array, count, typename IsTypedStream<Stream>::Type() );
    return *this;
 }
 //*************************************************************************************************
@@ -536,8 +564,7 @@ template< typename Type >    // Type of the array elements
 inline typename EnableIf< IsNumeric<Type>, Archive<Stream>& >::Type
    Archive<Stream>::read( Type* array, size_t count )
 {
-   typedef typename Stream::char_type  CharType;
-   stream_.read( reinterpret_cast<CharType*>( array ), count*sizeof(Type) );
+   readData( array, count, typename IsTypedStream<Stream>::Type() );
    return *this;
 }
 //*************************************************************************************************
@@ -643,6 +670,143 @@ inline void Archive<Stream>::clear( std::ios_base::iostate state )
 }
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  POSITIONING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current read position of the archive.
+//
+// \return The current read position of the bound input stream.
+//
+// This function returns the current read position of the bound input stream. Note that this
+// function can only be used in case the bound stream is seekable (as for instance the standard
+// file and string streams).
+*/
+template< typename Stream >  // Type of the bound stream
+inline std::streampos Archive<Stream>::tellg()
+{
+   return stream_.tellg();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the read position of the archive.
+//
+// \param pos The new read position.
+// \return Reference to the archive.
+//
+// This function sets the read position of the bound input stream. In combination with the
+// tellg() function it enables the random access to serialized data structures, as for instance
+// the partial deserialization of matrices. Note that this function can only be used in case
+// the bound stream is seekable (as for instance the standard file and string streams).
+*/
+template< typename Stream >  // Type of the bound stream
+inline Archive<Stream>& Archive<Stream>::seekg( std::streampos pos )
+{
+   stream_.seekg( pos );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INPUT/OUTPUT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes an array of values to an untyped stream.
+//
+// \param array Pointer to the first element of the array.
+// \param count The number of elements in the array.
+// \return void
+//
+// This function writes the given array via the character-based \c write() function of the
+// bound stream.
+*/
+template< typename Stream >  // Type of the bound stream
+template< typename Type >    // Type of the array elements
+inline void Archive<Stream>::writeData( const Type* array, size_t count, FalseType )
+{
+   typedef typename Stream::char_type  CharType;
+   stream_.write( reinterpret_cast<const CharType*>( array ), count*sizeof(Type) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes an array of values to a typed stream.
+//
+// \param array Pointer to the first element of the array.
+// \param count The number of elements in the array.
+// \return void
+//
+// This function writes the given array via the typed \c write() function of the bound stream.
+*/
+template< typename Stream >  // Type of the bound stream
+template< typename Type >    // Type of the array elements
+inline void Archive<Stream>::writeData( const Type* array, size_t count, TrueType )
+{
+   stream_.write( array, count );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads an array of values from an untyped stream.
+//
+// \param array Pointer to the first element of the array.
+// \param count The number of elements in the array.
+// \return void
+//
+// This function reads the given array via the character-based \c read() function of the bound
+// stream.
+*/
+template< typename Stream >  // Type of the bound stream
+template< typename Type >    // Type of the array elements
+inline void Archive<Stream>::readData( Type* array, size_t count, FalseType )
+{
+   typedef typename Stream::char_type  CharType;
+   stream_.read( reinterpret_cast<CharType*>( array ), count*sizeof(Type) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads an array of values from a typed stream.
+//
+// \param array Pointer to the first element of the array.
+// \param count The number of elements in the array.
+// \return void
+//
+// This function reads the given array via the typed \c read() function of the bound stream.
+*/
+template< typename Stream >  // Type of the bound stream
+template< typename Type >    // Type of the array elements
+inline void Archive<Stream>::readData( Type* array, size_t count, TrueType )
+{
+   stream_.read( array, count );
+}
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -0,0 +1,1911 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/serialization/CompressedStream.h
+//  \brief Header file for the CompressedStream class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_SERIALIZATION_COMPRESSEDSTREAM_H_
+#define _BLAZE_UTIL_SERIALIZATION_COMPRESSEDSTREAM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/SMP.h>
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+#  include <omp.h>
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <blaze/math/smp/threads/ThreadBackend.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <ios>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/serialization/IsTypedStream.h>
+#include <blaze/util/serialization/LZCodec.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/UniquePtr.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  COMPRESSION FILTERS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Preprocessing filters of the CompressedStream class template.
+// \ingroup serialization
+//
+// The compression filters are applied to all values of the same built-in data type within a
+// single block before the block is compressed. They do not change the data, but rearrange it
+// in order to expose redundancy to the compression codec. The filters can be combined via the
+// bitwise OR operator.
+*/
+enum CompressionFilter
+{
+   noFilter      = 0,  //!< No preprocessing of the data.
+   shuffleFilter = 1,  //!< Byte shuffling of all multi-byte values.
+                       /*!< The shuffle filter groups the bytes of equal significance of all
+                            values of the same type. For instance for smooth floating point
+                            data the sign and exponent bytes become nearly constant sequences,
+                            for integral indices the most significant bytes become zeros. */
+   deltaFilter   = 2   //!< Delta encoding of consecutive values of the same type.
+                       /*!< The delta filter replaces each integral value by its difference
+                            to the preceding value of the same type and each floating point
+                            value by the bitwise XOR with the preceding value. For instance
+                            sorted sparse matrix indices are turned into small gaps. */
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compressing stream adaptor for the Archive class.
+// \ingroup serialization
+//
+// \section compressedstream_general General
+//
+// The CompressedStream class template is an adaptor for an arbitrary input or output stream,
+// which transparently compresses all written data and decompresses all read data. It can be
+// used as the \a Stream template parameter of the Archive class in order to reduce the size of
+// the serialized representation of vectors and matrices:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::CompressedStream;
+
+   CompressedMatrix<double> A;
+   // ... Resizing and initialization
+
+   // Serialization of the matrix into the compressed file "matrix.blaze"
+   {
+      blaze::Archive< CompressedStream<std::ofstream> > archive( "matrix.blaze", std::ofstream::binary );
+      archive << A;
+   }
+
+   // Reconstitution of the matrix from the compressed file "matrix.blaze"
+   {
+      blaze::Archive< CompressedStream<std::ifstream> > archive( "matrix.blaze", std::ifstream::binary );
+      archive >> A;
+   }
+   \endcode
+
+// All given constructor arguments are forwarded to the underlying stream. Alternatively, the
+// compressed stream can be bound to an already existing stream.
+//
+//
+// \section compressedstream_blocks Blocks and Parallelization
+//
+// The data is split into independent blocks of configurable size (see the setBlockSize()
+// function), which are compressed by means of the built-in LZCodec. Since the blocks do not
+// depend on each other, several blocks are compressed and decompressed in parallel. For this
+// purpose the compressed stream uses the active shared memory parallelization of the Blaze
+// library (OpenMP, C++11 threads, or Boost threads). By default, the stream processes as many
+// blocks concurrently as threads are available for a parallel operation of the calling thread
+// (see the setThreads() function). The blocks are executed by the threads of the active SMP
+// backend, i.e. in case of the C++11 and Boost thread parallelization via the execution context
+// of the calling thread. Therefore the compression respects both serial sections (see the
+// BLAZE_SERIAL_SECTION macro) and the thread limit of the calling thread (see the
+// BLAZE_THREAD_LIMIT macro).
+//
+//
+// \section compressedstream_filters Filters
+//
+// Within each block the values are grouped by their type, i.e. all values of the same built-in
+// data type form a separate lane. For instance, in case of a serialized CompressedMatrix all
+// indices form a single lane of integral values and all element values form a lane of floating
+// point values. Per lane the following filters can be applied before the compression (see the
+// setFilters() function):
+//
+//  - \a shuffleFilter: Byte shuffling of all multi-byte values (default)
+//  - \a deltaFilter  : Delta encoding of consecutive values of the same type
+//
+// Since the filters are stored along with each compressed block, the reading stream does not
+// require any configuration:
+
+   \code
+   std::ofstream ofs( "matrix.blaze", std::ofstream::binary );
+   blaze::CompressedStream<std::ofstream> stream( ofs );
+   stream.setFilters( blaze::shuffleFilter | blaze::deltaFilter );
+   stream.setBlockSize( 4194304UL );
+
+   blaze::Archive< blaze::CompressedStream<std::ofstream> > archive( stream );
+   archive << A;
+   \endcode
+
+// Note that the values have to be read in exactly the same order and with the same types as
+// they have been written. All remaining data is written to the underlying stream on a call to
+// the flush() function or at the latest on destruction of the compressed stream.
+*/
+template< typename Stream >  // Type of the underlying stream
+class CompressedStream : private NonCopyable
+{
+ public:
+   //**Type definitions****************************************************************************
+   typedef typename Stream::char_type  char_type;  //!< Character type of the underlying stream.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline CompressedStream();
+
+   template< typename A1 >
+   explicit inline CompressedStream( const A1& a1 );
+
+   template< typename A1, typename A2 >
+   explicit inline CompressedStream( const A1& a1, const A2& a2 );
+
+   template< typename A1, typename A2, typename A3 >
+   explicit inline CompressedStream( const A1& a1, const A2& a2, const A3& a3 );
+
+   template< typename A1, typename A2, typename A3, typename A4 >
+   explicit inline CompressedStream( const A1& a1, const A2& a2, const A3& a3, const A4& a4 );
+
+   template< typename A1, typename A2, typename A3, typename A4, typename A5 >
+   explicit inline CompressedStream( const A1& a1, const A2& a2, const A3& a3, const A4& a4, const A5& a5 );
+
+   explicit inline CompressedStream( Stream& stream );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~CompressedStream();
+   //@}
+   //**********************************************************************************************
+
+   //**Operators***********************************************************************************
+   /*!\name Operators */
+   //@{
+   inline operator bool() const;
+   inline bool operator!() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Input/output functions**********************************************************************
+   /*!\name Input/output functions */
+   //@{
+   CompressedStream& write( const char_type* s, std::streamsize n );
+   CompressedStream& read ( char_type* s, std::streamsize n );
+
+   template< typename T > CompressedStream& write( const T* array, size_t count );
+   template< typename T > CompressedStream& read ( T* array, size_t count );
+
+   CompressedStream& flush();
+   //@}
+   //**********************************************************************************************
+
+   //**Configuration functions*********************************************************************
+   /*!\name Configuration functions */
+   //@{
+   inline size_t blockSize () const;
+   inline void   setBlockSize( size_t size );
+   inline int    filters   () const;
+   inline void   setFilters( int filters );
+   inline size_t threads   () const;
+   inline void   setThreads( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool good() const;
+   inline bool eof () const;
+   inline bool fail() const;
+   inline bool bad () const;
+
+   inline std::ios_base::iostate rdstate () const;
+   inline void                   setstate( std::ios_base::iostate state );
+   inline void                   clear   ( std::ios_base::iostate state = std::ios_base::goodbit );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Private constants***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   enum { lanes = 7 };                //!< Number of lanes per block.
+   enum { version = 1 };              //!< Version of the compressed stream format.
+   enum { headerSize = 8 };           //!< Size of the stream header.
+   enum { recordHeaderSize = 10 };    //!< Size of the header of each compressed block.
+   enum { stored = 0, packed = 1 };   //!< Storage modes of the compressed blocks.
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class LaneOf************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Compile time evaluation of the lane of a built-in data type.
+   //
+   // Lane 0 contains all single byte and all untyped data, lanes 1 to 3 contain 16-, 32- and
+   // 64-bit integral values, lanes 4 and 5 contain single and double precision floating point
+   // values, and lane 6 contains all remaining data types (e.g. \c long \c double). Complex
+   // values are stored in the lane of their real and imaginary parts.
+   */
+   template< typename T >
+   struct LaneOf
+   {
+      enum { value = ( IsFloatingPoint<T>::value )
+                     ?( ( sizeof(T) == 4UL )?( 4 ):( sizeof(T) == 8UL )?( 5 ):( 6 ) )
+                     :( ( sizeof(T) == 1UL )?( 0 ):( sizeof(T) == 2UL )?( 1 ):
+                        ( sizeof(T) == 4UL )?( 2 ):( sizeof(T) == 8UL )?( 3 ):( 6 ) ) };
+   };
+
+   template< typename T >
+   struct LaneOf< complex<T> > : public LaneOf<T>
+   {};
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class Block*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Uncompressed representation of a single block.
+   */
+   struct Block
+   {
+      //**Utility functions************************************************************************
+      inline void reset() {
+         for( size_t i=0UL; i<size_t(lanes); ++i ) {
+            data_[i].clear();
+            pos_[i] = 0UL;
+         }
+         size_ = 0UL;
+      }
+
+      inline bool isConsumed() const {
+         for( size_t i=0UL; i<size_t(lanes); ++i )
+            if( pos_[i] != data_[i].size() ) return false;
+         return true;
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      std::vector<uint8_t> data_[lanes];  //!< The data of the individual lanes.
+      size_t pos_[lanes];                 //!< The current read positions within the lanes.
+      size_t size_;                       //!< The total number of bytes of all lanes.
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class Record************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Compressed representation of a single block.
+   */
+   struct Record
+   {
+      std::vector<uint8_t> data_;  //!< The compressed data of the block.
+      uint32_t rawSize_;           //!< The size of the uncompressed block.
+      uint8_t  mode_;              //!< The storage mode of the block (stored or packed).
+      uint8_t  filters_;           //!< The filters applied to the lanes of the block.
+      bool     valid_;             //!< Validity flag of the decompressed block.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class Encoder***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Auxiliary functor for the threaded compression of a single block.
+   */
+   struct Encoder
+   {
+      explicit inline Encoder( const Block* block, Record* record )
+         : block_ ( block  )  // The block to be compressed
+         , record_( record )  // The resulting compressed block
+      {}
+
+      inline void operator()() const {
+         encode( *block_, *record_ );
+      }
+
+      const Block* block_;  //!< The block to be compressed.
+      Record* record_;      //!< The resulting compressed block.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class Decoder***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Auxiliary functor for the threaded decompression of a single block.
+   */
+   struct Decoder
+   {
+      explicit inline Decoder( Record* record, Block* block )
+         : record_( record )  // The compressed block
+         , block_ ( block  )  // The resulting decompressed block
+      {}
+
+      inline void operator()() const {
+         record_->valid_ = decode( *record_, *block_ );
+      }
+
+      Record* record_;  //!< The compressed block.
+      Block* block_;    //!< The resulting decompressed block.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class TaskGroup*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Auxiliary functor for the threaded execution of every n-th task of a batch.
+   */
+   template< typename Task >  // Type of the tasks
+   struct TaskGroup
+   {
+      explicit inline TaskGroup( std::vector<Task>& tasks, size_t first, size_t stride )
+         : tasks_ ( &tasks )  // The tasks of the batch
+         , first_ ( first  )  // Index of the first task of the group
+         , stride_( stride )  // The distance between two tasks of the group
+      {}
+
+      inline void operator()() const {
+         for( size_t i=first_; i<tasks_->size(); i+=stride_ ) {
+            (*tasks_)[i]();
+         }
+      }
+
+      std::vector<Task>* tasks_;  //!< The tasks of the batch.
+      size_t first_;              //!< Index of the first task of the group.
+      size_t stride_;             //!< The distance between two tasks of the group.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block functions*****************************************************************************
+   /*!\name Block functions */
+   //@{
+   void writeBytes ( size_t lane, const uint8_t* data, size_t bytes, size_t width );
+   void readBytes  ( size_t lane, uint8_t* data, size_t bytes );
+   void finishBlock();
+   void writeBatch ();
+   bool readBatch  ();
+   bool readHeader ();
+   void writeHeader();
+
+   template< typename Task >
+   void run( std::vector<Task>& tasks );
+
+   static void encode( const Block& block, Record& record );
+   static bool decode( Record& record, Block& block );
+   //@}
+   //**********************************************************************************************
+
+   //**Filter functions****************************************************************************
+   /*!\name Filter functions */
+   //@{
+   static inline size_t widthOf( size_t lane );
+
+   static void applyFilters ( uint8_t* data, size_t bytes, size_t lane, int filters, uint8_t* tmp );
+   static void revertFilters( uint8_t* data, size_t bytes, size_t lane, int filters, uint8_t* tmp );
+
+   template< typename UT >
+   static void encodeDelta( uint8_t* data, size_t count, bool isFloat );
+
+   template< typename UT >
+   static void decodeDelta( uint8_t* data, size_t count, bool isFloat );
+
+   static void shuffle  ( const uint8_t* src, uint8_t* dst, size_t bytes, size_t width );
+   static void unshuffle( const uint8_t* src, uint8_t* dst, size_t bytes, size_t width );
+   //@}
+   //**********************************************************************************************
+
+   //**Initialization functions********************************************************************
+   /*!\name Initialization functions */
+   //@{
+   static inline size_t initThreads();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   UniquePtr<Stream> ptr_;          //!< The dynamically allocated stream resource.
+   Stream& stream_;                 //!< Reference to the underlying stream.
+   std::ios_base::iostate state_;   //!< The current state of the compressed stream.
+   size_t blockSize_;               //!< The size of the uncompressed blocks in bytes.
+   int filters_;                    //!< The active compression filters.
+   size_t threads_;                 //!< The number of threads for the (de-)compression.
+   bool writing_;                   //!< Flag for an active output stream.
+   bool reading_;                   //!< Flag for an active input stream.
+   bool header_;                    //!< Flag for an already written or read stream header.
+   bool finished_;                  //!< Flag for the end of the input data.
+   std::vector<Block> blocks_;      //!< The uncompressed blocks of the current batch.
+   std::vector<Record> records_;    //!< The compressed blocks of the current batch.
+   size_t current_;                 //!< Index of the current block within the current batch.
+   size_t batch_;                   //!< Number of blocks within the current batch.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( char_type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating a compressed stream with an internal stream resource.
+*/
+template< typename Stream >  // Type of the underlying stream
+inline CompressedStream<Stream>::CompressedStream()
+   : ptr_      ( new Stream() )        // The dynamically allocated stream resource
+   , stream_   ( *ptr_.get() )         // Reference to the underlying stream
+   , state_    ( std::ios_base::goodbit )  // The current state of the compressed stream
+   , blockSize_( 1048576UL )           // The size of the uncompressed blocks in bytes
+   , filters_  ( shuffleFilter )       // The active compression filters
+   , threads_  ( initThreads() )       // The number of threads for the (de-)compression
+   , writing_  ( false )               // Flag for an active output stream
+   , reading_  ( false )               // Flag for an active input stream
+   , header_   ( false )               // Flag for an already written or read stream header
+   , finished_ ( false )               // Flag for the end of the input data
+   , blocks_   ()                      // The uncompressed blocks of the current batch
+   , records_  ()                      // The compressed blocks of the current batch
+   , current_  ( 0UL )                 // Index of the current block within the current batch
+   , batch_    ( 0UL )                 // Number of blocks within the current batch
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a compressed stream with an internal stream resource.
+//
+// \param a1 The first stream argument.
+//
+// This function creates a new compressed stream with an internal stream resource, which is
+// created based on the given argument \a a1.
+*/
+template< typename Stream >  // Type of the underlying stream
+template< typename A1 >      // Type of the first argument
+inline CompressedStream<Stream>::CompressedStream( const A1& a1 )
+   : ptr_      ( new Stream( a1 ) )    // The dynamically allocated stream resource
+   , stream_   ( *ptr_.get() )         // Reference to the underlying stream
+   , state_    ( std::ios_base::goodbit )  // The current state of the compressed stream
+   , blockSize_( 1048576UL )           // The size of the uncompressed blocks in bytes
+   , filters_  ( shuffleFilter )       // The active compression filters
+   , threads_  ( initThreads() )       // The number of threads for the (de-)compression
+   , writing_  ( false )               // Flag for an active output stream
+   , reading_  ( false )               // Flag for an active input stream
+   , header_   ( false )               // Flag for an already written or read stream header
+   , finished_ ( false )               // Flag for the end of the input data
+   , blocks_   ()                      // The uncompressed blocks of the current batch
+   , records_  ()                      // The compressed blocks of the current batch
+   , current_  ( 0UL )                 // Index of the current block within the current batch
+   , batch_    ( 0UL )                 // Number of blocks within the current batch
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a compressed stream with an internal stream resource.
+//
+// \param a1 The first stream argument.
+// \param a2 The second stream argument.
+//
+// This function creates a new compressed stream with an internal stream resource, which is
+// created based on the given arguments \a a1 and \a a2.
+*/
+template< typename Stream >  // Type of the underlying stream
+template< typename A1        // Type of the first argument
+        , typename A2 >      // Type of the second argument
+inline CompressedStream<Stream>::CompressedStream( const A1& a1, const A2& a2 )
+   : ptr_      ( new Stream( a1, a2 ) )  // The dynamically allocated stream resource
+   , stream_   ( *ptr_.get() )         // Reference to the underlying stream
+   , state_    ( std::ios_base::goodbit )  // The current state of the compressed stream
+   , blockSize_( 1048576UL )           // The size of the uncompressed blocks in bytes
+   , filters_  ( shuffleFilter )       // The active compression filters
+   , threads_  ( initThreads() )       // The number of threads for the (de-)compression
+   , writing_  ( false )               // Flag for an active output stream
+   , reading_  ( false )               // Flag for an active input stream
+   , header_   ( false )               // Flag for an already written or read stream header
+   , finished_ ( false )               // Flag for the end of the input data
+   , blocks_   ()                      // The uncompressed blocks of the current batch
+   , records_  ()                      // The compressed blocks of the current batch
+   , current_  ( 0UL )                 // Index of the current block within the current batch
+   , batch_    ( 0UL )                 // Number of blocks within the current batch
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a compressed stream with an internal stream resource.
+//
+// \param a1 The first stream argument.
+// \param a2 The second stream argument.
+// \param a3 The third stream argument.
+//
+// This function creates a new compressed stream with an internal stream resource, which is
+// created based on the given arguments \a a1, \a a2, and \a a3.
+*/
+template< typename Stream >  // Type of the underlying stream
+template< typename A1        // Type of the first argument
+        , typename A2        // Type of the second argument
+        , typename A3 >      // Type of the third argument
+inline CompressedStream<Stream>::CompressedStream( const A1& a1, const A2& a2, const A3& a3 )
+   : ptr_      ( new Stream( a1, a2, a3 ) )  // The dynamically allocated stream resource
+   , stream_   ( *ptr_.get() )         // Reference to the underlying stream
+   , state_    ( std::ios_base::goodbit )  // The current state of the compressed stream
+   , blockSize_( 1048576UL )           // The size of the uncompressed blocks in bytes
+   , filters_  ( shuffleFilter )       // The active compression filters
+   , threads_  ( initThreads() )       // The number of threads for the (de-)compression
+   , writing_  ( false )               // Flag for an active output stream
+   , reading_  ( false )               // Flag for an active input stream
+   , header_   ( false )               // Flag for an already written or read stream header
+   , finished_ ( false )               // Flag for the end of the input data
+   , blocks_   ()                      // The uncompressed blocks of the current batch
+   , records_  ()                      // The compressed blocks of the current batch
+   , current_  ( 0UL )                 // Index of the current block within the current batch
+   , batch_    ( 0UL )                 // Number of blocks within the current batch
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a compressed stream with an internal stream resource.
+//
+// \param a1 The first stream argument.
+// \param a2 The second stream argument.
+// \param a3 The third stream argument.
+// \param a4 The fourth stream argument.
+//
+// This function creates a new compressed stream with an internal stream resource, which is
+// created based on the given arguments \a a1, \a a2, \a a3, and \a a4.
+*/
+template< typename Stream >  // Type of the underlying stream
+template< typename A1        // Type of the first argument
+        , typename A2        // Type of the second argument
+        , typename A3        // Type of the third argument
+        , typename A4 >      // Type of the fourth argument
+inline CompressedStream<Stream>::CompressedStream( const A1& a1, const A2& a2, const A3& a3, const A4& a4 )
+   : ptr_      ( new Stream( a1, a2, a3, a4 ) )  // The dynamically allocated stream resource
+   , stream_   ( *ptr_.get() )         // Reference to the underlying stream
+   , state_    ( std::ios_base::goodbit )  // The current state of the compressed stream
+   , blockSize_( 1048576UL )           // The size of the uncompressed blocks in bytes
+   , filters_  ( shuffleFilter )       // The active compression filters
+   , threads_  ( initThreads() )       // The number of threads for the (de-)compression
+   , writing_  ( false )               // Flag for an active output stream
+   , reading_  ( false )               // Flag for an active input stream
+   , header_   ( false )               // Flag for an already written or read stream header
+   , finished_ ( false )               // Flag for the end of the input data
+   , blocks_   ()                      // The uncompressed blocks of the current batch
+   , records_  ()                      // The compressed blocks of the current batch
+   , current_  ( 0UL )                 // Index of the current block within the current batch
+   , batch_    ( 0UL )                 // Number of blocks within the current batch
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a compressed stream with an internal stream resource.
+//
+// \param a1 The first stream argument.
+// \param a2 The second stream argument.
+// \param a3 The third stream argument.
+// \param a4 The fourth stream argument.
+// \param a5 The fifth stream argument.
+//
+// This function creates a new compressed stream with an internal stream resource, which is
+// created based on the given arguments \a a1, \a a2, \a a3, \a a4, and \a a5.
+*/
+template< typename Stream >  // Type of the underlying stream
+template< typename A1        // Type of the first argument
+        , typename A2        // Type of the second argument
+        , typename A3        // Type of the third argument
+        , typename A4        // Type of the fourth argument
+        , typename A5 >      // Type of the fifth argument
+inline CompressedStream<Stream>::CompressedStream( const A1& a1, const A2& a2, const A3& a3, const A4& a4, const A5& a5 )
+   : ptr_      ( new Stream( a1, a2, a3, a4, a5 ) )  // The dynamically allocated stream resource
+   , stream_   ( *ptr_.get() )         // Reference to the underlying stream
+   , state_    ( std::ios_base::goodbit )  // The current state of the compressed stream
+   , blockSize_( 1048576UL )           // The size of the uncompressed blocks in bytes
+   , filters_  ( shuffleFilter )       // The active compression filters
+   , threads_  ( initThreads() )       // The number of threads for the (de-)compression
+   , writing_  ( false )               // Flag for an active output stream
+   , reading_  ( false )               // Flag for an active input stream
+   , header_   ( false )               // Flag for an already written or read stream header
+   , finished_ ( false )               // Flag for the end of the input data
+   , blocks_   ()                      // The uncompressed blocks of the current batch
+   , records_  ()                      // The compressed blocks of the current batch
+   , current_  ( 0UL )                 // Index of the current block within the current batch
+   , batch_    ( 0UL )                 // Number of blocks within the current batch
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a compressed stream bound to an external stream resource.
+//
+// \param stream The stream to be bound to the compressed stream.
+//
+// This function creates a new compressed stream, which is bound to the given external stream.
+// Note that the stream is NOT automatically closed when the compressed stream is destroyed.
+*/
+template< typename Stream >  // Type of the underlying stream
+inline CompressedStream<Stream>::CompressedStream( Stream& stream )
+   : ptr_      ()                      // The dynamically allocated stream resource
+   , stream_   ( stream )              // Reference to the underlying stream
+   , state_    ( std::ios_base::goodbit )  // The current state of the compressed stream
+   , blockSize_( 1048576UL )           // The size of the uncompressed blocks in bytes
+   , filters_  ( shuffleFilter )       // The active compression filters
+   , threads_  ( initThreads() )       // The number of threads for the (de-)compression
+   , writing_  ( false )               // Flag for an active output stream
+   , reading_  ( false )               // Flag for an active input stream
+   , header_   ( false )               // Flag for an already written or read stream header
+   , finished_ ( false )               // Flag for the end of the input data
+   , blocks_   ()                      // The uncompressed blocks of the current batch
+   , records_  ()                      // The compressed blocks of the current batch
+   , current_  ( 0UL )                 // Index of the current block within the current batch
+   , batch_    ( 0UL )                 // Number of blocks within the current batch
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor of the CompressedStream class.
+//
+// The destructor writes all remaining data to the underlying stream.
+*/
+template< typename Stream >  // Type of the underlying stream
+CompressedStream<Stream>::~CompressedStream()
+{
+   if( writing_ ) {
+      flush();
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current state of the compressed stream.
+//
+// \return \a false in case an input/output error has occurred, \a true otherwise.
+*/
+template< typename Stream >  // Type of the underlying stream
+inline CompressedStream<Stream>::operator bool() const
+{
+   return !fail();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the negated state of the compressed stream.
+//
+// \return \a true in case an input/output error has occurred, \a false otherwise.
+*/
+template< typename Stream >  // Type of the underlying stream
+inline bool CompressedStream<Stream>::operator!() const
+{
+   return fail();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INPUT/OUTPUT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writes a sequence of characters to the compressed stream.
+//
+// \param s Pointer to the first character.
+// \param n The number of characters to be written.
+// \return Reference to the compressed stream.
+//
+// This function writes \a n characters of untyped data to the compressed stream. Note that
+// untyped data is compressed without the application of any filter.
+*/
+template< typename Stream >  // Type of the underlying stream
+CompressedStream<Stream>& CompressedStream<Stream>::write( const char_type* s, std::streamsize n )
+{
+   if( n > 0 ) {
+      writeBytes( 0UL, reinterpret_cast<const uint8_t*>( s ), n*sizeof(char_type), sizeof(char_type) );
+   }
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads a sequence of characters from the compressed stream.
+//
+// \param s Pointer to the first character of the destination buffer.
+// \param n The number of characters to be read.
+// \return Reference to the compressed stream.
+//
+// This function reads \a n characters of untyped data from the compressed stream. In case
+// not enough data is available, the \a eofbit and \a failbit are set.
+*/
+template< typename Stream >  // Type of the underlying stream
+CompressedStream<Stream>& CompressedStream<Stream>::read( char_type* s, std::streamsize n )
+{
+   if( n > 0 ) {
+      readBytes( 0UL, reinterpret_cast<uint8_t*>( s ), n*sizeof(char_type) );
+   }
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes an array of built-in data values to the compressed stream.
+//
+// \param array Pointer to the first element of the array.
+// \param count The number of elements in the array.
+// \return Reference to the compressed stream.
+//
+// This function writes \a count values of the built-in data type \a T to the compressed
+// stream. The values are added to the lane of the data type \a T within the current block.
+*/
+template< typename Stream >  // Type of the underlying stream
+template< typename T >       // Type of the array elements
+CompressedStream<Stream>& CompressedStream<Stream>::write( const T* array, size_t count )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T );
+
+   if( count > 0UL ) {
+      writeBytes( LaneOf<T>::value, reinterpret_cast<const uint8_t*>( array ), count*sizeof(T), sizeof(T) );
+   }
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads an array of built-in data values from the compressed stream.
+//
+// \param array Pointer to the first element of the destination array.
+// \param count The number of elements to be read.
+// \return Reference to the compressed stream.
+//
+// This function reads \a count values of the built-in data type \a T from the compressed
+// stream. In case not enough values are available, the \a eofbit and \a failbit are set.
+// In case the current block does not contain any more values of type \a T, but still contains
+// unread values of another type (i.e. the values have been written in a different order or with
+// different types), the \a failbit is set.
+*/
+template< typename Stream >  // Type of the underlying stream
+template< typename T >       // Type of the array elements
+CompressedStream<Stream>& CompressedStream<Stream>::read( T* array, size_t count )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T );
+
+   if( count > 0UL ) {
+      readBytes( LaneOf<T>::value, reinterpret_cast<uint8_t*>( array ), count*sizeof(T) );
+   }
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes all remaining data to the underlying stream.
+//
+// \return Reference to the compressed stream.
+//
+// This function compresses the current (partially filled) block and all pending blocks and
+// writes them to the underlying stream. Note that calling this function frequently results
+// in small blocks and therefore in a reduced compression ratio.
+*/
+template< typename Stream >  // Type of the underlying stream
+CompressedStream<Stream>& CompressedStream<Stream>::flush()
+{
+   if( !writing_ || bad() )
+      return *this;
+
+   if( !header_ ) {
+      writeHeader();
+   }
+
+   if( batch_ < blocks_.size() && blocks_[batch_].size_ > 0UL ) {
+      ++batch_;
+   }
+
+   writeBatch();
+   stream_.flush();
+
+   if( stream_.fail() ) {
+      state_ |= std::ios_base::badbit;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONFIGURATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the size of the uncompressed blocks.
+//
+// \return The size of the uncompressed blocks in bytes.
+*/
+template< typename Stream >  // Type of the underlying stream
+inline size_t CompressedStream<Stream>::blockSize() const
+{
+   return blockSize_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the size of the uncompressed blocks.
+//
+// \param size The new block size in bytes \f$[1024..2^{30}]\f$.
+// \return void
+// \exception std::invalid_argument Invalid block size.
+//
+// This function sets the size of the uncompressed blocks written by the compressed stream.
+// Larger blocks result in better compression ratios, smaller blocks reduce the memory
+// requirements and improve the parallel efficiency for small archives. In case the given
+// size is not in the range \f$[1024..2^{30}]\f$, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename Stream >  // Type of the underlying stream
+inline void CompressedStream<Stream>::setBlockSize( size_t size )
+{
+   if( size < 1024UL || size > 1073741824UL )
+      throw std::invalid_argument( "Invalid block size" );
+
+   blockSize_ = size;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the active compression filters.
+//
+// \return The active compression filters.
+*/
+template< typename Stream >  // Type of the underlying stream
+inline int CompressedStream<Stream>::filters() const
+{
+   return filters_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the compression filters.
+//
+// \param filters The new compression filters (combination of \a shuffleFilter and \a deltaFilter).
+// \return void
+// \exception std::invalid_argument Invalid compression filters.
+//
+// This function sets the filters that are applied to all subsequently written blocks.
+*/
+template< typename Stream >  // Type of the underlying stream
+inline void CompressedStream<Stream>::setFilters( int filters )
+{
+   if( filters & ~( shuffleFilter | deltaFilter ) )
+      throw std::invalid_argument( "Invalid compression filters" );
+
+   filters_ = filters;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of threads used for the compression and decompression.
+//
+// \return The number of threads.
+*/
+template< typename Stream >  // Type of the underlying stream
+inline size_t CompressedStream<Stream>::threads() const
+{
+   return threads_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the number of threads used for the compression and decompression.
+//
+// \param n The new number of threads \f$[1..\infty)\f$.
+// \return void
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This function sets the number of blocks that are compressed or decompressed concurrently.
+// Note that the number of threads is additionally restricted to the number of threads available
+// for a parallel operation of the calling thread. In case the shared memory parallelization of
+// the Blaze library is deactivated or a serial section is active, all blocks are processed
+// sequentially.
+*/
+template< typename Stream >  // Type of the underlying stream
+inline void CompressedStream<Stream>::setThreads( size_t n )
+{
+   if( n == 0UL )
+      throw std::invalid_argument( "Invalid number of threads" );
+
+   if( writing_ ) {
+      flush();
+   }
+
+   if( !reading_ ) {
+      threads_ = n;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checks if no error has occurred, i.e. I/O operations are available.
+//
+// \return \a true in case no error has occurred, \a false otherwise.
+*/
+template< typename Stream >  // Type of the underlying stream
+inline bool CompressedStream<Stream>::good() const
+{
+   return state_ == std::ios_base::goodbit;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks if end-of-file (EOF) has been reached
+//
+// \return \a true in case end-of-file has been reached, \a false otherwise.
+*/
+template< typename Stream >  // Type of the underlying stream
+inline bool CompressedStream<Stream>::eof() const
+{
+   return ( state_ & std::ios_base::eofbit ) != 0;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks if a recoverable error has occurred.
+//
+// \return \a true in case a recoverable error has occurred, \a false otherwise.
+*/
+template< typename Stream >  // Type of the underlying stream
+inline bool CompressedStream<Stream>::fail() const
+{
+   return ( state_ & ( std::ios_base::failbit | std::ios_base::badbit ) ) != 0;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks if a non-recoverable error has occurred.
+//
+// \return \a true in case a non-recoverable error has occurred, \a false otherwise.
+*/
+template< typename Stream >  // Type of the underlying stream
+inline bool CompressedStream<Stream>::bad() const
+{
+   return ( state_ & std::ios_base::badbit ) != 0;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current state flags settings.
+//
+// \return The current state flags settings.
+*/
+template< typename Stream >  // Type of the underlying stream
+inline std::ios_base::iostate CompressedStream<Stream>::rdstate() const
+{
+   return state_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the state flags to a specific value.
+//
+// \param state The new error state flags setting.
+// \return void
+*/
+template< typename Stream >  // Type of the underlying stream
+inline void CompressedStream<Stream>::setstate( std::ios_base::iostate state )
+{
+   state_ |= state;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clears error and eof flags.
+//
+// \param state The new error state flags setting.
+// \return void
+*/
+template< typename Stream >  // Type of the underlying stream
+inline void CompressedStream<Stream>::clear( std::ios_base::iostate state )
+{
+   state_ = state;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCK FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Adds the given bytes to a lane of the current block.
+//
+// \param lane The index of the lane.
+// \param data Pointer to the first byte to be written.
+// \param bytes The total number of bytes to be written.
+// \param width The size of a single value in bytes.
+// \return void
+//
+// This function adds the given data to the specified lane of the current block. In case the
+// current block is full, the block is finished and a new block is started. Note that values
+// are never split between two blocks.
+*/
+template< typename Stream >  // Type of the underlying stream
+void CompressedStream<Stream>::writeBytes( size_t lane, const uint8_t* data, size_t bytes, size_t width )
+{
+   if( reading_ ) {
+      state_ |= std::ios_base::failbit;
+      return;
+   }
+
+   if( fail() )
+      return;
+
+   if( !writing_ ) {
+      writing_ = true;
+      blocks_.resize( threads_ );
+      records_.resize( threads_ );
+      for( size_t i=0UL; i<blocks_.size(); ++i )
+         blocks_[i].reset();
+      batch_ = 0UL;
+   }
+
+   while( bytes > 0UL )
+   {
+      Block& block( blocks_[batch_] );
+
+      const size_t space( ( block.size_ < blockSize_ )?( blockSize_ - block.size_ ):( 0UL ) );
+      size_t chunk( std::min( bytes, space - space % width ) );
+
+      if( chunk == 0UL ) {
+         if( block.size_ > 0UL ) {
+            finishBlock();
+            continue;
+         }
+         chunk = width;
+      }
+
+      block.data_[lane].insert( block.data_[lane].end(), data, data+chunk );
+      block.size_ += chunk;
+      data  += chunk;
+      bytes -= chunk;
+
+      if( block.size_ >= blockSize_ ) {
+         finishBlock();
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads the given number of bytes from a lane of the current block.
+//
+// \param lane The index of the lane.
+// \param data Pointer to the first byte of the destination buffer.
+// \param bytes The total number of bytes to be read.
+// \return void
+//
+// This function reads the given number of bytes from the specified lane of the current block.
+// In case the lane is exhausted, the next block is decompressed.
+*/
+template< typename Stream >  // Type of the underlying stream
+void CompressedStream<Stream>::readBytes( size_t lane, uint8_t* data, size_t bytes )
+{
+   if( writing_ ) {
+      state_ |= std::ios_base::failbit;
+      return;
+   }
+
+   if( fail() )
+      return;
+
+   if( !reading_ ) {
+      reading_ = true;
+      blocks_.resize( threads_ );
+      records_.resize( threads_ );
+      current_ = 0UL;
+      batch_   = 0UL;
+      if( !readHeader() )
+         return;
+   }
+
+   while( bytes > 0UL )
+   {
+      if( current_ < batch_ )
+      {
+         Block& block( blocks_[current_] );
+         const size_t available( block.data_[lane].size() - block.pos_[lane] );
+
+         if( available > 0UL ) {
+            const size_t chunk( std::min( bytes, available ) );
+            std::memcpy( data, &block.data_[lane][block.pos_[lane]], chunk );
+            block.pos_[lane] += chunk;
+            data  += chunk;
+            bytes -= chunk;
+            continue;
+         }
+
+         // The lane of the current block is exhausted, but the block still contains unread
+         // data of another type: the data has been written in a different order
+         if( !block.isConsumed() ) {
+            state_ |= std::ios_base::failbit;
+            return;
+         }
+
+         ++current_;
+         continue;
+      }
+
+      if( !readBatch() ) {
+         return;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Finishes the current block and starts a new one.
+//
+// \return void
+//
+// In case the current batch of blocks is complete, all blocks of the batch are compressed and
+// written to the underlying stream.
+*/
+template< typename Stream >  // Type of the underlying stream
+void CompressedStream<Stream>::finishBlock()
+{
+   ++batch_;
+
+   if( batch_ == blocks_.size() ) {
+      if( !header_ ) {
+         writeHeader();
+      }
+      writeBatch();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compresses all blocks of the current batch and writes them to the underlying stream.
+//
+// \return void
+*/
+template< typename Stream >  // Type of the underlying stream
+void CompressedStream<Stream>::writeBatch()
+{
+   std::vector<Encoder> tasks;
+   tasks.reserve( batch_ );
+
+   for( size_t i=0UL; i<batch_; ++i ) {
+      records_[i].filters_ = static_cast<uint8_t>( filters_ );
+      tasks.push_back( Encoder( &blocks_[i], &records_[i] ) );
+   }
+
+   run( tasks );
+
+   for( size_t i=0UL; i<batch_; ++i )
+   {
+      const Record& record( records_[i] );
+
+      uint8_t header[recordHeaderSize];
+      const uint32_t packedSize( static_cast<uint32_t>( record.data_.size() ) );
+      std::memcpy( header  , &record.rawSize_, sizeof( uint32_t ) );
+      std::memcpy( header+4, &packedSize     , sizeof( uint32_t ) );
+      header[8] = record.mode_;
+      header[9] = record.filters_;
+
+      stream_.write( reinterpret_cast<const char_type*>( header ), recordHeaderSize/sizeof(char_type) );
+      stream_.write( reinterpret_cast<const char_type*>( &record.data_[0] ), packedSize/sizeof(char_type) );
+
+      blocks_[i].reset();
+   }
+
+   if( stream_.fail() ) {
+      state_ |= std::ios_base::badbit;
+   }
+
+   batch_ = 0UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads and decompresses the next batch of blocks from the underlying stream.
+//
+// \return \a true in case at least one block could be read, \a false otherwise.
+*/
+template< typename Stream >  // Type of the underlying stream
+bool CompressedStream<Stream>::readBatch()
+{
+   if( finished_ ) {
+      state_ |= std::ios_base::eofbit | std::ios_base::failbit;
+      return false;
+   }
+
+   std::vector<Decoder> tasks;
+   tasks.reserve( blocks_.size() );
+
+   batch_   = 0UL;
+   current_ = 0UL;
+
+   while( batch_ < blocks_.size() )
+   {
+      uint8_t header[recordHeaderSize];
+
+      stream_.read( reinterpret_cast<char_type*>( header ), recordHeaderSize/sizeof(char_type) );
+
+      if( stream_.gcount() == 0 && stream_.eof() ) {
+         finished_ = true;
+         break;
+      }
+      else if( stream_.fail() ) {
+         state_ |= std::ios_base::badbit;
+         return false;
+      }
+
+      Record& record( records_[batch_] );
+      uint32_t packedSize;
+      std::memcpy( &record.rawSize_, header  , sizeof( uint32_t ) );
+      std::memcpy( &packedSize     , header+4, sizeof( uint32_t ) );
+      record.mode_    = header[8];
+      record.filters_ = header[9];
+
+      record.data_.resize( packedSize );
+      if( packedSize > 0U ) {
+         stream_.read( reinterpret_cast<char_type*>( &record.data_[0] ), packedSize/sizeof(char_type) );
+      }
+
+      if( stream_.fail() ) {
+         state_ |= std::ios_base::badbit;
+         return false;
+      }
+
+      tasks.push_back( Decoder( &record, &blocks_[batch_] ) );
+      ++batch_;
+   }
+
+   if( batch_ == 0UL ) {
+      state_ |= std::ios_base::eofbit | std::ios_base::failbit;
+      return false;
+   }
+
+   run( tasks );
+
+   for( size_t i=0UL; i<batch_; ++i ) {
+      if( !records_[i].valid_ ) {
+         state_ |= std::ios_base::badbit;
+         return false;
+      }
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the header of the compressed stream.
+//
+// \return void
+*/
+template< typename Stream >  // Type of the underlying stream
+void CompressedStream<Stream>::writeHeader()
+{
+   const uint8_t header[headerSize] = { 'B', 'L', 'Z', 'C', uint8_t( version ), uint8_t( lanes ), 0U, 0U };
+
+   stream_.write( reinterpret_cast<const char_type*>( header ), headerSize/sizeof(char_type) );
+
+   if( stream_.fail() ) {
+      state_ |= std::ios_base::badbit;
+   }
+
+   header_ = true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reads and validates the header of the compressed stream.
+//
+// \return \a true in case a valid header has been read, \a false otherwise.
+*/
+template< typename Stream >  // Type of the underlying stream
+bool CompressedStream<Stream>::readHeader()
+{
+   uint8_t header[headerSize];
+
+   stream_.read( reinterpret_cast<char_type*>( header ), headerSize/sizeof(char_type) );
+
+   if( stream_.fail() ) {
+      state_ |= ( stream_.eof() )?( std::ios_base::eofbit | std::ios_base::failbit )
+                                 :( std::ios_base::badbit );
+      return false;
+   }
+
+   if( header[0] != 'B' || header[1] != 'L' || header[2] != 'Z' || header[3] != 'C' ||
+       header[4] != uint8_t( version ) || header[5] != uint8_t( lanes ) ) {
+      state_ |= std::ios_base::failbit;
+      return false;
+   }
+
+   header_ = true;
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given compression or decompression tasks.
+//
+// \param tasks The tasks to be executed.
+// \return void
+//
+// This function executes the given tasks by means of the active shared memory parallelization.
+// At most as many tasks are executed concurrently as specified via the setThreads() function
+// and as threads are available for a parallel operation of the calling thread. In case of the
+// C++11 and Boost thread parallelization the tasks are scheduled via the execution context of
+// the calling thread. In case the parallelization is deactivated or a serial section is active,
+// the tasks are executed sequentially by the calling thread.
+*/
+template< typename Stream >  // Type of the underlying stream
+template< typename Task >    // Type of the tasks
+void CompressedStream<Stream>::run( std::vector<Task>& tasks )
+{
+#if BLAZE_OPENMP_PARALLEL_MODE
+   const int n( static_cast<int>( tasks.size() ) );
+   const int threads( static_cast<int>( ( isSerialSectionActive() )
+                                        ?( 1UL )
+                                        :( std::min( threads_, getAvailableThreads() ) ) ) );
+
+#pragma omp parallel for schedule(dynamic,1) num_threads(threads) if(n > 1 && threads > 1)
+   for( int i=0; i<n; ++i ) {
+      tasks[i]();
+   }
+#elif BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   if( tasks.size() > 1UL && threads_ > 1UL && !isSerialSectionActive() )
+   {
+      const TheThreadBackend::Team team;
+
+      const size_t groups( std::min( std::min( threads_, team.size() ), tasks.size() ) );
+
+      if( groups > 1UL )
+      {
+         for( size_t i=0UL; i<groups; ++i ) {
+            TheThreadBackend::context().schedule( TaskGroup<Task>( tasks, i, groups ) );
+         }
+
+         TheThreadBackend::wait();
+         return;
+      }
+   }
+
+   for( size_t i=0UL; i<tasks.size(); ++i ) {
+      tasks[i]();
+   }
+#else
+   for( size_t i=0UL; i<tasks.size(); ++i ) {
+      tasks[i]();
+   }
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compression of a single block.
+//
+// \param block The block to be compressed.
+// \param record The resulting compressed block.
+// \return void
+//
+// This function filters all lanes of the given block and compresses the concatenated lanes.
+// The uncompressed representation consists of the sizes of all lanes followed by the data of
+// all lanes. In case the compression does not reduce the size of the block, the block is
+// stored uncompressed.
+*/
+template< typename Stream >  // Type of the underlying stream
+void CompressedStream<Stream>::encode( const Block& block, Record& record )
+{
+   const size_t prefix( lanes*sizeof(uint32_t) );
+
+   std::vector<uint8_t> raw( prefix + block.size_ );
+   std::vector<uint8_t> tmp;
+
+   size_t offset( prefix );
+
+   for( size_t i=0UL; i<size_t(lanes); ++i )
+   {
+      const uint32_t bytes( static_cast<uint32_t>( block.data_[i].size() ) );
+      std::memcpy( &raw[i*sizeof(uint32_t)], &bytes, sizeof( uint32_t ) );
+
+      if( bytes == 0U ) continue;
+
+      std::memcpy( &raw[offset], &block.data_[i][0], bytes );
+
+      if( record.filters_ != noFilter && widthOf( i ) > 1UL ) {
+         tmp.resize( bytes );
+         applyFilters( &raw[offset], bytes, i, record.filters_, &tmp[0] );
+      }
+
+      offset += bytes;
+   }
+
+   record.rawSize_ = static_cast<uint32_t>( raw.size() );
+   record.data_.resize( LZCodec::bound( raw.size() ) );
+
+   const size_t size( LZCodec::compress( &raw[0], raw.size(), &record.data_[0], record.data_.size() ) );
+
+   if( size == 0UL || size >= raw.size() ) {
+      record.mode_ = stored;
+      record.data_.swap( raw );
+   }
+   else {
+      record.mode_ = packed;
+      record.data_.resize( size );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Decompression of a single block.
+//
+// \param record The compressed block.
+// \param block The resulting decompressed block.
+// \return \a true in case the block could be decompressed, \a false in case it is corrupt.
+*/
+template< typename Stream >  // Type of the underlying stream
+bool CompressedStream<Stream>::decode( Record& record, Block& block )
+{
+   const size_t prefix( lanes*sizeof(uint32_t) );
+
+   block.reset();
+
+   if( record.rawSize_ < prefix || ( record.filters_ & ~( shuffleFilter | deltaFilter ) ) )
+      return false;
+
+   std::vector<uint8_t> raw;
+
+   if( record.mode_ == stored ) {
+      if( record.data_.size() != record.rawSize_ )
+         return false;
+      raw.swap( record.data_ );
+   }
+   else if( record.mode_ == packed ) {
+      raw.resize( record.rawSize_ );
+      if( record.data_.empty() ||
+          !LZCodec::decompress( &record.data_[0], record.data_.size(), &raw[0], raw.size() ) )
+         return false;
+   }
+   else return false;
+
+   std::vector<uint8_t> tmp;
+   size_t offset( prefix );
+
+   for( size_t i=0UL; i<size_t(lanes); ++i )
+   {
+      uint32_t bytes;
+      std::memcpy( &bytes, &raw[i*sizeof(uint32_t)], sizeof( uint32_t ) );
+
+      if( bytes == 0U ) continue;
+
+      if( raw.size() - offset < bytes )
+         return false;
+
+      if( record.filters_ != noFilter && widthOf( i ) > 1UL ) {
+         tmp.resize( bytes );
+         revertFilters( &raw[offset], bytes, i, record.filters_, &tmp[0] );
+      }
+
+      block.data_[i].assign( raw.begin()+offset, raw.begin()+offset+bytes );
+      block.size_ += bytes;
+      offset += bytes;
+   }
+
+   return offset == raw.size();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FILTER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the width of the values of the given lane.
+//
+// \param lane The index of the lane.
+// \return The size of a single value in bytes (1 for untyped lanes).
+*/
+template< typename Stream >  // Type of the underlying stream
+inline size_t CompressedStream<Stream>::widthOf( size_t lane )
+{
+   const size_t widths[lanes] = { 1UL, 2UL, 4UL, 8UL, 4UL, 8UL, 1UL };
+   return widths[lane];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given filters to the data of a single lane.
+//
+// \param data Pointer to the first byte of the lane.
+// \param bytes The number of bytes of the lane.
+// \param lane The index of the lane.
+// \param filters The filters to be applied.
+// \param tmp Temporary buffer of at least \a bytes bytes.
+// \return void
+*/
+template< typename Stream >  // Type of the underlying stream
+void CompressedStream<Stream>::applyFilters( uint8_t* data, size_t bytes, size_t lane, int filters, uint8_t* tmp )
+{
+   const size_t width( widthOf( lane ) );
+   const bool isFloat( lane == 4UL || lane == 5UL );
+
+   if( filters & deltaFilter ) {
+      switch( width ) {
+         case 2UL: encodeDelta<uint16_t>( data, bytes/width, isFloat ); break;
+         case 4UL: encodeDelta<uint32_t>( data, bytes/width, isFloat ); break;
+         case 8UL: encodeDelta<uint64_t>( data, bytes/width, isFloat ); break;
+         default: break;
+      }
+   }
+
+   if( filters & shuffleFilter ) {
+      shuffle( data, tmp, bytes, width );
+      std::memcpy( data, tmp, bytes );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reverts the given filters on the data of a single lane.
+//
+// \param data Pointer to the first byte of the lane.
+// \param bytes The number of bytes of the lane.
+// \param lane The index of the lane.
+// \param filters The filters to be reverted.
+// \param tmp Temporary buffer of at least \a bytes bytes.
+// \return void
+*/
+template< typename Stream >  // Type of the underlying stream
+void CompressedStream<Stream>::revertFilters( uint8_t* data, size_t bytes, size_t lane, int filters, uint8_t* tmp )
+{
+   const size_t width( widthOf( lane ) );
+   const bool isFloat( lane == 4UL || lane == 5UL );
+
+   if( filters & shuffleFilter ) {
+      unshuffle( data, tmp, bytes, width );
+      std::memcpy( data, tmp, bytes );
+   }
+
+   if( filters & deltaFilter ) {
+      switch( width ) {
+         case 2UL: decodeDelta<uint16_t>( data, bytes/width, isFloat ); break;
+         case 4UL: decodeDelta<uint32_t>( data, bytes/width, isFloat ); break;
+         case 8UL: decodeDelta<uint64_t>( data, bytes/width, isFloat ); break;
+         default: break;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Delta encoding of an array of unaligned values.
+//
+// \param data Pointer to the first value.
+// \param count The number of values.
+// \param isFloat \a true in case of floating point values (XOR encoding), \a false otherwise.
+// \return void
+*/
+template< typename Stream >  // Type of the underlying stream
+template< typename UT >      // Unsigned type of the values
+void CompressedStream<Stream>::encodeDelta( uint8_t* data, size_t count, bool isFloat )
+{
+   UT previous( 0 ), current;
+
+   for( size_t i=0UL; i<count; ++i ) {
+      std::memcpy( &current, data+i*sizeof(UT), sizeof(UT) );
+      const UT encoded( ( isFloat )?( UT( current ^ previous ) ):( UT( current - previous ) ) );
+      std::memcpy( data+i*sizeof(UT), &encoded, sizeof(UT) );
+      previous = current;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Delta decoding of an array of unaligned values.
+//
+// \param data Pointer to the first value.
+// \param count The number of values.
+// \param isFloat \a true in case of floating point values (XOR encoding), \a false otherwise.
+// \return void
+*/
+template< typename Stream >  // Type of the underlying stream
+template< typename UT >      // Unsigned type of the values
+void CompressedStream<Stream>::decodeDelta( uint8_t* data, size_t count, bool isFloat )
+{
+   UT previous( 0 ), current;
+
+   for( size_t i=0UL; i<count; ++i ) {
+      std::memcpy( &current, data+i*sizeof(UT), sizeof(UT) );
+      previous = ( isFloat )?( UT( current ^ previous ) ):( UT( current + previous ) );
+      std::memcpy( data+i*sizeof(UT), &previous, sizeof(UT) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Byte shuffling of an array of values.
+//
+// \param src Pointer to the first byte of the values.
+// \param dst Pointer to the first byte of the destination buffer.
+// \param bytes The total number of bytes.
+// \param width The size of a single value in bytes.
+// \return void
+//
+// This function stores the i-th byte of all values consecutively in the destination buffer.
+*/
+template< typename Stream >  // Type of the underlying stream
+void CompressedStream<Stream>::shuffle( const uint8_t* src, uint8_t* dst, size_t bytes, size_t width )
+{
+   const size_t count( bytes / width );
+
+   for( size_t i=0UL; i<count; ++i ) {
+      for( size_t j=0UL; j<width; ++j ) {
+         dst[j*count+i] = src[i*width+j];
+      }
+   }
+
+   std::memcpy( dst+count*width, src+count*width, bytes-count*width );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reverts the byte shuffling of an array of values.
+//
+// \param src Pointer to the first byte of the shuffled values.
+// \param dst Pointer to the first byte of the destination buffer.
+// \param bytes The total number of bytes.
+// \param width The size of a single value in bytes.
+// \return void
+*/
+template< typename Stream >  // Type of the underlying stream
+void CompressedStream<Stream>::unshuffle( const uint8_t* src, uint8_t* dst, size_t bytes, size_t width )
+{
+   const size_t count( bytes / width );
+
+   for( size_t i=0UL; i<count; ++i ) {
+      for( size_t j=0UL; j<width; ++j ) {
+         dst[i*width+j] = src[j*count+i];
+      }
+   }
+
+   std::memcpy( dst+count*width, src+count*width, bytes-count*width );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INITIALIZATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the initial number of threads for the compression and decompression.
+//
+// \return The initial number of threads.
+//
+// This function returns the number of threads available for a parallel operation of the calling
+// thread (see the getAvailableThreads() function). In case the shared memory parallelization is
+// deactivated, the function returns 1.
+*/
+template< typename Stream >  // Type of the underlying stream
+inline size_t CompressedStream<Stream>::initThreads()
+{
+   return getAvailableThreads();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISTYPEDSTREAM SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename Stream >
+struct IsTypedStream< CompressedStream<Stream> > : public TrueType
+{
+ public:
+   //**********************************************************************************************
+   enum { value = 1 };
+   typedef TrueType  Type;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
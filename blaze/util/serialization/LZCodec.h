@@ -0,0 +1,398 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/serialization/LZCodec.h
+//  \brief Header file for the LZCodec class
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_SERIALIZATION_LZCODEC_H_
+#define _BLAZE_UTIL_SERIALIZATION_LZCODEC_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <vector>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Built-in LZ77-type block codec for the compression of serialized data.
+// \ingroup serialization
+//
+// The LZCodec class implements a fast, byte-oriented LZ77 block codec that does not depend on
+// any external compression library. The compressed representation follows the widespread LZ4
+// block layout: a sequence of tokens, each consisting of a run of literal bytes followed by a
+// back reference (offset and length) into the already decoded data. The codec favors speed
+// over compression ratio and is primarily used by the CompressedStream class to compress the
+// independent blocks of an archive:
+
+   \code
+   const std::vector<blaze::uint8_t> raw( ... );
+   std::vector<blaze::uint8_t> packed( blaze::LZCodec::bound( raw.size() ) );
+
+   const size_t packedSize( blaze::LZCodec::compress( &raw[0], raw.size(), &packed[0], packed.size() ) );
+
+   std::vector<blaze::uint8_t> unpacked( raw.size() );
+   blaze::LZCodec::decompress( &packed[0], packedSize, &unpacked[0], unpacked.size() );
+   \endcode
+
+// Note that the decompression requires the exact size of the uncompressed data. The codec does
+// not store this size itself, it has to be provided by the surrounding container format.
+*/
+class LZCodec
+{
+ private:
+   //**Private constants***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   enum { minMatch    = 4 };             //!< Minimum length of a back reference.
+   enum { lastLiterals= 5 };             //!< Number of trailing bytes that are always literals.
+   enum { matchLimit  = 12 };            //!< Minimum distance of a match start to the block end.
+   enum { maxOffset   = 65535 };         //!< Maximum distance of a back reference.
+   enum { hashLog     = 14 };            //!< Binary logarithm of the size of the hash table.
+   enum { hashSize    = 1 << hashLog };  //!< Number of entries in the hash table.
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t bound( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Compression functions***********************************************************************
+   /*!\name Compression functions */
+   //@{
+   static size_t compress  ( const uint8_t* src, size_t n, uint8_t* dst, size_t capacity );
+   static bool   decompress( const uint8_t* src, size_t n, uint8_t* dst, size_t size );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline uint32_t load32( const uint8_t* ptr );
+   static inline uint32_t hash  ( uint32_t sequence );
+   static inline uint8_t* writeLength( uint8_t* op, size_t length );
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the maximum size of the compressed representation of \a n bytes.
+//
+// \param n The number of bytes to be compressed.
+// \return The worst case size of the compressed data.
+//
+// This function returns the size of the compressed representation of \a n bytes in the worst
+// case, i.e. for incompressible data. Providing an output buffer of at least this size to the
+// compress() function guarantees a successful compression.
+*/
+inline size_t LZCodec::bound( size_t n )
+{
+   return n + n/255UL + 16UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned load of four consecutive bytes.
+//
+// \param ptr Pointer to the first of the four bytes.
+// \return The four bytes as 32-bit integer in native byte order.
+*/
+inline uint32_t LZCodec::load32( const uint8_t* ptr )
+{
+   uint32_t value;
+   std::memcpy( &value, ptr, sizeof( uint32_t ) );
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplicative hash of a four byte sequence.
+//
+// \param sequence The four byte sequence to be hashed.
+// \return The position of the sequence in the hash table.
+*/
+inline uint32_t LZCodec::hash( uint32_t sequence )
+{
+   return ( sequence * 2654435761U ) >> ( 32 - hashLog );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Writes the extension bytes of a literal or match length.
+//
+// \param op The current output position.
+// \param length The remaining length beyond the four bits stored in the token.
+// \return The new output position.
+*/
+inline uint8_t* LZCodec::writeLength( uint8_t* op, size_t length )
+{
+   while( length >= 255UL ) {
+      *op++ = 255U;
+      length -= 255UL;
+   }
+   *op++ = static_cast<uint8_t>( length );
+   return op;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPRESSION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compression of a block of bytes.
+//
+// \param src Pointer to the first byte to be compressed.
+// \param n The number of bytes to be compressed.
+// \param dst Pointer to the output buffer.
+// \param capacity The size of the output buffer.
+// \return The size of the compressed data, 0 in case the output buffer is too small.
+//
+// This function compresses the \a n bytes starting at \a src and writes the compressed
+// representation to the output buffer \a dst. In case \a capacity is at least bound(n), the
+// compression is guaranteed to succeed. Otherwise the function returns 0 in case the compressed
+// data does not fit into the output buffer.
+*/
+inline size_t LZCodec::compress( const uint8_t* src, size_t n, uint8_t* dst, size_t capacity )
+{
+   const uint8_t* const iend  ( src + n );
+   const uint8_t* const mflimit( ( n > size_t( matchLimit ) )?( iend - matchLimit ):( src ) );
+   const uint8_t* const mlimit ( iend - lastLiterals );
+   uint8_t* const oend( dst + capacity );
+
+   const uint8_t* ip    ( src );
+   const uint8_t* anchor( src );
+   uint8_t* op( dst );
+
+   std::vector<uint32_t> table( hashSize, 0U );
+
+   if( n > size_t( matchLimit ) )
+   {
+      ++ip;
+
+      while( ip < mflimit )
+      {
+         // Searching for the next match
+         const uint32_t sequence( load32( ip ) );
+         const uint32_t h( hash( sequence ) );
+         const uint8_t* ref( src + table[h] );
+         table[h] = static_cast<uint32_t>( ip - src );
+
+         if( ref >= ip || size_t( ip - ref ) > size_t( maxOffset ) || load32( ref ) != sequence ) {
+            ++ip;
+            continue;
+         }
+
+         // Extending the match backwards
+         while( ip > anchor && ref > src && ip[-1] == ref[-1] ) {
+            --ip;
+            --ref;
+         }
+
+         // Extending the match forwards
+         const uint8_t* mp( ip + minMatch );
+         const uint8_t* rp( ref + minMatch );
+         while( mp < mlimit && *mp == *rp ) {
+            ++mp;
+            ++rp;
+         }
+
+         const size_t literals( ip - anchor );
+         const size_t length  ( mp - ip - minMatch );
+
+         if( op + 1UL + literals + literals/255UL + 3UL + length/255UL + 1UL > oend )
+            return 0UL;
+
+         // Encoding the token, the literals, and the back reference
+         uint8_t* token( op++ );
+         *token = static_cast<uint8_t>( ( ( literals < 15UL )?( literals ):( 15UL ) ) << 4 );
+         if( literals >= 15UL )
+            op = writeLength( op, literals - 15UL );
+         std::memcpy( op, anchor, literals );
+         op += literals;
+
+         const size_t offset( ip - ref );
+         *op++ = static_cast<uint8_t>( offset & 0xFF );
+         *op++ = static_cast<uint8_t>( offset >> 8 );
+
+         *token |= static_cast<uint8_t>( ( length < 15UL )?( length ):( 15UL ) );
+         if( length >= 15UL )
+            op = writeLength( op, length - 15UL );
+
+         ip = anchor = mp;
+
+         if( ip < mflimit ) {
+            table[hash( load32( ip-2 ) )] = static_cast<uint32_t>( ip - 2 - src );
+         }
+      }
+   }
+
+   // Encoding the trailing literals
+   const size_t literals( iend - anchor );
+
+   if( op + 1UL + literals + literals/255UL + 1UL > oend )
+      return 0UL;
+
+   *op++ = static_cast<uint8_t>( ( ( literals < 15UL )?( literals ):( 15UL ) ) << 4 );
+   if( literals >= 15UL )
+      op = writeLength( op, literals - 15UL );
+   std::memcpy( op, anchor, literals );
+   op += literals;
+
+   return static_cast<size_t>( op - dst );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Decompression of a block of bytes.
+//
+// \param src Pointer to the first byte of the compressed data.
+// \param n The size of the compressed data.
+// \param dst Pointer to the output buffer.
+// \param size The exact size of the decompressed data.
+// \return \a true in case the decompression succeeded, \a false if the data is corrupt.
+//
+// This function decompresses the \a n bytes of compressed data starting at \a src into the
+// output buffer \a dst, which is expected to provide storage for exactly \a size bytes. All
+// accesses are checked, i.e. corrupt input data results in a return value of \a false but
+// never in an access outside of the given buffers.
+*/
+inline bool LZCodec::decompress( const uint8_t* src, size_t n, uint8_t* dst, size_t size )
+{
+   const uint8_t* const iend( src + n );
+   uint8_t* const oend( dst + size );
+
+   const uint8_t* ip( src );
+   uint8_t* op( dst );
+
+   while( ip < iend )
+   {
+      const uint8_t token( *ip++ );
+
+      // Decoding the literals
+      size_t literals( token >> 4 );
+      if( literals == 15UL ) {
+         uint8_t s;
+         do {
+            if( ip == iend ) return false;
+            s = *ip++;
+            literals += s;
+         } while( s == 255U );
+      }
+
+      if( size_t( iend - ip ) < literals || size_t( oend - op ) < literals )
+         return false;
+
+      std::memcpy( op, ip, literals );
+      ip += literals;
+      op += literals;
+
+      // The last sequence consists of literals only
+      if( ip == iend )
+         break;
+
+      // Decoding the back reference
+      if( iend - ip < 2 ) return false;
+      const size_t offset( size_t( ip[0] ) | ( size_t( ip[1] ) << 8 ) );
+      ip += 2;
+
+      if( offset == 0UL || size_t( op - dst ) < offset )
+         return false;
+
+      size_t length( token & 15U );
+      if( length == 15UL ) {
+         uint8_t s;
+         do {
+            if( ip == iend ) return false;
+            s = *ip++;
+            length += s;
+         } while( s == 255U );
+      }
+      length += minMatch;
+
+      if( size_t( oend - op ) < length )
+         return false;
+
+      // Copying the match byte by byte to correctly handle overlapping references
+      const uint8_t* ref( op - offset );
+      for( size_t i=0UL; i<length; ++i ) {
+         op[i] = ref[i];
+      }
+      op += length;
+   }
+
+   return op == oend;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
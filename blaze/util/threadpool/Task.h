@@ -1,7 +1,7 @@
 //=================================================================================================
 /*!
 //  \file blaze/util/threadpool/Task.h
-//  \brief Header file for the Task base class
+//  \brief Header file for the Task class
 //
 //  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
 //
@@ -32,6 +32,7 @@
 */
 //=================================================================================================
 
+
 #ifndef _BLAZE_UTIL_THREADPOOL_TASK_H_
 #define _BLAZE_UTIL_THREADPOOL_TASK_H_
 
@@ -40,7 +41,10 @@
 // Includes
 //*************************************************************************************************
 
-#include <boost/function.hpp>
+#include <new>
+#include <blaze/util/Assert.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -49,15 +53,407 @@ namespace threadpool {
 
 //=================================================================================================
 //
-//  TYPE DEFINITIONS
+//  CLASS DEFINITION
 //
 //=================================================================================================
 
 //*************************************************************************************************
 /*!\brief Handle for a single, executable task.
 // \ingroup threads
+//
+// The Task class represents a zero argument function/functor of arbitrary type that is scheduled
+// for execution by a thread pool. In contrast to a \c boost::function or \c std::function, the
+// Task class stores functors of up to \a storageSize bytes within its own storage, i.e. creating
+// and copying a task does not involve any dynamic memory allocation. Only larger functors are
+// stored on the heap. A default constructed task is empty and must not be executed.
+*/
+class Task
+{
+ public:
+   //**Constants***********************************************************************************
+   //! The number of bytes available for functors without dynamic memory allocation.
+   enum { storageSize = 384 };
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   /*!\brief Suitably aligned raw storage for a functor.
+   */
+   union Storage
+   {
+      char        bytes[storageSize];  //!< The raw bytes of the storage.
+      long double ld;                  //!< Alignment of long double.
+      double      d;                   //!< Alignment of double.
+      void*       ptr;                 //!< Alignment of pointers and handle for large functors.
+   };
+   //**********************************************************************************************
+
+   //**Private class Handler***********************************************************************
+   /*!\brief Management of a functor within the storage of a task.
+   */
+   template< typename Callable                      // Type of the function/functor
+           , bool Fits = ( sizeof(Callable) <= sizeof(Storage) &&
+                           static_cast<size_t>( AlignmentOf<Callable>::value ) <=
+                           static_cast<size_t>( AlignmentOf<Storage>::value ) ) >
+   struct Handler
+   {
+      static inline Callable* get( Storage& s ) {
+         return reinterpret_cast<Callable*>( s.bytes );
+      }
+      static void create( Storage& to, const Callable& func ) {
+         ::new( to.bytes ) Callable( func );
+      }
+      static void copy( const Storage& from, Storage& to ) {
+         create( to, *reinterpret_cast<const Callable*>( from.bytes ) );
+      }
+      static void move( Storage& from, Storage& to ) {
+         create( to, *get( from ) );
+         destroy( from );
+      }
+      static void destroy( Storage& s ) {
+         get( s )->~Callable();
+      }
+      static void invoke( Storage& s ) {
+         (*get( s ))();
+      }
+   };
+   //**********************************************************************************************
+
+   //**Private class Handler (large functors)******************************************************
+   /*!\brief Management of a functor exceeding the storage of a task.
+   */
+   template< typename Callable >  // Type of the function/functor
+   struct Handler<Callable,false>
+   {
+      static inline Callable* get( Storage& s ) {
+         return static_cast<Callable*>( s.ptr );
+      }
+      static void create( Storage& to, const Callable& func ) {
+         to.ptr = new Callable( func );
+      }
+      static void copy( const Storage& from, Storage& to ) {
+         create( to, *static_cast<const Callable*>( from.ptr ) );
+      }
+      static void move( Storage& from, Storage& to ) {
+         to.ptr = from.ptr;
+      }
+      static void destroy( Storage& s ) {
+         delete get( s );
+      }
+      static void invoke( Storage& s ) {
+         (*get( s ))();
+      }
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline Task();
+
+   template< typename Callable >
+   explicit inline Task( const Callable& func );
+
+   inline Task( const Task& task );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~Task();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline Task& operator=( const Task& task );
+   //@}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\name Function call operator */
+   //@{
+   inline void operator()();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline bool isEmpty() const;
+   inline void reset  ();
+   inline void swap   ( Task& task ) /* throw() */;
+
+   template< typename Callable >
+   inline void assign( const Callable& func );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   void (*invoke_ )( Storage& );                  //!< Execution function of the functor.
+   void (*copy_   )( const Storage&, Storage& );  //!< Copy function of the functor.
+   void (*move_   )( Storage&, Storage& );        //!< Move function of the functor.
+   void (*destroy_)( Storage& );                  //!< Destruction function of the functor.
+   Storage storage_;                              //!< Storage of the functor.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for an empty task.
+*/
+inline Task::Task()
+   : invoke_ ( 0 )  // Execution function of the functor
+   , copy_   ( 0 )  // Copy function of the functor
+   , move_   ( 0 )  // Move function of the functor
+   , destroy_( 0 )  // Destruction function of the functor
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a task executing the given zero argument function/functor.
+//
+// \param func The function/functor to be executed.
+*/
+template< typename Callable >  // Type of the function/functor
+inline Task::Task( const Callable& func )
+   : invoke_ ( 0 )  // Execution function of the functor
+   , copy_   ( 0 )  // Copy function of the functor
+   , move_   ( 0 )  // Move function of the functor
+   , destroy_( 0 )  // Destruction function of the functor
+{
+   assign( func );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for Task.
+//
+// \param task The task to be copied.
+*/
+inline Task::Task( const Task& task )
+   : invoke_ ( task.invoke_  )  // Execution function of the functor
+   , copy_   ( task.copy_    )  // Copy function of the functor
+   , move_   ( task.move_    )  // Move function of the functor
+   , destroy_( task.destroy_ )  // Destruction function of the functor
+{
+   if( copy_ )
+      copy_( task.storage_, storage_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for Task.
+*/
+inline Task::~Task()
+{
+   reset();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for Task.
+//
+// \param task The task to be copied.
+// \return Reference to the assigned task.
+*/
+inline Task& Task::operator=( const Task& task )
+{
+   Task tmp( task );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUNCTION CALL OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Executes the function/functor of the task.
+//
+// \return void
+*/
+inline void Task::operator()()
+{
+   BLAZE_INTERNAL_ASSERT( !isEmpty(), "Execution of an empty task detected" );
+
+   invoke_( storage_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the task is empty.
+//
+// \return \a true if the task is empty, \a false if it is not.
+*/
+inline bool Task::isEmpty() const
+{
+   return invoke_ == 0;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destroys the function/functor of the task.
+//
+// \return void
+*/
+inline void Task::reset()
+{
+   if( destroy_ )
+      destroy_( storage_ );
+
+   invoke_  = 0;
+   copy_    = 0;
+   move_    = 0;
+   destroy_ = 0;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two tasks.
+//
+// \param task The task to be swapped.
+// \return void
+// \exception no-throw guarantee.
+//
+// Note that the functors are required to provide a no-throw copy constructor.
+*/
+inline void Task::swap( Task& task ) /* throw() */
+{
+   if( this == &task )
+      return;
+
+   Storage tmp;
+
+   if( move_ )
+      move_( storage_, tmp );
+   if( task.move_ )
+      task.move_( task.storage_, storage_ );
+   if( move_ )
+      move_( tmp, task.storage_ );
+
+   void (*invoke )( Storage& )                 ( invoke_  );
+   void (*copy   )( const Storage&, Storage& ) ( copy_    );
+   void (*move   )( Storage&, Storage& )       ( move_    );
+   void (*destroy)( Storage& )                 ( destroy_ );
+
+   invoke_  = task.invoke_;
+   copy_    = task.copy_;
+   move_    = task.move_;
+   destroy_ = task.destroy_;
+
+   task.invoke_  = invoke;
+   task.copy_    = copy;
+   task.move_    = move;
+   task.destroy_ = destroy;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Replaces the function/functor of the task.
+//
+// \param func The new function/functor to be executed.
+// \return void
+*/
+template< typename Callable >  // Type of the function/functor
+inline void Task::assign( const Callable& func )
+{
+   typedef Handler<Callable>  H;
+
+   reset();
+
+   H::create( storage_, func );
+
+   invoke_  = &H::invoke;
+   copy_    = &H::copy;
+   move_    = &H::move;
+   destroy_ = &H::destroy;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Task operators */
+//@{
+inline void swap( Task& a, Task& b ) /* throw() */;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two tasks.
+//
+// \param a The first task to be swapped.
+// \param b The second task to be swapped.
+// \return void
+// \exception no-throw guarantee.
 */
-typedef boost::function<void(void)>  Task;
+inline void swap( Task& a, Task& b ) /* throw() */
+{
+   a.swap( b );
+}
 //*************************************************************************************************
 
 } // namespace threadpool
@@ -32,6 +32,7 @@
 */
 //=================================================================================================
 
+
 #ifndef _BLAZE_UTIL_THREADPOOL_TASKQUEUE_H_
 #define _BLAZE_UTIL_THREADPOOL_TASKQUEUE_H_
 
@@ -40,8 +41,11 @@
 // Includes
 //*************************************************************************************************
 
-#include <deque>
+#include <cstddef>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/threadpool/Counter.h>
 #include <blaze/util/threadpool/Task.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -59,24 +63,43 @@ namespace threadpool {
 // \ingroup threads
 //
 // The TaskQueue class represents the internal task container of a thread pool. It uses a FIFO
-// (first in, first out) strategy to store and remove the assigned tasks.
+// (first in, first out) strategy to store and remove the assigned tasks. The queue is a bounded
+// ring buffer that can be accessed concurrently by any number of threads without locking (see
+// D. Vyukov: "Bounded MPMC queue"). Every slot of the ring buffer carries a sequence number,
+// which indicates whether the slot is ready to be filled or to be emptied in the current round.
+// Threads claim a slot by atomically incrementing the according position counter. Since the
+// tasks are stored within the preallocated slots, neither adding nor removing a task involves
+// any dynamic memory allocation. In case the queue is full, push() fails and the task has to be
+// handled by the caller.
 */
-class TaskQueue
+class TaskQueue : private NonCopyable
 {
  private:
-   //**Type definitions****************************************************************************
-   typedef std::deque<Task>  Tasks;  //!< FIFO container for tasks.
+   //**Compilation flags***************************************************************************
+   enum { cacheLineSize = 64 };  //!< Assumed size of a cache line in bytes.
+   //**********************************************************************************************
+
+   //**Private class Cell**************************************************************************
+   /*!\brief A single slot of the ring buffer.
+   */
+   struct Cell : private NonCopyable
+   {
+      inline Cell() : sequence_( 0UL ), task_() {}
+
+      Counter sequence_;  //!< The sequence number of the slot.
+      Task    task_;      //!< The task stored in the slot.
+   };
    //**********************************************************************************************
 
  public:
    //**Type definitions****************************************************************************
-   typedef Tasks::size_type  SizeType;  //!< Size type of the task queue.
+   typedef size_t  SizeType;  //!< Size type of the task queue.
    //**********************************************************************************************
 
    //**Constructor*********************************************************************************
    /*!\name Constructor */
    //@{
-   explicit inline TaskQueue();
+   explicit inline TaskQueue( size_t capacity );
    //@}
    //**********************************************************************************************
 
@@ -90,7 +113,7 @@ class TaskQueue
    //**Get functions*******************************************************************************
    /*!\name Get functions */
    //@{
-   inline SizeType maxSize()  const;
+   inline SizeType capacity() const;
    inline SizeType size()     const;
    inline bool     isEmpty()  const;
    //@}
@@ -99,16 +122,11 @@ class TaskQueue
    //**Element functions***************************************************************************
    /*!\name Element functions */
    //@{
-   inline void push ( Task task );
-   inline Task pop  ();
-   inline void clear();
-   //@}
-   //**********************************************************************************************
+   template< typename Callable >
+   inline bool push( const Callable& func );
 
-   //**Utility functions***************************************************************************
-   /*!\name Utility functions */
-   //@{
-   inline void swap( TaskQueue& tq ) /* throw() */;
+   inline bool pop  ( Task& task );
+   inline void clear();
    //@}
    //**********************************************************************************************
 
@@ -116,7 +134,13 @@ class TaskQueue
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   Tasks tasks_;  //!< FIFO container for the contained tasks.
+   Cell*   cells_;                    //!< The slots of the ring buffer.
+   size_t  mask_;                     //!< Bit mask for the mapping of positions to slots.
+   char    padding1_[cacheLineSize];  //!< Padding to avoid false sharing.
+   Counter enqueue_;                  //!< The position of the next task to be added.
+   char    padding2_[cacheLineSize];  //!< Padding to avoid false sharing.
+   Counter dequeue_;                  //!< The position of the next task to be removed.
+   char    padding3_[cacheLineSize];  //!< Padding to avoid false sharing.
    //@}
    //**********************************************************************************************
 };
@@ -132,11 +156,28 @@ class TaskQueue
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief Default constructor for TaskQueue.
+/*!\brief Constructor for TaskQueue.
+//
+// \param capacity The minimum number of tasks the queue is able to store.
+//
+// The capacity of the queue is rounded up to the next power of two (but at least 2).
 */
-inline TaskQueue::TaskQueue()
-   : tasks_()  // FIFO container for the contained tasks
-{}
+inline TaskQueue::TaskQueue( size_t capacity )
+   : cells_  ( 0 )    // The slots of the ring buffer
+   , mask_   ( 1UL )  // Bit mask for the mapping of positions to slots
+   , enqueue_( 0UL )  // The position of the next task to be added
+   , dequeue_( 0UL )  // The position of the next task to be removed
+{
+   while( mask_ + 1UL < capacity ) {
+      mask_ = ( mask_ << 1 ) | 1UL;
+   }
+
+   cells_ = new Cell[mask_+1UL];
+
+   for( size_t i=0UL; i<=mask_; ++i ) {
+      cells_[i].sequence_.store( i );
+   }
+}
 //*************************************************************************************************
 
 
@@ -153,9 +194,9 @@ inline TaskQueue::TaskQueue()
 //
 // The destructor destroys any remaining task in the task queue.
 */
-TaskQueue::~TaskQueue()
+inline TaskQueue::~TaskQueue()
 {
-   clear();
+   delete[] cells_;
 }
 //*************************************************************************************************
 
@@ -169,13 +210,13 @@ TaskQueue::~TaskQueue()
 //=================================================================================================
 
 //*************************************************************************************************
-/*!\brief Returns the maximum possible size of a task queue.
+/*!\brief Returns the maximum number of tasks the queue is able to store.
 //
-// \return The maximum possible size.
+// \return The capacity of the task queue.
 */
-inline TaskQueue::SizeType TaskQueue::maxSize() const
+inline TaskQueue::SizeType TaskQueue::capacity() const
 {
-   return tasks_.max_size();
+   return mask_ + 1UL;
 }
 //*************************************************************************************************
 
@@ -185,11 +226,15 @@ inline TaskQueue::SizeType TaskQueue::maxSize() const
 //
 // \return The current size.
 //
-// This function returns the number of the currently contained tasks.
+// This function returns the number of the currently contained tasks. Note that in case other
+// threads concurrently add or remove tasks, the returned value is only a snapshot.
 */
 inline TaskQueue::SizeType TaskQueue::size() const
 {
-   return tasks_.size();
+   const size_t dequeue( dequeue_.load() );
+   const size_t enqueue( enqueue_.load() );
+
+   return ( enqueue > dequeue )?( enqueue - dequeue ):( 0UL );
 }
 //*************************************************************************************************
 
@@ -201,7 +246,7 @@ inline TaskQueue::SizeType TaskQueue::size() const
 */
 inline bool TaskQueue::isEmpty() const
 {
-   return tasks_.empty();
+   return size() == 0UL;
 }
 //*************************************************************************************************
 
@@ -217,28 +262,83 @@ inline bool TaskQueue::isEmpty() const
 //*************************************************************************************************
 /*!\brief Adding a task to the end of the task queue.
 //
-// \param task The task to be added to the end of the task queue.
-// \return void
+// \param func The function/functor to be added to the end of the task queue.
+// \return \a true if the task has been added, \a false if the task queue is full.
 //
-// This function adds the given task to the end of the task queue. It runs in constant time.
+// This function adds the given function/functor to the end of the task queue. The function
+// is lock-free and does not allocate memory unless the functor exceeds the storage of a task.
 */
-inline void TaskQueue::push( Task task )
+template< typename Callable >  // Type of the function/functor
+inline bool TaskQueue::push( const Callable& func )
 {
-   tasks_.push_back( task );
+   size_t pos( enqueue_.load() );
+   Cell* cell( 0 );
+
+   while( true )
+   {
+      cell = cells_ + ( pos & mask_ );
+
+      const size_t    sequence( cell->sequence_.load() );
+      const ptrdiff_t diff( static_cast<ptrdiff_t>( sequence ) - static_cast<ptrdiff_t>( pos ) );
+
+      if( diff == 0 ) {
+         if( enqueue_.compare_exchange_weak( pos, pos+1UL ) )
+            break;
+      }
+      else if( diff < 0 ) {
+         return false;
+      }
+      else {
+         pos = enqueue_.load();
+      }
+   }
+
+   cell->task_.assign( func );
+   cell->sequence_.store( pos+1UL );
+
+   return true;
 }
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-/*!\brief Returns the task from the front of the task queue.
+/*!\brief Removes the task from the front of the task queue.
 //
-// \return The first task in the task queue.
+// \param task The task to be set to the first task in the task queue.
+// \return \a true if a task has been removed, \a false if the task queue is empty.
+//
+// This function is lock-free and does not allocate memory.
 */
-inline Task TaskQueue::pop()
+inline bool TaskQueue::pop( Task& task )
 {
-   const Task task( tasks_.front() );
-   tasks_.pop_front();
-   return task;
+   size_t pos( dequeue_.load() );
+   Cell* cell( 0 );
+
+   while( true )
+   {
+      cell = cells_ + ( pos & mask_ );
+
+      const size_t    sequence( cell->sequence_.load() );
+      const ptrdiff_t diff( static_cast<ptrdiff_t>( sequence ) -
+                            static_cast<ptrdiff_t>( pos+1UL ) );
+
+      if( diff == 0 ) {
+         if( dequeue_.compare_exchange_weak( pos, pos+1UL ) )
+            break;
+      }
+      else if( diff < 0 ) {
+         return false;
+      }
+      else {
+         pos = dequeue_.load();
+      }
+   }
+
+   task.reset();
+   task.swap( cell->task_ );
+   cell->sequence_.store( pos+mask_+1UL );
+
+   return true;
 }
 //*************************************************************************************************
 
@@ -250,60 +350,8 @@ inline Task TaskQueue::pop()
 */
 inline void TaskQueue::clear()
 {
-   tasks_.clear();
-}
-//*************************************************************************************************
-
-
-
-
-//=================================================================================================
-//
-//  UTILITY FUNCTIONS
-//
-//=================================================================================================
-
-//*************************************************************************************************
-/*!\brief Swapping the contents of two task queues.
-//
-// \param tq The task queue to be swapped.
-// \return void
-// \exception no-throw guarantee.
-*/
-inline void TaskQueue::swap( TaskQueue& tq ) /* throw() */
-{
-   tasks_.swap( tq.tasks_ );
-}
-//*************************************************************************************************
-
-
-
-
-//=================================================================================================
-//
-//  GLOBAL OPERATORS
-//
-//=================================================================================================
-
-//*************************************************************************************************
-/*!\name TaskQueue operators */
-//@{
-inline void swap( TaskQueue& a, TaskQueue& b ) /* throw() */;
-//@}
-//*************************************************************************************************
-
-
-//*************************************************************************************************
-/*!\brief Swapping the contents of two task queues.
-//
-// \param a The first task queue to be swapped.
-// \param b The second task queue to be swapped.
-// \return void
-// \exception no-throw guarantee.
-*/
-inline void swap( TaskQueue& a, TaskQueue& b ) /* throw() */
-{
-   a.swap( b );
+   Task task;
+   while( pop( task ) ) {}
 }
 //*************************************************************************************************
 
@@ -311,5 +359,4 @@ inline void swap( TaskQueue& a, TaskQueue& b ) /* throw() */
 
 } // namespace blaze
 
-
 #endif
@@ -57,6 +57,7 @@ namespace blaze {
 /*!\name Blaze kernel functions */
 //@{
 double mat3mat3mult( size_t N, size_t steps );
+double mat3mat3mult_batch( size_t N, size_t steps );
 //@}
 //*************************************************************************************************
 
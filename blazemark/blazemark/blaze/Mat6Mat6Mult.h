@@ -57,6 +57,7 @@ namespace blaze {
 /*!\name Blaze kernel functions */
 //@{
 double mat6mat6mult( size_t N, size_t steps );
+double mat6mat6mult_batch( size_t N, size_t steps );
 //@}
 //*************************************************************************************************
 
@@ -57,6 +57,7 @@ namespace blaze {
 /*!\name Blaze kernel functions */
 //@{
 double smatdvecmult( size_t N, size_t F, size_t steps );
+double smatdvecmult_sell( size_t N, size_t F, size_t steps );
 //@}
 //*************************************************************************************************
 
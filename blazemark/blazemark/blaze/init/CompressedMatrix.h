@@ -61,14 +61,14 @@ namespace blaze {
 //*************************************************************************************************
 /*!\name Blaze initialization functions */
 //@{
-template< typename Type >
-void init( ::blaze::CompressedMatrix<Type,::blaze::rowMajor>& m, size_t nonzeros );
+template< typename Type, typename IT >
+void init( ::blaze::CompressedMatrix<Type,::blaze::rowMajor,IT>& m, size_t nonzeros );
 
-template< typename Type >
-void init( ::blaze::CompressedMatrix<Type,::blaze::columnMajor>& m, size_t nonzeros );
+template< typename Type, typename IT >
+void init( ::blaze::CompressedMatrix<Type,::blaze::columnMajor,IT>& m, size_t nonzeros );
 
-template< typename Type, bool SO >
-void init( ::std::vector< ::blaze::CompressedMatrix<Type,SO> >& v, size_t nonzeros );
+template< typename Type, bool SO, typename IT >
+void init( ::std::vector< ::blaze::CompressedMatrix<Type,SO,IT> >& v, size_t nonzeros );
 //@}
 //*************************************************************************************************
 
@@ -84,8 +84,9 @@ void init( ::std::vector< ::blaze::CompressedMatrix<Type,SO> >& v, size_t nonzer
 // Each row will be filled with \a nonzeros non-zero elements, whose indices are randomly
 // determined.
 */
-template< typename Type >  // Data type of the matrix
-void init( ::blaze::CompressedMatrix<Type,::blaze::rowMajor>& m, size_t nonzeros )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+void init( ::blaze::CompressedMatrix<Type,::blaze::rowMajor,IT>& m, size_t nonzeros )
 {
    const size_t M( m.rows()    );
    const size_t N( m.columns() );
@@ -133,8 +134,9 @@ void init( ::blaze::CompressedMatrix<Type,::blaze::rowMajor>& m, size_t nonzeros
 // Each column will be filled with \a nonzeros non-zero elements, whose indices are randomly
 // determined.
 */
-template< typename Type >  // Data type of the matrix
-void init( ::blaze::CompressedMatrix<Type,::blaze::columnMajor>& m, size_t nonzeros )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+void init( ::blaze::CompressedMatrix<Type,::blaze::columnMajor,IT>& m, size_t nonzeros )
 {
    const size_t M( m.rows()    );
    const size_t N( m.columns() );
@@ -183,8 +185,9 @@ void init( ::blaze::CompressedMatrix<Type,::blaze::columnMajor>& m, size_t nonze
 // randomly determined.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-void init( ::std::vector< ::blaze::CompressedMatrix<Type,SO> >& v, size_t nonzeros )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void init( ::std::vector< ::blaze::CompressedMatrix<Type,SO,IT> >& v, size_t nonzeros )
 {
    const size_t size( v.size() );
 
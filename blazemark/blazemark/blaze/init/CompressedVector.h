@@ -60,11 +60,11 @@ namespace blaze {
 //*************************************************************************************************
 /*!\name Blaze initialization functions */
 //@{
-template< typename Type, bool TF >
-void init( ::blaze::CompressedVector<Type,TF>& v, size_t nonzeros );
+template< typename Type, bool TF, typename IT >
+void init( ::blaze::CompressedVector<Type,TF,IT>& v, size_t nonzeros );
 
-template< typename Type, bool TF >
-void init( ::std::vector< ::blaze::CompressedVector<Type,TF> >& v, size_t nonzeros );
+template< typename Type, bool TF, typename IT >
+void init( ::std::vector< ::blaze::CompressedVector<Type,TF,IT> >& v, size_t nonzeros );
 //@}
 //*************************************************************************************************
 
@@ -80,8 +80,9 @@ void init( ::std::vector< ::blaze::CompressedVector<Type,TF> >& v, size_t nonzer
 // be filled with \a nonzeros non-zero elements, whose indices will be randomly determined.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-void init( ::blaze::CompressedVector<Type,TF>& v, size_t nonzeros )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+void init( ::blaze::CompressedVector<Type,TF,IT>& v, size_t nonzeros )
 {
    const size_t N( v.size() );
 
@@ -105,8 +106,9 @@ void init( ::blaze::CompressedVector<Type,TF>& v, size_t nonzeros )
 // be randomly determined.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-void init( ::std::vector< ::blaze::CompressedVector<Type,TF> >& v, size_t nonzeros )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+void init( ::std::vector< ::blaze::CompressedVector<Type,TF,IT> >& v, size_t nonzeros )
 {
    const size_t size( v.size() );
 
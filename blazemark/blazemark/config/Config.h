@@ -109,6 +109,27 @@ const size_t seed( 128753984 );  //!< Seed for the random number generator.
 
 
 
+//=================================================================================================
+//
+//  BLAZE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Index data type for the Blaze sparse matrices and vectors.
+//
+// This type definition offers the possibility to specify the index type for the sparse matrices
+// and vectors in all Blaze benchmarks. Possible settings are all unsigned integral types that
+// can represent all indices of the benchmarked sparse matrices and vectors. The default setting
+// is \a unsigned \a int, which halves the size of the stored indices in comparison to the
+// default index type of the Blaze library (\a size_t).
+*/
+typedef unsigned int  BlazeSparseIndexType;
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  EIGEN CONFIGURATION
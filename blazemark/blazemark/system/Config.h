@@ -40,7 +40,9 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/util/constraints/Integral.h>
 #include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Unsigned.h>
 #include <blaze/util/StaticAssert.h>
 #include <blazemark/util/MatrixStructure.h>
 
@@ -70,6 +72,8 @@ namespace {
 
 BLAZE_STATIC_ASSERT( reps > 0 );
 BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( element_t );
+BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE( BlazeSparseIndexType );
+BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE( BlazeSparseIndexType );
 
 }
 /*! \endcond */
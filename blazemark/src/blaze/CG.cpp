@@ -86,7 +86,7 @@ double cg( size_t N, size_t steps, size_t iterations )
       }
    }
 
-   ::blaze::CompressedMatrix<element_t,rowMajor> A( NN, NN, nnz );
+   ::blaze::CompressedMatrix<element_t,rowMajor,BlazeSparseIndexType> A( NN, NN, nnz );
    ::blaze::DynamicVector<element_t,columnVector> x( NN ), b( NN ), r( NN ), d( NN ), h( NN ), start( NN );
    element_t alpha, beta, delta;
    ::blaze::timing::WcTimer timer;
@@ -0,0 +1,181 @@
+//=================================================================================================
+/*!
+//  \file src/blaze/DMatDMatMultBatch.cpp
+//  \brief Source file for the Blaze batched dense matrix/dense matrix multiplication kernels
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iostream>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/DMatDMatMultBatch.h>
+#include <blazemark/blaze/init/DynamicMatrix.h>
+#include <blazemark/system/Config.h>
+
+
+namespace blazemark {
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  KERNEL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Blaze dense matrix/dense matrix multiplication kernel for a loop of single products.
+//
+// \param N The number of rows and columns of the matrices.
+// \param M The number of products per step.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function.
+//
+// This kernel function computes \a M independent dense matrix/dense matrix multiplications per
+// step by means of a loop of single products. Each product is parallelized on its own.
+*/
+double dmatdmatmultloop( size_t N, size_t M, size_t steps )
+{
+   using ::blazemark::element_t;
+   using ::blaze::rowMajor;
+
+   typedef ::blaze::DynamicMatrix<element_t,rowMajor>  MatrixType;
+
+   ::blaze::setSeed( seed );
+
+   ::std::vector<MatrixType> A( M, MatrixType( N, N ) ), B( M, MatrixType( N, N ) );
+   ::std::vector<MatrixType> C( M, MatrixType( N, N ) );
+   ::blaze::timing::WcTimer timer;
+
+   for( size_t b=0UL; b<M; ++b ) {
+      init( A[b] );
+      init( B[b] );
+   }
+
+   for( size_t b=0UL; b<M; ++b ) {
+      C[b] = A[b] * B[b];
+   }
+
+   for( size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         for( size_t b=0UL; b<M; ++b ) {
+            C[b] = A[b] * B[b];
+         }
+      }
+      timer.end();
+
+      for( size_t b=0UL; b<M; ++b )
+         if( C[b].rows() != N )
+            std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      if( timer.last() > maxtime )
+         break;
+   }
+
+   const double minTime( timer.min()     );
+   const double avgTime( timer.average() );
+
+   if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
+      std::cerr << " Blaze kernel 'dmatdmatmultloop': Time deviation too large!!!\n";
+
+   return minTime;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Blaze batched dense matrix/dense matrix multiplication kernel.
+//
+// \param N The number of rows and columns of the matrices.
+// \param M The number of products per step.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function.
+//
+// This kernel function computes \a M independent dense matrix/dense matrix multiplications per
+// step by means of the Blaze batchMult() function, which distributes whole products among the
+// available threads.
+*/
+double dmatdmatmultbatch( size_t N, size_t M, size_t steps )
+{
+   using ::blazemark::element_t;
+   using ::blaze::rowMajor;
+
+   typedef ::blaze::DynamicMatrix<element_t,rowMajor>  MatrixType;
+
+   ::blaze::setSeed( seed );
+
+   ::std::vector<MatrixType> A( M, MatrixType( N, N ) ), B( M, MatrixType( N, N ) );
+   ::std::vector<MatrixType> C( M, MatrixType( N, N ) );
+   ::blaze::timing::WcTimer timer;
+
+   for( size_t b=0UL; b<M; ++b ) {
+      init( A[b] );
+      init( B[b] );
+   }
+
+   ::blaze::batchMult( A.begin(), A.end(), B.begin(), C.begin() );
+
+   for( size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         ::blaze::batchMult( A.begin(), A.end(), B.begin(), C.begin() );
+      }
+      timer.end();
+
+      for( size_t b=0UL; b<M; ++b )
+         if( C[b].rows() != N )
+            std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      if( timer.last() > maxtime )
+         break;
+   }
+
+   const double minTime( timer.min()     );
+   const double avgTime( timer.average() );
+
+   if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
+      std::cerr << " Blaze kernel 'dmatdmatmultbatch': Time deviation too large!!!\n";
+
+   return minTime;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+} // namespace blazemark
@@ -76,7 +76,7 @@ double dmatsmatadd( size_t N, size_t F, size_t steps )
    ::blaze::setSeed( seed );
 
    ::blaze::DynamicMatrix<element_t,rowMajor> A( N, N ), C( N, N, 0 );
-   ::blaze::CompressedMatrix<element_t,rowMajor> B( N, N, N*F );
+   ::blaze::CompressedMatrix<element_t,rowMajor,BlazeSparseIndexType> B( N, N, N*F );
    ::blaze::timing::WcTimer timer;
 
    init( A );
@@ -78,7 +78,7 @@ double dmatsvecmult( size_t N, size_t F, size_t steps )
    ::blaze::setSeed( seed );
 
    ::blaze::DynamicMatrix<element_t,rowMajor> A( N, N );
-   ::blaze::CompressedVector<element_t,columnVector> a( N );
+   ::blaze::CompressedVector<element_t,columnVector,BlazeSparseIndexType> a( N );
    ::blaze::DynamicVector<element_t,columnVector> b( N );
    ::blaze::timing::WcTimer timer;
 
@@ -77,7 +77,7 @@ double dmattsmatmult( size_t N, size_t F, size_t steps )
    ::blaze::setSeed( seed );
 
    ::blaze::DynamicMatrix<element_t,rowMajor> A( N, N ), C( N, N );
-   ::blaze::CompressedMatrix<element_t,columnMajor> B( N, N, N*F );
+   ::blaze::CompressedMatrix<element_t,columnMajor,BlazeSparseIndexType> B( N, N, N*F );
    ::blaze::timing::WcTimer timer;
 
    init( A );
@@ -76,7 +76,7 @@ double dvecsvecadd( size_t N, size_t F, size_t steps )
    ::blaze::setSeed( seed );
 
    ::blaze::DynamicVector<element_t,columnVector> a( N ), c( N );
-   ::blaze::CompressedVector<element_t,columnVector> b( N );
+   ::blaze::CompressedVector<element_t,columnVector,BlazeSparseIndexType> b( N );
    ::blaze::timing::WcTimer timer;
 
    init( a );
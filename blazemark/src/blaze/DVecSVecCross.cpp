@@ -81,7 +81,7 @@ double dvecsveccross( size_t N, size_t F, size_t steps )
    ::blaze::setSeed( seed );
 
    ::std::vector< VectorType, AllocatorType > a( N ), c( N );
-   ::std::vector< ::blaze::CompressedVector<element_t,columnVector> > b( N );
+   ::std::vector< ::blaze::CompressedVector<element_t,columnVector,BlazeSparseIndexType> > b( N );
    ::blaze::timing::WcTimer timer;
 
    for( size_t i=0UL; i<N; ++i ) {
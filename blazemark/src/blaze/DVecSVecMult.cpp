@@ -76,7 +76,7 @@ double dvecsvecmult( size_t N, size_t F, size_t steps )
    ::blaze::setSeed( seed );
 
    ::blaze::DynamicVector<element_t,columnVector> a( N );
-   ::blaze::CompressedVector<element_t,columnVector> b( N ), c( N );
+   ::blaze::CompressedVector<element_t,columnVector,BlazeSparseIndexType> b( N ), c( N );
    ::blaze::timing::WcTimer timer;
 
    init( a );
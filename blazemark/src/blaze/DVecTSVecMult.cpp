@@ -79,8 +79,8 @@ double dvectsvecmult( size_t N, size_t F, size_t steps )
    ::blaze::setSeed( seed );
 
    ::blaze::DynamicVector<element_t,columnVector> a( N );
-   ::blaze::CompressedVector<element_t,rowVector> b( N );
-   ::blaze::CompressedMatrix<element_t,rowMajor> A( N, N );
+   ::blaze::CompressedVector<element_t,rowVector,BlazeSparseIndexType> b( N );
+   ::blaze::CompressedMatrix<element_t,rowMajor,BlazeSparseIndexType> A( N, N );
    ::blaze::timing::WcTimer timer;
 
    init( a );
@@ -0,0 +1,258 @@
+//=================================================================================================
+/*!
+//  \file src/blaze/Mat3Inv.cpp
+//  \brief Source file for the Blaze 3D matrix inversion kernels
+//
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/init/StaticMatrix.h>
+#include <blazemark/blaze/Mat3Inv.h>
+#include <blazemark/system/Config.h>
+
+
+namespace blazemark {
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  KERNEL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Blaze 3-dimensional matrix inversion kernel.
+//
+// \param N The number of 3x3 matrices to be computed.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function.
+//
+// This kernel function implements the 3-dimensional matrix inversion by means of the Blaze
+// functionality.
+*/
+double mat3inv( size_t N, size_t steps )
+{
+   using ::blazemark::element_t;
+   using ::blaze::rowMajor;
+
+   typedef ::blaze::StaticMatrix<element_t,3UL,3UL,rowMajor>  MatrixType;
+   typedef ::blaze::AlignedAllocator<MatrixType>              AllocatorType;
+
+   ::blaze::setSeed( seed );
+
+   ::std::vector< MatrixType, AllocatorType > A( N ), B( N );
+   ::blaze::timing::WcTimer timer;
+
+   for( size_t i=0UL; i<N; ++i ) {
+      init( A[i] );
+      for( size_t j=0UL; j<3UL; ++j ) {
+         A[i](j,j) += element_t( 30 );
+      }
+   }
+
+   for( size_t i=0UL; i<N; ++i ) {
+      B[i] = inv( A[i] );
+   }
+
+   for( size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL, i=0UL; step<steps; ++step, ++i ) {
+         if( i == N ) i = 0UL;
+         B[i] = inv( A[i] );
+      }
+      timer.end();
+
+      for( size_t i=0UL; i<N; ++i )
+         if( B[i](0,0) <= element_t(0) )
+            std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      if( timer.last() > maxtime )
+         break;
+   }
+
+   const double minTime( timer.min()     );
+   const double avgTime( timer.average() );
+
+   if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
+      std::cerr << " Blaze kernel 'mat3inv': Time deviation too large!!!\n";
+
+   return minTime;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Blaze 3-dimensional determinant kernel.
+//
+// \param N The number of 3x3 matrices to be computed.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function.
+//
+// This kernel function implements the computation of the determinant of a 3-dimensional matrix by
+// means of the Blaze functionality.
+*/
+double mat3det( size_t N, size_t steps )
+{
+   using ::blazemark::element_t;
+   using ::blaze::rowMajor;
+
+   typedef ::blaze::StaticMatrix<element_t,3UL,3UL,rowMajor>  MatrixType;
+   typedef ::blaze::AlignedAllocator<MatrixType>              AllocatorType;
+
+   ::blaze::setSeed( seed );
+
+   ::std::vector< MatrixType, AllocatorType > A( N );
+   ::std::vector< element_t > d( N );
+   ::blaze::timing::WcTimer timer;
+
+   for( size_t i=0UL; i<N; ++i ) {
+      init( A[i] );
+      for( size_t j=0UL; j<3UL; ++j ) {
+         A[i](j,j) += element_t( 30 );
+      }
+   }
+
+   for( size_t i=0UL; i<N; ++i ) {
+      d[i] = det( A[i] );
+   }
+
+   for( size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL, i=0UL; step<steps; ++step, ++i ) {
+         if( i == N ) i = 0UL;
+         d[i] = det( A[i] );
+      }
+      timer.end();
+
+      for( size_t i=0UL; i<N; ++i )
+         if( d[i] <= element_t(0) )
+            std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      if( timer.last() > maxtime )
+         break;
+   }
+
+   const double minTime( timer.min()     );
+   const double avgTime( timer.average() );
+
+   if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
+      std::cerr << " Blaze kernel 'mat3det': Time deviation too large!!!\n";
+
+   return minTime;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Blaze 3-dimensional linear system solver kernel.
+//
+// \param N The number of 3x3 matrices to be computed.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function.
+//
+// This kernel function implements the solution of a 3-dimensional linear system of equations by
+// means of the Blaze functionality.
+*/
+double mat3solve( size_t N, size_t steps )
+{
+   using ::blazemark::element_t;
+   using ::blaze::rowMajor;
+   using ::blaze::columnVector;
+
+   typedef ::blaze::StaticMatrix<element_t,3UL,3UL,rowMajor>  MatrixType;
+   typedef ::blaze::StaticVector<element_t,3UL,columnVector>  VectorType;
+   typedef ::blaze::AlignedAllocator<MatrixType>              MatrixAllocatorType;
+   typedef ::blaze::AlignedAllocator<VectorType>              VectorAllocatorType;
+
+   ::blaze::setSeed( seed );
+
+   ::std::vector< MatrixType, MatrixAllocatorType > A( N );
+   ::std::vector< VectorType, VectorAllocatorType > b( N ), x( N );
+   ::blaze::timing::WcTimer timer;
+
+   for( size_t i=0UL; i<N; ++i ) {
+      init( A[i] );
+      for( size_t j=0UL; j<3UL; ++j ) {
+         A[i](j,j) += element_t( 30 );
+      }
+      b[i] = A[i] * VectorType( element_t( 1 ) );
+   }
+
+   for( size_t i=0UL; i<N; ++i ) {
+      x[i] = b[i];
+      solve( A[i], x[i] );
+   }
+
+   for( size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL, i=0UL; step<steps; ++step, ++i ) {
+         if( i == N ) i = 0UL;
+         x[i] = b[i];
+         solve( A[i], x[i] );
+      }
+      timer.end();
+
+      for( size_t i=0UL; i<N; ++i )
+         if( std::fabs( x[i][0] - element_t(1) ) > element_t(1E-4) )
+            std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      if( timer.last() > maxtime )
+         break;
+   }
+
+   const double minTime( timer.min()     );
+   const double avgTime( timer.average() );
+
+   if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
+      std::cerr << " Blaze kernel 'mat3solve': Time deviation too large!!!\n";
+
+   return minTime;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+} // namespace blazemark
@@ -40,6 +40,7 @@
 #include <iostream>
 #include <vector>
 #include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticMatrixBatch.h>
 #include <blaze/util/AlignedAllocator.h>
 #include <blaze/util/Timing.h>
 #include <blazemark/blaze/init/StaticMatrix.h>
@@ -116,6 +117,71 @@ double mat3mat3mult( size_t N, size_t steps )
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Blaze 3-dimensional batched matrix/matrix multiplication kernel.
+//
+// \param N The number of 3x3 matrices to be computed.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function (normalized to \a steps multiplications).
+//
+// This kernel function implements the 3-dimensional matrix/matrix multiplication by means of the
+// batched multiplication of the Blaze StaticMatrixBatch class template, which vectorizes the
+// multiplications across the matrices of the batch. Since each call multiplies all \a N matrices,
+// the measured runtime is scaled to the given number of steps.
+*/
+double mat3mat3mult_batch( size_t N, size_t steps )
+{
+   using ::blazemark::element_t;
+   using ::blaze::rowMajor;
+
+   typedef ::blaze::StaticMatrix<element_t,3UL,3UL,rowMajor>  MatrixType;
+   typedef ::blaze::AlignedAllocator<MatrixType>              AllocatorType;
+   typedef ::blaze::StaticMatrixBatch<element_t,3UL,3UL>      BatchType;
+
+   ::blaze::setSeed( seed );
+
+   ::std::vector< MatrixType, AllocatorType > A( N ), B( N );
+   ::blaze::timing::WcTimer timer;
+
+   for( size_t i=0UL; i<N; ++i ) {
+      init( A[i] );
+      init( B[i] );
+   }
+
+   const BatchType AB( A.begin(), A.end() ), BB( B.begin(), B.end() );
+   BatchType CB;
+
+   mult( CB, AB, BB );
+
+   const size_t batches( ( steps > N )?( steps / N ):( 1UL ) );
+
+   for( size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( size_t batch=0UL; batch<batches; ++batch ) {
+         mult( CB, AB, BB );
+      }
+      timer.end();
+
+      for( size_t i=0UL; i<N; ++i )
+         if( CB(i,0,0) < element_t(0) )
+            std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      if( timer.last() > maxtime )
+         break;
+   }
+
+   const double minTime( timer.min()     );
+   const double avgTime( timer.average() );
+
+   if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
+      std::cerr << " Blaze kernel 'mat3mat3mult_batch': Time deviation too large!!!\n";
+
+   return minTime * steps / ( batches * N );
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 } // namespace blazemark
@@ -75,7 +75,7 @@ double smatdmatadd( size_t N, size_t F, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::blaze::CompressedMatrix<element_t,rowMajor> A( N, N, N*F );
+   ::blaze::CompressedMatrix<element_t,rowMajor,BlazeSparseIndexType> A( N, N, N*F );
    ::blaze::DynamicMatrix<element_t,rowMajor> B( N, N ), C( N, N );
    ::blaze::timing::WcTimer timer;
 
@@ -40,6 +40,7 @@
 #include <iostream>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DynamicVector.h>
+#include <blaze/math/SlicedEllpackMatrix.h>
 #include <blaze/util/Timing.h>
 #include <blazemark/blaze/init/CompressedMatrix.h>
 #include <blazemark/blaze/init/DynamicVector.h>
@@ -76,7 +77,7 @@ double smatdvecmult( size_t N, size_t F, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::blaze::CompressedMatrix<element_t,rowMajor> A( N, N, N*F );
+   ::blaze::CompressedMatrix<element_t,rowMajor,BlazeSparseIndexType> A( N, N, N*F );
    ::blaze::DynamicVector<element_t,columnVector> a( N ), b( N );
    ::blaze::timing::WcTimer timer;
 
@@ -110,6 +111,63 @@ double smatdvecmult( size_t N, size_t F, size_t steps )
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Blaze sliced ELLPACK sparse matrix/dense vector multiplication kernel.
+//
+// \param N The number of rows and columns of the matrix and the size of the vector.
+// \param F The number of non-zero elements in each row of the sparse matrix.
+// \param steps The number of iteration steps to perform.
+// \return Minimum runtime of the kernel function.
+//
+// This kernel function implements the sparse matrix/dense vector multiplication by means of
+// the Blaze SlicedEllpackMatrix (SELL-C-sigma format). The matrix is initialized as a compressed
+// matrix and converted prior to the time measurement.
+*/
+double smatdvecmult_sell( size_t N, size_t F, size_t steps )
+{
+   using ::blazemark::element_t;
+   using ::blaze::columnVector;
+   using ::blaze::rowMajor;
+
+   ::blaze::setSeed( seed );
+
+   ::blaze::CompressedMatrix<element_t,rowMajor,BlazeSparseIndexType> C( N, N, N*F );
+   ::blaze::DynamicVector<element_t,columnVector> a( N ), b( N );
+   ::blaze::timing::WcTimer timer;
+
+   init( C, F );
+   init( a );
+
+   const ::blaze::SlicedEllpackMatrix<element_t,BlazeSparseIndexType> A( C );
+
+   b = A * a;
+
+   for( size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         b = A * a;
+      }
+      timer.end();
+
+      if( b.size() != N )
+         std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      if( timer.last() > maxtime )
+         break;
+   }
+
+   const double minTime( timer.min()     );
+   const double avgTime( timer.average() );
+
+   if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
+      std::cerr << " Blaze kernel 'smatdvecmult_sell': Time deviation too large!!!\n";
+
+   return minTime;
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 } // namespace blazemark
@@ -73,7 +73,7 @@ double smatsmatadd( size_t N, size_t F, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::blaze::CompressedMatrix<element_t,rowMajor> A( N, N, N*F ), B( N, N, N*F ), C( N, N );
+   ::blaze::CompressedMatrix<element_t,rowMajor,BlazeSparseIndexType> A( N, N, N*F ), B( N, N, N*F ), C( N, N );
    ::blaze::timing::WcTimer timer;
 
    init( A, F );
@@ -76,8 +76,8 @@ double smatsvecmult( size_t N, size_t F, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::blaze::CompressedMatrix<element_t,rowMajor> A( N, N, N*F );
-   ::blaze::CompressedVector<element_t,columnVector> a( N ), b( N );
+   ::blaze::CompressedMatrix<element_t,rowMajor,BlazeSparseIndexType> A( N, N, N*F );
+   ::blaze::CompressedVector<element_t,columnVector,BlazeSparseIndexType> a( N ), b( N );
    ::blaze::timing::WcTimer timer;
 
    init( A, F );
@@ -74,8 +74,8 @@ double smattsmatadd( size_t N, size_t F, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::blaze::CompressedMatrix<element_t,rowMajor> A( N, N, N*F ), C( N, N );;
-   ::blaze::CompressedMatrix<element_t,columnMajor> B( N, N, N*F );
+   ::blaze::CompressedMatrix<element_t,rowMajor,BlazeSparseIndexType> A( N, N, N*F ), C( N, N );;
+   ::blaze::CompressedMatrix<element_t,columnMajor,BlazeSparseIndexType> B( N, N, N*F );
    ::blaze::timing::WcTimer timer;
 
    init( A, F );
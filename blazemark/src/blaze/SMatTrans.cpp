@@ -72,7 +72,7 @@ double smattrans( size_t N, size_t F, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::blaze::CompressedMatrix<element_t,rowMajor> A( N, N, N*F ), B( N, N, N*F );
+   ::blaze::CompressedMatrix<element_t,rowMajor,BlazeSparseIndexType> A( N, N, N*F ), B( N, N, N*F );
    ::blaze::timing::WcTimer timer;
 
    init( A, F );
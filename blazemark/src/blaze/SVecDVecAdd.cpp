@@ -75,7 +75,7 @@ double svecdvecadd( size_t N, size_t F, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::blaze::CompressedVector<element_t,columnVector> a( N );
+   ::blaze::CompressedVector<element_t,columnVector,BlazeSparseIndexType> a( N );
    ::blaze::DynamicVector<element_t,columnVector> b( N ), c( N );
    ::blaze::timing::WcTimer timer;
 
@@ -80,7 +80,7 @@ double svecdveccross( size_t N, size_t F, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::std::vector< ::blaze::CompressedVector<element_t,columnVector> > a( N );
+   ::std::vector< ::blaze::CompressedVector<element_t,columnVector,BlazeSparseIndexType> > a( N );
    ::std::vector< VectorType, AllocatorType > b( N ), c( N );
    ::blaze::timing::WcTimer timer;
 
@@ -75,7 +75,7 @@ double svecdvecmult( size_t N, size_t F, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::blaze::CompressedVector<element_t,columnVector> a( N ), c( N );
+   ::blaze::CompressedVector<element_t,columnVector,BlazeSparseIndexType> a( N ), c( N );
    ::blaze::DynamicVector<element_t,columnVector> b( N );
    ::blaze::timing::WcTimer timer;
 
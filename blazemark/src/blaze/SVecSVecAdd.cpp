@@ -73,7 +73,7 @@ double svecsvecadd( size_t N, size_t F, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::blaze::CompressedVector<element_t,columnVector> a( N ), b( N ), c( N );
+   ::blaze::CompressedVector<element_t,columnVector,BlazeSparseIndexType> a( N ), b( N ), c( N );
    ::blaze::timing::WcTimer timer;
 
    init( a, F );
@@ -80,7 +80,7 @@ double svecsveccross( size_t N, size_t F, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::std::vector< ::blaze::CompressedVector<element_t,columnVector> > a( N ), b( N );
+   ::std::vector< ::blaze::CompressedVector<element_t,columnVector,BlazeSparseIndexType> > a( N ), b( N );
    ::std::vector< VectorType, AllocatorType > c( N );
    ::blaze::timing::WcTimer timer;
 
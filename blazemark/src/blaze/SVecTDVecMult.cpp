@@ -78,9 +78,9 @@ double svectdvecmult( size_t N, size_t F, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::blaze::CompressedVector<element_t,columnVector> a( N );
+   ::blaze::CompressedVector<element_t,columnVector,BlazeSparseIndexType> a( N );
    ::blaze::DynamicVector<element_t,rowVector> b( N );
-   ::blaze::CompressedMatrix<element_t,rowMajor> A( N, N );
+   ::blaze::CompressedMatrix<element_t,rowMajor,BlazeSparseIndexType> A( N, N );
    ::blaze::timing::WcTimer timer;
 
    init( a, F );
@@ -76,9 +76,9 @@ double svectsvecmult( size_t N, size_t F, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::blaze::CompressedVector<element_t,columnVector> a( N );
-   ::blaze::CompressedVector<element_t,rowVector> b( N );
-   ::blaze::CompressedMatrix<element_t,rowMajor> A( N, N );
+   ::blaze::CompressedVector<element_t,columnVector,BlazeSparseIndexType> a( N );
+   ::blaze::CompressedVector<element_t,rowVector,BlazeSparseIndexType> b( N );
+   ::blaze::CompressedMatrix<element_t,rowMajor,BlazeSparseIndexType> A( N, N );
    ::blaze::timing::WcTimer timer;
 
    init( a, F );
@@ -77,7 +77,7 @@ double tdvecsvecmult( size_t N, size_t F, size_t steps )
    ::blaze::setSeed( seed );
 
    ::blaze::DynamicVector<element_t,rowVector> a( N );
-   ::blaze::CompressedVector<element_t,columnVector> b( N );
+   ::blaze::CompressedVector<element_t,columnVector,BlazeSparseIndexType> b( N );
    element_t scalar( 0 );
    ::blaze::timing::WcTimer timer;
 
@@ -76,7 +76,7 @@ double tdvectsmatmult( size_t N, size_t F, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::blaze::CompressedMatrix<element_t,columnMajor> A( N, N, N*F );
+   ::blaze::CompressedMatrix<element_t,columnMajor,BlazeSparseIndexType> A( N, N, N*F );
    ::blaze::DynamicVector<element_t,rowVector> a( N ), b( N );
    ::blaze::timing::WcTimer timer;
 
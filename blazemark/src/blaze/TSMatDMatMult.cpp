@@ -76,7 +76,7 @@ double tsmatdmatmult( size_t N, size_t F, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::blaze::CompressedMatrix<element_t,columnMajor> A( N, N, N*F );
+   ::blaze::CompressedMatrix<element_t,columnMajor,BlazeSparseIndexType> A( N, N, N*F );
    ::blaze::DynamicMatrix<element_t,rowMajor> B( N, N );
    ::blaze::DynamicMatrix<element_t,columnMajor> C( N, N );
    ::blaze::timing::WcTimer timer;
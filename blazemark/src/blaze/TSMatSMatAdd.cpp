@@ -74,8 +74,8 @@ double tsmatsmatadd( size_t N, size_t F, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::blaze::CompressedMatrix<element_t,columnMajor> A( N, N, N*F ), C( N, N );
-   ::blaze::CompressedMatrix<element_t,rowMajor> B( N, N, N*F );
+   ::blaze::CompressedMatrix<element_t,columnMajor,BlazeSparseIndexType> A( N, N, N*F ), C( N, N );
+   ::blaze::CompressedMatrix<element_t,rowMajor,BlazeSparseIndexType> B( N, N, N*F );
    ::blaze::timing::WcTimer timer;
 
    init( A, F );
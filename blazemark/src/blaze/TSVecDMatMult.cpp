@@ -78,7 +78,7 @@ double tsvecdmatmult( size_t N, size_t F, size_t steps )
    ::blaze::setSeed( seed );
 
    ::blaze::DynamicMatrix<element_t,rowMajor> A( N, N );
-   ::blaze::CompressedVector<element_t,rowVector> a( N );
+   ::blaze::CompressedVector<element_t,rowVector,BlazeSparseIndexType> a( N );
    ::blaze::DynamicVector<element_t,rowVector> b( N );
    ::blaze::timing::WcTimer timer;
 
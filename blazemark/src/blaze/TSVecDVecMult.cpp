@@ -76,7 +76,7 @@ double tsvecdvecmult( size_t N, size_t F, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::blaze::CompressedVector<element_t,rowVector> a( N );
+   ::blaze::CompressedVector<element_t,rowVector,BlazeSparseIndexType> a( N );
    ::blaze::DynamicVector<element_t,columnVector> b( N );
    element_t scalar( 0 );
    ::blaze::timing::WcTimer timer;
@@ -74,8 +74,8 @@ double tsvecsvecmult( size_t N, size_t F, size_t steps )
 
    ::blaze::setSeed( seed );
 
-   ::blaze::CompressedVector<element_t,rowVector> a( N );
-   ::blaze::CompressedVector<element_t,columnVector> b( N );
+   ::blaze::CompressedVector<element_t,rowVector,BlazeSparseIndexType> a( N );
+   ::blaze::CompressedVector<element_t,columnVector,BlazeSparseIndexType> b( N );
    element_t scalar( 0 );
    ::blaze::timing::WcTimer timer;
 
@@ -213,6 +213,15 @@ void mat6mat6mult( std::vector<Run>& runs, Benchmarks benchmarks )
          const double mflops( run->getFlops() * steps / run->getBlazeResult() / 1E6 );
          std::cout << "     " << std::setw(12) << N << mflops << std::endl;
       }
+
+      std::cout << "   Blaze batched [MFlop/s]:\n";
+      for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run ) {
+         const size_t N    ( run->getNumber() );
+         const size_t steps( run->getSteps()  );
+         const double time ( blazemark::blaze::mat6mat6mult_batch( N, steps ) );
+         const double mflops( run->getFlops() * steps / time / 1E6 );
+         std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+      }
    }
 
    if( benchmarks.runBoost ) {
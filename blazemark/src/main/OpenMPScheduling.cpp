@@ -0,0 +1,322 @@
+//=================================================================================================
+/*!
+//  \file src/main/OpenMPScheduling.cpp
+//  \brief Source file for the measurement of the OpenMP loop scheduling under background load
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include <boost/thread/thread.hpp>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Timing.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+#  include <omp.h>
+#endif
+
+
+#if BLAZE_OPENMP_PARALLEL_MODE
+
+//=================================================================================================
+//
+//  CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Size of the dense vectors of the vector addition.
+*/
+const size_t vectorSize( 4000000UL );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Number of rows and columns of the matrices of the triangular multiplication.
+*/
+const size_t productSize( 600UL );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Number of rows and columns of the matrices of the sparse matrix addition.
+*/
+const size_t sparseSize( 3000UL );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Number of timing samples per measurement.
+*/
+const size_t reps( 10UL );
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BACKGROUND LOAD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Termination flag of the background threads.
+*/
+volatile bool terminated( false );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Busy loop of a single background thread.
+//
+// \return void
+//
+// The background threads compete with the OpenMP threads for the available cores and thus
+// emulate the load of other processes on a shared host.
+*/
+void spin()
+{
+   volatile size_t counter( 0UL );
+
+   while( !terminated ) {
+      ++counter;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MEASUREMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Measures the average time of a dense vector addition.
+//
+// \return The average time of the addition [s].
+*/
+double measureVectorAddition()
+{
+   blaze::DynamicVector<double> a( vectorSize, 1.0 ), b( vectorSize, 2.0 ), c( vectorSize );
+   blaze::timing::WcTimer timer;
+
+   c = a + b;
+
+   for( size_t rep=0UL; rep<reps; ++rep ) {
+      timer.start();
+      c = a + b;
+      timer.end();
+   }
+
+   return timer.average();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures the average time of a lower triangular/dense matrix multiplication.
+//
+// \return The average time of the multiplication [s].
+*/
+double measureTriangularMultiplication()
+{
+   blaze::LowerMatrix< blaze::DynamicMatrix<double> > L( productSize );
+   blaze::DynamicMatrix<double> A( productSize, productSize, 1.0 ), C( productSize, productSize );
+   blaze::timing::WcTimer timer;
+
+   for( size_t i=0UL; i<productSize; ++i ) {
+      for( size_t j=0UL; j<=i; ++j ) {
+         L(i,j) = 1.0;
+      }
+   }
+
+   C = L * A;
+
+   for( size_t rep=0UL; rep<reps; ++rep ) {
+      timer.start();
+      C = L * A;
+      timer.end();
+   }
+
+   return timer.average();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures the average time of a dense matrix/sparse matrix addition.
+//
+// \return The average time of the addition [s].
+//
+// The number of non-zero elements per row of the sparse matrix grows with the row index, i.e.
+// the work per row of the addition is irregular.
+*/
+double measureSparseAddition()
+{
+   blaze::DynamicMatrix<double> A( sparseSize, sparseSize, 1.0 ), C( sparseSize, sparseSize );
+   blaze::CompressedMatrix<double> S( sparseSize, sparseSize );
+   blaze::timing::WcTimer timer;
+
+   S.reserve( sparseSize * ( sparseSize / 8UL + 1UL ) );
+   for( size_t i=0UL; i<sparseSize; ++i ) {
+      for( size_t j=0UL; j<i; j+=4UL ) {
+         S.append( i, j, 1.0 );
+      }
+      S.finalize( i );
+   }
+
+   C = A + S;
+
+   for( size_t rep=0UL; rep<reps; ++rep ) {
+      timer.start();
+      C = A + S;
+      timer.end();
+   }
+
+   return timer.average();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Runs all measurements with the given number of background threads.
+//
+// \param load The number of background threads.
+// \param results The resulting average times [s].
+// \return void
+*/
+void measure( size_t load, std::vector<double>& results )
+{
+   std::vector<boost::thread*> threads;
+
+   terminated = false;
+   for( size_t i=0UL; i<load; ++i ) {
+      threads.push_back( new boost::thread( spin ) );
+   }
+
+   results.clear();
+   results.push_back( measureVectorAddition() );
+   results.push_back( measureTriangularMultiplication() );
+   results.push_back( measureSparseAddition() );
+
+   terminated = true;
+   for( size_t i=0UL; i<load; ++i ) {
+      threads[i]->join();
+      delete threads[i];
+   }
+}
+//*************************************************************************************************
+
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the measurement of the OpenMP loop scheduling.
+//
+// \param argc The total number of command line arguments.
+// \param argv The array of command line arguments.
+// \return void
+//
+// This benchmark measures the average time of a dense vector addition, a lower triangular/dense
+// matrix multiplication and a dense matrix/sparse matrix addition, once on an otherwise idle
+// system and once while a given number of busy background threads (default: 1) compete for the
+// cores. The slowdown due to the background load indicates how well the OpenMP loop schedule
+// (see the \c BLAZE_OPENMP_SCHEDULING and \c BLAZE_OPENMP_BLOCKS_PER_THREAD switches in the
+// <em>./blaze/config/SMP.h</em> configuration file) rebalances the work of delayed threads.
+// Ideally, a single background thread slows down an operation with \a n threads by a factor of
+// about \f$ (n+1)/n \f$. The number of threads is given by the OMP_NUM_THREADS environment
+// variable. The benchmark requires the OpenMP-based parallelization of the Blaze library.
+*/
+int main( int argc, char** argv )
+{
+#if BLAZE_OPENMP_PARALLEL_MODE
+
+   const size_t threads( omp_get_max_threads() );
+   const size_t load( ( argc > 1 )?( std::atoi( argv[1] ) ):( 1 ) );
+
+   const char* schedules[] = { "static", "dynamic", "guided" };
+   const char* names[] = { "Dense vector addition", "Lower/dense matrix multiplication",
+                           "Dense/sparse matrix addition" };
+
+   std::cout << "\n OpenMP Scheduling (" << threads << " thread(s), "
+             << schedules[BLAZE_OPENMP_SCHEDULING] << " scheduling, "
+             << BLAZE_OPENMP_BLOCKS_PER_THREAD << " block(s) per thread, "
+             << load << " background thread(s)):\n";
+
+   std::vector<double> idle, busy;
+   measure( 0UL , idle );
+   measure( load, busy );
+
+   for( size_t i=0UL; i<idle.size(); ++i ) {
+      std::cout << "   " << std::left << std::setw(36) << names[i] << std::right << std::fixed
+                << std::setprecision(2) << std::setw(9) << idle[i]*1E3 << " ms"
+                << std::setw(9) << busy[i]*1E3 << " ms"
+                << std::setw(8) << busy[i]/idle[i] << "x\n";
+   }
+
+   std::cout << "\n";
+
+#else
+
+   blaze::UNUSED_PARAMETER( argc, argv );
+
+   std::cerr << "\n   The measurement of the OpenMP loop scheduling requires the OpenMP-based\n"
+             << "   parallelization (see the -fopenmp or /openmp compiler flags).\n\n";
+
+   return EXIT_FAILURE;
+
+#endif
+}
+//*************************************************************************************************
@@ -0,0 +1,334 @@
+//=================================================================================================
+/*!
+//  \file src/main/TaskOverhead.cpp
+//  \brief Source file for the measurement of the per-task overhead of the Blaze thread pools
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <blaze/math/SMP.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/Timing.h>
+#include <blaze/util/Types.h>
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <blaze/util/ThreadPool.h>
+#  include <blaze/util/threadpool/Counter.h>
+#endif
+
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The type of the measured thread pool.
+*/
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+typedef blaze::ThreadPool< std::thread
+                         , std::mutex
+                         , std::unique_lock< std::mutex >
+                         , std::condition_variable
+                         >  Pool;
+#else
+typedef blaze::ThreadPool< boost::thread
+                         , boost::mutex
+                         , boost::unique_lock< boost::mutex >
+                         , boost::condition_variable
+                         >  Pool;
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Number of tasks scheduled per timing sample.
+*/
+const size_t tasks( 100000UL );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Number of tasks scheduled before waiting for their completion.
+//
+// The batch size is smaller than the capacity of the task queue of the thread pool in order to
+// avoid the inline execution of tasks in the scheduling thread.
+*/
+const size_t batch( 128UL );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Number of timing samples per measurement.
+*/
+const size_t reps( 5UL );
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TASKS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Global counter of the executed tasks.
+*/
+blaze::threadpool::Counter executed( 0UL );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Task without any workload.
+*/
+struct EmptyTask
+{
+   inline void operator()() const {}
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Small task, which fits into the storage of a task.
+*/
+struct SmallTask
+{
+   inline void operator()() const { executed += value_; }
+
+   size_t value_;  //!< The value to be added to the global counter.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Large task, which exceeds the storage of a task and is stored on the heap.
+*/
+struct LargeTask
+{
+   inline void operator()() const { executed += value_[0]; }
+
+   size_t value_[64];  //!< The value to be added to the global counter.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unary function used for the scheduling of tasks with arguments.
+//
+// \param value The value to be added to the global counter.
+// \return void
+*/
+void unaryTask( size_t value )
+{
+   executed += value;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MEASUREMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Measures the average time for scheduling and executing a task via a thread pool.
+//
+// \param pool The thread pool used for the execution of the tasks.
+// \param task The task to be scheduled.
+// \return The minimum time per task [ns].
+*/
+template< typename Task >  // Type of the task
+double measurePool( Pool& pool, const Task& task )
+{
+   blaze::timing::WcTimer timer;
+
+   for( size_t rep=0UL; rep<reps; ++rep ) {
+      timer.start();
+      for( size_t i=0UL; i<tasks; i+=batch ) {
+         for( size_t j=0UL; j<batch; ++j )
+            pool.schedule( task );
+         pool.wait();
+      }
+      timer.end();
+   }
+
+   return timer.min() * 1E9 / tasks;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures the average time for scheduling and executing a unary function via a thread
+//        pool.
+//
+// \param pool The thread pool used for the execution of the tasks.
+// \return The minimum time per task [ns].
+*/
+double measureArgs( Pool& pool )
+{
+   blaze::timing::WcTimer timer;
+
+   for( size_t rep=0UL; rep<reps; ++rep ) {
+      timer.start();
+      for( size_t i=0UL; i<tasks; i+=batch ) {
+         for( size_t j=0UL; j<batch; ++j )
+            pool.schedule( unaryTask, j );
+         pool.wait();
+      }
+      timer.end();
+   }
+
+   return timer.min() * 1E9 / tasks;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures the average time for scheduling and executing a task via the thread backend
+//        of the Blaze library.
+//
+// \param task The task to be scheduled.
+// \return The minimum time per task [ns].
+*/
+template< typename Task >  // Type of the task
+double measureBackend( const Task& task )
+{
+   blaze::TheThreadBackend::Context& context( blaze::TheThreadBackend::context() );
+   blaze::timing::WcTimer timer;
+
+   for( size_t rep=0UL; rep<reps; ++rep ) {
+      timer.start();
+      for( size_t i=0UL; i<tasks; i+=batch ) {
+         for( size_t j=0UL; j<batch; ++j )
+            context.schedule( task );
+         context.wait();
+      }
+      timer.end();
+   }
+
+   return timer.min() * 1E9 / tasks;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Prints a single result of the per-task overhead measurement.
+//
+// \param name The name of the measurement.
+// \param time The measured time per task [ns].
+// \return void
+*/
+void print( const char* name, double time )
+{
+   std::cout << "   " << std::left << std::setw(36) << name
+             << std::right << std::setw(10) << std::fixed << std::setprecision(1) << time
+             << " ns/task\n";
+}
+//*************************************************************************************************
+
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the measurement of the per-task overhead.
+//
+// \return void
+//
+// This benchmark measures the average time for scheduling and completing a single task via a
+// blaze::ThreadPool and via the thread backend of the Blaze library, using the current number
+// of threads (see the BLAZE_NUM_THREADS environment variable). Since the tasks themselves do
+// not perform any relevant work, the results represent the per-task overhead of the thread
+// pools, which determines the minimum task granularity that can be executed efficiently. The
+// benchmark requires the C++11 or the Boost thread-based parallelization of the Blaze library.
+*/
+int main()
+{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+
+   const size_t threads( blaze::getNumThreads() );
+
+   std::cout << "\n Per-Task Overhead (" << threads << " thread(s)):\n";
+
+   Pool pool( threads );
+
+   SmallTask small = { 1UL };
+   LargeTask large = { { 1UL } };
+
+   print( "ThreadPool, empty task"  , measurePool( pool, EmptyTask() ) );
+   print( "ThreadPool, small task"  , measurePool( pool, small ) );
+   print( "ThreadPool, large task"  , measurePool( pool, large ) );
+   print( "ThreadPool, unary function", measureArgs( pool ) );
+   print( "Thread backend, empty task", measureBackend( EmptyTask() ) );
+   print( "Thread backend, small task", measureBackend( small ) );
+
+   std::cout << "\n";
+
+#else
+
+   std::cerr << "\n   The measurement of the per-task overhead requires the C++11 or the Boost\n"
+             << "   thread-based parallelization (see BLAZE_USE_CPP_THREADS and\n"
+             << "   BLAZE_USE_BOOST_THREADS).\n\n";
+
+   return EXIT_FAILURE;
+
+#endif
+}
+//*************************************************************************************************
@@ -0,0 +1,836 @@
+//=================================================================================================
+/*!
+//  \file src/main/Thresholds.cpp
+//  \brief Source file for the tuning of the Blaze thresholds
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Configuration
+//*************************************************************************************************
+
+// The tuning requires the runtime mode of the Blaze thresholds
+#undef BLAZE_USE_RUNTIME_THRESHOLDS
+#define BLAZE_USE_RUNTIME_THRESHOLDS 1
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/DenseSubvector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/dense/BatchMult.h>
+#include <blaze/math/SMP.h>
+#include <blaze/math/StaticMatrixBatch.h>
+#include <blaze/system/BLAS.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/init/CompressedMatrix.h>
+#include <blazemark/blaze/init/CompressedVector.h>
+#include <blazemark/blaze/init/DynamicMatrix.h>
+#include <blazemark/blaze/init/DynamicVector.h>
+#include <blazemark/system/Config.h>
+
+
+//*************************************************************************************************
+// Using declarations
+//*************************************************************************************************
+
+using blaze::columnMajor;
+using blaze::columnVector;
+using blaze::rowMajor;
+using blaze::rowVector;
+using blazemark::element_t;
+
+
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Operand types */
+//@{
+typedef blaze::DynamicVector<element_t,columnVector>     DVec;    //!< Dense column vector.
+typedef blaze::DynamicVector<element_t,rowVector>        TDVec;   //!< Dense row vector.
+typedef blaze::CompressedVector<element_t,columnVector>  SVec;    //!< Sparse column vector.
+typedef blaze::CompressedVector<element_t,rowVector>     TSVec;   //!< Sparse row vector.
+typedef blaze::DynamicMatrix<element_t,rowMajor>         DMat;    //!< Row-major dense matrix.
+typedef blaze::DynamicMatrix<element_t,columnMajor>      TDMat;   //!< Column-major dense matrix.
+typedef blaze::CompressedMatrix<element_t,rowMajor>      SMat;    //!< Row-major sparse matrix.
+typedef blaze::CompressedMatrix<element_t,columnMajor>   TSMat;   //!< Column-major sparse matrix.
+typedef blaze::StaticMatrixBatch<element_t,3UL,3UL>      Batch;   //!< Batch of 3x3 matrices.
+typedef std::vector<DMat>                                DMats;   //!< Vector of dense matrices.
+//@}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Minimum runtime of a single timing sample [s].
+*/
+const double sampleTime( 0.02 );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Growth factor between two consecutive problem sizes of a sweep.
+*/
+const double growth( 1.25 );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Minimum relative speedup required for a crossover.
+//
+// The alternative execution is only considered to be faster in case its runtime is below the
+// given fraction of the runtime of the default execution, which filters out timing noise.
+*/
+const double margin( 0.95 );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Fill degree of the sparse operands [%].
+*/
+const size_t fill( 1UL );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Size of the dense matrices of the batch matrix multiplication.
+*/
+const size_t batchSize( 32UL );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Value representing an infinite threshold.
+*/
+const size_t never( std::numeric_limits<size_t>::max() );
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERAND SETUP
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements per row/column of a sparse operand.
+//
+// \param N The number of rows/columns of the operand.
+// \return The number of non-zero elements.
+*/
+inline size_t nonzeros( size_t N )
+{
+   return blaze::max( 1UL, ( N * fill ) / 100UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\name Operand setup functions */
+//@{
+template< typename Type, bool TF >
+void setup( blaze::DynamicVector<Type,TF>& v, size_t N )
+{
+   v.resize( N, false );
+   blazemark::blaze::init( v );
+}
+
+template< typename Type, bool TF >
+void setup( blaze::CompressedVector<Type,TF>& v, size_t N )
+{
+   v.resize( N, false );
+   v.reset();
+   blazemark::blaze::init( v, nonzeros( N ) );
+}
+
+template< typename Type, bool SO >
+void setup( blaze::DynamicMatrix<Type,SO>& m, size_t N )
+{
+   m.resize( N, N, false );
+   blazemark::blaze::init( m );
+}
+
+template< typename Type, bool SO >
+void setup( blaze::CompressedMatrix<Type,SO>& m, size_t N )
+{
+   m.resize( N, N, false );
+   m.reset();
+   blazemark::blaze::init( m, nonzeros( N ) );
+}
+
+void setup( Batch& batch, size_t N )
+{
+   batch.resize( N, false );
+}
+
+void setup( DMats& mats, size_t N )
+{
+   mats.resize( N );
+   for( size_t i=0UL; i<N; ++i ) {
+      mats[i].resize( batchSize, batchSize, false );
+      blazemark::blaze::init( mats[i] );
+   }
+}
+//@}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Addition of two operands.
+*/
+struct Add {
+   template< typename T1, typename T2, typename T3 >
+   static void apply( T1& c, const T2& a, const T3& b ) { c = a + b; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction of two operands.
+*/
+struct Sub {
+   template< typename T1, typename T2, typename T3 >
+   static void apply( T1& c, const T2& a, const T3& b ) { c = a - b; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of two operands.
+*/
+struct Mult {
+   template< typename T1, typename T2, typename T3 >
+   static void apply( T1& c, const T2& a, const T3& b ) { c = a * b; }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the first operand (the second operand is ignored).
+*/
+struct Scale {
+   template< typename T1, typename T2, typename T3 >
+   static void apply( T1& c, const T2& a, const T3& ) { c = a * element_t( 2 ); }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment of the first operand to a view on the target (the second operand is ignored).
+*/
+struct Copy {
+   template< typename T1, typename T2, typename T3 >
+   static void apply( T1& c, const T2& a, const T3& ) { view( c ) = a; }
+
+   template< typename Type, bool TF >
+   static blaze::DenseSubvector< blaze::DynamicVector<Type,TF> >
+      view( blaze::DynamicVector<Type,TF>& v ) { return subvector( v, 0UL, v.size() ); }
+
+   template< typename Type, bool SO >
+   static blaze::DenseSubmatrix< blaze::DynamicMatrix<Type,SO> >
+      view( blaze::DynamicMatrix<Type,SO>& m ) {
+      return submatrix( m, 0UL, 0UL, m.rows(), m.columns() );
+   }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of two batches of small matrices.
+*/
+struct BatchedMult {
+   static void apply( Batch& c, const Batch& a, const Batch& b ) { mult( c, a, b ); }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batch of independent dense matrix multiplications.
+*/
+struct BatchMult {
+   static void apply( DMats& c, const DMats& a, const DMats& b ) {
+      blaze::batchMult( a.begin(), a.end(), b.begin(), c.begin() );
+   }
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Base class for all kernels of the tuning process.
+*/
+class Kernel : private blaze::NonCopyable
+{
+ public:
+   virtual ~Kernel() {}
+   virtual void setup( size_t N ) = 0;
+   virtual void run() = 0;
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Kernel computing the operation \a OP on two operands of size \a N.
+*/
+template< typename OP    // Type of the operation
+        , typename TT    // Type of the target
+        , typename T1    // Type of the left-hand side operand
+        , typename T2 >  // Type of the right-hand side operand
+class BinaryKernel : public Kernel
+{
+ public:
+   virtual void setup( size_t N ) {
+      ::setup( c_, N );
+      ::setup( a_, N );
+      ::setup( b_, N );
+   }
+
+   virtual void run() {
+      OP::apply( c_, a_, b_ );
+   }
+
+ private:
+   TT c_;  //!< The target of the operation.
+   T1 a_;  //!< The left-hand side operand.
+   T2 b_;  //!< The right-hand side operand.
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Unit of a threshold.
+*/
+enum Unit {
+   dimension = 0,  //!< The threshold is a number of rows, columns or elements of a vector.
+   elements  = 1,  //!< The threshold is a number of matrix elements.
+   products  = 2   //!< The threshold is a number of multiply-add operations of a batch.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Range of problem sizes of a sweep.
+*/
+struct Range
+{
+   size_t first_;  //!< The smallest problem size of the sweep.
+   size_t last_;   //!< The largest problem size of the sweep.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\name Sweep ranges */
+//@{
+const Range dvRange       = {  1000UL, 4194304UL };  //!< Dense vector operations.
+const Range dmRange       = {    16UL,    2048UL };  //!< Dense matrix operations.
+const Range dmvRange      = {    16UL,    2048UL };  //!< Dense matrix/vector multiplications.
+const Range smvRange      = {    64UL,    8192UL };  //!< Sparse matrix/vector multiplications.
+const Range dmmRange      = {     8UL,     512UL };  //!< Dense matrix multiplications.
+const Range mixedRange    = {     8UL,    1024UL };  //!< Dense/sparse matrix multiplications.
+const Range smmRange      = {    16UL,    2048UL };  //!< Sparse matrix multiplications.
+const Range batchRange    = {    64UL,  262144UL };  //!< Number of matrices of a batch.
+const Range multRange     = {     2UL,     256UL };  //!< Number of products of a batch.
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief A single threshold to be tuned.
+*/
+struct Threshold
+{
+   const char* name_;    //!< The name of the threshold.
+   bool smp_;            //!< \a true for an SMP threshold, \a false for a kernel threshold.
+   Unit unit_;           //!< The unit of the threshold.
+   Range range_;         //!< The range of problem sizes of the sweep.
+   Kernel* kernel_;      //!< The kernel governed by the threshold.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a new SMP threshold.
+*/
+template< typename OP, typename TT, typename T1, typename T2 >
+Threshold smp( const char* name, const Range& range, Unit unit=dimension )
+{
+   const Threshold t = { name, true, unit, range, new BinaryKernel<OP,TT,T1,T2>() };
+   return t;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a new kernel selection threshold.
+*/
+template< typename OP, typename TT, typename T1, typename T2 >
+Threshold kernel( const char* name, const Range& range )
+{
+   const Threshold t = { name, false, elements, range, new BinaryKernel<OP,TT,T1,T2>() };
+   return t;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the list of all thresholds.
+//
+// \return The list of thresholds.
+*/
+std::vector<Threshold> createThresholds()
+{
+   std::vector<Threshold> t;
+
+#if BLAZE_BLAS_MODE
+   t.push_back( kernel<Mult,DVec,DMat,DVec>( "DMATDVECMULT_THRESHOLD", dmvRange ) );
+   t.push_back( kernel<Mult,DVec,TDMat,DVec>( "TDMATDVECMULT_THRESHOLD", dmvRange ) );
+   t.push_back( kernel<Mult,TDVec,TDVec,DMat>( "TDVECDMATMULT_THRESHOLD", dmvRange ) );
+   t.push_back( kernel<Mult,TDVec,TDVec,TDMat>( "TDVECTDMATMULT_THRESHOLD", dmvRange ) );
+   t.push_back( kernel<Mult,DMat,DMat,DMat>( "DMATDMATMULT_THRESHOLD", dmmRange ) );
+   t.push_back( kernel<Mult,DMat,DMat,TDMat>( "DMATTDMATMULT_THRESHOLD", dmmRange ) );
+   t.push_back( kernel<Mult,TDMat,TDMat,DMat>( "TDMATDMATMULT_THRESHOLD", dmmRange ) );
+   t.push_back( kernel<Mult,TDMat,TDMat,TDMat>( "TDMATTDMATMULT_THRESHOLD", dmmRange ) );
+#endif
+
+   t.push_back( smp<Copy,DVec,DVec,DVec>( "SMP_DVECASSIGN_THRESHOLD", dvRange ) );
+   t.push_back( smp<Add,DVec,DVec,DVec>( "SMP_DVECDVECADD_THRESHOLD", dvRange ) );
+   t.push_back( smp<Sub,DVec,DVec,DVec>( "SMP_DVECDVECSUB_THRESHOLD", dvRange ) );
+   t.push_back( smp<Mult,DVec,DVec,DVec>( "SMP_DVECDVECMULT_THRESHOLD", dvRange ) );
+   t.push_back( smp<Scale,DVec,DVec,DVec>( "SMP_DVECSCALARMULT_THRESHOLD", dvRange ) );
+
+   t.push_back( smp<Mult,DVec,DMat,DVec>( "SMP_DMATDVECMULT_THRESHOLD", dmvRange ) );
+   t.push_back( smp<Mult,DVec,TDMat,DVec>( "SMP_TDMATDVECMULT_THRESHOLD", dmvRange ) );
+   t.push_back( smp<Mult,TDVec,TDVec,DMat>( "SMP_TDVECDMATMULT_THRESHOLD", dmvRange ) );
+   t.push_back( smp<Mult,TDVec,TDVec,TDMat>( "SMP_TDVECTDMATMULT_THRESHOLD", dmvRange ) );
+   t.push_back( smp<Mult,DVec,DMat,SVec>( "SMP_DMATSVECMULT_THRESHOLD", dmvRange ) );
+   t.push_back( smp<Mult,DVec,TDMat,SVec>( "SMP_TDMATSVECMULT_THRESHOLD", dmvRange ) );
+   t.push_back( smp<Mult,TDVec,TSVec,DMat>( "SMP_TSVECDMATMULT_THRESHOLD", dmvRange ) );
+   t.push_back( smp<Mult,TDVec,TSVec,TDMat>( "SMP_TSVECTDMATMULT_THRESHOLD", dmvRange ) );
+
+   t.push_back( smp<Mult,DVec,SMat,DVec>( "SMP_SMATDVECMULT_THRESHOLD", smvRange ) );
+   t.push_back( smp<Mult,DVec,TSMat,DVec>( "SMP_TSMATDVECMULT_THRESHOLD", smvRange ) );
+   t.push_back( smp<Mult,TDVec,TDVec,SMat>( "SMP_TDVECSMATMULT_THRESHOLD", smvRange ) );
+   t.push_back( smp<Mult,TDVec,TDVec,TSMat>( "SMP_TDVECTSMATMULT_THRESHOLD", smvRange ) );
+   t.push_back( smp<Mult,DVec,SMat,SVec>( "SMP_SMATSVECMULT_THRESHOLD", smvRange ) );
+   t.push_back( smp<Mult,DVec,TSMat,SVec>( "SMP_TSMATSVECMULT_THRESHOLD", smvRange ) );
+   t.push_back( smp<Mult,TDVec,TSVec,SMat>( "SMP_TSVECSMATMULT_THRESHOLD", smvRange ) );
+   t.push_back( smp<Mult,TDVec,TSVec,TSMat>( "SMP_TSVECTSMATMULT_THRESHOLD", smvRange ) );
+
+   t.push_back( smp<Copy,DMat,DMat,DMat>( "SMP_DMATASSIGN_THRESHOLD", dmRange ) );
+   t.push_back( smp<Add,DMat,DMat,DMat>( "SMP_DMATDMATADD_THRESHOLD", dmRange ) );
+   t.push_back( smp<Add,DMat,DMat,TDMat>( "SMP_DMATTDMATADD_THRESHOLD", dmRange ) );
+   t.push_back( smp<Sub,DMat,DMat,DMat>( "SMP_DMATDMATSUB_THRESHOLD", dmRange ) );
+   t.push_back( smp<Sub,DMat,DMat,TDMat>( "SMP_DMATTDMATSUB_THRESHOLD", dmRange ) );
+   t.push_back( smp<Scale,DMat,DMat,DMat>( "SMP_DMATSCALARMULT_THRESHOLD", dmRange ) );
+
+   t.push_back( smp<Mult,DMat,DMat,DMat>( "SMP_DMATDMATMULT_THRESHOLD", dmmRange ) );
+   t.push_back( smp<Mult,DMat,DMat,TDMat>( "SMP_DMATTDMATMULT_THRESHOLD", dmmRange ) );
+   t.push_back( smp<Mult,TDMat,TDMat,DMat>( "SMP_TDMATDMATMULT_THRESHOLD", dmmRange ) );
+   t.push_back( smp<Mult,TDMat,TDMat,TDMat>( "SMP_TDMATTDMATMULT_THRESHOLD", dmmRange ) );
+
+   t.push_back( smp<Mult,DMat,DMat,SMat>( "SMP_DMATSMATMULT_THRESHOLD", mixedRange ) );
+   t.push_back( smp<Mult,DMat,DMat,TSMat>( "SMP_DMATTSMATMULT_THRESHOLD", mixedRange ) );
+   t.push_back( smp<Mult,TDMat,TDMat,SMat>( "SMP_TDMATSMATMULT_THRESHOLD", mixedRange ) );
+   t.push_back( smp<Mult,TDMat,TDMat,TSMat>( "SMP_TDMATTSMATMULT_THRESHOLD", mixedRange ) );
+   t.push_back( smp<Mult,DMat,SMat,DMat>( "SMP_SMATDMATMULT_THRESHOLD", mixedRange ) );
+   t.push_back( smp<Mult,DMat,SMat,TDMat>( "SMP_SMATTDMATMULT_THRESHOLD", mixedRange ) );
+   t.push_back( smp<Mult,TDMat,TSMat,DMat>( "SMP_TSMATDMATMULT_THRESHOLD", mixedRange ) );
+   t.push_back( smp<Mult,TDMat,TSMat,TDMat>( "SMP_TSMATTDMATMULT_THRESHOLD", mixedRange ) );
+
+   t.push_back( smp<Mult,DMat,SMat,SMat>( "SMP_SMATSMATMULT_THRESHOLD", smmRange ) );
+   t.push_back( smp<Mult,DMat,SMat,TSMat>( "SMP_SMATTSMATMULT_THRESHOLD", smmRange ) );
+   t.push_back( smp<Mult,TDMat,TSMat,SMat>( "SMP_TSMATSMATMULT_THRESHOLD", smmRange ) );
+   t.push_back( smp<Mult,TDMat,TSMat,TSMat>( "SMP_TSMATTSMATMULT_THRESHOLD", smmRange ) );
+
+   t.push_back( smp<Mult,DMat,DVec,TDVec>( "SMP_DVECTDVECMULT_THRESHOLD", dmRange ) );
+   t.push_back( smp<BatchedMult,Batch,Batch,Batch>( "SMP_BATCH_THRESHOLD", batchRange ) );
+   t.push_back( smp<BatchMult,DMats,DMats,DMats>( "SMP_BATCHMULT_THRESHOLD", multRange,
+                                                  products ) );
+
+   return t;
+}
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Converts the given problem size into the unit of the given threshold.
+//
+// \param t The threshold.
+// \param N The problem size.
+// \return The according value of the threshold.
+*/
+size_t convert( const Threshold& t, size_t N )
+{
+   switch( t.unit_ ) {
+      case elements: return N*N;
+      case products: return N*batchSize*batchSize*batchSize;
+      default      : return N;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures the runtime of a single execution of the given kernel.
+//
+// \param kernel The kernel to be measured.
+// \param serial \a true in case the kernel is executed within a serial section.
+// \return The minimum runtime of a single execution [s].
+*/
+double measure( Kernel& kernel, bool serial )
+{
+   blaze::timing::WcTimer timer;
+   size_t steps( 1UL );
+
+   kernel.run();
+
+   for( size_t rep=0UL; rep<blazemark::reps; )
+   {
+      timer.start();
+      if( serial ) {
+         BLAZE_SERIAL_SECTION {
+            for( size_t step=0UL; step<steps; ++step )
+               kernel.run();
+         }
+      }
+      else {
+         for( size_t step=0UL; step<steps; ++step )
+            kernel.run();
+      }
+      timer.end();
+
+      if( timer.last() < sampleTime ) {
+         timer.reset();
+         steps *= 2UL;
+         rep = 0UL;
+      }
+      else ++rep;
+   }
+
+   return timer.min() / steps;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Determines the crossover point of the given threshold.
+//
+// \param t The threshold to be tuned.
+// \param thresholds The list of all thresholds.
+// \param value The current value of the threshold.
+// \return The tuned value of the threshold.
+//
+// For SMP thresholds this function compares the single-threaded and the parallel execution of
+// the kernel of the threshold, for kernel thresholds it compares the Blaze kernel and the BLAS
+// kernel. The problem size is increased geometrically until the alternative execution is faster
+// for two consecutive problem sizes. In case no crossover is found, the larger of the current
+// value and the largest problem size is returned. SMP thresholds are not tuned in case only a
+// single thread is available.
+*/
+size_t tune( const Threshold& t, const std::vector<Threshold>& thresholds, size_t value )
+{
+   if( t.smp_ && blaze::getNumThreads() < 2UL ) {
+      std::cout << "\n " << t.name_ << ": skipped (no parallel execution available)\n";
+      return value;
+   }
+
+   for( size_t i=0UL; i<thresholds.size(); ++i ) {
+      if( thresholds[i].smp_ )
+         blaze::setThreshold( thresholds[i].name_, never );
+   }
+
+   std::cout << "\n " << t.name_ << ":\n"
+             << "     " << std::setw(12) << "N"
+             << std::setw(16) << ( t.smp_ ? "serial [s]" : "Blaze [s]" )
+             << std::setw(16) << ( t.smp_ ? "parallel [s]" : "BLAS [s]" ) << "\n";
+
+   size_t candidate( 0UL );
+
+   for( size_t N=t.range_.first_; N<=t.range_.last_; N=blaze::max( N+1UL, size_t( N*growth ) ) )
+   {
+      t.kernel_->setup( N );
+
+      blaze::setThreshold( t.name_, never );
+      const double before( measure( *t.kernel_, true ) );
+
+      blaze::setThreshold( t.name_, t.smp_ ? 0UL : 1UL );
+      const double after( measure( *t.kernel_, !t.smp_ ) );
+
+      std::cout << "     " << std::setw(12) << N
+                << std::setw(16) << before << std::setw(16) << after << std::endl;
+
+      if( after < margin*before ) {
+         if( candidate != 0UL )
+            break;
+         candidate = N;
+      }
+      else candidate = 0UL;
+   }
+
+   t.kernel_->setup( 0UL );
+   blaze::setThreshold( t.name_, value );
+
+   // All thresholds except for the kernel and the batch multiplication thresholds are exclusive
+   const bool inclusive( !t.smp_ || t.unit_ == products );
+
+   if( candidate == 0UL ) {
+      std::cout << "   No crossover found\n";
+      return blaze::max( value, convert( t, t.range_.last_ ) + ( inclusive ? 1UL : 0UL ) );
+   }
+
+   const size_t result( inclusive ? convert( t, candidate ) : convert( t, candidate ) - 1UL );
+   std::cout << "   Crossover at N = " << candidate << " (" << t.name_ << " = " << result << ")\n";
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes a replacement of the given threshold configuration file.
+//
+// \param input The name of the current threshold configuration file.
+// \param output The name of the output file.
+// \param values The tuned values of the thresholds.
+// \return void
+// \exception std::runtime_error Unable to read/write the configuration file.
+//
+// This function copies the given threshold configuration file and replaces the values of all
+// thresholds defined via the BLAZE_THRESHOLD macro by the tuned values.
+*/
+void writeHeader( const std::string& input, const std::string& output,
+                  const std::map<std::string,size_t>& values )
+{
+   std::ifstream in( input.c_str() );
+   if( !in )
+      throw std::runtime_error( "Unable to read '" + input + "'" );
+
+   std::ofstream out( output.c_str() );
+   if( !out )
+      throw std::runtime_error( "Unable to write '" + output + "'" );
+
+   std::string line;
+
+   while( std::getline( in, line ) )
+   {
+      const std::string prefix( "BLAZE_THRESHOLD( " );
+      const std::string::size_type comma( line.find( ',' ) );
+
+      if( line.compare( 0UL, prefix.size(), prefix ) == 0 && comma != std::string::npos ) {
+         const std::string name( line.substr( prefix.size(), comma-prefix.size() ) );
+         const std::map<std::string,size_t>::const_iterator pos( values.find( name ) );
+         if( pos != values.end() ) {
+            out << prefix << name << ", " << pos->second << "UL );\n";
+            continue;
+         }
+      }
+
+      out << line << "\n";
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes a threshold file for the runtime mode of the thresholds.
+//
+// \param output The name of the output file.
+// \param values The tuned values of the thresholds.
+// \return void
+// \exception std::runtime_error Unable to write the threshold file.
+*/
+void writeRuntimeFile( const std::string& output, const std::map<std::string,size_t>& values )
+{
+   std::ofstream out( output.c_str() );
+   if( !out )
+      throw std::runtime_error( "Unable to write '" + output + "'" );
+
+   out << "# Blaze thresholds tuned for " << blaze::getNumThreads() << " thread(s)\n";
+
+   for( std::map<std::string,size_t>::const_iterator it=values.begin(); it!=values.end(); ++it ) {
+      out << std::left << std::setw(32) << it->first << it->second << "\n";
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the tuning of the Blaze thresholds.
+//
+// \param argc The total number of command line arguments.
+// \param argv The array of command line arguments.
+// \return void
+//
+// The tuning tool measures the crossover points of all SMP thresholds and, in case BLAS is
+// enabled, of all BLAS kernel thresholds on the current machine with the current number of
+// threads. The results are written to a replacement of the \c blaze/config/Thresholds.h
+// configuration file (option \c -o, default "Thresholds.h") and to a threshold file for the
+// runtime mode of the thresholds (option \c -r, default "thresholds.cfg"). Optionally, the
+// tuning can be restricted to the thresholds given on the command line:
+
+   \code
+   BLAZE_NUM_THREADS=8 ./thresholds -o Thresholds.h SMP_DVECDVECADD_THRESHOLD
+   \endcode
+*/
+int main( int argc, char** argv )
+{
+   std::cout << "\n Threshold Tuning (" << blaze::getNumThreads() << " thread(s)):\n";
+
+   const std::string installPath( INSTALL_PATH );
+   const std::string input( installPath + "/../blaze/config/Thresholds.h" );
+   std::string header( "Thresholds.h" );
+   std::string runtime( "thresholds.cfg" );
+   std::vector<std::string> selection;
+
+   std::vector<Threshold> thresholds( createThresholds() );
+   std::map<std::string,size_t> values;
+
+   for( size_t i=0UL; i<thresholds.size(); ++i ) {
+      values[thresholds[i].name_] = blaze::getThreshold( thresholds[i].name_ );
+   }
+
+   for( int i=1; i<argc; ++i )
+   {
+      if( std::strcmp( argv[i], "-o" ) == 0 && i+1 < argc ) {
+         header = argv[++i];
+      }
+      else if( std::strcmp( argv[i], "-r" ) == 0 && i+1 < argc ) {
+         runtime = argv[++i];
+      }
+      else if( values.find( argv[i] ) != values.end() ) {
+         selection.push_back( argv[i] );
+      }
+      else {
+         std::cerr << "   Invalid command line argument '" << argv[i] << "'\n";
+         return EXIT_FAILURE;
+      }
+   }
+
+   ::blaze::setSeed( ::blazemark::seed );
+
+   try {
+      for( size_t i=0UL; i<thresholds.size(); ++i ) {
+         const std::string name( thresholds[i].name_ );
+         if( selection.empty() ||
+             std::find( selection.begin(), selection.end(), name ) != selection.end() )
+            values[name] = tune( thresholds[i], thresholds, values[name] );
+      }
+
+      writeHeader( input, header, values );
+      writeRuntimeFile( runtime, values );
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "   Error during threshold tuning: " << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   for( size_t i=0UL; i<thresholds.size(); ++i ) {
+      delete thresholds[i].kernel_;
+   }
+
+   std::cout << "\n   Tuned configuration file: " << header << "\n"
+             << "   Tuned threshold file    : " << runtime << "\n\n";
+}
+//*************************************************************************************************
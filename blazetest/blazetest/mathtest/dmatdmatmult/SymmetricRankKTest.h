@@ -0,0 +1,422 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dmatdmatmult/SymmetricRankKTest.h
+//  \brief Header file for the dense matrix/dense matrix symmetric rank-k update test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DMATDMATMULT_SYMMETRICRANKKTEST_H_
+#define _BLAZETEST_MATHTEST_DMATDMATMULT_SYMMETRICRANKKTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dmatdmatmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the dense matrix/dense matrix symmetric rank-k update test.
+//
+// This class represents a test suite for the multiplication of a dense matrix with its own
+// transpose (i.e. \f$ A*A^T \f$ for a row-major and \f$ A^T*A \f$ for a column-major matrix
+// \f$ A \f$), which is evaluated by means of a symmetric rank-k update. It performs a series
+// of runtime tests for several element types and for matrix sizes covering the vectorized
+// kernels, the BLAS kernels and the SMP assignment.
+*/
+class SymmetricRankKTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SymmetricRankKTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type >
+   void testProducts( const std::string& type );
+
+   template< typename Type >
+   void testProduct( size_t m, size_t n );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& computedResult, const T2& expectedResult );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   static void randomize( Type& value );
+
+   template< typename Type >
+   static void randomize( blaze::complex<Type>& value );
+
+   template< typename MT >
+   static void randomize( MT& matrix, size_t m, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the symmetric rank-k update for a particular element type.
+//
+// \param type The name of the element type.
+// \return void
+// \exception std::runtime_error Operation error detected.
+//
+// This function tests the products \f$ A*A^T \f$ and \f$ A^T*A \f$ for all matrix sizes up
+// to twice the width of the largest SIMD vector (which covers both the row pairs and the
+// remainder loops of the vectorized kernels), around the SMP threshold and above the BLAS
+// threshold.
+*/
+template< typename Type >  // Element type of the matrix operands
+void SymmetricRankKTest::testProducts( const std::string& type )
+{
+   const size_t inner[] = { 1UL, 7UL, 8UL, 9UL, 33UL };
+
+   const size_t smp ( blaze::SMP_DMATTDMATMULT_THRESHOLD );
+   const size_t blas( static_cast<size_t>( std::sqrt( double( blaze::DMATTDMATMULT_THRESHOLD ) ) ) );
+   const size_t outer[] = { smp, smp+1UL, smp+2UL, smp+9UL, blas+1UL };
+
+   for( size_t i=0UL; i<sizeof( inner )/sizeof( size_t ); ++i )
+   {
+      for( size_t m=1UL; m<=17UL; ++m ) {
+         test_ = "SYRK with element type " + type;
+         testProduct<Type>( m, inner[i] );
+      }
+
+      for( size_t j=0UL; j<sizeof( outer )/sizeof( size_t ); ++j ) {
+         test_ = "SMP/BLAS SYRK with element type " + type;
+         testProduct<Type>( outer[j], inner[i] );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the symmetric rank-k update of an \f$ M \times N \f$ matrix.
+//
+// \param m The number of rows of the row-major operand \f$ A \f$.
+// \param n The number of columns of the row-major operand \f$ A \f$.
+// \return void
+// \exception std::runtime_error Operation error detected.
+//
+// This function tests the plain, addition and subtraction assignment as well as the scaled
+// assignments of the products \f$ A*A^T \f$ and \f$ A^T*A \f$ to both row-major and
+// column-major target matrices. The operands are initialized with small integral values such
+// that the results are exact for all element types.
+*/
+template< typename Type >  // Element type of the matrix operands
+void SymmetricRankKTest::testProduct( size_t m, size_t n )
+{
+   typedef blaze::DynamicMatrix<Type,blaze::rowMajor>     DMat;
+   typedef blaze::DynamicMatrix<Type,blaze::columnMajor>  TDMat;
+
+   DMat A;
+   randomize( A, m, n );
+
+   const TDMat tA( trans( A ) );
+
+   DMat init;
+   randomize( init, m, m );
+
+   DMat ref( m, m );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<m; ++j ) {
+         Type sum = Type();
+         for( size_t k=0UL; k<n; ++k )
+            sum += A(i,k) * A(j,k);
+         ref(i,j) = sum;
+      }
+   }
+
+   const Type two( 2 );
+
+   {
+      std::ostringstream oss;
+      oss << test_ << " (" << m << "x" << n << ")";
+      test_ = oss.str();
+   }
+
+   // Row-major assignments
+   {
+      DMat C( m, m );
+
+      C = A * trans( A );
+      checkResult( C, ref );
+
+      C = trans( tA ) * tA;
+      checkResult( C, ref );
+
+      C = two * ( A * trans( A ) );
+      checkResult( C, two * ref );
+
+      C = trans( tA ) * tA * two;
+      checkResult( C, two * ref );
+
+      C = init;
+      C += A * trans( A );
+      checkResult( C, init + ref );
+
+      C = init;
+      C -= trans( tA ) * tA;
+      checkResult( C, init - ref );
+
+      C = init;
+      C += trans( tA ) * tA * two;
+      checkResult( C, init + two * ref );
+
+      C = init;
+      C -= two * ( A * trans( A ) );
+      checkResult( C, init - two * ref );
+   }
+
+   // Column-major assignments
+   {
+      TDMat C( m, m );
+
+      C = A * trans( A );
+      checkResult( C, ref );
+
+      C = trans( tA ) * tA;
+      checkResult( C, ref );
+
+      C = two * ( trans( tA ) * tA );
+      checkResult( C, two * ref );
+
+      C = A * trans( A ) * two;
+      checkResult( C, two * ref );
+
+      C = init;
+      C += trans( tA ) * tA;
+      checkResult( C, init + ref );
+
+      C = init;
+      C -= A * trans( A );
+      checkResult( C, init - ref );
+
+      C = init;
+      C += two * ( A * trans( A ) );
+      checkResult( C, init + two * ref );
+
+      C = init;
+      C -= trans( tA ) * tA * two;
+      checkResult( C, init - two * ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param computedResult The computed result.
+// \param expectedResult The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function is called after each test case to check and compare the computed result.
+// In case the computed and the expected result differ in any way, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename T1    // Matrix type of the computed result
+        , typename T2 >  // Matrix type of the expected result
+void SymmetricRankKTest::checkResult( const T1& computedResult, const T2& expectedResult )
+{
+   if( computedResult != expectedResult ) {
+      std::ostringstream oss;
+      oss.precision( 20 );
+      oss << " Test : " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Computed result:\n" << computedResult << "\n"
+          << "   Expected result:\n" << expectedResult << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given value with a small random integral value.
+//
+// \param value The value to be initialized.
+// \return void
+*/
+template< typename Type >  // Type of the value
+void SymmetricRankKTest::randomize( Type& value )
+{
+   value = static_cast<Type>( blaze::rand<int>( -4, 4 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given complex value with small random integral values.
+//
+// \param value The complex value to be initialized.
+// \return void
+*/
+template< typename Type >  // Type of the real and imaginary part
+void SymmetricRankKTest::randomize( blaze::complex<Type>& value )
+{
+   value = blaze::complex<Type>( static_cast<Type>( blaze::rand<int>( -4, 4 ) ),
+                                 static_cast<Type>( blaze::rand<int>( -4, 4 ) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given matrix with small random integral values.
+//
+// \param matrix The matrix to be initialized.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+*/
+template< typename MT >  // Type of the matrix
+void SymmetricRankKTest::randomize( MT& matrix, size_t m, size_t n )
+{
+   matrix.resize( m, n, false );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         randomize( matrix(i,j) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the dense matrix/dense matrix symmetric rank-k update.
+//
+// \return void
+*/
+void runTest()
+{
+   SymmetricRankKTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the dense matrix/dense matrix symmetric rank-k update test.
+*/
+#define RUN_DMATDMATMULT_SYMMETRICRANKK_TEST \
+   blazetest::mathtest::dmatdmatmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dmatdmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
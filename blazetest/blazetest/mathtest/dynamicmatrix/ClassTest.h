@@ -110,6 +110,7 @@ class ClassTest
    void testTranspose   ();
    void testSwap        ();
    void testIsDefault   ();
+   void testBatchMult   ();
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
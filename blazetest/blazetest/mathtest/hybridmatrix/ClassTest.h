@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <cmath>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -109,6 +111,9 @@ class ClassTest
    void testTranspose   ();
    void testSwap        ();
    void testIsDefault   ();
+   void testDeterminant ();
+   void testInversion   ();
+   void testSolve       ();
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
@@ -124,6 +129,9 @@ class ClassTest
 
    template< typename Type >
    void checkNonZeros( const Type& matrix, size_t index, size_t expectedNonZeros ) const;
+
+   template< typename Type >
+   void checkInverse( const Type& matrix ) const;
    //@}
    //**********************************************************************************************
 
@@ -501,6 +509,44 @@ void ClassTest::checkNonZeros( const Type& matrix, size_t index, size_t expected
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking the inverse of the given matrix.
+//
+// \param matrix The square matrix to be checked.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function computes the inverse of the given matrix via the inv() function and checks that
+// the product of the matrix and its inverse is the identity matrix. In case the product deviates
+// from the identity matrix, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the hybrid matrix
+void ClassTest::checkInverse( const Type& matrix ) const
+{
+   const Type inverse( inv( matrix ) );
+   const Type identity( matrix * inverse );
+
+   double error( 0.0 );
+   for( size_t i=0UL; i<rows( matrix ); ++i ) {
+      for( size_t j=0UL; j<columns( matrix ); ++j ) {
+         error = std::max( error, std::fabs( identity(i,j) - ( i == j ? 1.0 : 0.0 ) ) );
+      }
+   }
+
+   if( error > 1E-12 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inversion failed\n"
+          << " Details:\n"
+          << "   Matrix:\n" << matrix << "\n"
+          << "   Result:\n" << inverse << "\n"
+          << "   Product of the matrix and the result:\n" << identity << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
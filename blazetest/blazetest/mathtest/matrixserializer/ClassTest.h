@@ -92,9 +92,10 @@ class ClassTest
    //**Test functions******************************************************************************
    /*!\name Test functions */
    //@{
-   void testEmptyMatrices ();
-   void testRandomMatrices();
-   void testFailures      ();
+   void testEmptyMatrices        ();
+   void testRandomMatrices       ();
+   void testPartialDeserialization();
+   void testFailures             ();
 
    template< size_t M, size_t N, typename MT >
    void runAllTests( const MT& src );
@@ -117,6 +118,12 @@ class ClassTest
    template< typename MT1, typename MT2 >
    void runTest( const MT1& src, MT2& dst );
 
+   template< typename MT >
+   void runPartialTests( const MT& src );
+
+   template< typename MT1, typename MT2 >
+   void runPartialTest( const MT1& src, MT2& dst, size_t row, size_t column, size_t m, size_t n );
+
    template< typename Archive, typename MT >
    void testSerialization( Archive& archive, const MT& src );
 
@@ -401,6 +408,147 @@ void ClassTest::runTest( const MT1& src, MT2& dst )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Execution of several partial deserialization tests with the given source matrix.
+//
+// \param src The source matrix to be tested.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the partial deserialization of several submatrices of the given matrix,
+// using instances of DynamicMatrix, CompressedMatrix, DenseSubmatrix, and SparseSubmatrix as
+// destination matrix type. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename MT >  // Type of the matrix
+void ClassTest::runPartialTests( const MT& src )
+{
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( MT );
+
+   typedef typename MT::ElementType  ET;
+
+   const size_t M( src.rows() );
+   const size_t N( src.columns() );
+
+   const size_t regions[5][4] = { { 0UL, 0UL, M, N }, { 5UL, 3UL, 7UL, 9UL }, { 0UL, 4UL, M, 1UL },
+                                  { M-3UL, 0UL, 3UL, N }, { 2UL, 2UL, 0UL, 0UL } };
+
+   for( size_t r=0UL; r<5UL; ++r )
+   {
+      const size_t row   ( regions[r][0] );
+      const size_t column( regions[r][1] );
+      const size_t m     ( regions[r][2] );
+      const size_t n     ( regions[r][3] );
+
+      {
+         blaze::DynamicMatrix<ET,blaze::rowMajor> dst;
+         runPartialTest( src, dst, row, column, m, n );
+      }
+
+      {
+         blaze::DynamicMatrix<ET,blaze::columnMajor> dst( 3UL, 4UL );
+         randomize( dst );
+         runPartialTest( src, dst, row, column, m, n );
+      }
+
+      {
+         blaze::CompressedMatrix<ET,blaze::rowMajor> dst;
+         runPartialTest( src, dst, row, column, m, n );
+      }
+
+      {
+         blaze::CompressedMatrix<ET,blaze::columnMajor> dst( 3UL, 4UL );
+         randomize( dst );
+         runPartialTest( src, dst, row, column, m, n );
+      }
+
+      {
+         blaze::DynamicMatrix<ET,blaze::rowMajor> mat( m+2UL, n+3UL );
+         randomize( mat );
+         blaze::DenseSubmatrix< blaze::DynamicMatrix<ET,blaze::rowMajor> > dst( mat, 1UL, 2UL, m, n );
+         runPartialTest( src, dst, row, column, m, n );
+      }
+
+      {
+         blaze::CompressedMatrix<ET,blaze::columnMajor> mat( m+2UL, n+3UL );
+         randomize( mat );
+         blaze::SparseSubmatrix< blaze::CompressedMatrix<ET,blaze::columnMajor> > dst( mat, 2UL, 1UL, m, n );
+         runPartialTest( src, dst, row, column, m, n );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the partial deserialization of a submatrix of the given source matrix.
+//
+// \param src The source matrix to be serialized.
+// \param dst The destination matrix for the submatrix.
+// \param row The index of the first row of the submatrix.
+// \param column The index of the first column of the submatrix.
+// \param m The number of rows of the submatrix.
+// \param n The number of columns of the submatrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function serializes the given matrix both with and without offset table, followed by
+// a marker value, and deserializes the specified submatrix. Afterwards it checks the result
+// of the partial deserialization and that the read position is located behind the matrix. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the source matrix
+        , typename MT2 >  // Type of the destination matrix
+void ClassTest::runPartialTest( const MT1& src, MT2& dst, size_t row, size_t column, size_t m, size_t n )
+{
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( MT1 );
+   BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( MT2 );
+
+   for( int indexed=0; indexed<2; ++indexed )
+   {
+      blaze::Archive<std::stringstream> archive;
+
+      if( indexed )
+         serializeIndexed( archive, src );
+      else
+         archive << src;
+
+      archive << 42;
+
+      try {
+         deserialize( archive, dst, row, column, m, n );
+      }
+      catch( std::exception& ex ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Partial deserialization failed\n"
+             << " Details:\n"
+             << "   Offset table = " << ( indexed ? "yes" : "no" ) << "\n"
+             << "   Submatrix    = (" << row << "," << column << "," << m << "," << n << ")\n"
+             << "   Error message: " << ex.what() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      int marker( 0 );
+      archive >> marker;
+
+      if( !archive || marker != 42 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid read position after partial deserialization\n"
+             << " Details:\n"
+             << "   Offset table = " << ( indexed ? "yes" : "no" ) << "\n"
+             << "   Submatrix    = (" << row << "," << column << "," << m << "," << n << ")\n"
+             << "   Marker       = " << marker << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      compareMatrices( submatrix( src, row, column, m, n ), dst );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Testing the serialization process.
 //
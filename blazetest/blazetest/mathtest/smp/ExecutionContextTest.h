@@ -0,0 +1,195 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/ExecutionContextTest.h
+//  \brief Header file for the ExecutionContext test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_EXECUTIONCONTEXTTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_EXECUTIONCONTEXTTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the execution contexts.
+//
+// This class represents a test suite for the execution contexts of the C++11 and Boost thread
+// parallelization. It tests the concurrent execution of parallel operations by several
+// application threads, each using its own execution context, and the execution of parallel
+// operations from within the tasks of an execution context. In case neither the C++11 nor the
+// Boost thread parallelization is active, no tests are performed.
+*/
+class ExecutionContextTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ExecutionContextTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   //**Type definitions****************************************************************************
+   typedef blaze::DynamicMatrix<double>  MT;  //!< Type of the dense matrices.
+   typedef blaze::DynamicVector<double>  VT;  //!< Type of the dense vectors.
+   //**********************************************************************************************
+
+   //**Class Client********************************************************************************
+   /*!\brief Application thread performing matrix multiplications via an execution context.
+   //
+   // The client evaluates a series of matrix multiplications within an ExecutionScope of the
+   // given context (or via the default context in case no context is given) and counts the
+   // number of results that differ from the serially computed reference result.
+   */
+   struct Client
+   {
+      //**Function call operator*******************************************************************
+      void operator()() const;
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      blaze::ExecutionContext* context_;  //!< The execution context of the client (or 0).
+      size_t id_;                         //!< The ID of the client.
+      size_t expectedThreads_;            //!< The expected number of threads (0 for any).
+      size_t* errors_;                    //!< The number of detected errors.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Class NestedAssignment**********************************************************************
+   /*!\brief Task performing a parallel vector assignment.
+   */
+   struct NestedAssignment
+   {
+      //**Function call operator*******************************************************************
+      void operator()() const;
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      VT*       lhs_;     //!< The target vector.
+      const VT* rhs_;     //!< The source vector.
+      bool*     serial_;  //!< Flag for an active serial section within the task.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConcurrentContexts();
+   void testNestedOperations  ();
+   void testParallelSection   ();
+   //@}
+   //**********************************************************************************************
+#endif
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the execution contexts.
+//
+// \return void
+*/
+void runTest()
+{
+   ExecutionContextTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the ExecutionContext test.
+*/
+#define RUN_SMP_EXECUTIONCONTEXT_TEST \
+   blazetest::mathtest::smp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
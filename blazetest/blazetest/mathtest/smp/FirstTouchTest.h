@@ -0,0 +1,285 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/FirstTouchTest.h
+//  \brief Header file for the parallel first-touch initialization test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_FIRSTTOUCHTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_FIRSTTOUCHTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/smp/FirstTouch.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the parallel first-touch initialization.
+//
+// This class represents a test suite for the parallel first-touch initialization of the memory
+// of dense vectors and matrices. It checks that the elements and the padding elements of newly
+// allocated DynamicVector and DynamicMatrix instances are correctly initialized, both below
+// and above the SMP assignment thresholds.
+*/
+class FirstTouchTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit FirstTouchTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testFirstTouch ();
+   void testVector     ();
+   void testRowMajor   ();
+   void testColumnMajor();
+
+   template< typename Type >
+   void checkVector( const Type& vec, size_t size, double value ) const;
+
+   template< typename Type >
+   void checkMatrix( const Type& mat, size_t m, size_t n, double value ) const;
+
+   template< typename Type >
+   void checkPadding( const Type* array, size_t index, size_t size ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef blaze::DynamicVector<double,blaze::columnVector>  VT;   //!< Type of the dense vector.
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>      MT;   //!< Row-major dense matrix type.
+   typedef blaze::DynamicMatrix<double,blaze::columnMajor>   OMT;  //!< Column-major matrix type.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the elements of the given dense vector.
+//
+// \param vec The dense vector to be checked.
+// \param size The number of leading elements expected to be equal to \a value.
+// \param value The expected value of the leading elements.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the first \a size elements of the given dense vector are equal to
+// \a value and that all padding elements beyond the size of the vector are 0. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the dense vector
+void FirstTouchTest::checkVector( const Type& vec, size_t size, double value ) const
+{
+   for( size_t i=0UL; i<size; ++i ) {
+      if( vec[i] != value ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid vector element detected\n"
+             << " Details:\n"
+             << "   Size of the vector : " << vec.size() << "\n"
+             << "   Index              : " << i << "\n"
+             << "   Element            : " << vec[i] << "\n"
+             << "   Expected element   : " << value << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   checkPadding( vec.data(), vec.size(), vec.capacity() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the elements of the given dense matrix.
+//
+// \param mat The dense matrix to be checked.
+// \param m The number of leading rows expected to be equal to \a value.
+// \param n The number of leading columns expected to be equal to \a value.
+// \param value The expected value of the leading \f$ m \times n \f$ elements.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the leading \f$ m \times n \f$ elements of the given dense matrix
+// are equal to \a value and that all padding elements of all rows (columns in case of a
+// column-major matrix) are 0. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type >  // Type of the dense matrix
+void FirstTouchTest::checkMatrix( const Type& mat, size_t m, size_t n, double value ) const
+{
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( mat(i,j) != value ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid matrix element detected\n"
+                << " Details:\n"
+                << "   Number of rows    : " << mat.rows() << "\n"
+                << "   Number of columns : " << mat.columns() << "\n"
+                << "   Element (" << i << "," << j << ")   : " << mat(i,j) << "\n"
+                << "   Expected element  : " << value << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   const size_t lines( blaze::IsRowMajorMatrix<Type>::value ? mat.rows() : mat.columns() );
+   const size_t size ( blaze::IsRowMajorMatrix<Type>::value ? mat.columns() : mat.rows() );
+
+   for( size_t i=0UL; i<lines; ++i ) {
+      checkPadding( mat.data() + i*mat.spacing(), size, mat.spacing() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the padding elements of the given array.
+//
+// \param array The array to be checked.
+// \param index The index of the first padding element.
+// \param size The total number of elements of the array.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the elements in the range \f$ [index..size) \f$ of the given array
+// are 0. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the elements
+void FirstTouchTest::checkPadding( const Type* array, size_t index, size_t size ) const
+{
+   for( size_t i=index; i<size; ++i ) {
+      if( array[i] != Type() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid padding element detected\n"
+             << " Details:\n"
+             << "   Index            : " << i << "\n"
+             << "   Element          : " << array[i] << "\n"
+             << "   Expected element : " << Type() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the parallel first-touch initialization.
+//
+// \return void
+*/
+void runTest()
+{
+   FirstTouchTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the first-touch initialization test.
+*/
+#define RUN_SMP_FIRSTTOUCH_TEST \
+   blazetest::mathtest::smp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,213 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/staticmatrixbatch/ClassTest.h
+//  \brief Header file for the StaticMatrixBatch class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_STATICMATRIXBATCH_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_STATICMATRIXBATCH_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/StaticMatrixBatch.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace staticmatrixbatch {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the StaticMatrixBatch and StaticVectorBatch classes.
+//
+// This class represents a test suite for the blaze::StaticMatrixBatch and blaze::StaticVectorBatch
+// class templates and the according batch operations. It performs a series of both compile time
+// as well as runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::StaticMatrixBatch<int,2UL,3UL>  MBT;  //!< Type of the matrix batch.
+   typedef blaze::StaticVectorBatch<int,3UL>      VBT;  //!< Type of the vector batch.
+   typedef MBT::MatrixType                        MT;   //!< Type of a single matrix of the batch.
+   typedef VBT::VectorType                        VT;   //!< Type of a single vector of the batch.
+
+   typedef std::vector< MT, blaze::AlignedAllocator<MT> >  MatrixArray;  //!< Array of matrices.
+   typedef std::vector< VT, blaze::AlignedAllocator<VT> >  VectorArray;  //!< Array of vectors.
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors  ();
+   void testFunctionCall  ();
+   void testGatherScatter ();
+   void testResize        ();
+   void testSwap          ();
+   void testMultiplication();
+   void testAddition      ();
+   void testTransposition ();
+   void testInversion     ();
+   void testSolver        ();
+
+   template< typename Type >
+   void checkSize( const Type& batch, size_t expectedSize ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( MBT::ElementType, MT::ElementType );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( VBT::ElementType, VT::ElementType );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the size of the given batch.
+//
+// \param batch The batch to be checked.
+// \param expectedSize The expected number of matrices/vectors of the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of matrices/vectors of the given batch. In case the actual
+// size does not correspond to the given expected size, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type >  // Type of the batch
+void ClassTest::checkSize( const Type& batch, size_t expectedSize ) const
+{
+   if( batch.size() != expectedSize ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid batch size detected\n"
+          << " Details:\n"
+          << "   Size         : " << batch.size() << "\n"
+          << "   Expected size: " << expectedSize << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the StaticMatrixBatch and StaticVectorBatch class templates.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the StaticMatrixBatch class test.
+*/
+#define RUN_STATICMATRIXBATCH_CLASS_TEST \
+   blazetest::mathtest::staticmatrixbatch::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace staticmatrixbatch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,232 @@
+//=================================================================================================
+/*!
+//  \file blazetest/utiltest/compressedstream/ClassTest.h
+//  \brief Header file for the CompressedStream test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_UTILTEST_COMPRESSEDSTREAM_CLASSTEST_H_
+#define _BLAZETEST_UTILTEST_COMPRESSEDSTREAM_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/serialization/MatrixSerializer.h>
+#include <blaze/math/serialization/VectorSerializer.h>
+#include <blaze/util/Serialization.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace compressedstream {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the test of the CompressedStream class template.
+//
+// This class represents the collection of tests for the CompressedStream class template.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   typedef blaze::CompressedStream<std::stringstream>  Stream;  //!< Type of the compressed stream.
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testScalars();
+   void testDenseMatrix();
+   void testSparseMatrix();
+   void testVectors();
+   void testCompression();
+   void testConfiguration();
+   void testSerialSection();
+   void testFailures();
+
+   template< typename Type >
+   void runRoundTrip( const Type& src, int filters, size_t blockSize, size_t threads );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Serialization and deserialization of the given object via a compressed stream.
+//
+// \param src The object to be serialized.
+// \param filters The compression filters.
+// \param blockSize The size of the uncompressed blocks.
+// \param threads The number of threads.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function serializes the given object into a compressed stream with the given settings
+// and deserializes it again. In case the reconstituted object differs from the original object,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the serialized object
+void ClassTest::runRoundTrip( const Type& src, int filters, size_t blockSize, size_t threads )
+{
+   std::stringstream ss;
+
+   {
+      Stream stream( ss );
+      stream.setFilters( filters );
+      stream.setBlockSize( blockSize );
+      stream.setThreads( threads );
+
+      blaze::Archive<Stream> archive( stream );
+      archive << src;
+
+      if( archive.fail() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Serialization failed\n"
+             << " Details:\n"
+             << "   Filters    = " << filters << "\n"
+             << "   Block size = " << blockSize << "\n"
+             << "   Threads    = " << threads << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   Type dst;
+
+   {
+      Stream stream( ss );
+      stream.setThreads( threads );
+
+      blaze::Archive<Stream> archive( stream );
+      archive >> dst;
+
+      if( archive.fail() || dst != src ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Deserialization failed\n"
+             << " Details:\n"
+             << "   Filters    = " << filters << "\n"
+             << "   Block size = " << blockSize << "\n"
+             << "   Threads    = " << threads << "\n"
+             << "   Result:\n" << dst << "\n"
+             << "   Expected result:\n" << src << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the CompressedStream class template.
+//
+// \return void
+*/
+inline void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the CompressedStream class test.
+*/
+#define RUN_COMPRESSEDSTREAM_CLASS_TEST \
+   blazetest::utiltest::compressedstream::runTest();
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace compressedstream
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,1472 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/bandmatrix/ClassTest.cpp
+//  \brief Source file for the BandMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/DenseSubvector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Serialization.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Serialization.h>
+#include <blazetest/mathtest/bandmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace bandmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BandMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testScaling();
+   testFunctionCall();
+   testIterator();
+   testNonZeros();
+   testReset();
+   testClear();
+   testResize();
+   testBandwidths();
+   testSwap();
+   testIsDefault();
+   testMultiplication();
+   testSolvers();
+   testSerialization();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the BandMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the BandMatrix class template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "BandMatrix default constructor";
+
+      MT mat;
+
+      checkRows      ( mat, 0UL );
+      checkColumns   ( mat, 0UL );
+      checkNonZeros  ( mat, 0UL );
+      checkBandwidths( mat, 0UL, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "BandMatrix size constructor (4x5)";
+
+      MT mat( 4UL, 5UL, 1UL, 2UL );
+
+      checkRows      ( mat, 4UL );
+      checkColumns   ( mat, 5UL );
+      checkCapacity  ( mat, 20UL );
+      checkBandwidths( mat, 1UL, 2UL );
+
+      if( mat(0,3) != 0 || mat(2,0) != 0 || mat(3,1) != 0 || mat(0,4) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result: zero elements outside the band\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Homogeneous initialization
+   //=====================================================================================
+
+   {
+      test_ = "BandMatrix homogeneous initialization constructor (3x3)";
+
+      MT mat( 3UL, 3UL, 1UL, 0UL, 2 );
+
+      checkRows      ( mat, 3UL );
+      checkColumns   ( mat, 3UL );
+      checkNonZeros  ( mat, 5UL );
+      checkNonZeros  ( mat, 0UL, 1UL );
+      checkNonZeros  ( mat, 1UL, 2UL );
+      checkNonZeros  ( mat, 2UL, 2UL );
+      checkBandwidths( mat, 1UL, 0UL );
+
+      if( mat(0,0) != 2 || mat(0,1) != 0 || mat(0,2) != 0 ||
+          mat(1,0) != 2 || mat(1,1) != 2 || mat(1,2) != 0 ||
+          mat(2,0) != 0 || mat(2,1) != 2 || mat(2,2) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 0 0 )\n( 2 2 0 )\n( 0 2 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "BandMatrix copy constructor (3x4)";
+
+      MT mat1( 3UL, 4UL, 0UL, 1UL, 0 );
+      mat1(0,1) = 1;
+      mat1(2,2) = 2;
+      mat1(2,3) = 3;
+
+      MT mat2( mat1 );
+
+      checkRows      ( mat2, 3UL );
+      checkColumns   ( mat2, 4UL );
+      checkNonZeros  ( mat2, 3UL );
+      checkNonZeros  ( mat2, 0UL, 1UL );
+      checkNonZeros  ( mat2, 1UL, 0UL );
+      checkNonZeros  ( mat2, 2UL, 2UL );
+      checkBandwidths( mat2, 0UL, 1UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Conversion constructors
+   //=====================================================================================
+
+   {
+      test_ = "BandMatrix dense matrix constructor";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> tmp( 4UL, 3UL, 0 );
+      tmp(0,0) = 1;
+      tmp(0,1) = 2;
+      tmp(2,1) = 3;
+      tmp(3,2) = 4;
+
+      MT mat1( tmp );
+      MT mat2( trans( trans( tmp ) ) );
+
+      checkRows      ( mat1, 4UL );
+      checkColumns   ( mat1, 3UL );
+      checkNonZeros  ( mat1, 4UL );
+      checkBandwidths( mat1, 1UL, 1UL );
+      checkBandwidths( mat2, 1UL, 1UL );
+
+      if( mat1 != tmp || mat2 != tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n" << tmp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BandMatrix dense matrix constructor with bandwidths";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> tmp( 3UL, 3UL, 0 );
+      tmp(1,0) = 1;
+      tmp(2,2) = 2;
+
+      MT mat( tmp, 2UL, 1UL );
+
+      checkNonZeros  ( mat, 2UL );
+      checkBandwidths( mat, 2UL, 1UL );
+
+      mat(0,1) = 3;
+      mat(2,0) = 4;
+
+      if( mat(1,0) != 1 || mat(2,2) != 2 || mat(0,1) != 3 || mat(2,0) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 3 0 )\n( 1 0 0 )\n( 4 0 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BandMatrix sparse matrix constructor stress test";
+
+      for( size_t i=0UL; i<100UL; ++i )
+      {
+         const size_t m ( blaze::rand<size_t>( 0UL, 30UL ) );
+         const size_t n ( blaze::rand<size_t>( 0UL, 30UL ) );
+         const size_t kl( blaze::rand<size_t>( 0UL, 5UL ) );
+         const size_t ku( blaze::rand<size_t>( 0UL, 5UL ) );
+
+         blaze::CompressedMatrix<int,blaze::rowMajor> tmp( m, n );
+         for( size_t j=0UL; j<m; ++j ) {
+            const size_t jbegin( ( j > kl )?( j-kl ):( 0UL ) );
+            const size_t jend  ( blaze::min( n, j+ku+1UL ) );
+            if( jbegin < jend && blaze::rand<int>( 0, 1 ) )
+               tmp( j, blaze::rand<size_t>( jbegin, jend-1UL ) ) = blaze::rand<int>( 1, 10 );
+         }
+
+         const blaze::CompressedMatrix<int,blaze::columnMajor> tmp2( tmp );
+
+         const MT mat1( tmp );
+         const MT mat2( tmp2 );
+
+         if( mat1 != tmp || mat2 != tmp || nonZeros( mat1 ) != nonZeros( tmp ) ||
+             mat1.lowerBandwidth() > kl || mat1.upperBandwidth() > ku ||
+             mat2.lowerBandwidth() != mat1.lowerBandwidth() ||
+             mat2.upperBandwidth() != mat1.upperBandwidth() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Construction failed\n"
+                << " Details:\n"
+                << "   Result (row-major matrix):\n" << mat1 << "\n"
+                << "   Result (column-major matrix):\n" << mat2 << "\n"
+                << "   Expected result:\n" << tmp << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "BandMatrix constructor with too small bandwidths";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> tmp( 3UL, 3UL, 0 );
+      tmp(2,0) = 1;
+
+      try {
+         MT mat( tmp, 1UL, 1UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup with too small bandwidths succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BandMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the BandMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   blaze::DynamicMatrix<int,blaze::rowMajor> tmp( 3UL, 4UL, 0 );
+   tmp(0,0) = 1;
+   tmp(0,1) = 2;
+   tmp(1,1) = 3;
+   tmp(2,1) = 4;
+   tmp(2,3) = 5;
+
+   {
+      test_ = "BandMatrix homogeneous assignment";
+
+      MT mat( 3UL, 4UL, 1UL, 1UL );
+      mat = 4;
+
+      checkNonZeros( mat, 8UL );
+
+      if( mat(0,0) != 4 || mat(0,1) != 4 || mat(0,2) != 0 || mat(2,1) != 4 || mat(2,3) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 4 4 0 0 )\n( 4 4 4 0 )\n( 0 4 4 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BandMatrix copy assignment";
+
+      const MT mat1( tmp );
+      MT mat2;
+      mat2 = mat1;
+
+      checkRows      ( mat2, 3UL );
+      checkColumns   ( mat2, 4UL );
+      checkNonZeros  ( mat2, 5UL );
+      checkBandwidths( mat2, 1UL, 1UL );
+
+      if( mat2 != tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << tmp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BandMatrix addition/subtraction/multiplication assignment";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> tmp2( 3UL, 4UL, 0 );
+      tmp2(2,0) = 6;
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> tmp3( 4UL, 4UL, 0 );
+      tmp3(0,0) = 1;
+      tmp3(1,2) = 2;
+      tmp3(3,3) = 3;
+
+      MT mat( tmp );
+      mat += tmp2;
+      mat -= tmp * 3;
+
+      checkBandwidths( mat, 2UL, 1UL );
+
+      mat *= tmp3;
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> ref( ( tmp2 - tmp * 2 ) * tmp3 );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BandMatrix aliased assignment";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> diag( 3UL, 4UL, 0 );
+      diag(0,0) = 1;
+      diag(1,1) = 3;
+
+      MT mat( tmp );
+      mat = mat - ( tmp - diag );
+
+      checkNonZeros  ( mat, 2UL );
+      checkBandwidths( mat, 0UL, 0UL );
+
+      if( mat != diag ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << diag << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BandMatrix assignment of a matrix of different size";
+
+      MT mat( tmp );
+
+      try {
+         mat += blaze::DynamicMatrix<int,blaze::rowMajor>( 4UL, 4UL, 0 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment of matrix of different size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( mat != tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed assignment modified the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << tmp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of all BandMatrix (self-)scaling operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all available ways to scale an instance of the BandMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testScaling()
+{
+   test_ = "BandMatrix self-scaling";
+
+   MT mat( 3UL, 3UL, 1UL, 1UL, 0 );
+   mat(0,0) = 1;
+   mat(1,2) = 2;
+
+   mat *= 3;
+   mat.scale( 2 );
+   mat /= 3;
+
+   if( mat(0,0) != 2 || mat(1,1) != 0 || mat(1,2) != 4 || nonZeros( mat ) != 2UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Scaling failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n( 2 0 0 )\n( 0 0 4 )\n( 0 0 0 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BandMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the function call operator of the BandMatrix class template.
+// The elements within the band can be modified freely, whereas any write access to an element
+// outside the band has to fail. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   test_ = "BandMatrix::operator()";
+
+   MT mat( 3UL, 4UL, 1UL, 0UL, 0 );
+   mat(0,0) = 1;
+   mat(1,0) = 2;
+   mat(1,0) += 3;
+   mat(2,1) = 4;
+   mat(2,1) *= 2;
+
+   checkNonZeros( mat, 3UL );
+
+   if( mat(0,0) != 1 || mat(1,0) != 5 || mat(2,1) != 8 || mat(1,2) != 0 ||
+       mat.band()(1,0) != 5 || mat.band()(0,0) != 1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Function call operator failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n( 1 0 0 0 )\n( 5 0 0 0 )\n( 0 8 0 0 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      mat(2,0) = 5;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Assignment to matrix element outside the band succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      mat(0,1) += 1;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Addition assignment to matrix element outside the band succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BandMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the BandMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   MT mat( 3UL, 3UL, 0UL, 1UL, 0 );
+   mat(0,0) = 1;
+   mat(0,1) = 2;
+   mat(2,2) = 3;
+
+   {
+      test_ = "BandMatrix iterator/const iterator conversion";
+
+      MT::ConstIterator it( begin( mat, 1UL ) );
+
+      if( it == end( mat, 1UL ) || *it != 0 || end( mat, 1UL ) - it != 3L ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed iterator conversion detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BandMatrix iterator traversal";
+
+      int sum( 0 );
+      for( size_t i=0UL; i<3UL; ++i )
+         for( MT::ConstIterator it=mat.cbegin(i); it!=mat.cend(i); ++it )
+            sum += *it;
+
+      if( sum != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator traversal failed\n"
+             << " Details:\n"
+             << "   Sum of all elements         : " << sum << "\n"
+             << "   Expected sum of all elements: 6\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BandMatrix assignment via iterator";
+
+      MT::Iterator it( mat.begin( 1UL ) );
+      ++it;
+      *it = 4;
+      ++it;
+      *it = 5;
+
+      try {
+         *mat.begin( 1UL ) = 6;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment to matrix element outside the band via iterator succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( mat(1,0) != 0 || mat(1,1) != 4 || mat(1,2) != 5 || mat(2,2) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment via iterator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 0 )\n( 0 4 5 )\n( 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the BandMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the BandMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "BandMatrix::nonZeros()";
+
+   MT mat( 4UL, 4UL, 1UL, 1UL, 0 );
+
+   checkNonZeros( mat, 0UL );
+
+   mat(0,0) = 1;
+   mat(0,1) = 2;
+   mat(2,1) = 3;
+   mat(3,3) = 4;
+
+   checkNonZeros( mat, 4UL );
+   checkNonZeros( mat, 0UL, 2UL );
+   checkNonZeros( mat, 1UL, 0UL );
+   checkNonZeros( mat, 2UL, 1UL );
+   checkNonZeros( mat, 3UL, 1UL );
+
+   mat(0,0) = 0;
+
+   checkNonZeros( mat, 3UL );
+   checkNonZeros( mat, 0UL, 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the BandMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the BandMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   test_ = "BandMatrix::reset()";
+
+   MT mat( 3UL, 3UL, 1UL, 1UL, 1 );
+
+   reset( mat, 1UL );
+
+   checkRows      ( mat, 3UL );
+   checkNonZeros  ( mat, 4UL );
+   checkNonZeros  ( mat, 1UL, 0UL );
+   checkBandwidths( mat, 1UL, 1UL );
+
+   if( mat(0,0) != 1 || mat(1,0) != 0 || mat(1,1) != 0 || mat(1,2) != 0 || mat(2,1) != 1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reset operation failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n( 1 1 0 )\n( 0 0 0 )\n( 0 1 1 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   reset( mat );
+
+   checkRows      ( mat, 3UL );
+   checkNonZeros  ( mat, 0UL );
+   checkBandwidths( mat, 1UL, 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the BandMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the BandMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "BandMatrix::clear()";
+
+   MT mat( 3UL, 4UL, 1UL, 1UL, 1 );
+
+   clear( mat );
+
+   checkRows    ( mat, 0UL );
+   checkColumns ( mat, 0UL );
+   checkNonZeros( mat, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c resize() member function of the BandMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c resize() member function of the BandMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "BandMatrix::resize()";
+
+   MT mat( 2UL, 2UL, 1UL, 1UL, 0 );
+   mat(0,0) = 1;
+   mat(0,1) = 2;
+   mat(1,1) = 3;
+
+   mat.resize( 4UL, 5UL, true );
+
+   checkRows      ( mat, 4UL );
+   checkColumns   ( mat, 5UL );
+   checkNonZeros  ( mat, 3UL );
+   checkBandwidths( mat, 1UL, 1UL );
+
+   mat(3,4) = 4;
+
+   checkNonZeros( mat, 4UL );
+
+   mat.resize( 2UL, 2UL, true );
+
+   checkRows    ( mat, 2UL );
+   checkColumns ( mat, 2UL );
+   checkNonZeros( mat, 3UL );
+
+   mat.reserve( 10UL );
+
+   checkCapacity( mat, 10UL );
+
+   if( mat(0,0) != 1 || mat(0,1) != 2 || mat(1,0) != 0 || mat(1,1) != 3 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resizing the matrix failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n( 1 2 )\n( 0 3 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c setBandwidths() member function of the BandMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c setBandwidths() member function of the BandMatrix
+// class template. Extending the band has to preserve all elements, whereas any attempt to
+// shrink the band such that non-zero elements would be lost has to fail. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testBandwidths()
+{
+   test_ = "BandMatrix::setBandwidths()";
+
+   MT mat( 4UL, 4UL, 1UL, 0UL, 0 );
+   mat(0,0) = 1;
+   mat(2,1) = 2;
+   mat(3,3) = 3;
+
+   mat.setBandwidths( 2UL, 2UL );
+
+   checkBandwidths( mat, 2UL, 2UL );
+   checkNonZeros  ( mat, 3UL );
+
+   mat(0,2) = 4;
+   mat(3,1) = 5;
+
+   try {
+      mat.setBandwidths( 1UL, 2UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Shrinking the band with non-zero elements succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   checkBandwidths( mat, 2UL, 2UL );
+
+   mat(3,1) = 0;
+   mat.setBandwidths( 1UL, 2UL );
+
+   checkBandwidths( mat, 1UL, 2UL );
+   checkNonZeros  ( mat, 4UL );
+
+   if( mat(0,0) != 1 || mat(0,2) != 4 || mat(2,1) != 2 || mat(3,3) != 3 || mat(3,1) != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Changing the bandwidths failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n( 1 0 4 0 )\n( 0 0 0 0 )\n( 0 2 0 0 )\n( 0 0 0 3 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the BandMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the BandMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "BandMatrix swap";
+
+   MT mat1( 2UL, 2UL, 0UL, 0UL, 1 );
+   MT mat2( 3UL, 4UL, 1UL, 2UL, 0 );
+   mat2(2,1) = 2;
+
+   swap( mat1, mat2 );
+
+   checkRows      ( mat1, 3UL );
+   checkColumns   ( mat1, 4UL );
+   checkNonZeros  ( mat1, 1UL );
+   checkBandwidths( mat1, 1UL, 2UL );
+   checkRows      ( mat2, 2UL );
+   checkNonZeros  ( mat2, 2UL );
+   checkBandwidths( mat2, 0UL, 0UL );
+
+   if( mat1(2,1) != 2 || mat2(0,0) != 1 || mat2(1,0) != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the matrices failed\n"
+          << " Details:\n"
+          << "   First matrix:\n" << mat1 << "\n"
+          << "   Second matrix:\n" << mat2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the BandMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the BandMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   MT mat( 3UL, 3UL, 1UL, 1UL, 0 );
+
+   if( isDefault( mat ) != false || isDefault( MT() ) != true ||
+       isDefault( mat(0,2) ) != true ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid isDefault evaluation\n"
+          << " Details:\n"
+          << "   Matrix:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BandMatrix multiplication kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the band kernels of the matrix/vector and vector/matrix multiplication
+// (including submatrices of the band matrix and subvector targets, as they occur during the
+// parallel execution) and the matrix/matrix multiplication by comparing the results with the
+// multiplication of a general dense matrix. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>         DMT;
+   typedef blaze::BandMatrix<double>                            BMT;
+   typedef blaze::DynamicVector<double,blaze::columnVector>     DVT;
+   typedef blaze::DynamicVector<double,blaze::rowVector>        TDVT;
+   typedef blaze::CompressedVector<double,blaze::columnVector>  SVT;
+
+   const size_t sizes[] = { 0UL, 1UL, 3UL, 8UL, 17UL, 64UL, 129UL };
+   const size_t bands[] = { 0UL, 1UL, 2UL, 5UL, 20UL };
+
+   for( size_t a=0UL; a<sizeof(sizes)/sizeof(size_t); ++a ) {
+      for( size_t b=0UL; b<sizeof(bands)/sizeof(size_t); ++b )
+      {
+         const size_t m ( sizes[a] );
+         const size_t n ( sizes[a] + 3UL );
+         const size_t kl( bands[b] );
+         const size_t ku( bands[(b+2UL)%(sizeof(bands)/sizeof(size_t))] );
+
+         BMT D( m, n, kl, ku );
+         for( size_t i=0UL; i<m; ++i ) {
+            const size_t jbegin( ( i > kl )?( i-kl ):( 0UL ) );
+            const size_t jend  ( blaze::min( n, i+ku+1UL ) );
+            for( size_t j=jbegin; j<jend; ++j )
+               D(i,j) = blaze::rand<int>( -10, 10 );
+         }
+
+         const DMT A( D );
+
+         DMT B( n, 5UL );
+         for( size_t i=0UL; i<n; ++i )
+            for( size_t j=0UL; j<5UL; ++j )
+               B(i,j) = blaze::rand<int>( -10, 10 );
+
+         DVT x( n );
+         for( size_t j=0UL; j<n; ++j )
+            x[j] = blaze::rand<int>( -10, 10 );
+
+         DVT z( m );
+         for( size_t i=0UL; i<m; ++i )
+            z[i] = blaze::rand<int>( -10, 10 );
+
+         SVT s( n );
+         for( size_t j=0UL; j<n; j+=3UL )
+            s[j] = blaze::rand<int>( 1, 10 );
+
+         {
+            test_ = "BandMatrix/vector multiplication";
+
+            const DVT  ref1( A * x );
+            const DVT  ref2( A * s );
+            const TDVT ref3( trans( z ) * A );
+            const DVT  one ( m, 1.0 );
+            const TDVT tone( n, 1.0 );
+            DVT  y1( one ), y2( one ), y3( one ), y4( one );
+            TDVT y5( tone ), y6( tone );
+
+            y1  = D * x;
+            y2 += D * x;
+            y3 -= D * s;
+            y4  = D * s;
+            y5 -= trans( z ) * D;
+            y6 += trans( z ) * D;
+
+            bool failure( y1 != ref1 || y2 != one + ref1 || y3 != one - ref2 || y4 != ref2 ||
+                          y5 != tone - ref3 || y6 != tone + ref3 );
+
+            if( m > 2UL )
+            {
+               const DVT r1( submatrix( A, 1UL, 0UL, m-2UL, n ) * x );
+               const DVT r2( submatrix( A, 1UL, 2UL, m-2UL, n-3UL ) * subvector( x, 1UL, n-3UL ) );
+               const DVT r3( submatrix( A, 0UL, 1UL, m-2UL, n-2UL ) * subvector( s, 0UL, n-2UL ) );
+               const TDVT r4( trans( subvector( z, 1UL, m-2UL ) ) *
+                              submatrix( A, 2UL, 1UL, m-2UL, n-1UL ) );
+
+               const DVT s1( submatrix( D, 1UL, 0UL, m-2UL, n ) * x );
+               const DVT s3( submatrix( D, 0UL, 1UL, m-2UL, n-2UL ) * subvector( s, 0UL, n-2UL ) );
+               const TDVT s4( trans( subvector( z, 1UL, m-2UL ) ) *
+                              submatrix( D, 2UL, 1UL, m-2UL, n-1UL ) );
+
+               DVT s2( m, 0.0 );
+               subvector( s2, 1UL, m-2UL ) =
+                  submatrix( D, 1UL, 2UL, m-2UL, n-3UL ) * subvector( x, 1UL, n-3UL );
+
+               failure = failure || s1 != r1 || subvector( s2, 1UL, m-2UL ) != r2 || s3 != r3 ||
+                         s4 != r4;
+            }
+
+            if( failure ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication failed\n"
+                   << " Details:\n"
+                   << "   Matrix size: " << m << "x" << n << "\n"
+                   << "   Bandwidths : " << kl << "/" << ku << "\n"
+                   << "   Result:\n" << y1 << "\n"
+                   << "   Expected result:\n" << ref1 << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         {
+            test_ = "BandMatrix/dense matrix multiplication";
+
+            const DMT ref( A * B );
+            DMT C1, C2( m, 5UL, 1.0 );
+
+            C1  = D * B;
+            C2 -= D * B;
+
+            if( C1 != ref || C2 != DMT( m, 5UL, 1.0 ) - ref ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication failed\n"
+                   << " Details:\n"
+                   << "   Matrix size: " << m << "x" << n << "\n"
+                   << "   Bandwidths : " << kl << "/" << ku << "\n"
+                   << "   Result:\n" << C1 << "\n"
+                   << "   Expected result:\n" << ref << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the band LU, band Cholesky and tridiagonal solvers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the direct solvers for band and tridiagonal systems by solving systems
+// with a known solution. The LU decomposition is tested with matrices that require pivoting.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSolvers()
+{
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>      DMT;
+   typedef blaze::BandMatrix<double>                         BMT;
+   typedef blaze::DynamicVector<double,blaze::columnVector>  DVT;
+
+   const size_t sizes[] = { 1UL, 2UL, 7UL, 33UL, 100UL };
+   const size_t bands[] = { 0UL, 1UL, 3UL };
+
+   for( size_t a=0UL; a<sizeof(sizes)/sizeof(size_t); ++a ) {
+      for( size_t b=0UL; b<sizeof(bands)/sizeof(size_t); ++b )
+      {
+         const size_t n ( sizes[a] );
+         const size_t kl( bands[b] );
+         const size_t ku( bands[(b+1UL)%(sizeof(bands)/sizeof(size_t))] );
+
+         DVT x( n );
+         for( size_t i=0UL; i<n; ++i )
+            x[i] = blaze::rand<int>( -10, 10 );
+
+         {
+            test_ = "Band LU decomposition";
+
+            BMT A( n, n, kl, ku );
+            for( size_t i=0UL; i<n; ++i ) {
+               const size_t jbegin( ( i > kl )?( i-kl ):( 0UL ) );
+               const size_t jend  ( blaze::min( n, i+ku+1UL ) );
+               for( size_t j=jbegin; j<jend; ++j )
+                  A(i,j) = blaze::rand<int>( -10, 10 );
+               A(i,i) = 12.0*( kl+ku+1UL );
+            }
+
+            if( kl > 0UL && ku > 0UL ) {
+               for( size_t i=0UL; i+1UL<n; i+=2UL ) {
+                  A(i    ,i+1UL) = A(i,i);
+                  A(i+1UL,i    ) = A(i,i);
+                  A(i    ,i    ) = 1.0;
+                  A(i+1UL,i+1UL) = 1.0;
+               }
+            }
+
+            const DMT ref( A );
+            const DVT rhs( ref * x );
+            DVT y1( rhs ), y2( rhs );
+
+            BMT LU( A );
+            std::vector<size_t> pivots;
+            lu( LU, pivots );
+            luSolve( LU, pivots, y1 );
+            solve( A, y2 );
+
+            double error( 0.0 );
+            for( size_t i=0UL; i<n; ++i )
+               error = blaze::max( error, std::fabs( y1[i] - x[i] ), std::fabs( y2[i] - x[i] ) );
+
+            if( LU.lowerBandwidth() != kl || LU.upperBandwidth() != kl+ku || error > 1E-8 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Solving the band system failed\n"
+                   << " Details:\n"
+                   << "   Matrix size: " << n << "x" << n << "\n"
+                   << "   Bandwidths : " << kl << "/" << ku << "\n"
+                   << "   Result:\n" << y1 << "\n"
+                   << "   Expected result:\n" << x << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         {
+            test_ = "Band Cholesky decomposition";
+
+            BMT A( n, n, kl, kl );
+            for( size_t i=0UL; i<n; ++i ) {
+               const size_t jbegin( ( i > kl )?( i-kl ):( 0UL ) );
+               for( size_t j=jbegin; j<i; ++j ) {
+                  A(i,j) = blaze::rand<int>( -10, 10 );
+                  A(j,i) = A(i,j);
+               }
+               A(i,i) = 21.0*( 2UL*kl+1UL );
+            }
+
+            const DMT ref( A );
+            DVT y( ref * x );
+
+            llh( A );
+            llhSolve( A, y );
+
+            const DMT L( A );
+            const DMT R( L * trans( L ) );
+
+            double error( 0.0 );
+            for( size_t i=0UL; i<n; ++i ) {
+               error = blaze::max( error, std::fabs( y[i] - x[i] ) );
+               for( size_t j=0UL; j<n; ++j )
+                  error = blaze::max( error, std::fabs( R(i,j) - ref(i,j) ) );
+            }
+
+            if( A.upperBandwidth() != 0UL || error > 1E-8 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Solving the band system failed\n"
+                   << " Details:\n"
+                   << "   Matrix size: " << n << "x" << n << "\n"
+                   << "   Bandwidth  : " << kl << "\n"
+                   << "   Result:\n" << y << "\n"
+                   << "   Expected result:\n" << x << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Tridiagonal solver";
+
+      const size_t n( 50UL );
+
+      BMT T( n, n, 1UL, 1UL );
+      for( size_t i=0UL; i<n; ++i ) {
+         T(i,i) = 4.0 + i%3UL;
+         if( i > 0UL   ) T(i,i-1UL) = -1.0;
+         if( i < n-1UL ) T(i,i+1UL) = -2.0;
+      }
+
+      DVT x( n );
+      for( size_t i=0UL; i<n; ++i )
+         x[i] = blaze::rand<int>( -10, 10 );
+
+      DVT y( DMT( T ) * x );
+      solveTridiagonal( T, y );
+
+      double error( 0.0 );
+      for( size_t i=0UL; i<n; ++i )
+         error = blaze::max( error, std::fabs( y[i] - x[i] ) );
+
+      if( error > 1E-10 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the tridiagonal system failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Batched tridiagonal solver";
+
+      const size_t sizes2[] = { 1UL, 2UL, 17UL };
+      const size_t counts[] = { 1UL, 3UL, 8UL, 37UL, 300UL };
+
+      for( size_t a=0UL; a<sizeof(sizes2)/sizeof(size_t); ++a ) {
+         for( size_t b=0UL; b<sizeof(counts)/sizeof(size_t); ++b )
+         {
+            const size_t n( sizes2[a] );
+            const size_t s( counts[b] );
+
+            DMT lower( n, s ), diag( n, s ), upper( n, s ), X( n, s ), B( n, s );
+
+            for( size_t i=0UL; i<n; ++i ) {
+               for( size_t k=0UL; k<s; ++k ) {
+                  lower(i,k) = blaze::rand<int>( -2, 2 );
+                  upper(i,k) = blaze::rand<int>( -2, 2 );
+                  diag (i,k) = blaze::rand<int>( 5, 9 );
+                  X    (i,k) = blaze::rand<int>( -10, 10 );
+               }
+            }
+
+            for( size_t i=0UL; i<n; ++i ) {
+               for( size_t k=0UL; k<s; ++k ) {
+                  B(i,k) = diag(i,k) * X(i,k);
+                  if( i > 0UL   ) B(i,k) += lower(i,k) * X(i-1UL,k);
+                  if( i < n-1UL ) B(i,k) += upper(i,k) * X(i+1UL,k);
+               }
+            }
+
+            DMT B2( B );
+
+            solveTridiagonal( lower, diag, upper, B );
+            solveTridiagonal( submatrix( lower, 0UL, 0UL, n, s ), diag,
+                              trans( trans( upper ) ), B2 );
+
+            double error( 0.0 );
+            for( size_t i=0UL; i<n; ++i )
+               for( size_t k=0UL; k<s; ++k )
+                  error = blaze::max( error, std::fabs( B (i,k) - X(i,k) ),
+                                             std::fabs( B2(i,k) - X(i,k) ) );
+
+            if( error > 1E-10 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Solving the tridiagonal systems failed\n"
+                   << " Details:\n"
+                   << "   Number of systems: " << s << "\n"
+                   << "   System size      : " << n << "\n"
+                   << "   Result:\n" << B << "\n"
+                   << "   Expected result:\n" << X << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Band solvers with invalid matrices";
+
+      BMT A( 3UL, 3UL, 1UL, 1UL, 0.0 );
+      A(0,0) = 1.0;
+      DVT y( 3UL, 1.0 );
+      std::vector<size_t> pivots;
+
+      bool singular( false );
+
+      try {
+         lu( A, pivots );
+      }
+      catch( std::runtime_error& ) {
+         singular = true;
+      }
+
+      if( !singular ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: LU decomposition of singular matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      BMT B( 3UL, 3UL, 1UL, 1UL, -1.0 );
+      bool indefinite( false );
+
+      try {
+         llh( B );
+      }
+      catch( std::runtime_error& ) {
+         indefinite = true;
+      }
+
+      if( !indefinite ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Cholesky decomposition of indefinite matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      BMT C( 3UL, 3UL, 2UL, 0UL, 1.0 );
+
+      try {
+         solveTridiagonal( C, y );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Tridiagonal solve with non-tridiagonal matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the serialization of the BandMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the serialization and deserialization of instances of the
+// BandMatrix class template. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testSerialization()
+{
+   {
+      test_ = "BandMatrix serialization";
+
+      MT mat1( 5UL, 6UL, 2UL, 1UL, 0 );
+      mat1(0,0) = 1;
+      mat1(2,0) = 2;
+      mat1(3,4) = 3;
+      mat1(4,5) = 4;
+
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+      archive << mat1;
+
+      MT mat2( 2UL, 2UL, 0UL, 0UL, 7 );
+      archive >> mat2;
+
+      checkRows      ( mat2, 5UL );
+      checkColumns   ( mat2, 6UL );
+      checkNonZeros  ( mat2, 4UL );
+      checkBandwidths( mat2, 2UL, 1UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Serialization failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BandMatrix deserialization of a general matrix";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat1( 4UL, 3UL );
+      mat1(0,2) = 1;
+      mat1(3,1) = 2;
+
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+      archive << mat1;
+
+      MT mat2;
+      archive >> mat2;
+
+      checkRows      ( mat2, 4UL );
+      checkColumns   ( mat2, 3UL );
+      checkNonZeros  ( mat2, 2UL );
+      checkBandwidths( mat2, 2UL, 2UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Deserialization failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace bandmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running BandMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_BANDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during BandMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
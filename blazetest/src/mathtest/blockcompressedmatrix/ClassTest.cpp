@@ -0,0 +1,1273 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/blockcompressedmatrix/ClassTest.cpp
+//  \brief Source file for the BlockCompressedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/DenseSubvector.h>
+#include <blaze/math/SparseSubmatrix.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/blockcompressedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace blockcompressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BlockCompressedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testScaling();
+   testFunctionCall();
+   testIterator();
+   testNonZeros();
+   testReset();
+   testClear();
+   testSwap();
+   testFind();
+   testLowerBound();
+   testUpperBound();
+   testIsDefault();
+   testAppend();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the BlockCompressedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix default constructor";
+
+      MT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix size constructor (0x4)";
+
+      MT mat( 0UL, 4UL );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "BlockCompressedMatrix size constructor (3x4)";
+
+      MT mat( 3UL, 4UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 0UL );
+
+      if( mat(0,0) != 0 || mat(1,3) != 0 || mat(2,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 0 )\n( 0 0 0 0 )\n( 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BlockCompressedMatrix size constructor (index type range)";
+
+      try {
+         blaze::BlockCompressedMatrix<int,2UL,3UL,unsigned char> mat( 3UL, 769UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Exceeding the range of the index type succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Size/Capacity constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix size/capacity constructor (3x4,2)";
+
+      MT mat( 3UL, 4UL, 2UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 12UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix copy constructor (2x3)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 2UL, 3UL );
+      tmp(0,0) = 1;
+      tmp(0,1) = 2;
+      tmp(1,1) = 3;
+      tmp(1,2) = 4;
+
+      MT mat1( tmp );
+      MT mat2( mat1 );
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 6UL );
+      checkNonZeros( mat2, 0UL, 3UL );
+      checkNonZeros( mat2, 1UL, 3UL );
+
+      if( mat2(0,0) != 1 || mat2(0,1) != 2 || mat2(0,2) != 0 ||
+          mat2(1,0) != 0 || mat2(1,1) != 3 || mat2(1,2) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 2 0 )\n( 0 3 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Conversion constructors
+   //=====================================================================================
+
+   {
+      test_ = "BlockCompressedMatrix dense matrix constructor";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> tmp( 3UL, 4UL, 0 );
+      tmp(0,3) = 1;
+      tmp(1,0) = 2;
+      tmp(1,1) = 3;
+      tmp(1,3) = 4;
+      tmp(2,2) = 5;
+
+      MT mat( tmp );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 11UL );
+      checkNonZeros( mat, 0UL, 4UL );
+      checkNonZeros( mat, 1UL, 4UL );
+      checkNonZeros( mat, 2UL, 3UL );
+
+      if( mat != tmp || mat.nonZeroBlocks() != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Number of non-zero blocks         : " << mat.nonZeroBlocks() << "\n"
+             << "   Expected number of non-zero blocks: 3\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << tmp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BlockCompressedMatrix column-major sparse matrix constructor";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> tmp( 3UL, 4UL );
+      tmp(0,3) = 1;
+      tmp(1,0) = 2;
+      tmp(1,1) = 3;
+      tmp(1,3) = 4;
+      tmp(2,2) = 5;
+
+      MT mat( tmp );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 11UL );
+
+      if( mat != tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << tmp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BlockCompressedMatrix sparse matrix constructor stress test";
+
+      for( size_t i=0UL; i<100UL; ++i )
+      {
+         const size_t rows   ( blaze::rand<size_t>( 0UL, 40UL ) );
+         const size_t columns( blaze::rand<size_t>( 0UL, 20UL ) );
+
+         blaze::CompressedMatrix<int,blaze::rowMajor> tmp( rows, columns );
+         for( size_t j=0UL; j<rows*columns/8UL; ++j ) {
+            tmp( blaze::rand<size_t>( 0UL, rows-1UL ), blaze::rand<size_t>( 0UL, columns-1UL ) ) =
+               blaze::rand<int>( 1, 10 );
+         }
+
+         const MT mat( tmp );
+         const blaze::DynamicMatrix<int,blaze::rowMajor> back( mat );
+
+         if( mat != tmp || back != tmp ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Construction failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Conversion back:\n" << back << "\n"
+                << "   Expected result:\n" << tmp << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the BlockCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "BlockCompressedMatrix copy assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 2UL, 3UL );
+      tmp(0,0) = 1;
+      tmp(0,1) = 2;
+      tmp(1,1) = 3;
+      tmp(1,2) = 4;
+
+      const MT mat1( tmp );
+      MT mat2( 5UL, 5UL, 4UL );
+      mat2 = mat1;
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 6UL );
+
+      if( mat2 != tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 2 0 )\n( 0 3 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BlockCompressedMatrix sparse matrix assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 3UL, 5UL );
+      tmp(0,4) = 1;
+      tmp(2,0) = 2;
+
+      MT mat( 5UL, 5UL, 4UL );
+      mat = tmp;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 5UL );
+      checkNonZeros( mat, 7UL );
+
+      if( mat != tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 0 1 )\n( 0 0 0 0 0 )\n( 2 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BlockCompressedMatrix sparse matrix expression assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 2UL, 3UL );
+      tmp(0,2) = 1;
+      tmp(1,0) = 2;
+
+      MT mat;
+      mat = 2 * tmp;
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 6UL );
+
+      if( mat(0,2) != 2 || mat(1,0) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 2 )\n( 4 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of all BlockCompressedMatrix (self-)scaling operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all available ways to scale an instance of the
+// BlockCompressedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testScaling()
+{
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 3UL, 3UL );
+   tmp(0,0) =  1;
+   tmp(1,2) = -2;
+   tmp(2,1) =  3;
+
+   {
+      test_ = "BlockCompressedMatrix self-scaling (M*=s)";
+
+      MT mat( tmp );
+      mat *= 2;
+
+      checkNonZeros( mat, 9UL );
+
+      if( mat(0,0) != 2 || mat(1,2) != -4 || mat(2,1) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 0 0 )\n( 0 0 -4 )\n( 0 6 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BlockCompressedMatrix self-scaling (M/=s)";
+
+      MT mat( 4 * tmp );
+      mat /= 2;
+
+      checkNonZeros( mat, 9UL );
+
+      if( mat(0,0) != 2 || mat(1,2) != -4 || mat(2,1) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 0 0 )\n( 0 0 -4 )\n( 0 6 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BlockCompressedMatrix::scale()";
+
+      MT mat( tmp );
+      mat.scale( 3 );
+
+      checkNonZeros( mat, 9UL );
+
+      if( mat(0,0) != 3 || mat(1,2) != -6 || mat(2,1) != 9 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 3 0 0 )\n( 0 0 -6 )\n( 0 9 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of accessing elements via the function call operator of the
+// BlockCompressedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   test_ = "BlockCompressedMatrix::operator()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 5UL, 7UL );
+   tmp(0,6) = 1;
+   tmp(2,0) = 2;
+   tmp(2,3) = 3;
+   tmp(2,4) = 4;
+   tmp(4,1) = 5;
+   tmp(4,6) = 6;
+
+   const MT mat( tmp );
+
+   checkRows    ( mat, 5UL );
+   checkColumns ( mat, 7UL );
+   checkNonZeros( mat, 18UL );
+
+   for( size_t i=0UL; i<5UL; ++i ) {
+      for( size_t j=0UL; j<7UL; ++j ) {
+         if( mat(i,j) != tmp(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Function call operator failed\n"
+                << " Details:\n"
+                << "   Position: (" << i << "," << j << ")\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n" << tmp << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   typedef MT::Iterator       Iterator;
+   typedef MT::ConstIterator  ConstIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 3UL, 5UL );
+   tmp(0,1) =  1;
+   tmp(1,0) = -2;
+   tmp(1,2) = -3;
+   tmp(1,4) =  4;
+   tmp(2,3) =  5;
+
+   MT mat( tmp );
+
+   // Testing conversion from Iterator to ConstIterator
+   {
+      test_ = "Iterator/ConstIterator conversion";
+
+      ConstIterator it( begin( mat, 1UL ) );
+
+      if( it == end( mat, 1UL ) || it->value() != -2 || it->index() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed iterator conversion detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Counting the number of elements in the second row (including the clipped last block)
+   {
+      test_ = "Iterator subtraction";
+
+      const size_t number( end( mat, 1UL ) - begin( mat, 1UL ) );
+
+      if( number != 5UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 5\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing read-only access via ConstIterator
+   {
+      test_ = "Read-only access via ConstIterator";
+
+      ConstIterator it ( cbegin( mat, 1UL ) );
+      ConstIterator end( cend( mat, 1UL ) );
+
+      const int values[] = { -2, 0, -3, 0, 4 };
+
+      for( size_t k=0UL; k<5UL; ++k, ++it ) {
+         if( it == end || it->value() != values[k] || it->index() != k ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Iterator access failed at element " << k << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( it != end ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator end not reached\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing assignment via Iterator
+   {
+      test_ = "Assignment via Iterator";
+
+      int value = 7;
+
+      for( Iterator it=begin( mat, 1UL ); it!=end( mat, 1UL ); ++it ) {
+         *it = value++;
+      }
+
+      if( mat(1,0) != 7 || mat(1,1) != 8 || mat(1,2) != 9 || mat(1,3) != 10 || mat(1,4) != 11 ||
+          mat(0,1) != 1 || mat(2,3) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment via iterator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 0 0 0 )\n( 7 8 9 10 11 )\n( 0 0 0 5 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing addition/subtraction/multiplication/division assignment via Iterator
+   {
+      test_ = "Compound assignment via Iterator";
+
+      Iterator it( begin( mat, 1UL ) );
+      it->value() += 2;
+      ++it;
+      *it -= 2;
+      ++it;
+      *it *= 2;
+      *begin( mat, 2UL ) /= 5;
+
+      if( mat(1,0) != 9 || mat(1,1) != 6 || mat(1,2) != 18 || mat(2,3) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Compound assignment via iterator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 0 0 0 )\n( 9 6 18 10 11 )\n( 0 0 0 1 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "BlockCompressedMatrix::nonZeros()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 3UL, 4UL );
+   tmp(0,0) = 1;
+   tmp(0,2) = 2;
+   tmp(0,3) = 3;
+   tmp(2,1) = 4;
+
+   const MT mat( tmp );
+
+   checkRows    ( mat, 3UL );
+   checkColumns ( mat, 4UL );
+   checkNonZeros( mat, 11UL );
+   checkNonZeros( mat, 0UL, 4UL );
+   checkNonZeros( mat, 1UL, 4UL );
+   checkNonZeros( mat, 2UL, 3UL );
+   checkCapacity( mat, 18UL );
+   checkCapacity( mat, 0UL, 6UL );
+   checkCapacity( mat, 2UL, 3UL );
+
+   if( mat.nonZeroBlocks() != 3UL || mat.nonZeroBlocks( 0UL ) != 2UL || mat.nonZeroBlocks( 1UL ) != 1UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero blocks\n"
+          << " Details:\n"
+          << "   Number of non-zero blocks         : " << mat.nonZeroBlocks() << "\n"
+          << "   Expected number of non-zero blocks: 3\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 3UL, 4UL );
+   tmp(0,0) = 1;
+   tmp(0,2) = 2;
+   tmp(1,1) = 3;
+   tmp(2,3) = 4;
+
+   {
+      test_ = "BlockCompressedMatrix::reset( size_t )";
+
+      MT mat( tmp );
+      reset( mat, 0UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 7UL );
+      checkNonZeros( mat, 0UL, 3UL );
+      checkNonZeros( mat, 1UL, 3UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat(0,0) != 0 || mat(0,2) != 0 || mat(1,1) != 3 || mat(2,3) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reset operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 0 )\n( 0 3 0 0 )\n( 0 0 0 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "BlockCompressedMatrix::reset()";
+
+      MT mat( tmp );
+      reset( mat );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+
+      if( mat != blaze::CompressedMatrix<int,blaze::rowMajor>( 3UL, 4UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reset operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 0 )\n( 0 0 0 0 )\n( 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() function with the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() function with the BlockCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "BlockCompressedMatrix::clear()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 3UL, 4UL );
+   tmp(0,0) = 1;
+   tmp(2,3) = 2;
+
+   MT mat( tmp );
+   clear( mat );
+
+   checkRows    ( mat, 0UL );
+   checkColumns ( mat, 0UL );
+   checkNonZeros( mat, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the BlockCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "BlockCompressedMatrix swap";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp1( 2UL, 2UL );
+   tmp1(0,0) = 1;
+   tmp1(1,1) = 2;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp2( 3UL, 1UL );
+   tmp2(2,0) = 3;
+
+   MT mat1( tmp1 );
+   MT mat2( tmp2 );
+
+   swap( mat1, mat2 );
+
+   checkRows    ( mat1, 3UL );
+   checkColumns ( mat1, 1UL );
+   checkNonZeros( mat1, 1UL );
+   checkRows    ( mat2, 2UL );
+   checkColumns ( mat2, 2UL );
+   checkNonZeros( mat2, 4UL );
+
+   if( mat1 != tmp2 || mat2 != tmp1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the first matrix failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat1 << "\n" << mat2 << "\n"
+          << "   Expected result:\n" << tmp2 << "\n" << tmp1 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c find() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find() member function of the BlockCompressedMatrix
+// class template. Elements within non-zero blocks are expected to be found, all other elements
+// are expected to be missing. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testFind()
+{
+   test_ = "BlockCompressedMatrix::find()";
+
+   typedef MT::ConstIterator  ConstIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 8UL, 8UL );
+   tmp(1,2) = 1;
+   tmp(2,3) = 2;
+   tmp(6,0) = 3;
+   tmp(6,1) = 4;
+   tmp(7,7) = 5;
+
+   const MT mat( tmp );
+
+   for( size_t i=0UL; i<8UL; ++i ) {
+      for( size_t j=0UL; j<8UL; ++j )
+      {
+         const ConstIterator pos( mat.find( i, j ) );
+
+         bool stored( false );
+         for( size_t k=i/2UL*2UL; k<i/2UL*2UL+2UL; ++k )
+            for( size_t l=j/3UL*3UL; l<std::min<size_t>( j/3UL*3UL+3UL, 8UL ); ++l )
+               stored = stored || !isDefault( tmp(k,l) );
+
+         if( !stored && pos != mat.end( i ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Non-existing element could be found\n"
+                << " Details:\n"
+                << "   Required position = (" << i << "," << j << ")\n"
+                << "   Found index       = " << pos->index() << "\n"
+                << "   Current matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         else if( stored &&
+                  ( pos == mat.end( i ) || pos->index() != j || pos->value() != tmp(i,j) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Element could not be found\n"
+                << " Details:\n"
+                << "   Required position = (" << i << "," << j << ")\n"
+                << "   Current matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c lowerBound() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c lowerBound() member function of the
+// BlockCompressedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testLowerBound()
+{
+   test_ = "BlockCompressedMatrix::lowerBound()";
+
+   typedef MT::ConstIterator  ConstIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 4UL, 12UL );
+   tmp(1,1) = 1;
+   tmp(1,7) = 2;
+
+   const MT mat( tmp );
+
+   const size_t expected[] = { 0UL, 1UL, 2UL, 6UL, 6UL, 6UL, 6UL, 7UL, 8UL, 12UL, 12UL, 12UL };
+
+   for( size_t j=0UL; j<12UL; ++j )
+   {
+      const ConstIterator pos( mat.lowerBound( 1UL, j ) );
+      const size_t index( pos == mat.end( 1UL ) ? 12UL : pos->index() );
+
+      if( index != expected[j] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Wrong element found\n"
+             << " Details:\n"
+             << "   Required index = " << j << "\n"
+             << "   Found index    = " << index << "\n"
+             << "   Expected index = " << expected[j] << "\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   if( mat.lowerBound( 3UL, 3UL ) != mat.end( 3UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Element found in empty row\n"
+          << " Details:\n"
+          << "   Current matrix:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c upperBound() member function of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c upperBound() member function of the
+// BlockCompressedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testUpperBound()
+{
+   test_ = "BlockCompressedMatrix::upperBound()";
+
+   typedef MT::ConstIterator  ConstIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 4UL, 12UL );
+   tmp(1,1) = 1;
+   tmp(1,7) = 2;
+
+   const MT mat( tmp );
+
+   const size_t expected[] = { 1UL, 2UL, 6UL, 6UL, 6UL, 6UL, 7UL, 8UL, 12UL, 12UL, 12UL, 12UL };
+
+   for( size_t j=0UL; j<12UL; ++j )
+   {
+      const ConstIterator pos( mat.upperBound( 1UL, j ) );
+      const size_t index( pos == mat.end( 1UL ) ? 12UL : pos->index() );
+
+      if( index != expected[j] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Wrong element found\n"
+             << " Details:\n"
+             << "   Required index = " << j << "\n"
+             << "   Found index    = " << index << "\n"
+             << "   Expected index = " << expected[j] << "\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the BlockCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   {
+      MT mat;
+
+      if( isDefault( mat ) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      MT mat( 2UL, 3UL );
+
+      if( isDefault( mat ) != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the low-level block interface of the BlockCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the \c reserve(), \c appendBlock(), and \c finalizeBlockRow() functions
+// as well as the low-level block access of the BlockCompressedMatrix class template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAppend()
+{
+   test_ = "BlockCompressedMatrix::appendBlock()";
+
+   typedef blaze::StaticMatrix<int,2UL,3UL,blaze::rowMajor>  BT;
+
+   BT block1( 0 ), block2( 0 ), block3( 0 );
+   block1(0,0) = 1;
+   block1(1,2) = 2;
+   block2(0,0) = 3;
+   block2(1,0) = 4;
+   block3(0,1) = 5;
+   block3(0,2) = 6;
+
+   MT mat( 5UL, 7UL );
+   mat.reserve( 1UL );
+   mat.appendBlock( 0UL, 0UL, block1 );
+   mat.reserve( 3UL );
+   mat.appendBlock( 0UL, 2UL, block2 );
+   mat.finalizeBlockRow( 0UL );
+   mat.finalizeBlockRow( 1UL );
+   mat.appendBlock( 2UL, 1UL, block3 );
+   mat.finalizeBlockRow( 2UL );
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> ref( 5UL, 7UL );
+   ref(0,0) = 1;
+   ref(1,2) = 2;
+   ref(0,6) = 3;
+   ref(1,6) = 4;
+   ref(4,4) = 5;
+   ref(4,5) = 6;
+
+   checkRows    ( mat, 5UL );
+   checkColumns ( mat, 7UL );
+   checkCapacity( mat, 18UL );
+   checkNonZeros( mat, 11UL );
+   checkNonZeros( mat, 0UL, 4UL );
+   checkNonZeros( mat, 2UL, 0UL );
+   checkNonZeros( mat, 4UL, 3UL );
+
+   if( mat != ref ||
+       mat.blockBegin( 0UL ) != 0UL || mat.blockEnd( 0UL ) != 2UL ||
+       mat.blockBegin( 1UL ) != 2UL || mat.blockEnd( 1UL ) != 2UL ||
+       mat.blockBegin( 2UL ) != 2UL || mat.blockEnd( 2UL ) != 3UL ||
+       mat.blockIndex( 1UL ) != 2UL || mat.block( 2UL )(0,2) != 6 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Appending blocks failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockCompressedMatrix/dense vector and dense matrix multiplications.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the multiplication of a BlockCompressedMatrix with a dense vector and
+// a dense matrix with the according multiplication of a CompressedMatrix for matrices of various
+// sizes, including submatrices and compound assignments. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   test_ = "BlockCompressedMatrix/dense vector multiplication";
+
+   typedef blaze::CompressedMatrix<double,blaze::rowMajor>         CMT;
+   typedef blaze::BlockCompressedMatrix<double,3UL,2UL>            BMT;
+   typedef blaze::DynamicVector<double,blaze::columnVector>        DVT;
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>            DMT;
+   typedef blaze::DynamicMatrix<double,blaze::columnMajor>         TDMT;
+
+   const size_t sizes[] = { 0UL, 1UL, 3UL, 8UL, 17UL, 64UL, 129UL };
+
+   for( size_t a=0UL; a<sizeof(sizes)/sizeof(size_t); ++a ) {
+      for( size_t b=0UL; b<sizeof(sizes)/sizeof(size_t); ++b )
+      {
+         const size_t m( sizes[a] );
+         const size_t n( sizes[b] );
+
+         CMT A( m, n );
+         for( size_t i=0UL; i<m; ++i ) {
+            const size_t nonzeros( n == 0UL ? 0UL : blaze::rand<size_t>( 0UL, std::min<size_t>( n, 10UL ) ) );
+            for( size_t j=0UL; j<nonzeros; ++j )
+               A( i, blaze::rand<size_t>( 0UL, n-1UL ) ) = blaze::rand<int>( -10, 10 );
+         }
+
+         DVT x( n );
+         for( size_t j=0UL; j<n; ++j )
+            x[j] = blaze::rand<int>( -10, 10 );
+
+         DMT X( n, 5UL );
+         for( size_t i=0UL; i<n; ++i )
+            for( size_t j=0UL; j<5UL; ++j )
+               X(i,j) = blaze::rand<int>( -10, 10 );
+
+         const BMT B( A );
+
+         test_ = "BlockCompressedMatrix/dense vector multiplication";
+
+         {
+            const DVT ref( A * x );
+            const DVT one( m, 1.0 );
+            DVT y1( one ), y2( one ), y3( one );
+
+            y1  = B * x;
+            y2 += B * x;
+            y3 -= B * x;
+
+            bool failure( y1 != ref || y2 != one + ref || y3 != one - ref );
+
+            if( m > 2UL && n > 2UL )
+            {
+               const DVT r1( submatrix( A, 1UL, 0UL, m-2UL, n ) * x );
+               const DVT r2( submatrix( A, 1UL, 1UL, m-2UL, n-2UL ) * subvector( x, 1UL, n-2UL ) );
+
+               const DVT s1( submatrix( B, 1UL, 0UL, m-2UL, n ) * x );
+               const DVT s2( submatrix( B, 1UL, 1UL, m-2UL, n-2UL ) * subvector( x, 1UL, n-2UL ) );
+
+               failure = failure || s1 != r1 || s2 != r2;
+            }
+
+            if( failure ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication failed\n"
+                   << " Details:\n"
+                   << "   Matrix size: " << m << "x" << n << "\n"
+                   << "   Result:\n" << y1 << "\n"
+                   << "   Expected result:\n" << ref << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         test_ = "BlockCompressedMatrix/dense matrix multiplication";
+
+         {
+            const DMT ref( A * X );
+            const DMT one( m, 5UL, 1.0 );
+            DMT  Y1( one ), Y2( one ), Y3( one );
+            TDMT Y4( one );
+
+            Y1  = B * X;
+            Y2 += B * X;
+            Y3 -= B * X;
+            Y4  = B * X;
+
+            bool failure( Y1 != ref || Y2 != one + ref || Y3 != one - ref || Y4 != ref );
+
+            if( m > 2UL && n > 2UL )
+            {
+               const DMT R1( submatrix( A, 1UL, 0UL, m-2UL, n ) * X );
+               const DMT S1( submatrix( B, 1UL, 0UL, m-2UL, n ) * X );
+
+               failure = failure || S1 != R1;
+            }
+
+            if( failure ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication failed\n"
+                   << " Details:\n"
+                   << "   Matrix size: " << m << "x" << n << "\n"
+                   << "   Result:\n" << Y1 << "\n"
+                   << "   Expected result:\n" << ref << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace blockcompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running BlockCompressedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_BLOCKCOMPRESSEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during BlockCompressedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,1049 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/compactdiagonalmatrix/ClassTest.cpp
+//  \brief Source file for the CompactDiagonalMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/DenseSubvector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Serialization.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Serialization.h>
+#include <blazetest/mathtest/compactdiagonalmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compactdiagonalmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompactDiagonalMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testScaling();
+   testFunctionCall();
+   testIterator();
+   testNonZeros();
+   testReset();
+   testClear();
+   testResize();
+   testSwap();
+   testIsDefault();
+   testMultiplication();
+   testSerialization();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CompactDiagonalMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the CompactDiagonalMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "CompactDiagonalMatrix default constructor";
+
+      MT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "CompactDiagonalMatrix size constructor (3x3)";
+
+      MT mat( 3UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 3UL );
+
+      if( mat(0,1) != 0 || mat(1,0) != 0 || mat(0,2) != 0 || mat(2,1) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result: zero off-diagonal elements\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Homogeneous initialization
+   //=====================================================================================
+
+   {
+      test_ = "CompactDiagonalMatrix homogeneous initialization constructor (3x3)";
+
+      MT mat( 3UL, 2 );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat(0,0) != 2 || mat(0,1) != 0 || mat(0,2) != 0 ||
+          mat(1,0) != 0 || mat(1,1) != 2 || mat(1,2) != 0 ||
+          mat(2,0) != 0 || mat(2,1) != 0 || mat(2,2) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 0 0 )\n( 0 2 0 )\n( 0 0 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "CompactDiagonalMatrix copy constructor (3x3)";
+
+      MT mat1( 3UL, 0 );
+      mat1(0,0) = 1;
+      mat1(2,2) = 3;
+
+      MT mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 2UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 1UL, 0UL );
+      checkNonZeros( mat2, 2UL, 1UL );
+
+      if( mat2(0,0) != 1 || mat2(1,1) != 0 || mat2(2,2) != 3 || mat2(2,0) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 0 0 )\n( 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Conversion constructors
+   //=====================================================================================
+
+   {
+      test_ = "CompactDiagonalMatrix vector constructor";
+
+      blaze::DynamicVector<int,blaze::columnVector> diag( 3UL );
+      diag[0] = 1;
+      diag[1] = 0;
+      diag[2] = 3;
+
+      MT mat( diag );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 2UL );
+
+      if( mat(0,0) != 1 || mat(1,1) != 0 || mat(2,2) != 3 || mat.diagonal() != diag ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 0 0 )\n( 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompactDiagonalMatrix dense matrix constructor";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> tmp( 3UL, 3UL, 0 );
+      tmp(0,0) = 1;
+      tmp(2,2) = 2;
+
+      MT mat1( tmp );
+      MT mat2( trans( trans( tmp ) ) );
+
+      checkRows    ( mat1, 3UL );
+      checkColumns ( mat1, 3UL );
+      checkNonZeros( mat1, 2UL );
+
+      if( mat1 != tmp || mat2 != tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n" << tmp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompactDiagonalMatrix sparse matrix constructor stress test";
+
+      for( size_t i=0UL; i<100UL; ++i )
+      {
+         const size_t n( blaze::rand<size_t>( 0UL, 30UL ) );
+
+         blaze::CompressedMatrix<int,blaze::rowMajor> tmp( n, n );
+         for( size_t j=0UL; j<n/2UL; ++j ) {
+            const size_t index( blaze::rand<size_t>( 0UL, n-1UL ) );
+            tmp( index, index ) = blaze::rand<int>( 1, 10 );
+         }
+
+         const MT mat1( tmp );
+         const MT mat2( trans( tmp ) );
+
+         if( mat1 != tmp || mat2 != tmp || nonZeros( mat1 ) != nonZeros( tmp ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Construction failed\n"
+                << " Details:\n"
+                << "   Result (row-major matrix):\n" << mat1 << "\n"
+                << "   Result (column-major matrix):\n" << mat2 << "\n"
+                << "   Expected result:\n" << tmp << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "CompactDiagonalMatrix non-diagonal matrix constructor";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> tmp( 3UL, 3UL, 0 );
+      tmp(2,0) = 1;
+
+      try {
+         MT mat( tmp );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of non-diagonal matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompactDiagonalMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the CompactDiagonalMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   blaze::DynamicMatrix<int,blaze::rowMajor> tmp( 3UL, 3UL, 0 );
+   tmp(0,0) = 1;
+   tmp(1,1) = 2;
+   tmp(2,2) = 3;
+
+   {
+      test_ = "CompactDiagonalMatrix homogeneous assignment";
+
+      MT mat( 3UL );
+      mat = 4;
+
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 4 || mat(1,1) != 4 || mat(2,0) != 0 || mat(2,2) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 4 0 0 )\n( 0 4 0 )\n( 0 0 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompactDiagonalMatrix copy assignment";
+
+      const MT mat1( tmp );
+      MT mat2;
+      mat2 = mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2 != tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << tmp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompactDiagonalMatrix addition/subtraction/multiplication assignment";
+
+      MT mat( tmp );
+      mat += tmp;
+      mat -= tmp * 3;
+      mat *= tmp;
+
+      if( mat != -tmp * tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << -tmp * tmp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompactDiagonalMatrix non-diagonal assignment";
+
+      MT mat( tmp );
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> tmp2( 3UL, 3UL, 0 );
+      tmp2(0,1) = 1;
+
+      try {
+         mat += tmp2;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment of non-diagonal matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( mat != tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed assignment modified the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << tmp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of all CompactDiagonalMatrix (self-)scaling operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all available ways to scale an instance of the
+// CompactDiagonalMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testScaling()
+{
+   test_ = "CompactDiagonalMatrix self-scaling";
+
+   MT mat( 3UL, 0 );
+   mat(0,0) = 1;
+   mat(2,2) = 2;
+
+   mat *= 3;
+   mat.scale( 2 );
+   mat /= 3;
+
+   if( mat(0,0) != 2 || mat(1,1) != 0 || mat(2,2) != 4 || nonZeros( mat ) != 2UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Scaling failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n( 2 0 0 )\n( 0 0 0 )\n( 0 0 4 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompactDiagonalMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the function call operator of the CompactDiagonalMatrix
+// class template. The diagonal elements can be modified freely, whereas any write access to
+// an off-diagonal element has to fail. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   test_ = "CompactDiagonalMatrix::operator()";
+
+   MT mat( 3UL, 0 );
+   mat(0,0) = 1;
+   mat(1,1) = 2;
+   mat(1,1) += 3;
+   mat(2,2) = 4;
+   mat(2,2) *= 2;
+
+   checkNonZeros( mat, 3UL );
+
+   if( mat(0,0) != 1 || mat(1,1) != 5 || mat(2,2) != 8 || mat(1,2) != 0 ||
+       mat.diagonal()[1] != 5 || mat.diagonal().size() != 3UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Function call operator failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n( 1 0 0 )\n( 0 5 0 )\n( 0 0 8 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      mat(2,1) = 5;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Assignment to off-diagonal matrix element succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      mat(0,1) += 1;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Addition assignment to off-diagonal matrix element succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompactDiagonalMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the CompactDiagonalMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   MT mat( 3UL, 0 );
+   mat(0,0) = 1;
+   mat(2,2) = 3;
+
+   {
+      test_ = "CompactDiagonalMatrix iterator/const iterator conversion";
+
+      MT::ConstIterator it( begin( mat, 1UL ) );
+
+      if( it == end( mat, 1UL ) || *it != 0 || end( mat, 1UL ) - it != 3L ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed iterator conversion detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompactDiagonalMatrix iterator traversal";
+
+      int sum( 0 );
+      for( size_t i=0UL; i<3UL; ++i )
+         for( MT::ConstIterator it=mat.cbegin(i); it!=mat.cend(i); ++it )
+            sum += *it;
+
+      if( sum != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator traversal failed\n"
+             << " Details:\n"
+             << "   Sum of all elements         : " << sum << "\n"
+             << "   Expected sum of all elements: 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompactDiagonalMatrix assignment via iterator";
+
+      MT::Iterator it( mat.begin( 1UL ) );
+      ++it;
+      *it = 2;
+
+      try {
+         *(--mat.end( 1UL )) = 6;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment to off-diagonal matrix element via iterator succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( mat(0,0) != 1 || mat(1,1) != 2 || mat(2,2) != 3 || mat(1,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment via iterator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 2 0 )\n( 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the CompactDiagonalMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the
+// CompactDiagonalMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "CompactDiagonalMatrix::nonZeros()";
+
+   MT mat( 4UL, 0 );
+
+   checkNonZeros( mat, 0UL );
+
+   mat(0,0) = 1;
+   mat(1,1) = 2;
+   mat(3,3) = 3;
+
+   checkNonZeros( mat, 3UL );
+   checkNonZeros( mat, 0UL, 1UL );
+   checkNonZeros( mat, 1UL, 1UL );
+   checkNonZeros( mat, 2UL, 0UL );
+   checkNonZeros( mat, 3UL, 1UL );
+
+   mat(0,0) = 0;
+
+   checkNonZeros( mat, 2UL );
+   checkNonZeros( mat, 0UL, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the CompactDiagonalMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the CompactDiagonalMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   test_ = "CompactDiagonalMatrix::reset()";
+
+   MT mat( 3UL, 1 );
+
+   reset( mat, 1UL );
+
+   checkRows    ( mat, 3UL );
+   checkNonZeros( mat, 2UL );
+   checkNonZeros( mat, 1UL, 0UL );
+
+   if( mat(0,0) != 1 || mat(1,1) != 0 || mat(2,2) != 1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reset operation failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n( 1 0 0 )\n( 0 0 0 )\n( 0 0 1 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   reset( mat );
+
+   checkRows    ( mat, 3UL );
+   checkNonZeros( mat, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the CompactDiagonalMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the CompactDiagonalMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "CompactDiagonalMatrix::clear()";
+
+   MT mat( 3UL, 1 );
+
+   clear( mat );
+
+   checkRows    ( mat, 0UL );
+   checkColumns ( mat, 0UL );
+   checkNonZeros( mat, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c resize() member function of the CompactDiagonalMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c resize() member function of the CompactDiagonalMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "CompactDiagonalMatrix::resize()";
+
+   MT mat( 2UL, 0 );
+   mat(0,0) = 1;
+   mat(1,1) = 2;
+
+   mat.resize( 4UL );
+
+   checkRows    ( mat, 4UL );
+   checkColumns ( mat, 4UL );
+   checkCapacity( mat, 4UL );
+   checkNonZeros( mat, 2UL );
+
+   mat(2,2) = 3;
+
+   checkNonZeros( mat, 3UL );
+
+   mat.resize( 2UL );
+
+   checkRows    ( mat, 2UL );
+   checkNonZeros( mat, 2UL );
+
+   mat.reserve( 10UL );
+
+   checkCapacity( mat, 10UL );
+
+   if( mat(0,0) != 1 || mat(1,0) != 0 || mat(1,1) != 2 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resizing the matrix failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n( 1 0 )\n( 0 2 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the CompactDiagonalMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the CompactDiagonalMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "CompactDiagonalMatrix swap";
+
+   MT mat1( 2UL, 1 );
+   MT mat2( 3UL, 0 );
+   mat2(2,2) = 2;
+
+   swap( mat1, mat2 );
+
+   checkRows    ( mat1, 3UL );
+   checkNonZeros( mat1, 1UL );
+   checkRows    ( mat2, 2UL );
+   checkNonZeros( mat2, 2UL );
+
+   if( mat1(2,2) != 2 || mat2(0,0) != 1 || mat2(1,0) != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the matrices failed\n"
+          << " Details:\n"
+          << "   First matrix:\n" << mat1 << "\n"
+          << "   Second matrix:\n" << mat2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the CompactDiagonalMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the CompactDiagonalMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   MT mat( 3UL, 0 );
+
+   if( isDefault( mat ) != false || isDefault( MT() ) != true ||
+       isDefault( mat(0,1) ) != true ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid isDefault evaluation\n"
+          << " Details:\n"
+          << "   Matrix:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompactDiagonalMatrix multiplication kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the scaling kernels of the matrix/vector, vector/matrix and matrix/matrix
+// multiplication (including submatrices of the diagonal matrix, as they occur during the
+// parallel execution) by comparing the results with the multiplication of a general dense
+// matrix. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>         DMT;
+   typedef blaze::DynamicMatrix<double,blaze::columnMajor>      ODMT;
+   typedef blaze::CompactDiagonalMatrix<double>                 CDMT;
+   typedef blaze::DynamicVector<double,blaze::columnVector>     DVT;
+   typedef blaze::DynamicVector<double,blaze::rowVector>        TDVT;
+   typedef blaze::CompressedVector<double,blaze::columnVector>  SVT;
+
+   const size_t sizes[] = { 0UL, 1UL, 3UL, 8UL, 17UL, 64UL, 129UL };
+
+   for( size_t a=0UL; a<sizeof(sizes)/sizeof(size_t); ++a )
+   {
+      const size_t n( sizes[a] );
+
+      DMT A( n, n, 0.0 );
+      for( size_t i=0UL; i<n; ++i ) {
+         A(i,i) = blaze::rand<int>( -10, 10 );
+      }
+
+      DMT B( n, 5UL );
+      for( size_t i=0UL; i<n; ++i )
+         for( size_t j=0UL; j<5UL; ++j )
+            B(i,j) = blaze::rand<int>( -10, 10 );
+
+      DVT x( n );
+      for( size_t j=0UL; j<n; ++j )
+         x[j] = blaze::rand<int>( -10, 10 );
+
+      SVT s( n );
+      for( size_t j=0UL; j<n; j+=3UL )
+         s[j] = blaze::rand<int>( 1, 10 );
+
+      const CDMT D( A );
+
+      {
+         test_ = "CompactDiagonalMatrix/vector multiplication";
+
+         const DVT  ref1( A * x );
+         const DVT  ref2( A * s );
+         const TDVT ref3( trans( x ) * A );
+         const DVT  one( n, 1.0 );
+         DVT  y1( one ), y2( one ), y3( one ), y4( one );
+         TDVT y5( trans( one ) );
+
+         y1  = D * x;
+         y2 += D * x;
+         y3 -= D * s;
+         y4  = D * s;
+         y5 -= trans( x ) * D;
+
+         bool failure( y1 != ref1 || y2 != one + ref1 || y3 != one - ref2 || y4 != ref2 ||
+                       y5 != trans( one ) - ref3 );
+
+         if( n > 2UL )
+         {
+            const DVT r1( submatrix( A, 1UL, 0UL, n-2UL, n ) * x );
+            const DVT r2( submatrix( A, 1UL, 1UL, n-2UL, n-2UL ) * subvector( x, 1UL, n-2UL ) );
+            const DVT r3( submatrix( A, 0UL, 1UL, n-2UL, n-2UL ) * subvector( s, 0UL, n-2UL ) );
+
+            const DVT s1( submatrix( D, 1UL, 0UL, n-2UL, n ) * x );
+            const DVT s2( submatrix( D, 1UL, 1UL, n-2UL, n-2UL ) * subvector( x, 1UL, n-2UL ) );
+            const DVT s3( submatrix( D, 0UL, 1UL, n-2UL, n-2UL ) * subvector( s, 0UL, n-2UL ) );
+
+            failure = failure || s1 != r1 || s2 != r2 || s3 != r3;
+         }
+
+         if( failure ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Matrix size: " << n << "x" << n << "\n"
+                << "   Result:\n" << y1 << "\n"
+                << "   Expected result:\n" << ref1 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         test_ = "CompactDiagonalMatrix/dense matrix multiplication";
+
+         const DMT ref1( A * B );
+         const DMT ref2( trans( B ) * A );
+         DMT  C1( n, 5UL, 1.0 ), C2( n, 5UL, 1.0 ), C4( 5UL, n, 1.0 );
+         ODMT C3( n, 5UL, 1.0 );
+
+         C1  = D * B;
+         C2 += D * B;
+         C3 -= D * B;
+         C4 -= trans( B ) * D;
+
+         bool failure( C1 != ref1 || C2 != ref1 + DMT( n, 5UL, 1.0 ) ||
+                       C3 != DMT( n, 5UL, 1.0 ) - ref1 || C4 != DMT( 5UL, n, 1.0 ) - ref2 );
+
+         if( n > 2UL )
+         {
+            const DMT r1( submatrix( A, 1UL, 0UL, n-2UL, n ) * B );
+            const DMT s1( submatrix( D, 1UL, 0UL, n-2UL, n ) * B );
+
+            const DMT r2( trans( B ) * submatrix( A, 0UL, 1UL, n, n-2UL ) );
+            const DMT s2( trans( B ) * submatrix( D, 0UL, 1UL, n, n-2UL ) );
+
+            failure = failure || s1 != r1 || s2 != r2;
+         }
+
+         if( failure ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Matrix size: " << n << "x" << n << "\n"
+                << "   Result:\n" << C1 << "\n"
+                << "   Expected result:\n" << ref1 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the serialization of the CompactDiagonalMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the serialization and deserialization of instances of the
+// CompactDiagonalMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testSerialization()
+{
+   {
+      test_ = "CompactDiagonalMatrix serialization";
+
+      MT mat1( 5UL, 0 );
+      mat1(0,0) = 1;
+      mat1(2,2) = 2;
+      mat1(4,4) = 3;
+
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+      archive << mat1;
+
+      MT mat2( 2UL, 7 );
+      archive >> mat2;
+
+      checkRows    ( mat2, 5UL );
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Serialization failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompactDiagonalMatrix deserialization of a non-diagonal matrix";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1( 3UL, 3UL, 1 );
+
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+      archive << mat1;
+
+      MT mat2;
+
+      try {
+         archive >> mat2;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Deserialization of non-diagonal matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+} // namespace compactdiagonalmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompactDiagonalMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_COMPACTDIAGONALMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompactDiagonalMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -94,6 +94,7 @@ ClassTest::ClassTest()
    testLowerBound();
    testUpperBound();
    testIsDefault();
+   testIndexType();
 }
 //*************************************************************************************************
 
@@ -10079,6 +10080,218 @@ void ClassTest::testIsDefault()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of CompressedMatrix instances with a narrow index type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of compressed matrices that store their indices by means of
+// a narrow index type. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testIndexType()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedMatrix with 16-bit indices";
+
+      typedef blaze::CompressedMatrix<int,blaze::rowMajor,blaze::uint16_t>  NarrowType;
+      typedef blaze::CompressedMatrix<int,blaze::rowMajor>                  WideType;
+
+      // Element access at the upper end of the index range
+      {
+         NarrowType mat( 3UL, 65536UL, 3UL );
+         mat(0,65535) = 1;
+         mat(1,    0) = 2;
+         mat(2,40000) = 3;
+
+         checkRows    ( mat, 3UL );
+         checkColumns ( mat, 65536UL );
+         checkNonZeros( mat, 3UL );
+
+         if( mat(0,65535) != 1 || mat(1,0) != 2 || mat(2,40000) != 3 ||
+             mat.begin(0)->index() != 65535UL || mat.begin(2)->index() != 40000UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Element access failed\n"
+                << " Details:\n"
+                << "   Index of element (0,65535): " << mat.begin(0)->index() << "\n"
+                << "   Index of element (2,40000): " << mat.begin(2)->index() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Construction and resizing beyond the range of the index type
+      {
+         try {
+            NarrowType mat( 3UL, 65537UL );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Construction of an out-of-range matrix succeeded\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+
+         NarrowType mat( 65537UL, 3UL );
+         mat(65536,2) = 4;
+
+         try {
+            mat.resize( 65537UL, 65537UL );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Resizing to an out-of-range matrix succeeded\n"
+                << " Details:\n"
+                << "   Number of columns: " << mat.columns() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+
+         checkRows    ( mat, 65537UL );
+         checkColumns ( mat, 3UL );
+         checkNonZeros( mat, 1UL );
+      }
+
+      // Conversion and computation with the default index type
+      {
+         NarrowType mat1( 4UL, 5UL );
+         mat1(0,4) = 1;
+         mat1(1,1) = 2;
+         mat1(3,0) = 3;
+         mat1(3,3) = 4;
+
+         WideType mat2( mat1 );
+         NarrowType mat3( mat2 * 2 );
+
+         blaze::DynamicVector<int,blaze::columnVector> vec( 5UL );
+         vec[0] = 1; vec[1] = 2; vec[2] = 3; vec[3] = 4; vec[4] = 5;
+
+         const blaze::DynamicVector<int,blaze::columnVector> res1( mat1 * vec );
+         const blaze::DynamicVector<int,blaze::columnVector> res2( mat2 * vec );
+
+         if( mat1 != mat2 || mat3 != mat1 * 2 || mat3 - mat1 != mat2 || res1 != res2 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Computation failed\n"
+                << " Details:\n"
+                << "   16-bit index matrix:\n" << mat1 << "\n"
+                << "   Default index matrix:\n" << mat2 << "\n"
+                << "   16-bit result:\n" << res1 << "\n"
+                << "   Default result:\n" << res2 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompressedMatrix with 16-bit indices";
+
+      typedef blaze::CompressedMatrix<int,blaze::columnMajor,blaze::uint16_t>  NarrowType;
+      typedef blaze::CompressedMatrix<int,blaze::columnMajor>                  WideType;
+
+      // Element access at the upper end of the index range
+      {
+         NarrowType mat( 65536UL, 3UL, 3UL );
+         mat(65535,0) = 1;
+         mat(    0,1) = 2;
+         mat(40000,2) = 3;
+
+         checkRows    ( mat, 65536UL );
+         checkColumns ( mat, 3UL );
+         checkNonZeros( mat, 3UL );
+
+         if( mat(65535,0) != 1 || mat(0,1) != 2 || mat(40000,2) != 3 ||
+             mat.begin(0)->index() != 65535UL || mat.begin(2)->index() != 40000UL ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Element access failed\n"
+                << " Details:\n"
+                << "   Index of element (65535,0): " << mat.begin(0)->index() << "\n"
+                << "   Index of element (40000,2): " << mat.begin(2)->index() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Construction and resizing beyond the range of the index type
+      {
+         try {
+            NarrowType mat( 65537UL, 3UL );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Construction of an out-of-range matrix succeeded\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+
+         NarrowType mat( 3UL, 65537UL );
+         mat(2,65536) = 4;
+
+         try {
+            mat.resize( 65537UL, 65537UL );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Resizing to an out-of-range matrix succeeded\n"
+                << " Details:\n"
+                << "   Number of rows: " << mat.rows() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+
+         checkRows    ( mat, 3UL );
+         checkColumns ( mat, 65537UL );
+         checkNonZeros( mat, 1UL );
+      }
+
+      // Conversion and computation with the default index type
+      {
+         NarrowType mat1( 4UL, 5UL );
+         mat1(0,4) = 1;
+         mat1(1,1) = 2;
+         mat1(3,0) = 3;
+         mat1(3,3) = 4;
+
+         WideType mat2( mat1 );
+         NarrowType mat3( mat2 * 2 );
+
+         blaze::DynamicVector<int,blaze::columnVector> vec( 5UL );
+         vec[0] = 1; vec[1] = 2; vec[2] = 3; vec[3] = 4; vec[4] = 5;
+
+         const blaze::DynamicVector<int,blaze::columnVector> res1( mat1 * vec );
+         const blaze::DynamicVector<int,blaze::columnVector> res2( mat2 * vec );
+
+         if( mat1 != mat2 || mat3 != mat1 * 2 || mat3 - mat1 != mat2 || res1 != res2 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Computation failed\n"
+                << " Details:\n"
+                << "   16-bit index matrix:\n" << mat1 << "\n"
+                << "   Default index matrix:\n" << mat2 << "\n"
+                << "   16-bit result:\n" << res1 << "\n"
+                << "   Default result:\n" << res2 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
 } // namespace compressedmatrix
 
 } // namespace mathtest
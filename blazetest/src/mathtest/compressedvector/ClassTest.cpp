@@ -90,6 +90,7 @@ ClassTest::ClassTest()
    testLowerBound();
    testUpperBound();
    testIsDefault();
+   testIndexType();
 }
 //*************************************************************************************************
 
@@ -2938,6 +2939,103 @@ void ClassTest::testIsDefault()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of CompressedVector instances with a narrow index type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of compressed vectors that store their indices by means of
+// a narrow index type. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testIndexType()
+{
+   test_ = "CompressedVector with 16-bit indices";
+
+   typedef blaze::CompressedVector<int,blaze::rowVector,blaze::uint16_t>  NarrowType;
+   typedef blaze::CompressedVector<int,blaze::rowVector>                  WideType;
+
+   // Element access at the upper end of the index range
+   {
+      NarrowType vec( 65536UL, 3UL );
+      vec[    0] = 1;
+      vec[40000] = 2;
+      vec[65535] = 3;
+
+      checkSize    ( vec, 65536UL );
+      checkNonZeros( vec, 3UL );
+
+      NarrowType::ConstIterator it( vec.begin() );
+
+      if( vec[0] != 1 || vec[40000] != 2 || vec[65535] != 3 ||
+          it->index() != 0UL || (++it)->index() != 40000UL || (++it)->index() != 65535UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element access failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Construction and resizing beyond the range of the index type
+   {
+      try {
+         NarrowType vec( 65537UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction of an out-of-range vector succeeded\n"
+             << " Details:\n"
+             << "   Size: " << vec.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      NarrowType vec( 5UL );
+      vec[4] = 1;
+
+      try {
+         vec.resize( 65537UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing to an out-of-range vector succeeded\n"
+             << " Details:\n"
+             << "   Size: " << vec.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkSize    ( vec, 5UL );
+      checkNonZeros( vec, 1UL );
+   }
+
+   // Conversion and computation with the default index type
+   {
+      NarrowType vec1( 6UL );
+      vec1[1] = 2;
+      vec1[3] = 4;
+      vec1[5] = 6;
+
+      WideType vec2( vec1 );
+      NarrowType vec3( vec2 * 2 );
+
+      if( vec1 != vec2 || vec3 != vec1 * 2 || vec3 - vec1 != vec2 || vec1 * trans( vec2 ) != 56 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Computation failed\n"
+             << " Details:\n"
+             << "   16-bit index vector:\n" << vec1 << "\n"
+             << "   Default index vector:\n" << vec2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
 } // namespace compressedvector
 
 } // namespace mathtest
@@ -514,6 +514,30 @@ void AliasingTest::testDMatTDMatMult()
       checkResult( tdB4x3_, result_ );
    }
 
+   // Assignment of a symmetric product to its row-major operand
+   {
+      test_ = "DMatTDMatMult - Assignment of a symmetric product to its row-major operand";
+
+      initialize();
+
+      result_ = dA3x4_ * TDMat( trans( dA3x4_ ) );
+      dA3x4_  = dA3x4_ * trans( dA3x4_ );
+
+      checkResult( dA3x4_, result_ );
+   }
+
+   // Assignment of a symmetric product to its column-major operand
+   {
+      test_ = "DMatTDMatMult - Assignment of a symmetric product to its column-major operand";
+
+      initialize();
+
+      result_ = DMat( trans( tdB4x3_ ) ) * tdB4x3_;
+      tdB4x3_ = trans( tdB4x3_ ) * tdB4x3_;
+
+      checkResult( tdB4x3_, result_ );
+   }
+
 
    //=====================================================================================
    // Multiplication with addition assignment
@@ -39,6 +39,7 @@
 
 #include <cstdlib>
 #include <iostream>
+#include <vector>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DiagonalMatrix.h>
 #include <blaze/math/LowerMatrix.h>
@@ -101,6 +102,7 @@ ClassTest::ClassTest()
    testTranspose();
    testSwap();
    testIsDefault();
+   testBatchMult();
 }
 //*************************************************************************************************
 
@@ -7039,6 +7041,170 @@ void ClassTest::testIsDefault()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the \c batchMult() function with the DynamicMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c batchMult() function with the DynamicMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testBatchMult()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major DynamicMatrix batch multiplication";
+
+      const size_t sizes[] = { 1UL, 3UL, 16UL, 33UL, 64UL, 7UL, 64UL, 80UL, 2UL, 64UL };
+      const size_t batch( sizeof( sizes ) / sizeof( size_t ) );
+
+      std::vector<MT> A( batch ), B( batch ), C( batch );
+
+      for( size_t b=0UL; b<batch; ++b ) {
+         const size_t m( sizes[b] ), k( sizes[(b+3UL)%batch] ), n( sizes[(b+5UL)%batch] );
+         A[b].resize( m, k, false );
+         B[b].resize( k, n, false );
+         for( size_t i=0UL; i<m; ++i )
+            for( size_t j=0UL; j<k; ++j )
+               A[b](i,j) = static_cast<int>( ( i*7UL + j*3UL + b ) % 11UL ) - 5;
+         for( size_t i=0UL; i<k; ++i )
+            for( size_t j=0UL; j<n; ++j )
+               B[b](i,j) = static_cast<int>( ( i*5UL + j + b*2UL ) % 13UL ) - 6;
+      }
+
+      blaze::batchMult( A.begin(), A.end(), B.begin(), C.begin() );
+
+      for( size_t b=0UL; b<batch; ++b )
+      {
+         const MT ref( A[b] * B[b] );
+
+         if( C[b] != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batch multiplication failed\n"
+                << " Details:\n"
+                << "   Product: " << b << "\n"
+                << "   Result:\n" << C[b] << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major DynamicMatrix batch multiplication";
+
+      std::vector<OMT> A( 20UL ), B( 20UL ), C( 20UL );
+
+      for( size_t b=0UL; b<A.size(); ++b ) {
+         const size_t n( 5UL + b*5UL );
+         A[b].resize( n, n, false );
+         B[b].resize( n, n, false );
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<n; ++j ) {
+               A[b](i,j) = static_cast<int>( ( i*3UL + j*5UL + b ) % 7UL ) - 3;
+               B[b](i,j) = static_cast<int>( ( i + j*2UL + b ) % 9UL ) - 4;
+            }
+         }
+      }
+
+      C[3] = A[3];
+
+      blaze::batchMult( A.begin(), A.end(), B.begin(), C.begin() );
+
+      for( size_t b=0UL; b<A.size(); ++b )
+      {
+         const OMT ref( A[b] * B[b] );
+
+         if( C[b] != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batch multiplication failed\n"
+                << " Details:\n"
+                << "   Product: " << b << "\n"
+                << "   Result:\n" << C[b] << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Aliasing tests
+   //=====================================================================================
+
+   {
+      test_ = "DynamicMatrix batch multiplication with aliasing";
+
+      std::vector<MT> A( 2UL, MT( 2UL, 2UL ) ), B( 2UL, MT( 2UL, 2UL ) );
+
+      A[0](0,0) = 1; A[0](0,1) = 2; A[0](1,0) = 3; A[0](1,1) = 4;
+      A[1](0,0) = 2; A[1](0,1) = 0; A[1](1,0) = 1; A[1](1,1) = 1;
+      B[0](0,0) = 1; B[0](0,1) = 1; B[0](1,0) = 0; B[0](1,1) = 1;
+      B[1](0,0) = 1; B[1](0,1) = 2; B[1](1,0) = 3; B[1](1,1) = 4;
+
+      blaze::batchMult( A.begin(), A.end(), B.begin(), A.begin() );
+
+      if( A[0](0,0) != 1 || A[0](0,1) != 3 || A[0](1,0) != 3 || A[0](1,1) != 7 ||
+          A[1](0,0) != 2 || A[1](0,1) != 4 || A[1](1,0) != 4 || A[1](1,1) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Batch multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << A[0] << "\n" << A[1] << "\n"
+             << "   Expected result:\n( 1 3 )\n( 3 7 )\n\n( 2 4 )\n( 4 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Size mismatch tests
+   //=====================================================================================
+
+   {
+      test_ = "DynamicMatrix batch multiplication with non-matching sizes";
+
+      std::vector<MT> A( 2UL ), B( 2UL ), C( 2UL, MT( 1UL, 1UL, 5 ) );
+      A[0].resize( 2UL, 3UL ); A[0] = 1;
+      B[0].resize( 3UL, 2UL ); B[0] = 1;
+      A[1].resize( 2UL, 3UL ); A[1] = 1;
+      B[1].resize( 2UL, 2UL ); B[1] = 1;
+
+      try {
+         blaze::batchMult( A.begin(), A.end(), B.begin(), C.begin() );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Batch multiplication of non-matching matrices succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( C[0].rows() != 1UL || C[0](0,0) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Target matrix modified by failed batch multiplication\n"
+             << " Details:\n"
+             << "   Result:\n" << C[0] << "\n"
+             << "   Expected result:\n( 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
 } // namespace dynamicmatrix
 
 } // namespace mathtest
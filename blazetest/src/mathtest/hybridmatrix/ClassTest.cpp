@@ -42,6 +42,7 @@
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DiagonalMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
 #include <blaze/math/LowerMatrix.h>
 #include <blaze/math/UpperMatrix.h>
 #include <blaze/util/Complex.h>
@@ -100,6 +101,9 @@ ClassTest::ClassTest()
    testTranspose();
    testSwap();
    testIsDefault();
+   testDeterminant();
+   testInversion();
+   testSolve();
 }
 //*************************************************************************************************
 
@@ -6994,6 +6998,288 @@ void ClassTest::testIsDefault()
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Test of the \c det() function with the HybridMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c det() function with the HybridMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testDeterminant()
+{
+   using blaze::det;
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major det() function";
+
+      // Determinant of a 0x0 matrix
+      {
+         blaze::HybridMatrix<double,8UL,8UL,blaze::rowMajor> mat;
+
+         if( det( mat ) != 1.0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid determinant\n"
+                << " Details:\n"
+                << "   Result: " << det( mat ) << "\n"
+                << "   Expected result: 1\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Determinant of upper triangular matrices of various sizes
+      for( size_t n=1UL; n<=8UL; ++n )
+      {
+         blaze::HybridMatrix<double,8UL,8UL,blaze::rowMajor> mat( n, n, 0.0 );
+         double ref( 1.0 );
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=i; j<n; ++j ) {
+               mat(i,j) = ( i == j )?( i+1UL ):( 0.5 );
+            }
+            ref *= i+1UL;
+         }
+
+         if( std::fabs( det( mat ) - ref ) > 1E-12 * ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid determinant\n"
+                << " Details:\n"
+                << "   Result: " << det( mat ) << "\n"
+                << "   Expected result: " << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Determinant of a non-square matrix
+      try {
+         blaze::HybridMatrix<double,8UL,8UL,blaze::rowMajor> mat( 2UL, 3UL, 1.0 );
+         const double result( det( mat ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Determinant of a non-square matrix succeeded\n"
+             << " Details:\n"
+             << "   Result: " << result << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major det() function";
+
+      // Determinant of anti-diagonal matrices of various sizes
+      for( size_t n=1UL; n<=8UL; ++n )
+      {
+         blaze::HybridMatrix<double,8UL,8UL,blaze::columnMajor> mat( n, n, 0.0 );
+         double ref( ( ( n*(n-1UL)/2UL ) % 2UL )?( -1.0 ):( 1.0 ) );
+         for( size_t i=0UL; i<n; ++i ) {
+            mat(i,n-i-1UL) = i+1UL;
+            ref *= i+1UL;
+         }
+
+         if( std::fabs( det( mat ) - ref ) > 1E-12 * std::fabs( ref ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid determinant\n"
+                << " Details:\n"
+                << "   Result: " << det( mat ) << "\n"
+                << "   Expected result: " << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c inv() and \c invert() functions with the HybridMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c inv() and \c invert() functions with the HybridMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testInversion()
+{
+   using blaze::inv;
+   using blaze::invert;
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major inv() function";
+
+      // Inversion of matrices of various sizes
+      for( size_t n=1UL; n<=8UL; ++n )
+      {
+         blaze::HybridMatrix<double,8UL,8UL,blaze::rowMajor> mat( n, n );
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<n; ++j ) {
+               mat(i,j) = ( i == j )?( 10.0 ):( 1.0 / ( 1.0 + i + j ) );
+            }
+         }
+         checkInverse( mat );
+      }
+
+      // Inversion of a non-square matrix
+      try {
+         blaze::HybridMatrix<double,8UL,8UL,blaze::rowMajor> mat( 3UL, 2UL, 1.0 );
+         invert( mat );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inversion of a non-square matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major inv() function";
+
+      // Inversion of matrices of various sizes requiring pivoting
+      for( size_t n=2UL; n<=8UL; ++n )
+      {
+         blaze::HybridMatrix<double,8UL,8UL,blaze::columnMajor> mat( n, n );
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<n; ++j ) {
+               mat(i,j) = ( i == j )?( 0.0 ):( 1.0 + 2.0*i + j );
+            }
+         }
+         checkInverse( mat );
+      }
+   }
+
+   {
+      test_ = "Column-major invert() function";
+
+      // Inversion of singular matrices of various sizes
+      for( size_t n=2UL; n<=8UL; ++n )
+      {
+         try {
+            blaze::HybridMatrix<double,8UL,8UL,blaze::columnMajor> mat( n, n, 1.0 );
+            invert( mat );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inversion of a singular matrix succeeded\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::runtime_error& ex ) {
+            if( std::string( ex.what() ) != "Singular matrix provided" )
+               throw;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c solve() function with the HybridMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c solve() function with the HybridMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSolve()
+{
+   using blaze::solve;
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major solve() function";
+
+      // Solving systems of various sizes
+      for( size_t n=1UL; n<=8UL; ++n )
+      {
+         blaze::HybridMatrix<double,8UL,8UL,blaze::rowMajor> mat( n, n );
+         blaze::DynamicVector<double,blaze::columnVector> x( n );
+         for( size_t i=0UL; i<n; ++i ) {
+            for( size_t j=0UL; j<n; ++j ) {
+               mat(i,j) = ( i == j )?( 0.0 ):( 1.0 + 2.0*i + j );
+            }
+            x[i] = 1.0 + i;
+         }
+         mat(0,0) = 1.0;
+         blaze::DynamicVector<double,blaze::columnVector> b( mat * x );
+
+         solve( mat, b );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            if( std::fabs( b[i] - x[i] ) > 1E-12 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Solving the linear system failed\n"
+                   << " Details:\n"
+                   << "   Result:\n" << b << "\n"
+                   << "   Expected result:\n" << x << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major solve() function";
+
+      // Solving a system with a vector of invalid size
+      try {
+         blaze::HybridMatrix<double,8UL,8UL,blaze::columnMajor> mat( 4UL, 4UL, 1.0 );
+         blaze::DynamicVector<double,blaze::columnVector> b( 3UL, 1.0 );
+
+         solve( mat, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving a system with a vector of invalid size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << b << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
 } // namespace hybridmatrix
 
 } // namespace mathtest
@@ -66,6 +66,7 @@ ClassTest::ClassTest()
 {
    testEmptyMatrices();
    testRandomMatrices();
+   testPartialDeserialization();
    testFailures();
 }
 //*************************************************************************************************
@@ -315,6 +316,81 @@ void ClassTest::testRandomMatrices()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the partial deserialization of randomly initialized matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs partial deserialization tests with dense and sparse, row-major and
+// column-major matrices. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testPartialDeserialization()
+{
+   test_ = "Partial deserialization";
+
+   {
+      blaze::DynamicMatrix<int,blaze::rowMajor> src( 23UL, 17UL );
+      randomize( src );
+      runPartialTests( src );
+   }
+
+   {
+      blaze::DynamicMatrix<double,blaze::columnMajor> src( 17UL, 23UL );
+      randomize( src );
+      runPartialTests( src );
+   }
+
+   {
+      blaze::CompressedMatrix<int,blaze::rowMajor> src( 23UL, 17UL );
+      randomize( src, 80UL );
+      runPartialTests( src );
+   }
+
+   {
+      blaze::CompressedMatrix<blaze::complex<float>,blaze::columnMajor> src( 17UL, 23UL );
+      randomize( src, 60UL );
+      runPartialTests( src );
+   }
+
+   try {
+      blaze::DynamicMatrix<int> src( 10UL, 10UL );
+      blaze::DynamicMatrix<int> dst;
+      randomize( src );
+
+      blaze::Archive<std::stringstream> archive;
+      archive << src;
+      deserialize( archive, dst, 5UL, 0UL, 6UL, 10UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid submatrix specification succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& )
+   {}
+
+   try {
+      blaze::DynamicMatrix<int> src( 10UL, 10UL );
+      blaze::StaticMatrix<int,3UL,3UL> dst;
+      randomize( src );
+
+      blaze::Archive<std::stringstream> archive;
+      archive << src;
+      deserializeRows( archive, dst, 2UL, 3UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Size difference succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& )
+   {}
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of failing serialization attempts.
 //
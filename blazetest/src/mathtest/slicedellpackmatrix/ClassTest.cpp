@@ -0,0 +1,1255 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/slicedellpackmatrix/ClassTest.cpp
+//  \brief Source file for the SlicedEllpackMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/DenseSubvector.h>
+#include <blaze/math/SparseSubmatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/slicedellpackmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace slicedellpackmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SlicedEllpackMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testScaling();
+   testFunctionCall();
+   testIterator();
+   testNonZeros();
+   testReset();
+   testClear();
+   testSwap();
+   testFind();
+   testLowerBound();
+   testUpperBound();
+   testIsDefault();
+   testLayout();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the SlicedEllpackMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllpackMatrix default constructor";
+
+      MT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllpackMatrix size constructor (0x4)";
+
+      MT mat( 0UL, 4UL );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix size constructor (3x4)";
+
+      MT mat( 3UL, 4UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 0UL );
+
+      if( mat(0,0) != 0 || mat(1,3) != 0 || mat(2,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 0 )\n( 0 0 0 0 )\n( 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix size constructor (index type range)";
+
+      try {
+         blaze::SlicedEllpackMatrix<int,unsigned char> mat( 3UL, 257UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Exceeding the range of the index type succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllpackMatrix copy constructor (2x3)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 2UL, 3UL );
+      tmp(0,0) = 1;
+      tmp(0,1) = 2;
+      tmp(1,1) = 3;
+      tmp(1,2) = 4;
+
+      MT mat1( tmp );
+      MT mat2( mat1 );
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 4UL );
+      checkNonZeros( mat2, 0UL, 2UL );
+      checkNonZeros( mat2, 1UL, 2UL );
+
+      if( mat2(0,0) != 1 || mat2(0,1) != 2 || mat2(0,2) != 0 ||
+          mat2(1,0) != 0 || mat2(1,1) != 3 || mat2(1,2) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 2 0 )\n( 0 3 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Conversion constructors
+   //=====================================================================================
+
+   {
+      test_ = "SlicedEllpackMatrix dense matrix constructor";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> tmp( 3UL, 4UL, 0 );
+      tmp(0,3) = 1;
+      tmp(1,0) = 2;
+      tmp(1,1) = 3;
+      tmp(1,3) = 4;
+      tmp(2,2) = 5;
+
+      MT mat( tmp );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 3UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat != tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << tmp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix column-major sparse matrix constructor";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> tmp( 3UL, 4UL );
+      tmp(0,3) = 1;
+      tmp(1,0) = 2;
+      tmp(1,1) = 3;
+      tmp(1,3) = 4;
+      tmp(2,2) = 5;
+
+      MT mat( tmp );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 5UL );
+
+      if( mat != tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << tmp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix sparse matrix constructor stress test";
+
+      for( size_t i=0UL; i<100UL; ++i )
+      {
+         const size_t rows   ( blaze::rand<size_t>( 0UL, 40UL ) );
+         const size_t columns( blaze::rand<size_t>( 0UL, 20UL ) );
+         const size_t sigma  ( blaze::rand<size_t>( 1UL, 50UL ) );
+
+         blaze::CompressedMatrix<int,blaze::rowMajor> tmp( rows, columns );
+         for( size_t j=0UL; j<rows*columns/4UL; ++j ) {
+            tmp( blaze::rand<size_t>( 0UL, rows-1UL ), blaze::rand<size_t>( 0UL, columns-1UL ) ) =
+               blaze::rand<int>( 1, 10 );
+         }
+
+         const MT mat( tmp, sigma );
+         const blaze::CompressedMatrix<int,blaze::rowMajor> back( mat );
+
+         checkNonZeros( mat, tmp.nonZeros() );
+
+         if( mat != tmp || back != tmp ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Construction failed\n"
+                << " Details:\n"
+                << "   Window size: " << sigma << "\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Conversion back:\n" << back << "\n"
+                << "   Expected result:\n" << tmp << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the SlicedEllpackMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   {
+      test_ = "SlicedEllpackMatrix copy assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 2UL, 3UL );
+      tmp(0,0) = 1;
+      tmp(0,1) = 2;
+      tmp(1,1) = 3;
+      tmp(1,2) = 4;
+
+      const MT mat1( tmp );
+      MT mat2( 5UL, 5UL, 2UL*MT::chunkSize );
+      mat2 = mat1;
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 4UL );
+
+      if( mat2 != tmp || mat2.sigma() != mat1.sigma() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 2 0 )\n( 0 3 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix sparse matrix assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 2UL, 3UL );
+      tmp(0,2) = 1;
+      tmp(1,0) = 2;
+
+      MT mat( 5UL, 5UL, 2UL*MT::chunkSize );
+      mat = tmp;
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 2UL );
+
+      if( mat != tmp || mat.sigma() != 2UL*MT::chunkSize ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Window size: " << mat.sigma() << "\n"
+             << "   Expected result:\n( 0 0 1 )\n( 2 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix sparse matrix expression assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 2UL, 3UL );
+      tmp(0,2) = 1;
+      tmp(1,0) = 2;
+
+      MT mat;
+      mat = 2 * tmp;
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 2UL );
+
+      if( mat(0,2) != 2 || mat(1,0) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 2 )\n( 4 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of all SlicedEllpackMatrix (self-)scaling operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all available ways to scale an instance of the
+// SlicedEllpackMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testScaling()
+{
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 3UL, 3UL );
+   tmp(0,0) =  1;
+   tmp(1,2) = -2;
+   tmp(2,1) =  3;
+
+   {
+      test_ = "SlicedEllpackMatrix self-scaling (M*=s)";
+
+      MT mat( tmp );
+      mat *= 2;
+
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 2 || mat(1,2) != -4 || mat(2,1) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 0 0 )\n( 0 0 -4 )\n( 0 6 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix self-scaling (M/=s)";
+
+      MT mat( 4 * tmp );
+      mat /= 2;
+
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 2 || mat(1,2) != -4 || mat(2,1) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 0 0 )\n( 0 0 -4 )\n( 0 6 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix::scale()";
+
+      MT mat( tmp );
+      mat.scale( 3 );
+
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 3 || mat(1,2) != -6 || mat(2,1) != 9 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 3 0 0 )\n( 0 0 -6 )\n( 0 9 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of accessing elements via the function call operator of the
+// SlicedEllpackMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   test_ = "SlicedEllpackMatrix::operator()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 5UL, 7UL );
+   tmp(0,6) = 1;
+   tmp(2,0) = 2;
+   tmp(2,3) = 3;
+   tmp(2,4) = 4;
+   tmp(4,1) = 5;
+   tmp(4,6) = 6;
+
+   const MT mat( tmp );
+
+   checkRows    ( mat, 5UL );
+   checkColumns ( mat, 7UL );
+   checkNonZeros( mat, 6UL );
+
+   for( size_t i=0UL; i<5UL; ++i ) {
+      for( size_t j=0UL; j<7UL; ++j ) {
+         if( mat(i,j) != tmp(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Function call operator failed\n"
+                << " Details:\n"
+                << "   Position: (" << i << "," << j << ")\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n" << tmp << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the SlicedEllpackMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   typedef MT::Iterator       Iterator;
+   typedef MT::ConstIterator  ConstIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 3UL, 5UL );
+   tmp(0,1) =  1;
+   tmp(1,0) = -2;
+   tmp(1,2) = -3;
+   tmp(1,4) =  4;
+   tmp(2,3) =  5;
+
+   MT mat( tmp );
+
+   // Testing conversion from Iterator to ConstIterator
+   {
+      test_ = "Iterator/ConstIterator conversion";
+
+      ConstIterator it( begin( mat, 1UL ) );
+
+      if( it == end( mat, 1UL ) || it->value() != -2 || it->index() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed iterator conversion detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Counting the number of elements in the second row
+   {
+      test_ = "Iterator subtraction";
+
+      const size_t number( end( mat, 1UL ) - begin( mat, 1UL ) );
+
+      if( number != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing read-only access via ConstIterator
+   {
+      test_ = "Read-only access via ConstIterator";
+
+      ConstIterator it ( cbegin( mat, 1UL ) );
+      ConstIterator end( cend( mat, 1UL ) );
+
+      const int    values [] = { -2, -3, 4 };
+      const size_t indices[] = { 0UL, 2UL, 4UL };
+
+      for( size_t k=0UL; k<3UL; ++k, ++it ) {
+         if( it == end || it->value() != values[k] || it->index() != indices[k] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Iterator access failed at element " << k << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( it != end ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator end not reached\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing assignment via Iterator
+   {
+      test_ = "Assignment via Iterator";
+
+      int value = 7;
+
+      for( Iterator it=begin( mat, 1UL ); it!=end( mat, 1UL ); ++it ) {
+         *it = value++;
+      }
+
+      if( mat(1,0) != 7 || mat(1,2) != 8 || mat(1,4) != 9 || mat(0,1) != 1 || mat(2,3) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment via iterator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 0 0 0 )\n( 7 0 8 0 9 )\n( 0 0 0 5 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing addition/subtraction/multiplication/division assignment via Iterator
+   {
+      test_ = "Compound assignment via Iterator";
+
+      Iterator it( begin( mat, 1UL ) );
+      it->value() += 2;
+      ++it;
+      *it -= 2;
+      ++it;
+      *it *= 2;
+      *begin( mat, 2UL ) /= 5;
+
+      if( mat(1,0) != 9 || mat(1,2) != 6 || mat(1,4) != 18 || mat(2,3) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Compound assignment via iterator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 0 0 0 )\n( 9 0 6 0 18 )\n( 0 0 0 1 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the SlicedEllpackMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "SlicedEllpackMatrix::nonZeros()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 3UL, 4UL );
+   tmp(0,0) = 1;
+   tmp(0,2) = 2;
+   tmp(0,3) = 3;
+   tmp(2,1) = 4;
+
+   const MT mat( tmp );
+
+   checkRows    ( mat, 3UL );
+   checkColumns ( mat, 4UL );
+   checkNonZeros( mat, 4UL );
+   checkNonZeros( mat, 0UL, 3UL );
+   checkNonZeros( mat, 1UL, 0UL );
+   checkNonZeros( mat, 2UL, 1UL );
+   checkCapacity( mat, 4UL );
+   checkCapacity( mat, 0UL, 3UL );
+   checkCapacity( mat, 2UL, 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the SlicedEllpackMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 3UL, 4UL );
+   tmp(0,0) = 1;
+   tmp(0,2) = 2;
+   tmp(1,1) = 3;
+   tmp(2,3) = 4;
+
+   {
+      test_ = "SlicedEllpackMatrix::reset( size_t )";
+
+      MT mat( tmp );
+      reset( mat, 0UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 2UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 1UL );
+      checkCapacity( mat, 0UL, 2UL );
+
+      if( mat(0,0) != 0 || mat(0,2) != 0 || mat(1,1) != 3 || mat(2,3) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reset operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 0 )\n( 0 3 0 0 )\n( 0 0 0 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix::reset()";
+
+      MT mat( tmp );
+      reset( mat );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+
+      if( mat != blaze::CompressedMatrix<int,blaze::rowMajor>( 3UL, 4UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reset operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 0 )\n( 0 0 0 0 )\n( 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() function with the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() function with the SlicedEllpackMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "SlicedEllpackMatrix::clear()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 3UL, 4UL );
+   tmp(0,0) = 1;
+   tmp(2,3) = 2;
+
+   MT mat( tmp, 3UL*MT::chunkSize );
+   clear( mat );
+
+   checkRows    ( mat, 0UL );
+   checkColumns ( mat, 0UL );
+   checkNonZeros( mat, 0UL );
+
+   if( mat.sigma() != 3UL*MT::chunkSize ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Clear operation failed\n"
+          << " Details:\n"
+          << "   Window size         : " << mat.sigma() << "\n"
+          << "   Expected window size: " << 3UL*MT::chunkSize << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the SlicedEllpackMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "SlicedEllpackMatrix swap";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp1( 2UL, 2UL );
+   tmp1(0,0) = 1;
+   tmp1(1,1) = 2;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp2( 3UL, 1UL );
+   tmp2(2,0) = 3;
+
+   MT mat1( tmp1 );
+   MT mat2( tmp2 );
+
+   swap( mat1, mat2 );
+
+   checkRows    ( mat1, 3UL );
+   checkColumns ( mat1, 1UL );
+   checkNonZeros( mat1, 1UL );
+   checkRows    ( mat2, 2UL );
+   checkColumns ( mat2, 2UL );
+   checkNonZeros( mat2, 2UL );
+
+   if( mat1 != tmp2 || mat2 != tmp1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the first matrix failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat1 << "\n" << mat2 << "\n"
+          << "   Expected result:\n" << tmp2 << "\n" << tmp1 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c find() member function of the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find() member function of the SlicedEllpackMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFind()
+{
+   test_ = "SlicedEllpackMatrix::find()";
+
+   typedef MT::ConstIterator  ConstIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 8UL, 6UL );
+   tmp(1,2) = 1;
+   tmp(2,3) = 2;
+   tmp(6,0) = 3;
+   tmp(6,1) = 4;
+   tmp(6,5) = 5;
+
+   const MT mat( tmp );
+
+   for( size_t i=0UL; i<8UL; ++i ) {
+      for( size_t j=0UL; j<6UL; ++j )
+      {
+         const ConstIterator pos( mat.find( i, j ) );
+
+         if( isDefault( tmp(i,j) ) && pos != mat.end( i ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Non-existing element could be found\n"
+                << " Details:\n"
+                << "   Required position = (" << i << "," << j << ")\n"
+                << "   Found index       = " << pos->index() << "\n"
+                << "   Current matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         else if( !isDefault( tmp(i,j) ) &&
+                  ( pos == mat.end( i ) || pos->index() != j || pos->value() != tmp(i,j) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Element could not be found\n"
+                << " Details:\n"
+                << "   Required position = (" << i << "," << j << ")\n"
+                << "   Current matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c lowerBound() member function of the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c lowerBound() member function of the
+// SlicedEllpackMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testLowerBound()
+{
+   test_ = "SlicedEllpackMatrix::lowerBound()";
+
+   typedef MT::ConstIterator  ConstIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 2UL, 8UL );
+   tmp(1,1) = 1;
+   tmp(1,3) = 2;
+   tmp(1,6) = 3;
+
+   const MT mat( tmp );
+
+   const size_t expected[] = { 1UL, 1UL, 3UL, 3UL, 6UL, 6UL, 6UL, 8UL };
+
+   for( size_t j=0UL; j<8UL; ++j )
+   {
+      const ConstIterator pos( mat.lowerBound( 1UL, j ) );
+      const size_t index( pos == mat.end( 1UL ) ? 8UL : pos->index() );
+
+      if( index != expected[j] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Wrong element found\n"
+             << " Details:\n"
+             << "   Required index = " << j << "\n"
+             << "   Found index    = " << index << "\n"
+             << "   Expected index = " << expected[j] << "\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   if( mat.lowerBound( 0UL, 3UL ) != mat.end( 0UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Element found in empty row\n"
+          << " Details:\n"
+          << "   Current matrix:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c upperBound() member function of the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c upperBound() member function of the
+// SlicedEllpackMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testUpperBound()
+{
+   test_ = "SlicedEllpackMatrix::upperBound()";
+
+   typedef MT::ConstIterator  ConstIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 2UL, 8UL );
+   tmp(1,1) = 1;
+   tmp(1,3) = 2;
+   tmp(1,6) = 3;
+
+   const MT mat( tmp );
+
+   const size_t expected[] = { 1UL, 3UL, 3UL, 6UL, 6UL, 6UL, 8UL, 8UL };
+
+   for( size_t j=0UL; j<8UL; ++j )
+   {
+      const ConstIterator pos( mat.upperBound( 1UL, j ) );
+      const size_t index( pos == mat.end( 1UL ) ? 8UL : pos->index() );
+
+      if( index != expected[j] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Wrong element found\n"
+             << " Details:\n"
+             << "   Required index = " << j << "\n"
+             << "   Found index    = " << index << "\n"
+             << "   Expected index = " << expected[j] << "\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the SlicedEllpackMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   {
+      MT mat;
+
+      if( isDefault( mat ) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      MT mat( 2UL, 3UL );
+
+      if( isDefault( mat ) != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the chunk layout of the SlicedEllpackMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the window size adjustment, the sorting of the rows within each window,
+// and the padding of the chunks of the SlicedEllpackMatrix class template. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLayout()
+{
+   const size_t C( MT::chunkSize );
+
+   {
+      test_ = "SlicedEllpackMatrix window size adjustment";
+
+      const MT mat1( 4UL, 4UL, 0UL );
+      const MT mat2( 4UL, 4UL, C+1UL );
+      const MT mat3( 4UL, 4UL, 2UL*C );
+
+      if( mat1.sigma() != C || mat2.sigma() != 2UL*C || mat3.sigma() != 2UL*C ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid window size\n"
+             << " Details:\n"
+             << "   Chunk size   : " << C << "\n"
+             << "   Window sizes : " << mat1.sigma() << " " << mat2.sigma() << " " << mat3.sigma() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SlicedEllpackMatrix chunk layout";
+
+      // Row i has i%5 non-zero elements; rows are sorted within windows of 2*C rows
+      const size_t M( 5UL*C+1UL );
+      blaze::CompressedMatrix<int,blaze::rowMajor> tmp( M, 8UL );
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=0UL; j<i%5UL; ++j )
+            tmp(i,2UL*j) = static_cast<int>( i+1UL );
+      }
+
+      const MT mat( tmp, 2UL*C );
+
+      if( mat.chunks() != 6UL || mat != tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of chunks\n"
+             << " Details:\n"
+             << "   Number of chunks         : " << mat.chunks() << "\n"
+             << "   Expected number of chunks: 6\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      size_t capacity( 0UL );
+
+      for( size_t k=0UL; k<mat.chunks(); ++k )
+      {
+         const size_t* const rows( mat.chunkRows( k ) );
+         const int*    const values( mat.chunkValues( k ) );
+         const size_t length( mat.chunkLength( k ) );
+
+         for( size_t s=0UL; s<C; ++s )
+         {
+            const size_t window( ( k*C ) / ( 2UL*C ) );
+            const bool   padded( rows[s] == M );
+
+            if( ( !padded && ( rows[s] > M || rows[s] / ( 2UL*C ) != window ) ) ||
+                ( padded && k*C+s < M ) ||
+                ( s > 0UL && !padded && rows[s-1UL] != M && (rows[s-1UL]%5UL) < (rows[s]%5UL) ) ||
+                ( !padded && length < rows[s]%5UL ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid row order in chunk " << k << "\n"
+                   << " Details:\n"
+                   << "   Slot: " << s << "\n"
+                   << "   Row : " << rows[s] << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+
+            for( size_t l=( padded ? 0UL : rows[s]%5UL ); l<length; ++l ) {
+               if( values[l*C+s] != 0 ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Non-zero padding element in chunk " << k << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+
+         capacity += length * C;
+      }
+
+      checkCapacity( mat, capacity );
+
+      if( mat.capacity() != capacity ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid capacity detected\n"
+             << " Details:\n"
+             << "   Capacity         : " << mat.capacity() << "\n"
+             << "   Expected capacity: " << capacity << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SlicedEllpackMatrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the multiplication of a SlicedEllpackMatrix with a dense vector with
+// the according multiplication of a CompressedMatrix for matrices of various sizes and window
+// sizes, including submatrices and compound assignments. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   test_ = "SlicedEllpackMatrix/dense vector multiplication";
+
+   typedef blaze::CompressedMatrix<double,blaze::rowMajor>  CMT;
+   typedef blaze::SlicedEllpackMatrix<double>               SMT;
+   typedef blaze::DynamicVector<double,blaze::columnVector>  DVT;
+
+   const size_t sizes[] = { 0UL, 1UL, 3UL, 8UL, 17UL, 64UL, 129UL };
+
+   for( size_t a=0UL; a<sizeof(sizes)/sizeof(size_t); ++a ) {
+      for( size_t b=0UL; b<sizeof(sizes)/sizeof(size_t); ++b ) {
+         for( size_t sigma=1UL; sigma<=128UL; sigma*=4UL )
+         {
+            const size_t m( sizes[a] );
+            const size_t n( sizes[b] );
+
+            CMT A( m, n );
+            for( size_t i=0UL; i<m; ++i ) {
+               const size_t nonzeros( n == 0UL ? 0UL : blaze::rand<size_t>( 0UL, std::min<size_t>( n, 10UL ) ) );
+               for( size_t j=0UL; j<nonzeros; ++j )
+                  A( i, blaze::rand<size_t>( 0UL, n-1UL ) ) = blaze::rand<int>( -10, 10 );
+            }
+
+            DVT x( n );
+            for( size_t j=0UL; j<n; ++j )
+               x[j] = blaze::rand<int>( -10, 10 );
+
+            const SMT S( A, sigma );
+
+            const DVT ref( A * x );
+            const DVT one( m, 1.0 );
+            DVT y1( one ), y2( one ), y3( one );
+
+            y1  = S * x;
+            y2 += S * x;
+            y3 -= S * x;
+
+            bool failure( y1 != ref || y2 != one + ref || y3 != one - ref );
+
+            if( m > 2UL && n > 2UL )
+            {
+               const DVT r1( submatrix( A, 1UL, 0UL, m-2UL, n ) * x );
+               const DVT r2( submatrix( A, 1UL, 1UL, m-2UL, n-2UL ) * subvector( x, 1UL, n-2UL ) );
+
+               const DVT s1( submatrix( S, 1UL, 0UL, m-2UL, n ) * x );
+               const DVT s2( submatrix( S, 1UL, 1UL, m-2UL, n-2UL ) * subvector( x, 1UL, n-2UL ) );
+
+               failure = failure || s1 != r1 || s2 != r2;
+            }
+
+            if( failure ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication failed\n"
+                   << " Details:\n"
+                   << "   Matrix size: " << m << "x" << n << "\n"
+                   << "   Window size: " << S.sigma() << "\n"
+                   << "   Result:\n" << y1 << "\n"
+                   << "   Expected result:\n" << ref << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace slicedellpackmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SlicedEllpackMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_SLICEDELLPACKMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SlicedEllpackMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
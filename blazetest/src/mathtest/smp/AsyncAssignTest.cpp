@@ -0,0 +1,424 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/AsyncAssignTest.cpp
+//  \brief Source file for the asynchronous assignment test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <blazetest/mathtest/smp/AsyncAssignTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the AsyncAssignTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+AsyncAssignTest::AsyncAssignTest()
+{
+   testVectorAssignment();
+   testMatrixAssignment();
+   testHandles();
+   testSizeMismatch();
+   testAliasing();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of concurrently pending asynchronous vector assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function starts several asynchronous matrix/vector multiplications, performs a
+// synchronous multiplication while the assignments are pending, and compares all results to
+// the serially computed reference results after waiting for the handles. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void AsyncAssignTest::testVectorAssignment()
+{
+   test_ = "Asynchronous vector assignment";
+
+   const size_t n( 600UL );
+   const size_t assignments( 8UL );
+
+   MT A( n, n );
+   initialize( A, 1UL );
+
+   std::vector<VT> x( assignments, VT( n ) ), y( assignments, VT( n, 0.0 ) ), ref( assignments );
+
+   BLAZE_SERIAL_SECTION
+   {
+      for( size_t k=0UL; k<assignments; ++k ) {
+         initialize( x[k], k );
+         ref[k] = A * x[k];
+      }
+   }
+
+   for( size_t round=0UL; round<10UL; ++round )
+   {
+      std::vector<blaze::Future> futures;
+
+      for( size_t k=0UL; k<assignments; ++k ) {
+         reset( y[k] );
+         futures.push_back( blaze::asyncAssign( y[k], A * x[k] ) );
+      }
+
+      const VT z( A * x[0UL] );
+
+      for( size_t k=0UL; k<assignments; ++k )
+      {
+         futures[k].wait();
+
+         if( !futures[k].isReady() || y[k] != ref[k] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Asynchronous assignment failed\n"
+                << " Details:\n"
+                << "   Round      : " << round << "\n"
+                << "   Assignment : " << k << "\n"
+                << "   Ready      : " << futures[k].isReady() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( z != ref[0UL] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Concurrent synchronous assignment failed\n"
+             << " Details:\n"
+             << "   Round      : " << round << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of asynchronous matrix assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function starts asynchronous matrix multiplications into a row-major and a column-major
+// target matrix and compares the results to the serially computed reference result. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AsyncAssignTest::testMatrixAssignment()
+{
+   test_ = "Asynchronous matrix assignment";
+
+   const size_t n( 200UL );
+
+   MT A( n, n ), B( n, n ), ref;
+   initialize( A, 2UL );
+   initialize( B, 3UL );
+
+   BLAZE_SERIAL_SECTION {
+      ref = A * B;
+   }
+
+   MT C( n, n, 0.0 );
+   blaze::DynamicMatrix<double,blaze::columnMajor> D( n, n, 0.0 );
+
+   blaze::Future f1( blaze::asyncAssign( C, A * B ) );
+   blaze::Future f2( blaze::asyncAssign( D, A * B ) );
+
+   f1.wait();
+   f2.wait();
+
+   if( C != ref || D != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Asynchronous assignment failed\n"
+          << " Details:\n"
+          << "   Row-major result correct    : " << ( C == ref ) << "\n"
+          << "   Column-major result correct : " << ( D == ref ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Future handles.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that a default handle is ready, that the destruction of the last copy
+// of a handle waits for the completion of the assignment, and that an asynchronous assignment
+// within a serial section computes the correct result. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void AsyncAssignTest::testHandles()
+{
+   test_ = "Future handles";
+
+   const size_t n( 600UL );
+
+   MT A( n, n );
+   VT x( n ), ref;
+   initialize( A, 4UL );
+   initialize( x, 5UL );
+
+   BLAZE_SERIAL_SECTION {
+      ref = A * x;
+   }
+
+   {
+      blaze::Future future;
+      future.wait();
+
+      if( !future.isReady() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Default handle is not ready\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      VT y( n, 0.0 );
+
+      {
+         blaze::Future f1( blaze::asyncAssign( y, A * x ) );
+         blaze::Future f2( f1 );
+      }
+
+      if( y != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Destruction of the handles did not wait for the assignment\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   BLAZE_SERIAL_SECTION
+   {
+      VT y( n, 0.0 );
+      blaze::asyncAssign( y, A * x ).wait();
+
+      if( y != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Asynchronous assignment within a serial section failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of asynchronous assignments with non-matching sizes.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that an asynchronous assignment to a target of non-matching size
+// results in a \a std::invalid_argument exception, since the target is not resized. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AsyncAssignTest::testSizeMismatch()
+{
+   test_ = "Asynchronous assignment with non-matching sizes";
+
+   MT A( 10UL, 10UL, 1.0 );
+   VT x( 10UL, 1.0 );
+
+   try {
+      VT y( 9UL );
+      blaze::asyncAssign( y, A * x ).wait();
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Assignment to a vector of non-matching size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      MT B( 10UL, 9UL );
+      blaze::asyncAssign( B, A * A ).wait();
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Assignment to a matrix of non-matching size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of asynchronous assignments to an aliased target.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that an asynchronous assignment to a target that is used as operand of
+// the right-hand side expression results in a \a std::invalid_argument exception, since the
+// assignment is executed without intermediate temporary. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void AsyncAssignTest::testAliasing()
+{
+   test_ = "Asynchronous assignment to an aliased target";
+
+   MT A( 10UL, 10UL, 1.0 ), B( 10UL, 10UL, 2.0 );
+   VT x( 10UL, 1.0 );
+
+   try {
+      blaze::asyncAssign( x, A * x ).wait();
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Assignment to an aliased vector succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::asyncAssign( A, A * B ).wait();
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Assignment to an aliased matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given matrix with deterministic values.
+//
+// \param A The matrix to be initialized.
+// \param seed The seed for the element values.
+// \return void
+*/
+void AsyncAssignTest::initialize( MT& A, size_t seed )
+{
+   for( size_t i=0UL; i<A.rows(); ++i )
+      for( size_t j=0UL; j<A.columns(); ++j )
+         A(i,j) = static_cast<double>( ( i*7UL + j*3UL + seed ) % 11UL ) - 5.0;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given vector with deterministic values.
+//
+// \param x The vector to be initialized.
+// \param seed The seed for the element values.
+// \return void
+*/
+void AsyncAssignTest::initialize( VT& x, size_t seed )
+{
+   for( size_t i=0UL; i<x.size(); ++i )
+      x[i] = static_cast<double>( ( i + seed ) % 13UL );
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running asynchronous assignment test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_ASYNCASSIGN_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during asynchronous assignment test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,466 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/BlockPartitionTest.cpp
+//  \brief Source file for the BlockPartition class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blazetest/mathtest/smp/BlockPartitionTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BlockPartitionTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+BlockPartitionTest::BlockPartitionTest()
+{
+   testUniform();
+   testIncreasing();
+   testDecreasing();
+   testEmpty();
+   testAlignment();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the partitioning in case of a uniform workload.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the partitioning of rows/columns with uniform workload. All
+// blocks except for the last one are expected to contain the same number of rows, which is the
+// equal share of the rows rounded up to the alignment. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void BlockPartitionTest::testUniform()
+{
+   using blaze::BlockPartition;
+
+   test_ = "Uniform workload";
+
+   const size_t sizes[] = { 0UL, 1UL, 7UL, 64UL, 1000UL, 1001UL };
+   const size_t blocks[] = { 1UL, 2UL, 3UL, 7UL, 16UL };
+   const size_t alignments[] = { 1UL, 2UL, 8UL };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(size_t); ++i ) {
+      for( size_t j=0UL; j<sizeof(blocks)/sizeof(size_t); ++j ) {
+         for( size_t k=0UL; k<sizeof(alignments)/sizeof(size_t); ++k )
+         {
+            const size_t n( sizes[i] );
+            const size_t b( blocks[j] );
+            const size_t a( alignments[k] );
+
+            const BlockPartition partition( n, b, a, BlockPartition::uniform );
+
+            checkBoundaries( partition, n, b, a );
+
+            const size_t equalShare( ( n + b - 1UL ) / b );
+            const size_t share( ( ( equalShare + a - 1UL ) / a ) * a );
+
+            for( size_t block=1UL; block<b; ++block )
+            {
+               const size_t expected( ( block*share < n )?( block*share ):( n ) );
+
+               if( partition.begin( block ) != expected ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Unequal block sizes detected\n"
+                      << " Details:\n"
+                      << "   Number of rows   : " << n << "\n"
+                      << "   Number of blocks : " << b << "\n"
+                      << "   Alignment        : " << a << "\n"
+                      << "   Block            : " << block << "\n"
+                      << "   Begin of block   : " << partition.begin( block ) << "\n"
+                      << "   Expected begin   : " << expected << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the partitioning in case of an increasing workload.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the partitioning of rows/columns whose work grows with the
+// index (as for instance for the rows of a product with a lower triangular left-hand side
+// operand). The blocks are expected to perform approximately the same number of operations.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void BlockPartitionTest::testIncreasing()
+{
+   using blaze::BlockPartition;
+
+   test_ = "Increasing workload";
+
+   const size_t sizes[] = { 1UL, 100UL, 1000UL, 10007UL };
+   const size_t blocks[] = { 1UL, 2UL, 3UL, 4UL, 7UL, 16UL };
+   const size_t alignments[] = { 1UL, 4UL, 8UL };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(size_t); ++i ) {
+      for( size_t j=0UL; j<sizeof(blocks)/sizeof(size_t); ++j ) {
+         for( size_t k=0UL; k<sizeof(alignments)/sizeof(size_t); ++k )
+         {
+            const size_t n( sizes[i] );
+            const size_t b( blocks[j] );
+            const size_t a( alignments[k] );
+
+            const BlockPartition partition( n, b, a, BlockPartition::increasing );
+
+            checkBoundaries( partition, n, b, a );
+            checkBalance( partition, BlockPartition::increasing, n, b, a );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the partitioning in case of a decreasing workload.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the partitioning of rows/columns whose work shrinks with the
+// index (as for instance for the rows of a product with an upper triangular left-hand side
+// operand). The blocks are expected to perform approximately the same number of operations.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void BlockPartitionTest::testDecreasing()
+{
+   using blaze::BlockPartition;
+
+   test_ = "Decreasing workload";
+
+   const size_t sizes[] = { 1UL, 100UL, 1000UL, 10007UL };
+   const size_t blocks[] = { 1UL, 2UL, 3UL, 4UL, 7UL, 16UL };
+   const size_t alignments[] = { 1UL, 4UL, 8UL };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(size_t); ++i ) {
+      for( size_t j=0UL; j<sizeof(blocks)/sizeof(size_t); ++j ) {
+         for( size_t k=0UL; k<sizeof(alignments)/sizeof(size_t); ++k )
+         {
+            const size_t n( sizes[i] );
+            const size_t b( blocks[j] );
+            const size_t a( alignments[k] );
+
+            const BlockPartition partition( n, b, a, BlockPartition::decreasing );
+
+            checkBoundaries( partition, n, b, a );
+            checkBalance( partition, BlockPartition::decreasing, n, b, a );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the partitioning in case of more blocks than aligned rows.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the partitioning of a small number of rows/columns into
+// a large number of aligned blocks, in which case some of the blocks are expected to be empty.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void BlockPartitionTest::testEmpty()
+{
+   using blaze::BlockPartition;
+
+   test_ = "Empty blocks";
+
+   const BlockPartition::Profile profiles[] = {
+      BlockPartition::uniform, BlockPartition::increasing, BlockPartition::decreasing
+   };
+
+   const size_t n( 40UL );
+   const size_t b( 16UL );
+   const size_t a( 8UL );
+
+   for( size_t i=0UL; i<sizeof(profiles)/sizeof(BlockPartition::Profile); ++i )
+   {
+      const BlockPartition partition( n, b, a, profiles[i] );
+
+      checkBoundaries( partition, n, b, a );
+
+      if( profiles[i] != BlockPartition::uniform ) {
+         checkBalance( partition, profiles[i], n, b, a );
+      }
+
+      size_t empty( 0UL );
+
+      for( size_t block=0UL; block<b; ++block ) {
+         if( partition.begin( block ) == partition.begin( block+1UL ) )
+            ++empty;
+      }
+
+      if( empty == 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: No empty blocks detected\n"
+             << " Details:\n"
+             << "   Profile          : " << profiles[i] << "\n"
+             << "   Number of rows   : " << n << "\n"
+             << "   Number of blocks : " << b << "\n"
+             << "   Alignment        : " << a << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the alignment of the blocks of the OpenMP-based SMP assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the blocks of an OpenMP parallel assignment are rounded to a full
+// cache line only in case they split the contiguous dimension of the target and otherwise only
+// to the number of elements per intrinsic operation of a vectorized assignment. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void BlockPartitionTest::testAlignment()
+{
+#if BLAZE_OPENMP_PARALLEL_MODE
+   using blaze::getBlockAlignment;
+
+   test_ = "Block alignment";
+
+   const size_t simd( blaze::IntrinsicTrait<double>::size );
+   const size_t line( 64UL / sizeof(double) );
+
+   const size_t results[] = {
+      getBlockAlignment<double>( true , true  ), ( simd > line )?( simd ):( line ),
+      getBlockAlignment<double>( false, true  ), line,
+      getBlockAlignment<double>( true , false ), simd,
+      getBlockAlignment<double>( false, false ), 1UL,
+      getBlockAlignment< blaze::complex<double> >( false, true  ), 4UL,
+      getBlockAlignment< blaze::complex<double> >( false, false ), 1UL
+   };
+
+   for( size_t i=0UL; i<sizeof(results)/sizeof(size_t); i+=2UL )
+   {
+      if( results[i] != results[i+1UL] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid block alignment\n"
+             << " Details:\n"
+             << "   Test case       : " << i/2UL << "\n"
+             << "   Result          : " << results[i] << "\n"
+             << "   Expected result : " << results[i+1UL] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the block boundaries of the given partition.
+//
+// \param partition The partition to be checked.
+// \param n The total number of rows/columns.
+// \param blocks The number of blocks.
+// \param alignment The alignment of the block boundaries.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the first block starts at row 0, that the block boundaries are
+// monotonically increasing and aligned, and that the last block ends at row \a n. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void BlockPartitionTest::checkBoundaries( const blaze::BlockPartition& partition,
+                                          size_t n, size_t blocks, size_t alignment ) const
+{
+   for( size_t block=0UL; block<=blocks; ++block )
+   {
+      const size_t begin( partition.begin( block ) );
+
+      const bool invalid( ( block == 0UL      && begin != 0UL ) ||
+                          ( block == blocks   && begin != n   ) ||
+                          ( block <  blocks   && begin % alignment != 0UL && begin != n ) ||
+                          ( block >  0UL      && begin < partition.begin( block-1UL ) ) ||
+                          ( begin > n ) );
+
+      if( invalid ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid block boundary detected\n"
+             << " Details:\n"
+             << "   Number of rows   : " << n << "\n"
+             << "   Number of blocks : " << blocks << "\n"
+             << "   Alignment        : " << alignment << "\n"
+             << "   Block            : " << block << "\n"
+             << "   Begin of block   : " << begin << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the workload balance of the given partition.
+//
+// \param partition The partition to be checked.
+// \param profile The workload profile of the rows/columns.
+// \param n The total number of rows/columns.
+// \param blocks The number of blocks.
+// \param alignment The alignment of the block boundaries.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that all blocks of the given partition perform approximately the same
+// work. The work of a block \f$ [r_0..r_1) \f$ is \f$ (r_1-r_0) \cdot r_1 \f$ in case of an
+// increasing and \f$ (r_1-r_0) \cdot (n-r_0) \f$ in case of a decreasing workload. Since each
+// boundary is rounded by less than \a alignment+1 rows, which changes the work of a block by
+// less than \f$ (alignment+1) \cdot n \f$, the work of two blocks must not differ by more than
+// \f$ 4 \cdot (alignment+1) \cdot n \f$. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void BlockPartitionTest::checkBalance( const blaze::BlockPartition& partition,
+                                       blaze::BlockPartition::Profile profile,
+                                       size_t n, size_t blocks, size_t alignment ) const
+{
+   size_t minWork( n*n );
+   size_t maxWork( 0UL );
+
+   for( size_t block=0UL; block<blocks; ++block )
+   {
+      const size_t r0( partition.begin( block ) );
+      const size_t r1( partition.begin( block+1UL ) );
+      const size_t work( ( profile == blaze::BlockPartition::increasing )
+                         ?( ( r1 - r0 ) * r1 )
+                         :( ( r1 - r0 ) * ( n - r0 ) ) );
+
+      if( work < minWork ) minWork = work;
+      if( work > maxWork ) maxWork = work;
+   }
+
+   if( maxWork - minWork > 4UL*( alignment+1UL )*n ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Unbalanced partition detected\n"
+          << " Details:\n"
+          << "   Number of rows   : " << n << "\n"
+          << "   Number of blocks : " << blocks << "\n"
+          << "   Alignment        : " << alignment << "\n"
+          << "   Minimum work     : " << minWork << "\n"
+          << "   Maximum work     : " << maxWork << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running BlockPartition class test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_BLOCKPARTITION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during BlockPartition class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
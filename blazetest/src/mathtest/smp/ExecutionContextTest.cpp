@@ -0,0 +1,365 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/ExecutionContextTest.cpp
+//  \brief Source file for the ExecutionContext test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <blazetest/mathtest/smp/ExecutionContextTest.h>
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+#  include <thread>
+#elif BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <boost/thread/thread.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+typedef std::thread  ClientThread;  //!< Type of the application threads.
+#elif BLAZE_BOOST_THREADS_PARALLEL_MODE
+typedef boost::thread  ClientThread;  //!< Type of the application threads.
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ExecutionContextTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ExecutionContextTest::ExecutionContextTest()
+{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   testConcurrentContexts();
+   testNestedOperations();
+   testParallelSection();
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+
+//*************************************************************************************************
+/*!\brief Test of the concurrent use of several execution contexts.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of several application threads that concurrently evaluate
+// parallel matrix multiplications. Each thread either uses its own context borrowing the
+// process-wide workers, its own context owning two worker threads, or the default context.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ExecutionContextTest::testConcurrentContexts()
+{
+   test_ = "Concurrent execution contexts";
+
+   const size_t clients( 6UL );
+
+   std::vector<blaze::ExecutionContext*> contexts( clients, 0 );
+   std::vector<size_t> errors( clients, 0UL );
+   std::vector<ClientThread*> threads( clients, 0 );
+
+   for( size_t i=0UL; i<clients; ++i )
+   {
+      if( i % 3UL == 0UL )
+         contexts[i] = new blaze::ExecutionContext();
+      else if( i % 3UL == 1UL )
+         contexts[i] = new blaze::ExecutionContext( 2UL );
+
+      const Client client = { contexts[i], i, ( i % 3UL == 1UL )?( 2UL ):( 0UL ), &errors[i] };
+      threads[i] = new ClientThread( client );
+   }
+
+   for( size_t i=0UL; i<clients; ++i ) {
+      threads[i]->join();
+      delete threads[i];
+      delete contexts[i];
+   }
+
+   for( size_t i=0UL; i<clients; ++i )
+   {
+      if( errors[i] != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Concurrent multiplication failed\n"
+             << " Details:\n"
+             << "   Client            : " << i << "\n"
+             << "   Context           : " << ( ( i % 3UL == 0UL )?( "borrowed" )
+                                             :( ( i % 3UL == 1UL )?( "owned" ):( "default" ) ) )
+                                             << "\n"
+             << "   Number of failures: " << errors[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of parallel operations executed from within the tasks of an execution context.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of tasks that are scheduled via the execution context of the
+// calling thread and that themselves execute parallel vector assignments. The nested operations
+// are expected to be executed serially by the worker threads and to compute the correct result.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ExecutionContextTest::testNestedOperations()
+{
+   test_ = "Parallel operations within tasks";
+
+   const size_t tasks( 32UL );
+   const size_t n( blaze::SMP_DVECASSIGN_THRESHOLD + 100UL );
+
+   const VT x( n, 1.0 );
+   std::vector<VT> y( tasks, VT( n, 0.0 ) );
+   bool flags[tasks];
+
+   for( size_t i=0UL; i<tasks; ++i ) {
+      flags[i] = false;
+      const NestedAssignment task = { &y[i], &x, &flags[i] };
+      blaze::TheThreadBackend::context().schedule( task );
+   }
+
+   blaze::TheThreadBackend::wait();
+
+   for( size_t i=0UL; i<tasks; ++i )
+   {
+      if( y[i][0UL] != 2.0 || y[i][n-1UL] != 2.0 || !flags[i] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Nested assignment failed\n"
+             << " Details:\n"
+             << "   Task                  : " << i << "\n"
+             << "   Serial section active : " << flags[i] << "\n"
+             << "   First element         : " << y[i][0UL] << " (expected 2)\n"
+             << "   Last element          : " << y[i][n-1UL] << " (expected 2)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   if( blaze::isSerialSectionActive() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Serial section still active after the tasks\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   VT z;
+   z = x * 3.0;
+
+   if( z[0UL] != 3.0 || z[n-1UL] != 3.0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Parallel assignment after the tasks failed\n"
+          << " Details:\n"
+          << "   First element : " << z[0UL] << " (expected 3)\n"
+          << "   Last element  : " << z[n-1UL] << " (expected 3)\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the activation of an execution context inside a parallel section.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the creation of an ExecutionScope inside a parallel section
+// results in a \a std::runtime_error exception. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ExecutionContextTest::testParallelSection()
+{
+   test_ = "Execution scope inside a parallel section";
+
+   blaze::ExecutionContext context;
+   bool thrown( false );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      try {
+         blaze::ExecutionScope scope( context );
+      }
+      catch( std::runtime_error& ) {
+         thrown = true;
+      }
+   }
+
+   if( !thrown ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: No exception thrown\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Evaluates a series of matrix multiplications via the execution context of the client.
+//
+// \return void
+*/
+void ExecutionContextTest::Client::operator()() const
+{
+   const size_t n( 96UL );
+
+   for( size_t rep=0UL; rep<10UL; ++rep )
+   {
+      MT A( n, n ), B( n, n ), C, R;
+
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            A(i,j) = static_cast<double>( ( i + j + id_ ) % 7UL );
+            B(i,j) = static_cast<double>( ( i * j + rep ) % 5UL );
+         }
+      }
+
+      BLAZE_SERIAL_SECTION {
+         R = A * B;
+      }
+
+      if( context_ != 0 ) {
+         blaze::ExecutionScope scope( *context_ );
+         C = A * B;
+
+         if( expectedThreads_ != 0UL && blaze::getNumThreads() != expectedThreads_ )
+            ++*errors_;
+      }
+      else {
+         C = A * B;
+      }
+
+      if( C != R )
+         ++*errors_;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs the parallel vector assignment.
+//
+// \return void
+*/
+void ExecutionContextTest::NestedAssignment::operator()() const
+{
+   *serial_ = blaze::isSerialSectionActive();
+   *lhs_ = *rhs_ + *rhs_;
+}
+//*************************************************************************************************
+
+#endif
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ExecutionContext test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_EXECUTIONCONTEXT_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ExecutionContext test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,469 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/FirstTouchTest.cpp
+//  \brief Source file for the parallel first-touch initialization test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+// Activating the parallel first-touch initialization for this test
+#define BLAZE_USE_PARALLEL_FIRST_TOUCH 1
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Memory.h>
+#include <blazetest/mathtest/smp/FirstTouchTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the FirstTouchTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+FirstTouchTest::FirstTouchTest()
+{
+   testFirstTouch();
+   testVector();
+   testRowMajor();
+   testColumnMajor();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the smpFirstTouch() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the smpFirstTouch() functions for arrays below and above
+// the SMP assignment thresholds. Arrays above the thresholds are expected to be initialized in
+// parallel in case at least two threads are available, in which case all elements and padding
+// elements are expected to be initialized. Otherwise the array is expected to be untouched. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void FirstTouchTest::testFirstTouch()
+{
+   using blaze::smpFirstTouch;
+
+   test_ = "smpFirstTouch() function";
+
+   // Initialization of dense vector arrays
+   {
+      const size_t sizes[] = { 1UL, blaze::SMP_DVECASSIGN_THRESHOLD,
+                               blaze::SMP_DVECASSIGN_THRESHOLD + 1UL,
+                               blaze::SMP_DVECASSIGN_THRESHOLD + 1001UL,
+                               4UL*blaze::SMP_DVECASSIGN_THRESHOLD + 7UL };
+
+      for( size_t k=0UL; k<sizeof(sizes)/sizeof(size_t); ++k )
+      {
+         const size_t n( sizes[k] );
+         const size_t capacity( n + 5UL );
+
+         double* array( blaze::allocate<double>( capacity ) );
+         std::fill( array, array+capacity, -1.0 );
+
+         const bool touched( smpFirstTouch( array, n, capacity, 2.0 ) );
+
+         for( size_t i=0UL; i<capacity; ++i )
+         {
+            const double expected( ( !touched )?( -1.0 ):( ( i < n )?( 2.0 ):( 0.0 ) ) );
+
+            if( array[i] != expected ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid vector initialization detected\n"
+                   << " Details:\n"
+                   << "   Size             : " << n << "\n"
+                   << "   Capacity         : " << capacity << "\n"
+                   << "   Initialized      : " << touched << "\n"
+                   << "   Index            : " << i << "\n"
+                   << "   Element          : " << array[i] << "\n"
+                   << "   Expected element : " << expected << "\n";
+               blaze::deallocate( array );
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         blaze::deallocate( array );
+
+         const bool parallel( n > blaze::SMP_DVECASSIGN_THRESHOLD &&
+                              blaze::firstTouchThreads() > 1UL );
+
+         if( touched != parallel ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid vector initialization mode detected\n"
+                << " Details:\n"
+                << "   Size        : " << n << "\n"
+                << "   Threads     : " << blaze::firstTouchThreads() << "\n"
+                << "   Initialized : " << touched << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   // Initialization of dense matrix arrays
+   {
+      const size_t rows[] = { 1UL, blaze::SMP_DMATASSIGN_THRESHOLD,
+                              blaze::SMP_DMATASSIGN_THRESHOLD + 1UL,
+                              3UL*blaze::SMP_DMATASSIGN_THRESHOLD + 13UL };
+
+      for( size_t k=0UL; k<sizeof(rows)/sizeof(size_t); ++k )
+      {
+         const size_t m ( rows[k] );
+         const size_t n ( 37UL );
+         const size_t nn( 40UL );
+
+         double* array( blaze::allocate<double>( m*nn ) );
+         std::fill( array, array+m*nn, -1.0 );
+
+         const bool touched( smpFirstTouch( array, m, n, nn, 3.0 ) );
+
+         for( size_t i=0UL; i<m*nn; ++i )
+         {
+            const double expected( ( !touched )?( -1.0 ):( ( i%nn < n )?( 3.0 ):( 0.0 ) ) );
+
+            if( array[i] != expected ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid matrix initialization detected\n"
+                   << " Details:\n"
+                   << "   Number of rows/columns : " << m << "\n"
+                   << "   Initialized            : " << touched << "\n"
+                   << "   Index                  : " << i << "\n"
+                   << "   Element                : " << array[i] << "\n"
+                   << "   Expected element       : " << expected << "\n";
+               blaze::deallocate( array );
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         blaze::deallocate( array );
+
+         const bool parallel( m > blaze::SMP_DMATASSIGN_THRESHOLD &&
+                              blaze::firstTouchThreads() > 1UL );
+
+         if( touched != parallel ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid matrix initialization mode detected\n"
+                << " Details:\n"
+                << "   Number of rows/columns : " << m << "\n"
+                << "   Threads                : " << blaze::firstTouchThreads() << "\n"
+                << "   Initialized            : " << touched << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   // Initialization within a serial section
+   {
+      const size_t n( 2UL*blaze::SMP_DVECASSIGN_THRESHOLD );
+
+      double* array( blaze::allocate<double>( n ) );
+      bool touched( false );
+
+      BLAZE_SERIAL_SECTION {
+         touched = smpFirstTouch( array, n, n, 1.0 );
+      }
+
+      blaze::deallocate( array );
+
+      if( touched ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Parallel initialization within a serial section\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the initialization of DynamicVector instances.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the elements of DynamicVector instances after construction and after
+// resizing, both below and above the SMP assignment threshold. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void FirstTouchTest::testVector()
+{
+   test_ = "DynamicVector initialization";
+
+   const size_t sizes[] = { 0UL, 7UL, blaze::SMP_DVECASSIGN_THRESHOLD - 1UL,
+                            blaze::SMP_DVECASSIGN_THRESHOLD + 1UL,
+                            3UL*blaze::SMP_DVECASSIGN_THRESHOLD + 5UL };
+
+   for( size_t k=0UL; k<sizeof(sizes)/sizeof(size_t); ++k )
+   {
+      const size_t n( sizes[k] );
+
+      // Construction with a homogeneous initialization
+      {
+         const VT vec( n, 2.0 );
+         checkVector( vec, n, 2.0 );
+      }
+
+      // Construction without initialization
+      {
+         const VT vec( n );
+         checkPadding( vec.data(), vec.size(), vec.capacity() );
+      }
+
+      // Resizing with preservation of the elements
+      {
+         VT vec( n, 3.0 );
+         vec.resize( 2UL*n + 11UL, true );
+         checkVector( vec, n, 3.0 );
+
+         for( size_t i=n; i<vec.size(); ++i )
+            vec[i] = 3.0;
+
+         vec.resize( 3UL*n + 1013UL, true );
+         checkVector( vec, 2UL*n + 11UL, 3.0 );
+      }
+
+      // Resizing without preservation of the elements
+      {
+         VT vec( 5UL, 1.0 );
+         vec.resize( n, false );
+         checkPadding( vec.data(), vec.size(), vec.capacity() );
+
+         vec = 4.0;
+         checkVector( vec, n, 4.0 );
+      }
+
+      // Copy construction
+      {
+         const VT vec( n, 5.0 );
+         const VT copy( vec );
+         checkVector( copy, n, 5.0 );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the initialization of row-major DynamicMatrix instances.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the elements of row-major DynamicMatrix instances after construction
+// and after resizing, both below and above the SMP assignment threshold. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void FirstTouchTest::testRowMajor()
+{
+   test_ = "Row-major DynamicMatrix initialization";
+
+   const size_t rows[] = { 0UL, 3UL, blaze::SMP_DMATASSIGN_THRESHOLD,
+                           blaze::SMP_DMATASSIGN_THRESHOLD + 1UL,
+                           2UL*blaze::SMP_DMATASSIGN_THRESHOLD + 37UL };
+
+   for( size_t k=0UL; k<sizeof(rows)/sizeof(size_t); ++k )
+   {
+      const size_t m( rows[k] );
+      const size_t n( 13UL );
+
+      // Construction with a homogeneous initialization
+      {
+         const MT mat( m, n, 2.0 );
+         checkMatrix( mat, m, n, 2.0 );
+      }
+
+      // Construction without initialization
+      {
+         const MT mat( m, n );
+         checkMatrix( mat, 0UL, 0UL, 0.0 );
+      }
+
+      // Resizing with preservation of the elements
+      {
+         MT mat( m, n, 3.0 );
+         mat.resize( 2UL*m + 3UL, n + 9UL, true );
+         checkMatrix( mat, m, n, 3.0 );
+
+         mat.resize( m, n - 4UL, true );
+         checkMatrix( mat, m, n - 4UL, 3.0 );
+      }
+
+      // Resizing without preservation of the elements
+      {
+         MT mat( 2UL, 2UL, 1.0 );
+         mat.resize( m, n, false );
+         checkMatrix( mat, 0UL, 0UL, 0.0 );
+
+         mat = 4.0;
+         checkMatrix( mat, m, n, 4.0 );
+      }
+
+      // Copy construction
+      {
+         const MT mat( m, n, 5.0 );
+         const MT copy( mat );
+         checkMatrix( copy, m, n, 5.0 );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the initialization of column-major DynamicMatrix instances.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the elements of column-major DynamicMatrix instances after construction
+// and after resizing, both below and above the SMP assignment threshold. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void FirstTouchTest::testColumnMajor()
+{
+   test_ = "Column-major DynamicMatrix initialization";
+
+   const size_t columns[] = { 0UL, 3UL, blaze::SMP_DMATASSIGN_THRESHOLD,
+                              blaze::SMP_DMATASSIGN_THRESHOLD + 1UL,
+                              2UL*blaze::SMP_DMATASSIGN_THRESHOLD + 37UL };
+
+   for( size_t k=0UL; k<sizeof(columns)/sizeof(size_t); ++k )
+   {
+      const size_t m( 13UL );
+      const size_t n( columns[k] );
+
+      // Construction with a homogeneous initialization
+      {
+         const OMT mat( m, n, 2.0 );
+         checkMatrix( mat, m, n, 2.0 );
+      }
+
+      // Construction without initialization
+      {
+         const OMT mat( m, n );
+         checkMatrix( mat, 0UL, 0UL, 0.0 );
+      }
+
+      // Resizing with preservation of the elements
+      {
+         OMT mat( m, n, 3.0 );
+         mat.resize( m + 9UL, 2UL*n + 3UL, true );
+         checkMatrix( mat, m, n, 3.0 );
+
+         mat.resize( m - 4UL, n, true );
+         checkMatrix( mat, m - 4UL, n, 3.0 );
+      }
+
+      // Resizing without preservation of the elements
+      {
+         OMT mat( 2UL, 2UL, 1.0 );
+         mat.resize( m, n, false );
+         checkMatrix( mat, 0UL, 0UL, 0.0 );
+
+         mat = 4.0;
+         checkMatrix( mat, m, n, 4.0 );
+      }
+
+      // Copy construction
+      {
+         const OMT mat( m, n, 5.0 );
+         const OMT copy( mat );
+         checkMatrix( copy, m, n, 5.0 );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running first-touch initialization test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_FIRSTTOUCH_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during first-touch initialization test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
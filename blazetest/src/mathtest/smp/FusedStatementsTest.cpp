@@ -0,0 +1,351 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/FusedStatementsTest.cpp
+//  \brief Source file for the FusedStatements class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blaze/math/DenseSubvector.h>
+#include <blazetest/mathtest/smp/FusedStatementsTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the FusedStatementsTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+FusedStatementsTest::FusedStatementsTest()
+{
+   const size_t sizes[] = { 0UL, 1UL, 63UL, 1000UL, 40000UL, 123457UL, 1000003UL };
+
+   for( size_t i=0UL; i<sizeof(sizes)/sizeof(size_t); ++i ) {
+      testStatements  ( sizes[i] );
+      testSubvectors  ( sizes[i] );
+      testElementTypes( sizes[i] );
+   }
+
+   testSerialSection();
+   testRecording();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of a sequence of fused vector statements.
+//
+// \param n The size of the vectors.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function fuses the vector updates of a conjugate gradient iteration, which read the
+// results of the previous statements, and compares the results to the results of the unfused
+// statements. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void FusedStatementsTest::testStatements( size_t n )
+{
+   test_ = "Fused vector statements";
+
+   const double alpha( 0.5 ), beta( 0.25 );
+
+   VT r( n ), Ap( n ), p( n ), x( n );
+   initialize( r , 3UL );
+   initialize( Ap, 5UL );
+   initialize( p , 7UL );
+   initialize( x , 11UL );
+
+   VT refr( r ), refp( p ), refx( x );
+   refr -= alpha * Ap;
+   refp  = refr + beta * refp;
+   refx += alpha * refp;
+
+   blaze::FusedStatements statements;
+   statements.subAssign( r, alpha * Ap );
+   statements.assign   ( p, r + beta * p );
+   statements.addAssign( x, alpha * p );
+
+   if( statements.size() != 3UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of recorded statements detected\n"
+          << " Details:\n"
+          << "   Size of the vectors    : " << n << "\n"
+          << "   Number of statements   : " << statements.size() << "\n"
+          << "   Expected number        : 3\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   statements.run();
+
+   if( r != refr || p != refp || x != refx ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Evaluation of the fused statements failed\n"
+          << " Details:\n"
+          << "   Size of the vectors   : " << n << "\n"
+          << "   Results correct       : " << ( r == refr ) << ( p == refp )
+                                           << ( x == refx ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of fused statements on subvectors.
+//
+// \param n The size of the subvectors.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function fuses statements on aligned and unaligned subvectors, where one target is also
+// used as operand of its own and of the subsequent statement, and compares the results to the
+// results of the unfused statements. Additionally it checks that the elements outside of the
+// subvectors remain unchanged. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void FusedStatementsTest::testSubvectors( size_t n )
+{
+   test_ = "Fused statements on subvectors";
+
+   VT a( n+7UL, 1.0 ), b( n+7UL ), c( n+7UL, 2.0 );
+   initialize( b, 13UL );
+
+   VT refa( a ), refc( c );
+   subvector( refa, 3UL, n ) = subvector( refa, 3UL, n ) * 2.0 + subvector( b, 5UL, n );
+   subvector( refc, 0UL, n ) -= subvector( refa, 3UL, n );
+
+   blaze::DenseSubvector<VT> sa( subvector( a, 3UL, n ) );
+   blaze::DenseSubvector<VT> sc( subvector( c, 0UL, n ) );
+
+   blaze::FusedStatements statements;
+   statements.assign   ( sa, sa * 2.0 + subvector( b, 5UL, n ) );
+   statements.subAssign( sc, sa );
+   statements.run();
+
+   if( a != refa || c != refc ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Evaluation of the fused statements failed\n"
+          << " Details:\n"
+          << "   Size of the subvectors   : " << n << "\n"
+          << "   Results correct          : " << ( a == refa ) << ( c == refc ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of fused statements on single precision row vectors.
+//
+// \param n The size of the vectors.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function fuses statements on single precision row vectors and compares the results to
+// the results of the unfused statements. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void FusedStatementsTest::testElementTypes( size_t n )
+{
+   test_ = "Fused statements on single precision row vectors";
+
+   typedef blaze::DynamicVector<float,blaze::rowVector>  RVT;
+
+   RVT t( n, 1.0F ), u( n );
+   initialize( u, 3UL );
+
+   RVT reft( t + u * u ), refu( reft - u );
+
+   blaze::FusedStatements statements;
+   statements.addAssign( t, u * u );
+   statements.assign   ( u, t - u );
+   statements.run();
+
+   if( t != reft || u != refu ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Evaluation of the fused statements failed\n"
+          << " Details:\n"
+          << "   Size of the vectors   : " << n << "\n"
+          << "   Results correct       : " << ( t == reft ) << ( u == refu ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of fused statements within a serial section.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function evaluates fused statements within a serial section. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void FusedStatementsTest::testSerialSection()
+{
+   BLAZE_SERIAL_SECTION {
+      testStatements( 200000UL );
+      testSubvectors( 200000UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the recording of fused statements.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the recording of a statement with non-matching sizes or with a
+// size differing from the size of the previously recorded statements results in a
+// \a std::invalid_argument exception and that the clear() function removes all recorded
+// statements. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void FusedStatementsTest::testRecording()
+{
+   test_ = "Recording of fused statements";
+
+   VT a( 10UL, 1.0 ), b( 11UL, 2.0 ), c( 11UL, 3.0 );
+
+   blaze::FusedStatements statements;
+
+   try {
+      statements.assign( a, b );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Recording of a statement with non-matching sizes succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   statements.assign( b, c );
+
+   try {
+      statements.assign( a, a * 2.0 );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Recording of a statement of different size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   if( statements.size() != 1UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of recorded statements detected\n"
+          << " Details:\n"
+          << "   Number of statements   : " << statements.size() << "\n"
+          << "   Expected number        : 1\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   statements.clear();
+   statements.assign( a, a * 2.0 );
+   statements.run();
+
+   if( statements.size() != 1UL || a != VT( 10UL, 2.0 ) || b != VT( 11UL, 2.0 ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Clearing the fused statements failed\n"
+          << " Details:\n"
+          << "   Number of statements   : " << statements.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running FusedStatements class test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_FUSEDSTATEMENTS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during FusedStatements class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,571 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/SpinningPoolTest.cpp
+//  \brief Source file for the SpinningPool class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blazetest/mathtest/smp/SpinningPoolTest.h>
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+#  include <condition_variable>
+#  include <mutex>
+#  include <thread>
+#  include <blaze/math/smp/threads/SpinningPool.h>
+#elif BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <boost/thread/condition.hpp>
+#  include <boost/thread/mutex.hpp>
+#  include <boost/thread/thread.hpp>
+#  include <blaze/math/smp/threads/SpinningPool.h>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+typedef blaze::SpinningPool< std::thread
+                           , std::mutex
+                           , std::unique_lock< std::mutex >
+                           , std::condition_variable
+                           >  Pool;  //!< Type of the tested pool.
+#else
+typedef blaze::SpinningPool< boost::thread
+                           , boost::mutex
+                           , boost::unique_lock< boost::mutex >
+                           , boost::condition_variable
+                           >  Pool;  //!< Type of the tested pool.
+#endif
+
+typedef Pool::Counter  Counter;  //!< Type of the atomic counters.
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+typedef std::thread  ClientThread;  //!< Type of the application threads.
+#else
+typedef boost::thread  ClientThread;  //!< Type of the application threads.
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Task counting its executions.
+*/
+struct Increment
+{
+   //**Function call operator**********************************************************************
+   void operator()() const {
+      counter_->fetch_add( 1UL );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Counter* counter_;  //!< The execution counter of the task.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Task exceeding the storage of a dispatch slot.
+//
+// The task carries a payload that exceeds the storage of a dispatch slot and is therefore
+// stored on the heap. On execution it verifies its payload and counts its execution.
+*/
+struct LargeTask
+{
+   //**Function call operator**********************************************************************
+   void operator()() const {
+      for( size_t i=0UL; i<sizeof(payload_); ++i ) {
+         if( payload_[i] != static_cast<char>( i % 127UL ) )
+            return;
+      }
+      counter_->fetch_add( 1UL );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   char     payload_[2048];  //!< The payload of the task.
+   Counter* counter_;        //!< The execution counter of the task.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Application thread scheduling tasks until it is stopped.
+*/
+struct Scheduler
+{
+   //**Function call operator**********************************************************************
+   void operator()() const {
+      while( stop_->load() == 0UL ) {
+         const Increment task = { counter_ };
+         pool_->schedule( task );
+         scheduled_->fetch_add( 1UL );
+      }
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   Pool*    pool_;       //!< The pool used for the scheduling.
+   Counter* counter_;    //!< The execution counter of the scheduled tasks.
+   Counter* scheduled_;  //!< The number of scheduled tasks.
+   Counter* stop_;       //!< The stop flag of the thread.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Counter for the executions of the initialization function.
+*/
+Counter initializations( 0UL );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization function of the worker threads.
+//
+// \return void
+*/
+void initialize()
+{
+   initializations.fetch_add( 1UL );
+}
+//*************************************************************************************************
+
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SpinningPoolTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+SpinningPoolTest::SpinningPoolTest()
+{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   testConstructor();
+   testSchedule();
+   testLargeTasks();
+   testResize();
+   testConcurrentResize();
+   testInitialization();
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+
+//*************************************************************************************************
+/*!\brief Test of the SpinningPool constructor.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of worker threads of a newly created pool and checks that
+// a pool without threads cannot be created. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void SpinningPoolTest::testConstructor()
+{
+   test_ = "SpinningPool constructor";
+
+   {
+      Pool pool( 3UL );
+
+      if( pool.size() != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of threads detected\n"
+             << " Details:\n"
+             << "   Number of threads   : " << pool.size() << "\n"
+             << "   Expected number     : 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   try {
+      Pool pool( 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Pool without threads created\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the scheduling of tasks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules a large number of small tasks, which fit into the dispatch slots of
+// the workers. Since the destructor of the pool waits for all scheduled tasks, every task is
+// expected to have been executed exactly once after the destruction of the pool. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SpinningPoolTest::testSchedule()
+{
+   test_ = "Scheduling of tasks";
+
+   const size_t tasks( 10000UL );
+   Counter* counters( new Counter[tasks] );
+
+   for( size_t i=0UL; i<tasks; ++i )
+      counters[i].store( 0UL );
+
+   {
+      Pool pool( 3UL );
+
+      for( size_t i=0UL; i<tasks; ++i ) {
+         const Increment task = { &counters[i] };
+         pool.schedule( task );
+      }
+   }
+
+   for( size_t i=0UL; i<tasks; ++i )
+   {
+      const size_t executions( counters[i].load() );
+
+      if( executions != 1UL ) {
+         delete[] counters;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of executions detected\n"
+             << " Details:\n"
+             << "   Task                  : " << i << "\n"
+             << "   Number of executions  : " << executions << "\n"
+             << "   Expected executions   : 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   delete[] counters;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the scheduling of tasks exceeding the storage of a dispatch slot.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules tasks that do not fit into the dispatch slots of the workers. Every
+// task is expected to be executed exactly once with an intact payload. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void SpinningPoolTest::testLargeTasks()
+{
+   test_ = "Scheduling of large tasks";
+
+   const size_t tasks( 500UL );
+   Counter counter( 0UL );
+
+   LargeTask task;
+   task.counter_ = &counter;
+
+   for( size_t i=0UL; i<sizeof(task.payload_); ++i )
+      task.payload_[i] = static_cast<char>( i % 127UL );
+
+   {
+      Pool pool( 2UL );
+
+      for( size_t i=0UL; i<tasks; ++i )
+         pool.schedule( task );
+   }
+
+   if( counter.load() != tasks ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of executions detected\n"
+          << " Details:\n"
+          << "   Number of executions  : " << counter.load() << "\n"
+          << "   Expected executions   : " << tasks << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resizing of the pool.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function changes the number of worker threads of a pool between scheduled tasks and
+// checks the number of threads and the execution of all tasks. Additionally it checks that a
+// pool cannot be resized to zero threads. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void SpinningPoolTest::testResize()
+{
+   test_ = "Resizing of the pool";
+
+   const size_t sizes[] = { 1UL, 4UL, 4UL, 2UL, 5UL };
+   Counter counter( 0UL );
+   size_t expected( 0UL );
+
+   {
+      Pool pool( 3UL );
+
+      for( size_t k=0UL; k<sizeof(sizes)/sizeof(size_t); ++k )
+      {
+         pool.resize( sizes[k] );
+
+         if( pool.size() != sizes[k] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid number of threads detected\n"
+                << " Details:\n"
+                << "   Number of threads   : " << pool.size() << "\n"
+                << "   Expected number     : " << sizes[k] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         for( size_t i=0UL; i<1000UL; ++i ) {
+            const Increment task = { &counter };
+            pool.schedule( task );
+         }
+
+         expected += 1000UL;
+      }
+
+      try {
+         pool.resize( 0UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing to zero threads succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   if( counter.load() != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of executions detected\n"
+          << " Details:\n"
+          << "   Number of executions  : " << counter.load() << "\n"
+          << "   Expected executions   : " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resizing of the pool while tasks are scheduled concurrently.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function repeatedly changes the number of worker threads of a pool while two other
+// threads continuously schedule tasks via the same pool. Every scheduled task is expected to
+// be executed exactly once. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void SpinningPoolTest::testConcurrentResize()
+{
+   test_ = "Resizing of the pool during the scheduling of tasks";
+
+   const size_t schedulers( 2UL );
+
+   Counter counter( 0UL ), scheduled( 0UL ), stop( 0UL );
+
+   {
+      Pool pool( 2UL );
+
+      const Scheduler scheduler = { &pool, &counter, &scheduled, &stop };
+      ClientThread* threads[schedulers];
+
+      for( size_t i=0UL; i<schedulers; ++i )
+         threads[i] = new ClientThread( scheduler );
+
+      for( size_t i=0UL; i<200UL; ++i ) {
+         pool.resize( 1UL + i % 4UL );
+      }
+
+      stop.store( 1UL );
+
+      for( size_t i=0UL; i<schedulers; ++i ) {
+         threads[i]->join();
+         delete threads[i];
+      }
+   }
+
+   if( counter.load() != scheduled.load() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of executions detected\n"
+          << " Details:\n"
+          << "   Number of executions  : " << counter.load() << "\n"
+          << "   Expected executions   : " << scheduled.load() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the initialization function of the worker threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the initialization function of a pool is executed exactly once
+// by every worker thread, including the workers started by a resize operation, and never by a
+// thread executing a task because all dispatch slots are occupied. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void SpinningPoolTest::testInitialization()
+{
+   test_ = "Initialization of the worker threads";
+
+   Counter counter( 0UL );
+   initializations.store( 0UL );
+
+   {
+      Pool pool( 2UL, &initialize );
+
+      for( size_t i=0UL; i<5000UL; ++i ) {
+         const Increment task = { &counter };
+         pool.schedule( task );
+      }
+
+      pool.resize( 3UL );
+
+      for( size_t i=0UL; i<5000UL; ++i ) {
+         const Increment task = { &counter };
+         pool.schedule( task );
+      }
+   }
+
+   if( initializations.load() != 5UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of initializations detected\n"
+          << " Details:\n"
+          << "   Number of initializations  : " << initializations.load() << "\n"
+          << "   Expected initializations   : 5\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+#endif
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SpinningPool class test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_SPINNINGPOOL_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SpinningPool class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,484 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/TaskGraphTest.cpp
+//  \brief Source file for the TaskGraph class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <blaze/math/DenseRow.h>
+#include <blaze/math/DenseSubvector.h>
+#include <blazetest/mathtest/smp/TaskGraphTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the TaskGraphTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+TaskGraphTest::TaskGraphTest()
+{
+   testIndependentStatements();
+   testDependentStatements();
+   testViews();
+   testRecording();
+   testSizeMismatch();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of a task graph with independent and dependent statements.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function records three independent statements and one statement depending on the first
+// two of them and compares the results of several executions of the task graph to the results
+// of the in-order evaluation. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void TaskGraphTest::testIndependentStatements()
+{
+   test_ = "Independent statements";
+
+   const size_t n( 600UL );
+   const double alpha( 0.5 );
+
+   MT A( n, n ), B( n, n );
+   VT p( n ), q( n ), s( n ), x( n ), r( n );
+   initialize( A, 1UL );
+   initialize( B, 2UL );
+   initialize( p, 3UL );
+   initialize( x, 4UL );
+   initialize( r, 5UL );
+
+   VT refq, refs, refx( x ), refr( r );
+
+   BLAZE_SERIAL_SECTION {
+      refq  = A * p;
+      refs  = B * p;
+      refx += alpha * p;
+      refr -= alpha * refq + refs;
+   }
+
+   blaze::TaskGraph graph;
+   graph.assign   ( q, A * p );
+   graph.assign   ( s, B * p );
+   graph.addAssign( x, alpha * p );
+   graph.subAssign( r, alpha * q + s );
+
+   if( graph.size() != 4UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of recorded statements detected\n"
+          << " Details:\n"
+          << "   Number of statements   : " << graph.size() << "\n"
+          << "   Expected number        : 4\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const VT x0( x ), r0( r );
+
+   for( size_t round=0UL; round<10UL; ++round )
+   {
+      reset( q );
+      reset( s );
+      x = x0;
+      r = r0;
+
+      graph.run();
+
+      if( q != refq || s != refs || x != refx || r != refr ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Execution of the task graph failed\n"
+             << " Details:\n"
+             << "   Round             : " << round << "\n"
+             << "   Results correct   : " << ( q == refq ) << ( s == refs )
+                                          << ( x == refx ) << ( r == refr ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of a task graph with read-after-write, write-after-read and write-after-write
+//        dependencies.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function records a chain of statements each reading the result of its predecessor,
+// statements overwriting an operand of a previous statement, statements writing the same target,
+// and a statement using its own target as operand. The results are compared to the results of
+// the in-order evaluation. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void TaskGraphTest::testDependentStatements()
+{
+   test_ = "Dependent statements";
+
+   const size_t n( 600UL );
+   const size_t length( 6UL );
+
+   MT A( n, n );
+   initialize( A, 6UL );
+
+   std::vector<VT> chain( length, VT( n ) ), refchain( length );
+   VT a( n ), b( n ), c( n ), d( n );
+   VT refa, refb, refc, refd;
+
+   for( size_t round=0UL; round<5UL; ++round )
+   {
+      initialize( chain[0UL], round );
+      initialize( a, round+1UL );
+      initialize( b, round+2UL );
+      initialize( d, round+3UL );
+
+      BLAZE_SERIAL_SECTION
+      {
+         refchain[0UL] = chain[0UL];
+         for( size_t k=1UL; k<length; ++k )
+            refchain[k] = A * refchain[k-1UL] + refchain[0UL];
+
+         refa = a; refb = b; refd = d;
+         refc  = refa + refb;
+         refa  = refb * 2.0;
+         refb  = A * refb;
+         refc += refa;
+         refd  = refc - refb;
+         refd += A * refd;
+      }
+
+      blaze::TaskGraph graph;
+
+      for( size_t k=1UL; k<length; ++k )
+         graph.assign( chain[k], A * chain[k-1UL] + chain[0UL] );
+
+      graph.assign   ( c, a + b );    // Reads a and b
+      graph.assign   ( a, b * 2.0 );  // Write-after-read on a
+      graph.assign   ( b, A * b );    // Write-after-read on b, aliased target
+      graph.addAssign( c, a );        // Write-after-write on c, read-after-write on a
+      graph.assign   ( d, c - b );    // Read-after-write on c and b
+      graph.addAssign( d, A * d );    // Aliased target
+
+      graph.run();
+
+      for( size_t k=1UL; k<length; ++k )
+      {
+         if( chain[k] != refchain[k] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Read-after-write dependency violated\n"
+                << " Details:\n"
+                << "   Round       : " << round << "\n"
+                << "   Statement   : " << k << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( a != refa || b != refb || c != refc || d != refd ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Dependency violated\n"
+             << " Details:\n"
+             << "   Round             : " << round << "\n"
+             << "   Results correct   : " << ( a == refa ) << ( b == refb )
+                                          << ( c == refc ) << ( d == refd ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of a task graph with matrix statements and view targets.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function records matrix statements and statements assigning to a subvector and to a row
+// of a matrix and compares the results to the results of the in-order evaluation. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void TaskGraphTest::testViews()
+{
+   test_ = "Matrix statements and view targets";
+
+   const size_t n( 300UL );
+
+   MT A( n, n ), B( n, n ), C( n, n ), D( n, n, 0.0 );
+   VT p( n ), t( n, 1.0 );
+   initialize( A, 7UL );
+   initialize( B, 8UL );
+   initialize( p, 9UL );
+
+   MT refC, refD( D );
+   VT reft( t );
+
+   BLAZE_SERIAL_SECTION {
+      refC  = A + B;
+      subvector( reft, 0UL, n/2UL ) = subvector( p, 0UL, n/2UL );
+      refD -= refC;
+      refD += A * B;
+      row( refC, 0UL ) = trans( p );
+   }
+
+   blaze::TaskGraph graph;
+
+   blaze::DenseSubvector<VT> sv( subvector( t, 0UL, n/2UL ) );
+   blaze::DenseRow<MT> r0( row( C, 0UL ) );
+
+   graph.assign   ( C, A + B );
+   graph.assign   ( sv, subvector( p, 0UL, n/2UL ) );
+   graph.subAssign( D, C );
+   graph.addAssign( D, A * B );
+   graph.assign   ( r0, trans( p ) );
+
+   graph.run();
+
+   if( C != refC || D != refD || t != reft ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Execution of the task graph failed\n"
+          << " Details:\n"
+          << "   Results correct   : " << ( C == refC ) << ( D == refD )
+                                       << ( t == reft ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the recording of statements.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the execution of an empty task graph, the removal of all recorded
+// statements via the clear() function, and the execution of a task graph within a serial
+// section. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void TaskGraphTest::testRecording()
+{
+   test_ = "Recording of statements";
+
+   const size_t n( 600UL );
+
+   MT A( n, n );
+   VT p( n ), q( n, 0.0 ), ref;
+   initialize( A, 10UL );
+   initialize( p, 11UL );
+
+   BLAZE_SERIAL_SECTION {
+      ref = A * p;
+   }
+
+   blaze::TaskGraph graph;
+   graph.run();
+
+   graph.assign( q, p );
+   graph.clear();
+   graph.run();
+
+   if( graph.size() != 0UL || q != VT( n, 0.0 ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Clearing the task graph failed\n"
+          << " Details:\n"
+          << "   Number of statements   : " << graph.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   BLAZE_SERIAL_SECTION
+   {
+      graph.assign( q, A * p );
+      graph.run();
+
+      if( q != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Execution within a serial section failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the recording of statements with non-matching sizes.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the recording of a statement with a target of non-matching size
+// results in a \a std::invalid_argument exception, since the targets are not resized. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void TaskGraphTest::testSizeMismatch()
+{
+   test_ = "Statements with non-matching sizes";
+
+   MT A( 10UL, 10UL, 1.0 );
+   VT p( 10UL, 1.0 );
+
+   try {
+      blaze::TaskGraph graph;
+      VT q( 9UL );
+      graph.assign( q, A * p );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Recording of a vector of non-matching size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::TaskGraph graph;
+      MT B( 9UL, 10UL );
+      graph.addAssign( B, A );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Recording of a matrix of non-matching size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given matrix with deterministic values.
+//
+// \param A The matrix to be initialized.
+// \param seed The seed for the element values.
+// \return void
+*/
+void TaskGraphTest::initialize( MT& A, size_t seed )
+{
+   for( size_t i=0UL; i<A.rows(); ++i )
+      for( size_t j=0UL; j<A.columns(); ++j )
+         A(i,j) = static_cast<double>( ( i*7UL + j*3UL + seed ) % 11UL ) * 0.125 - 0.625;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given vector with deterministic values.
+//
+// \param x The vector to be initialized.
+// \param seed The seed for the element values.
+// \return void
+*/
+void TaskGraphTest::initialize( VT& x, size_t seed )
+{
+   for( size_t i=0UL; i<x.size(); ++i )
+      x[i] = static_cast<double>( ( i + seed ) % 13UL );
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running TaskGraph class test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_TASKGRAPH_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during TaskGraph class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
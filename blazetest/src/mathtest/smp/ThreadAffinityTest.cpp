@@ -0,0 +1,462 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/ThreadAffinityTest.cpp
+//  \brief Source file for the ThreadAffinity class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blazetest/mathtest/smp/ThreadAffinityTest.h>
+
+#if ( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE ) && defined(__linux__)
+#  define BLAZETEST_THREAD_AFFINITY 1
+#  include <pthread.h>
+#  include <sched.h>
+#  include <blaze/math/smp/threads/ThreadAffinity.h>
+#  if BLAZE_CPP_THREADS_PARALLEL_MODE
+#    include <thread>
+#  else
+#    include <boost/thread/thread.hpp>
+#  endif
+#else
+#  define BLAZETEST_THREAD_AFFINITY 0
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+#if BLAZETEST_THREAD_AFFINITY
+
+//=================================================================================================
+//
+//  AUXILIARY CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Mutex type for a separate instantiation of the ThreadAffinity class template.
+//
+// The ThreadAffinity class template serializes the placement via a mutex of type \a MT and a
+// lock of type \a LT. Each test uses a separate pair of types to obtain a fresh placement.
+*/
+template< int N >  // Index of the instantiation
+struct TestMutex
+{
+   //**Constructor*********************************************************************************
+   inline TestMutex() { pthread_mutex_init( &mutex_, 0 ); }
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   inline ~TestMutex() { pthread_mutex_destroy( &mutex_ ); }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   pthread_mutex_t mutex_;  //!< The POSIX mutex.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Lock type for a separate instantiation of the ThreadAffinity class template.
+*/
+template< int N >  // Index of the instantiation
+struct TestLock
+{
+   //**Constructor*********************************************************************************
+   explicit inline TestLock( TestMutex<N>& mutex ) : mutex_( mutex ) {
+      pthread_mutex_lock( &mutex_.mutex_ );
+   }
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   inline ~TestLock() { pthread_mutex_unlock( &mutex_.mutex_ ); }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   TestMutex<N>& mutex_;  //!< The locked mutex.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Thread pinning itself via the given ThreadAffinity instantiation.
+//
+// The worker pins itself twice (the second call is supposed to have no effect) and stores the
+// CPUs it is allowed to run on afterwards.
+*/
+template< typename Affinity >  // Type of the ThreadAffinity instantiation
+struct Worker
+{
+   //**Function call operator**********************************************************************
+   void operator()() const {
+      Affinity::pin();
+      Affinity::pin();
+
+      cpu_set_t set;
+      CPU_ZERO( &set );
+      pthread_getaffinity_np( pthread_self(), sizeof( set ), &set );
+
+      for( size_t cpu=0UL; cpu<static_cast<size_t>( CPU_SETSIZE ); ++cpu )
+         if( CPU_ISSET( cpu, &set ) )
+            cpus_->push_back( cpu );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   std::vector<size_t>* cpus_;  //!< The CPUs of the thread after pinning.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+typedef std::thread  WorkerThread;  //!< Type of the worker threads.
+#else
+typedef boost::thread  WorkerThread;  //!< Type of the worker threads.
+#endif
+//*************************************************************************************************
+
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThreadAffinityTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ThreadAffinityTest::ThreadAffinityTest()
+   : test_   ()  // Label of the currently performed test
+   , allowed_()  // The CPUs the process is allowed to run on
+{
+#if BLAZETEST_THREAD_AFFINITY
+   cpu_set_t set;
+   CPU_ZERO( &set );
+   sched_getaffinity( 0, sizeof( set ), &set );
+
+   for( size_t cpu=0UL; cpu<static_cast<size_t>( CPU_SETSIZE ); ++cpu )
+      if( CPU_ISSET( cpu, &set ) )
+         allowed_.push_back( cpu );
+
+   testExplicitList();
+   testCompact();
+   testScatter();
+   testInvalidList();
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+#if BLAZETEST_THREAD_AFFINITY
+
+//*************************************************************************************************
+/*!\brief Test of the placement via an explicit list of CPUs.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the placement of threads via an explicit list of CPUs,
+// including a CPU range. The i-th thread is expected to be pinned to the i-th CPU of the list,
+// where the placement is continued cyclically in case there are more threads than CPUs. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ThreadAffinityTest::testExplicitList()
+{
+   typedef blaze::ThreadAffinity< TestMutex<0>, TestLock<0> >  Affinity;
+
+   test_ = "Explicit list of CPUs";
+
+   // Listing the allowed CPUs in reverse order, followed by a range of the first CPU
+   std::vector<size_t> expected( allowed_.rbegin(), allowed_.rend() );
+   expected.push_back( allowed_.front() );
+
+   std::ostringstream list;
+   for( size_t i=0UL; i+1UL<expected.size(); ++i )
+      list << expected[i] << ",";
+   list << allowed_.front() << "-" << allowed_.front();
+
+   setenv( "BLAZE_THREAD_AFFINITY", list.str().c_str(), 1 );
+
+   const size_t threads( 2UL*expected.size() + 1UL );
+   std::vector< std::vector<size_t> > cpus( threads );
+
+   pinThreads<Affinity>( threads, cpus );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t cpu( expected[i % expected.size()] );
+
+      if( cpus[i].size() != 1UL || cpus[i][0UL] != cpu ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid placement detected\n"
+             << " Details:\n"
+             << "   List of CPUs     : " << list.str() << "\n"
+             << "   Thread           : " << i << "\n"
+             << "   Number of CPUs   : " << cpus[i].size() << "\n"
+             << "   First CPU        : " << ( cpus[i].empty() ? 0UL : cpus[i][0UL] ) << "\n"
+             << "   Expected CPU     : " << cpu << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the compact placement.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the compact placement of threads. Every thread is expected
+// to be pinned to a single CPU and the first threads are expected to occupy every allowed CPU
+// exactly once. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ThreadAffinityTest::testCompact()
+{
+   typedef blaze::ThreadAffinity< TestMutex<1>, TestLock<1> >  Affinity;
+
+   test_ = "Compact placement";
+
+   setenv( "BLAZE_THREAD_AFFINITY", "compact", 1 );
+
+   std::vector< std::vector<size_t> > cpus( allowed_.size() );
+   pinThreads<Affinity>( allowed_.size(), cpus );
+
+   checkPermutation( cpus );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the scatter placement.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the scatter placement of threads. Every thread is expected
+// to be pinned to a single CPU and the first threads are expected to occupy every allowed CPU
+// exactly once. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ThreadAffinityTest::testScatter()
+{
+   typedef blaze::ThreadAffinity< TestMutex<2>, TestLock<2> >  Affinity;
+
+   test_ = "Scatter placement";
+
+   setenv( "BLAZE_THREAD_AFFINITY", "scatter", 1 );
+
+   std::vector< std::vector<size_t> > cpus( allowed_.size() );
+   pinThreads<Affinity>( allowed_.size(), cpus );
+
+   checkPermutation( cpus );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of an invalid list of CPUs.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the threads remain unpinned in case the list of CPUs contains an
+// invalid entry. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ThreadAffinityTest::testInvalidList()
+{
+   typedef blaze::ThreadAffinity< TestMutex<3>, TestLock<3> >  Affinity;
+
+   test_ = "Invalid list of CPUs";
+
+   std::ostringstream list;
+   list << allowed_.front() << ",x";
+
+   setenv( "BLAZE_THREAD_AFFINITY", list.str().c_str(), 1 );
+
+   std::vector< std::vector<size_t> > cpus( 2UL );
+   pinThreads<Affinity>( 2UL, cpus );
+
+   for( size_t i=0UL; i<cpus.size(); ++i )
+   {
+      if( cpus[i] != allowed_ ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Pinned thread detected\n"
+             << " Details:\n"
+             << "   List of CPUs           : " << list.str() << "\n"
+             << "   Thread                 : " << i << "\n"
+             << "   Number of CPUs         : " << cpus[i].size() << "\n"
+             << "   Number of allowed CPUs : " << allowed_.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Starting the given number of threads one after another and collecting their CPUs.
+//
+// \param threads The number of threads.
+// \param cpus The resulting CPUs of each thread after pinning.
+// \return void
+//
+// The threads are started and joined one at a time, such that the i-th thread is the i-th
+// thread pinned via the given ThreadAffinity instantiation.
+*/
+template< typename Affinity >  // Type of the ThreadAffinity instantiation
+void ThreadAffinityTest::pinThreads( size_t threads,
+                                     std::vector< std::vector<size_t> >& cpus ) const
+{
+   for( size_t i=0UL; i<threads; ++i ) {
+      const Worker<Affinity> worker = { &cpus[i] };
+      WorkerThread thread( worker );
+      thread.join();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that the given threads occupy every allowed CPU exactly once.
+//
+// \param cpus The CPUs of each thread after pinning.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ThreadAffinityTest::checkPermutation( const std::vector< std::vector<size_t> >& cpus ) const
+{
+   std::vector<size_t> placement;
+
+   for( size_t i=0UL; i<cpus.size(); ++i )
+   {
+      if( cpus[i].size() != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Thread not pinned to a single CPU\n"
+             << " Details:\n"
+             << "   Thread         : " << i << "\n"
+             << "   Number of CPUs : " << cpus[i].size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      placement.push_back( cpus[i][0UL] );
+   }
+
+   std::sort( placement.begin(), placement.end() );
+
+   if( placement != allowed_ ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Threads do not occupy every allowed CPU exactly once\n"
+          << " Details:\n"
+          << "   Number of threads      : " << cpus.size() << "\n"
+          << "   Number of allowed CPUs : " << allowed_.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+#endif
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ThreadAffinity class test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_THREADAFFINITY_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ThreadAffinity class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
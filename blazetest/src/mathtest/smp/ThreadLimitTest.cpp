@@ -0,0 +1,425 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/ThreadLimitTest.cpp
+//  \brief Source file for the thread limit test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <blazetest/mathtest/smp/ThreadLimitTest.h>
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+#  include <thread>
+#elif BLAZE_BOOST_THREADS_PARALLEL_MODE
+#  include <boost/thread/thread.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE
+typedef std::thread  ClientThread;  //!< Type of the application threads.
+#elif BLAZE_BOOST_THREADS_PARALLEL_MODE
+typedef boost::thread  ClientThread;  //!< Type of the application threads.
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThreadLimitTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ThreadLimitTest::ThreadLimitTest()
+{
+   testNestedLimits();
+   testSerialLimit();
+   testOperations();
+   testInvalidLimit();
+   testThreadLocality();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of nested thread limit sections.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the active thread limit and the number of available threads within
+// nested thread limit sections and after leaving them. Within nested sections the smaller of
+// both limits is expected to be in effect. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ThreadLimitTest::testNestedLimits()
+{
+   test_ = "Nested thread limit sections";
+
+   const size_t available( blaze::getAvailableThreads() );
+
+   checkLimit( ~size_t( 0UL ), "outside of all sections" );
+
+   BLAZE_THREAD_LIMIT( 2UL )
+   {
+      checkLimit( 2UL, "limit 2" );
+
+      BLAZE_THREAD_LIMIT( 3UL ) {
+         checkLimit( 2UL, "limit 3 within limit 2" );
+      }
+
+      BLAZE_THREAD_LIMIT( 1UL ) {
+         checkLimit( 1UL, "limit 1 within limit 2" );
+      }
+
+      checkLimit( 2UL, "limit 2 after nested sections" );
+   }
+
+   checkLimit( ~size_t( 0UL ), "after all sections" );
+
+   if( blaze::getAvailableThreads() != available ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Number of available threads not restored\n"
+          << " Details:\n"
+          << "   Available threads   : " << blaze::getAvailableThreads() << "\n"
+          << "   Expected threads    : " << available << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of a thread limit section with a limit of 1.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that a thread limit of 1 activates the serial execution of all parallel
+// operations, both for a block of code and for a single statement, and that the serial
+// execution ends with the section. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ThreadLimitTest::testSerialLimit()
+{
+   test_ = "Thread limit section with a limit of 1";
+
+   BLAZE_THREAD_LIMIT( 1UL )
+   {
+      if( !blaze::isSerialSectionActive() || blaze::getAvailableThreads() != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Parallel execution within the section detected\n"
+             << " Details:\n"
+             << "   Serial section active   : " << blaze::isSerialSectionActive() << "\n"
+             << "   Available threads       : " << blaze::getAvailableThreads() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   bool serial( false );
+
+   BLAZE_THREAD_LIMIT( 1UL ) serial = blaze::isSerialSectionActive();
+
+   if( !serial || blaze::isSerialSectionActive() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid serial execution detected\n"
+          << " Details:\n"
+          << "   Serial within the statement   : " << serial << "\n"
+          << "   Serial after the statement    : " << blaze::isSerialSectionActive() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of parallel operations within thread limit sections.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function evaluates a matrix multiplication and a vector operation within thread limit
+// sections of different limits and compares the results to the serially computed reference
+// results. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ThreadLimitTest::testOperations()
+{
+   test_ = "Operations within thread limit sections";
+
+   const size_t n( 300UL );
+
+   MT A( n, n ), B( n, n ), refC;
+   initialize( A, 1UL );
+   initialize( B, 2UL );
+
+   const VT x( 200000UL, 1.0 ), y( 200000UL, 2.0 );
+   VT refz;
+
+   BLAZE_SERIAL_SECTION {
+      refC = A * B;
+      refz = x + y * 2.0;
+   }
+
+   for( size_t limit=1UL; limit<=4UL; ++limit )
+   {
+      MT C;
+      VT z;
+
+      BLAZE_THREAD_LIMIT( limit ) {
+         C = A * B;
+         z = x + y * 2.0;
+      }
+
+      if( C != refC || z != refz ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Operation within the section failed\n"
+             << " Details:\n"
+             << "   Thread limit      : " << limit << "\n"
+             << "   Results correct   : " << ( C == refC ) << ( z == refz ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of an invalid thread limit.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that a thread limit of 0 results in a \a std::invalid_argument exception
+// without entering the section and without changing the active thread limit. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ThreadLimitTest::testInvalidLimit()
+{
+   test_ = "Invalid thread limit";
+
+   BLAZE_THREAD_LIMIT( 2UL )
+   {
+      bool entered( false );
+
+      try {
+         BLAZE_THREAD_LIMIT( 0UL ) {
+            entered = true;
+         }
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Thread limit of 0 accepted\n"
+             << " Details:\n"
+             << "   Section entered   : " << entered << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkLimit( 2UL, "after the invalid section" );
+   }
+
+   checkLimit( ~size_t( 0UL ), "after all sections" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the thread locality of the thread limit.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that in case of the thread-based parallelization a thread limit section
+// only restricts the thread that entered the section. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ThreadLimitTest::testThreadLocality()
+{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   test_ = "Thread locality of the thread limit";
+
+   size_t limit( 0UL );
+
+   BLAZE_THREAD_LIMIT( 1UL )
+   {
+      const LimitQuery query = { &limit };
+      ClientThread thread( query );
+      thread.join();
+   }
+
+   if( limit != ~size_t( 0UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Thread limit of another thread in effect\n"
+          << " Details:\n"
+          << "   Thread limit of the application thread   : " << limit << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the active thread limit.
+//
+// \param expected The expected thread limit.
+// \param section Description of the current section.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the active thread limit and the number of available threads against
+// the given expected thread limit. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ThreadLimitTest::checkLimit( size_t expected, const std::string& section ) const
+{
+   if( blaze::getThreadLimit() != expected || blaze::getAvailableThreads() > expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid thread limit detected\n"
+          << " Details:\n"
+          << "   Section             : " << section << "\n"
+          << "   Thread limit        : " << blaze::getThreadLimit() << "\n"
+          << "   Expected limit      : " << expected << "\n"
+          << "   Available threads   : " << blaze::getAvailableThreads() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given matrix with deterministic values.
+//
+// \param A The matrix to be initialized.
+// \param seed The seed for the element values.
+// \return void
+*/
+void ThreadLimitTest::initialize( MT& A, size_t seed )
+{
+   for( size_t i=0UL; i<A.rows(); ++i )
+      for( size_t j=0UL; j<A.columns(); ++j )
+         A(i,j) = static_cast<double>( ( i*7UL + j*3UL + seed ) % 11UL ) - 5.0;
+}
+//*************************************************************************************************
+
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+//*************************************************************************************************
+/*!\brief Queries the thread limit of the application thread.
+//
+// \return void
+*/
+void ThreadLimitTest::LimitQuery::operator()() const
+{
+   *limit_ = blaze::getThreadLimit();
+}
+//*************************************************************************************************
+#endif
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running thread limit test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_THREADLIMIT_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during thread limit test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
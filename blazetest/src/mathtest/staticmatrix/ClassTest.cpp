@@ -42,7 +42,9 @@
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DiagonalMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
 #include <blaze/math/LowerMatrix.h>
+#include <blaze/math/StaticVector.h>
 #include <blaze/math/UpperMatrix.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/Random.h>
@@ -97,6 +99,9 @@ ClassTest::ClassTest()
    testTranspose();
    testSwap();
    testIsDefault();
+   testDeterminant();
+   testInversion();
+   testSolve();
 }
 //*************************************************************************************************
 
@@ -7394,6 +7399,419 @@ void ClassTest::testIsDefault()
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Test of the \c det() function with the StaticMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c det() function with the StaticMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testDeterminant()
+{
+   using blaze::det;
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major det() function";
+
+      // Determinant of a 2x2 matrix
+      {
+         const double array[2][2] = { { 2.0, 1.0 }, { 1.0, 3.0 } };
+         blaze::StaticMatrix<double,2UL,2UL,blaze::rowMajor> mat( array );
+
+         if( std::fabs( det( mat ) - 5.0 ) > 1E-12 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid determinant\n"
+                << " Details:\n"
+                << "   Result: " << det( mat ) << "\n"
+                << "   Expected result: 5\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Determinant of a 3x3 matrix
+      {
+         const double array[3][3] = { { 2.0, 0.0, 1.0 }, { 1.0, 3.0, 2.0 }, { 1.0, 1.0, 4.0 } };
+         blaze::StaticMatrix<double,3UL,3UL,blaze::rowMajor> mat( array );
+
+         if( std::fabs( det( mat ) - 18.0 ) > 1E-12 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid determinant\n"
+                << " Details:\n"
+                << "   Result: " << det( mat ) << "\n"
+                << "   Expected result: 18\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Determinant of a 5x5 upper triangular matrix
+      {
+         blaze::StaticMatrix<double,5UL,5UL,blaze::rowMajor> mat;
+         for( size_t i=0UL; i<5UL; ++i ) {
+            for( size_t j=i; j<5UL; ++j ) {
+               mat(i,j) = ( i == j )?( i+1UL ):( 0.5 );
+            }
+         }
+
+         if( std::fabs( det( mat ) - 120.0 ) > 1E-12 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid determinant\n"
+                << " Details:\n"
+                << "   Result: " << det( mat ) << "\n"
+                << "   Expected result: 120\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major det() function";
+
+      // Determinant of a 4x4 anti-diagonal matrix
+      {
+         blaze::StaticMatrix<double,4UL,4UL,blaze::columnMajor> mat;
+         for( size_t i=0UL; i<4UL; ++i ) {
+            mat(i,3UL-i) = i+2UL;
+         }
+
+         if( std::fabs( det( mat ) - 120.0 ) > 1E-12 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid determinant\n"
+                << " Details:\n"
+                << "   Result: " << det( mat ) << "\n"
+                << "   Expected result: 120\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Determinant of a 6x6 anti-diagonal matrix
+      {
+         blaze::StaticMatrix<double,6UL,6UL,blaze::columnMajor> mat;
+         for( size_t i=0UL; i<6UL; ++i ) {
+            mat(i,5UL-i) = i+1UL;
+         }
+
+         if( std::fabs( det( mat ) + 720.0 ) > 1E-12 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid determinant\n"
+                << " Details:\n"
+                << "   Result: " << det( mat ) << "\n"
+                << "   Expected result: -720\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c inv() and \c invert() functions with the StaticMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c inv() and \c invert() functions with the StaticMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testInversion()
+{
+   using blaze::inv;
+   using blaze::invert;
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major inv() function";
+
+      // Inversion of a 2x2 matrix
+      {
+         const double array[2][2] = { { 4.0, 7.0 }, { 2.0, 6.0 } };
+         checkInverse( blaze::StaticMatrix<double,2UL,2UL,blaze::rowMajor>( array ) );
+      }
+
+      // Inversion of a 3x3 matrix requiring pivoting
+      {
+         const double array[3][3] = { { 0.0, 2.0, 1.0 }, { 3.0, 0.0, 2.0 }, { 1.0, 1.0, 0.0 } };
+         checkInverse( blaze::StaticMatrix<double,3UL,3UL,blaze::rowMajor>( array ) );
+      }
+
+      // Inversion of a 4x4 matrix
+      {
+         const double array[4][4] = { { 5.0, 1.0, 0.0, 2.0 }, { 1.0, 4.0, 1.0, 0.0 },
+                                      { 0.0, 1.0, 3.0, 1.0 }, { 2.0, 0.0, 1.0, 6.0 } };
+         checkInverse( blaze::StaticMatrix<double,4UL,4UL,blaze::rowMajor>( array ) );
+      }
+
+      // Inversion of a 5x5 matrix requiring pivoting
+      {
+         blaze::StaticMatrix<double,5UL,5UL,blaze::rowMajor> mat;
+         for( size_t i=0UL; i<5UL; ++i ) {
+            for( size_t j=0UL; j<5UL; ++j ) {
+               mat(i,j) = ( i == j )?( 0.0 ):( 1.0 + i + 2.0*j );
+            }
+         }
+         checkInverse( mat );
+      }
+
+      // Inversion of a 6x6 matrix
+      {
+         blaze::StaticMatrix<double,6UL,6UL,blaze::rowMajor> mat;
+         for( size_t i=0UL; i<6UL; ++i ) {
+            for( size_t j=0UL; j<6UL; ++j ) {
+               mat(i,j) = ( i == j )?( 10.0 ):( 1.0 / ( 1.0 + i + j ) );
+            }
+         }
+         checkInverse( mat );
+      }
+   }
+
+   {
+      test_ = "Row-major invert() function";
+
+      // In-place inversion of a 6x6 matrix
+      {
+         blaze::StaticMatrix<double,6UL,6UL,blaze::rowMajor> mat;
+         for( size_t i=0UL; i<6UL; ++i ) {
+            mat(i,5UL-i) = 2.0;
+            mat(i,i) += 1.0;
+         }
+
+         const blaze::StaticMatrix<double,6UL,6UL,blaze::rowMajor> ref( inv( mat ) );
+         invert( mat );
+
+         for( size_t i=0UL; i<6UL; ++i ) {
+            for( size_t j=0UL; j<6UL; ++j ) {
+               if( std::fabs( mat(i,j) - ref(i,j) ) > 1E-12 ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: In-place inversion failed\n"
+                      << " Details:\n"
+                      << "   Result:\n" << mat << "\n"
+                      << "   Expected result:\n" << ref << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      // Inversion of a singular 3x3 matrix
+      try {
+         const double array[3][3] = { { 1.0, 2.0, 3.0 }, { 4.0, 5.0, 6.0 }, { 5.0, 7.0, 9.0 } };
+         blaze::StaticMatrix<double,3UL,3UL,blaze::rowMajor> mat( array );
+         invert( mat );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inversion of a singular matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ) != "Singular matrix provided" )
+            throw;
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major inv() function";
+
+      // Inversion of a 2x2 matrix
+      {
+         const double array[2][2] = { { 0.0, 3.0 }, { 2.0, 1.0 } };
+         checkInverse( blaze::StaticMatrix<double,2UL,2UL,blaze::columnMajor>( array ) );
+      }
+
+      // Inversion of a 3x3 matrix
+      {
+         const double array[3][3] = { { 2.0, 0.0, 1.0 }, { 1.0, 3.0, 2.0 }, { 1.0, 1.0, 4.0 } };
+         checkInverse( blaze::StaticMatrix<double,3UL,3UL,blaze::columnMajor>( array ) );
+      }
+
+      // Inversion of a 4x4 matrix requiring pivoting
+      {
+         blaze::StaticMatrix<double,4UL,4UL,blaze::columnMajor> mat;
+         for( size_t i=0UL; i<4UL; ++i ) {
+            mat(i,3UL-i) = i+2UL;
+            mat(i,(i+1UL)%4UL) += 0.5;
+         }
+         checkInverse( mat );
+      }
+
+      // Inversion of a 5x5 matrix
+      {
+         blaze::StaticMatrix<double,5UL,5UL,blaze::columnMajor> mat;
+         for( size_t i=0UL; i<5UL; ++i ) {
+            for( size_t j=0UL; j<5UL; ++j ) {
+               mat(i,j) = ( i == j )?( 8.0 ):( 1.0 / ( 1.0 + i + j ) );
+            }
+         }
+         checkInverse( mat );
+      }
+
+      // Inversion of a 6x6 matrix requiring pivoting
+      {
+         blaze::StaticMatrix<double,6UL,6UL,blaze::columnMajor> mat;
+         for( size_t i=0UL; i<6UL; ++i ) {
+            for( size_t j=0UL; j<6UL; ++j ) {
+               mat(i,j) = ( i == j )?( 0.0 ):( 1.0 + 2.0*i + j );
+            }
+         }
+         checkInverse( mat );
+      }
+   }
+
+   {
+      test_ = "Column-major invert() function";
+
+      // Inversion of a singular 5x5 matrix
+      try {
+         blaze::StaticMatrix<double,5UL,5UL,blaze::columnMajor> mat;
+         for( size_t i=0UL; i<5UL; ++i ) {
+            for( size_t j=0UL; j<4UL; ++j ) {
+               mat(i,j) = ( i == j )?( 2.0 ):( 1.0 );
+            }
+         }
+         invert( mat );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inversion of a singular matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ) != "Singular matrix provided" )
+            throw;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c solve() function with the StaticMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c solve() function with the StaticMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSolve()
+{
+   using blaze::solve;
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major solve() function";
+
+      // Solving a 3x3 system
+      {
+         const double array[3][3] = { { 0.0, 2.0, 1.0 }, { 3.0, 0.0, 2.0 }, { 1.0, 1.0, 0.0 } };
+         blaze::StaticMatrix<double,3UL,3UL,blaze::rowMajor> mat( array );
+         blaze::StaticVector<double,3UL,blaze::columnVector> x( 1.0, -2.0, 3.0 );
+         blaze::StaticVector<double,3UL,blaze::columnVector> b( mat * x );
+
+         solve( mat, b );
+
+         if( std::fabs( b[0] - x[0] ) > 1E-12 || std::fabs( b[1] - x[1] ) > 1E-12 ||
+             std::fabs( b[2] - x[2] ) > 1E-12 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Solving the linear system failed\n"
+                << " Details:\n"
+                << "   Result:\n" << b << "\n"
+                << "   Expected result:\n" << x << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Solving a system with a vector of invalid size
+      try {
+         blaze::StaticMatrix<double,3UL,3UL,blaze::rowMajor> mat;
+         blaze::DynamicVector<double,blaze::columnVector> b( 4UL, 1.0 );
+
+         solve( mat, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving a system with a vector of invalid size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << b << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major solve() function";
+
+      // Solving a 6x6 system
+      {
+         blaze::StaticMatrix<double,6UL,6UL,blaze::columnMajor> mat;
+         blaze::DynamicVector<double,blaze::columnVector> x( 6UL );
+         for( size_t i=0UL; i<6UL; ++i ) {
+            for( size_t j=0UL; j<6UL; ++j ) {
+               mat(i,j) = ( i == j )?( 0.0 ):( 1.0 + 2.0*i + j );
+            }
+            x[i] = 1.0 + i;
+         }
+         blaze::DynamicVector<double,blaze::columnVector> b( mat * x );
+
+         solve( mat, b );
+
+         for( size_t i=0UL; i<6UL; ++i ) {
+            if( std::fabs( b[i] - x[i] ) > 1E-12 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Solving the linear system failed\n"
+                   << " Details:\n"
+                   << "   Result:\n" << b << "\n"
+                   << "   Expected result:\n" << x << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
 } // namespace staticmatrix
 
 } // namespace mathtest
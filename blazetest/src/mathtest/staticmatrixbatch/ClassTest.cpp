@@ -0,0 +1,898 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/staticmatrixbatch/ClassTest.cpp
+//  \brief Source file for the StaticMatrixBatch class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/staticmatrixbatch/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace staticmatrixbatch {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the StaticMatrixBatch class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testFunctionCall();
+   testGatherScatter();
+   testResize();
+   testSwap();
+   testMultiplication();
+   testAddition();
+   testTransposition();
+   testInversion();
+   testSolver();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the StaticMatrixBatch and StaticVectorBatch constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the StaticMatrixBatch and the
+// StaticVectorBatch class templates. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "StaticMatrixBatch default constructor";
+
+      MBT batch;
+
+      checkSize( batch, 0UL );
+   }
+
+   {
+      test_ = "StaticVectorBatch default constructor";
+
+      VBT batch;
+
+      checkSize( batch, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "StaticMatrixBatch size constructor";
+
+      MBT batch( 5UL );
+
+      checkSize( batch, 5UL );
+
+      if( batch.blocks() != ( 5UL + MBT::lanes - 1UL ) / MBT::lanes ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of blocks detected\n"
+             << " Details:\n"
+             << "   Number of blocks: " << batch.blocks() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "StaticVectorBatch size constructor";
+
+      VBT batch( 5UL );
+
+      checkSize( batch, 5UL );
+   }
+
+
+   //=====================================================================================
+   // Range constructor
+   //=====================================================================================
+
+   {
+      test_ = "StaticMatrixBatch range constructor";
+
+      MatrixArray mats( 3UL );
+      for( size_t k=0UL; k<3UL; ++k )
+         for( size_t i=0UL; i<2UL; ++i )
+            for( size_t j=0UL; j<3UL; ++j )
+               mats[k](i,j) = int( 100UL*k + 10UL*i + j );
+
+      MBT batch( mats.begin(), mats.end() );
+
+      checkSize( batch, 3UL );
+
+      if( batch.get( 0UL ) != mats[0] || batch.get( 1UL ) != mats[1] ||
+          batch.get( 2UL ) != mats[2] || batch(2,1,2) != 212 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << batch.get( 2UL ) << "\n"
+             << "   Expected result:\n" << mats[2] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "StaticVectorBatch range constructor";
+
+      VectorArray vecs( 3UL );
+      for( size_t k=0UL; k<3UL; ++k )
+         for( size_t i=0UL; i<3UL; ++i )
+            vecs[k][i] = int( 10UL*k + i );
+
+      VBT batch( vecs.begin(), vecs.end() );
+
+      checkSize( batch, 3UL );
+
+      if( batch.get( 0UL ) != vecs[0] || batch.get( 2UL ) != vecs[2] || batch(1,2) != 12 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << batch.get( 2UL ) << "\n"
+             << "   Expected result:\n" << vecs[2] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the StaticMatrixBatch function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the element access via the function call operator and of
+// the interleaved storage scheme of the StaticMatrixBatch class template. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   test_ = "StaticMatrixBatch::operator()";
+
+   MBT batch( 2UL*MBT::lanes );
+   batch.reset();
+
+   batch(0,0,0) = 1;
+   batch(1,0,0) = 2;
+   batch(MBT::lanes,1,2) = 3;
+
+   const int* data( batch.data() );
+
+   if( data[0] != 1 || data[1] != 2 ||
+       batch.data( 1UL )[(1UL*3UL+2UL)*MBT::lanes] != 3 || data[MBT::blockSize] != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Function call operator failed\n"
+          << " Details:\n"
+          << "   Result:\n" << batch.get( 0UL ) << "\n" << batch.get( MBT::lanes ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the gather(), scatter() and set() member functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the conversion between arrays of matrices and matrix
+// batches. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testGatherScatter()
+{
+   {
+      test_ = "StaticMatrixBatch::gather() and StaticMatrixBatch::scatter()";
+
+      MatrixArray mats( 11UL ), result( 11UL );
+      for( size_t k=0UL; k<mats.size(); ++k )
+         for( size_t i=0UL; i<2UL; ++i )
+            for( size_t j=0UL; j<3UL; ++j )
+               mats[k](i,j) = blaze::rand<int>( -10, 10 );
+
+      MBT batch;
+      batch.gather( mats.begin(), mats.end() );
+      batch.scatter( result.begin() );
+
+      checkSize( batch, 11UL );
+
+      for( size_t k=0UL; k<mats.size(); ++k ) {
+         if( result[k] != mats[k] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Gather/scatter operation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << result[k] << "\n"
+                << "   Expected result:\n" << mats[k] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "StaticMatrixBatch::set()";
+
+      MBT batch( 3UL );
+      blaze::DynamicMatrix<int> mat( 2UL, 3UL, 4 );
+
+      batch.set( 1UL, mat );
+
+      if( batch(1,1,2) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting a matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << batch.get( 1UL ) << "\n"
+             << "   Expected result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         batch.set( 0UL, blaze::DynamicMatrix<int>( 3UL, 2UL ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting a matrix of invalid size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "StaticVectorBatch::gather() and StaticVectorBatch::scatter()";
+
+      VectorArray vecs( 11UL ), result( 11UL );
+      for( size_t k=0UL; k<vecs.size(); ++k )
+         for( size_t i=0UL; i<3UL; ++i )
+            vecs[k][i] = blaze::rand<int>( -10, 10 );
+
+      VBT batch;
+      batch.gather( vecs.begin(), vecs.end() );
+      batch.scatter( result.begin() );
+
+      checkSize( batch, 11UL );
+
+      for( size_t k=0UL; k<vecs.size(); ++k ) {
+         if( result[k] != vecs[k] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Gather/scatter operation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << result[k] << "\n"
+                << "   Expected result:\n" << vecs[k] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize() member functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the resize() member function of the StaticMatrixBatch class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "StaticMatrixBatch::resize()";
+
+   MBT batch( 3UL );
+   batch.reset();
+   batch(2,1,1) = 5;
+
+   batch.resize( 2UL );
+   checkSize( batch, 2UL );
+
+   batch.resize( 3UL );
+   checkSize( batch, 3UL );
+
+   if( batch(2,1,1) != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resizing the batch failed\n"
+          << " Details:\n"
+          << "   Result:\n" << batch.get( 2UL ) << "\n"
+          << "   Expected result: zero matrix\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   batch(0,0,1) = 7;
+   batch.resize( 5UL*MBT::lanes );
+   checkSize( batch, 5UL*MBT::lanes );
+
+   if( batch(0,0,1) != 7 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resizing the batch failed\n"
+          << " Details:\n"
+          << "   Result:\n" << batch.get( 0UL ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   batch.clear();
+   checkSize( batch, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the swap functionality.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the swap function of the StaticMatrixBatch class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "StaticMatrixBatch swap";
+
+   MBT batch1( 2UL ), batch2( 5UL );
+   batch1.reset();
+   batch2.reset();
+   batch1(1,0,0) = 1;
+   batch2(4,1,2) = 2;
+
+   swap( batch1, batch2 );
+
+   checkSize( batch1, 5UL );
+   checkSize( batch2, 2UL );
+
+   if( batch1(4,1,2) != 2 || batch2(1,0,0) != 1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the batches failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched multiplications.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the batched matrix/matrix and matrix/vector multiplications
+// for several batch sizes, including batch sizes that are not a multiple of the number of
+// interleaved matrices and batch sizes that exceed the SMP threshold. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   typedef blaze::StaticMatrixBatch<double,3UL,2UL>  RBT;
+   typedef blaze::StaticMatrixBatch<double,2UL,2UL>  PBT;
+   typedef blaze::StaticVectorBatch<double,2UL>      XBT;
+   typedef blaze::StaticVectorBatch<double,3UL>      YBT;
+
+   const size_t sizes[] = { 1UL, 7UL, 33UL, 2501UL };
+
+   for( size_t s=0UL; s<sizeof(sizes)/sizeof(size_t); ++s )
+   {
+      const size_t n( sizes[s] );
+
+      RBT A( n ), C;
+      PBT B( n );
+      XBT x( n ), y;
+      YBT z;
+
+      for( size_t k=0UL; k<n; ++k ) {
+         for( size_t i=0UL; i<3UL; ++i )
+            for( size_t j=0UL; j<2UL; ++j )
+               A(k,i,j) = blaze::rand<int>( -10, 10 );
+         for( size_t i=0UL; i<2UL; ++i ) {
+            x(k,i) = blaze::rand<int>( -10, 10 );
+            for( size_t j=0UL; j<2UL; ++j )
+               B(k,i,j) = blaze::rand<int>( -10, 10 );
+         }
+      }
+
+      {
+         test_ = "Batched matrix/matrix multiplication";
+
+         mult( C, A, B );
+
+         checkSize( C, n );
+
+         for( size_t k=0UL; k<n; ++k ) {
+            if( C.get( k ) != A.get( k ) * B.get( k ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication failed\n"
+                   << " Details:\n"
+                   << "   Batch size: " << n << "\n"
+                   << "   Result:\n" << C.get( k ) << "\n"
+                   << "   Expected result:\n" << A.get( k ) * B.get( k ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      {
+         test_ = "Batched matrix/vector multiplication";
+
+         mult( z, A, x );
+
+         checkSize( z, n );
+
+         for( size_t k=0UL; k<n; ++k ) {
+            if( z.get( k ) != A.get( k ) * x.get( k ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication failed\n"
+                   << " Details:\n"
+                   << "   Batch size: " << n << "\n"
+                   << "   Result:\n" << z.get( k ) << "\n"
+                   << "   Expected result:\n" << A.get( k ) * x.get( k ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      {
+         test_ = "Batched aliased matrix/vector multiplication";
+
+         mult( y, B, x );
+         mult( x, B, x );
+
+         for( size_t k=0UL; k<n; ++k ) {
+            if( x.get( k ) != y.get( k ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication failed\n"
+                   << " Details:\n"
+                   << "   Batch size: " << n << "\n"
+                   << "   Result:\n" << x.get( k ) << "\n"
+                   << "   Expected result:\n" << y.get( k ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Batched multiplication with non-matching batch sizes";
+
+      try {
+         MBT A( 2UL ), C;
+         blaze::StaticMatrixBatch<int,3UL,3UL> B( 3UL );
+         mult( C, A, B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication of non-matching batches succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched additions and subtractions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the batched additions and subtractions of matrices and
+// vectors. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAddition()
+{
+   const size_t sizes[] = { 1UL, 7UL, 33UL, 2501UL };
+
+   for( size_t s=0UL; s<sizeof(sizes)/sizeof(size_t); ++s )
+   {
+      const size_t n( sizes[s] );
+
+      MBT A( n ), B( n ), C;
+      VBT a( n ), b( n ), c;
+
+      for( size_t k=0UL; k<n; ++k ) {
+         for( size_t i=0UL; i<3UL; ++i ) {
+            a(k,i) = blaze::rand<int>( -10, 10 );
+            b(k,i) = blaze::rand<int>( -10, 10 );
+         }
+         for( size_t i=0UL; i<2UL; ++i ) {
+            for( size_t j=0UL; j<3UL; ++j ) {
+               A(k,i,j) = blaze::rand<int>( -10, 10 );
+               B(k,i,j) = blaze::rand<int>( -10, 10 );
+            }
+         }
+      }
+
+      {
+         test_ = "Batched matrix addition and subtraction";
+
+         add( C, A, B );
+
+         for( size_t k=0UL; k<n; ++k ) {
+            if( C.get( k ) != A.get( k ) + B.get( k ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Addition failed\n"
+                   << " Details:\n"
+                   << "   Batch size: " << n << "\n"
+                   << "   Result:\n" << C.get( k ) << "\n"
+                   << "   Expected result:\n" << A.get( k ) + B.get( k ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         sub( C, C, B );
+
+         for( size_t k=0UL; k<n; ++k ) {
+            if( C.get( k ) != A.get( k ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Subtraction failed\n"
+                   << " Details:\n"
+                   << "   Batch size: " << n << "\n"
+                   << "   Result:\n" << C.get( k ) << "\n"
+                   << "   Expected result:\n" << A.get( k ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      {
+         test_ = "Batched vector addition and subtraction";
+
+         sub( c, a, b );
+
+         for( size_t k=0UL; k<n; ++k ) {
+            if( c.get( k ) != a.get( k ) - b.get( k ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Subtraction failed\n"
+                   << " Details:\n"
+                   << "   Batch size: " << n << "\n"
+                   << "   Result:\n" << c.get( k ) << "\n"
+                   << "   Expected result:\n" << a.get( k ) - b.get( k ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         add( c, c, b );
+
+         for( size_t k=0UL; k<n; ++k ) {
+            if( c.get( k ) != a.get( k ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Addition failed\n"
+                   << " Details:\n"
+                   << "   Batch size: " << n << "\n"
+                   << "   Result:\n" << c.get( k ) << "\n"
+                   << "   Expected result:\n" << a.get( k ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched transposition.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the batched transposition of rectangular and (in-place)
+// square matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testTransposition()
+{
+   {
+      test_ = "Batched transposition of rectangular matrices";
+
+      MBT A( 13UL );
+      blaze::StaticMatrixBatch<int,3UL,2UL> B;
+
+      for( size_t k=0UL; k<13UL; ++k )
+         for( size_t i=0UL; i<2UL; ++i )
+            for( size_t j=0UL; j<3UL; ++j )
+               A(k,i,j) = blaze::rand<int>( -10, 10 );
+
+      trans( B, A );
+
+      checkSize( B, 13UL );
+
+      for( size_t k=0UL; k<13UL; ++k ) {
+         if( B.get( k ) != trans( A.get( k ) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Transposition failed\n"
+                << " Details:\n"
+                << "   Result:\n" << B.get( k ) << "\n"
+                << "   Expected result:\n" << trans( A.get( k ) ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "Batched in-place transposition of square matrices";
+
+      blaze::StaticMatrixBatch<double,3UL,3UL> A( 13UL ), B;
+
+      for( size_t k=0UL; k<13UL; ++k )
+         for( size_t i=0UL; i<3UL; ++i )
+            for( size_t j=0UL; j<3UL; ++j )
+               A(k,i,j) = blaze::rand<int>( -10, 10 );
+
+      B = A;
+      trans( A, A );
+
+      for( size_t k=0UL; k<13UL; ++k ) {
+         if( A.get( k ) != trans( B.get( k ) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Transposition failed\n"
+                << " Details:\n"
+                << "   Result:\n" << A.get( k ) << "\n"
+                << "   Expected result:\n" << trans( B.get( k ) ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched inversion.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the batched inversion of square matrices. The matrices are
+// chosen such that every second matrix requires row interchanges. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testInversion()
+{
+   typedef blaze::StaticMatrixBatch<double,4UL,4UL>  BT;
+
+   const size_t sizes[] = { 1UL, 7UL, 33UL, 2501UL };
+
+   for( size_t s=0UL; s<sizeof(sizes)/sizeof(size_t); ++s )
+   {
+      test_ = "Batched inversion";
+
+      const size_t n( sizes[s] );
+
+      BT A( n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         for( size_t i=0UL; i<4UL; ++i ) {
+            for( size_t j=0UL; j<4UL; ++j )
+               A(k,i,j) = blaze::rand<int>( -5, 5 );
+            A(k,i,(i+k)%4UL) += 25.0;
+         }
+      }
+
+      BT B( A );
+      invert( B );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const BT::MatrixType I( A.get( k ) * B.get( k ) );
+
+         double error( 0.0 );
+         for( size_t i=0UL; i<4UL; ++i )
+            for( size_t j=0UL; j<4UL; ++j )
+               error = blaze::max( error, std::fabs( I(i,j) - ( i == j ? 1.0 : 0.0 ) ) );
+
+         if( error > 1E-12 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Inversion failed\n"
+                << " Details:\n"
+                << "   Batch size: " << n << "\n"
+                << "   Matrix:\n" << A.get( k ) << "\n"
+                << "   Result:\n" << B.get( k ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "Batched inversion of a singular matrix";
+
+      BT A( 3UL );
+      A.reset();
+      for( size_t k=0UL; k<2UL; ++k )
+         for( size_t i=0UL; i<4UL; ++i )
+            A(k,i,i) = 2.0;
+
+      try {
+         invert( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inversion of a singular matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ) != "Singular matrix provided" )
+            throw;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched solver.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the batched solution of linear systems of equations. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSolver()
+{
+   typedef blaze::StaticMatrixBatch<double,5UL,5UL>  MT5;
+   typedef blaze::StaticVectorBatch<double,5UL>      VT5;
+
+   const size_t sizes[] = { 1UL, 7UL, 33UL, 2501UL };
+
+   for( size_t s=0UL; s<sizeof(sizes)/sizeof(size_t); ++s )
+   {
+      test_ = "Batched solver";
+
+      const size_t n( sizes[s] );
+
+      MT5 A( n );
+      VT5 x( n ), b;
+
+      for( size_t k=0UL; k<n; ++k ) {
+         for( size_t i=0UL; i<5UL; ++i ) {
+            x(k,i) = blaze::rand<int>( -10, 10 );
+            for( size_t j=0UL; j<5UL; ++j )
+               A(k,i,j) = blaze::rand<int>( -5, 5 );
+            A(k,i,(i+k)%5UL) += 30.0;
+         }
+      }
+
+      mult( b, A, x );
+      solve( A, b );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         double error( 0.0 );
+         for( size_t i=0UL; i<5UL; ++i )
+            error = blaze::max( error, std::fabs( b(k,i) - x(k,i) ) );
+
+         if( error > 1E-10 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Solving the linear system failed\n"
+                << " Details:\n"
+                << "   Batch size: " << n << "\n"
+                << "   Result:\n" << b.get( k ) << "\n"
+                << "   Expected result:\n" << x.get( k ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace staticmatrixbatch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running StaticMatrixBatch class test..." << std::endl;
+
+   try
+   {
+      RUN_STATICMATRIXBATCH_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during StaticMatrixBatch class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
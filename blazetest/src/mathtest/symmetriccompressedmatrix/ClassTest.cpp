@@ -0,0 +1,1366 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/symmetriccompressedmatrix/ClassTest.cpp
+//  \brief Source file for the SymmetricCompressedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/DenseSubvector.h>
+#include <blaze/math/SparseSubmatrix.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/symmetriccompressedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace symmetriccompressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SymmetricCompressedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testScaling();
+   testFunctionCall();
+   testIterator();
+   testNonZeros();
+   testReset();
+   testClear();
+   testErase();
+   testResize();
+   testSwap();
+   testFind();
+   testLowerBound();
+   testUpperBound();
+   testIsDefault();
+   testAppend();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SymmetricCompressedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the SymmetricCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "SymmetricCompressedMatrix default constructor";
+
+      MT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "SymmetricCompressedMatrix size constructor (3x3)";
+
+      MT mat( 3UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 0UL );
+
+      if( mat(0,0) != 0 || mat(1,2) != 0 || mat(2,1) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 0 0 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Size/Capacity constructor
+   //=====================================================================================
+
+   {
+      test_ = "SymmetricCompressedMatrix size/capacity constructor (3x3,4)";
+
+      MT mat( 3UL, 4UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 4UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "SymmetricCompressedMatrix size/vector constructor (3x3)";
+
+      std::vector<size_t> nonzeros( 3UL );
+      nonzeros[0] = 2UL;
+      nonzeros[1] = 1UL;
+      nonzeros[2] = 0UL;
+
+      MT mat( 3UL, nonzeros );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 3UL );
+      checkCapacity( mat, 0UL, 2UL );
+      checkCapacity( mat, 1UL, 1UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "SymmetricCompressedMatrix copy constructor (3x3)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 3UL, 3UL );
+      tmp(0,0) = 1;
+      tmp(0,2) = 2;
+      tmp(2,0) = 2;
+      tmp(1,2) = 3;
+      tmp(2,1) = 3;
+
+      MT mat1( tmp );
+      MT mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 5UL );
+      checkNonZeros( mat2, 0UL, 2UL );
+      checkNonZeros( mat2, 1UL, 1UL );
+      checkNonZeros( mat2, 2UL, 2UL );
+
+      if( mat2 != tmp || mat2.triangle().nonZeros() != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Number of stored elements         : " << mat2.triangle().nonZeros() << "\n"
+             << "   Expected number of stored elements: 3\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 2 )\n( 0 0 3 )\n( 2 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Conversion constructors
+   //=====================================================================================
+
+   {
+      test_ = "SymmetricCompressedMatrix dense matrix constructor";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> tmp( 3UL, 3UL, 0 );
+      tmp(0,1) = 1;
+      tmp(1,0) = 1;
+      tmp(1,1) = 2;
+      tmp(2,2) = 3;
+
+      MT  mat1( tmp );
+      LMT mat2( tmp );
+
+      checkRows    ( mat1, 3UL );
+      checkColumns ( mat1, 3UL );
+      checkNonZeros( mat1, 4UL );
+      checkNonZeros( mat2, 4UL );
+
+      if( mat1 != tmp || mat2 != tmp ||
+          mat1.triangle()(0,1) != 1 || mat1.triangle()(1,0) != 0 ||
+          mat2.triangle()(1,0) != 1 || mat2.triangle()(0,1) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result (upper storage):\n" << mat1 << "\n"
+             << "   Result (lower storage):\n" << mat2 << "\n"
+             << "   Expected result:\n" << tmp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SymmetricCompressedMatrix symmetric matrix constructor stress test";
+
+      for( size_t i=0UL; i<100UL; ++i )
+      {
+         const size_t n( blaze::rand<size_t>( 0UL, 30UL ) );
+
+         blaze::SymmetricMatrix< blaze::CompressedMatrix<int,blaze::rowMajor> > tmp( n );
+         for( size_t j=0UL; j<n*n/8UL; ++j ) {
+            tmp( blaze::rand<size_t>( 0UL, n-1UL ), blaze::rand<size_t>( 0UL, n-1UL ) ) =
+               blaze::rand<int>( 1, 10 );
+         }
+
+         const MT  mat1( tmp );
+         const LMT mat2( tmp );
+
+         if( mat1 != tmp || mat2 != tmp || nonZeros( mat1 ) != nonZeros( tmp ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Construction failed\n"
+                << " Details:\n"
+                << "   Result (upper storage):\n" << mat1 << "\n"
+                << "   Result (lower storage):\n" << mat2 << "\n"
+                << "   Expected result:\n" << tmp << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "SymmetricCompressedMatrix non-symmetric matrix constructor";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 3UL, 3UL );
+      tmp(0,1) = 1;
+      tmp(1,0) = 2;
+
+      try {
+         MT mat( tmp );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of non-symmetric matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SymmetricCompressedMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the SymmetricCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 3UL, 3UL );
+   tmp(0,2) = 1;
+   tmp(2,0) = 1;
+   tmp(1,1) = 2;
+
+   {
+      test_ = "SymmetricCompressedMatrix copy assignment";
+
+      const MT mat1( tmp );
+      MT mat2( 5UL, 4UL );
+      mat2 = mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2 != tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 0 0 1 )\n( 0 2 0 )\n( 1 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SymmetricCompressedMatrix sparse matrix expression assignment";
+
+      LMT mat;
+      mat = 2 * tmp;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,2) != 2 || mat(2,0) != 2 || mat(1,1) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 2 )\n( 0 4 0 )\n( 2 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SymmetricCompressedMatrix addition/subtraction assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> tmp2( 3UL, 3UL );
+      tmp2(0,1) = 3;
+      tmp2(1,0) = 3;
+      tmp2(1,1) = 1;
+
+      MT mat( tmp );
+      mat += tmp2;
+      mat -= tmp;
+
+      checkRows   ( mat, 3UL );
+      checkColumns( mat, 3UL );
+
+      if( mat != tmp2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << tmp2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SymmetricCompressedMatrix non-symmetric matrix assignment";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> tmp2( 3UL, 3UL );
+      tmp2(0,1) = 1;
+
+      MT mat( tmp );
+
+      try {
+         mat += tmp2;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of non-symmetric matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( mat != tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed assignment modified the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << tmp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of all SymmetricCompressedMatrix (self-)scaling operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all available ways to scale an instance of the
+// SymmetricCompressedMatrix class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testScaling()
+{
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 3UL, 3UL );
+   tmp(0,0) =  1;
+   tmp(1,2) = -2;
+   tmp(2,1) = -2;
+
+   {
+      test_ = "SymmetricCompressedMatrix self-scaling (M*=s)";
+
+      MT mat( tmp );
+      mat *= 2;
+
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 2 || mat(1,2) != -4 || mat(2,1) != -4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 0 0 )\n( 0 0 -4 )\n( 0 -4 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SymmetricCompressedMatrix self-scaling (M/=s)";
+
+      MT mat( 4 * tmp );
+      mat /= 2;
+
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 2 || mat(1,2) != -4 || mat(2,1) != -4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 0 0 )\n( 0 0 -4 )\n( 0 -4 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SymmetricCompressedMatrix::scaleDiagonal()";
+
+      LMT mat( tmp );
+      mat.scaleDiagonal( 3 );
+
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 3 || mat(1,2) != -2 || mat(2,1) != -2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 3 0 0 )\n( 0 0 -2 )\n( 0 -2 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SymmetricCompressedMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the function call operator
+// of the SymmetricCompressedMatrix class template. Any modification of an element of the opposite
+// triangle is expected to be applied to the according stored element. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   test_ = "SymmetricCompressedMatrix::operator()";
+
+   MT  mat1( 4UL );
+   LMT mat2( 4UL );
+
+   mat1(2,1) = 1;
+   mat1(1,2) += 2;
+   mat1(3,3) = 4;
+   mat1(0,3) = 5;
+   mat1(3,0) -= 1;
+
+   mat2(2,1) = 1;
+   mat2(1,2) += 2;
+   mat2(3,3) = 4;
+   mat2(0,3) = 5;
+   mat2(3,0) -= 1;
+
+   checkNonZeros( mat1, 5UL );
+   checkNonZeros( mat1, 0UL, 1UL );
+   checkNonZeros( mat1, 1UL, 1UL );
+   checkNonZeros( mat1, 3UL, 2UL );
+   checkNonZeros( mat2, 5UL );
+
+   if( mat1(1,2) != 3 || mat1(2,1) != 3 || mat1(3,3) != 4 || mat1(0,3) != 4 || mat1(3,0) != 4 ||
+       mat1 != mat2 || mat1.triangle().nonZeros() != 3UL || mat2.triangle().nonZeros() != 3UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Function call operator failed\n"
+          << " Details:\n"
+          << "   Result (upper storage):\n" << mat1 << "\n"
+          << "   Result (lower storage):\n" << mat2 << "\n"
+          << "   Expected result:\n( 0 0 0 4 )\n( 0 0 3 0 )\n( 0 3 0 0 )\n( 4 0 0 4 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SymmetricCompressedMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the SymmetricCompressedMatrix
+// class template. The iterators are expected to traverse complete rows, including the elements
+// of the opposite triangle. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testIterator()
+{
+   typedef MT::Iterator       Iterator;
+   typedef MT::ConstIterator  ConstIterator;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 4UL, 4UL );
+   tmp(0,1) =  1;
+   tmp(1,0) =  1;
+   tmp(1,1) = -2;
+   tmp(1,3) =  3;
+   tmp(3,1) =  3;
+   tmp(2,2) =  4;
+
+   MT mat( tmp );
+
+   // Testing conversion from Iterator to ConstIterator
+   {
+      test_ = "Iterator/ConstIterator conversion";
+
+      ConstIterator it( begin( mat, 1UL ) );
+
+      if( it == end( mat, 1UL ) || it->value() != 1 || it->index() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed iterator conversion detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Counting the number of elements in the second row
+   {
+      test_ = "Iterator subtraction";
+
+      const size_t number( end( mat, 1UL ) - begin( mat, 1UL ) );
+
+      if( number != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << number << "\n"
+             << "   Expected number of elements: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing read-only access via ConstIterator
+   {
+      test_ = "Read-only access via ConstIterator";
+
+      ConstIterator it ( cbegin( mat, 3UL ) );
+      ConstIterator end( cend( mat, 3UL ) );
+
+      if( it == end || it->value() != 3 || it->index() != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator access to mirrored element failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      ++it;
+
+      if( it != end ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator end not reached\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing assignment via Iterator
+   {
+      test_ = "Assignment via Iterator";
+
+      int value = 7;
+
+      for( Iterator it=begin( mat, 1UL ); it!=end( mat, 1UL ); ++it ) {
+         *it = value++;
+      }
+
+      if( mat(1,0) != 7 || mat(0,1) != 7 || mat(1,1) != 8 || mat(1,3) != 9 || mat(3,1) != 9 ||
+          mat(2,2) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment via iterator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 7 0 0 )\n( 7 8 0 9 )\n( 0 0 4 0 )\n( 0 9 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing addition/subtraction/multiplication/division assignment via Iterator
+   {
+      test_ = "Compound assignment via Iterator";
+
+      Iterator it( begin( mat, 3UL ) );
+      it->value() += 2;
+      *begin( mat, 1UL ) -= 2;
+      *begin( mat, 2UL ) *= 2;
+      *begin( mat, 0UL ) /= 5;
+
+      if( mat(1,0) != 1 || mat(0,1) != 1 || mat(1,3) != 11 || mat(3,1) != 11 || mat(2,2) != 8 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Compound assignment via iterator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 0 0 )\n( 1 8 0 11 )\n( 0 0 8 0 )\n( 0 11 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the SymmetricCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the
+// SymmetricCompressedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "SymmetricCompressedMatrix::nonZeros()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 3UL, 3UL );
+   tmp(0,0) = 1;
+   tmp(0,2) = 2;
+   tmp(2,0) = 2;
+   tmp(1,2) = 3;
+   tmp(2,1) = 3;
+
+   const MT mat( tmp );
+
+   checkRows    ( mat, 3UL );
+   checkColumns ( mat, 3UL );
+   checkNonZeros( mat, 5UL );
+   checkNonZeros( mat, 0UL, 2UL );
+   checkNonZeros( mat, 1UL, 1UL );
+   checkNonZeros( mat, 2UL, 2UL );
+
+   if( mat.triangle().nonZeros() != 3UL ||
+       mat.mirrorEnd( 2UL ) - mat.mirrorBegin( 2UL ) != 2L ||
+       mat.mirrorEnd( 0UL ) != mat.mirrorBegin( 0UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of stored elements\n"
+          << " Details:\n"
+          << "   Number of stored elements         : " << mat.triangle().nonZeros() << "\n"
+          << "   Expected number of stored elements: 3\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the SymmetricCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the
+// SymmetricCompressedMatrix class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 3UL, 3UL );
+   tmp(0,0) = 1;
+   tmp(0,2) = 2;
+   tmp(2,0) = 2;
+   tmp(1,1) = 3;
+   tmp(1,2) = 4;
+   tmp(2,1) = 4;
+
+   {
+      test_ = "SymmetricCompressedMatrix::reset( size_t )";
+
+      MT  mat1( tmp );
+      LMT mat2( tmp );
+      reset( mat1, 2UL );
+      reset( mat2, 2UL );
+
+      checkRows    ( mat1, 3UL );
+      checkColumns ( mat1, 3UL );
+      checkNonZeros( mat1, 2UL );
+      checkNonZeros( mat1, 0UL, 1UL );
+      checkNonZeros( mat1, 1UL, 1UL );
+      checkNonZeros( mat1, 2UL, 0UL );
+
+      if( mat1(0,0) != 1 || mat1(1,1) != 3 || mat1(0,2) != 0 || mat1(1,2) != 0 || mat1 != mat2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reset operation failed\n"
+             << " Details:\n"
+             << "   Result (upper storage):\n" << mat1 << "\n"
+             << "   Result (lower storage):\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 3 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SymmetricCompressedMatrix::reset()";
+
+      MT mat( tmp );
+      reset( mat );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkNonZeros( mat, 0UL );
+
+      if( mat != blaze::CompressedMatrix<int,blaze::rowMajor>( 3UL, 3UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reset operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 0 0 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() function with the SymmetricCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() function with the SymmetricCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "SymmetricCompressedMatrix::clear()";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 3UL, 3UL );
+   tmp(0,2) = 1;
+   tmp(2,0) = 1;
+
+   MT mat( tmp );
+   clear( mat );
+
+   checkRows    ( mat, 0UL );
+   checkColumns ( mat, 0UL );
+   checkNonZeros( mat, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c erase() member functions of the SymmetricCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c erase() member functions of the
+// SymmetricCompressedMatrix class template. Erasing an element of the opposite triangle is
+// expected to erase the according stored element. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testErase()
+{
+   typedef MT::Iterator  Iterator;
+
+   blaze::SymmetricMatrix< blaze::CompressedMatrix<int,blaze::rowMajor> > tmp( 4UL );
+   tmp(0,1) = 1;
+   tmp(0,3) = 2;
+   tmp(1,1) = 3;
+   tmp(1,2) = 4;
+   tmp(2,3) = 5;
+
+   {
+      test_ = "SymmetricCompressedMatrix::erase( size_t, size_t )";
+
+      MT mat( tmp );
+      mat.erase( 3UL, 0UL );
+      mat.erase( 1UL, 1UL );
+
+      checkNonZeros( mat, 6UL );
+
+      if( mat(0,3) != 0 || mat(3,0) != 0 || mat(1,1) != 0 || mat(1,2) != 4 || mat(3,2) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Erasing elements failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SymmetricCompressedMatrix::erase( size_t, Iterator )";
+
+      LMT mat( tmp );
+      LMT::Iterator pos( mat.erase( 1UL, mat.find( 1UL, 0UL ) ) );
+
+      checkNonZeros( mat, 7UL );
+
+      if( pos == mat.end( 1UL ) || pos->index() != 1UL || mat(0,1) != 0 || mat(1,0) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Erasing an element failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SymmetricCompressedMatrix::erase( size_t, Iterator, Iterator )";
+
+      MT mat( tmp );
+      const Iterator pos( mat.erase( 2UL, mat.begin( 2UL ), mat.end( 2UL ) ) );
+
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 2UL, 0UL );
+
+      blaze::SymmetricMatrix< blaze::CompressedMatrix<int,blaze::rowMajor> > ref( tmp );
+      reset( ref, 2UL );
+
+      if( pos != mat.end( 2UL ) || mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Erasing a range of elements failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c resize() member function of the SymmetricCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c resize() member function of the
+// SymmetricCompressedMatrix class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "SymmetricCompressedMatrix::resize()";
+
+   MT mat( 2UL );
+   mat(0,1) = 1;
+   mat(1,1) = 2;
+
+   mat.resize( 4UL );
+   mat(3,0) = 3;
+
+   checkRows    ( mat, 4UL );
+   checkColumns ( mat, 4UL );
+   checkNonZeros( mat, 5UL );
+
+   if( mat(1,0) != 1 || mat(1,1) != 2 || mat(0,3) != 3 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resizing the matrix failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n( 0 1 0 3 )\n( 1 2 0 0 )\n( 0 0 0 0 )\n( 3 0 0 0 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   mat.resize( 2UL );
+
+   checkRows    ( mat, 2UL );
+   checkColumns ( mat, 2UL );
+   checkNonZeros( mat, 3UL );
+
+   if( mat(0,1) != 1 || mat(1,0) != 1 || mat(1,1) != 2 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resizing the matrix failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n( 0 1 )\n( 1 2 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the SymmetricCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the SymmetricCompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "SymmetricCompressedMatrix swap";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp1( 2UL, 2UL );
+   tmp1(0,1) = 1;
+   tmp1(1,0) = 1;
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> tmp2( 3UL, 3UL );
+   tmp2(2,2) = 2;
+
+   MT mat1( tmp1 );
+   MT mat2( tmp2 );
+
+   swap( mat1, mat2 );
+
+   checkRows    ( mat1, 3UL );
+   checkColumns ( mat1, 3UL );
+   checkNonZeros( mat1, 1UL );
+   checkRows    ( mat2, 2UL );
+   checkColumns ( mat2, 2UL );
+   checkNonZeros( mat2, 2UL );
+
+   if( mat1 != tmp2 || mat2 != tmp1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the first matrix failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat1 << "\n" << mat2 << "\n"
+          << "   Expected result:\n" << tmp2 << "\n" << tmp1 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c find() member function of the SymmetricCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find() member function of the
+// SymmetricCompressedMatrix class template. Elements of both triangles are expected to be
+// found. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFind()
+{
+   test_ = "SymmetricCompressedMatrix::find()";
+
+   typedef LMT::ConstIterator  ConstIterator;
+
+   blaze::SymmetricMatrix< blaze::CompressedMatrix<int,blaze::rowMajor> > tmp( 8UL );
+   tmp(1,2) = 1;
+   tmp(2,3) = 2;
+   tmp(6,0) = 3;
+   tmp(6,1) = 4;
+   tmp(7,7) = 5;
+
+   const LMT mat( tmp );
+
+   for( size_t i=0UL; i<8UL; ++i ) {
+      for( size_t j=0UL; j<8UL; ++j )
+      {
+         const ConstIterator pos( mat.find( i, j ) );
+
+         if( isDefault( tmp(i,j) ) && pos != mat.end( i ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Non-existing element could be found\n"
+                << " Details:\n"
+                << "   Required position = (" << i << "," << j << ")\n"
+                << "   Found index       = " << pos->index() << "\n"
+                << "   Current matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         else if( !isDefault( tmp(i,j) ) &&
+                  ( pos == mat.end( i ) || pos->index() != j || pos->value() != tmp(i,j) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Element could not be found\n"
+                << " Details:\n"
+                << "   Required position = (" << i << "," << j << ")\n"
+                << "   Current matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c lowerBound() member function of the SymmetricCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c lowerBound() member function of the
+// SymmetricCompressedMatrix class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLowerBound()
+{
+   test_ = "SymmetricCompressedMatrix::lowerBound()";
+
+   typedef MT::ConstIterator  ConstIterator;
+
+   blaze::SymmetricMatrix< blaze::CompressedMatrix<int,blaze::rowMajor> > tmp( 6UL );
+   tmp(2,0) = 1;
+   tmp(2,2) = 2;
+   tmp(2,4) = 3;
+
+   const MT mat( tmp );
+
+   const size_t expected[] = { 0UL, 2UL, 2UL, 4UL, 4UL, 6UL };
+
+   for( size_t j=0UL; j<6UL; ++j )
+   {
+      const ConstIterator pos( mat.lowerBound( 2UL, j ) );
+      const size_t index( pos == mat.end( 2UL ) ? 6UL : pos->index() );
+
+      if( index != expected[j] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Wrong element found\n"
+             << " Details:\n"
+             << "   Required index = " << j << "\n"
+             << "   Found index    = " << index << "\n"
+             << "   Expected index = " << expected[j] << "\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c upperBound() member function of the SymmetricCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c upperBound() member function of the
+// SymmetricCompressedMatrix class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testUpperBound()
+{
+   test_ = "SymmetricCompressedMatrix::upperBound()";
+
+   typedef LMT::ConstIterator  ConstIterator;
+
+   blaze::SymmetricMatrix< blaze::CompressedMatrix<int,blaze::rowMajor> > tmp( 6UL );
+   tmp(2,0) = 1;
+   tmp(2,2) = 2;
+   tmp(2,4) = 3;
+
+   const LMT mat( tmp );
+
+   const size_t expected[] = { 2UL, 2UL, 4UL, 4UL, 6UL, 6UL };
+
+   for( size_t j=0UL; j<6UL; ++j )
+   {
+      const ConstIterator pos( mat.upperBound( 2UL, j ) );
+      const size_t index( pos == mat.end( 2UL ) ? 6UL : pos->index() );
+
+      if( index != expected[j] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Wrong element found\n"
+             << " Details:\n"
+             << "   Required index = " << j << "\n"
+             << "   Found index    = " << index << "\n"
+             << "   Expected index = " << expected[j] << "\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the SymmetricCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the SymmetricCompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   {
+      MT mat;
+
+      if( isDefault( mat ) != true ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      MT mat( 3UL );
+
+      if( isDefault( mat ) != false ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c append() member function of the SymmetricCompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c append() and \c finalize() member functions of the
+// SymmetricCompressedMatrix class template. Appending an element to the stored triangle is
+// expected to implicitly set the according element of the opposite triangle. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAppend()
+{
+   test_ = "SymmetricCompressedMatrix::append()";
+
+   MT mat( 4UL, 4UL );
+   mat.append( 0UL, 0UL, 1 );
+   mat.append( 0UL, 2UL, 2 );
+   mat.finalize( 0UL );
+   mat.append( 1UL, 3UL, 3 );
+   mat.finalize( 1UL );
+   mat.finalize( 2UL );
+   mat.append( 3UL, 3UL, 4 );
+   mat.finalize( 3UL );
+
+   blaze::SymmetricMatrix< blaze::CompressedMatrix<int,blaze::rowMajor> > ref( 4UL );
+   ref(0,0) = 1;
+   ref(0,2) = 2;
+   ref(1,3) = 3;
+   ref(3,3) = 4;
+
+   checkRows    ( mat, 4UL );
+   checkColumns ( mat, 4UL );
+   checkNonZeros( mat, 6UL );
+   checkNonZeros( mat, 2UL, 1UL );
+   checkNonZeros( mat, 3UL, 2UL );
+
+   if( mat != ref || mat.mirrorEnd( 3UL ) - mat.mirrorBegin( 3UL ) != 1L ||
+       *mat.mirrorBegin( 3UL ) != 1UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Appending elements failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SymmetricCompressedMatrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the multiplication of a SymmetricCompressedMatrix with a dense vector
+// with the according multiplication of a CompressedMatrix for matrices of various sizes, both
+// storage triangles, submatrices, and compound assignments. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   test_ = "SymmetricCompressedMatrix/dense vector multiplication";
+
+   typedef blaze::CompressedMatrix<double,blaze::rowMajor>          CMT;
+   typedef blaze::SymmetricCompressedMatrix<double,true>            SUMT;
+   typedef blaze::SymmetricCompressedMatrix<double,false>           SLMT;
+   typedef blaze::DynamicVector<double,blaze::columnVector>         DVT;
+
+   const size_t sizes[] = { 0UL, 1UL, 3UL, 8UL, 17UL, 64UL, 129UL, 1000UL };
+
+   for( size_t a=0UL; a<sizeof(sizes)/sizeof(size_t); ++a )
+   {
+      const size_t n( sizes[a] );
+
+      CMT A( n, n );
+      for( size_t i=0UL; i<n; ++i ) {
+         const size_t nonzeros( blaze::rand<size_t>( 0UL, std::min<size_t>( n, 5UL ) ) );
+         for( size_t k=0UL; k<nonzeros; ++k ) {
+            const size_t j( blaze::rand<size_t>( 0UL, n-1UL ) );
+            A(i,j) = A(j,i) = blaze::rand<int>( -10, 10 );
+         }
+      }
+
+      DVT x( n );
+      for( size_t j=0UL; j<n; ++j )
+         x[j] = blaze::rand<int>( -10, 10 );
+
+      const SUMT U( A );
+      const SLMT L( A );
+
+      const DVT ref( A * x );
+      const DVT one( n, 1.0 );
+      DVT y1( one ), y2( one ), y3( one ), y4( one );
+
+      y1  = U * x;
+      y2 += U * x;
+      y3 -= L * x;
+      y4  = L * x;
+
+      bool failure( y1 != ref || y2 != one + ref || y3 != one - ref || y4 != ref );
+
+      if( n > 2UL )
+      {
+         const DVT r1( submatrix( A, 1UL, 0UL, n-2UL, n ) * x );
+         const DVT r2( submatrix( A, 1UL, 1UL, n-2UL, n-2UL ) * subvector( x, 1UL, n-2UL ) );
+
+         const DVT s1( submatrix( U, 1UL, 0UL, n-2UL, n ) * x );
+         const DVT s2( submatrix( L, 1UL, 0UL, n-2UL, n ) * x );
+         const DVT s3( submatrix( U, 1UL, 1UL, n-2UL, n-2UL ) * subvector( x, 1UL, n-2UL ) );
+
+         failure = failure || s1 != r1 || s2 != r1 || s3 != r2;
+      }
+
+      if( failure ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Matrix size: " << n << "x" << n << "\n"
+             << "   Result:\n" << y1 << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace symmetriccompressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SymmetricCompressedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_SYMMETRICCOMPRESSEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SymmetricCompressedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,1082 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/symmetricpackedmatrix/ClassTest.cpp
+//  \brief Source file for the SymmetricPackedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/DenseSubvector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Serialization.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Serialization.h>
+#include <blazetest/mathtest/symmetricpackedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace symmetricpackedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SymmetricPackedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testScaling();
+   testFunctionCall();
+   testIterator();
+   testNonZeros();
+   testReset();
+   testClear();
+   testResize();
+   testSwap();
+   testIsDefault();
+   testMultiplication();
+   testSerialization();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SymmetricPackedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the SymmetricPackedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "SymmetricPackedMatrix default constructor";
+
+      MT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "SymmetricPackedMatrix size constructor (3x3)";
+
+      MT mat( 3UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+   }
+
+
+   //=====================================================================================
+   // Homogeneous initialization
+   //=====================================================================================
+
+   {
+      test_ = "SymmetricPackedMatrix homogeneous initialization constructor (3x3)";
+
+      MT mat( 3UL, 2 );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 9UL );
+      checkNonZeros( mat, 0UL, 3UL );
+      checkNonZeros( mat, 1UL, 3UL );
+      checkNonZeros( mat, 2UL, 3UL );
+
+      if( mat(0,0) != 2 || mat(0,1) != 2 || mat(0,2) != 2 ||
+          mat(1,0) != 2 || mat(1,1) != 2 || mat(1,2) != 2 ||
+          mat(2,0) != 2 || mat(2,1) != 2 || mat(2,2) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 2 2 )\n( 2 2 2 )\n( 2 2 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "SymmetricPackedMatrix copy constructor (3x3)";
+
+      MT mat1( 3UL, 0 );
+      mat1(0,0) = 1;
+      mat1(0,2) = 2;
+      mat1(2,1) = 3;
+
+      MT mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 5UL );
+      checkNonZeros( mat2, 0UL, 2UL );
+      checkNonZeros( mat2, 1UL, 1UL );
+      checkNonZeros( mat2, 2UL, 2UL );
+
+      if( mat2(0,0) != 1 || mat2(0,1) != 0 || mat2(0,2) != 2 ||
+          mat2(1,0) != 0 || mat2(1,1) != 0 || mat2(1,2) != 3 ||
+          mat2(2,0) != 2 || mat2(2,1) != 3 || mat2(2,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 2 )\n( 0 0 3 )\n( 2 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Conversion constructors
+   //=====================================================================================
+
+   {
+      test_ = "SymmetricPackedMatrix dense matrix constructor";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> tmp( 3UL, 3UL, 0 );
+      tmp(0,1) = 1;
+      tmp(1,0) = 1;
+      tmp(1,1) = 2;
+      tmp(2,2) = 3;
+
+      MT  mat1( tmp );
+      LMT mat2( tmp );
+
+      checkRows    ( mat1, 3UL );
+      checkColumns ( mat1, 3UL );
+      checkNonZeros( mat1, 4UL );
+      checkNonZeros( mat2, 4UL );
+
+      if( mat1 != tmp || mat2 != tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result (upper storage):\n" << mat1 << "\n"
+             << "   Result (lower storage):\n" << mat2 << "\n"
+             << "   Expected result:\n" << tmp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SymmetricPackedMatrix sparse matrix constructor stress test";
+
+      for( size_t i=0UL; i<100UL; ++i )
+      {
+         const size_t n( blaze::rand<size_t>( 0UL, 30UL ) );
+
+         blaze::CompressedMatrix<int,blaze::columnMajor> tmp( n, n );
+         for( size_t j=0UL; j<n*n/8UL; ++j ) {
+            const size_t row   ( blaze::rand<size_t>( 0UL, n-1UL ) );
+            const size_t column( blaze::rand<size_t>( 0UL, n-1UL ) );
+            tmp(row,column) = tmp(column,row) = blaze::rand<int>( 1, 10 );
+         }
+
+         const MT  mat1( tmp );
+         const LMT mat2( tmp );
+
+         if( mat1 != tmp || mat2 != tmp || nonZeros( mat1 ) != nonZeros( tmp ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Construction failed\n"
+                << " Details:\n"
+                << "   Result (upper storage):\n" << mat1 << "\n"
+                << "   Result (lower storage):\n" << mat2 << "\n"
+                << "   Expected result:\n" << tmp << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "SymmetricPackedMatrix non-symmetric matrix constructor";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> tmp( 3UL, 3UL, 0 );
+      tmp(0,1) = 1;
+      tmp(1,0) = 2;
+
+      try {
+         MT mat( tmp );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of non-symmetric matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "SymmetricPackedMatrix non-square matrix constructor";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> tmp( 2UL, 3UL, 0 );
+
+      try {
+         MT mat( tmp );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of non-square matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SymmetricPackedMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the SymmetricPackedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   blaze::DynamicMatrix<int,blaze::rowMajor> tmp( 3UL, 3UL, 0 );
+   tmp(0,2) = 1;
+   tmp(2,0) = 1;
+   tmp(1,1) = 2;
+
+   {
+      test_ = "SymmetricPackedMatrix homogeneous assignment";
+
+      MT mat( 3UL );
+      mat = 4;
+
+      checkNonZeros( mat, 9UL );
+
+      if( mat != blaze::DynamicMatrix<int,blaze::rowMajor>( 3UL, 3UL, 4 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 4 4 4 )\n( 4 4 4 )\n( 4 4 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SymmetricPackedMatrix copy assignment";
+
+      const MT mat1( tmp );
+      LMT mat2;
+      MT  mat3;
+      mat2 = mat1;
+      mat3 = mat1;
+
+      checkRows    ( mat3, 3UL );
+      checkNonZeros( mat3, 3UL );
+
+      if( mat2 != tmp || mat3 != tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result (lower storage):\n" << mat2 << "\n"
+             << "   Result (upper storage):\n" << mat3 << "\n"
+             << "   Expected result:\n" << tmp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SymmetricPackedMatrix addition/subtraction assignment";
+
+      MT mat( tmp );
+      mat += tmp;
+      mat -= trans( tmp ) * 3;
+
+      if( mat != -tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << -tmp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SymmetricPackedMatrix multiplication assignment";
+
+      MT mat( tmp );
+      mat *= tmp;
+
+      if( mat != tmp * tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << tmp * tmp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SymmetricPackedMatrix non-symmetric assignment";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> rhs( 3UL, 3UL, 0 );
+      rhs(1,2) = 5;
+
+      MT mat( tmp );
+
+      try {
+         mat += rhs;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment of non-symmetric matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( mat != tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed assignment modified the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << tmp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of all SymmetricPackedMatrix (self-)scaling operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all available ways to scale an instance of the
+// SymmetricPackedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testScaling()
+{
+   test_ = "SymmetricPackedMatrix self-scaling";
+
+   MT mat( 3UL, 0 );
+   mat(0,1) = 1;
+   mat(2,2) = 2;
+
+   mat *= 3;
+   mat.scale( 2 );
+   mat /= 3;
+
+   if( mat(0,1) != 2 || mat(1,0) != 2 || mat(2,2) != 4 || nonZeros( mat ) != 3UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Scaling failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n( 0 2 0 )\n( 2 0 0 )\n( 0 0 4 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SymmetricPackedMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the function call operator of the SymmetricPackedMatrix
+// class template. Each element access has to write to the single stored element, which is
+// additionally checked via the low-level access to the packed rows. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   {
+      test_ = "SymmetricPackedMatrix::operator() (upper storage)";
+
+      MT mat( 3UL, 0 );
+      mat(2,0) = 1;
+      mat(1,1) = 2;
+      mat(1,2) = 3;
+      mat(2,1) += 1;
+
+      checkNonZeros( mat, 5UL );
+
+      // Packed upper storage: ( 0 0 1 | 2 4 | 0 )
+      const int* const row0( mat.packedBegin( 0UL ) );
+      const int* const row1( mat.packedBegin( 1UL ) );
+
+      if( mat(0,2) != 1 || mat(2,1) != 4 || mat.packedEnd( 0UL ) - row0 != 3 ||
+          row0[2] != 1 || row1[0] != 2 || row1[1] != 4 || mat.packedEnd( 2UL ) - mat.packedBegin( 2UL ) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 1 )\n( 0 2 4 )\n( 1 4 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SymmetricPackedMatrix::operator() (lower storage)";
+
+      LMT mat( 3UL, 0 );
+      mat(0,2) = 1;
+      mat(1,1) = 2;
+      mat(1,2) = 3;
+      mat(2,1) *= 2;
+
+      checkNonZeros( mat, 5UL );
+
+      // Packed lower storage: ( 0 | 0 2 | 1 6 0 )
+      const int* const row2( mat.packedBegin( 2UL ) );
+
+      if( mat(2,0) != 1 || mat(1,2) != 6 || mat.packedEnd( 2UL ) - row2 != 3 ||
+          row2[0] != 1 || row2[1] != 6 || row2[2] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 1 )\n( 0 2 6 )\n( 1 6 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SymmetricPackedMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the SymmetricPackedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   LMT mat( 3UL, 0 );
+   mat(0,1) = 1;
+   mat(2,0) = 2;
+   mat(2,2) = 3;
+
+   {
+      test_ = "SymmetricPackedMatrix iterator/const iterator conversion";
+
+      LMT::ConstIterator it( begin( mat, 1UL ) );
+
+      if( it == end( mat, 1UL ) || *it != 1 || end( mat, 1UL ) - it != 3L ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed iterator conversion detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SymmetricPackedMatrix iterator traversal";
+
+      int sum( 0 );
+      for( LMT::ConstIterator it=mat.cbegin(0UL); it!=mat.cend(0UL); ++it )
+         sum += *it;
+
+      if( sum != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator traversal failed\n"
+             << " Details:\n"
+             << "   Sum of row 0         : " << sum << "\n"
+             << "   Expected sum of row 0: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SymmetricPackedMatrix assignment via iterator";
+
+      LMT::Iterator it( mat.begin( 0UL ) );
+      *it = 4;
+      it += 2UL;
+      *it = 5;
+
+      if( mat(0,0) != 4 || mat(2,0) != 5 || mat(0,2) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment via iterator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 4 1 5 )\n( 1 0 0 )\n( 5 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the SymmetricPackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the
+// SymmetricPackedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "SymmetricPackedMatrix::nonZeros()";
+
+   MT mat( 4UL, 0 );
+
+   checkNonZeros( mat, 0UL );
+
+   mat(0,3) = 1;
+   mat(1,1) = 2;
+   mat(3,2) = 3;
+
+   checkNonZeros( mat, 5UL );
+   checkNonZeros( mat, 0UL, 1UL );
+   checkNonZeros( mat, 1UL, 1UL );
+   checkNonZeros( mat, 2UL, 1UL );
+   checkNonZeros( mat, 3UL, 2UL );
+
+   mat(3,0) = 0;
+
+   checkNonZeros( mat, 3UL );
+   checkNonZeros( mat, 0UL, 0UL );
+   checkNonZeros( mat, 3UL, 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the SymmetricPackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the SymmetricPackedMatrix
+// class template. Resetting a single row also resets the according column. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   test_ = "SymmetricPackedMatrix::reset()";
+
+   MT mat( 3UL, 1 );
+
+   reset( mat, 1UL );
+
+   checkRows    ( mat, 3UL );
+   checkNonZeros( mat, 4UL );
+   checkNonZeros( mat, 1UL, 0UL );
+
+   if( mat(0,1) != 0 || mat(2,1) != 0 || mat(0,2) != 1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reset operation failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n( 1 0 1 )\n( 0 0 0 )\n( 1 0 1 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   reset( mat );
+
+   checkRows    ( mat, 3UL );
+   checkNonZeros( mat, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the SymmetricPackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the SymmetricPackedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "SymmetricPackedMatrix::clear()";
+
+   MT mat( 3UL, 1 );
+
+   clear( mat );
+
+   checkRows    ( mat, 0UL );
+   checkColumns ( mat, 0UL );
+   checkNonZeros( mat, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c resize() member function of the SymmetricPackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c resize() member function of the SymmetricPackedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   {
+      test_ = "SymmetricPackedMatrix::resize() (upper storage)";
+
+      MT mat( 2UL, 0 );
+      mat(0,1) = 1;
+      mat(1,1) = 2;
+
+      mat.resize( 4UL );
+
+      checkRows    ( mat, 4UL );
+      checkCapacity( mat, 10UL );
+
+      mat(3,0) = 0;
+      mat(3,1) = 0;
+      mat(3,3) = 0;
+      mat(2,0) = 0;
+      mat(2,1) = 0;
+      mat(2,2) = 3;
+      mat(2,3) = 0;
+      mat(0,0) = 0;
+
+      checkNonZeros( mat, 4UL );
+
+      mat.resize( 2UL );
+
+      checkRows    ( mat, 2UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,1) != 1 || mat(1,0) != 1 || mat(1,1) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 )\n( 1 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SymmetricPackedMatrix::resize() (lower storage)";
+
+      LMT mat( 3UL, 0 );
+      mat(0,1) = 1;
+      mat(2,1) = 2;
+
+      mat.resize( 5UL );
+
+      for( size_t i=0UL; i<5UL; ++i ) {
+         for( size_t j=i; j<5UL; ++j ) {
+            if( j >= 3UL ) mat(i,j) = 0;
+         }
+      }
+
+      checkRows    ( mat, 5UL );
+      checkNonZeros( mat, 4UL );
+
+      if( mat(1,0) != 1 || mat(1,2) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the SymmetricPackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the SymmetricPackedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "SymmetricPackedMatrix swap";
+
+   MT mat1( 2UL, 1 );
+   MT mat2( 3UL, 0 );
+   mat2(0,2) = 2;
+
+   swap( mat1, mat2 );
+
+   checkRows    ( mat1, 3UL );
+   checkNonZeros( mat1, 2UL );
+   checkRows    ( mat2, 2UL );
+   checkNonZeros( mat2, 4UL );
+
+   if( mat1(2,0) != 2 || mat2(1,0) != 1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the matrices failed\n"
+          << " Details:\n"
+          << "   First matrix:\n" << mat1 << "\n"
+          << "   Second matrix:\n" << mat2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the SymmetricPackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the SymmetricPackedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   MT mat( 3UL, 0 );
+
+   if( isDefault( mat ) != false || isDefault( MT() ) != true ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid isDefault evaluation\n"
+          << " Details:\n"
+          << "   Matrix:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SymmetricPackedMatrix multiplication kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the packed kernels of the matrix/vector and the matrix/matrix
+// multiplication (including submatrices of the packed matrix, as they occur during the
+// parallel execution) by comparing the results with the multiplication of a general dense
+// matrix. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>     DMT;
+   typedef blaze::DynamicMatrix<double,blaze::columnMajor>  ODMT;
+   typedef blaze::SymmetricPackedMatrix<double,true>        SUMT;
+   typedef blaze::SymmetricPackedMatrix<double,false>       SLMT;
+   typedef blaze::DynamicVector<double,blaze::columnVector> DVT;
+
+   const size_t sizes[] = { 0UL, 1UL, 3UL, 8UL, 17UL, 64UL, 129UL };
+
+   for( size_t a=0UL; a<sizeof(sizes)/sizeof(size_t); ++a )
+   {
+      const size_t n( sizes[a] );
+
+      DMT A( n, n );
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=0UL; j<=i; ++j ) {
+            A(i,j) = A(j,i) = blaze::rand<int>( -10, 10 );
+         }
+      }
+
+      DMT B( n, 5UL );
+      for( size_t i=0UL; i<n; ++i )
+         for( size_t j=0UL; j<5UL; ++j )
+            B(i,j) = blaze::rand<int>( -10, 10 );
+
+      DVT x( n );
+      for( size_t j=0UL; j<n; ++j )
+         x[j] = blaze::rand<int>( -10, 10 );
+
+      const SUMT U( A );
+      const SLMT L( A );
+
+      {
+         test_ = "SymmetricPackedMatrix/dense vector multiplication";
+
+         const DVT ref( A * x );
+         const DVT one( n, 1.0 );
+         DVT y1( one ), y2( one ), y3( one ), y4( one );
+
+         y1  = U * x;
+         y2 += U * x;
+         y3 -= L * x;
+         y4  = L * x;
+
+         bool failure( y1 != ref || y2 != one + ref || y3 != one - ref || y4 != ref );
+
+         if( n > 2UL )
+         {
+            const DVT r1( submatrix( A, 1UL, 0UL, n-2UL, n ) * x );
+            const DVT r2( submatrix( A, 1UL, 1UL, n-2UL, n-2UL ) * subvector( x, 1UL, n-2UL ) );
+
+            const DVT s1( submatrix( U, 1UL, 0UL, n-2UL, n ) * x );
+            const DVT s2( submatrix( L, 1UL, 0UL, n-2UL, n ) * x );
+            const DVT s3( submatrix( U, 1UL, 1UL, n-2UL, n-2UL ) * subvector( x, 1UL, n-2UL ) );
+
+            failure = failure || s1 != r1 || s2 != r1 || s3 != r2;
+         }
+
+         if( failure ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Matrix size: " << n << "x" << n << "\n"
+                << "   Result:\n" << y1 << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         test_ = "SymmetricPackedMatrix/dense matrix multiplication";
+
+         const DMT ref( A * B );
+         DMT  C1( n, 5UL, 1.0 ), C2( n, 5UL, 1.0 );
+         ODMT C3( n, 5UL, 1.0 );
+
+         C1  = U * B;
+         C2 += L * B;
+         C3 -= U * B;
+
+         bool failure( C1 != ref || C2 != ref + DMT( n, 5UL, 1.0 ) || C3 != DMT( n, 5UL, 1.0 ) - ref );
+
+         if( n > 2UL )
+         {
+            const DMT r1( submatrix( A, 1UL, 0UL, n-2UL, n ) * B );
+            const DMT s1( submatrix( U, 1UL, 0UL, n-2UL, n ) * B );
+            const DMT s2( submatrix( L, 1UL, 0UL, n-2UL, n ) * B );
+
+            failure = failure || s1 != r1 || s2 != r1;
+         }
+
+         if( failure ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Matrix size: " << n << "x" << n << "\n"
+                << "   Result:\n" << C1 << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the serialization of the SymmetricPackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the serialization and deserialization of instances of the
+// SymmetricPackedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testSerialization()
+{
+   {
+      test_ = "SymmetricPackedMatrix serialization";
+
+      MT mat1( 5UL, 0 );
+      mat1(0,4) = 1;
+      mat1(2,1) = 2;
+      mat1(3,3) = 3;
+
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+      archive << mat1;
+
+      MT  mat2;
+      LMT mat3( 2UL, 7 );
+      archive << mat1;
+      archive >> mat2 >> mat3;
+
+      checkRows    ( mat2, 5UL );
+      checkNonZeros( mat2, 5UL );
+      checkRows    ( mat3, 5UL );
+      checkNonZeros( mat3, 5UL );
+
+      if( mat2 != mat1 || mat3 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Serialization failed\n"
+             << " Details:\n"
+             << "   Result (upper storage):\n" << mat2 << "\n"
+             << "   Result (lower storage):\n" << mat3 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SymmetricPackedMatrix deserialization of a non-symmetric matrix";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> tmp( 3UL, 3UL );
+      tmp(0,1) = 1;
+
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+      archive << tmp;
+
+      MT mat;
+
+      try {
+         archive >> mat;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Deserialization of non-symmetric matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+} // namespace symmetricpackedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SymmetricPackedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_SYMMETRICPACKEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SymmetricPackedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
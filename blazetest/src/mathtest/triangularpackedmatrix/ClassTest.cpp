@@ -0,0 +1,1077 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/triangularpackedmatrix/ClassTest.cpp
+//  \brief Source file for the TriangularPackedMatrix class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DenseSubmatrix.h>
+#include <blaze/math/DenseSubvector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Serialization.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Serialization.h>
+#include <blazetest/mathtest/triangularpackedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace triangularpackedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the TriangularPackedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testScaling();
+   testFunctionCall();
+   testIterator();
+   testNonZeros();
+   testReset();
+   testClear();
+   testResize();
+   testSwap();
+   testIsDefault();
+   testMultiplication();
+   testSerialization();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the TriangularPackedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the TriangularPackedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "TriangularPackedMatrix default constructor";
+
+      MT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "TriangularPackedMatrix size constructor (3x3)";
+
+      LMT mat( 3UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+
+      if( mat(0,1) != 0 || mat(0,2) != 0 || mat(1,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result: zero upper part\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Homogeneous initialization
+   //=====================================================================================
+
+   {
+      test_ = "TriangularPackedMatrix homogeneous initialization constructor (3x3)";
+
+      MT mat( 3UL, 2 );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 6UL );
+      checkNonZeros( mat, 0UL, 3UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat(0,0) != 2 || mat(0,1) != 2 || mat(0,2) != 2 ||
+          mat(1,0) != 0 || mat(1,1) != 2 || mat(1,2) != 2 ||
+          mat(2,0) != 0 || mat(2,1) != 0 || mat(2,2) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 2 2 )\n( 0 2 2 )\n( 0 0 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "TriangularPackedMatrix copy constructor (3x3)";
+
+      LMT mat1( 3UL, 0 );
+      mat1(0,0) = 1;
+      mat1(2,0) = 2;
+      mat1(2,1) = 3;
+
+      LMT mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+      checkNonZeros( mat2, 0UL, 1UL );
+      checkNonZeros( mat2, 1UL, 0UL );
+      checkNonZeros( mat2, 2UL, 2UL );
+
+      if( mat2(0,0) != 1 || mat2(0,1) != 0 || mat2(0,2) != 0 ||
+          mat2(1,0) != 0 || mat2(1,1) != 0 || mat2(1,2) != 0 ||
+          mat2(2,0) != 2 || mat2(2,1) != 3 || mat2(2,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 0 0 )\n( 2 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Conversion constructors
+   //=====================================================================================
+
+   {
+      test_ = "TriangularPackedMatrix dense matrix constructor";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> tmp( 3UL, 3UL, 0 );
+      tmp(0,1) = 1;
+      tmp(1,1) = 2;
+      tmp(0,2) = 3;
+
+      MT mat1( tmp );
+      MT mat2( trans( trans( tmp ) ) );
+
+      checkRows    ( mat1, 3UL );
+      checkColumns ( mat1, 3UL );
+      checkNonZeros( mat1, 3UL );
+
+      if( mat1 != tmp || mat2 != tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n" << tmp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "TriangularPackedMatrix sparse matrix constructor stress test";
+
+      for( size_t i=0UL; i<100UL; ++i )
+      {
+         const size_t n( blaze::rand<size_t>( 0UL, 30UL ) );
+
+         blaze::CompressedMatrix<int,blaze::rowMajor> tmp( n, n );
+         for( size_t j=0UL; j<n*n/8UL; ++j ) {
+            const size_t row   ( blaze::rand<size_t>( 0UL, n-1UL ) );
+            const size_t column( blaze::rand<size_t>( 0UL, n-1UL ) );
+            tmp( std::max( row, column ), std::min( row, column ) ) = blaze::rand<int>( 1, 10 );
+         }
+
+         const LMT mat1( tmp );
+         const MT  mat2( trans( tmp ) );
+
+         if( mat1 != tmp || mat2 != trans( tmp ) || nonZeros( mat1 ) != nonZeros( tmp ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Construction failed\n"
+                << " Details:\n"
+                << "   Result (lower matrix):\n" << mat1 << "\n"
+                << "   Result (upper matrix):\n" << mat2 << "\n"
+                << "   Expected result:\n" << tmp << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "TriangularPackedMatrix non-triangular matrix constructor";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> tmp( 3UL, 3UL, 0 );
+      tmp(0,1) = 1;
+
+      try {
+         LMT mat( tmp );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of non-lower matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the TriangularPackedMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the TriangularPackedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   blaze::DynamicMatrix<int,blaze::rowMajor> tmp( 3UL, 3UL, 0 );
+   tmp(0,2) = 1;
+   tmp(1,1) = 2;
+   tmp(1,2) = 3;
+
+   {
+      test_ = "TriangularPackedMatrix homogeneous assignment";
+
+      MT mat( 3UL );
+      mat = 4;
+
+      checkNonZeros( mat, 6UL );
+
+      if( mat(0,0) != 4 || mat(0,2) != 4 || mat(2,0) != 0 || mat(2,2) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 4 4 4 )\n( 0 4 4 )\n( 0 0 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "TriangularPackedMatrix copy assignment";
+
+      const MT mat1( tmp );
+      MT mat2;
+      mat2 = mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2 != tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << tmp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "TriangularPackedMatrix addition/subtraction/multiplication assignment";
+
+      MT mat( tmp );
+      mat += tmp;
+      mat -= tmp * 3;
+      mat *= tmp;
+
+      if( mat != -tmp * tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << -tmp * tmp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "TriangularPackedMatrix non-triangular assignment";
+
+      MT mat( tmp );
+
+      try {
+         mat += trans( tmp );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment of non-upper matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( mat != tmp ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed assignment modified the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << tmp << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of all TriangularPackedMatrix (self-)scaling operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all available ways to scale an instance of the
+// TriangularPackedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testScaling()
+{
+   test_ = "TriangularPackedMatrix self-scaling";
+
+   LMT mat( 3UL, 0 );
+   mat(1,0) = 1;
+   mat(2,2) = 2;
+
+   mat *= 3;
+   mat.scale( 2 );
+   mat /= 3;
+
+   if( mat(1,0) != 2 || mat(0,1) != 0 || mat(2,2) != 4 || nonZeros( mat ) != 2UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Scaling failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n( 0 0 0 )\n( 2 0 0 )\n( 0 0 4 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the TriangularPackedMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the function call operator of the TriangularPackedMatrix
+// class template. Elements of the stored triangle can be modified freely, whereas any write
+// access to an element of the other triangle has to fail. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   {
+      test_ = "TriangularPackedMatrix::operator() (upper matrix)";
+
+      MT mat( 3UL, 0 );
+      mat(0,2) = 1;
+      mat(1,1) = 2;
+      mat(1,2) = 3;
+      mat(1,2) += 1;
+
+      checkNonZeros( mat, 3UL );
+
+      // Packed upper storage: ( 0 0 1 | 2 4 | 0 )
+      const int* const row0( mat.packedBegin( 0UL ) );
+      const int* const row1( mat.packedBegin( 1UL ) );
+
+      if( mat(0,2) != 1 || mat(2,1) != 0 || mat.packedEnd( 0UL ) - row0 != 3 ||
+          row0[2] != 1 || row1[0] != 2 || row1[1] != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 1 )\n( 0 2 4 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         mat(2,1) = 5;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment to lower matrix element succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "TriangularPackedMatrix::operator() (lower matrix)";
+
+      LMT mat( 3UL, 0 );
+      mat(2,0) = 1;
+      mat(1,1) = 2;
+      mat(2,1) = 3;
+      mat(2,1) *= 2;
+
+      checkNonZeros( mat, 3UL );
+
+      // Packed lower storage: ( 0 | 0 2 | 1 6 0 )
+      const int* const row2( mat.packedBegin( 2UL ) );
+
+      if( mat(2,0) != 1 || mat(1,2) != 0 || mat.packedEnd( 2UL ) - row2 != 3 ||
+          row2[0] != 1 || row2[1] != 6 || row2[2] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 0 2 0 )\n( 1 6 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         mat(0,1) += 1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment to upper matrix element succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the TriangularPackedMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the TriangularPackedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   LMT mat( 3UL, 0 );
+   mat(1,0) = 1;
+   mat(2,0) = 2;
+   mat(2,2) = 3;
+
+   {
+      test_ = "TriangularPackedMatrix iterator/const iterator conversion";
+
+      LMT::ConstIterator it( begin( mat, 1UL ) );
+
+      if( it == end( mat, 1UL ) || *it != 1 || end( mat, 1UL ) - it != 3L ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed iterator conversion detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "TriangularPackedMatrix iterator traversal";
+
+      int sum( 0 );
+      for( LMT::ConstIterator it=mat.cbegin(2UL); it!=mat.cend(2UL); ++it )
+         sum += *it;
+
+      if( sum != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator traversal failed\n"
+             << " Details:\n"
+             << "   Sum of row 2         : " << sum << "\n"
+             << "   Expected sum of row 2: 5\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "TriangularPackedMatrix assignment via iterator";
+
+      LMT::Iterator it( mat.begin( 2UL ) );
+      *it = 4;
+      ++it;
+      *it = 5;
+
+      try {
+         *(--mat.end( 1UL )) = 6;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment to upper matrix element via iterator succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( mat(2,0) != 4 || mat(2,1) != 5 || mat(2,2) != 3 || mat(1,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment via iterator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 1 0 0 )\n( 4 5 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the TriangularPackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the
+// TriangularPackedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   test_ = "TriangularPackedMatrix::nonZeros()";
+
+   MT mat( 4UL, 0 );
+
+   checkNonZeros( mat, 0UL );
+
+   mat(0,3) = 1;
+   mat(1,1) = 2;
+   mat(2,3) = 3;
+
+   checkNonZeros( mat, 3UL );
+   checkNonZeros( mat, 0UL, 1UL );
+   checkNonZeros( mat, 1UL, 1UL );
+   checkNonZeros( mat, 2UL, 1UL );
+   checkNonZeros( mat, 3UL, 0UL );
+
+   mat(0,3) = 0;
+
+   checkNonZeros( mat, 2UL );
+   checkNonZeros( mat, 0UL, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the TriangularPackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the TriangularPackedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   test_ = "TriangularPackedMatrix::reset()";
+
+   MT mat( 3UL, 1 );
+
+   reset( mat, 1UL );
+
+   checkRows    ( mat, 3UL );
+   checkNonZeros( mat, 4UL );
+   checkNonZeros( mat, 1UL, 0UL );
+
+   if( mat(0,1) != 1 || mat(1,2) != 0 || mat(2,2) != 1 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reset operation failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n( 1 1 1 )\n( 0 0 0 )\n( 0 0 1 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   reset( mat );
+
+   checkRows    ( mat, 3UL );
+   checkNonZeros( mat, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the TriangularPackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the TriangularPackedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "TriangularPackedMatrix::clear()";
+
+   LMT mat( 3UL, 1 );
+
+   clear( mat );
+
+   checkRows    ( mat, 0UL );
+   checkColumns ( mat, 0UL );
+   checkNonZeros( mat, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c resize() member function of the TriangularPackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c resize() member function of the TriangularPackedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   {
+      test_ = "TriangularPackedMatrix::resize() (upper matrix)";
+
+      MT mat( 2UL, 0 );
+      mat(0,1) = 1;
+      mat(1,1) = 2;
+
+      mat.resize( 4UL );
+
+      checkRows    ( mat, 4UL );
+      checkCapacity( mat, 10UL );
+
+      mat(0,0) = 0;
+      mat(0,2) = 0;
+      mat(0,3) = 0;
+      mat(1,2) = 0;
+      mat(1,3) = 0;
+      mat(2,2) = 3;
+      mat(2,3) = 0;
+      mat(3,3) = 0;
+
+      checkNonZeros( mat, 3UL );
+
+      mat.resize( 2UL );
+
+      checkRows    ( mat, 2UL );
+      checkNonZeros( mat, 2UL );
+
+      if( mat(0,1) != 1 || mat(1,0) != 0 || mat(1,1) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 )\n( 0 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "TriangularPackedMatrix::resize() (lower matrix)";
+
+      LMT mat( 3UL, 0 );
+      mat(1,0) = 1;
+      mat(2,1) = 2;
+
+      mat.resize( 5UL );
+
+      for( size_t i=3UL; i<5UL; ++i ) {
+         for( size_t j=0UL; j<=i; ++j ) {
+            mat(i,j) = 0;
+         }
+      }
+
+      checkRows    ( mat, 5UL );
+      checkNonZeros( mat, 2UL );
+
+      if( mat(1,0) != 1 || mat(2,1) != 2 || mat(0,1) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the TriangularPackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the TriangularPackedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "TriangularPackedMatrix swap";
+
+   MT mat1( 2UL, 1 );
+   MT mat2( 3UL, 0 );
+   mat2(0,2) = 2;
+
+   swap( mat1, mat2 );
+
+   checkRows    ( mat1, 3UL );
+   checkNonZeros( mat1, 1UL );
+   checkRows    ( mat2, 2UL );
+   checkNonZeros( mat2, 3UL );
+
+   if( mat1(0,2) != 2 || mat2(0,1) != 1 || mat2(1,0) != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the matrices failed\n"
+          << " Details:\n"
+          << "   First matrix:\n" << mat1 << "\n"
+          << "   Second matrix:\n" << mat2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the TriangularPackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the TriangularPackedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   test_ = "isDefault() function";
+
+   LMT mat( 3UL, 0 );
+
+   if( isDefault( mat ) != false || isDefault( LMT() ) != true ||
+       isDefault( mat(0,1) ) != true ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid isDefault evaluation\n"
+          << " Details:\n"
+          << "   Matrix:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the TriangularPackedMatrix multiplication kernels.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the packed kernels of the matrix/vector and the matrix/matrix
+// multiplication (including submatrices of the packed matrix, as they occur during the
+// parallel execution) by comparing the results with the multiplication of a general dense
+// matrix. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMultiplication()
+{
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>     DMT;
+   typedef blaze::DynamicMatrix<double,blaze::columnMajor>  ODMT;
+   typedef blaze::TriangularPackedMatrix<double,true>       TUMT;
+   typedef blaze::TriangularPackedMatrix<double,false>      TLMT;
+   typedef blaze::DynamicVector<double,blaze::columnVector> DVT;
+
+   const size_t sizes[] = { 0UL, 1UL, 3UL, 8UL, 17UL, 64UL, 129UL };
+
+   for( size_t a=0UL; a<sizeof(sizes)/sizeof(size_t); ++a )
+   {
+      const size_t n( sizes[a] );
+
+      DMT A( n, n, 0.0 );
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=i; j<n; ++j ) {
+            A(i,j) = blaze::rand<int>( -10, 10 );
+         }
+      }
+
+      DMT B( n, 5UL );
+      for( size_t i=0UL; i<n; ++i )
+         for( size_t j=0UL; j<5UL; ++j )
+            B(i,j) = blaze::rand<int>( -10, 10 );
+
+      DVT x( n );
+      for( size_t j=0UL; j<n; ++j )
+         x[j] = blaze::rand<int>( -10, 10 );
+
+      const TUMT U( A );
+      const TLMT L( trans( A ) );
+
+      {
+         test_ = "TriangularPackedMatrix/dense vector multiplication";
+
+         const DVT ref1( A * x );
+         const DVT ref2( trans( A ) * x );
+         const DVT one( n, 1.0 );
+         DVT y1( one ), y2( one ), y3( one ), y4( one );
+
+         y1  = U * x;
+         y2 += U * x;
+         y3 -= L * x;
+         y4  = L * x;
+
+         bool failure( y1 != ref1 || y2 != one + ref1 || y3 != one - ref2 || y4 != ref2 );
+
+         if( n > 2UL )
+         {
+            const DVT r1( submatrix( A, 1UL, 0UL, n-2UL, n ) * x );
+            const DVT r2( submatrix( trans( A ), 1UL, 1UL, n-2UL, n-2UL ) * subvector( x, 1UL, n-2UL ) );
+
+            const DVT s1( submatrix( U, 1UL, 0UL, n-2UL, n ) * x );
+            const DVT s2( submatrix( L, 1UL, 1UL, n-2UL, n-2UL ) * subvector( x, 1UL, n-2UL ) );
+
+            failure = failure || s1 != r1 || s2 != r2;
+         }
+
+         if( failure ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Matrix size: " << n << "x" << n << "\n"
+                << "   Result:\n" << y1 << "\n"
+                << "   Expected result:\n" << ref1 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         test_ = "TriangularPackedMatrix/dense matrix multiplication";
+
+         const DMT ref1( A * B );
+         const DMT ref2( trans( A ) * B );
+         DMT  C1( n, 5UL, 1.0 ), C2( n, 5UL, 1.0 );
+         ODMT C3( n, 5UL, 1.0 );
+
+         C1  = U * B;
+         C2 += L * B;
+         C3 -= U * B;
+
+         bool failure( C1 != ref1 || C2 != ref2 + DMT( n, 5UL, 1.0 ) || C3 != DMT( n, 5UL, 1.0 ) - ref1 );
+
+         if( n > 2UL )
+         {
+            const DMT r1( submatrix( A, 1UL, 0UL, n-2UL, n ) * B );
+            const DMT s1( submatrix( U, 1UL, 0UL, n-2UL, n ) * B );
+
+            failure = failure || s1 != r1;
+         }
+
+         if( failure ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Matrix size: " << n << "x" << n << "\n"
+                << "   Result:\n" << C1 << "\n"
+                << "   Expected result:\n" << ref1 << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the serialization of the TriangularPackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the serialization and deserialization of instances of the
+// TriangularPackedMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testSerialization()
+{
+   {
+      test_ = "TriangularPackedMatrix serialization";
+
+      LMT mat1( 5UL, 0 );
+      mat1(4,0) = 1;
+      mat1(2,1) = 2;
+      mat1(3,3) = 3;
+
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+      archive << mat1;
+
+      LMT mat2( 2UL, 7 );
+      archive >> mat2;
+
+      checkRows    ( mat2, 5UL );
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2 != mat1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Serialization failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n" << mat1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "TriangularPackedMatrix deserialization of a non-triangular matrix";
+
+      LMT mat1( 3UL, 1 );
+
+      std::stringstream stream;
+      blaze::Archive<std::stringstream> archive( stream );
+      archive << mat1;
+
+      MT mat2;
+
+      try {
+         archive >> mat2;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Deserialization of lower matrix into upper matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+} // namespace triangularpackedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running TriangularPackedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_TRIANGULARPACKEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during TriangularPackedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,590 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/compressedstream/ClassTest.cpp
+//  \brief Source file for the CompressedStream class test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/ThreadLimit.h>
+#include <blazetest/utiltest/compressedstream/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace compressedstream {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompressedStream class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testScalars();
+   testDenseMatrix();
+   testSparseMatrix();
+   testVectors();
+   testCompression();
+   testConfiguration();
+   testSerialSection();
+   testFailures();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the serialization of built-in data values.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function writes a sequence of built-in data values of different types to a compressed
+// stream and reads them back. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testScalars()
+{
+   test_ = "Serialization of built-in data values";
+
+   std::stringstream ss;
+
+   {
+      Stream stream( ss );
+      blaze::Archive<Stream> archive( stream );
+      archive << 'a' << short( -2 ) << 3 << 4UL << 5.5F << 6.5 << blaze::complex<float>( 7.0F, 8.0F );
+
+      const int array[5] = { 1, 2, 3, 5, 8 };
+      archive.write( array, 5UL );
+   }
+
+   char c( 0 );
+   short s( 0 );
+   int i( 0 );
+   unsigned long ul( 0UL );
+   float f( 0.0F );
+   double d( 0.0 );
+   blaze::complex<float> z;
+   int array[5] = { 0, 0, 0, 0, 0 };
+
+   Stream stream( ss );
+   blaze::Archive<Stream> archive( stream );
+   archive >> c >> s >> i >> ul >> f >> d >> z;
+   archive.read( array, 5UL );
+
+   if( archive.fail() || c != 'a' || s != -2 || i != 3 || ul != 4UL || f != 5.5F || d != 6.5 ||
+       z != blaze::complex<float>( 7.0F, 8.0F ) || array[0] != 1 || array[1] != 2 ||
+       array[2] != 3 || array[3] != 5 || array[4] != 8 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Deserialization failed\n"
+          << " Details:\n"
+          << "   Result: " << c << " " << s << " " << i << " " << ul << " " << f << " " << d << " " << z
+          << " ( " << array[0] << " " << array[1] << " " << array[2] << " " << array[3] << " " << array[4] << " )\n"
+          << "   Expected result: a -2 3 4 5.5 6.5 (7,8) ( 1 2 3 5 8 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   archive >> c;
+
+   if( !archive.eof() || !archive.fail() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reading beyond the end of the data succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the serialization of dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function serializes dense matrices via a compressed stream with all combinations of
+// filters and several block sizes and numbers of threads. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testDenseMatrix()
+{
+   test_ = "Serialization of dense matrices";
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 97UL, 61UL );
+   for( size_t i=0UL; i<A.rows(); ++i )
+      for( size_t j=0UL; j<A.columns(); ++j )
+         A(i,j) = 0.25*i - 0.5*j + ( ( i*j ) % 7UL );
+
+   blaze::DynamicMatrix<int,blaze::columnMajor> B( 33UL, 47UL );
+   for( size_t i=0UL; i<B.rows(); ++i )
+      for( size_t j=0UL; j<B.columns(); ++j )
+         B(i,j) = int( i*j ) - 500;
+
+   for( int filters=0; filters<4; ++filters ) {
+      runRoundTrip( A, filters, 1048576UL, 1UL );
+      runRoundTrip( A, filters, 1024UL, 1UL );
+      runRoundTrip( A, filters, 1024UL, 3UL );
+      runRoundTrip( B, filters, 2000UL, 2UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the serialization of sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function serializes sparse matrices via a compressed stream with all combinations of
+// filters and several block sizes and numbers of threads. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSparseMatrix()
+{
+   test_ = "Serialization of sparse matrices";
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 200UL, 150UL );
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      A.reserve( i, 10UL );
+      for( size_t j=i%5UL; j<A.columns(); j+=17UL )
+         A.append( i, j, 1.0 + 0.5*j );
+      A.finalize( i );
+   }
+
+   blaze::CompressedMatrix<float,blaze::columnMajor> B( 31UL, 73UL, 600UL );
+   for( size_t j=0UL; j<B.columns(); ++j ) {
+      for( size_t i=j%3UL; i<B.rows(); i+=4UL )
+         B.append( i, j, float( i ) - float( j ) );
+      B.finalize( j );
+   }
+
+   for( int filters=0; filters<4; ++filters ) {
+      runRoundTrip( A, filters, 1048576UL, 1UL );
+      runRoundTrip( A, filters, 1024UL, 1UL );
+      runRoundTrip( A, filters, 1024UL, 4UL );
+      runRoundTrip( B, filters, 1500UL, 2UL );
+   }
+
+   runRoundTrip( blaze::CompressedMatrix<int>(), blaze::shuffleFilter, 1024UL, 2UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the serialization of dense and sparse vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function serializes dense and sparse vectors via a compressed stream. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testVectors()
+{
+   test_ = "Serialization of vectors";
+
+   blaze::DynamicVector<double> a( 5000UL );
+   for( size_t i=0UL; i<a.size(); ++i )
+      a[i] = 0.001 * i;
+
+   blaze::CompressedVector<short> b( 10000UL, 1112UL );
+   for( size_t i=0UL; i<b.size(); i+=9UL )
+      b.append( i, short( i % 100UL ) );
+
+   for( int filters=0; filters<4; ++filters ) {
+      runRoundTrip( a, filters, 1024UL, 1UL );
+      runRoundTrip( a, filters, 4096UL, 3UL );
+      runRoundTrip( b, filters, 1024UL, 2UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the compression ratio.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the compressed representation of a structured sparse matrix is
+// smaller than its uncompressed representation and that the delta filter further reduces the
+// size of the compressed representation. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testCompression()
+{
+   test_ = "Compression ratio";
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 500UL, 500UL, 84000UL );
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); j+=3UL )
+         A.append( i, j, 2.0 );
+      A.finalize( i );
+   }
+
+   std::stringstream raw;
+
+   {
+      blaze::Archive<std::stringstream> archive( raw );
+      archive << A;
+   }
+
+   std::stringstream shuffled;
+
+   {
+      Stream stream( shuffled );
+      stream.setFilters( blaze::shuffleFilter );
+      blaze::Archive<Stream> archive( stream );
+      archive << A;
+   }
+
+   std::stringstream delta;
+
+   {
+      Stream stream( delta );
+      stream.setFilters( blaze::shuffleFilter | blaze::deltaFilter );
+      blaze::Archive<Stream> archive( stream );
+      archive << A;
+   }
+
+   const size_t rawSize     ( raw.str().size() );
+   const size_t shuffledSize( shuffled.str().size() );
+   const size_t deltaSize   ( delta.str().size() );
+
+   if( shuffledSize >= rawSize / 4UL || deltaSize >= shuffledSize ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Insufficient compression\n"
+          << " Details:\n"
+          << "   Uncompressed size        = " << rawSize << "\n"
+          << "   Size with shuffle filter = " << shuffledSize << "\n"
+          << "   Size with delta filter   = " << deltaSize << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the configuration functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the configuration functions of the CompressedStream class template. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConfiguration()
+{
+   test_ = "Configuration functions";
+
+   Stream stream;
+
+   if( stream.blockSize() != 1048576UL || stream.filters() != blaze::shuffleFilter || stream.threads() == 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid default configuration\n"
+          << " Details:\n"
+          << "   Block size = " << stream.blockSize() << "\n"
+          << "   Filters    = " << stream.filters() << "\n"
+          << "   Threads    = " << stream.threads() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      stream.setBlockSize( 100UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting an invalid block size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      stream.setFilters( 8 );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting invalid compression filters succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      stream.setThreads( 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting an invalid number of threads succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the compression within serial sections and with thread limits.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function serializes a dense matrix via a compressed stream with several threads within
+// a serial section and with a thread limit of the calling thread, in which case the blocks are
+// processed by fewer threads than specified via the setThreads() function. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSerialSection()
+{
+   test_ = "Serialization within serial sections";
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 67UL, 53UL );
+   for( size_t i=0UL; i<A.rows(); ++i )
+      for( size_t j=0UL; j<A.columns(); ++j )
+         A(i,j) = 0.5*i - 0.25*j + ( ( i+j ) % 5UL );
+
+   BLAZE_SERIAL_SECTION
+   {
+      runRoundTrip( A, blaze::shuffleFilter, 1024UL, 4UL );
+   }
+
+   test_ = "Serialization with thread limits";
+
+   BLAZE_THREAD_LIMIT( 1UL )
+   {
+      runRoundTrip( A, blaze::shuffleFilter, 1024UL, 4UL );
+   }
+
+   BLAZE_THREAD_LIMIT( 2UL )
+   {
+      runRoundTrip( A, blaze::shuffleFilter | blaze::deltaFilter, 1024UL, 5UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the failure handling of the CompressedStream class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that reading from an invalid, truncated, or corrupted compressed stream
+// and reading with mismatching types fails. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFailures()
+{
+   test_ = "Failure handling";
+
+   blaze::DynamicVector<double> a( 1000UL );
+   for( size_t i=0UL; i<a.size(); ++i )
+      a[i] = 1.0 + i;
+
+   std::stringstream ss;
+
+   {
+      Stream stream( ss );
+      blaze::Archive<Stream> archive( stream );
+      archive << a;
+   }
+
+   const std::string data( ss.str() );
+
+   // Reading from an uncompressed stream (note that the deserialization of vectors and matrices
+   // throws a std::runtime_error exception in case the archive is corrupt)
+   {
+      std::stringstream raw;
+      {
+         blaze::Archive<std::stringstream> archive( raw );
+         archive << a;
+      }
+
+      blaze::DynamicVector<double> b;
+      Stream stream( raw );
+      blaze::Archive<Stream> archive( stream );
+
+      bool failed( false );
+      try {
+         failed = !( archive >> b );
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reading from an uncompressed stream succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Reading from a truncated stream
+   {
+      std::stringstream truncated( data.substr( 0UL, data.size() - 10UL ) );
+
+      blaze::DynamicVector<double> b;
+      Stream stream( truncated );
+      blaze::Archive<Stream> archive( stream );
+
+      bool failed( false );
+      try {
+         failed = !( archive >> b );
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reading from a truncated stream succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Reading from a corrupted stream
+   {
+      std::string corrupt( data );
+      corrupt[20UL] = ~corrupt[20UL];
+      corrupt[21UL] = ~corrupt[21UL];
+      std::stringstream corrupted( corrupt );
+
+      blaze::DynamicVector<double> b;
+      Stream stream( corrupted );
+      blaze::Archive<Stream> archive( stream );
+
+      bool failed( false );
+      try {
+         failed = !( archive >> b ) || b != a;
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reading from a corrupted stream succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Reading with mismatching types
+   {
+      std::stringstream mixed;
+
+      {
+         Stream stream( mixed );
+         blaze::Archive<Stream> archive( stream );
+         archive << 1.0 << 2.0;
+      }
+
+      int i( 0 );
+      Stream stream( mixed );
+      blaze::Archive<Stream> archive( stream );
+
+      if( archive >> i ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reading with mismatching types succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace compressedstream
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompressedStream class test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSEDSTREAM_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompressedStream class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
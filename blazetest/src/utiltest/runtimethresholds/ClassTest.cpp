@@ -0,0 +1,514 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/runtimethresholds/ClassTest.cpp
+//  \brief Source file for the runtime thresholds test
+//
+//  Copyright (C) 2013 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blazetest/utiltest/runtimethresholds/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace runtimethresholds {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the runtime thresholds test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testGetThreshold();
+   testSetThreshold();
+   testLoadThresholds();
+   testInvalidFiles();
+   testStartupFile();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the getThreshold() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the runtime thresholds are initialized with their default values
+// and that querying an unknown threshold results in a \a std::invalid_argument exception. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testGetThreshold()
+{
+   test_ = "getThreshold() function";
+
+   checkThresholds( blaze::thresholds::SMP_DVECASSIGN_THRESHOLD::value(),
+                    blaze::thresholds::SMP_DMATASSIGN_THRESHOLD::value() );
+
+   try {
+      blaze::getThreshold( "UNKNOWN_THRESHOLD" );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Querying an unknown threshold succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the setThreshold() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the setThreshold() function changes the value of a single threshold
+// and that changing an unknown threshold results in a \a std::invalid_argument exception. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSetThreshold()
+{
+   test_ = "setThreshold() function";
+
+   const size_t dmatassign( blaze::thresholds::SMP_DMATASSIGN_THRESHOLD::value() );
+
+   blaze::setThreshold( "SMP_DVECASSIGN_THRESHOLD", 1234UL );
+   checkThresholds( 1234UL, dmatassign );
+
+   blaze::setThreshold( "SMP_DVECASSIGN_THRESHOLD", 0UL );
+   checkThresholds( 0UL, dmatassign );
+
+   try {
+      blaze::setThreshold( "UNKNOWN_THRESHOLD", 5UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Changing an unknown threshold succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   checkThresholds( 0UL, dmatassign );
+
+   blaze::setThreshold( "SMP_DVECASSIGN_THRESHOLD",
+                        blaze::thresholds::SMP_DVECASSIGN_THRESHOLD::value() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the loadThresholds() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function loads a threshold file containing comments, empty lines and arbitrary white
+// space. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLoadThresholds()
+{
+   test_ = "loadThresholds() function";
+
+   const std::string file( "RuntimeThresholdsTest.txt" );
+
+   writeFile( file, "# Thresholds for the runtime thresholds test\n"
+                    "\n"
+                    "SMP_DVECASSIGN_THRESHOLD 4321\n"
+                    "   \t\n"
+                    "  SMP_DMATASSIGN_THRESHOLD\t  17   # Trailing comment\n"
+                    "#SMP_DVECASSIGN_THRESHOLD 1\n" );
+
+   blaze::loadThresholds( file );
+   checkThresholds( 4321UL, 17UL );
+
+   writeFile( file, "SMP_DVECASSIGN_THRESHOLD 11\n"
+                    "SMP_DVECASSIGN_THRESHOLD 12" );
+
+   blaze::loadThresholds( file );
+   checkThresholds( 12UL, 17UL );
+
+   writeFile( file, "# Only comments\n\n" );
+
+   blaze::loadThresholds( file );
+   checkThresholds( 12UL, 17UL );
+
+   std::remove( file.c_str() );
+
+   blaze::setThreshold( "SMP_DVECASSIGN_THRESHOLD",
+                        blaze::thresholds::SMP_DVECASSIGN_THRESHOLD::value() );
+   blaze::setThreshold( "SMP_DMATASSIGN_THRESHOLD",
+                        blaze::thresholds::SMP_DMATASSIGN_THRESHOLD::value() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the loadThresholds() function with invalid threshold files.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that missing threshold files and threshold files with malformed lines
+// result in a \a std::runtime_error exception and that threshold files with unknown thresholds
+// result in a \a std::invalid_argument exception. Since the function is all-or-nothing, none
+// of the thresholds must be modified, even if the invalid line follows valid lines. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testInvalidFiles()
+{
+   test_ = "loadThresholds() function with invalid files";
+
+   const size_t dvecassign( blaze::thresholds::SMP_DVECASSIGN_THRESHOLD::value() );
+   const size_t dmatassign( blaze::thresholds::SMP_DMATASSIGN_THRESHOLD::value() );
+
+   const std::string file( "RuntimeThresholdsTest.txt" );
+
+   const char* const malformed[] = {
+      "SMP_DVECASSIGN_THRESHOLD 5\nSMP_DMATASSIGN_THRESHOLD\n",
+      "SMP_DVECASSIGN_THRESHOLD 5\nSMP_DMATASSIGN_THRESHOLD many\n",
+      "SMP_DVECASSIGN_THRESHOLD 5\nSMP_DMATASSIGN_THRESHOLD 6 7\n",
+      "SMP_DVECASSIGN_THRESHOLD 5\nSMP_DMATASSIGN_THRESHOLD -6\n",
+      "SMP_DVECASSIGN_THRESHOLD 5\nSMP_DMATASSIGN_THRESHOLD=6\n",
+      "SMP_DVECASSIGN_THRESHOLD 5\nSMP_DMATASSIGN_THRESHOLD 6.5\n"
+   };
+
+   for( size_t i=0UL; i<sizeof( malformed )/sizeof( const char* ); ++i )
+   {
+      writeFile( file, malformed[i] );
+
+      try {
+         blaze::loadThresholds( file );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Loading a malformed threshold file succeeded\n"
+             << " Details:\n"
+             << "   File:\n" << malformed[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ) != "Invalid threshold file" )
+            throw;
+      }
+
+      checkThresholds( dvecassign, dmatassign );
+   }
+
+   writeFile( file, "SMP_DVECASSIGN_THRESHOLD 5\n"
+                    "SMP_DMATASSIGN_THRESHOLD 6\n"
+                    "UNKNOWN_THRESHOLD 7\n" );
+
+   try {
+      blaze::loadThresholds( file );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Loading a threshold file with an unknown threshold succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   checkThresholds( dvecassign, dmatassign );
+
+   std::remove( file.c_str() );
+
+   try {
+      blaze::loadThresholds( file );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Loading a missing threshold file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ) != "Invalid threshold file" )
+         throw;
+   }
+
+   checkThresholds( dvecassign, dmatassign );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the threshold file loaded at program startup.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the loading of the threshold file named by the \c BLAZE_THRESHOLD_FILE
+// environment variable. Since the table of the Blaze thresholds has already been created during
+// the static initialization of the test, the test uses separate threshold tables for other
+// value types, which are created on their first use. The values of a valid file take precedence
+// over the default values of the registered thresholds, whereas missing files and files with
+// malformed lines are silently ignored. Thresholds of the file that are never registered cannot
+// be queried or changed. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testStartupFile()
+{
+   test_ = "Threshold file at program startup";
+
+   const std::string file( "RuntimeThresholdsTest.txt" );
+
+   // Loading a valid threshold file
+   {
+      typedef blaze::ThresholdTable<unsigned int>  Table;
+
+      writeFile( file, "# Startup thresholds\n"
+                       "ALPHA 17  # Comment\n"
+                       "\n"
+                       "GAMMA 5\n" );
+      setEnvironment( "BLAZE_THRESHOLD_FILE", file.c_str() );
+
+      unsigned int alpha( 0U ), beta( 0U );
+
+      alpha = Table::attach( "ALPHA", 1U, &alpha );
+      beta  = Table::attach( "BETA" , 2U, &beta  );
+
+      if( alpha != 17U || beta != 2U || Table::get( "ALPHA" ) != 17U ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid threshold values\n"
+             << " Details:\n"
+             << "   Result: ALPHA=" << alpha << " BETA=" << beta << "\n"
+             << "   Expected result: ALPHA=17 BETA=2\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      Table::set( "ALPHA", 23U );
+
+      if( alpha != 23U || Table::get( "ALPHA" ) != 23U ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Changing a threshold failed\n"
+             << " Details:\n"
+             << "   Result: " << alpha << "\n"
+             << "   Expected result: 23\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         Table::get( "GAMMA" );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Querying an unregistered threshold succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   // Ignoring a malformed threshold file
+   {
+      typedef blaze::ThresholdTable<unsigned short>  Table;
+
+      writeFile( file, "ALPHA 17\n"
+                       "BETA\n" );
+      setEnvironment( "BLAZE_THRESHOLD_FILE", file.c_str() );
+
+      unsigned short alpha( 0U );
+      alpha = Table::attach( "ALPHA", 1U, &alpha );
+
+      if( alpha != 1U ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Malformed threshold file has not been ignored\n"
+             << " Details:\n"
+             << "   Result: " << alpha << "\n"
+             << "   Expected result: 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   std::remove( file.c_str() );
+
+   // Ignoring a missing threshold file
+   {
+      typedef blaze::ThresholdTable<int>  Table;
+
+      setEnvironment( "BLAZE_THRESHOLD_FILE", file.c_str() );
+
+      int alpha( 0 );
+      alpha = Table::attach( "ALPHA", 1, &alpha );
+
+      if( alpha != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Missing threshold file has not been ignored\n"
+             << " Details:\n"
+             << "   Result: " << alpha << "\n"
+             << "   Expected result: 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the current values of the two test thresholds.
+//
+// \param dvecassign The expected value of the SMP_DVECASSIGN_THRESHOLD.
+// \param dmatassign The expected value of the SMP_DMATASSIGN_THRESHOLD.
+// \return void
+// \exception std::runtime_error Invalid threshold value detected.
+//
+// This function checks both the values returned by the getThreshold() function and the values
+// the thresholds themselves convert to. In case any of the values differs from the expected
+// value, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::checkThresholds( size_t dvecassign, size_t dmatassign )
+{
+   const size_t dvec( blaze::SMP_DVECASSIGN_THRESHOLD );
+   const size_t dmat( blaze::SMP_DMATASSIGN_THRESHOLD );
+
+   if( dvec != dvecassign || blaze::getThreshold( "SMP_DVECASSIGN_THRESHOLD" ) != dvecassign ||
+       dmat != dmatassign || blaze::getThreshold( "SMP_DMATASSIGN_THRESHOLD" ) != dmatassign ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid threshold values\n"
+          << " Details:\n"
+          << "   SMP_DVECASSIGN_THRESHOLD: " << dvec << " (" << blaze::getThreshold( "SMP_DVECASSIGN_THRESHOLD" ) << ")\n"
+          << "   SMP_DMATASSIGN_THRESHOLD: " << dmat << " (" << blaze::getThreshold( "SMP_DMATASSIGN_THRESHOLD" ) << ")\n"
+          << "   Expected result: " << dvecassign << " " << dmatassign << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writing the given content to the given file.
+//
+// \param file The name of the file.
+// \param content The new content of the file.
+// \return void
+// \exception std::runtime_error The file could not be written.
+*/
+void ClassTest::writeFile( const std::string& file, const std::string& content )
+{
+   std::ofstream out( file.c_str(), std::ios::trunc );
+   out << content;
+
+   if( !out )
+      throw std::runtime_error( "Writing the threshold file " + file + " failed" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the given environment variable.
+//
+// \param name The name of the environment variable.
+// \param value The new value of the environment variable.
+// \return void
+*/
+void ClassTest::setEnvironment( const char* name, const char* value )
+{
+#if (defined _MSC_VER)
+   _putenv_s( name, value );
+#else
+   setenv( name, value, 1 );
+#endif
+}
+//*************************************************************************************************
+
+} // namespace runtimethresholds
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running runtime thresholds test..." << std::endl;
+
+   try
+   {
+      RUN_RUNTIMETHRESHOLDS_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during runtime thresholds test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************